@@ -0,0 +1,120 @@
+#include <benchmark/benchmark.h>
+
+#include <components/esm/loadland.hpp>
+#include <components/esmterrain/storage.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace
+{
+    ESM::Land generateLand()
+    {
+        std::minstd_rand random;
+        std::uniform_int_distribution<int> colour(0, 255);
+
+        ESM::Land land;
+        land.blank();
+        land.mX = 0;
+        land.mY = 0;
+
+        ESM::Land::LandData* data = land.getLandData();
+        data->mMinHeight = std::numeric_limits<float>::max();
+        data->mMaxHeight = -std::numeric_limits<float>::max();
+        for (int y = 0; y < ESM::Land::LAND_SIZE; ++y)
+        {
+            for (int x = 0; x < ESM::Land::LAND_SIZE; ++x)
+            {
+                const float height = 512.f * (std::sin(x * 0.3f) + std::cos(y * 0.2f));
+                data->mHeights[y * ESM::Land::LAND_SIZE + x] = height;
+                data->mMinHeight = std::min(data->mMinHeight, height);
+                data->mMaxHeight = std::max(data->mMaxHeight, height);
+
+                const int vertex = y * ESM::Land::LAND_SIZE + x;
+                data->mColours[vertex * 3] = colour(random);
+                data->mColours[vertex * 3 + 1] = colour(random);
+                data->mColours[vertex * 3 + 2] = colour(random);
+            }
+        }
+
+        return land;
+    }
+
+    // Minimal in-memory Storage implementation serving the same procedurally generated
+    // cell everywhere, so the benchmark measures fillVertexBuffers itself rather than
+    // any store lookup.
+    class TestStorage : public ESMTerrain::Storage
+    {
+    public:
+        TestStorage()
+            : ESMTerrain::Storage(nullptr)
+            , mLand(generateLand())
+            , mLandObject(new ESMTerrain::LandObject(&mLand, ESM::Land::DATA_VHGT | ESM::Land::DATA_VNML | ESM::Land::DATA_VCLR | ESM::Land::DATA_VTEX))
+        {
+        }
+
+        osg::ref_ptr<const ESMTerrain::LandObject> getLand(int cellX, int cellY) override
+        {
+            return mLandObject;
+        }
+
+        const ESM::LandTexture* getLandTexture(int index, short plugin) override
+        {
+            return nullptr;
+        }
+
+        void getBounds(float& minX, float& maxX, float& minY, float& maxY) override
+        {
+            minX = -32;
+            maxX = 32;
+            minY = -32;
+            maxY = 32;
+        }
+
+    private:
+        ESM::Land mLand;
+        osg::ref_ptr<ESMTerrain::LandObject> mLandObject;
+    };
+
+    void fillVertexBuffers(benchmark::State& state)
+    {
+        TestStorage storage;
+        const int lodLevel = static_cast<int>(state.range(0));
+        const float size = static_cast<float>(state.range(1));
+        const osg::Vec2f center(size * 0.5f, size * 0.5f);
+
+        for (auto _ : state)
+        {
+            osg::ref_ptr<osg::Vec3Array> positions(new osg::Vec3Array);
+            osg::ref_ptr<osg::Vec3Array> normals(new osg::Vec3Array);
+            osg::ref_ptr<osg::Vec4ubArray> colours(new osg::Vec4ubArray);
+            storage.fillVertexBuffers(lodLevel, size, center, positions, normals, colours);
+            benchmark::DoNotOptimize(positions->size());
+        }
+    }
+
+    void getMinMaxHeights(benchmark::State& state)
+    {
+        TestStorage storage;
+        const osg::Vec2f center(0.5f, 0.5f);
+
+        for (auto _ : state)
+        {
+            float min = 0.f;
+            float max = 0.f;
+            storage.getMinMaxHeights(1.f, center, min, max);
+            benchmark::DoNotOptimize(max);
+        }
+    }
+} // namespace
+
+BENCHMARK(fillVertexBuffers)
+    ->Args({0, 1})
+    ->Args({0, 4})
+    ->Args({1, 4})
+    ->Args({2, 8});
+BENCHMARK(getMinMaxHeights);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,190 @@
+#include <benchmark/benchmark.h>
+
+#include <components/misc/stringops.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    std::atomic<std::size_t> allocationCount{0};
+}
+
+// Count every heap allocation so the lookup benchmarks below can report how
+// many allocations a case-insensitive probe costs per iteration.
+void* operator new(std::size_t count)
+{
+    ++allocationCount;
+    if (void* ptr = std::malloc(count))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t count)
+{
+    ++allocationCount;
+    if (void* ptr = std::malloc(count))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+    template <typename Random>
+    std::string generateString(std::size_t length, Random& random)
+    {
+        std::uniform_int_distribution<int> letter('a', 'z');
+        std::uniform_int_distribution<int> upper(0, 1);
+        std::string result;
+        result.reserve(length);
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            const char value = static_cast<char>(letter(random));
+            result += upper(random) ? static_cast<char>(value - 'a' + 'A') : value;
+        }
+        return result;
+    }
+
+    void ciEqualMatching(benchmark::State& state)
+    {
+        std::minstd_rand random;
+        const std::string lhs = generateString(static_cast<std::size_t>(state.range(0)), random);
+        std::string rhs = lhs;
+        Misc::StringUtils::lowerCaseInPlace(rhs);
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(Misc::StringUtils::ciEqual(lhs, rhs));
+    }
+
+    void ciEqualNonMatching(benchmark::State& state)
+    {
+        std::minstd_rand random;
+        const std::string lhs = generateString(static_cast<std::size_t>(state.range(0)), random);
+        const std::string rhs = generateString(static_cast<std::size_t>(state.range(0)), random);
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(Misc::StringUtils::ciEqual(lhs, rhs));
+    }
+
+    void lowerCase(benchmark::State& state)
+    {
+        std::minstd_rand random;
+        std::vector<std::string> strings;
+        for (std::size_t i = 0; i < 64; ++i)
+            strings.push_back(generateString(static_cast<std::size_t>(state.range(0)), random));
+
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Misc::StringUtils::lowerCase(strings[i]));
+            i = (i + 1) % strings.size();
+        }
+    }
+    template <typename Random>
+    std::vector<std::string> generateQueries(std::size_t count, std::size_t length, Random& random)
+    {
+        std::vector<std::string> queries;
+        queries.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            queries.push_back(generateString(length, random));
+        return queries;
+    }
+
+    void reportAllocations(benchmark::State& state, std::size_t before)
+    {
+        state.counters["allocs"] = benchmark::Counter(
+            static_cast<double>(allocationCount.load() - before), benchmark::Counter::kAvgIterations);
+    }
+
+    // The pattern the transparent comparators replace: lowercase the query,
+    // then probe a map keyed by lowercased strings.
+    void ciMapLookupLowerCased(benchmark::State& state)
+    {
+        std::minstd_rand random;
+        const std::vector<std::string> queries = generateQueries(512, static_cast<std::size_t>(state.range(0)), random);
+        std::map<std::string, int> map;
+        for (std::size_t i = 0; i < queries.size(); ++i)
+            map.emplace(Misc::StringUtils::lowerCase(queries[i]), static_cast<int>(i));
+
+        std::size_t i = 0;
+        const std::size_t before = allocationCount.load();
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(map.find(Misc::StringUtils::lowerCase(queries[i])));
+            i = (i + 1) % queries.size();
+        }
+        reportAllocations(state, before);
+    }
+
+    void ciMapLookupTransparent(benchmark::State& state)
+    {
+        std::minstd_rand random;
+        const std::vector<std::string> queries = generateQueries(512, static_cast<std::size_t>(state.range(0)), random);
+        std::map<std::string, int, Misc::StringUtils::CiComp> map;
+        for (std::size_t i = 0; i < queries.size(); ++i)
+            map.emplace(queries[i], static_cast<int>(i));
+
+        std::size_t i = 0;
+        const std::size_t before = allocationCount.load();
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(map.find(std::string_view(queries[i])));
+            i = (i + 1) % queries.size();
+        }
+        reportAllocations(state, before);
+    }
+
+    void ciUnorderedMapLookup(benchmark::State& state)
+    {
+        std::minstd_rand random;
+        const std::vector<std::string> queries = generateQueries(512, static_cast<std::size_t>(state.range(0)), random);
+        std::unordered_map<std::string, int, Misc::StringUtils::CiHash, Misc::StringUtils::CiEqualTo> map;
+        for (std::size_t i = 0; i < queries.size(); ++i)
+            map.emplace(queries[i], static_cast<int>(i));
+
+        std::size_t i = 0;
+        const std::size_t before = allocationCount.load();
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(map.find(queries[i]));
+            i = (i + 1) % queries.size();
+        }
+        reportAllocations(state, before);
+    }
+} // namespace
+
+BENCHMARK(ciEqualMatching)->Arg(8)->Arg(32)->Arg(256);
+BENCHMARK(ciEqualNonMatching)->Arg(8)->Arg(32)->Arg(256);
+BENCHMARK(lowerCase)->Arg(8)->Arg(32)->Arg(256);
+BENCHMARK(ciMapLookupLowerCased)->Arg(32);
+BENCHMARK(ciMapLookupTransparent)->Arg(32);
+BENCHMARK(ciUnorderedMapLookup)->Arg(32);
+
+BENCHMARK_MAIN();
@@ -1,5 +1,11 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <iostream>
 #include <iomanip>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include <boost/program_options.hpp>
@@ -7,6 +13,7 @@
 #include <boost/filesystem/fstream.hpp>
 
 #include <components/bsa/compressedbsafile.hpp>
+#include <components/misc/hash.hpp>
 #include <components/misc/stringops.hpp>
 
 #define BSATOOL_VERSION 1.1
@@ -25,6 +32,8 @@ struct Arguments
 
     bool longformat;
     bool fullpath;
+
+    int threads;
 };
 
 bool parseOptions (int argc, char** argv, Arguments &info)
@@ -41,6 +50,8 @@ bool parseOptions (int argc, char** argv, Arguments &info)
             "      Add a file to the input archive.\n\n"
             "  bsatool create [-c] archivefile\n"
             "      Create an archive.\n\n"
+            "  bsatool verify archivefile\n"
+            "      Decompress and checksum all files in the archive.\n\n"
             "Allowed options");
 
     desc.add_options()
@@ -49,6 +60,9 @@ bool parseOptions (int argc, char** argv, Arguments &info)
         ("long,l", "Include extra information in archive listing.")
         ("full-path,f", "Create directory hierarchy on file extraction "
          "(always true for extractall).")
+        ("threads,j", bpo::value<int>()->default_value(0),
+         "Number of worker threads for extractall and verify. "
+         "0 (the default) uses all hardware threads.")
         ;
 
     // input-file is hidden and used as a positional argument
@@ -100,7 +114,7 @@ bool parseOptions (int argc, char** argv, Arguments &info)
     }
 
     info.mode = variables["mode"].as<std::string>();
-    if (!(info.mode == "list" || info.mode == "extract" || info.mode == "extractall" || info.mode == "add" || info.mode == "create"))
+    if (!(info.mode == "list" || info.mode == "extract" || info.mode == "extractall" || info.mode == "add" || info.mode == "create" || info.mode == "verify"))
     {
         std::cout << std::endl << "ERROR: invalid mode \"" << info.mode << "\"\n\n"
             << desc << std::endl;
@@ -148,6 +162,10 @@ bool parseOptions (int argc, char** argv, Arguments &info)
     info.longformat = variables.count("long") != 0;
     info.fullpath = variables.count("full-path") != 0;
 
+    info.threads = variables["threads"].as<int>();
+    if (info.threads < 1)
+        info.threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
     return true;
 }
 
@@ -155,6 +173,7 @@ int list(std::unique_ptr<Bsa::BSAFile>& bsa, Arguments& info);
 int extract(std::unique_ptr<Bsa::BSAFile>& bsa, Arguments& info);
 int extractAll(std::unique_ptr<Bsa::BSAFile>& bsa, Arguments& info);
 int add(std::unique_ptr<Bsa::BSAFile>& bsa, Arguments& info);
+int verify(std::unique_ptr<Bsa::BSAFile>& bsa, Arguments& info);
 
 int main(int argc, char** argv)
 {
@@ -190,6 +209,8 @@ int main(int argc, char** argv)
             return extractAll(bsa, info);
         else if (info.mode == "add")
             return add(bsa, info);
+        else if (info.mode == "verify")
+            return verify(bsa, info);
         else
         {
             std::cout << "Unsupported mode. That is not supposed to happen." << std::endl;
@@ -274,9 +295,101 @@ int extract(std::unique_ptr<Bsa::BSAFile>& bsa, Arguments& info)
     return 0;
 }
 
+namespace
+{
+    // The files of the archive sorted by offset, so that a pool of workers
+    // reads through the archive mostly sequentially instead of seeking all
+    // over it. The second member is the index into getList().
+    typedef std::pair<const Bsa::BSAFile::FileStruct*, size_t> PlannedFile;
+
+    std::vector<PlannedFile> makeReadPlan(const Bsa::BSAFile::FileList& files)
+    {
+        std::vector<PlannedFile> plan;
+        plan.reserve(files.size());
+        for (size_t i = 0; i < files.size(); ++i)
+            plan.emplace_back(&files[i], i);
+
+        std::sort(plan.begin(), plan.end(),
+            [](const PlannedFile& left, const PlannedFile& right)
+            { return left.first->offset < right.first->offset; });
+
+        return plan;
+    }
+
+    // Run worker() over every planned file on a pool of threads. The first
+    // exception thrown by a worker is rethrown on the calling thread.
+    void runOnPlan(const std::vector<PlannedFile>& plan, int threadCount,
+        const std::function<void (const PlannedFile&)>& worker)
+    {
+        const size_t threads = std::min<size_t>(std::max(threadCount, 1),
+            std::max<size_t>(plan.size(), 1));
+
+        std::atomic<size_t> nextFile(0);
+        std::mutex errorMutex;
+        std::string error;
+
+        std::vector<std::thread> pool;
+        for (size_t i = 0; i < threads; ++i)
+        {
+            pool.emplace_back([&]
+            {
+                while (true)
+                {
+                    const size_t index = nextFile++;
+                    if (index >= plan.size())
+                        return;
+
+                    {
+                        std::lock_guard<std::mutex> lock (errorMutex);
+                        if (!error.empty())
+                            return;
+                    }
+
+                    try
+                    {
+                        worker(plan[index]);
+                    }
+                    catch (std::exception& e)
+                    {
+                        std::lock_guard<std::mutex> lock (errorMutex);
+                        if (error.empty())
+                            error = e.what();
+                        return;
+                    }
+                }
+            });
+        }
+
+        for (std::thread& thread : pool)
+            thread.join();
+
+        if (!error.empty())
+            throw std::runtime_error(error);
+    }
+
+    // 64 bit FNV-1a over the (decompressed) file contents
+    std::uint64_t hashStream(std::istream& stream)
+    {
+        std::uint64_t hash = Misc::fnv1aBasis;
+        char buffer[4096];
+        while (stream)
+        {
+            stream.read(buffer, sizeof(buffer));
+            hash = Misc::fnv1aAppend(hash, buffer, static_cast<std::size_t>(stream.gcount()));
+        }
+        return hash;
+    }
+}
+
 int extractAll(std::unique_ptr<Bsa::BSAFile>& bsa, Arguments& info)
 {
-    for (const auto &file : bsa->getList())
+    const Bsa::BSAFile::FileList& files = bsa->getList();
+
+    // Create the directory hierarchy up front, so the workers do not race
+    // each other through the same create_directories calls.
+    std::vector<bfs::path> targets;
+    targets.reserve(files.size());
+    for (const auto& file : files)
     {
         std::string extractPath(file.name());
         Misc::StringUtils::replaceAll(extractPath, "\\", "/");
@@ -285,7 +398,6 @@ int extractAll(std::unique_ptr<Bsa::BSAFile>& bsa, Arguments& info)
         bfs::path target (info.outdir);
         target /= extractPath;
 
-        // Create the directory hierarchy
         bfs::create_directories(target.parent_path());
 
         bfs::file_status s = bfs::status(target.parent_path());
@@ -295,16 +407,54 @@ int extractAll(std::unique_ptr<Bsa::BSAFile>& bsa, Arguments& info)
             return 3;
         }
 
+        targets.push_back(target);
+    }
+
+    std::mutex outputMutex;
+
+    runOnPlan(makeReadPlan(files), info.threads, [&](const PlannedFile& planned)
+    {
+        const bfs::path& target = targets[planned.second];
+
         // Get a stream for the file to extract
-        // (inefficient because getFile iter on the list again)
-        Files::IStreamPtr data = bsa->getFile(file.name());
+        Files::IStreamPtr data = bsa->getFile(planned.first);
         bfs::ofstream out(target, std::ios::binary);
 
         // Write the file to disk
-        std::cout << "Extracting " << target << std::endl;
         out << data->rdbuf();
         out.close();
+
+        std::lock_guard<std::mutex> lock (outputMutex);
+        std::cout << "Extracting " << target << std::endl;
+    });
+
+    return 0;
+}
+
+int verify(std::unique_ptr<Bsa::BSAFile>& bsa, Arguments& info)
+{
+    const Bsa::BSAFile::FileList& files = bsa->getList();
+
+    // Checksum on the workers, print in list order so the output is stable
+    // for the same archive contents no matter how the work was scheduled.
+    std::vector<std::uint64_t> hashes (files.size(), 0);
+
+    runOnPlan(makeReadPlan(files), info.threads, [&](const PlannedFile& planned)
+    {
+        Files::IStreamPtr data = bsa->getFile(planned.first);
+        hashes[planned.second] = hashStream(*data);
+    });
+
+    std::ios::fmtflags f(std::cout.flags());
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        std::cout << std::hex << std::setw(16) << std::setfill('0') << hashes[i]
+            << std::dec << std::setfill(' ');
+        if (info.longformat)
+            std::cout << ' ' << std::setw(9) << files[i].fileSize;
+        std::cout << ' ' << files[i].name() << '\n';
     }
+    std::cout.flags(f);
 
     return 0;
 }
@@ -1,4 +1,10 @@
+#include <atomic>
+#include <condition_variable>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
 #include <vector>
 #include <deque>
 #include <list>
@@ -42,6 +48,9 @@ struct Arguments
     bool quiet_given;
     bool loadcells_given;
     bool plain_given;
+    bool binary_given;
+
+    int threads;
 
     std::string mode;
     std::string encoding;
@@ -76,6 +85,14 @@ bool parseOptions (int argc, char** argv, Arguments &info)
          "Only affects dump mode.")
         ("quiet,q", "Suppress all record information. Useful for speed tests.")
         ("loadcells,C", "Browse through contents of all cells.")
+        ("threads,j", bpo::value<int>(&(info.threads))->default_value(1),
+         "Decode records with this many worker threads. The output is "
+         "streamed in file order, same as a serial dump.  Only affects dump "
+         "mode.")
+        ("binary,b", "Dump each record as a \"TYPE flags size id\" header "
+         "line followed by 'size' bytes of raw record data and a newline, so "
+         "per-record diff tooling can consume the output without re-parsing "
+         "formatted text.  Only affects dump mode.")
 
         ( "encoding,e", bpo::value<std::string>(&(info.encoding))->
           default_value("win1252"),
@@ -171,6 +188,13 @@ bool parseOptions (int argc, char** argv, Arguments &info)
     info.quiet_given = variables.count ("quiet") != 0;
     info.loadcells_given = variables.count ("loadcells") != 0;
     info.plain_given = variables.count("plain") != 0;
+    info.binary_given = variables.count("binary") != 0;
+
+    if (info.threads < 1)
+    {
+        std::cout << "Invalid number of threads (" << info.threads << "), using 1.\n";
+        info.threads = 1;
+    }
 
     // Font encoding settings
     info.encoding = variables["encoding"].as<std::string>();
@@ -185,9 +209,242 @@ bool parseOptions (int argc, char** argv, Arguments &info)
 }
 
 void printRaw(ESM::ESMReader &esm);
-void loadCell(ESM::Cell &cell, ESM::ESMReader &esm, Arguments& info);
+void loadCell(ESM::Cell &cell, ESM::ESMReader &esm, Arguments& info, std::ostream& out);
+
+namespace
+{
+    // A record found by the scan pass of dumpStreamed(). Only the file
+    // position is kept; workers rebuild a full context from the base context
+    // captured after the file header.
+    struct RecordJob
+    {
+        size_t mFilePos = 0;
+        size_t mLeftFile = 0;
+        uint32_t mSize = 0; // record payload size in bytes
+
+        std::string mText; // preformatted output (record types we cannot decode)
+        bool mPreformatted = false;
+    };
+
+    // Decode and format a single record on a worker's own reader.
+    std::string decodeRecord(const RecordJob& job, const ESM::ESM_Context& baseContext,
+        ESM::ESMReader& esm, Arguments& info)
+    {
+        ESM::ESM_Context context = baseContext;
+        context.filePos = job.mFilePos;
+        context.leftFile = job.mLeftFile;
+
+        esm.restoreContext(context);
+
+        const ESM::NAME n = esm.getRecName();
+        uint32_t flags;
+        esm.getRecHeader(flags);
+
+        std::unique_ptr<EsmTool::RecordBase> record(EsmTool::RecordBase::create(n));
+        record->setFlags(static_cast<int>(flags));
+        record->setPrintPlain(info.plain_given);
+        record->load(esm);
+
+        // Is the user interested in this record type?
+        bool interested = true;
+        if (!info.types.empty())
+        {
+            std::vector<std::string>::iterator match;
+            match = std::find(info.types.begin(), info.types.end(), n.toString());
+            if (match == info.types.end()) interested = false;
+        }
+
+        if (!info.name.empty() && !Misc::StringUtils::ciEqual(info.name, record->getId()))
+            interested = false;
+
+        std::ostringstream out;
+
+        if (info.binary_given)
+        {
+            if (interested)
+            {
+                // Re-read the raw record payload now that we know the ID
+                std::string payload(job.mSize, '\0');
+                esm.restoreContext(context);
+                esm.getRecName();
+                esm.getRecHeader(flags);
+                if (job.mSize > 0)
+                    esm.getExact(&payload[0], static_cast<int>(job.mSize));
+
+                out << n.toString() << ' ' << flags << ' ' << job.mSize << ' '
+                    << record->getId() << '\n';
+                out.write(payload.data(), payload.size());
+                out << '\n';
+            }
+        }
+        else
+        {
+            if (!info.quiet_given && interested)
+            {
+                out << "\nRecord: " << n.toString() << " '" << record->getId() << "'\n";
+                record->print(out);
+            }
+
+            if (record->getType().intval == ESM::REC_CELL && info.loadcells_given && interested)
+                loadCell(record->cast<ESM::Cell>()->get(), esm, info, out);
+        }
+
+        return out.str();
+    }
+}
+
+// Dump the records of an already opened file, decoding on a pool of worker
+// threads while streaming the formatted output in file order.
+int dumpStreamed(Arguments& info)
+{
+    ESM::ESMReader& esm = info.reader;
+    const ESM::ESM_Context baseContext = esm.getContext();
+
+    // Scan pass: collect the file position and size of every record without
+    // decoding any of them.
+    std::vector<RecordJob> jobs;
+    std::unordered_set<uint32_t> skipped;
+
+    while (esm.hasMoreRecs())
+    {
+        RecordJob job;
+        job.mFilePos = esm.getFileOffset();
+        job.mLeftFile = esm.getContext().leftFile;
+
+        const ESM::NAME n = esm.getRecName();
+        uint32_t flags;
+        esm.getRecHeader(flags);
+
+        const size_t start = esm.getFileOffset();
+        esm.skipRecord();
+        job.mSize = static_cast<uint32_t>(esm.getFileOffset() - start);
+
+        EsmTool::RecordBase* record = EsmTool::RecordBase::create(n);
+        if (record == nullptr)
+        {
+            job.mPreformatted = true;
+            if (skipped.count(n.intval) == 0)
+            {
+                job.mText = "Skipping " + n.toString() + " records.\n";
+                skipped.emplace(n.intval);
+            }
+
+            if (info.quiet_given)
+            {
+                jobs.push_back(job);
+                break;
+            }
+            job.mText += "  Skipping\n";
+
+            jobs.push_back(job);
+            continue;
+        }
+        delete record;
+
+        jobs.push_back(job);
+        ++info.data.mRecordStats[n.intval];
+    }
+
+    const unsigned int threads = static_cast<unsigned int>(
+        std::min<size_t>(info.threads, std::max<size_t>(jobs.size(), 1)));
+
+    // Completed output is buffered in a bounded window, so a slow record
+    // cannot make the dump accumulate the whole file in memory.
+    const size_t windowSize = threads * 16;
+    std::vector<std::string> window(windowSize);
+    std::vector<char> ready(windowSize, 0); // 0 = pending, 1 = done, 2 = failed
+
+    std::atomic<size_t> nextJob(0);
+    std::mutex mutex;
+    std::condition_variable produced, consumed;
+    size_t written = 0;
+    bool failed = false;
+
+    std::vector<std::thread> workers;
+    for (unsigned int i = 0; i < threads; ++i)
+    {
+        workers.emplace_back([&]
+        {
+            ESM::ESMReader reader;
+            ToUTF8::Utf8Encoder encoder (ToUTF8::calculateEncoding(info.encoding));
+            reader.setEncoder(&encoder);
+            reader.open(info.filename);
+
+            while (true)
+            {
+                const size_t index = nextJob++;
+                if (index >= jobs.size())
+                    return;
+
+                std::string text;
+                char state = 1;
+                if (jobs[index].mPreformatted)
+                    text = jobs[index].mText;
+                else
+                {
+                    try
+                    {
+                        text = decodeRecord(jobs[index], baseContext, reader, info);
+                    }
+                    catch (std::exception& e)
+                    {
+                        text = e.what();
+                        state = 2;
+                    }
+                }
+
+                std::unique_lock<std::mutex> lock (mutex);
+                consumed.wait(lock, [&] { return index < written + windowSize || failed; });
+                if (failed)
+                    return;
+
+                window[index % windowSize] = std::move(text);
+                ready[index % windowSize] = state;
+                produced.notify_all();
+            }
+        });
+    }
+
+    // Stream the results in file order
+    std::string error;
+    for (size_t index = 0; index < jobs.size(); ++index)
+    {
+        std::unique_lock<std::mutex> lock (mutex);
+        produced.wait(lock, [&] { return ready[index % windowSize] != 0; });
+
+        const bool ok = ready[index % windowSize] == 1;
+        std::string text = std::move(window[index % windowSize]);
+        ready[index % windowSize] = 0;
+        ++written;
+
+        if (!ok)
+        {
+            failed = true;
+            error = std::move(text);
+            consumed.notify_all();
+            break;
+        }
+
+        lock.unlock();
+        consumed.notify_all();
+
+        std::cout.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    if (failed)
+    {
+        std::cout << "\nERROR:\n\n  " << error << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
 
 int load(Arguments& info);
+int dumpStreamed(Arguments& info);
 int clone(Arguments& info);
 int comp(Arguments& info);
 
@@ -220,7 +477,7 @@ int main(int argc, char**argv)
     return 0;
 }
 
-void loadCell(ESM::Cell &cell, ESM::ESMReader &esm, Arguments& info)
+void loadCell(ESM::Cell &cell, ESM::ESMReader &esm, Arguments& info, std::ostream& out)
 {
     bool quiet = (info.quiet_given || info.mode == "clone");
     bool save = (info.mode == "clone");
@@ -233,7 +490,7 @@ void loadCell(ESM::Cell &cell, ESM::ESMReader &esm, Arguments& info)
 
     // Loop through all the references
     ESM::CellRef ref;
-    if(!quiet) std::cout << "  References:\n";
+    if(!quiet) out << "  References:\n";
 
     bool deleted = false;
     ESM::MovedCellRef movedCellRef;
@@ -246,44 +503,44 @@ void loadCell(ESM::Cell &cell, ESM::ESMReader &esm, Arguments& info)
 
         if(quiet) continue;
 
-        std::cout << "  - Refnum: " << ref.mRefNum.mIndex << '\n';
-        std::cout << "    ID: " << ref.mRefID << '\n';
-        std::cout << "    Position: (" << ref.mPos.pos[0] << ", " << ref.mPos.pos[1] << ", " << ref.mPos.pos[2] << ")\n";
+        out << "  - Refnum: " << ref.mRefNum.mIndex << '\n';
+        out << "    ID: " << ref.mRefID << '\n';
+        out << "    Position: (" << ref.mPos.pos[0] << ", " << ref.mPos.pos[1] << ", " << ref.mPos.pos[2] << ")\n";
         if (ref.mScale != 1.f)
-            std::cout << "    Scale: " << ref.mScale << '\n';
+            out << "    Scale: " << ref.mScale << '\n';
         if (!ref.mOwner.empty())
-            std::cout << "    Owner: " << ref.mOwner << '\n';
+            out << "    Owner: " << ref.mOwner << '\n';
         if (!ref.mGlobalVariable.empty())
-            std::cout << "    Global: " << ref.mGlobalVariable << '\n';
+            out << "    Global: " << ref.mGlobalVariable << '\n';
         if (!ref.mFaction.empty())
-            std::cout << "    Faction: " << ref.mFaction << '\n';
+            out << "    Faction: " << ref.mFaction << '\n';
         if (!ref.mFaction.empty() || ref.mFactionRank != -2)
-            std::cout << "    Faction rank: " << ref.mFactionRank << '\n';
-        std::cout << "    Enchantment charge: " << ref.mEnchantmentCharge << '\n';
-        std::cout << "    Uses/health: " << ref.mChargeInt << '\n';
-        std::cout << "    Gold value: " << ref.mGoldValue << '\n';
-        std::cout << "    Blocked: " << static_cast<int>(ref.mReferenceBlocked) << '\n';
-        std::cout << "    Deleted: " << deleted << '\n';
+            out << "    Faction rank: " << ref.mFactionRank << '\n';
+        out << "    Enchantment charge: " << ref.mEnchantmentCharge << '\n';
+        out << "    Uses/health: " << ref.mChargeInt << '\n';
+        out << "    Gold value: " << ref.mGoldValue << '\n';
+        out << "    Blocked: " << static_cast<int>(ref.mReferenceBlocked) << '\n';
+        out << "    Deleted: " << deleted << '\n';
         if (!ref.mKey.empty())
-            std::cout << "    Key: " << ref.mKey << '\n';
-        std::cout << "    Lock level: " << ref.mLockLevel << '\n';
+            out << "    Key: " << ref.mKey << '\n';
+        out << "    Lock level: " << ref.mLockLevel << '\n';
         if (!ref.mTrap.empty())
-            std::cout << "    Trap: " << ref.mTrap << '\n';
+            out << "    Trap: " << ref.mTrap << '\n';
         if (!ref.mSoul.empty())
-            std::cout << "    Soul: " << ref.mSoul << '\n';
+            out << "    Soul: " << ref.mSoul << '\n';
         if (ref.mTeleport)
         {
-            std::cout << "    Destination position: (" << ref.mDoorDest.pos[0] << ", "
+            out << "    Destination position: (" << ref.mDoorDest.pos[0] << ", "
                       << ref.mDoorDest.pos[1] << ", " << ref.mDoorDest.pos[2] << ")\n";
             if (!ref.mDestCell.empty())
-                std::cout << "    Destination cell: " << ref.mDestCell << '\n';
+                out << "    Destination cell: " << ref.mDestCell << '\n';
         }
-        std::cout << "    Moved: " << std::boolalpha << moved << std::noboolalpha << '\n';
+        out << "    Moved: " << std::boolalpha << moved << std::noboolalpha << '\n';
         if (moved)
         {
-            std::cout << "    Moved refnum: " << movedCellRef.mRefNum.mIndex << '\n';
-            std::cout << "    Moved content file: " << movedCellRef.mRefNum.mContentFile << '\n';
-            std::cout << "    Target: " << movedCellRef.mTarget[0] << ", " << movedCellRef.mTarget[1] << '\n';
+            out << "    Moved refnum: " << movedCellRef.mRefNum.mIndex << '\n';
+            out << "    Moved content file: " << movedCellRef.mRefNum.mContentFile << '\n';
+            out << "    Target: " << movedCellRef.mTarget[0] << ", " << movedCellRef.mTarget[1] << '\n';
         }
     }
 }
@@ -357,6 +614,11 @@ int load(Arguments& info)
             }
         }
 
+        // The streamed path decodes with its own readers and does not keep
+        // records around, so it cannot serve clone mode.
+        if (!save && (info.threads > 1 || info.binary_given))
+            return dumpStreamed(info);
+
         // Loop through all records
         while(esm.hasMoreRecs())
         {
@@ -399,12 +661,12 @@ int load(Arguments& info)
             if(!quiet && interested)
             {
                 std::cout << "\nRecord: " << n.toString() << " '" << record->getId() << "'\n";
-                record->print();
+                record->print(std::cout);
             }
 
             if (record->getType().intval == ESM::REC_CELL && loadCells && interested)
             {
-                loadCell(record->cast<ESM::Cell>()->get(), esm, info);
+                loadCell(record->cast<ESM::Cell>()->get(), esm, info, std::cout);
             }
 
             if (save)
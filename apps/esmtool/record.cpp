@@ -9,48 +9,48 @@
 namespace
 {
 
-void printAIPackage(const ESM::AIPackage& p)
+void printAIPackage(std::ostream& out, const ESM::AIPackage& p)
 {
-    std::cout << "  AI Type: " << aiTypeLabel(p.mType)
+    out << "  AI Type: " << aiTypeLabel(p.mType)
               << " (" << Misc::StringUtils::format("0x%08X", p.mType) << ")" << std::endl;
     if (p.mType == ESM::AI_Wander)
     {
-        std::cout << "    Distance: " << p.mWander.mDistance << std::endl;
-        std::cout << "    Duration: " << p.mWander.mDuration << std::endl;
-        std::cout << "    Time of Day: " << (int)p.mWander.mTimeOfDay << std::endl;
+        out << "    Distance: " << p.mWander.mDistance << std::endl;
+        out << "    Duration: " << p.mWander.mDuration << std::endl;
+        out << "    Time of Day: " << (int)p.mWander.mTimeOfDay << std::endl;
         if (p.mWander.mShouldRepeat != 1)
-            std::cout << "    Should repeat: " << (bool)(p.mWander.mShouldRepeat != 0) << std::endl;
+            out << "    Should repeat: " << (bool)(p.mWander.mShouldRepeat != 0) << std::endl;
 
-        std::cout << "    Idle: ";
+        out << "    Idle: ";
         for (int i = 0; i != 8; i++)
-            std::cout << (int)p.mWander.mIdle[i] << " ";
-        std::cout << std::endl;
+            out << (int)p.mWander.mIdle[i] << " ";
+        out << std::endl;
     }
     else if (p.mType == ESM::AI_Travel)
     {
-        std::cout << "    Travel Coordinates: (" << p.mTravel.mX << ","
+        out << "    Travel Coordinates: (" << p.mTravel.mX << ","
                   << p.mTravel.mY << "," << p.mTravel.mZ << ")" << std::endl;
-        std::cout << "    Travel Unknown: " << p.mTravel.mUnk << std::endl;
+        out << "    Travel Unknown: " << p.mTravel.mUnk << std::endl;
     }
     else if (p.mType == ESM::AI_Follow || p.mType == ESM::AI_Escort)
     {
-        std::cout << "    Follow Coordinates: (" << p.mTarget.mX << ","
+        out << "    Follow Coordinates: (" << p.mTarget.mX << ","
                   << p.mTarget.mY << "," << p.mTarget.mZ << ")" << std::endl;
-        std::cout << "    Duration: " << p.mTarget.mDuration << std::endl;
-        std::cout << "    Target ID: " << p.mTarget.mId.toString() << std::endl;
-        std::cout << "    Unknown: " << p.mTarget.mUnk << std::endl;
+        out << "    Duration: " << p.mTarget.mDuration << std::endl;
+        out << "    Target ID: " << p.mTarget.mId.toString() << std::endl;
+        out << "    Unknown: " << p.mTarget.mUnk << std::endl;
     }
     else if (p.mType == ESM::AI_Activate)
     {
-        std::cout << "    Name: " << p.mActivate.mName.toString() << std::endl;
-        std::cout << "    Activate Unknown: " << p.mActivate.mUnk << std::endl;
+        out << "    Name: " << p.mActivate.mName.toString() << std::endl;
+        out << "    Activate Unknown: " << p.mActivate.mUnk << std::endl;
     }
     else {
-        std::cout << "    BadPackage: " << Misc::StringUtils::format("0x%08X", p.mType) << std::endl;
+        out << "    BadPackage: " << Misc::StringUtils::format("0x%08X", p.mType) << std::endl;
     }
 
     if (!p.mCellName.empty())
-        std::cout << "    Cell Name: " << p.mCellName << std::endl;
+        out << "    Cell Name: " << p.mCellName << std::endl;
 }
 
 std::string ruleString(const ESM::DialInfo::SelectStruct& ss)
@@ -126,44 +126,44 @@ std::string ruleString(const ESM::DialInfo::SelectStruct& ss)
     return result;
 }
 
-void printEffectList(const ESM::EffectList& effects)
+void printEffectList(std::ostream& out, const ESM::EffectList& effects)
 {
     int i = 0;
     for (const ESM::ENAMstruct& effect : effects.mList)
     {
-        std::cout << "  Effect[" << i << "]: " << magicEffectLabel(effect.mEffectID)
+        out << "  Effect[" << i << "]: " << magicEffectLabel(effect.mEffectID)
                   << " (" << effect.mEffectID << ")" << std::endl;
         if (effect.mSkill != -1)
-            std::cout << "    Skill: " << skillLabel(effect.mSkill)
+            out << "    Skill: " << skillLabel(effect.mSkill)
                       << " (" << (int)effect.mSkill << ")" << std::endl;
         if (effect.mAttribute != -1)
-            std::cout << "    Attribute: " << attributeLabel(effect.mAttribute)
+            out << "    Attribute: " << attributeLabel(effect.mAttribute)
                       << " (" << (int)effect.mAttribute << ")" << std::endl;
-        std::cout << "    Range: " << rangeTypeLabel(effect.mRange)
+        out << "    Range: " << rangeTypeLabel(effect.mRange)
                   << " (" << effect.mRange << ")" << std::endl;
         // Area is always zero if range type is "Self"
         if (effect.mRange != ESM::RT_Self)
-            std::cout << "    Area: " << effect.mArea << std::endl;
-        std::cout << "    Duration: " << effect.mDuration << std::endl;
-        std::cout << "    Magnitude: " << effect.mMagnMin << "-" << effect.mMagnMax << std::endl;
+            out << "    Area: " << effect.mArea << std::endl;
+        out << "    Duration: " << effect.mDuration << std::endl;
+        out << "    Magnitude: " << effect.mMagnMin << "-" << effect.mMagnMax << std::endl;
         i++;
     }
 }
 
-void printTransport(const std::vector<ESM::Transport::Dest>& transport)
+void printTransport(std::ostream& out, const std::vector<ESM::Transport::Dest>& transport)
 {
     for (const ESM::Transport::Dest& dest : transport)
     {
-        std::cout << "  Destination Position: "
+        out << "  Destination Position: "
                   << Misc::StringUtils::format("%12.3f", dest.mPos.pos[0]) << ","
                   << Misc::StringUtils::format("%12.3f", dest.mPos.pos[1]) << ","
                   << Misc::StringUtils::format("%12.3f", dest.mPos.pos[2]) << ")" << std::endl;
-        std::cout << "  Destination Rotation: "
+        out << "  Destination Rotation: "
                   << Misc::StringUtils::format("%9.6f", dest.mPos.rot[0]) << ","
                   << Misc::StringUtils::format("%9.6f", dest.mPos.rot[1]) << ","
                   << Misc::StringUtils::format("%9.6f", dest.mPos.rot[2]) << ")" << std::endl;
         if (!dest.mCellName.empty())
-            std::cout << "  Destination Cell: " << dest.mCellName << std::endl;
+            out << "  Destination Cell: " << dest.mCellName << std::endl;
     }
 }
 
@@ -397,138 +397,138 @@ RecordBase::create(const ESM::NAME type)
 }
 
 template<>
-void Record<ESM::Activator>::print()
+void Record<ESM::Activator>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Model: " << mData.mModel << std::endl;
-    std::cout << "  Script: " << mData.mScript << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Model: " << mData.mModel << std::endl;
+    out << "  Script: " << mData.mScript << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Potion>::print()
+void Record<ESM::Potion>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Model: " << mData.mModel << std::endl;
-    std::cout << "  Icon: " << mData.mIcon << std::endl;
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Model: " << mData.mModel << std::endl;
+    out << "  Icon: " << mData.mIcon << std::endl;
     if (!mData.mScript.empty())
-        std::cout << "  Script: " << mData.mScript << std::endl;
-    std::cout << "  Weight: " << mData.mData.mWeight << std::endl;
-    std::cout << "  Value: " << mData.mData.mValue << std::endl;
-    std::cout << "  AutoCalc: " << mData.mData.mAutoCalc << std::endl;
-    printEffectList(mData.mEffects);
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+        out << "  Script: " << mData.mScript << std::endl;
+    out << "  Weight: " << mData.mData.mWeight << std::endl;
+    out << "  Value: " << mData.mData.mValue << std::endl;
+    out << "  AutoCalc: " << mData.mData.mAutoCalc << std::endl;
+    printEffectList(out, mData.mEffects);
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Armor>::print()
+void Record<ESM::Armor>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Model: " << mData.mModel << std::endl;
-    std::cout << "  Icon: " << mData.mIcon << std::endl;
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Model: " << mData.mModel << std::endl;
+    out << "  Icon: " << mData.mIcon << std::endl;
     if (!mData.mScript.empty())
-        std::cout << "  Script: " << mData.mScript << std::endl;
+        out << "  Script: " << mData.mScript << std::endl;
     if (!mData.mEnchant.empty())
-        std::cout << "  Enchantment: " << mData.mEnchant << std::endl;
-    std::cout << "  Type: " << armorTypeLabel(mData.mData.mType)
+        out << "  Enchantment: " << mData.mEnchant << std::endl;
+    out << "  Type: " << armorTypeLabel(mData.mData.mType)
               << " (" << mData.mData.mType << ")" << std::endl;
-    std::cout << "  Weight: " << mData.mData.mWeight << std::endl;
-    std::cout << "  Value: " << mData.mData.mValue << std::endl;
-    std::cout << "  Health: " << mData.mData.mHealth << std::endl;
-    std::cout << "  Armor: " << mData.mData.mArmor << std::endl;
-    std::cout << "  Enchantment Points: " << mData.mData.mEnchant << std::endl;
+    out << "  Weight: " << mData.mData.mWeight << std::endl;
+    out << "  Value: " << mData.mData.mValue << std::endl;
+    out << "  Health: " << mData.mData.mHealth << std::endl;
+    out << "  Armor: " << mData.mData.mArmor << std::endl;
+    out << "  Enchantment Points: " << mData.mData.mEnchant << std::endl;
     for (const ESM::PartReference &part : mData.mParts.mParts)
     {
-        std::cout << "  Body Part: " << bodyPartLabel(part.mPart)
+        out << "  Body Part: " << bodyPartLabel(part.mPart)
                   << " (" << (int)(part.mPart) << ")" << std::endl;
-        std::cout << "    Male Name: " << part.mMale << std::endl;
+        out << "    Male Name: " << part.mMale << std::endl;
         if (!part.mFemale.empty())
-            std::cout << "    Female Name: " << part.mFemale << std::endl;
+            out << "    Female Name: " << part.mFemale << std::endl;
     }
 
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Apparatus>::print()
+void Record<ESM::Apparatus>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Model: " << mData.mModel << std::endl;
-    std::cout << "  Icon: " << mData.mIcon << std::endl;
-    std::cout << "  Script: " << mData.mScript << std::endl;
-    std::cout << "  Type: " << apparatusTypeLabel(mData.mData.mType)
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Model: " << mData.mModel << std::endl;
+    out << "  Icon: " << mData.mIcon << std::endl;
+    out << "  Script: " << mData.mScript << std::endl;
+    out << "  Type: " << apparatusTypeLabel(mData.mData.mType)
               << " (" << mData.mData.mType << ")" << std::endl;
-    std::cout << "  Weight: " << mData.mData.mWeight << std::endl;
-    std::cout << "  Value: " << mData.mData.mValue << std::endl;
-    std::cout << "  Quality: " << mData.mData.mQuality << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Weight: " << mData.mData.mWeight << std::endl;
+    out << "  Value: " << mData.mData.mValue << std::endl;
+    out << "  Quality: " << mData.mData.mQuality << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::BodyPart>::print()
+void Record<ESM::BodyPart>::print(std::ostream& out)
 {
-    std::cout << "  Race: " << mData.mRace << std::endl;
-    std::cout << "  Model: " << mData.mModel << std::endl;
-    std::cout << "  Type: " << meshTypeLabel(mData.mData.mType)
+    out << "  Race: " << mData.mRace << std::endl;
+    out << "  Model: " << mData.mModel << std::endl;
+    out << "  Type: " << meshTypeLabel(mData.mData.mType)
               << " (" << (int)mData.mData.mType << ")" << std::endl;
-    std::cout << "  Flags: " << bodyPartFlags(mData.mData.mFlags) << std::endl;
-    std::cout << "  Part: " << meshPartLabel(mData.mData.mPart)
+    out << "  Flags: " << bodyPartFlags(mData.mData.mFlags) << std::endl;
+    out << "  Part: " << meshPartLabel(mData.mData.mPart)
               << " (" << (int)mData.mData.mPart << ")" << std::endl;
-    std::cout << "  Vampire: " << (int)mData.mData.mVampire << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Vampire: " << (int)mData.mData.mVampire << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Book>::print()
+void Record<ESM::Book>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Model: " << mData.mModel << std::endl;
-    std::cout << "  Icon: " << mData.mIcon << std::endl;
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Model: " << mData.mModel << std::endl;
+    out << "  Icon: " << mData.mIcon << std::endl;
     if (!mData.mScript.empty())
-        std::cout << "  Script: " << mData.mScript << std::endl;
+        out << "  Script: " << mData.mScript << std::endl;
     if (!mData.mEnchant.empty())
-        std::cout << "  Enchantment: " << mData.mEnchant << std::endl;
-    std::cout << "  Weight: " << mData.mData.mWeight << std::endl;
-    std::cout << "  Value: " << mData.mData.mValue << std::endl;
-    std::cout << "  IsScroll: " << mData.mData.mIsScroll << std::endl;
-    std::cout << "  SkillId: " << mData.mData.mSkillId << std::endl;
-    std::cout << "  Enchantment Points: " << mData.mData.mEnchant << std::endl;
+        out << "  Enchantment: " << mData.mEnchant << std::endl;
+    out << "  Weight: " << mData.mData.mWeight << std::endl;
+    out << "  Value: " << mData.mData.mValue << std::endl;
+    out << "  IsScroll: " << mData.mData.mIsScroll << std::endl;
+    out << "  SkillId: " << mData.mData.mSkillId << std::endl;
+    out << "  Enchantment Points: " << mData.mData.mEnchant << std::endl;
     if (mPrintPlain)
     {
-        std::cout << "  Text:" << std::endl;
-        std::cout << "START--------------------------------------" << std::endl;
-        std::cout << mData.mText << std::endl;
-        std::cout << "END----------------------------------------" << std::endl;
+        out << "  Text:" << std::endl;
+        out << "START--------------------------------------" << std::endl;
+        out << mData.mText << std::endl;
+        out << "END----------------------------------------" << std::endl;
     }
     else
     {
-        std::cout << "  Text: [skipped]" << std::endl;
+        out << "  Text: [skipped]" << std::endl;
     }
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::BirthSign>::print()
+void Record<ESM::BirthSign>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Texture: " << mData.mTexture << std::endl;
-    std::cout << "  Description: " << mData.mDescription << std::endl;
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Texture: " << mData.mTexture << std::endl;
+    out << "  Description: " << mData.mDescription << std::endl;
     for (const std::string &power : mData.mPowers.mList)
-        std::cout << "  Power: " << power << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+        out << "  Power: " << power << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Cell>::print()
+void Record<ESM::Cell>::print(std::ostream& out)
 {
     // None of the cells have names...
     if (!mData.mName.empty())
-        std::cout << "  Name: " << mData.mName << std::endl;
+        out << "  Name: " << mData.mName << std::endl;
     if (!mData.mRegion.empty())
-        std::cout << "  Region: " << mData.mRegion << std::endl;
-    std::cout << "  Flags: " << cellFlags(mData.mData.mFlags) << std::endl;
+        out << "  Region: " << mData.mRegion << std::endl;
+    out << "  Flags: " << cellFlags(mData.mData.mFlags) << std::endl;
 
-    std::cout << "  Coordinates: " << " (" << mData.getGridX() << ","
+    out << "  Coordinates: " << " (" << mData.getGridX() << ","
               << mData.getGridY() << ")" << std::endl;
 
     if (mData.mData.mFlags & ESM::Cell::Interior &&
@@ -537,599 +537,599 @@ void Record<ESM::Cell>::print()
         if (mData.hasAmbient())
         {
             // TODO: see if we can change the integer representation to something more sensible
-            std::cout << "  Ambient Light Color: " << mData.mAmbi.mAmbient << std::endl;
-            std::cout << "  Sunlight Color: " << mData.mAmbi.mSunlight << std::endl;
-            std::cout << "  Fog Color: " << mData.mAmbi.mFog << std::endl;
-            std::cout << "  Fog Density: " << mData.mAmbi.mFogDensity << std::endl;
+            out << "  Ambient Light Color: " << mData.mAmbi.mAmbient << std::endl;
+            out << "  Sunlight Color: " << mData.mAmbi.mSunlight << std::endl;
+            out << "  Fog Color: " << mData.mAmbi.mFog << std::endl;
+            out << "  Fog Density: " << mData.mAmbi.mFogDensity << std::endl;
         }
         else
         {
-            std::cout << "  No Ambient Information" << std::endl;
+            out << "  No Ambient Information" << std::endl;
         }
-        std::cout << "  Water Level: " << mData.mWater << std::endl;
+        out << "  Water Level: " << mData.mWater << std::endl;
     }
     else
-        std::cout << "  Map Color: " << Misc::StringUtils::format("0x%08X", mData.mMapColor) << std::endl;
-    std::cout << "  Water Level Int: " << mData.mWaterInt << std::endl;
-    std::cout << "  RefId counter: " << mData.mRefNumCounter << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+        out << "  Map Color: " << Misc::StringUtils::format("0x%08X", mData.mMapColor) << std::endl;
+    out << "  Water Level Int: " << mData.mWaterInt << std::endl;
+    out << "  RefId counter: " << mData.mRefNumCounter << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 
 }
 
 template<>
-void Record<ESM::Class>::print()
+void Record<ESM::Class>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Description: " << mData.mDescription << std::endl;
-    std::cout << "  Playable: " << mData.mData.mIsPlayable << std::endl;
-    std::cout << "  AutoCalc: " << mData.mData.mCalc << std::endl;
-    std::cout << "  Attribute1: " << attributeLabel(mData.mData.mAttribute[0])
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Description: " << mData.mDescription << std::endl;
+    out << "  Playable: " << mData.mData.mIsPlayable << std::endl;
+    out << "  AutoCalc: " << mData.mData.mCalc << std::endl;
+    out << "  Attribute1: " << attributeLabel(mData.mData.mAttribute[0])
               << " (" << mData.mData.mAttribute[0] << ")" << std::endl;
-    std::cout << "  Attribute2: " << attributeLabel(mData.mData.mAttribute[1])
+    out << "  Attribute2: " << attributeLabel(mData.mData.mAttribute[1])
               << " (" << mData.mData.mAttribute[1] << ")" << std::endl;
-    std::cout << "  Specialization: " << specializationLabel(mData.mData.mSpecialization)
+    out << "  Specialization: " << specializationLabel(mData.mData.mSpecialization)
               << " (" << mData.mData.mSpecialization << ")" << std::endl;
     for (int i = 0; i != 5; i++)
-        std::cout << "  Minor Skill: " << skillLabel(mData.mData.mSkills[i][0])
+        out << "  Minor Skill: " << skillLabel(mData.mData.mSkills[i][0])
                   << " (" << mData.mData.mSkills[i][0] << ")" << std::endl;
     for (int i = 0; i != 5; i++)
-        std::cout << "  Major Skill: " << skillLabel(mData.mData.mSkills[i][1])
+        out << "  Major Skill: " << skillLabel(mData.mData.mSkills[i][1])
                   << " (" << mData.mData.mSkills[i][1] << ")" << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Clothing>::print()
+void Record<ESM::Clothing>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Model: " << mData.mModel << std::endl;
-    std::cout << "  Icon: " << mData.mIcon << std::endl;
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Model: " << mData.mModel << std::endl;
+    out << "  Icon: " << mData.mIcon << std::endl;
     if (!mData.mScript.empty())
-        std::cout << "  Script: " << mData.mScript << std::endl;
+        out << "  Script: " << mData.mScript << std::endl;
     if (!mData.mEnchant.empty())
-        std::cout << "  Enchantment: " << mData.mEnchant << std::endl;
-    std::cout << "  Type: " << clothingTypeLabel(mData.mData.mType)
+        out << "  Enchantment: " << mData.mEnchant << std::endl;
+    out << "  Type: " << clothingTypeLabel(mData.mData.mType)
               << " (" << mData.mData.mType << ")" << std::endl;
-    std::cout << "  Weight: " << mData.mData.mWeight << std::endl;
-    std::cout << "  Value: " << mData.mData.mValue << std::endl;
-    std::cout << "  Enchantment Points: " << mData.mData.mEnchant << std::endl;
+    out << "  Weight: " << mData.mData.mWeight << std::endl;
+    out << "  Value: " << mData.mData.mValue << std::endl;
+    out << "  Enchantment Points: " << mData.mData.mEnchant << std::endl;
     for (const ESM::PartReference &part : mData.mParts.mParts)
     {
-        std::cout << "  Body Part: " << bodyPartLabel(part.mPart)
+        out << "  Body Part: " << bodyPartLabel(part.mPart)
                   << " (" << (int)(part.mPart) << ")" << std::endl;
-        std::cout << "    Male Name: " << part.mMale << std::endl;
+        out << "    Male Name: " << part.mMale << std::endl;
         if (!part.mFemale.empty())
-            std::cout << "    Female Name: " << part.mFemale << std::endl;
+            out << "    Female Name: " << part.mFemale << std::endl;
     }
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Container>::print()
+void Record<ESM::Container>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Model: " << mData.mModel << std::endl;
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Model: " << mData.mModel << std::endl;
     if (!mData.mScript.empty())
-        std::cout << "  Script: " << mData.mScript << std::endl;
-    std::cout << "  Flags: " << containerFlags(mData.mFlags) << std::endl;
-    std::cout << "  Weight: " << mData.mWeight << std::endl;
+        out << "  Script: " << mData.mScript << std::endl;
+    out << "  Flags: " << containerFlags(mData.mFlags) << std::endl;
+    out << "  Weight: " << mData.mWeight << std::endl;
     for (const ESM::ContItem &item : mData.mInventory.mList)
-        std::cout << "  Inventory: Count: " << Misc::StringUtils::format("%4d", item.mCount)
+        out << "  Inventory: Count: " << Misc::StringUtils::format("%4d", item.mCount)
                   << " Item: " << item.mItem << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Creature>::print()
+void Record<ESM::Creature>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Model: " << mData.mModel << std::endl;
-    std::cout << "  Script: " << mData.mScript << std::endl;
-    std::cout << "  Flags: " << creatureFlags((int)mData.mFlags) << std::endl;
-    std::cout << "  Blood Type: " << mData.mBloodType+1 << std::endl;
-    std::cout << "  Original: " << mData.mOriginal << std::endl;
-    std::cout << "  Scale: " << mData.mScale << std::endl;
-
-    std::cout << "  Type: " << creatureTypeLabel(mData.mData.mType)
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Model: " << mData.mModel << std::endl;
+    out << "  Script: " << mData.mScript << std::endl;
+    out << "  Flags: " << creatureFlags((int)mData.mFlags) << std::endl;
+    out << "  Blood Type: " << mData.mBloodType+1 << std::endl;
+    out << "  Original: " << mData.mOriginal << std::endl;
+    out << "  Scale: " << mData.mScale << std::endl;
+
+    out << "  Type: " << creatureTypeLabel(mData.mData.mType)
               << " (" << mData.mData.mType << ")" << std::endl;
-    std::cout << "  Level: " << mData.mData.mLevel << std::endl;
-
-    std::cout << "  Attributes:" << std::endl;
-    std::cout << "    Strength: " << mData.mData.mStrength << std::endl;
-    std::cout << "    Intelligence: " << mData.mData.mIntelligence << std::endl;
-    std::cout << "    Willpower: " << mData.mData.mWillpower << std::endl;
-    std::cout << "    Agility: " << mData.mData.mAgility << std::endl;
-    std::cout << "    Speed: " << mData.mData.mSpeed << std::endl;
-    std::cout << "    Endurance: " << mData.mData.mEndurance << std::endl;
-    std::cout << "    Personality: " << mData.mData.mPersonality << std::endl;
-    std::cout << "    Luck: " << mData.mData.mLuck << std::endl;
-
-    std::cout << "  Health: " << mData.mData.mHealth << std::endl;
-    std::cout << "  Magicka: " << mData.mData.mMana << std::endl;
-    std::cout << "  Fatigue: " << mData.mData.mFatigue << std::endl;
-    std::cout << "  Soul: " << mData.mData.mSoul << std::endl;
-    std::cout << "  Combat: " << mData.mData.mCombat << std::endl;
-    std::cout << "  Magic: " << mData.mData.mMagic << std::endl;
-    std::cout << "  Stealth: " << mData.mData.mStealth << std::endl;
-    std::cout << "  Attack1: " << mData.mData.mAttack[0]
+    out << "  Level: " << mData.mData.mLevel << std::endl;
+
+    out << "  Attributes:" << std::endl;
+    out << "    Strength: " << mData.mData.mStrength << std::endl;
+    out << "    Intelligence: " << mData.mData.mIntelligence << std::endl;
+    out << "    Willpower: " << mData.mData.mWillpower << std::endl;
+    out << "    Agility: " << mData.mData.mAgility << std::endl;
+    out << "    Speed: " << mData.mData.mSpeed << std::endl;
+    out << "    Endurance: " << mData.mData.mEndurance << std::endl;
+    out << "    Personality: " << mData.mData.mPersonality << std::endl;
+    out << "    Luck: " << mData.mData.mLuck << std::endl;
+
+    out << "  Health: " << mData.mData.mHealth << std::endl;
+    out << "  Magicka: " << mData.mData.mMana << std::endl;
+    out << "  Fatigue: " << mData.mData.mFatigue << std::endl;
+    out << "  Soul: " << mData.mData.mSoul << std::endl;
+    out << "  Combat: " << mData.mData.mCombat << std::endl;
+    out << "  Magic: " << mData.mData.mMagic << std::endl;
+    out << "  Stealth: " << mData.mData.mStealth << std::endl;
+    out << "  Attack1: " << mData.mData.mAttack[0]
               << "-" <<  mData.mData.mAttack[1] << std::endl;
-    std::cout << "  Attack2: " << mData.mData.mAttack[2]
+    out << "  Attack2: " << mData.mData.mAttack[2]
               << "-" <<  mData.mData.mAttack[3] << std::endl;
-    std::cout << "  Attack3: " << mData.mData.mAttack[4]
+    out << "  Attack3: " << mData.mData.mAttack[4]
               << "-" <<  mData.mData.mAttack[5] << std::endl;
-    std::cout << "  Gold: " << mData.mData.mGold << std::endl;
+    out << "  Gold: " << mData.mData.mGold << std::endl;
 
     for (const ESM::ContItem &item : mData.mInventory.mList)
-        std::cout << "  Inventory: Count: " << Misc::StringUtils::format("%4d", item.mCount)
+        out << "  Inventory: Count: " << Misc::StringUtils::format("%4d", item.mCount)
                   << " Item: " << item.mItem << std::endl;
 
     for (const std::string &spell : mData.mSpells.mList)
-        std::cout << "  Spell: " << spell << std::endl;
+        out << "  Spell: " << spell << std::endl;
 
-    printTransport(mData.getTransport());
+    printTransport(out, mData.getTransport());
 
-    std::cout << "  Artificial Intelligence: " << std::endl;
-    std::cout << "    AI Hello:" << (int)mData.mAiData.mHello << std::endl;
-    std::cout << "    AI Fight:" << (int)mData.mAiData.mFight << std::endl;
-    std::cout << "    AI Flee:" << (int)mData.mAiData.mFlee << std::endl;
-    std::cout << "    AI Alarm:" << (int)mData.mAiData.mAlarm << std::endl;
-    std::cout << "    AI U1:" << (int)mData.mAiData.mU1 << std::endl;
-    std::cout << "    AI U2:" << (int)mData.mAiData.mU2 << std::endl;
-    std::cout << "    AI U3:" << (int)mData.mAiData.mU3 << std::endl;
-    std::cout << "    AI Services:" << Misc::StringUtils::format("0x%08X", mData.mAiData.mServices) << std::endl;
+    out << "  Artificial Intelligence: " << std::endl;
+    out << "    AI Hello:" << (int)mData.mAiData.mHello << std::endl;
+    out << "    AI Fight:" << (int)mData.mAiData.mFight << std::endl;
+    out << "    AI Flee:" << (int)mData.mAiData.mFlee << std::endl;
+    out << "    AI Alarm:" << (int)mData.mAiData.mAlarm << std::endl;
+    out << "    AI U1:" << (int)mData.mAiData.mU1 << std::endl;
+    out << "    AI U2:" << (int)mData.mAiData.mU2 << std::endl;
+    out << "    AI U3:" << (int)mData.mAiData.mU3 << std::endl;
+    out << "    AI Services:" << Misc::StringUtils::format("0x%08X", mData.mAiData.mServices) << std::endl;
 
     for (const ESM::AIPackage &package : mData.mAiPackage.mList)
-        printAIPackage(package);
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+        printAIPackage(out, package);
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Dialogue>::print()
+void Record<ESM::Dialogue>::print(std::ostream& out)
 {
-    std::cout << "  Type: " << dialogTypeLabel(mData.mType)
+    out << "  Type: " << dialogTypeLabel(mData.mType)
               << " (" << (int)mData.mType << ")" << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
     // Sadly, there are no DialInfos, because the loader dumps as it
     // loads, rather than loading and then dumping. :-( Anyone mind if
     // I change this?
     for (const ESM::DialInfo &info : mData.mInfo)
-        std::cout << "INFO!" << info.mId << std::endl;
+        out << "INFO!" << info.mId << std::endl;
 }
 
 template<>
-void Record<ESM::Door>::print()
+void Record<ESM::Door>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Model: " << mData.mModel << std::endl;
-    std::cout << "  Script: " << mData.mScript << std::endl;
-    std::cout << "  OpenSound: " << mData.mOpenSound << std::endl;
-    std::cout << "  CloseSound: " << mData.mCloseSound << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Model: " << mData.mModel << std::endl;
+    out << "  Script: " << mData.mScript << std::endl;
+    out << "  OpenSound: " << mData.mOpenSound << std::endl;
+    out << "  CloseSound: " << mData.mCloseSound << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Enchantment>::print()
+void Record<ESM::Enchantment>::print(std::ostream& out)
 {
-    std::cout << "  Type: " << enchantTypeLabel(mData.mData.mType)
+    out << "  Type: " << enchantTypeLabel(mData.mData.mType)
               << " (" << mData.mData.mType << ")" << std::endl;
-    std::cout << "  Cost: " << mData.mData.mCost << std::endl;
-    std::cout << "  Charge: " << mData.mData.mCharge << std::endl;
-    std::cout << "  Flags: " << enchantmentFlags(mData.mData.mFlags) << std::endl;
-    printEffectList(mData.mEffects);
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Cost: " << mData.mData.mCost << std::endl;
+    out << "  Charge: " << mData.mData.mCharge << std::endl;
+    out << "  Flags: " << enchantmentFlags(mData.mData.mFlags) << std::endl;
+    printEffectList(out, mData.mEffects);
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Faction>::print()
+void Record<ESM::Faction>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Hidden: " << mData.mData.mIsHidden << std::endl;
-    std::cout << "  Attribute1: " << attributeLabel(mData.mData.mAttribute[0])
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Hidden: " << mData.mData.mIsHidden << std::endl;
+    out << "  Attribute1: " << attributeLabel(mData.mData.mAttribute[0])
               << " (" << mData.mData.mAttribute[0] << ")" << std::endl;
-    std::cout << "  Attribute2: " << attributeLabel(mData.mData.mAttribute[1])
+    out << "  Attribute2: " << attributeLabel(mData.mData.mAttribute[1])
               << " (" << mData.mData.mAttribute[1] << ")" << std::endl;
     for (int skill : mData.mData.mSkills)
         if (skill != -1)
-            std::cout << "  Skill: " << skillLabel(skill) << " (" << skill << ")" << std::endl;
+            out << "  Skill: " << skillLabel(skill) << " (" << skill << ")" << std::endl;
     for (int i = 0; i != 10; i++)
         if (!mData.mRanks[i].empty())
         {
-            std::cout << "  Rank: " << mData.mRanks[i] << std::endl;
-            std::cout << "    Attribute1 Requirement: "
+            out << "  Rank: " << mData.mRanks[i] << std::endl;
+            out << "    Attribute1 Requirement: "
                       << mData.mData.mRankData[i].mAttribute1 << std::endl;
-            std::cout << "    Attribute2 Requirement: "
+            out << "    Attribute2 Requirement: "
                       << mData.mData.mRankData[i].mAttribute2 << std::endl;
-            std::cout << "    One Skill at Level: "
+            out << "    One Skill at Level: "
                       << mData.mData.mRankData[i].mPrimarySkill << std::endl;
-            std::cout << "    Two Skills at Level: "
+            out << "    Two Skills at Level: "
                       << mData.mData.mRankData[i].mFavouredSkill << std::endl;
-            std::cout << "    Faction Reaction: "
+            out << "    Faction Reaction: "
                       << mData.mData.mRankData[i].mFactReaction << std::endl;
         }
     for (const auto &reaction : mData.mReactions)
-        std::cout << "  Reaction: " << reaction.second << " = " << reaction.first << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+        out << "  Reaction: " << reaction.second << " = " << reaction.first << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Global>::print()
+void Record<ESM::Global>::print(std::ostream& out)
 {
-    std::cout << "  " << mData.mValue << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  " << mData.mValue << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::GameSetting>::print()
+void Record<ESM::GameSetting>::print(std::ostream& out)
 {
-    std::cout << "  " << mData.mValue << std::endl;
+    out << "  " << mData.mValue << std::endl;
 }
 
 template<>
-void Record<ESM::DialInfo>::print()
+void Record<ESM::DialInfo>::print(std::ostream& out)
 {
-    std::cout << "  Id: " << mData.mId << std::endl;
+    out << "  Id: " << mData.mId << std::endl;
     if (!mData.mPrev.empty())
-        std::cout << "  Previous ID: " << mData.mPrev << std::endl;
+        out << "  Previous ID: " << mData.mPrev << std::endl;
     if (!mData.mNext.empty())
-        std::cout << "  Next ID: " << mData.mNext << std::endl;
-    std::cout << "  Text: " << mData.mResponse << std::endl;
+        out << "  Next ID: " << mData.mNext << std::endl;
+    out << "  Text: " << mData.mResponse << std::endl;
     if (!mData.mActor.empty())
-        std::cout << "  Actor: " << mData.mActor << std::endl;
+        out << "  Actor: " << mData.mActor << std::endl;
     if (!mData.mRace.empty())
-        std::cout << "  Race: " << mData.mRace << std::endl;
+        out << "  Race: " << mData.mRace << std::endl;
     if (!mData.mClass.empty())
-        std::cout << "  Class: " << mData.mClass << std::endl;
-    std::cout << "  Factionless: " << mData.mFactionLess << std::endl;
+        out << "  Class: " << mData.mClass << std::endl;
+    out << "  Factionless: " << mData.mFactionLess << std::endl;
     if (!mData.mFaction.empty())
-        std::cout << "  NPC Faction: " << mData.mFaction << std::endl;
+        out << "  NPC Faction: " << mData.mFaction << std::endl;
     if (mData.mData.mRank != -1)
-        std::cout << "  NPC Rank: " << (int)mData.mData.mRank << std::endl;
+        out << "  NPC Rank: " << (int)mData.mData.mRank << std::endl;
     if (!mData.mPcFaction.empty())
-        std::cout << "  PC Faction: " << mData.mPcFaction << std::endl;
+        out << "  PC Faction: " << mData.mPcFaction << std::endl;
     // CHANGE? non-standard capitalization mPCrank -> mPCRank (mPcRank?)
     if (mData.mData.mPCrank != -1)
-        std::cout << "  PC Rank: " << (int)mData.mData.mPCrank << std::endl;
+        out << "  PC Rank: " << (int)mData.mData.mPCrank << std::endl;
     if (!mData.mCell.empty())
-        std::cout << "  Cell: " << mData.mCell << std::endl;
+        out << "  Cell: " << mData.mCell << std::endl;
     if (mData.mData.mDisposition > 0)
-        std::cout << "  Disposition/Journal index: " << mData.mData.mDisposition << std::endl;
+        out << "  Disposition/Journal index: " << mData.mData.mDisposition << std::endl;
     if (mData.mData.mGender != ESM::DialInfo::NA)
-        std::cout << "  Gender: " << mData.mData.mGender << std::endl;
+        out << "  Gender: " << mData.mData.mGender << std::endl;
     if (!mData.mSound.empty())
-        std::cout << "  Sound File: " << mData.mSound << std::endl;
+        out << "  Sound File: " << mData.mSound << std::endl;
 
 
-    std::cout << "  Quest Status: " << questStatusLabel(mData.mQuestStatus)
+    out << "  Quest Status: " << questStatusLabel(mData.mQuestStatus)
               << " (" << mData.mQuestStatus << ")" << std::endl;
-    std::cout << "  Unknown1: " << mData.mData.mUnknown1 << std::endl;
-    std::cout << "  Unknown2: " << (int)mData.mData.mUnknown2 << std::endl;
+    out << "  Unknown1: " << mData.mData.mUnknown1 << std::endl;
+    out << "  Unknown2: " << (int)mData.mData.mUnknown2 << std::endl;
 
     for (const ESM::DialInfo::SelectStruct &rule : mData.mSelects)
-        std::cout << "  Select Rule: " << ruleString(rule) << std::endl;
+        out << "  Select Rule: " << ruleString(rule) << std::endl;
 
     if (!mData.mResultScript.empty())
     {
         if (mPrintPlain)
         {
-            std::cout << "  Result Script:" << std::endl;
-            std::cout << "START--------------------------------------" << std::endl;
-            std::cout << mData.mResultScript << std::endl;
-            std::cout << "END----------------------------------------" << std::endl;
+            out << "  Result Script:" << std::endl;
+            out << "START--------------------------------------" << std::endl;
+            out << mData.mResultScript << std::endl;
+            out << "END----------------------------------------" << std::endl;
         }
         else
         {
-            std::cout << "  Result Script: [skipped]" << std::endl;
+            out << "  Result Script: [skipped]" << std::endl;
         }
     }
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Ingredient>::print()
+void Record<ESM::Ingredient>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Model: " << mData.mModel << std::endl;
-    std::cout << "  Icon: " << mData.mIcon << std::endl;
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Model: " << mData.mModel << std::endl;
+    out << "  Icon: " << mData.mIcon << std::endl;
     if (!mData.mScript.empty())
-        std::cout << "  Script: " << mData.mScript << std::endl;
-    std::cout << "  Weight: " << mData.mData.mWeight << std::endl;
-    std::cout << "  Value: " << mData.mData.mValue << std::endl;
+        out << "  Script: " << mData.mScript << std::endl;
+    out << "  Weight: " << mData.mData.mWeight << std::endl;
+    out << "  Value: " << mData.mData.mValue << std::endl;
     for (int i = 0; i !=4; i++)
     {
         // A value of -1 means no effect
         if (mData.mData.mEffectID[i] == -1) continue;
-        std::cout << "  Effect: " << magicEffectLabel(mData.mData.mEffectID[i])
+        out << "  Effect: " << magicEffectLabel(mData.mData.mEffectID[i])
                   << " (" << mData.mData.mEffectID[i] << ")" << std::endl;
-        std::cout << "  Skill: " << skillLabel(mData.mData.mSkills[i])
+        out << "  Skill: " << skillLabel(mData.mData.mSkills[i])
                   << " (" << mData.mData.mSkills[i] << ")" << std::endl;
-        std::cout << "  Attribute: " << attributeLabel(mData.mData.mAttributes[i])
+        out << "  Attribute: " << attributeLabel(mData.mData.mAttributes[i])
                   << " (" << mData.mData.mAttributes[i] << ")" << std::endl;
     }
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Land>::print()
+void Record<ESM::Land>::print(std::ostream& out)
 {
-    std::cout << "  Coordinates: (" << mData.mX << "," << mData.mY << ")" << std::endl;
-    std::cout << "  Flags: " << landFlags(mData.mFlags) << std::endl;
-    std::cout << "  DataTypes: " << mData.mDataTypes << std::endl;
+    out << "  Coordinates: (" << mData.mX << "," << mData.mY << ")" << std::endl;
+    out << "  Flags: " << landFlags(mData.mFlags) << std::endl;
+    out << "  DataTypes: " << mData.mDataTypes << std::endl;
 
     if (const ESM::Land::LandData *data = mData.getLandData (mData.mDataTypes))
     {
-        std::cout << "  Height Offset: " << data->mHeightOffset << std::endl;
+        out << "  Height Offset: " << data->mHeightOffset << std::endl;
         // Lots of missing members.
-        std::cout << "  Unknown1: " << data->mUnk1 << std::endl;
-        std::cout << "  Unknown2: " << data->mUnk2 << std::endl;
+        out << "  Unknown1: " << data->mUnk1 << std::endl;
+        out << "  Unknown2: " << data->mUnk2 << std::endl;
     }
     mData.unloadData();
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::CreatureLevList>::print()
+void Record<ESM::CreatureLevList>::print(std::ostream& out)
 {
-    std::cout << "  Chance for None: " << (int)mData.mChanceNone << std::endl;
-    std::cout << "  Flags: " << creatureListFlags(mData.mFlags) << std::endl;
-    std::cout << "  Number of items: " << mData.mList.size() << std::endl;
+    out << "  Chance for None: " << (int)mData.mChanceNone << std::endl;
+    out << "  Flags: " << creatureListFlags(mData.mFlags) << std::endl;
+    out << "  Number of items: " << mData.mList.size() << std::endl;
     for (const ESM::LevelledListBase::LevelItem &item : mData.mList)
-        std::cout << "  Creature: Level: " << item.mLevel
+        out << "  Creature: Level: " << item.mLevel
                   << " Creature: " << item.mId << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::ItemLevList>::print()
+void Record<ESM::ItemLevList>::print(std::ostream& out)
 {
-    std::cout << "  Chance for None: " << (int)mData.mChanceNone << std::endl;
-    std::cout << "  Flags: " << itemListFlags(mData.mFlags) << std::endl;
-    std::cout << "  Number of items: " << mData.mList.size() << std::endl;
+    out << "  Chance for None: " << (int)mData.mChanceNone << std::endl;
+    out << "  Flags: " << itemListFlags(mData.mFlags) << std::endl;
+    out << "  Number of items: " << mData.mList.size() << std::endl;
     for (const ESM::LevelledListBase::LevelItem &item : mData.mList)
-        std::cout << "  Inventory: Level: " << item.mLevel
+        out << "  Inventory: Level: " << item.mLevel
                   << " Item: " << item.mId << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Light>::print()
+void Record<ESM::Light>::print(std::ostream& out)
 {
     if (!mData.mName.empty())
-        std::cout << "  Name: " << mData.mName << std::endl;
+        out << "  Name: " << mData.mName << std::endl;
     if (!mData.mModel.empty())
-        std::cout << "  Model: " << mData.mModel << std::endl;
+        out << "  Model: " << mData.mModel << std::endl;
     if (!mData.mIcon.empty())
-        std::cout << "  Icon: " << mData.mIcon << std::endl;
+        out << "  Icon: " << mData.mIcon << std::endl;
     if (!mData.mScript.empty())
-        std::cout << "  Script: " << mData.mScript << std::endl;
-    std::cout << "  Flags: " << lightFlags(mData.mData.mFlags) << std::endl;
-    std::cout << "  Weight: " << mData.mData.mWeight << std::endl;
-    std::cout << "  Value: " << mData.mData.mValue << std::endl;
-    std::cout << "  Sound: " << mData.mSound << std::endl;
-    std::cout << "  Duration: " << mData.mData.mTime << std::endl;
-    std::cout << "  Radius: " << mData.mData.mRadius << std::endl;
-    std::cout << "  Color: " << mData.mData.mColor << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+        out << "  Script: " << mData.mScript << std::endl;
+    out << "  Flags: " << lightFlags(mData.mData.mFlags) << std::endl;
+    out << "  Weight: " << mData.mData.mWeight << std::endl;
+    out << "  Value: " << mData.mData.mValue << std::endl;
+    out << "  Sound: " << mData.mSound << std::endl;
+    out << "  Duration: " << mData.mData.mTime << std::endl;
+    out << "  Radius: " << mData.mData.mRadius << std::endl;
+    out << "  Color: " << mData.mData.mColor << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Lockpick>::print()
+void Record<ESM::Lockpick>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Model: " << mData.mModel << std::endl;
-    std::cout << "  Icon: " << mData.mIcon << std::endl;
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Model: " << mData.mModel << std::endl;
+    out << "  Icon: " << mData.mIcon << std::endl;
     if (!mData.mScript.empty())
-        std::cout << "  Script: " << mData.mScript << std::endl;
-    std::cout << "  Weight: " << mData.mData.mWeight << std::endl;
-    std::cout << "  Value: " << mData.mData.mValue << std::endl;
-    std::cout << "  Quality: " << mData.mData.mQuality << std::endl;
-    std::cout << "  Uses: " << mData.mData.mUses << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+        out << "  Script: " << mData.mScript << std::endl;
+    out << "  Weight: " << mData.mData.mWeight << std::endl;
+    out << "  Value: " << mData.mData.mValue << std::endl;
+    out << "  Quality: " << mData.mData.mQuality << std::endl;
+    out << "  Uses: " << mData.mData.mUses << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Probe>::print()
+void Record<ESM::Probe>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Model: " << mData.mModel << std::endl;
-    std::cout << "  Icon: " << mData.mIcon << std::endl;
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Model: " << mData.mModel << std::endl;
+    out << "  Icon: " << mData.mIcon << std::endl;
     if (!mData.mScript.empty())
-        std::cout << "  Script: " << mData.mScript << std::endl;
-    std::cout << "  Weight: " << mData.mData.mWeight << std::endl;
-    std::cout << "  Value: " << mData.mData.mValue << std::endl;
-    std::cout << "  Quality: " << mData.mData.mQuality << std::endl;
-    std::cout << "  Uses: " << mData.mData.mUses << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+        out << "  Script: " << mData.mScript << std::endl;
+    out << "  Weight: " << mData.mData.mWeight << std::endl;
+    out << "  Value: " << mData.mData.mValue << std::endl;
+    out << "  Quality: " << mData.mData.mQuality << std::endl;
+    out << "  Uses: " << mData.mData.mUses << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Repair>::print()
+void Record<ESM::Repair>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Model: " << mData.mModel << std::endl;
-    std::cout << "  Icon: " << mData.mIcon << std::endl;
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Model: " << mData.mModel << std::endl;
+    out << "  Icon: " << mData.mIcon << std::endl;
     if (!mData.mScript.empty())
-        std::cout << "  Script: " << mData.mScript << std::endl;
-    std::cout << "  Weight: " << mData.mData.mWeight << std::endl;
-    std::cout << "  Value: " << mData.mData.mValue << std::endl;
-    std::cout << "  Quality: " << mData.mData.mQuality << std::endl;
-    std::cout << "  Uses: " << mData.mData.mUses << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+        out << "  Script: " << mData.mScript << std::endl;
+    out << "  Weight: " << mData.mData.mWeight << std::endl;
+    out << "  Value: " << mData.mData.mValue << std::endl;
+    out << "  Quality: " << mData.mData.mQuality << std::endl;
+    out << "  Uses: " << mData.mData.mUses << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::LandTexture>::print()
+void Record<ESM::LandTexture>::print(std::ostream& out)
 {
-    std::cout << "  Id: " << mData.mId << std::endl;
-    std::cout << "  Index: " << mData.mIndex << std::endl;
-    std::cout << "  Texture: " << mData.mTexture << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Id: " << mData.mId << std::endl;
+    out << "  Index: " << mData.mIndex << std::endl;
+    out << "  Texture: " << mData.mTexture << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::MagicEffect>::print()
+void Record<ESM::MagicEffect>::print(std::ostream& out)
 {
-    std::cout << "  Index: " << magicEffectLabel(mData.mIndex)
+    out << "  Index: " << magicEffectLabel(mData.mIndex)
               << " (" << mData.mIndex << ")" << std::endl;
-    std::cout << "  Description: " << mData.mDescription << std::endl;
-    std::cout << "  Icon: " << mData.mIcon << std::endl;
-    std::cout << "  Flags: " << magicEffectFlags(mData.mData.mFlags) << std::endl;
-    std::cout << "  Particle Texture: " << mData.mParticle << std::endl;
+    out << "  Description: " << mData.mDescription << std::endl;
+    out << "  Icon: " << mData.mIcon << std::endl;
+    out << "  Flags: " << magicEffectFlags(mData.mData.mFlags) << std::endl;
+    out << "  Particle Texture: " << mData.mParticle << std::endl;
     if (!mData.mCasting.empty())
-        std::cout << "  Casting Static: " << mData.mCasting << std::endl;
+        out << "  Casting Static: " << mData.mCasting << std::endl;
     if (!mData.mCastSound.empty())
-        std::cout << "  Casting Sound: " << mData.mCastSound << std::endl;
+        out << "  Casting Sound: " << mData.mCastSound << std::endl;
     if (!mData.mBolt.empty())
-        std::cout << "  Bolt Static: " << mData.mBolt << std::endl;
+        out << "  Bolt Static: " << mData.mBolt << std::endl;
     if (!mData.mBoltSound.empty())
-        std::cout << "  Bolt Sound: " << mData.mBoltSound << std::endl;
+        out << "  Bolt Sound: " << mData.mBoltSound << std::endl;
     if (!mData.mHit.empty())
-        std::cout << "  Hit Static: " << mData.mHit << std::endl;
+        out << "  Hit Static: " << mData.mHit << std::endl;
     if (!mData.mHitSound.empty())
-        std::cout << "  Hit Sound: " << mData.mHitSound << std::endl;
+        out << "  Hit Sound: " << mData.mHitSound << std::endl;
     if (!mData.mArea.empty())
-        std::cout << "  Area Static: " << mData.mArea << std::endl;
+        out << "  Area Static: " << mData.mArea << std::endl;
     if (!mData.mAreaSound.empty())
-        std::cout << "  Area Sound: " << mData.mAreaSound << std::endl;
-    std::cout << "  School: " << schoolLabel(mData.mData.mSchool)
+        out << "  Area Sound: " << mData.mAreaSound << std::endl;
+    out << "  School: " << schoolLabel(mData.mData.mSchool)
               << " (" << mData.mData.mSchool << ")" << std::endl;
-    std::cout << "  Base Cost: " << mData.mData.mBaseCost << std::endl;
-    std::cout << "  Unknown 1: " << mData.mData.mUnknown1 << std::endl;
-    std::cout << "  Speed: " << mData.mData.mSpeed << std::endl;
-    std::cout << "  Unknown 2: " << mData.mData.mUnknown2 << std::endl;
-    std::cout << "  RGB Color: " << "("
+    out << "  Base Cost: " << mData.mData.mBaseCost << std::endl;
+    out << "  Unknown 1: " << mData.mData.mUnknown1 << std::endl;
+    out << "  Speed: " << mData.mData.mSpeed << std::endl;
+    out << "  Unknown 2: " << mData.mData.mUnknown2 << std::endl;
+    out << "  RGB Color: " << "("
               << mData.mData.mRed << ","
               << mData.mData.mGreen << ","
               << mData.mData.mBlue << ")" << std::endl;
 }
 
 template<>
-void Record<ESM::Miscellaneous>::print()
+void Record<ESM::Miscellaneous>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Model: " << mData.mModel << std::endl;
-    std::cout << "  Icon: " << mData.mIcon << std::endl;
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Model: " << mData.mModel << std::endl;
+    out << "  Icon: " << mData.mIcon << std::endl;
     if (!mData.mScript.empty())
-        std::cout << "  Script: " << mData.mScript << std::endl;
-    std::cout << "  Weight: " << mData.mData.mWeight << std::endl;
-    std::cout << "  Value: " << mData.mData.mValue << std::endl;
-    std::cout << "  Is Key: " << mData.mData.mIsKey << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+        out << "  Script: " << mData.mScript << std::endl;
+    out << "  Weight: " << mData.mData.mWeight << std::endl;
+    out << "  Value: " << mData.mData.mValue << std::endl;
+    out << "  Is Key: " << mData.mData.mIsKey << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::NPC>::print()
+void Record<ESM::NPC>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Animation: " << mData.mModel << std::endl;
-    std::cout << "  Hair Model: " << mData.mHair << std::endl;
-    std::cout << "  Head Model: " << mData.mHead << std::endl;
-    std::cout << "  Race: " << mData.mRace << std::endl;
-    std::cout << "  Class: " << mData.mClass << std::endl;
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Animation: " << mData.mModel << std::endl;
+    out << "  Hair Model: " << mData.mHair << std::endl;
+    out << "  Head Model: " << mData.mHead << std::endl;
+    out << "  Race: " << mData.mRace << std::endl;
+    out << "  Class: " << mData.mClass << std::endl;
     if (!mData.mScript.empty())
-        std::cout << "  Script: " << mData.mScript << std::endl;
+        out << "  Script: " << mData.mScript << std::endl;
     if (!mData.mFaction.empty())
-        std::cout << "  Faction: " << mData.mFaction << std::endl;
-    std::cout << "  Flags: " << npcFlags((int)mData.mFlags) << std::endl;
+        out << "  Faction: " << mData.mFaction << std::endl;
+    out << "  Flags: " << npcFlags((int)mData.mFlags) << std::endl;
     if (mData.mBloodType != 0)
-        std::cout << "  Blood Type: " << mData.mBloodType+1 << std::endl;
+        out << "  Blood Type: " << mData.mBloodType+1 << std::endl;
 
     if (mData.mNpdtType == ESM::NPC::NPC_WITH_AUTOCALCULATED_STATS)
     {
-        std::cout << "  Level: " << mData.mNpdt.mLevel << std::endl;
-        std::cout << "  Reputation: " << (int)mData.mNpdt.mReputation << std::endl;
-        std::cout << "  Disposition: " << (int)mData.mNpdt.mDisposition << std::endl;
-        std::cout << "  Rank: " << (int)mData.mNpdt.mRank << std::endl;
-        std::cout << "  Gold: " << mData.mNpdt.mGold << std::endl;
+        out << "  Level: " << mData.mNpdt.mLevel << std::endl;
+        out << "  Reputation: " << (int)mData.mNpdt.mReputation << std::endl;
+        out << "  Disposition: " << (int)mData.mNpdt.mDisposition << std::endl;
+        out << "  Rank: " << (int)mData.mNpdt.mRank << std::endl;
+        out << "  Gold: " << mData.mNpdt.mGold << std::endl;
     }
     else {
-        std::cout << "  Level: " << mData.mNpdt.mLevel << std::endl;
-        std::cout << "  Reputation: " << (int)mData.mNpdt.mReputation << std::endl;
-        std::cout << "  Disposition: " << (int)mData.mNpdt.mDisposition << std::endl;
-        std::cout << "  Rank: " << (int)mData.mNpdt.mRank << std::endl;
-
-        std::cout << "  Attributes:" << std::endl;
-        std::cout << "    Strength: " << (int)mData.mNpdt.mStrength << std::endl;
-        std::cout << "    Intelligence: " << (int)mData.mNpdt.mIntelligence << std::endl;
-        std::cout << "    Willpower: " << (int)mData.mNpdt.mWillpower << std::endl;
-        std::cout << "    Agility: " << (int)mData.mNpdt.mAgility << std::endl;
-        std::cout << "    Speed: " << (int)mData.mNpdt.mSpeed << std::endl;
-        std::cout << "    Endurance: " << (int)mData.mNpdt.mEndurance << std::endl;
-        std::cout << "    Personality: " << (int)mData.mNpdt.mPersonality << std::endl;
-        std::cout << "    Luck: " << (int)mData.mNpdt.mLuck << std::endl;
-
-        std::cout << "  Skills:" << std::endl;
+        out << "  Level: " << mData.mNpdt.mLevel << std::endl;
+        out << "  Reputation: " << (int)mData.mNpdt.mReputation << std::endl;
+        out << "  Disposition: " << (int)mData.mNpdt.mDisposition << std::endl;
+        out << "  Rank: " << (int)mData.mNpdt.mRank << std::endl;
+
+        out << "  Attributes:" << std::endl;
+        out << "    Strength: " << (int)mData.mNpdt.mStrength << std::endl;
+        out << "    Intelligence: " << (int)mData.mNpdt.mIntelligence << std::endl;
+        out << "    Willpower: " << (int)mData.mNpdt.mWillpower << std::endl;
+        out << "    Agility: " << (int)mData.mNpdt.mAgility << std::endl;
+        out << "    Speed: " << (int)mData.mNpdt.mSpeed << std::endl;
+        out << "    Endurance: " << (int)mData.mNpdt.mEndurance << std::endl;
+        out << "    Personality: " << (int)mData.mNpdt.mPersonality << std::endl;
+        out << "    Luck: " << (int)mData.mNpdt.mLuck << std::endl;
+
+        out << "  Skills:" << std::endl;
         for (int i = 0; i != ESM::Skill::Length; i++)
-            std::cout << "    " << skillLabel(i) << ": "
+            out << "    " << skillLabel(i) << ": "
                       << (int)(mData.mNpdt.mSkills[i]) << std::endl;
 
-        std::cout << "  Health: " << mData.mNpdt.mHealth << std::endl;
-        std::cout << "  Magicka: " << mData.mNpdt.mMana << std::endl;
-        std::cout << "  Fatigue: " << mData.mNpdt.mFatigue << std::endl;
-        std::cout << "  Gold: " << mData.mNpdt.mGold << std::endl;
+        out << "  Health: " << mData.mNpdt.mHealth << std::endl;
+        out << "  Magicka: " << mData.mNpdt.mMana << std::endl;
+        out << "  Fatigue: " << mData.mNpdt.mFatigue << std::endl;
+        out << "  Gold: " << mData.mNpdt.mGold << std::endl;
     }
 
     for (const ESM::ContItem &item : mData.mInventory.mList)
-        std::cout << "  Inventory: Count: " << Misc::StringUtils::format("%4d", item.mCount)
+        out << "  Inventory: Count: " << Misc::StringUtils::format("%4d", item.mCount)
                   << " Item: " << item.mItem << std::endl;
 
     for (const std::string &spell : mData.mSpells.mList)
-        std::cout << "  Spell: " << spell << std::endl;
+        out << "  Spell: " << spell << std::endl;
 
-    printTransport(mData.getTransport());
+    printTransport(out, mData.getTransport());
 
-    std::cout << "  Artificial Intelligence: " << std::endl;
-    std::cout << "    AI Hello:" << (int)mData.mAiData.mHello << std::endl;
-    std::cout << "    AI Fight:" << (int)mData.mAiData.mFight << std::endl;
-    std::cout << "    AI Flee:" << (int)mData.mAiData.mFlee << std::endl;
-    std::cout << "    AI Alarm:" << (int)mData.mAiData.mAlarm << std::endl;
-    std::cout << "    AI U1:" << (int)mData.mAiData.mU1 << std::endl;
-    std::cout << "    AI U2:" << (int)mData.mAiData.mU2 << std::endl;
-    std::cout << "    AI U3:" << (int)mData.mAiData.mU3 << std::endl;
-    std::cout << "    AI Services:" << Misc::StringUtils::format("0x%08X", mData.mAiData.mServices) << std::endl;
+    out << "  Artificial Intelligence: " << std::endl;
+    out << "    AI Hello:" << (int)mData.mAiData.mHello << std::endl;
+    out << "    AI Fight:" << (int)mData.mAiData.mFight << std::endl;
+    out << "    AI Flee:" << (int)mData.mAiData.mFlee << std::endl;
+    out << "    AI Alarm:" << (int)mData.mAiData.mAlarm << std::endl;
+    out << "    AI U1:" << (int)mData.mAiData.mU1 << std::endl;
+    out << "    AI U2:" << (int)mData.mAiData.mU2 << std::endl;
+    out << "    AI U3:" << (int)mData.mAiData.mU3 << std::endl;
+    out << "    AI Services:" << Misc::StringUtils::format("0x%08X", mData.mAiData.mServices) << std::endl;
 
     for (const ESM::AIPackage &package : mData.mAiPackage.mList)
-        printAIPackage(package);
+        printAIPackage(out, package);
 
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Pathgrid>::print()
+void Record<ESM::Pathgrid>::print(std::ostream& out)
 {
-    std::cout << "  Cell: " << mData.mCell << std::endl;
-    std::cout << "  Coordinates: (" << mData.mData.mX << "," << mData.mData.mY << ")" << std::endl;
-    std::cout << "  Unknown S1: " << mData.mData.mS1 << std::endl;
+    out << "  Cell: " << mData.mCell << std::endl;
+    out << "  Coordinates: (" << mData.mData.mX << "," << mData.mData.mY << ")" << std::endl;
+    out << "  Unknown S1: " << mData.mData.mS1 << std::endl;
     if ((unsigned int)mData.mData.mS2 != mData.mPoints.size())
-        std::cout << "  Reported Point Count: " << mData.mData.mS2 << std::endl;
-    std::cout << "  Point Count: " << mData.mPoints.size() << std::endl;
-    std::cout << "  Edge Count: " << mData.mEdges.size() << std::endl;
+        out << "  Reported Point Count: " << mData.mData.mS2 << std::endl;
+    out << "  Point Count: " << mData.mPoints.size() << std::endl;
+    out << "  Edge Count: " << mData.mEdges.size() << std::endl;
 
     int i = 0;
     for (const ESM::Pathgrid::Point &point : mData.mPoints)
     {
-        std::cout << "  Point[" << i << "]:" << std::endl;
-        std::cout << "    Coordinates: (" << point.mX << ","
+        out << "  Point[" << i << "]:" << std::endl;
+        out << "    Coordinates: (" << point.mX << ","
              << point.mY << "," << point.mZ << ")" << std::endl;
-        std::cout << "    Auto-Generated: " << (int)point.mAutogenerated << std::endl;
-        std::cout << "    Connections: " << (int)point.mConnectionNum << std::endl;
-        std::cout << "    Unknown: " << point.mUnknown << std::endl;
+        out << "    Auto-Generated: " << (int)point.mAutogenerated << std::endl;
+        out << "    Connections: " << (int)point.mConnectionNum << std::endl;
+        out << "    Unknown: " << point.mUnknown << std::endl;
         i++;
     }
 
     i = 0;
     for (const ESM::Pathgrid::Edge &edge : mData.mEdges)
     {
-        std::cout << "  Edge[" << i << "]: " << edge.mV0 << " -> " << edge.mV1 << std::endl;
+        out << "  Edge[" << i << "]: " << edge.mV0 << " -> " << edge.mV1 << std::endl;
         if (edge.mV0 >= mData.mData.mS2 || edge.mV1 >= mData.mData.mS2)
-            std::cout << "  BAD POINT IN EDGE!" << std::endl;
+            out << "  BAD POINT IN EDGE!" << std::endl;
         i++;
     }
 
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Race>::print()
+void Record<ESM::Race>::print(std::ostream& out)
 {
     static const char *sAttributeNames[8] =
     {
@@ -1137,190 +1137,190 @@ void Record<ESM::Race>::print()
         "Speed", "Endurance", "Personality", "Luck"
     };
 
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Description: " << mData.mDescription << std::endl;
-    std::cout << "  Flags: " << raceFlags(mData.mData.mFlags) << std::endl;
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Description: " << mData.mDescription << std::endl;
+    out << "  Flags: " << raceFlags(mData.mData.mFlags) << std::endl;
 
     for (int i=0; i<2; ++i)
     {
         bool male = i==0;
 
-        std::cout << (male ? "  Male:" : "  Female:") << std::endl;
+        out << (male ? "  Male:" : "  Female:") << std::endl;
 
         for (int j=0; j<8; ++j)
-            std::cout << "    " << sAttributeNames[j] << ": "
+            out << "    " << sAttributeNames[j] << ": "
                 << mData.mData.mAttributeValues[j].getValue (male) << std::endl;
 
-        std::cout << "    Height: " << mData.mData.mHeight.getValue (male) << std::endl;
-        std::cout << "    Weight: " << mData.mData.mWeight.getValue (male) << std::endl;
+        out << "    Height: " << mData.mData.mHeight.getValue (male) << std::endl;
+        out << "    Weight: " << mData.mData.mWeight.getValue (male) << std::endl;
     }
 
     for (int i = 0; i != 7; i++)
         // Not all races have 7 skills.
         if (mData.mData.mBonus[i].mSkill != -1)
-            std::cout << "  Skill: "
+            out << "  Skill: "
                       << skillLabel(mData.mData.mBonus[i].mSkill)
                       << " (" << mData.mData.mBonus[i].mSkill << ") = "
                       << mData.mData.mBonus[i].mBonus << std::endl;
 
     for (const std::string &power : mData.mPowers.mList)
-        std::cout << "  Power: " << power << std::endl;
+        out << "  Power: " << power << std::endl;
 
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Region>::print()
+void Record<ESM::Region>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-
-    std::cout << "  Weather:" << std::endl;
-    std::cout << "    Clear: " << (int)mData.mData.mClear << std::endl;
-    std::cout << "    Cloudy: " << (int)mData.mData.mCloudy << std::endl;
-    std::cout << "    Foggy: " << (int)mData.mData.mFoggy << std::endl;
-    std::cout << "    Overcast: " << (int)mData.mData.mOvercast << std::endl;
-    std::cout << "    Rain: " << (int)mData.mData.mOvercast << std::endl;
-    std::cout << "    Thunder: " << (int)mData.mData.mThunder << std::endl;
-    std::cout << "    Ash: " << (int)mData.mData.mAsh << std::endl;
-    std::cout << "    Blight: " << (int)mData.mData.mBlight << std::endl;
-    std::cout << "    UnknownA: " << (int)mData.mData.mA << std::endl;
-    std::cout << "    UnknownB: " << (int)mData.mData.mB << std::endl;
-    std::cout << "  Map Color: " << mData.mMapColor << std::endl;
+    out << "  Name: " << mData.mName << std::endl;
+
+    out << "  Weather:" << std::endl;
+    out << "    Clear: " << (int)mData.mData.mClear << std::endl;
+    out << "    Cloudy: " << (int)mData.mData.mCloudy << std::endl;
+    out << "    Foggy: " << (int)mData.mData.mFoggy << std::endl;
+    out << "    Overcast: " << (int)mData.mData.mOvercast << std::endl;
+    out << "    Rain: " << (int)mData.mData.mOvercast << std::endl;
+    out << "    Thunder: " << (int)mData.mData.mThunder << std::endl;
+    out << "    Ash: " << (int)mData.mData.mAsh << std::endl;
+    out << "    Blight: " << (int)mData.mData.mBlight << std::endl;
+    out << "    UnknownA: " << (int)mData.mData.mA << std::endl;
+    out << "    UnknownB: " << (int)mData.mData.mB << std::endl;
+    out << "  Map Color: " << mData.mMapColor << std::endl;
     if (!mData.mSleepList.empty())
-        std::cout << "  Sleep List: " << mData.mSleepList << std::endl;
+        out << "  Sleep List: " << mData.mSleepList << std::endl;
     for (const ESM::Region::SoundRef &soundref : mData.mSoundList)
-        std::cout << "  Sound: " << (int)soundref.mChance << " = " << soundref.mSound << std::endl;
+        out << "  Sound: " << (int)soundref.mChance << " = " << soundref.mSound << std::endl;
 }
 
 template<>
-void Record<ESM::Script>::print()
+void Record<ESM::Script>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mId << std::endl;
+    out << "  Name: " << mData.mId << std::endl;
 
-    std::cout << "  Num Shorts: " << mData.mData.mNumShorts << std::endl;
-    std::cout << "  Num Longs: " << mData.mData.mNumLongs << std::endl;
-    std::cout << "  Num Floats: " << mData.mData.mNumFloats << std::endl;
-    std::cout << "  Script Data Size: " << mData.mData.mScriptDataSize << std::endl;
-    std::cout << "  Table Size: " << mData.mData.mStringTableSize << std::endl;
+    out << "  Num Shorts: " << mData.mData.mNumShorts << std::endl;
+    out << "  Num Longs: " << mData.mData.mNumLongs << std::endl;
+    out << "  Num Floats: " << mData.mData.mNumFloats << std::endl;
+    out << "  Script Data Size: " << mData.mData.mScriptDataSize << std::endl;
+    out << "  Table Size: " << mData.mData.mStringTableSize << std::endl;
 
     for (const std::string &variable : mData.mVarNames)
-        std::cout << "  Variable: " << variable << std::endl;
+        out << "  Variable: " << variable << std::endl;
 
-    std::cout << "  ByteCode: ";
+    out << "  ByteCode: ";
     for (const unsigned char &byte : mData.mScriptData)
-        std::cout << Misc::StringUtils::format("%02X", (int)(byte));
-    std::cout << std::endl;
+        out << Misc::StringUtils::format("%02X", (int)(byte));
+    out << std::endl;
 
     if (mPrintPlain)
     {
-        std::cout << "  Script:" << std::endl;
-        std::cout << "START--------------------------------------" << std::endl;
-        std::cout << mData.mScriptText << std::endl;
-        std::cout << "END----------------------------------------" << std::endl;
+        out << "  Script:" << std::endl;
+        out << "START--------------------------------------" << std::endl;
+        out << mData.mScriptText << std::endl;
+        out << "END----------------------------------------" << std::endl;
     }
     else
     {
-        std::cout << "  Script: [skipped]" << std::endl;
+        out << "  Script: [skipped]" << std::endl;
     }
 
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Skill>::print()
+void Record<ESM::Skill>::print(std::ostream& out)
 {
-    std::cout << "  ID: " << skillLabel(mData.mIndex)
+    out << "  ID: " << skillLabel(mData.mIndex)
               << " (" << mData.mIndex << ")" << std::endl;
-    std::cout << "  Description: " << mData.mDescription << std::endl;
-    std::cout << "  Governing Attribute: " << attributeLabel(mData.mData.mAttribute)
+    out << "  Description: " << mData.mDescription << std::endl;
+    out << "  Governing Attribute: " << attributeLabel(mData.mData.mAttribute)
               << " (" << mData.mData.mAttribute << ")" << std::endl;
-    std::cout << "  Specialization: " << specializationLabel(mData.mData.mSpecialization)
+    out << "  Specialization: " << specializationLabel(mData.mData.mSpecialization)
               << " (" << mData.mData.mSpecialization << ")" << std::endl;
     for (int i = 0; i != 4; i++)
-        std::cout << "  UseValue[" << i << "]:" << mData.mData.mUseValue[i] << std::endl;
+        out << "  UseValue[" << i << "]:" << mData.mData.mUseValue[i] << std::endl;
 }
 
 template<>
-void Record<ESM::SoundGenerator>::print()
+void Record<ESM::SoundGenerator>::print(std::ostream& out)
 {
     if (!mData.mCreature.empty())
-        std::cout << "  Creature: " << mData.mCreature << std::endl;
-    std::cout << "  Sound: " << mData.mSound << std::endl;
-    std::cout << "  Type: " << soundTypeLabel(mData.mType)
+        out << "  Creature: " << mData.mCreature << std::endl;
+    out << "  Sound: " << mData.mSound << std::endl;
+    out << "  Type: " << soundTypeLabel(mData.mType)
               << " (" << mData.mType << ")" << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Sound>::print()
+void Record<ESM::Sound>::print(std::ostream& out)
 {
-    std::cout << "  Sound: " << mData.mSound << std::endl;
-    std::cout << "  Volume: " << (int)mData.mData.mVolume << std::endl;
+    out << "  Sound: " << mData.mSound << std::endl;
+    out << "  Volume: " << (int)mData.mData.mVolume << std::endl;
     if (mData.mData.mMinRange != 0 && mData.mData.mMaxRange != 0)
-        std::cout << "  Range: " << (int)mData.mData.mMinRange << " - "
+        out << "  Range: " << (int)mData.mData.mMinRange << " - "
                   << (int)mData.mData.mMaxRange << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Spell>::print()
+void Record<ESM::Spell>::print(std::ostream& out)
 {
-    std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Type: " << spellTypeLabel(mData.mData.mType)
+    out << "  Name: " << mData.mName << std::endl;
+    out << "  Type: " << spellTypeLabel(mData.mData.mType)
               << " (" << mData.mData.mType << ")" << std::endl;
-    std::cout << "  Flags: " << spellFlags(mData.mData.mFlags) << std::endl;
-    std::cout << "  Cost: " << mData.mData.mCost << std::endl;
-    printEffectList(mData.mEffects);
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Flags: " << spellFlags(mData.mData.mFlags) << std::endl;
+    out << "  Cost: " << mData.mData.mCost << std::endl;
+    printEffectList(out, mData.mEffects);
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::StartScript>::print()
+void Record<ESM::StartScript>::print(std::ostream& out)
 {
-    std::cout << "  Start Script: " << mData.mId << std::endl;
-    std::cout << "  Start Data: " << mData.mData << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Start Script: " << mData.mId << std::endl;
+    out << "  Start Data: " << mData.mData << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<>
-void Record<ESM::Static>::print()
+void Record<ESM::Static>::print(std::ostream& out)
 {
-    std::cout << "  Model: " << mData.mModel << std::endl;
+    out << "  Model: " << mData.mModel << std::endl;
 }
 
 template<>
-void Record<ESM::Weapon>::print()
+void Record<ESM::Weapon>::print(std::ostream& out)
 {
     // No names on VFX bolts
     if (!mData.mName.empty())
-        std::cout << "  Name: " << mData.mName << std::endl;
-    std::cout << "  Model: " << mData.mModel << std::endl;
+        out << "  Name: " << mData.mName << std::endl;
+    out << "  Model: " << mData.mModel << std::endl;
     // No icons on VFX bolts or magic bolts
     if (!mData.mIcon.empty())
-        std::cout << "  Icon: " << mData.mIcon << std::endl;
+        out << "  Icon: " << mData.mIcon << std::endl;
     if (!mData.mScript.empty())
-        std::cout << "  Script: " << mData.mScript << std::endl;
+        out << "  Script: " << mData.mScript << std::endl;
     if (!mData.mEnchant.empty())
-        std::cout << "  Enchantment: " << mData.mEnchant << std::endl;
-    std::cout << "  Type: " << weaponTypeLabel(mData.mData.mType)
+        out << "  Enchantment: " << mData.mEnchant << std::endl;
+    out << "  Type: " << weaponTypeLabel(mData.mData.mType)
               << " (" << mData.mData.mType << ")" << std::endl;
-    std::cout << "  Flags: " << weaponFlags(mData.mData.mFlags) << std::endl;
-    std::cout << "  Weight: " << mData.mData.mWeight << std::endl;
-    std::cout << "  Value: " << mData.mData.mValue << std::endl;
-    std::cout << "  Health: " << mData.mData.mHealth << std::endl;
-    std::cout << "  Speed: " << mData.mData.mSpeed << std::endl;
-    std::cout << "  Reach: " << mData.mData.mReach << std::endl;
-    std::cout << "  Enchantment Points: " << mData.mData.mEnchant << std::endl;
+    out << "  Flags: " << weaponFlags(mData.mData.mFlags) << std::endl;
+    out << "  Weight: " << mData.mData.mWeight << std::endl;
+    out << "  Value: " << mData.mData.mValue << std::endl;
+    out << "  Health: " << mData.mData.mHealth << std::endl;
+    out << "  Speed: " << mData.mData.mSpeed << std::endl;
+    out << "  Reach: " << mData.mData.mReach << std::endl;
+    out << "  Enchantment Points: " << mData.mData.mEnchant << std::endl;
     if (mData.mData.mChop[0] != 0 && mData.mData.mChop[1] != 0)
-        std::cout << "  Chop: " << (int)mData.mData.mChop[0] << "-"
+        out << "  Chop: " << (int)mData.mData.mChop[0] << "-"
                   << (int)mData.mData.mChop[1] << std::endl;
     if (mData.mData.mSlash[0] != 0 && mData.mData.mSlash[1] != 0)
-        std::cout << "  Slash: " << (int)mData.mData.mSlash[0] << "-"
+        out << "  Slash: " << (int)mData.mData.mSlash[0] << "-"
                   << (int)mData.mData.mSlash[1] << std::endl;
     if (mData.mData.mThrust[0] != 0 && mData.mData.mThrust[1] != 0)
-        std::cout << "  Thrust: " << (int)mData.mData.mThrust[0] << "-"
+        out << "  Thrust: " << (int)mData.mData.mThrust[0] << "-"
                   << (int)mData.mData.mThrust[1] << std::endl;
-    std::cout << "  Deleted: " << mIsDeleted << std::endl;
+    out << "  Deleted: " << mIsDeleted << std::endl;
 }
 
 template<> 
@@ -1,6 +1,7 @@
 #ifndef OPENMW_ESMTOOL_RECORD_H
 #define OPENMW_ESMTOOL_RECORD_H
 
+#include <iosfwd>
 #include <string>
 
 #include <components/esm/records.hpp>
@@ -52,7 +53,7 @@ namespace EsmTool
 
         virtual void load(ESM::ESMReader &esm) = 0;
         virtual void save(ESM::ESMWriter &esm) = 0;
-        virtual void print() = 0;
+        virtual void print(std::ostream& out) = 0;
 
         static RecordBase *create(ESM::NAME type);
 
@@ -90,7 +91,7 @@ namespace EsmTool
             mData.load(esm, mIsDeleted);
         }
 
-        void print() override;
+        void print(std::ostream& out) override;
     };
     
     template<> std::string Record<ESM::Cell>::getId() const;
@@ -99,48 +100,48 @@ namespace EsmTool
     template<> std::string Record<ESM::Pathgrid>::getId() const;
     template<> std::string Record<ESM::Skill>::getId() const;
 
-    template<> void Record<ESM::Activator>::print();
-    template<> void Record<ESM::Potion>::print();
-    template<> void Record<ESM::Armor>::print();
-    template<> void Record<ESM::Apparatus>::print();
-    template<> void Record<ESM::BodyPart>::print();
-    template<> void Record<ESM::Book>::print();
-    template<> void Record<ESM::BirthSign>::print();
-    template<> void Record<ESM::Cell>::print();
-    template<> void Record<ESM::Class>::print();
-    template<> void Record<ESM::Clothing>::print();
-    template<> void Record<ESM::Container>::print();
-    template<> void Record<ESM::Creature>::print();
-    template<> void Record<ESM::Dialogue>::print();
-    template<> void Record<ESM::Door>::print();
-    template<> void Record<ESM::Enchantment>::print();
-    template<> void Record<ESM::Faction>::print();
-    template<> void Record<ESM::Global>::print();
-    template<> void Record<ESM::GameSetting>::print();
-    template<> void Record<ESM::DialInfo>::print();
-    template<> void Record<ESM::Ingredient>::print();
-    template<> void Record<ESM::Land>::print();
-    template<> void Record<ESM::CreatureLevList>::print();
-    template<> void Record<ESM::ItemLevList>::print();
-    template<> void Record<ESM::Light>::print();
-    template<> void Record<ESM::Lockpick>::print();
-    template<> void Record<ESM::Probe>::print();
-    template<> void Record<ESM::Repair>::print();
-    template<> void Record<ESM::LandTexture>::print();
-    template<> void Record<ESM::MagicEffect>::print();
-    template<> void Record<ESM::Miscellaneous>::print();
-    template<> void Record<ESM::NPC>::print();
-    template<> void Record<ESM::Pathgrid>::print();
-    template<> void Record<ESM::Race>::print();
-    template<> void Record<ESM::Region>::print();
-    template<> void Record<ESM::Script>::print();
-    template<> void Record<ESM::Skill>::print();
-    template<> void Record<ESM::SoundGenerator>::print();
-    template<> void Record<ESM::Sound>::print();
-    template<> void Record<ESM::Spell>::print();
-    template<> void Record<ESM::StartScript>::print();
-    template<> void Record<ESM::Static>::print();
-    template<> void Record<ESM::Weapon>::print();
+    template<> void Record<ESM::Activator>::print(std::ostream& out);
+    template<> void Record<ESM::Potion>::print(std::ostream& out);
+    template<> void Record<ESM::Armor>::print(std::ostream& out);
+    template<> void Record<ESM::Apparatus>::print(std::ostream& out);
+    template<> void Record<ESM::BodyPart>::print(std::ostream& out);
+    template<> void Record<ESM::Book>::print(std::ostream& out);
+    template<> void Record<ESM::BirthSign>::print(std::ostream& out);
+    template<> void Record<ESM::Cell>::print(std::ostream& out);
+    template<> void Record<ESM::Class>::print(std::ostream& out);
+    template<> void Record<ESM::Clothing>::print(std::ostream& out);
+    template<> void Record<ESM::Container>::print(std::ostream& out);
+    template<> void Record<ESM::Creature>::print(std::ostream& out);
+    template<> void Record<ESM::Dialogue>::print(std::ostream& out);
+    template<> void Record<ESM::Door>::print(std::ostream& out);
+    template<> void Record<ESM::Enchantment>::print(std::ostream& out);
+    template<> void Record<ESM::Faction>::print(std::ostream& out);
+    template<> void Record<ESM::Global>::print(std::ostream& out);
+    template<> void Record<ESM::GameSetting>::print(std::ostream& out);
+    template<> void Record<ESM::DialInfo>::print(std::ostream& out);
+    template<> void Record<ESM::Ingredient>::print(std::ostream& out);
+    template<> void Record<ESM::Land>::print(std::ostream& out);
+    template<> void Record<ESM::CreatureLevList>::print(std::ostream& out);
+    template<> void Record<ESM::ItemLevList>::print(std::ostream& out);
+    template<> void Record<ESM::Light>::print(std::ostream& out);
+    template<> void Record<ESM::Lockpick>::print(std::ostream& out);
+    template<> void Record<ESM::Probe>::print(std::ostream& out);
+    template<> void Record<ESM::Repair>::print(std::ostream& out);
+    template<> void Record<ESM::LandTexture>::print(std::ostream& out);
+    template<> void Record<ESM::MagicEffect>::print(std::ostream& out);
+    template<> void Record<ESM::Miscellaneous>::print(std::ostream& out);
+    template<> void Record<ESM::NPC>::print(std::ostream& out);
+    template<> void Record<ESM::Pathgrid>::print(std::ostream& out);
+    template<> void Record<ESM::Race>::print(std::ostream& out);
+    template<> void Record<ESM::Region>::print(std::ostream& out);
+    template<> void Record<ESM::Script>::print(std::ostream& out);
+    template<> void Record<ESM::Skill>::print(std::ostream& out);
+    template<> void Record<ESM::SoundGenerator>::print(std::ostream& out);
+    template<> void Record<ESM::Sound>::print(std::ostream& out);
+    template<> void Record<ESM::Spell>::print(std::ostream& out);
+    template<> void Record<ESM::StartScript>::print(std::ostream& out);
+    template<> void Record<ESM::Static>::print(std::ostream& out);
+    template<> void Record<ESM::Weapon>::print(std::ostream& out);
 }
 
 #endif
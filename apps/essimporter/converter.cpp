@@ -3,6 +3,7 @@
 #include <stdexcept>
 #include <algorithm>
 #include <climits> // INT_MIN
+#include <mutex>
 
 #include <osgDB/WriteFile>
 
@@ -25,6 +26,10 @@ namespace
         memcpy(image->data(), data, size);
         image->flipVertical();
 
+        // Batch mode converts saves in parallel and fog textures of the same
+        // exterior cell share a file name across saves, so serialize the writes.
+        static std::mutex writeMutex;
+        std::lock_guard<std::mutex> lock (writeMutex);
         osgDB::writeImageFile(*image, out);
     }
 
@@ -1,8 +1,16 @@
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <boost/program_options.hpp>
 #include <boost/filesystem.hpp>
 
+#include <osgDB/Registry>
+
 #include <components/files/configurationmanager.hpp>
 
 #include "importer.hpp"
@@ -10,20 +18,107 @@
 namespace bpo = boost::program_options;
 namespace bfs = boost::filesystem;
 
+namespace
+{
+
+    bool isEssFile(const bfs::path& file)
+    {
+        std::string extension = file.extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+        return extension == ".ess";
+    }
+
+    /// Convert all .ess files in a directory, running the saves through a pool
+    /// of worker threads. Each save is converted independently; errors are
+    /// collected and reported at the end.
+    int runBatch(const bfs::path& inputDir, const bfs::path& outputDir, const std::string& encoding, int threads)
+    {
+        std::vector<bfs::path> saves;
+        for (bfs::directory_iterator it(inputDir); it != bfs::directory_iterator(); ++it)
+        {
+            if (bfs::is_regular_file(it->status()) && isEssFile(it->path()))
+                saves.push_back(it->path());
+        }
+        std::sort(saves.begin(), saves.end());
+
+        if (saves.empty())
+        {
+            std::cout << "No .ess files found in " << inputDir.string() << std::endl;
+            return 0;
+        }
+
+        bfs::create_directories(outputDir);
+
+        // make sure the plugin registry exists before the workers race to create it
+        osgDB::Registry::instance();
+
+        threads = std::min<int>(threads, static_cast<int>(saves.size()));
 
+        std::atomic<size_t> nextSave (0);
+        std::mutex reportMutex;
+        size_t converted = 0;
+        std::vector<std::pair<std::string, std::string>> failures; // file name, error
+
+        std::vector<std::thread> pool;
+        for (int i = 0; i < threads; ++i)
+        {
+            pool.emplace_back([&]
+            {
+                for (;;)
+                {
+                    size_t index = nextSave.fetch_add(1);
+                    if (index >= saves.size())
+                        return;
+
+                    const bfs::path& essFile = saves[index];
+                    bfs::path outputFile = outputDir / (essFile.stem().string() + ".omwsave");
+                    try
+                    {
+                        ESSImport::Importer importer(essFile.string(), outputFile.string(), encoding);
+                        importer.run();
+
+                        std::lock_guard<std::mutex> lock (reportMutex);
+                        ++converted;
+                        std::cout << "Converted " << essFile.filename().string() << std::endl;
+                    }
+                    catch (std::exception& e)
+                    {
+                        std::lock_guard<std::mutex> lock (reportMutex);
+                        failures.emplace_back(essFile.filename().string(), e.what());
+                    }
+                }
+            });
+        }
+        for (std::thread& worker : pool)
+            worker.join();
+
+        for (const auto& failure : failures)
+            std::cerr << "Error converting " << failure.first << ": " << failure.second << std::endl;
+
+        std::cout << "Converted " << converted << " of " << saves.size() << " save(s)." << std::endl;
+
+        return failures.empty() ? 0 : 1;
+    }
+
+}
 
 int main(int argc, char** argv)
 {
     try
     {
-        bpo::options_description desc("Syntax: openmw-essimporter <options> infile.ess outfile.omwsave\nAllowed options");
+        bpo::options_description desc("Syntax: openmw-essimporter <options> infile.ess outfile.omwsave\n"
+            "  or:   openmw-essimporter <options> inputdir outputdir\n"
+            "      Batch mode: convert every .ess save in inputdir to outputdir.\n"
+            "Allowed options");
         bpo::positional_options_description p_desc;
         desc.add_options()
             ("help,h", "produce help message")
-            ("mwsave,m", bpo::value<std::string>(), "morrowind .ess save file")
-            ("output,o", bpo::value<std::string>(), "output file (.omwsave)")
+            ("mwsave,m", bpo::value<std::string>(), "morrowind .ess save file (or a directory of saves)")
+            ("output,o", bpo::value<std::string>(), "output file (.omwsave) (or a directory in batch mode)")
             ("compare,c", "compare two .ess files")
             ("encoding", boost::program_options::value<std::string>()->default_value("win1252"), "encoding of the save file")
+            ("threads,j", bpo::value<int>()->default_value(0),
+                "number of conversion threads in batch mode. 0 (the default) uses all hardware threads.")
         ;
         p_desc.add("mwsave", 1).add("output", 1);
 
@@ -50,6 +145,18 @@ int main(int argc, char** argv)
         std::string outputFile = variables["output"].as<std::string>();
         std::string encoding = variables["encoding"].as<std::string>();
 
+        if (bfs::is_directory(bfs::path(essFile)))
+        {
+            if (variables.count("compare"))
+                throw std::runtime_error("--compare can not be used with a directory of saves");
+
+            int threads = variables["threads"].as<int>();
+            if (threads < 1)
+                threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+            return runBatch(bfs::path(essFile), bfs::path(outputFile), encoding, threads);
+        }
+
         ESSImport::Importer importer(essFile, outputFile, encoding);
 
         if (variables.count("compare"))
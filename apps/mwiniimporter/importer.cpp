@@ -970,9 +970,11 @@ void MwIniImporter::writeToFile(std::ostream &out, const multistrmap &cfg) {
 
     for(multistrmap::const_iterator it=cfg.begin(); it != cfg.end(); ++it) {
         for(auto entry=it->second.begin(); entry != it->second.end(); ++entry) {
-            out << (it->first) << "=" << (*entry) << std::endl;
+            // '\n' instead of std::endl to avoid flushing the stream per line
+            out << (it->first) << "=" << (*entry) << '\n';
         }
     }
+    out.flush();
 }
 
 void MwIniImporter::setInputEncoding(const ToUTF8::FromType &encoding)
@@ -1,7 +1,14 @@
 ///Program to test .nif files both on the FileSystem and in BSA archives.
 
+#include <condition_variable>
+#include <deque>
 #include <iostream>
 #include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 #include <cstdlib>
 
 #include <components/nif/niffile.hpp>
@@ -43,41 +50,163 @@ bool isBSA(const std::string & filename)
     return hasExtension(filename,"bsa");
 }
 
-/// Check all the nif files in a given VFS::Archive
+/// Producer/consumer pipeline: archive enumeration pushes nif files into a
+/// bounded queue and a pool of worker threads parses them, while errors are
+/// collected for a report at the end of the run.
+class ScanPipeline
+{
+    struct FileJob
+    {
+        const VFS::Manager* mVfs; // null for loose files on the file system
+        std::string mName;
+        std::string mDisplayName;
+    };
+
+    // Keeps the managers of all scanned archives alive so the workers can
+    // still pull files out of them after enumeration has moved on.
+    std::vector<std::unique_ptr<VFS::Manager>> mManagers;
+
+    std::deque<FileJob> mQueue;
+    std::mutex mMutex;
+    std::condition_variable mPushed, mPopped;
+    size_t mCapacity;
+    bool mDone;
+
+    size_t mScanned;
+    std::vector<std::pair<std::string, std::string>> mFailures; // file name, error
+
+    std::vector<std::thread> mWorkers;
+
+    void runWorker()
+    {
+        for (;;)
+        {
+            FileJob job;
+            {
+                std::unique_lock<std::mutex> lock (mMutex);
+                mPushed.wait(lock, [this] { return !mQueue.empty() || mDone; });
+                if (mQueue.empty())
+                    return;
+                job = std::move(mQueue.front());
+                mQueue.pop_front();
+            }
+            mPopped.notify_one();
+
+            try
+            {
+                if (job.mVfs)
+                    Nif::NIFFile temp_nif(job.mVfs->get(job.mName), job.mDisplayName);
+                else
+                    Nif::NIFFile temp_nif(Files::openConstrainedFileStream(job.mName.c_str()), job.mDisplayName);
+
+                std::lock_guard<std::mutex> lock (mMutex);
+                ++mScanned;
+            }
+            catch (std::exception& e)
+            {
+                std::lock_guard<std::mutex> lock (mMutex);
+                ++mScanned;
+                mFailures.emplace_back(job.mDisplayName, e.what());
+            }
+        }
+    }
+
+public:
+
+    explicit ScanPipeline(int threads)
+        : mCapacity(threads * 32)
+        , mDone(false)
+        , mScanned(0)
+    {
+        for (int i = 0; i < threads; ++i)
+            mWorkers.emplace_back(&ScanPipeline::runWorker, this);
+    }
+
+    ~ScanPipeline()
+    {
+        finish();
+    }
+
+    /// Index the given archive for scanning.
+    /// \note Takes ownership!
+    const VFS::Manager* addArchive(VFS::Archive* anArchive)
+    {
+        auto manager = std::make_unique<VFS::Manager>(true);
+        manager->addArchive(anArchive);
+        manager->buildIndex();
+        mManagers.push_back(std::move(manager));
+        return mManagers.back().get();
+    }
+
+    /// Queue a nif file for parsing, blocking while the queue is full.
+    void addFile(const VFS::Manager* vfs, const std::string& name, const std::string& displayName)
+    {
+        {
+            std::unique_lock<std::mutex> lock (mMutex);
+            mPopped.wait(lock, [this] { return mQueue.size() < mCapacity; });
+            mQueue.push_back(FileJob { vfs, name, displayName });
+        }
+        mPushed.notify_one();
+    }
+
+    /// Record an error that occurred outside of the parse workers.
+    void addFailure(const std::string& name, const std::string& error)
+    {
+        std::lock_guard<std::mutex> lock (mMutex);
+        mFailures.emplace_back(name, error);
+    }
+
+    /// Wait until all queued files have been parsed.
+    void finish()
+    {
+        {
+            std::lock_guard<std::mutex> lock (mMutex);
+            mDone = true;
+        }
+        mPushed.notify_all();
+        for (std::thread& worker : mWorkers)
+            worker.join();
+        mWorkers.clear();
+    }
+
+    size_t getScannedCount() const { return mScanned; }
+
+    const std::vector<std::pair<std::string, std::string>>& getFailures() const { return mFailures; }
+};
+
+/// Queue all the nif files in a given VFS::Archive for parsing
 /// \note Takes ownership!
 /// \note Can not read a bsa file inside of a bsa file.
-void readVFS(VFS::Archive* anArchive,std::string archivePath = "")
+void readVFS(ScanPipeline& pipeline, VFS::Archive* anArchive, std::string archivePath = "")
 {
-    VFS::Manager myManager(true);
-    myManager.addArchive(anArchive);
-    myManager.buildIndex();
+    const VFS::Manager* vfs = pipeline.addArchive(anArchive);
 
-    for(const auto& name : myManager.getRecursiveDirectoryIterator(""))
+    for(const auto& name : vfs->getRecursiveDirectoryIterator(""))
     {
         try{
             if(isNIF(name))
             {
             //           std::cout << "Decoding: " << name << std::endl;
-                Nif::NIFFile temp_nif(myManager.get(name),archivePath+name);
+                pipeline.addFile(vfs, name, archivePath+name);
             }
             else if(isBSA(name))
             {
                 if(!archivePath.empty() && !isBSA(archivePath))
                 {
 //                     std::cout << "Reading BSA File: " << name << std::endl;
-                    readVFS(new VFS::BsaArchive(archivePath+name),archivePath+name+"/");
+                    readVFS(pipeline, new VFS::BsaArchive(archivePath+name), archivePath+name+"/");
 //                     std::cout << "Done with BSA File: " << name << std::endl;
                 }
             }
         }
         catch (std::exception& e)
         {
-            std::cerr << "ERROR, an exception has occurred:  " << e.what() << std::endl;
+            pipeline.addFailure(archivePath+name, e.what());
         }
     }
 }
 
-bool parseOptions (int argc, char** argv, std::vector<std::string>& files)
+bool parseOptions (int argc, char** argv, std::vector<std::string>& files, int& threads)
 {
     bpo::options_description desc("Ensure that OpenMW can use the provided NIF and BSA files\n\n"
         "Usages:\n"
@@ -86,6 +215,8 @@ bool parseOptions (int argc, char** argv, std::vector<std::string>& files)
         "Allowed options");
     desc.add_options()
         ("help,h", "print help message.")
+        ("threads,j", bpo::value<int>(&threads)->default_value(0),
+            "number of parse worker threads. 0 (the default) uses all hardware threads.")
         ("input-file", bpo::value< std::vector<std::string> >(), "input file")
         ;
 
@@ -108,6 +239,8 @@ bool parseOptions (int argc, char** argv, std::vector<std::string>& files)
         if (variables.count("input-file"))
         {
             files = variables["input-file"].as< std::vector<std::string> >();
+            if (threads < 1)
+                threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
             return true;
         }
     }
@@ -126,11 +259,15 @@ bool parseOptions (int argc, char** argv, std::vector<std::string>& files)
 int main(int argc, char **argv)
 {
     std::vector<std::string> files;
-    if(!parseOptions (argc, argv, files))
+    int threads = 0;
+    if(!parseOptions (argc, argv, files, threads))
         return 1;
 
     Nif::NIFFile::setLoadUnsupportedFiles(true);
 //     std::cout << "Reading Files" << std::endl;
+
+    ScanPipeline pipeline (threads);
+
     for(auto it=files.begin(); it!=files.end(); ++it)
     {
         std::string name = *it;
@@ -140,17 +277,17 @@ int main(int argc, char **argv)
             if(isNIF(name))
             {
                 //std::cout << "Decoding: " << name << std::endl;
-                Nif::NIFFile temp_nif(Files::openConstrainedFileStream(name.c_str()),name);
+                pipeline.addFile(nullptr, name, name);
              }
              else if(isBSA(name))
              {
 //                 std::cout << "Reading BSA File: " << name << std::endl;
-                readVFS(new VFS::BsaArchive(name));
+                readVFS(pipeline, new VFS::BsaArchive(name));
              }
              else if(bfs::is_directory(bfs::path(name)))
              {
 //                 std::cout << "Reading All Files in: " << name << std::endl;
-                readVFS(new VFS::FileSystemArchive(name),name);
+                readVFS(pipeline, new VFS::FileSystemArchive(name), name);
              }
              else
              {
@@ -159,8 +296,17 @@ int main(int argc, char **argv)
         }
         catch (std::exception& e)
         {
-            std::cerr << "ERROR, an exception has occurred:  " << e.what() << std::endl;
+            pipeline.addFailure(name, e.what());
         }
      }
-     return 0;
+
+     pipeline.finish();
+
+     for (const auto& failure : pipeline.getFailures())
+         std::cerr << "ERROR (" << failure.first << "), an exception has occurred:  " << failure.second << std::endl;
+
+     std::cout << "Scanned " << pipeline.getScannedCount() << " nif files, "
+         << pipeline.getFailures().size() << " error(s)." << std::endl;
+
+     return pipeline.getFailures().empty() ? 0 : 1;
 }
@@ -353,8 +353,10 @@ int CSMDoc::Document::getState() const
     if (!mUndoStack.isClean() || mDirty)
         state |= State_Modified;
 
+    // Saving works from a snapshot of the data taken when the save was started, so the
+    // document can remain editable while the file is written out.
     if (mSaving.isRunning())
-        state |= State_Locked | State_Saving | State_Operation;
+        state |= State_Saving | State_Operation;
 
     if (mRunner.isRunning())
         state |= State_Locked | State_Running;
@@ -2,6 +2,8 @@
 
 #include <iostream>
 
+#include <components/files/mappedfilestream.hpp>
+
 #include "../tools/reportmodel.hpp"
 
 #include "document.hpp"
@@ -18,6 +20,37 @@ CSMDoc::Loader::Loader()
     mTimer->start();
 }
 
+CSMDoc::Loader::~Loader()
+{
+    if (mPrefetch.valid())
+        mPrefetch.wait();
+}
+
+void CSMDoc::Loader::prefetch (const boost::filesystem::path& path)
+{
+    // Same one-request-deep read-ahead as the engine-side content loaders:
+    // the next file is pulled into the OS cache while the current one is
+    // merged on this thread. Assigning the future joins a still-running
+    // worker first, which throttles the read-ahead to the merge rate. The
+    // merge itself has to stay ordered, since later files override records
+    // from earlier ones.
+    const std::string file = path.string();
+    mPrefetch = std::async (std::launch::async, [file]
+    {
+        try
+        {
+            Files::IStreamPtr stream = Files::openMappedFileStream (file.c_str());
+            char buffer[4096];
+            while (stream->read (buffer, sizeof (buffer)))
+                ;
+        }
+        catch (const std::exception&)
+        {
+            // load() will report problems with proper context
+        }
+    });
+}
+
 QWaitCondition& CSMDoc::Loader::hasThingsToDo()
 {
     return mThingsToDo;
@@ -93,6 +126,9 @@ void CSMDoc::Loader::load()
             iter->second.mRecordsLeft = true;
             iter->second.mRecordsLoaded = 0;
 
+            if (iter->second.mFile+1 < size)
+                prefetch (document->getContentFiles()[iter->second.mFile+1]);
+
             emit nextStage (document, path.filename().string(), steps);
         }
         else if (iter->second.mFile==size) // start loading the last (project) file
@@ -1,8 +1,11 @@
 #ifndef CSM_DOC_LOADER_H
 #define CSM_DOC_LOADER_H
 
+#include <future>
 #include <vector>
 
+#include <boost/filesystem/path.hpp>
+
 #include <QObject>
 #include <QMutex>
 #include <QTimer>
@@ -31,11 +34,18 @@ namespace CSMDoc
 
             QTimer* mTimer;
             bool mShouldStop;
+            std::future<void> mPrefetch;
+
+            void prefetch (const boost::filesystem::path& path);
+            ///< Start streaming \a path into the OS cache on a worker thread, so
+            /// its pages are warm by the time the merge reaches it.
 
         public:
 
             Loader();
 
+            ~Loader();
+
             QWaitCondition& hasThingsToDo();
 
             void stop();
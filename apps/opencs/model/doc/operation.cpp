@@ -1,6 +1,8 @@
 #include "operation.hpp"
 
+#include <algorithm>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <QTimer>
@@ -64,6 +66,12 @@ void CSMDoc::Operation::setDefaultSeverity (Message::Severity severity)
     mDefaultSeverity = severity;
 }
 
+void CSMDoc::Operation::snapshotStages()
+{
+    for (std::vector<std::pair<Stage *, int> >::iterator iter (mStages.begin()); iter!=mStages.end(); ++iter)
+        iter->first->snapshot();
+}
+
 bool CSMDoc::Operation::hasError() const
 {
     return mError;
@@ -107,17 +115,36 @@ void CSMDoc::Operation::executeStage()
         }
         else
         {
-            try
+            // Leave the last step out of any parallel batch, so stages can use it for
+            // final checks that depend on the results of the earlier steps.
+            int batch = 0;
+
+            if (mCurrentStage->first->isThreadSafe())
             {
-                mCurrentStage->first->perform (mCurrentStep++, messages);
+                unsigned int threads = std::max (std::thread::hardware_concurrency(), 1u);
+
+                // Bound the batch so progress updates and aborts stay responsive.
+                batch = std::min (mCurrentStage->second-mCurrentStep-1,
+                    static_cast<int> (threads)*64);
             }
-            catch (const std::exception& e)
+
+            if (batch>1)
+                executeBatch (batch, messages);
+            else
             {
-                emit reportMessage (Message (CSMWorld::UniversalId(), e.what(), "", Message::Severity_SeriousError), mType);
-                abort();
+                try
+                {
+                    mCurrentStage->first->perform (mCurrentStep++, messages);
+                }
+                catch (const std::exception& e)
+                {
+                    emit reportMessage (Message (CSMWorld::UniversalId(), e.what(), "", Message::Severity_SeriousError), mType);
+                    abort();
+                }
+
+                ++mCurrentStepTotal;
             }
 
-            ++mCurrentStepTotal;
             break;
         }
     }
@@ -131,6 +158,58 @@ void CSMDoc::Operation::executeStage()
         operationDone();
 }
 
+void CSMDoc::Operation::executeBatch (int batch, Messages& messages)
+{
+    Stage *stage = mCurrentStage->first;
+    int begin = mCurrentStep;
+
+    unsigned int threads = std::min (std::max (std::thread::hardware_concurrency(), 1u),
+        static_cast<unsigned int> (batch));
+
+    std::vector<Messages> results (threads, Messages (mDefaultSeverity));
+    std::vector<std::string> errors (threads);
+    std::vector<std::thread> workers;
+
+    for (unsigned int i=0; i<threads; ++i)
+    {
+        // Contiguous ranges, so appending the per-worker messages in worker order
+        // keeps them sorted by step.
+        int first = begin + static_cast<int> ((static_cast<long long> (batch)*i)/threads);
+        int last = begin + static_cast<int> ((static_cast<long long> (batch)*(i+1))/threads);
+
+        workers.emplace_back ([stage, first, last, i, &results, &errors]
+        {
+            try
+            {
+                for (int step=first; step<last; ++step)
+                    stage->perform (step, results[i]);
+            }
+            catch (const std::exception& e)
+            {
+                errors[i] = e.what();
+            }
+        });
+    }
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    mCurrentStep += batch;
+    mCurrentStepTotal += batch;
+
+    for (unsigned int i=0; i<threads; ++i)
+    {
+        for (Messages::Iterator iter (results[i].begin()); iter!=results[i].end(); ++iter)
+            messages.add (iter->mId, iter->mMessage, iter->mHint, iter->mSeverity);
+
+        if (!errors[i].empty())
+        {
+            emit reportMessage (Message (CSMWorld::UniversalId(), errors[i], "", Message::Severity_SeriousError), mType);
+            abort();
+        }
+    }
+}
+
 void CSMDoc::Operation::operationDone()
 {
     mTimer->stop();
@@ -39,6 +39,10 @@ namespace CSMDoc
 
             void prepareStages();
 
+            void executeBatch (int batch, Messages& messages);
+            ///< Perform \a batch steps of the current (thread-safe) stage across a pool of
+            /// worker threads, merging the resulting messages into \a messages in step order.
+
         public:
 
             Operation (int type, bool ordered, bool finalAlways = false);
@@ -55,6 +59,10 @@ namespace CSMDoc
             /// \attention Do no call this function while this Operation is running.
             void setDefaultSeverity (Message::Severity severity);
 
+            void snapshotStages();
+            ///< Calls snapshot() on all stages. Must be called from the main thread before
+            /// the operation is started.
+
             bool hasError() const;
 
         signals:
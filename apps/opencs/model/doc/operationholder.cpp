@@ -39,6 +39,10 @@ bool CSMDoc::OperationHolder::isRunning() const
 
 void CSMDoc::OperationHolder::start()
 {
+    // Still on the main thread here: let stages copy the data they are going to work
+    // on, before the worker thread starts and the user can resume editing.
+    mOperation->snapshotStages();
+
     mRunning = true;
     mThread.start();
 }
@@ -34,9 +34,21 @@ void CSMDoc::OpenSaveStage::perform (int stage, Messages& messages)
 
 
 CSMDoc::WriteHeaderStage::WriteHeaderStage (Document& document, SavingState& state, bool simple)
-: mDocument (document), mState (state), mSimple (simple)
+: mDocument (document), mState (state), mSimple (simple), mRecordCount (0)
 {}
 
+void CSMDoc::WriteHeaderStage::snapshot()
+{
+    if (mSimple)
+        return;
+
+    mMetaData = mDocument.getData().getMetaData();
+    mRecordCount =
+        mDocument.getData().count (CSMWorld::RecordBase::State_Modified) +
+        mDocument.getData().count (CSMWorld::RecordBase::State_ModifiedOnly) +
+        mDocument.getData().count (CSMWorld::RecordBase::State_Deleted);
+}
+
 int CSMDoc::WriteHeaderStage::setup()
 {
     return 1;
@@ -57,11 +69,8 @@ void CSMDoc::WriteHeaderStage::perform (int stage, Messages& messages)
     }
     else
     {
-        mDocument.getData().getMetaData().save (mState.getWriter());
-        mState.getWriter().setRecordCount (
-            mDocument.getData().count (CSMWorld::RecordBase::State_Modified) +
-            mDocument.getData().count (CSMWorld::RecordBase::State_ModifiedOnly) +
-            mDocument.getData().count (CSMWorld::RecordBase::State_Deleted));
+        mMetaData.save (mState.getWriter());
+        mState.getWriter().setRecordCount (mRecordCount);
 
         /// \todo refine dependency list (at least remove redundant dependencies)
         std::vector<boost::filesystem::path> dependencies = mDocument.getContentFiles();
@@ -88,19 +97,59 @@ CSMDoc::WriteDialogueCollectionStage::WriteDialogueCollectionStage (Document& do
   mInfos (journal ? document.getData().getJournalInfos() : document.getData().getTopicInfos())
 {}
 
+void CSMDoc::WriteDialogueCollectionStage::snapshot()
+{
+    mSnapshot.clear();
+
+    for (int i=0; i<mTopics.getSize(); ++i)
+    {
+        const CSMWorld::Record<ESM::Dialogue>& topic = mTopics.getRecord (i);
+
+        if (topic.mState == CSMWorld::RecordBase::State_Deleted)
+        {
+            // if the topic is deleted, we do not need to bother with INFO records.
+            mSnapshot.push_back (TopicSnapshot {topic, {}});
+            continue;
+        }
+
+        // Test, if we need to save anything associated info records.
+        bool infoModified = false;
+        CSMWorld::InfoCollection::Range range = mInfos.getTopicRange (topic.get().mId);
+
+        for (CSMWorld::InfoCollection::RecordConstIterator iter (range.first); iter!=range.second; ++iter)
+        {
+            if ((*iter)->isModified() || (*iter)->mState == CSMWorld::RecordBase::State_Deleted)
+            {
+                infoModified = true;
+                break;
+            }
+        }
+
+        if (!topic.isModified() && !infoModified)
+            continue;
+
+        TopicSnapshot entry {topic, {}};
+
+        for (CSMWorld::InfoCollection::RecordConstIterator iter (range.first); iter!=range.second; ++iter)
+            entry.mInfos.push_back (**iter);
+
+        mSnapshot.push_back (std::move (entry));
+    }
+}
+
 int CSMDoc::WriteDialogueCollectionStage::setup()
 {
-    return mTopics.getSize();
+    return static_cast<int> (mSnapshot.size());
 }
 
 void CSMDoc::WriteDialogueCollectionStage::perform (int stage, Messages& messages)
 {
     ESM::ESMWriter& writer = mState.getWriter();
-    const CSMWorld::Record<ESM::Dialogue>& topic = mTopics.getRecord (stage);
+    const CSMWorld::Record<ESM::Dialogue>& topic = mSnapshot[stage].mTopic;
+    const std::vector<CSMWorld::Record<CSMWorld::Info> >& infos = mSnapshot[stage].mInfos;
 
     if (topic.mState == CSMWorld::RecordBase::State_Deleted)
     {
-        // if the topic is deleted, we do not need to bother with INFO records.
         ESM::Dialogue dialogue = topic.get();
         writer.startRecord(dialogue.sRecordId);
         dialogue.save(writer, true);
@@ -108,65 +157,57 @@ void CSMDoc::WriteDialogueCollectionStage::perform (int stage, Messages& message
         return;
     }
 
-    // Test, if we need to save anything associated info records.
     bool infoModified = false;
-    CSMWorld::InfoCollection::Range range = mInfos.getTopicRange (topic.get().mId);
 
-    for (CSMWorld::InfoCollection::RecordConstIterator iter (range.first); iter!=range.second; ++iter)
+    for (std::vector<CSMWorld::Record<CSMWorld::Info> >::const_iterator iter (infos.begin());
+        iter!=infos.end(); ++iter)
     {
-        if ((*iter)->isModified() || (*iter)->mState == CSMWorld::RecordBase::State_Deleted)
+        if (iter->isModified() || iter->mState == CSMWorld::RecordBase::State_Deleted)
         {
             infoModified = true;
             break;
         }
     }
 
-    if (topic.isModified() || infoModified)
+    if (infoModified && topic.mState != CSMWorld::RecordBase::State_Modified
+                     && topic.mState != CSMWorld::RecordBase::State_ModifiedOnly)
     {
-        if (infoModified && topic.mState != CSMWorld::RecordBase::State_Modified
-                         && topic.mState != CSMWorld::RecordBase::State_ModifiedOnly)
-        {
-            mState.getWriter().startRecord (topic.mBase.sRecordId);
-            topic.mBase.save (mState.getWriter(), topic.mState == CSMWorld::RecordBase::State_Deleted);
-            mState.getWriter().endRecord (topic.mBase.sRecordId);
-        }
-        else
-        {
-            mState.getWriter().startRecord (topic.mModified.sRecordId);
-            topic.mModified.save (mState.getWriter(), topic.mState == CSMWorld::RecordBase::State_Deleted);
-            mState.getWriter().endRecord (topic.mModified.sRecordId);
-        }
+        mState.getWriter().startRecord (topic.mBase.sRecordId);
+        topic.mBase.save (mState.getWriter(), topic.mState == CSMWorld::RecordBase::State_Deleted);
+        mState.getWriter().endRecord (topic.mBase.sRecordId);
+    }
+    else
+    {
+        mState.getWriter().startRecord (topic.mModified.sRecordId);
+        topic.mModified.save (mState.getWriter(), topic.mState == CSMWorld::RecordBase::State_Deleted);
+        mState.getWriter().endRecord (topic.mModified.sRecordId);
+    }
 
-        // write modified selected info records
-        for (CSMWorld::InfoCollection::RecordConstIterator iter (range.first); iter!=range.second; ++iter)
+    // write modified selected info records
+    for (std::size_t i=0; i<infos.size(); ++i)
+    {
+        if (infos[i].isModified() || infos[i].mState == CSMWorld::RecordBase::State_Deleted)
         {
-            if ((*iter)->isModified() || (*iter)->mState == CSMWorld::RecordBase::State_Deleted)
+            ESM::DialInfo info = infos[i].get();
+            info.mId = info.mId.substr (info.mId.find_last_of ('#')+1);
+
+            info.mPrev = "";
+            if (i>0)
+            {
+                const std::string& id = infos[i-1].get().mId;
+                info.mPrev = id.substr (id.find_last_of ('#')+1);
+            }
+
+            info.mNext = "";
+            if (i+1<infos.size())
             {
-                ESM::DialInfo info = (*iter)->get();
-                info.mId = info.mId.substr (info.mId.find_last_of ('#')+1);
-
-                info.mPrev = "";
-                if (iter!=range.first)
-                {
-                    CSMWorld::InfoCollection::RecordConstIterator prev = iter;
-                    --prev;
-
-                    info.mPrev = (*prev)->get().mId.substr ((*prev)->get().mId.find_last_of ('#')+1);
-                }
-
-                CSMWorld::InfoCollection::RecordConstIterator next = iter;
-                ++next;
-
-                info.mNext = "";
-                if (next!=range.second)
-                {
-                    info.mNext = (*next)->get().mId.substr ((*next)->get().mId.find_last_of ('#')+1);
-                }
-
-                writer.startRecord (info.sRecordId);
-                info.save (writer, (*iter)->mState == CSMWorld::RecordBase::State_Deleted);
-                writer.endRecord (info.sRecordId);
+                const std::string& id = infos[i+1].get().mId;
+                info.mNext = id.substr (id.find_last_of ('#')+1);
             }
+
+            writer.startRecord (info.sRecordId);
+            info.save (writer, infos[i].mState == CSMWorld::RecordBase::State_Deleted);
+            writer.endRecord (info.sRecordId);
         }
     }
 }
@@ -176,14 +217,31 @@ CSMDoc::WriteRefIdCollectionStage::WriteRefIdCollectionStage (Document& document
 : mDocument (document), mState (state)
 {}
 
+void CSMDoc::WriteRefIdCollectionStage::snapshot()
+{
+    const CSMWorld::RefIdCollection& collection = mDocument.getData().getReferenceables();
+    const CSMWorld::RefIdData& source = collection.getDataSet();
+
+    mSnapshot = std::make_unique<CSMWorld::RefIdData>();
+
+    for (int i=0; i<source.getSize(); ++i)
+    {
+        CSMWorld::RefIdData::LocalIndex localIndex = source.globalToLocalIndex (i);
+        const CSMWorld::RecordBase& record = source.getRecord (localIndex);
+
+        if (record.isModified() || record.mState==CSMWorld::RecordBase::State_Deleted)
+            mSnapshot->insertRecord (record.clone(), localIndex.second, collection.getId (i));
+    }
+}
+
 int CSMDoc::WriteRefIdCollectionStage::setup()
 {
-    return mDocument.getData().getReferenceables().getSize();
+    return mSnapshot->getSize();
 }
 
 void CSMDoc::WriteRefIdCollectionStage::perform (int stage, Messages& messages)
 {
-    mDocument.getData().getReferenceables().save (stage, mState.getWriter());
+    mSnapshot->save (stage, mState.getWriter());
 }
 
 
@@ -192,11 +250,39 @@ CSMDoc::CollectionReferencesStage::CollectionReferencesStage (Document& document
 : mDocument (document), mState (state)
 {}
 
+void CSMDoc::CollectionReferencesStage::snapshot()
+{
+    std::vector<RefSnapshot>& refs = mState.getRefSnapshots();
+    refs.clear();
+
+    const CSMWorld::RefIdData& refIdData = mDocument.getData().getReferenceables().getDataSet();
+
+    for (int i=0; i<mDocument.getData().getReferences().getSize(); ++i)
+    {
+        const CSMWorld::Record<CSMWorld::CellRef>& record =
+            mDocument.getData().getReferences().getRecord (i);
+
+        if (record.isModified() || record.mState == CSMWorld::RecordBase::State_Deleted)
+        {
+            const CSMWorld::CellRef& refRecord = record.get();
+
+            CSMWorld::RefIdData::LocalIndex localIndex = refIdData.searchId (refRecord.mRefID);
+            unsigned int recordFlags = refIdData.getRecordFlags (refRecord.mRefID);
+            bool isPersistent = ((recordFlags & ESM::FLAG_Persistent) != 0)
+                || refRecord.mTeleport
+                || localIndex.second == CSMWorld::UniversalId::Type_Creature
+                || localIndex.second == CSMWorld::UniversalId::Type_Npc;
+
+            refs.push_back (RefSnapshot {record, isPersistent});
+        }
+    }
+}
+
 int CSMDoc::CollectionReferencesStage::setup()
 {
     mState.getSubRecords().clear();
 
-    int size = mDocument.getData().getReferences().getSize();
+    int size = static_cast<int> (mState.getRefSnapshots().size());
 
     int steps = size/100;
     if (size%100) ++steps;
@@ -206,39 +292,37 @@ int CSMDoc::CollectionReferencesStage::setup()
 
 void CSMDoc::CollectionReferencesStage::perform (int stage, Messages& messages)
 {
-    int size = mDocument.getData().getReferences().getSize();
+    const std::vector<RefSnapshot>& refs = mState.getRefSnapshots();
+    int size = static_cast<int> (refs.size());
 
     for (int i=stage*100; i<stage*100+100 && i<size; ++i)
     {
-        const CSMWorld::Record<CSMWorld::CellRef>& record =
-            mDocument.getData().getReferences().getRecord (i);
-
-        if (record.isModified() || record.mState == CSMWorld::RecordBase::State_Deleted)
-        {
-            std::string cellId = record.get().mOriginalCell.empty() ?
-                record.get().mCell : record.get().mOriginalCell;
+        // only modified and deleted references make it into the snapshot
+        const CSMWorld::Record<CSMWorld::CellRef>& record = refs[i].mRecord;
 
-            std::deque<int>& indices =
-                mState.getSubRecords()[Misc::StringUtils::lowerCase (cellId)];
+        std::string cellId = record.get().mOriginalCell.empty() ?
+            record.get().mCell : record.get().mOriginalCell;
 
-            // collect moved references at the end of the container
-            bool interior = cellId.substr (0, 1)!="#";
-            std::ostringstream stream;
-            if (!interior)
-            {
-                // recalculate the ref's cell location
-                std::pair<int, int> index = record.get().getCellIndex();
-                stream << "#" << index.first << " " << index.second;
-            }
+        std::deque<int>& indices =
+            mState.getSubRecords()[Misc::StringUtils::lowerCase (cellId)];
 
-            // An empty mOriginalCell is meant to indicate that it is the same as
-            // the current cell.  It is possible that a moved ref is moved again.
-            if ((record.get().mOriginalCell.empty() ?
-                    record.get().mCell : record.get().mOriginalCell) != stream.str() && !interior && record.mState!=CSMWorld::RecordBase::State_ModifiedOnly && !record.get().mNew)
-                indices.push_back (i);
-            else
-                indices.push_front (i);
+        // collect moved references at the end of the container
+        bool interior = cellId.substr (0, 1)!="#";
+        std::ostringstream stream;
+        if (!interior)
+        {
+            // recalculate the ref's cell location
+            std::pair<int, int> index = record.get().getCellIndex();
+            stream << "#" << index.first << " " << index.second;
         }
+
+        // An empty mOriginalCell is meant to indicate that it is the same as
+        // the current cell.  It is possible that a moved ref is moved again.
+        if ((record.get().mOriginalCell.empty() ?
+                record.get().mCell : record.get().mOriginalCell) != stream.str() && !interior && record.mState!=CSMWorld::RecordBase::State_ModifiedOnly && !record.get().mNew)
+            indices.push_back (i);
+        else
+            indices.push_front (i);
     }
 }
 
@@ -248,9 +332,17 @@ CSMDoc::WriteCellCollectionStage::WriteCellCollectionStage (Document& document,
 : mDocument (document), mState (state)
 {}
 
+void CSMDoc::WriteCellCollectionStage::snapshot()
+{
+    mCells.clear();
+
+    for (int i=0; i<mDocument.getData().getCells().getSize(); ++i)
+        mCells.push_back (mDocument.getData().getCells().getRecord (i));
+}
+
 int CSMDoc::WriteCellCollectionStage::setup()
 {
-    return mDocument.getData().getCells().getSize();
+    return static_cast<int> (mCells.size());
 }
 
 void CSMDoc::WriteCellCollectionStage::writeReferences (const std::deque<int>& references, bool interior, unsigned int& newRefNum)
@@ -261,7 +353,7 @@ void CSMDoc::WriteCellCollectionStage::writeReferences (const std::deque<int>& r
         iter!=references.end(); ++iter)
     {
         const CSMWorld::Record<CSMWorld::CellRef>& ref =
-            mDocument.getData().getReferences().getRecord (*iter);
+            mState.getRefSnapshots()[*iter].mRecord;
 
         if (ref.isModified() || ref.mState == CSMWorld::RecordBase::State_Deleted)
         {
@@ -313,9 +405,7 @@ void CSMDoc::WriteCellCollectionStage::writeReferences (const std::deque<int>& r
 void CSMDoc::WriteCellCollectionStage::perform (int stage, Messages& messages)
 {
     ESM::ESMWriter& writer = mState.getWriter();
-    const CSMWorld::Record<CSMWorld::Cell>& cell = mDocument.getData().getCells().getRecord (stage);
-    const CSMWorld::RefIdCollection& referenceables = mDocument.getData().getReferenceables();
-    const CSMWorld::RefIdData& refIdData = referenceables.getDataSet();
+    const CSMWorld::Record<CSMWorld::Cell>& cell = mCells[stage];
 
     std::deque<int> tempRefs;
     std::deque<int> persistentRefs;
@@ -339,18 +429,11 @@ void CSMDoc::WriteCellCollectionStage::perform (int stage, Messages& messages)
                 iter!=references->second.end(); ++iter)
             {
                 const CSMWorld::Record<CSMWorld::CellRef>& ref =
-                    mDocument.getData().getReferences().getRecord (*iter);
+                    mState.getRefSnapshots()[*iter].mRecord;
 
                 CSMWorld::CellRef refRecord = ref.get();
 
-                CSMWorld::RefIdData::LocalIndex localIndex = refIdData.searchId(refRecord.mRefID);
-                unsigned int recordFlags = refIdData.getRecordFlags(refRecord.mRefID);
-                bool isPersistent = ((recordFlags & ESM::FLAG_Persistent) != 0)
-                    || refRecord.mTeleport
-                    || localIndex.second == CSMWorld::UniversalId::Type_Creature
-                    || localIndex.second == CSMWorld::UniversalId::Type_Npc;
-
-                if (isPersistent)
+                if (mState.getRefSnapshots()[*iter].mPersistent)
                     persistentRefs.push_back(*iter);
                 else
                     tempRefs.push_back(*iter);
@@ -400,34 +483,44 @@ CSMDoc::WritePathgridCollectionStage::WritePathgridCollectionStage (Document& do
 : mDocument (document), mState (state)
 {}
 
+void CSMDoc::WritePathgridCollectionStage::snapshot()
+{
+    mSnapshot.clear();
+
+    for (int i=0; i<mDocument.getData().getPathgrids().getSize(); ++i)
+    {
+        const CSMWorld::Record<CSMWorld::Pathgrid>& pathgrid =
+            mDocument.getData().getPathgrids().getRecord (i);
+
+        if (pathgrid.isModified() || pathgrid.mState == CSMWorld::RecordBase::State_Deleted)
+            mSnapshot.push_back (pathgrid);
+    }
+}
+
 int CSMDoc::WritePathgridCollectionStage::setup()
 {
-    return mDocument.getData().getPathgrids().getSize();
+    return static_cast<int> (mSnapshot.size());
 }
 
 void CSMDoc::WritePathgridCollectionStage::perform (int stage, Messages& messages)
 {
     ESM::ESMWriter& writer = mState.getWriter();
-    const CSMWorld::Record<CSMWorld::Pathgrid>& pathgrid =
-        mDocument.getData().getPathgrids().getRecord (stage);
-
-    if (pathgrid.isModified() || pathgrid.mState == CSMWorld::RecordBase::State_Deleted)
-    {
-        CSMWorld::Pathgrid record = pathgrid.get();
+    const CSMWorld::Record<CSMWorld::Pathgrid>& pathgrid = mSnapshot[stage];
 
-        if (record.mId.substr (0, 1)=="#")
-        {
-            std::istringstream stream (record.mId.c_str());
-            char ignore;
-            stream >> ignore >> record.mData.mX >> record.mData.mY;
-        }
-        else
-            record.mCell = record.mId;
+    CSMWorld::Pathgrid record = pathgrid.get();
 
-        writer.startRecord (record.sRecordId);
-        record.save (writer, pathgrid.mState == CSMWorld::RecordBase::State_Deleted);
-        writer.endRecord (record.sRecordId);
+    if (record.mId.substr (0, 1)=="#")
+    {
+        std::istringstream stream (record.mId.c_str());
+        char ignore;
+        stream >> ignore >> record.mData.mX >> record.mData.mY;
     }
+    else
+        record.mCell = record.mId;
+
+    writer.startRecord (record.sRecordId);
+    record.save (writer, pathgrid.mState == CSMWorld::RecordBase::State_Deleted);
+    writer.endRecord (record.sRecordId);
 }
 
 
@@ -436,24 +529,34 @@ CSMDoc::WriteLandCollectionStage::WriteLandCollectionStage (Document& document,
 : mDocument (document), mState (state)
 {}
 
+void CSMDoc::WriteLandCollectionStage::snapshot()
+{
+    mSnapshot.clear();
+
+    for (int i=0; i<mDocument.getData().getLand().getSize(); ++i)
+    {
+        const CSMWorld::Record<CSMWorld::Land>& land =
+            mDocument.getData().getLand().getRecord (i);
+
+        if (land.isModified() || land.mState == CSMWorld::RecordBase::State_Deleted)
+            mSnapshot.push_back (land);
+    }
+}
+
 int CSMDoc::WriteLandCollectionStage::setup()
 {
-    return mDocument.getData().getLand().getSize();
+    return static_cast<int> (mSnapshot.size());
 }
 
 void CSMDoc::WriteLandCollectionStage::perform (int stage, Messages& messages)
 {
     ESM::ESMWriter& writer = mState.getWriter();
-    const CSMWorld::Record<CSMWorld::Land>& land =
-        mDocument.getData().getLand().getRecord (stage);
+    const CSMWorld::Record<CSMWorld::Land>& land = mSnapshot[stage];
 
-    if (land.isModified() || land.mState == CSMWorld::RecordBase::State_Deleted)
-    {
-        CSMWorld::Land record = land.get();
-        writer.startRecord (record.sRecordId);
-        record.save (writer, land.mState == CSMWorld::RecordBase::State_Deleted);
-        writer.endRecord (record.sRecordId);
-    }
+    CSMWorld::Land record = land.get();
+    writer.startRecord (record.sRecordId);
+    record.save (writer, land.mState == CSMWorld::RecordBase::State_Deleted);
+    writer.endRecord (record.sRecordId);
 }
 
 
@@ -462,24 +565,34 @@ CSMDoc::WriteLandTextureCollectionStage::WriteLandTextureCollectionStage (Docume
 : mDocument (document), mState (state)
 {}
 
+void CSMDoc::WriteLandTextureCollectionStage::snapshot()
+{
+    mSnapshot.clear();
+
+    for (int i=0; i<mDocument.getData().getLandTextures().getSize(); ++i)
+    {
+        const CSMWorld::Record<CSMWorld::LandTexture>& landTexture =
+            mDocument.getData().getLandTextures().getRecord (i);
+
+        if (landTexture.isModified() || landTexture.mState == CSMWorld::RecordBase::State_Deleted)
+            mSnapshot.push_back (landTexture);
+    }
+}
+
 int CSMDoc::WriteLandTextureCollectionStage::setup()
 {
-    return mDocument.getData().getLandTextures().getSize();
+    return static_cast<int> (mSnapshot.size());
 }
 
 void CSMDoc::WriteLandTextureCollectionStage::perform (int stage, Messages& messages)
 {
     ESM::ESMWriter& writer = mState.getWriter();
-    const CSMWorld::Record<CSMWorld::LandTexture>& landTexture =
-        mDocument.getData().getLandTextures().getRecord (stage);
+    const CSMWorld::Record<CSMWorld::LandTexture>& landTexture = mSnapshot[stage];
 
-    if (landTexture.isModified() || landTexture.mState == CSMWorld::RecordBase::State_Deleted)
-    {
-        CSMWorld::LandTexture record = landTexture.get();
-        writer.startRecord (record.sRecordId);
-        record.save (writer, landTexture.mState == CSMWorld::RecordBase::State_Deleted);
-        writer.endRecord (record.sRecordId);
-    }
+    CSMWorld::LandTexture record = landTexture.get();
+    writer.startRecord (record.sRecordId);
+    record.save (writer, landTexture.mState == CSMWorld::RecordBase::State_Deleted);
+    writer.endRecord (record.sRecordId);
 }
 
 
@@ -502,9 +615,14 @@ void CSMDoc::CloseSaveStage::perform (int stage, Messages& messages)
 
 
 CSMDoc::FinalSavingStage::FinalSavingStage (Document& document, SavingState& state)
-: mDocument (document), mState (state)
+: mDocument (document), mState (state), mUndoStackIndex (0)
 {}
 
+void CSMDoc::FinalSavingStage::snapshot()
+{
+    mUndoStackIndex = mDocument.getUndoStack().index();
+}
+
 int CSMDoc::FinalSavingStage::setup()
 {
     return 1;
@@ -527,6 +645,17 @@ void CSMDoc::FinalSavingStage::perform (int stage, Messages& messages)
 
         boost::filesystem::rename (mState.getTmpPath(), mState.getPath());
 
-        mDocument.getUndoStack().setClean();
+        if (mDocument.getUndoStack().index()==mUndoStackIndex)
+            mDocument.getUndoStack().setClean();
+        else
+        {
+            // The document was edited while the stages were writing out the snapshot taken
+            // at the start of the save. Those edits are not part of the saved file, so the
+            // document has to remain flagged as modified.
+            messages.add (CSMWorld::UniversalId(),
+                "The document was modified while saving. The changes made since the save "
+                "was started are not part of the saved file; save again to write them out.",
+                "", Message::Severity_Info);
+        }
     }
 }
@@ -3,19 +3,24 @@
 
 #include "stage.hpp"
 
+#include <memory>
+
 #include "../world/record.hpp"
 #include "../world/idcollection.hpp"
 #include "../world/scope.hpp"
+#include "../world/metadata.hpp"
+#include "../world/info.hpp"
+#include "../world/cell.hpp"
+#include "../world/pathgrid.hpp"
+#include "../world/land.hpp"
+#include "../world/landtexture.hpp"
+#include "../world/refiddata.hpp"
 
 #include <components/esm/defs.hpp>
+#include <components/esm/loaddial.hpp>
 
 #include "savingstate.hpp"
 
-namespace ESM
-{
-    struct Dialogue;
-}
-
 namespace CSMWorld
 {
     class InfoCollection;
@@ -49,12 +54,16 @@ namespace CSMDoc
             Document& mDocument;
             SavingState& mState;
             bool mSimple;
+            CSMWorld::MetaData mMetaData;
+            int mRecordCount;
 
         public:
 
             WriteHeaderStage (Document& document, SavingState& state, bool simple);
             ///< \param simple Simplified header (used for project files).
 
+            void snapshot() override;
+
             int setup() override;
             ///< \return number of steps
 
@@ -69,12 +78,15 @@ namespace CSMDoc
             const CollectionT& mCollection;
             SavingState& mState;
             CSMWorld::Scope mScope;
+            std::vector<CSMWorld::Record<typename CollectionT::ESXRecord> > mSnapshot;
 
         public:
 
             WriteCollectionStage (const CollectionT& collection, SavingState& state,
                 CSMWorld::Scope scope = CSMWorld::Scope_Content);
 
+            void snapshot() override;
+
             int setup() override;
             ///< \return number of steps
 
@@ -88,43 +100,63 @@ namespace CSMDoc
     : mCollection (collection), mState (state), mScope (scope)
     {}
 
+    template<class CollectionT>
+    void WriteCollectionStage<CollectionT>::snapshot()
+    {
+        mSnapshot.clear();
+
+        for (int i=0; i<mCollection.getSize(); ++i)
+        {
+            const CSMWorld::Record<typename CollectionT::ESXRecord>& record =
+                mCollection.getRecord (i);
+
+            if ((record.isModified() || record.mState==CSMWorld::RecordBase::State_Deleted) &&
+                CSMWorld::getScopeFromId (record.get().mId)==mScope)
+                mSnapshot.push_back (record);
+        }
+    }
+
     template<class CollectionT>
     int WriteCollectionStage<CollectionT>::setup()
     {
-        return mCollection.getSize();
+        return static_cast<int> (mSnapshot.size());
     }
 
     template<class CollectionT>
     void WriteCollectionStage<CollectionT>::perform (int stage, Messages& messages)
     {
-        if (CSMWorld::getScopeFromId (mCollection.getRecord (stage).get().mId)!=mScope)
-            return;
-
         ESM::ESMWriter& writer = mState.getWriter();
-        CSMWorld::RecordBase::State state = mCollection.getRecord (stage).mState;
-        typename CollectionT::ESXRecord record = mCollection.getRecord (stage).get();
+        CSMWorld::RecordBase::State state = mSnapshot[stage].mState;
+        typename CollectionT::ESXRecord record = mSnapshot[stage].get();
 
-        if (state == CSMWorld::RecordBase::State_Modified ||
-            state == CSMWorld::RecordBase::State_ModifiedOnly ||
-            state == CSMWorld::RecordBase::State_Deleted)
-        {
-            writer.startRecord (record.sRecordId);
-            record.save (writer, state == CSMWorld::RecordBase::State_Deleted);
-            writer.endRecord (record.sRecordId);
-        }
+        writer.startRecord (record.sRecordId);
+        record.save (writer, state == CSMWorld::RecordBase::State_Deleted);
+        writer.endRecord (record.sRecordId);
     }
 
 
     class WriteDialogueCollectionStage : public Stage
     {
+            /// Copy of a topic that has to be written out, together with all info records
+            /// of the topic (the unmodified ones are needed to determine the predecessor
+            /// and successor of the modified ones).
+            struct TopicSnapshot
+            {
+                CSMWorld::Record<ESM::Dialogue> mTopic;
+                std::vector<CSMWorld::Record<CSMWorld::Info> > mInfos;
+            };
+
             SavingState& mState;
             const CSMWorld::IdCollection<ESM::Dialogue>& mTopics;
             CSMWorld::InfoCollection& mInfos;
+            std::vector<TopicSnapshot> mSnapshot;
 
         public:
 
             WriteDialogueCollectionStage (Document& document, SavingState& state, bool journal);
 
+            void snapshot() override;
+
             int setup() override;
             ///< \return number of steps
 
@@ -137,11 +169,14 @@ namespace CSMDoc
     {
             Document& mDocument;
             SavingState& mState;
+            std::unique_ptr<CSMWorld::RefIdData> mSnapshot; // modified/deleted records only
 
         public:
 
             WriteRefIdCollectionStage (Document& document, SavingState& state);
 
+            void snapshot() override;
+
             int setup() override;
             ///< \return number of steps
 
@@ -159,6 +194,8 @@ namespace CSMDoc
 
             CollectionReferencesStage (Document& document, SavingState& state);
 
+            void snapshot() override;
+
             int setup() override;
             ///< \return number of steps
 
@@ -170,6 +207,9 @@ namespace CSMDoc
     {
             Document& mDocument;
             SavingState& mState;
+            // All cell records: an unmodified cell still has to be written out if one of
+            // its references was modified.
+            std::vector<CSMWorld::Record<CSMWorld::Cell> > mCells;
 
             void writeReferences (const std::deque<int>& references, bool interior, unsigned int& newRefNum);
 
@@ -177,6 +217,8 @@ namespace CSMDoc
 
             WriteCellCollectionStage (Document& document, SavingState& state);
 
+            void snapshot() override;
+
             int setup() override;
             ///< \return number of steps
 
@@ -189,11 +231,14 @@ namespace CSMDoc
     {
             Document& mDocument;
             SavingState& mState;
+            std::vector<CSMWorld::Record<CSMWorld::Pathgrid> > mSnapshot;
 
         public:
 
             WritePathgridCollectionStage (Document& document, SavingState& state);
 
+            void snapshot() override;
+
             int setup() override;
             ///< \return number of steps
 
@@ -206,11 +251,14 @@ namespace CSMDoc
     {
             Document& mDocument;
             SavingState& mState;
+            std::vector<CSMWorld::Record<CSMWorld::Land> > mSnapshot;
 
         public:
 
             WriteLandCollectionStage (Document& document, SavingState& state);
 
+            void snapshot() override;
+
             int setup() override;
             ///< \return number of steps
 
@@ -223,11 +271,14 @@ namespace CSMDoc
     {
             Document& mDocument;
             SavingState& mState;
+            std::vector<CSMWorld::Record<CSMWorld::LandTexture> > mSnapshot;
 
         public:
 
             WriteLandTextureCollectionStage (Document& document, SavingState& state);
 
+            void snapshot() override;
+
             int setup() override;
             ///< \return number of steps
 
@@ -254,11 +305,14 @@ namespace CSMDoc
     {
             Document& mDocument;
             SavingState& mState;
+            int mUndoStackIndex;
 
         public:
 
             FinalSavingStage (Document& document, SavingState& state);
 
+            void snapshot() override;
+
             int setup() override;
             ///< \return number of steps
 
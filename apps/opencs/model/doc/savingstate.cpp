@@ -69,3 +69,8 @@ std::map<std::string, std::deque<int> >& CSMDoc::SavingState::getSubRecords()
 {
     return mSubRecords;
 }
+
+std::vector<CSMDoc::RefSnapshot>& CSMDoc::SavingState::getRefSnapshots()
+{
+    return mRefSnapshots;
+}
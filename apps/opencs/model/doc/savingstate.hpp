@@ -4,6 +4,7 @@
 #include <fstream>
 #include <map>
 #include <deque>
+#include <vector>
 
 #include <boost/filesystem/path.hpp>
 #include <boost/filesystem/fstream.hpp>
@@ -12,11 +13,21 @@
 
 #include <components/to_utf8/to_utf8.hpp>
 
+#include "../world/record.hpp"
+#include "../world/ref.hpp"
+
 namespace CSMDoc
 {
     class Operation;
     class Document;
 
+    /// Copy of a modified or deleted reference record, taken when the save was started
+    struct RefSnapshot
+    {
+        CSMWorld::Record<CSMWorld::CellRef> mRecord;
+        bool mPersistent; // resolved from the referenceables at snapshot time
+    };
+
     class SavingState
     {
             Operation& mOperation;
@@ -28,6 +39,7 @@ namespace CSMDoc
             boost::filesystem::path mProjectPath;
             bool mProjectFile;
             std::map<std::string, std::deque<int> > mSubRecords; // record ID, list of subrecords
+            std::vector<RefSnapshot> mRefSnapshots; // filled by CollectionReferencesStage::snapshot()
 
         public:
 
@@ -51,6 +63,9 @@ namespace CSMDoc
             ///< Currently saving project file? (instead of content file)
 
             std::map<std::string, std::deque<int> >& getSubRecords();
+
+            std::vector<RefSnapshot>& getRefSnapshots();
+            ///< The indices stored in getSubRecords() refer to this collection.
     };
 
 
@@ -1,3 +1,10 @@
 #include "stage.hpp"
 
 CSMDoc::Stage::~Stage() {}
+
+void CSMDoc::Stage::snapshot() {}
+
+bool CSMDoc::Stage::isThreadSafe() const
+{
+    return false;
+}
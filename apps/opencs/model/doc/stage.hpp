@@ -18,11 +18,22 @@ namespace CSMDoc
 
             virtual ~Stage();
 
+            virtual void snapshot();
+            ///< Called on the main thread before the operation worker starts. Stages that
+            /// read data which may be edited while the operation is running should copy it
+            /// here, so setup() and perform() can work from the copy. Default: do nothing.
+
             virtual int setup() = 0;
             ///< \return number of steps
 
             virtual void perform (int stage, Messages& messages) = 0;
             ///< Messages resulting from this stage will be appended to \a messages.
+
+            virtual bool isThreadSafe() const;
+            ///< Return true if perform() may be called concurrently for different steps
+            /// (i.e. the stage does not modify state shared between steps). The last step
+            /// is still performed only after all other steps have finished, so it can be
+            /// used for final checks. Default: false.
     };
 }
 
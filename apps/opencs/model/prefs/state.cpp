@@ -210,6 +210,10 @@ void CSMPrefs::State::declare()
         setTooltip("Size of the orthographic frustum, greater value will allow the camera to see more of the world.").
         setRange(10, 10000);
     declareDouble ("object-marker-alpha", "Object Marker Transparency", 0.5).setPrecision(2).setRange(0,1);
+    declareBool ("scene-batch-statics", "Batch static instances in exterior scenes", true).
+        setTooltip ("Merge unmodified static instances into shared geometry, the same way the "
+            "game's object paging does. Greatly reduces draw calls in multi-cell exterior views; "
+            "edited or selected instances are always shown individually.");
     declareBool("scene-use-gradient", "Use Gradient Background", true);
     declareColour ("scene-day-background-colour", "Day Background Colour", QColor (110, 120, 128, 255));
     declareColour ("scene-day-gradient-colour", "Day Gradient  Colour", QColor (47, 51, 51, 255)).
@@ -242,6 +242,11 @@ int CSMTools::ReferenceableCheckStage::setup()
     return mReferencables.getSize() + 1;
 }
 
+bool CSMTools::ReferenceableCheckStage::isThreadSafe() const
+{
+    return true;
+}
+
 void CSMTools::ReferenceableCheckStage::bookCheck(
     int stage,
     const CSMWorld::RefIdDataContainer< ESM::Book >& records,
@@ -1,6 +1,8 @@
 #ifndef REFERENCEABLECHECKSTAGE_H
 #define REFERENCEABLECHECKSTAGE_H
 
+#include <atomic>
+
 #include "../world/universalid.hpp"
 #include "../doc/stage.hpp"
 #include "../world/data.hpp"
@@ -25,6 +27,10 @@ namespace CSMTools
             void perform(int stage, CSMDoc::Messages& messages) override;
             int setup() override;
 
+            bool isThreadSafe() const override;
+            ///< The record checks only read from the data set; the player presence flag is
+            /// monotonic and evaluated in the final step.
+
         private:
             //CONCRETE CHECKS
             void bookCheck(int stage, const CSMWorld::RefIdDataContainer< ESM::Book >& records, CSMDoc::Messages& messages);
@@ -88,7 +94,7 @@ namespace CSMTools
             const CSMWorld::Resources& mModels;
             const CSMWorld::Resources& mIcons;
             const CSMWorld::IdCollection<ESM::BodyPart>& mBodyParts;
-            bool mPlayerPresent;
+            std::atomic<bool> mPlayerPresent;
             bool mIgnoreBaseRecords;
     };
 }
@@ -17,6 +17,8 @@ namespace CSMTools
             void perform(int stage, CSMDoc::Messages& messages) override;
             int setup() override;
 
+            bool isThreadSafe() const override;
+
         private:
             const CSMWorld::RefCollection& mReferences;
             const CSMWorld::RefIdCollection& mObjects;
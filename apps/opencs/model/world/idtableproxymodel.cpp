@@ -128,6 +128,43 @@ void CSMWorld::IdTableProxyModel::refreshFilter()
     }
 }
 
+void CSMWorld::IdTableProxyModel::refreshFilterForChange(const QModelIndex &topLeft, const QModelIndex &bottomRight)
+{
+    if (!mFilter)
+        return;
+
+    if (!topLeft.isValid() || !bottomRight.isValid())
+    {
+        refreshFilter();
+        return;
+    }
+
+    // Nothing to do if the filter does not read any of the changed columns
+    bool relevant = false;
+    for (std::map<int, int>::const_iterator iter (mColumnMap.begin()); iter!=mColumnMap.end(); ++iter)
+        if (iter->second >= topLeft.column() && iter->second <= bottomRight.column())
+        {
+            relevant = true;
+            break;
+        }
+    if (!relevant)
+        return;
+
+    // QSortFilterProxyModel already re-filters the changed rows before this slot runs, so
+    // normally every row agrees with its visibility here and nothing more is needed. The
+    // full refresh only remains as a fallback, instead of running unconditionally over
+    // every row of the table as it used to.
+    for (int row = topLeft.row(); row <= bottomRight.row(); ++row)
+    {
+        bool visible = mapFromSource (mSourceModel->index (row, 0)).isValid();
+        if (mFilter->test (*mSourceModel, row, mColumnMap) != visible)
+        {
+            refreshFilter();
+            return;
+        }
+    }
+}
+
 void CSMWorld::IdTableProxyModel::sourceRowsInserted(const QModelIndex &parent, int /*start*/, int end)
 {
     refreshFilter();
@@ -142,7 +179,7 @@ void CSMWorld::IdTableProxyModel::sourceRowsRemoved(const QModelIndex &/*parent*
     refreshFilter();
 }
 
-void CSMWorld::IdTableProxyModel::sourceDataChanged(const QModelIndex &/*topLeft*/, const QModelIndex &/*bottomRight*/)
+void CSMWorld::IdTableProxyModel::sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight)
 {
-    refreshFilter();
+    refreshFilterForChange (topLeft, bottomRight);
 }
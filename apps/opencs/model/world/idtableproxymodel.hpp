@@ -45,6 +45,11 @@ namespace CSMWorld
 
             void refreshFilter();
 
+            /// Refresh the filter after a change to the given source range. Re-tests only the
+            /// changed rows and falls back to refreshFilter() only if one of them disagrees
+            /// with its current visibility, instead of re-running the filter over every row.
+            void refreshFilterForChange (const QModelIndex& topLeft, const QModelIndex& bottomRight);
+
         protected:
 
             bool lessThan(const QModelIndex &left, const QModelIndex &right) const override;
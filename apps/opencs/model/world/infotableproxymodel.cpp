@@ -92,7 +92,7 @@ void CSMWorld::InfoTableProxyModel::sourceRowsInserted(const QModelIndex &parent
 
 void CSMWorld::InfoTableProxyModel::sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight)
 {
-    refreshFilter();
+    refreshFilterForChange(topLeft, bottomRight);
 
     if (mLastAddedSourceRow != -1 && 
         topLeft.row() <= mLastAddedSourceRow && bottomRight.row() >= mLastAddedSourceRow)
@@ -36,6 +36,11 @@ char CSMWorld::ScriptContext::getGlobalType (const std::string& name) const
     return ' ';
 }
 
+int CSMWorld::ScriptContext::getGlobalIndex (const std::string& name) const
+{
+    return mData.getGlobals().searchId (name);
+}
+
 std::pair<char, bool> CSMWorld::ScriptContext::getMemberType (const std::string& name,
     const std::string& id) const
 {
@@ -29,6 +29,10 @@ namespace CSMWorld
             char getGlobalType (const std::string& name) const override;
             ///< 'l: long, 's': short, 'f': float, ' ': does not exist.
 
+            int getGlobalIndex (const std::string& name) const override;
+            ///< Return the index of the global variable \a name or -1, if there is no such
+            /// variable. The editor only verifies scripts, so the index is never dereferenced.
+
             std::pair<char, bool> getMemberType (const std::string& name,
                 const std::string& id) const override;
             ///< Return type of member variable \a name in script \a id or in script of reference of
@@ -2,17 +2,24 @@
 
 #include <math.h>
 
+#include <functional>
+
 #include <osg/PositionAttitudeTransform>
 #include <osg/Geode>
 #include <osg/Geometry>
 #include <osg/Group>
+#include <osg/MatrixTransform>
 
 #include <components/misc/stringops.hpp>
 #include <components/esm/loadcell.hpp>
 #include <components/esm/loadland.hpp>
+#include <components/resource/scenemanager.hpp>
+#include <components/sceneutil/optimizer.hpp>
 #include <components/sceneutil/pathgridutil.hpp>
 #include <components/terrain/terraingrid.hpp>
 
+#include "../../model/prefs/state.hpp"
+
 #include "../../model/world/idtable.hpp"
 #include "../../model/world/columns.hpp"
 #include "../../model/world/data.hpp"
@@ -53,6 +60,24 @@ namespace CSVRender
                 traverse(node, nv);
                 CellNodeContainer* container = static_cast<CellNodeContainer*>(node->getUserData());
                 container->getCell()->updateLand();
+                container->getCell()->updateObjectBatches();
+            }
+    };
+
+    // \note Identical to the callback the engine's object paging uses
+    // (MWRender::ObjectPaging).
+    class CanBatchCallback : public SceneUtil::Optimizer::IsOperationPermissibleForObjectCallback
+    {
+        public:
+
+            bool isOperationPermissibleForObjectImplementation(const SceneUtil::Optimizer* optimizer, const osg::Drawable* node, unsigned int option) const override
+            {
+                return true;
+            }
+
+            bool isOperationPermissibleForObjectImplementation(const SceneUtil::Optimizer* optimizer, const osg::Node* node, unsigned int option) const override
+            {
+                return (node->getDataVariance() != osg::Object::DYNAMIC);
             }
     };
 }
@@ -72,6 +97,8 @@ bool CSVRender::Cell::removeObject (const std::string& id)
 std::map<std::string, CSVRender::Object *>::iterator CSVRender::Cell::removeObject (
     std::map<std::string, Object *>::iterator iter)
 {
+    invalidateBatchGroup (iter->first);
+
     delete iter->second;
     mObjects.erase (iter++);
     return iter;
@@ -108,10 +135,29 @@ bool CSVRender::Cell::addObjects (int start, int end)
 
 void CSVRender::Cell::updateLand()
 {
-    if (!mUpdateLand || mLandDeleted)
+    if (mLandDeleted)
+        return;
+
+    if (mUpdateLandPreview && !mUpdateLand)
+    {
+        // Only the altered height preview changed; patch the vertex data of the existing
+        // chunks in place instead of rebuilding the cell's terrain.
+        mUpdateLandPreview = false;
+
+        if (mTerrain)
+        {
+            mTerrain->updateCell(mCoordinates.getX(), mCoordinates.getY());
+            return;
+        }
+
+        mUpdateLand = true; // terrain has not been built yet, fall back to a full build
+    }
+
+    if (!mUpdateLand)
         return;
 
     mUpdateLand = false;
+    mUpdateLandPreview = false;
 
     // Cell is deleted
     if (mDeleted)
@@ -164,10 +210,127 @@ void  CSVRender::Cell::unloadLand()
         mCellBorder.reset();
 }
 
+int CSVRender::Cell::getBatchGroup (const std::string& id)
+{
+    return static_cast<int> (std::hash<std::string>() (id) % sNumBatchGroups);
+}
+
+bool CSVRender::Cell::isBatchable (const Object* object) const
+{
+    return object->getRecordType()==CSMWorld::UniversalId::Type_Static &&
+        !object->getSelected() && !object->isEdited();
+}
+
+void CSVRender::Cell::updateObjectBatches()
+{
+    if (!mBatchable)
+        return;
+
+    bool enabled = CSMPrefs::get()["Rendering"]["scene-batch-statics"].isTrue();
+
+    // catch eligibility changes (selection, start/end of editing, record type changes)
+    for (std::map<std::string, Object *>::const_iterator iter (mObjects.begin());
+        iter!=mObjects.end(); ++iter)
+        if (iter->second->isBatched()!=(enabled && isBatchable (iter->second)))
+            mBatchGroupsDirty[getBatchGroup (iter->first)] = true;
+
+    // Rebuild at most one group per frame, so the UI stays responsive while the
+    // batches ramp in after a cell load or a large selection change.
+    for (int i=0; i<sNumBatchGroups; ++i)
+        if (mBatchGroupsDirty[i])
+        {
+            rebuildBatchGroup (i, enabled);
+            mBatchGroupsDirty[i] = false;
+            break;
+        }
+}
+
+void CSVRender::Cell::rebuildBatchGroup (int group, bool enabled)
+{
+    if (!mBatchNode)
+    {
+        mBatchNode = new osg::Group;
+        mBatchNode->setNodeMask (Mask_ReferenceBatch);
+        mCellNode->addChild (mBatchNode);
+    }
+
+    if (mBatchGroups[group])
+    {
+        mBatchNode->removeChild (mBatchGroups[group]);
+        mBatchGroups[group] = nullptr;
+    }
+
+    osg::ref_ptr<osg::Group> batch (new osg::Group);
+
+    osg::CopyOp copyOp (osg::CopyOp::DEEP_COPY_NODES | osg::CopyOp::DEEP_COPY_DRAWABLES);
+
+    for (std::map<std::string, Object *>::const_iterator iter (mObjects.begin());
+        iter!=mObjects.end(); ++iter)
+    {
+        if (getBatchGroup (iter->first)!=group)
+            continue;
+
+        Object* object = iter->second;
+
+        if (!enabled || !isBatchable (object))
+        {
+            object->setBatched (false);
+            continue;
+        }
+
+        // the same transform the object's PositionAttitudeTransforms apply
+        ESM::Position position = object->getPosition();
+        float scale = object->getScale();
+
+        osg::Quat xr (-position.rot[0], osg::Vec3f(1,0,0));
+        osg::Quat yr (-position.rot[1], osg::Vec3f(0,1,0));
+        osg::Quat zr (-position.rot[2], osg::Vec3f(0,0,1));
+
+        osg::Matrixf matrix = osg::Matrixf::scale (scale, scale, scale) *
+            osg::Matrixf::rotate (zr*yr*xr) *
+            osg::Matrixf::translate (position.pos[0], position.pos[1], position.pos[2]);
+
+        osg::ref_ptr<osg::MatrixTransform> trans (new osg::MatrixTransform (matrix));
+        trans->setDataVariance (osg::Object::STATIC);
+
+        osg::Group* base = object->getBaseNode();
+        for (unsigned int i=0; i<base->getNumChildren(); ++i)
+            trans->addChild (static_cast<osg::Node*> (base->getChild (i)->clone (copyOp)));
+
+        batch->addChild (trans);
+        object->setBatched (true);
+    }
+
+    if (!batch->getNumChildren())
+        return;
+
+    // the same merge pipeline the engine's object paging applies to chunks
+    // (see MWRender::ObjectPaging::createChunk)
+    SceneUtil::Optimizer optimizer;
+    optimizer.setIsOperationPermissibleForObjectCallback (new CanBatchCallback);
+
+    unsigned int options = SceneUtil::Optimizer::FLATTEN_STATIC_TRANSFORMS |
+        SceneUtil::Optimizer::REMOVE_REDUNDANT_NODES | SceneUtil::Optimizer::MERGE_GEOMETRY;
+
+    mData.getResourceSystem()->getSceneManager()->shareState (batch);
+    optimizer.optimize (batch, options);
+
+    batch->setNodeMask (Mask_ReferenceBatch);
+    mBatchNode->addChild (batch);
+    mBatchGroups[group] = batch;
+}
+
+void CSVRender::Cell::invalidateBatchGroup (const std::string& id)
+{
+    if (mBatchable)
+        mBatchGroupsDirty[getBatchGroup (id)] = true;
+}
+
 CSVRender::Cell::Cell (CSMWorld::Data& data, osg::Group* rootNode, const std::string& id,
     bool deleted)
 : mData (data), mId (Misc::StringUtils::lowerCase (id)), mDeleted (deleted), mSubMode (0),
-  mSubModeElementMask (0), mUpdateLand(true), mLandDeleted(false)
+  mSubModeElementMask (0), mUpdateLand(true), mUpdateLandPreview(false), mLandDeleted(false),
+  mBatchable(false)
 {
     std::pair<CSMWorld::CellCoordinates, bool> result = CSMWorld::CellCoordinates::fromId (id);
 
@@ -176,6 +339,13 @@ CSVRender::Cell::Cell (CSMWorld::Data& data, osg::Group* rootNode, const std::st
     if (result.second)
         mCoordinates = result.first;
 
+    // only exterior cells are batched; interiors are small enough to render
+    // object by object
+    mBatchable = result.second && !mDeleted;
+
+    for (int i=0; i<sNumBatchGroups; ++i)
+        mBatchGroupsDirty[i] = true;
+
     mCellNode = new osg::Group;
     mCellNode->setUserData(new CellNodeContainer(this));
     mCellNode->setUpdateCallback(new CellNodeCallback);
@@ -221,7 +391,10 @@ bool CSVRender::Cell::referenceableDataChanged (const QModelIndex& topLeft,
     for (std::map<std::string, Object *>::iterator iter (mObjects.begin());
         iter!=mObjects.end(); ++iter)
         if (iter->second->referenceableDataChanged (topLeft, bottomRight))
+        {
+            invalidateBatchGroup (iter->first);
             modified = true;
+        }
 
     return modified;
 }
@@ -237,7 +410,10 @@ bool CSVRender::Cell::referenceableAboutToBeRemoved (const QModelIndex& parent,
     for (std::map<std::string, Object *>::iterator iter (mObjects.begin());
         iter!=mObjects.end(); ++iter)
         if (iter->second->referenceableAboutToBeRemoved (parent, start, end))
+        {
+            invalidateBatchGroup (iter->first);
             modified = true;
+        }
 
     return modified;
 }
@@ -281,7 +457,10 @@ bool CSVRender::Cell::referenceDataChanged (const QModelIndex& topLeft,
     while (iter!=mObjects.end())
     {
         if (iter->second->referenceDataChanged (topLeft, bottomRight))
+        {
+            invalidateBatchGroup (iter->first);
             modified = true;
+        }
 
         std::map<std::string, bool>::iterator iter2 = ids.find (iter->first);
 
@@ -354,7 +533,7 @@ bool CSVRender::Cell::referenceAdded (const QModelIndex& parent, int start, int
 void CSVRender::Cell::setAlteredHeight(int inCellX, int inCellY, float height)
 {
     mTerrainStorage->setAlteredHeight(inCellX, inCellY, height);
-    mUpdateLand = true;
+    mUpdateLandPreview = true;
 }
 
 float CSVRender::Cell::getSumOfAlteredAndTrueHeight(int cellX, int cellY, int inCellX, int inCellY)
@@ -370,7 +549,7 @@ float* CSVRender::Cell::getAlteredHeight(int inCellX, int inCellY)
 void CSVRender::Cell::resetAlteredHeights()
 {
     mTerrainStorage->resetHeights();
-    mUpdateLand = true;
+    mUpdateLandPreview = true;
 }
 
 void CSVRender::Cell::pathgridModified()
@@ -425,6 +604,9 @@ void CSVRender::Cell::reloadAssets()
         iter->second->reloadAssets();
     }
 
+    for (int i=0; i<sNumBatchGroups; ++i)
+        mBatchGroupsDirty[i] = true;
+
     if (mTerrain)
     {
         mTerrain->unloadCell(mCoordinates.getX(), mCoordinates.getY());
@@ -45,6 +45,8 @@ namespace CSVRender
 
     class Cell
     {
+            static const int sNumBatchGroups = 8;
+
             CSMWorld::Data& mData;
             std::string mId;
             osg::ref_ptr<osg::Group> mCellNode;
@@ -59,8 +61,12 @@ namespace CSVRender
             bool mDeleted;
             int mSubMode;
             unsigned int mSubModeElementMask;
-            bool mUpdateLand, mLandDeleted;
+            bool mUpdateLand, mUpdateLandPreview, mLandDeleted;
             TerrainStorage *mTerrainStorage;
+            bool mBatchable;
+            osg::ref_ptr<osg::Group> mBatchNode;
+            osg::ref_ptr<osg::Group> mBatchGroups[sNumBatchGroups];
+            bool mBatchGroupsDirty[sNumBatchGroups];
 
             /// Ignored if cell does not have an object with the given ID.
             ///
@@ -79,6 +85,22 @@ namespace CSVRender
             void updateLand();
             void unloadLand();
 
+            /// Bucket an object ID into one of the batch groups.
+            static int getBatchGroup (const std::string& id);
+
+            /// Can the object currently be represented by the cell batch?
+            bool isBatchable (const Object* object) const;
+
+            /// Hide batchable statics behind merged per-group geometry and restore
+            /// objects that are being edited. Called once per frame from the cell
+            /// node's update callback; rebuilds at most one batch group per call.
+            void updateObjectBatches();
+
+            void rebuildBatchGroup (int group, bool enabled);
+
+            /// Schedule a rebuild of the batch group containing \a id.
+            void invalidateBatchGroup (const std::string& id);
+
         public:
 
             enum Selection
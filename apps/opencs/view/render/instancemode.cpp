@@ -834,7 +834,7 @@ float CSVRender::InstanceMode::calculateDropHeight(DropMode dropMode, CSVRender:
     if (dropMode & Terrain)
         visitor.setTraversalMask(Mask_Terrain);
     if (dropMode & Collision)
-        visitor.setTraversalMask(Mask_Terrain | Mask_Reference);
+        visitor.setTraversalMask(Mask_Terrain | Mask_Reference | Mask_ReferenceHidden);
 
     mParentNode->accept(visitor);
 
@@ -17,6 +17,12 @@ namespace CSVRender
         Mask_Fog = 0x10,
         Mask_Terrain = 0x20,
 
+        // merged display geometry for batched static references; rendered whenever
+        // references are visible, but never picked (it carries no tags)
+        Mask_ReferenceBatch = 0x40,
+        // originals represented by a batch; never rendered, but still pickable
+        Mask_ReferenceHidden = 0x80,
+
         // used within models
         Mask_ParticleSystem = 0x100,
 
@@ -89,6 +89,8 @@ void CSVRender::Object::update()
 
     mBaseNode->removeChildren(0, mBaseNode->getNumChildren());
 
+    mRecordType = CSMWorld::UniversalId::Type_None;
+
     if (index == -1)
     {
         mBaseNode->addChild(createErrorCube());
@@ -98,6 +100,7 @@ void CSVRender::Object::update()
     /// \todo check for Deleted state (error 1)
 
     int recordType = referenceables.getData(index, TypeIndex).toInt();
+    mRecordType = recordType;
     std::string model = referenceables.getData(index, ModelIndex).toString().toUtf8().constData();
 
     if (recordType == CSMWorld::UniversalId::Type_Light)
@@ -414,7 +417,8 @@ osg::Vec3f CSVRender::Object::getMarkerPosition (float x, float y, float z, int
 CSVRender::Object::Object (CSMWorld::Data& data, osg::Group* parentNode,
     const std::string& id, bool referenceable, bool forceBaseToZero)
 : mData (data), mBaseNode(nullptr), mSelected(false), mParentNode(parentNode), mResourceSystem(data.getResourceSystem().get()), mForceBaseToZero (forceBaseToZero),
-  mScaleOverride (1), mOverrideFlags (0), mSubMode (-1), mMarkerTransparency(0.5f)
+  mScaleOverride (1), mOverrideFlags (0), mSubMode (-1), mMarkerTransparency(0.5f),
+  mRecordType (CSMWorld::UniversalId::Type_None), mBatched (false)
 {
     mRootNode = new osg::PositionAttitudeTransform;
 
@@ -574,6 +578,25 @@ std::string CSVRender::Object::getReferenceableId() const
     return mReferenceableId;
 }
 
+int CSVRender::Object::getRecordType() const
+{
+    return mRecordType;
+}
+
+void CSVRender::Object::setBatched (bool batched)
+{
+    if (batched==mBatched)
+        return;
+
+    mBatched = batched;
+    mRootNode->setNodeMask (batched ? Mask_ReferenceHidden : Mask_Reference);
+}
+
+bool CSVRender::Object::isBatched() const
+{
+    return mBatched;
+}
+
 osg::ref_ptr<CSVRender::TagBase> CSVRender::Object::getTag() const
 {
     return static_cast<CSVRender::TagBase *> (mBaseNode->getUserData());
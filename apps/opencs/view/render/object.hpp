@@ -101,6 +101,8 @@ namespace CSVRender
             int mSubMode;
             float mMarkerTransparency;
             std::unique_ptr<Actor> mActor;
+            int mRecordType;
+            bool mBatched;
 
             /// Not implemented
             Object (const Object&);
@@ -175,6 +177,16 @@ namespace CSVRender
 
             osg::ref_ptr<TagBase> getTag() const;
 
+            /// Type of the referenceable record (UniversalId::Type), as determined by the
+            /// last model update.
+            int getRecordType() const;
+
+            /// Hide the object's subtree while its geometry is represented by a cell-level
+            /// batch. The node stays pickable via Mask_ReferenceHidden.
+            void setBatched (bool batched);
+
+            bool isBatched() const;
+
             /// Is there currently an editing operation running on this object?
             bool isEdited() const;
 
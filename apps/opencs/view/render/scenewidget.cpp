@@ -121,6 +121,10 @@ void RenderWidget::flagAsModified()
 
 void RenderWidget::setVisibilityMask(unsigned int mask)
 {
+    // batched static references stand in for the hidden originals
+    if (mask & Mask_Reference)
+        mask |= Mask_ReferenceBatch;
+
     mView->getCamera()->setCullMask(mask | Mask_ParticleSystem | Mask_Lighting);
 }
 
@@ -206,7 +210,7 @@ SceneWidget::SceneWidget(std::shared_ptr<Resource::ResourceSystem> resourceSyste
     mOrbitCamControl = new OrbitCameraController(this);
     mCurrentCamControl = mFreeCamControl;
 
-    mOrbitCamControl->setPickingMask(Mask_Reference | Mask_Terrain);
+    mOrbitCamControl->setPickingMask(Mask_Reference | Mask_ReferenceHidden | Mask_Terrain);
 
     mOrbitCamControl->setConstRoll( CSMPrefs::get()["3D Scene Input"]["navi-orbit-const-roll"].isTrue() );
 
@@ -483,7 +487,7 @@ void SceneWidget::update(double dt)
     }
     else
     {
-        mCurrentCamControl->setup(mRootNode, Mask_Reference | Mask_Terrain, CameraController::WorldUp);
+        mCurrentCamControl->setup(mRootNode, Mask_Reference | Mask_ReferenceHidden | Mask_Terrain, CameraController::WorldUp);
         mCamPositionSet = true;
     }
 }
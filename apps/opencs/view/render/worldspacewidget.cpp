@@ -348,7 +348,14 @@ void CSVRender::WorldspaceWidget::setInteractionMask (unsigned int mask)
 
 unsigned int CSVRender::WorldspaceWidget::getInteractionMask() const
 {
-    return mInteractionMask & getVisibilityMask();
+    unsigned int mask = mInteractionMask & getVisibilityMask();
+
+    // references represented by a cell batch are hidden from rendering, but must
+    // stay pickable
+    if (mask & Mask_Reference)
+        mask |= Mask_ReferenceHidden;
+
+    return mask;
 }
 
 void CSVRender::WorldspaceWidget::setEditLock (bool locked)
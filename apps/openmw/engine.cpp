@@ -4,10 +4,15 @@
 #include <iomanip>
 #include <fstream>
 #include <chrono>
+#include <exception>
+#include <functional>
+#include <memory>
 #include <thread>
 
 #include <boost/filesystem/fstream.hpp>
 
+#include <osg/DisplaySettings>
+#include <osg/Timer>
 #include <osgViewer/ViewerEventHandlers>
 #include <osgDB/ReadFile>
 #include <osgDB/WriteFile>
@@ -16,8 +21,13 @@
 
 #include <components/debug/debuglog.hpp>
 #include <components/debug/gldebug.hpp>
+#include <components/debug/memorytracking.hpp>
 
+#include <components/misc/framearena.hpp>
 #include <components/misc/rng.hpp>
+#include <components/misc/constants.hpp>
+
+#include <components/loadinglistener/loadinglistener.hpp>
 
 #include <components/vfs/manager.hpp>
 #include <components/vfs/registerarchives.hpp>
@@ -25,6 +35,7 @@
 #include <components/sdlutil/sdlgraphicswindow.hpp>
 #include <components/sdlutil/imagetosurface.hpp>
 
+#include <components/resource/imagemanager.hpp>
 #include <components/resource/resourcesystem.hpp>
 #include <components/resource/scenemanager.hpp>
 #include <components/resource/stats.hpp>
@@ -43,6 +54,8 @@
 
 #include <components/sceneutil/screencapture.hpp>
 
+#include <components/shader/shadermanager.hpp>
+
 #include "mwinput/inputmanagerimp.hpp"
 
 #include "mwgui/windowmanagerimp.hpp"
@@ -55,6 +68,7 @@
 #include "mwsound/soundmanagerimp.hpp"
 
 #include "mwworld/class.hpp"
+#include "mwworld/esmstore.hpp"
 #include "mwworld/player.hpp"
 #include "mwworld/worldimp.hpp"
 
@@ -238,6 +252,88 @@ namespace
     {
         void operator()(std::string) const {}
     };
+
+    // Runs on the draw thread every frame to persist newly linked shader programs.
+    class UpdateProgramBinaryCacheOperation : public osg::GraphicsOperation
+    {
+    public:
+        explicit UpdateProgramBinaryCacheOperation(Shader::ShaderManager& shaderManager)
+            : osg::GraphicsOperation("UpdateProgramBinaryCacheOperation", /*keep*/ true)
+            , mShaderManager(shaderManager)
+        {
+        }
+
+        void operator()(osg::GraphicsContext* graphicsContext) override
+        {
+            mShaderManager.updateProgramBinaryCache(*graphicsContext->getState());
+        }
+
+    private:
+        Shader::ShaderManager& mShaderManager;
+    };
+
+    // Runs on the draw thread every frame to swap streamed-in image data into the
+    // images the scene references (see ImageManager::applyStreamedImages).
+    class ApplyStreamedImagesOperation : public osg::GraphicsOperation
+    {
+    public:
+        explicit ApplyStreamedImagesOperation(Resource::ImageManager& imageManager)
+            : osg::GraphicsOperation("ApplyStreamedImagesOperation", /*keep*/ true)
+            , mImageManager(imageManager)
+        {
+        }
+
+        void operator()(osg::GraphicsContext*) override
+        {
+            mImageManager.applyStreamedImages();
+        }
+
+    private:
+        Resource::ImageManager& mImageManager;
+    };
+
+    // One engine start-up stage, run on the work queue so that stages with no
+    // ordering constraints between them can overlap; constraints are expressed
+    // as work item dependencies. The work queue does not propagate exceptions
+    // out of doWork, so the stage stores its error and join() rethrows it once
+    // the main thread needs the result.
+    class InitStageWorkItem : public SceneUtil::WorkItem
+    {
+    public:
+        InitStageWorkItem(std::string name, std::function<void()> stage)
+            : mName(std::move(name))
+            , mStage(std::move(stage))
+        {
+        }
+
+        void doWork() override
+        {
+            osg::ElapsedTime timer;
+            try
+            {
+                mStage();
+            }
+            catch (...)
+            {
+                mError = std::current_exception();
+            }
+            Log(Debug::Info) << "Init stage '" << mName << "' took "
+                             << static_cast<int>(timer.elapsedTime_m()) << " ms";
+        }
+
+        /// Wait for the stage to complete, rethrowing any error it raised.
+        void join()
+        {
+            waitTillDone();
+            if (mError)
+                std::rethrow_exception(mError);
+        }
+
+    private:
+        std::string mName;
+        std::function<void()> mStage;
+        std::exception_ptr mError;
+    };
 }
 
 void OMW::Engine::executeLocalScripts()
@@ -277,7 +373,8 @@ bool OMW::Engine::frame(float frametime)
         {
             ScopedProfile<UserStatsType::Sound> profile(frameStart, frameNumber, *timer, *stats);
 
-            if (!mEnvironment.getWindowManager()->isWindowVisible())
+            // The headless window is hidden by design and must not pause the simulation.
+            if (!mHeadless && !mEnvironment.getWindowManager()->isWindowVisible())
             {
                 mEnvironment.getSoundManager()->pausePlayback();
                 return false;
@@ -285,9 +382,8 @@ bool OMW::Engine::frame(float frametime)
             else
                 mEnvironment.getSoundManager()->resumePlayback();
 
-            // sound
-            if (mUseSound)
-                mEnvironment.getSoundManager()->update(frametime);
+            // The sound update itself is dispatched to a worker in the main loop, in
+            // parallel with rendering (see Engine::go).
         }
 
         // Main menu opened? Then scripts are also paused.
@@ -381,6 +477,9 @@ bool OMW::Engine::frame(float frametime)
             stats->setAttribute(frameNumber, "WorkQueue", mWorkQueue->getNumItems());
             stats->setAttribute(frameNumber, "WorkThread", mWorkQueue->getNumActiveThreads());
 
+            if (Debug::isMemoryTrackingEnabled())
+                Debug::reportMemoryStats(frameNumber, *stats);
+
             mEnvironment.reportStats(frameNumber, *stats);
         }
     }
@@ -405,6 +504,8 @@ OMW::Engine::Engine(Files::ConfigurationManager& configurationManager)
   , mActivationDistanceOverride(-1)
   , mGrab(true)
   , mExportFonts(false)
+  , mPrecomputeNavMesh(false)
+  , mHeadless(false)
   , mRandomSeed(0)
   , mScriptContext (nullptr)
   , mLuaManager (nullptr)
@@ -538,6 +639,16 @@ void OMW::Engine::createWindow(Settings::Manager& settings)
     bool vsync = settings.getBool("vsync", "Video");
     unsigned int antialiasing = std::max(0, settings.getInt("antialiasing", "Video"));
 
+    if (mHeadless)
+    {
+        // A GL context is still needed to load the scene, but nothing is ever presented
+        // on it, so keep the window hidden and don't pay for antialiasing or vsync.
+        fullscreen = false;
+        vsync = false;
+        antialiasing = 0;
+        Settings::Manager::setInt("antialiasing", "Video", 0);
+    }
+
     int pos_x = SDL_WINDOWPOS_CENTERED_DISPLAY(screen),
         pos_y = SDL_WINDOWPOS_CENTERED_DISPLAY(screen);
 
@@ -547,7 +658,8 @@ void OMW::Engine::createWindow(Settings::Manager& settings)
         pos_y = SDL_WINDOWPOS_UNDEFINED_DISPLAY(screen);
     }
 
-    Uint32 flags = SDL_WINDOW_OPENGL|SDL_WINDOW_SHOWN|SDL_WINDOW_RESIZABLE;
+    Uint32 flags = SDL_WINDOW_OPENGL|SDL_WINDOW_RESIZABLE;
+    flags |= mHeadless ? SDL_WINDOW_HIDDEN : SDL_WINDOW_SHOWN;
     if(fullscreen)
         flags |= SDL_WINDOW_FULLSCREEN;
 
@@ -557,6 +669,15 @@ void OMW::Engine::createWindow(Settings::Manager& settings)
     SDL_SetHint(SDL_HINT_VIDEO_MINIMIZE_ON_FOCUS_LOSS,
                 settings.getBool("minimize on focus loss", "Video") ? "1" : "0");
 
+    // Pool deleted GL buffer objects for reuse instead of destroying them outright. Terrain
+    // chunks and paged objects constantly create and destroy identically laid out VBOs as the
+    // camera moves; reusing the storage of a deleted buffer replaces a delete/create/allocate
+    // round trip in the driver with a plain data upload. Must be set up before the graphics
+    // context is created.
+    const int bufferObjectPoolSize = settings.getInt("buffer object pool size", "Video");
+    if (bufferObjectPoolSize > 0)
+        osg::DisplaySettings::instance()->setMaxBufferObjectPoolSize(static_cast<unsigned int>(bufferObjectPoolSize) * 1024 * 1024);
+
     checkSDLError(SDL_GL_SetAttribute(SDL_GL_RED_SIZE, 8));
     checkSDLError(SDL_GL_SetAttribute(SDL_GL_GREEN_SIZE, 8));
     checkSDLError(SDL_GL_SetAttribute(SDL_GL_BLUE_SIZE, 8));
@@ -642,6 +763,22 @@ void OMW::Engine::createWindow(Settings::Manager& settings)
     if (Debug::shouldDebugOpenGL())
         mViewer->setRealizeOperation(new Debug::EnableGLDebugOperation());
 
+    // "default" keeps OSG's automatic selection, which respects the OSG_THREADING environment
+    // variable and picks a threaded draw on multicore machines. Dynamic per-frame state in
+    // mwrender is double buffered through SceneUtil::StateSetUpdater, so the threaded modes are
+    // safe; the "validate dynamic state" setting helps track down remaining serialization points.
+    const std::string threadingModel = Settings::Manager::getString("threading model", "Video");
+    if (threadingModel == "single-threaded")
+        mViewer->setThreadingModel(osgViewer::ViewerBase::SingleThreaded);
+    else if (threadingModel == "cull-draw-thread-per-context")
+        mViewer->setThreadingModel(osgViewer::ViewerBase::CullDrawThreadPerContext);
+    else if (threadingModel == "draw-thread-per-context")
+        mViewer->setThreadingModel(osgViewer::ViewerBase::DrawThreadPerContext);
+    else if (threadingModel == "cull-thread-per-camera-draw-thread-per-context")
+        mViewer->setThreadingModel(osgViewer::ViewerBase::CullThreadPerCameraDrawThreadPerContext);
+    else if (threadingModel != "default")
+        Log(Debug::Warning) << "Unknown threading model '" << threadingModel << "', using the default";
+
     mViewer->realize();
 
     mViewer->getEventQueue()->getCurrentEventState()->setWindowRectangle(0, 0, graphicsWindow->getTraits()->width, graphicsWindow->getTraits()->height);
@@ -673,17 +810,53 @@ void OMW::Engine::setWindowIcon()
 
 void OMW::Engine::prepareEngine (Settings::Manager & settings)
 {
+    int numThreads = Settings::Manager::getInt("preload num threads", "Cells");
+    if (numThreads <= 0)
+        throw std::runtime_error("Invalid setting: 'preload num threads' must be >0");
+    mWorkQueue = new SceneUtil::WorkQueue(numThreads);
+
     mEnvironment.setStateManager (
-        new MWState::StateManager (mCfgMgr.getUserDataPath() / "saves", mContentFiles.at (0)));
+        new MWState::StateManager (mCfgMgr.getUserDataPath() / "saves", mContentFiles.at (0), mWorkQueue));
+
+    // Start-up stages without ordering constraints between them run on the work
+    // queue, overlapping the main thread stages that do not need their result
+    // yet: the VFS index is built while the window and GL context come up, and
+    // the sound device (opening it can take a noticeable fraction of start-up
+    // time) while the resource managers, GUI and input are brought up. Each
+    // stage is joined right before the main thread first needs its result.
+    mVFS.reset(new VFS::Manager(mFSStrict));
+
+    osg::ref_ptr<InitStageWorkItem> vfsStage = new InitStageWorkItem("VFS index",
+        [this] { VFS::registerArchives(mVFS.get(), mFileCollections, mArchives, true); });
+    mWorkQueue->addWorkItem(vfsStage, true);
+
+    osg::ElapsedTime stageTimer;
+    const auto reportStage = [&stageTimer] (const char* name)
+    {
+        Log(Debug::Info) << "Init stage '" << name << "' took "
+                         << static_cast<int>(stageTimer.elapsedTime_m()) << " ms";
+        stageTimer.reset();
+    };
 
     createWindow(settings);
 
     osg::ref_ptr<osg::Group> rootNode (new osg::Group);
     mViewer->setSceneData(rootNode);
 
-    mVFS.reset(new VFS::Manager(mFSStrict));
+    reportStage("graphics window");
+
+    // Dispatched only now because createWindow may still write settings (the
+    // antialiasing fallback) while the sound manager's constructor reads them.
+    // The sound manager only stores the VFS pointer, so the index build does
+    // not have to be complete yet. The result is kept on the heap: if a main
+    // thread stage throws while this stage is still running, this stack frame
+    // unwinds before the work queue is stopped by the engine's destructor.
+    auto soundManager = std::make_shared<std::unique_ptr<MWSound::SoundManager>>();
+    osg::ref_ptr<InitStageWorkItem> soundStage = new InitStageWorkItem("sound device",
+        [this, soundManager] { *soundManager = std::make_unique<MWSound::SoundManager>(mVFS.get(), mUseSound); });
+    mWorkQueue->addWorkItem(soundStage, true);
 
-    VFS::registerArchives(mVFS.get(), mFileCollections, mArchives, true);
+    vfsStage->join();
 
     mResourceSystem.reset(new Resource::ResourceSystem(mVFS.get()));
     mResourceSystem->getSceneManager()->setUnRefImageDataAfterApply(false); // keep to Off for now to allow better state sharing
@@ -693,11 +866,23 @@ void OMW::Engine::prepareEngine (Settings::Manager & settings)
         Settings::Manager::getString("texture mipmap", "General"),
         Settings::Manager::getInt("anisotropy", "General")
     );
+    mResourceSystem->getImageManager()->setTranscodeCachePath(
+        Settings::Manager::getString("texture transcode cache path", "General"));
 
-    int numThreads = Settings::Manager::getInt("preload num threads", "Cells");
-    if (numThreads <= 0)
-        throw std::runtime_error("Invalid setting: 'preload num threads' must be >0");
-    mWorkQueue = new SceneUtil::WorkQueue(numThreads);
+    const int cacheSizeLimit = Settings::Manager::getInt("cache size limit", "Cells");
+    if (cacheSizeLimit > 0)
+        mResourceSystem->setCacheSizeBudget(static_cast<std::size_t>(cacheSizeLimit) * 1024 * 1024);
+
+    if (Settings::Manager::getBool("texture mip streaming", "General"))
+    {
+        Resource::ImageManager& imageManager = *mResourceSystem->getImageManager();
+        imageManager.setImageStreaming(mWorkQueue);
+        // The swap of streamed-in data mutates images the draw traversal uploads,
+        // so it has to run on the draw thread, between the context's draws.
+        mViewer->getCamera()->getGraphicsContext()->add(new ApplyStreamedImagesOperation(imageManager));
+    }
+
+    reportStage("resource managers");
 
     mScreenCaptureOperation = new SceneUtil::AsyncScreenCaptureOperation(
         mWorkQueue,
@@ -756,6 +941,14 @@ void OMW::Engine::prepareEngine (Settings::Manager & settings)
     // gui needs our shaders path before everything else
     mResourceSystem->getSceneManager()->setShaderPath((mResDir / "shaders").string());
 
+    const std::string programBinaryCachePath = Settings::Manager::getString("program binary cache path", "Shaders");
+    if (!programBinaryCachePath.empty())
+    {
+        Shader::ShaderManager& shaderManager = mResourceSystem->getSceneManager()->getShaderManager();
+        shaderManager.setProgramBinaryCachePath(programBinaryCachePath);
+        mViewer->getCamera()->getGraphicsContext()->add(new UpdateProgramBinaryCacheOperation(shaderManager));
+    }
+
     osg::ref_ptr<osg::GLExtensions> exts = osg::GLExtensions::Get(0, false);
     bool shadersSupported = exts && (exts->glslLanguageVersion >= 1.2f);
 
@@ -773,8 +966,12 @@ void OMW::Engine::prepareEngine (Settings::Manager & settings)
     MWInput::InputManager* input = new MWInput::InputManager (mWindow, mViewer, mScreenCaptureHandler, mScreenCaptureOperation, keybinderUser, keybinderUserExists, userGameControllerdb, gameControllerdb, mGrab);
     mEnvironment.setInputManager (input);
 
-    // Create sound system
-    mEnvironment.setSoundManager (new MWSound::SoundManager(mVFS.get(), mUseSound));
+    reportStage("GUI and input");
+
+    // The sound manager has to be in place before the logo video plays below:
+    // the video widget pulls its audio through the movie audio factory.
+    soundStage->join();
+    mEnvironment.setSoundManager (soundManager->release());
 
     if (!mSkipMenu)
     {
@@ -792,6 +989,8 @@ void OMW::Engine::prepareEngine (Settings::Manager & settings)
     window->setStore(mEnvironment.getWorld()->getStore());
     window->initUI();
 
+    reportStage("world");
+
     //Load translation data
     mTranslationDataStorage.setEncoder(mEncoder);
     for (size_t i = 0; i < mContentFiles.size(); i++)
@@ -804,7 +1003,8 @@ void OMW::Engine::prepareEngine (Settings::Manager & settings)
     mScriptContext->setExtensions (&mExtensions);
 
     mEnvironment.setScriptManager (new MWScript::ScriptManager (mEnvironment.getWorld()->getStore(), *mScriptContext, mWarningsMode,
-        mScriptBlacklistUse ? mScriptBlacklist : std::vector<std::string>()));
+        mScriptBlacklistUse ? mScriptBlacklist : std::vector<std::string>(),
+        (mCfgMgr.getUserDataPath() / "script_bytecode.cache").string()));
 
     // Create game mechanics system
     MWMechanics::MechanicsManager* mechanics = new MWMechanics::MechanicsManager;
@@ -836,6 +1036,43 @@ void OMW::Engine::prepareEngine (Settings::Manager & settings)
     }
 
     mLuaManager->init();
+
+    reportStage("script and game systems");
+}
+
+namespace
+{
+    // Runs the per-frame sound update on the work queue, in parallel with rendering.
+    // Like the Lua worker, it only reads world state that the logic update has
+    // finished writing; the main thread joins it before it touches the sound manager
+    // again (applying queued Lua changes can already play sounds).
+    class SoundUpdateWorkItem : public SceneUtil::WorkItem
+    {
+    public:
+        SoundUpdateWorkItem(float dt, osg::Timer_t frameStart, unsigned int frameNumber, osg::Stats& stats)
+            : mDt(dt), mFrameStart(frameStart), mFrameNumber(frameNumber), mStats(stats)
+        {
+        }
+
+        void doWork() override
+        {
+            try
+            {
+                ScopedProfile<UserStatsType::Sound> profile(mFrameStart, mFrameNumber, *osg::Timer::instance(), mStats);
+                MWBase::Environment::get().getSoundManager()->update(mDt);
+            }
+            catch (const std::exception& e)
+            {
+                Log(Debug::Error) << "Error in sound update: " << e.what();
+            }
+        }
+
+    private:
+        float mDt;
+        osg::Timer_t mFrameStart;
+        unsigned int mFrameNumber;
+        osg::Stats& mStats;
+    };
 }
 
 class OMW::Engine::LuaWorker
@@ -887,6 +1124,8 @@ private:
         ScopedProfile<UserStatsType::Lua> profile(frameStart, frameNumber, *osg::Timer::instance(), *viewer->getViewerStats());
 
         mEngine->mLuaManager->update(mIsGuiMode, mDt);
+        if (viewer->getViewerStats()->collectStats("resource"))
+            mEngine->mLuaManager->reportStats(frameNumber, *viewer->getViewerStats());
     }
 
     void threadBody()
@@ -923,6 +1162,12 @@ void OMW::Engine::go()
     SDL_GetVersion(&sdlVersion);
     Log(Debug::Info) << "SDL version: " << (int)sdlVersion.major << "." << (int)sdlVersion.minor << "." << (int)sdlVersion.patch;
 
+    // A replayed session must run with the seed it was recorded with to stay deterministic
+    if (!mReplaySessionFile.empty())
+        mRandomSeed = mInputReplay.startReplay(mReplaySessionFile);
+    else if (!mRecordSessionFile.empty())
+        mInputReplay.startRecording(mRecordSessionFile, mRandomSeed);
+
     Misc::Rng::init(mRandomSeed);
 
     // Load settings
@@ -948,6 +1193,17 @@ void OMW::Engine::go()
 
     prepareEngine (settings);
 
+    if (mPrecomputeNavMesh)
+    {
+        if (Settings::Manager::getString("nav mesh disk cache path", "Navigator").empty())
+            Log(Debug::Warning) << "Navmesh precomputation requested but no nav mesh disk cache path is configured;"
+                " generated tiles will not be stored";
+        // A running game state is needed so cell changes go through the regular activation path
+        mEnvironment.getStateManager()->newGame(true);
+        precomputeNavMesh();
+        return;
+    }
+
     std::ofstream stats;
     if (const auto path = std::getenv("OPENMW_OSG_STATS_FILE"))
     {
@@ -1001,12 +1257,30 @@ void OMW::Engine::go()
     double simulationTime = 0.0;
     Misc::FrameRateLimiter frameRateLimiter = Misc::makeFrameRateLimiter(mEnvironment.getFrameRateLimit());
     const std::chrono::steady_clock::duration maxSimulationInterval(std::chrono::milliseconds(200));
+    // Without a display to pace against, headless hosts advance the simulation by a
+    // fixed step per iteration so results stay deterministic; combine with the
+    // framerate limit setting to run in real time.
+    const double headlessTimestep = 1.0 / 60.0;
     while (!mViewer->done() && !mEnvironment.getStateManager()->hasQuitRequest())
     {
-        const double dt = std::chrono::duration_cast<std::chrono::duration<double>>(std::min(
-            frameRateLimiter.getLastFrameDuration(),
-            maxSimulationInterval
-        )).count();
+        double dt = mHeadless ? headlessTimestep
+            : std::chrono::duration_cast<std::chrono::duration<double>>(std::min(
+                frameRateLimiter.getLastFrameDuration(),
+                maxSimulationInterval
+            )).count();
+
+        // A replayed session advances by the recorded timesteps and injects the recorded
+        // events; the measured frame times feed the timing summary logged at the end.
+        if (mInputReplay.getMode() == InputReplay::Mode::Replay)
+        {
+            mInputReplay.addFrameTime(std::chrono::duration_cast<std::chrono::duration<double>>(
+                frameRateLimiter.getLastFrameDuration()).count());
+            if (!mInputReplay.replayFrame(dt))
+            {
+                mEnvironment.getStateManager()->requestQuit();
+                continue;
+            }
+        }
 
         mViewer->advance(simulationTime);
 
@@ -1017,6 +1291,10 @@ void OMW::Engine::go()
         }
         else
         {
+            // The events this frame's input update pumped off the queue are now buffered
+            if (mInputReplay.getMode() == InputReplay::Mode::Record)
+                mInputReplay.recordFrame(dt);
+
             mViewer->eventTraversal();
             mViewer->updateTraversal();
 
@@ -1024,7 +1302,24 @@ void OMW::Engine::go()
 
             luaWorker.allowUpdate(dt);  // if there is a separate Lua thread, it starts the update now
 
-            mViewer->renderingTraversals();
+            osg::ref_ptr<SceneUtil::WorkItem> soundUpdate;
+            if (mUseSound)
+            {
+                // Voice positions come from actor head nodes, so they have to be
+                // resolved here, before rendering owns the scene graph.
+                mEnvironment.getSoundManager()->updateVoicePositions();
+                soundUpdate = new SoundUpdateWorkItem(dt, mViewer->getStartTick(),
+                    mViewer->getFrameStamp()->getFrameNumber(), *mViewer->getViewerStats());
+                // Jump ahead of queued background work (cell preloading etc.) so the
+                // join below never stalls behind a long-running item.
+                mWorkQueue->addWorkItem(soundUpdate, true);
+            }
+
+            if (!mHeadless)
+                mViewer->renderingTraversals();
+
+            if (soundUpdate)
+                soundUpdate->waitTillDone();
 
             luaWorker.finishUpdate();
 
@@ -1046,6 +1341,9 @@ void OMW::Engine::go()
             }
         }
 
+        // Everything handed out by the main thread's frame arena this frame is dead by now
+        Misc::FrameArena::get().reset();
+
         frameRateLimiter.limit();
     }
 
@@ -1056,6 +1354,8 @@ void OMW::Engine::go()
 
     mViewer->stopThreading();
 
+    Debug::logMemoryStats();
+
     Log(Debug::Info) << "Quitting peacefully.";
 }
 
@@ -1114,6 +1414,38 @@ void OMW::Engine::enableFontExport(bool exportFonts)
     mExportFonts = exportFonts;
 }
 
+void OMW::Engine::enableNavMeshPrecomputation(bool precompute)
+{
+    mPrecomputeNavMesh = precompute;
+}
+
+void OMW::Engine::enableHeadless(bool headless)
+{
+    mHeadless = headless;
+}
+
+void OMW::Engine::precomputeNavMesh()
+{
+    MWBase::World* world = mEnvironment.getWorld();
+    const MWWorld::Store<ESM::Cell>& cells = world->getStore().get<ESM::Cell>();
+    const std::size_t total = cells.getExtSize();
+    Loading::Listener listener;
+    std::size_t current = 0;
+    for (auto it = cells.extBegin(); it != cells.extEnd(); ++it)
+    {
+        ESM::Position position;
+        std::fill(std::begin(position.pos), std::end(position.pos), 0.f);
+        std::fill(std::begin(position.rot), std::end(position.rot), 0.f);
+        position.pos[0] = (it->getGridX() + 0.5f) * Constants::CellSizeInUnits;
+        position.pos[1] = (it->getGridY() + 0.5f) * Constants::CellSizeInUnits;
+        world->changeToExteriorCell(position, false, false);
+        world->getNavigator()->wait(listener, DetourNavigator::WaitConditionType::allJobsDone);
+        Log(Debug::Info) << "Navmesh precomputation: " << ++current << "/" << total
+            << " cell (" << it->getGridX() << ", " << it->getGridY() << ")";
+    }
+    Log(Debug::Info) << "Navmesh precomputation done: " << total << " exterior cells";
+}
+
 void OMW::Engine::setSaveGameFile(const std::string &savegame)
 {
     mSaveGameFile = savegame;
@@ -1123,3 +1455,13 @@ void OMW::Engine::setRandomSeed(unsigned int seed)
 {
     mRandomSeed = seed;
 }
+
+void OMW::Engine::setRecordSessionFile(const std::string& path)
+{
+    mRecordSessionFile = path;
+}
+
+void OMW::Engine::setReplaySessionFile(const std::string& path)
+{
+    mReplaySessionFile = path;
+}
@@ -13,6 +13,8 @@
 
 #include "mwworld/ptr.hpp"
 
+#include "inputreplay.hpp"
+
 namespace Resource
 {
     class ResourceSystem;
@@ -87,7 +89,12 @@ namespace OMW
             bool mGrab;
 
             bool mExportFonts;
+            bool mPrecomputeNavMesh;
+            bool mHeadless;
             unsigned int mRandomSeed;
+            std::string mRecordSessionFile;
+            std::string mReplaySessionFile;
+            InputReplay mInputReplay;
 
             Compiler::Extensions mExtensions;
             Compiler::Context *mScriptContext;
@@ -118,6 +125,10 @@ namespace OMW
             void createWindow(Settings::Manager& settings);
             void setWindowIcon();
 
+            /// Walk all exterior cells through the regular activation path so every static
+            /// navmesh tile is generated and stored in the navmesh disk cache, then return.
+            void precomputeNavMesh();
+
         public:
             Engine(Files::ConfigurationManager& configurationManager);
             virtual ~Engine();
@@ -188,11 +199,28 @@ namespace OMW
 
             void enableFontExport(bool exportFonts);
 
+            /// Generate the navmesh disk cache for all exterior cells and exit instead of
+            /// starting the game.
+            void enableNavMeshPrecomputation(bool precompute);
+
+            /// Run the simulation without presenting anything: the window stays hidden,
+            /// the scene is never culled or drawn and the game loop advances by a fixed
+            /// timestep. Meant for dedicated hosts that only need world simulation.
+            void enableHeadless(bool headless);
+
             /// Set the save game file to load after initialising the engine.
             void setSaveGameFile(const std::string& savegame);
 
             void setRandomSeed(unsigned int seed);
 
+            /// Record the input events and frame timesteps of this session to the given
+            /// file so the workload can be replayed for performance measurements.
+            void setRecordSessionFile(const std::string& path);
+
+            /// Play back a recorded session: input is injected from the file, the RNG
+            /// seed it stores is applied and a frame-time summary is logged at the end.
+            void setReplaySessionFile(const std::string& path);
+
         private:
             Files::ConfigurationManager& mCfgMgr;
             class LuaWorker;
@@ -0,0 +1,149 @@
+#include "inputreplay.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+#include <components/debug/debuglog.hpp>
+
+namespace
+{
+    const char sessionMagic[8] = {'O', 'M', 'W', 'S', 'E', 'S', 'S', '1'};
+}
+
+namespace OMW
+{
+
+    InputReplay::~InputReplay()
+    {
+        if (mMode == Mode::Record)
+            SDL_DelEventWatch(&InputReplay::eventWatch, this);
+        else if (mMode == Mode::Replay)
+            logTimingSummary();
+    }
+
+    void InputReplay::startRecording(const std::string& path, unsigned int seed)
+    {
+        mStream.open(path, std::ios::out | std::ios::binary);
+        if (!mStream)
+            throw std::runtime_error("Failed to open session file for recording: " + path);
+
+        mStream.write(sessionMagic, sizeof(sessionMagic));
+        const std::uint32_t seed32 = seed;
+        mStream.write(reinterpret_cast<const char*>(&seed32), sizeof(seed32));
+
+        SDL_AddEventWatch(&InputReplay::eventWatch, this);
+        mMode = Mode::Record;
+        Log(Debug::Info) << "Recording input session to: " << path;
+    }
+
+    unsigned int InputReplay::startReplay(const std::string& path)
+    {
+        mStream.open(path, std::ios::in | std::ios::binary);
+        if (!mStream)
+            throw std::runtime_error("Failed to open session file for replay: " + path);
+
+        char magic[sizeof(sessionMagic)];
+        std::uint32_t seed32 = 0;
+        mStream.read(magic, sizeof(magic));
+        mStream.read(reinterpret_cast<char*>(&seed32), sizeof(seed32));
+        if (!mStream || !std::equal(std::begin(magic), std::end(magic), std::begin(sessionMagic)))
+            throw std::runtime_error("Not an input session file: " + path);
+
+        mMode = Mode::Replay;
+        Log(Debug::Info) << "Replaying input session from: " << path;
+        return seed32;
+    }
+
+    void InputReplay::recordFrame(double dt)
+    {
+        std::vector<SDL_Event> events;
+        {
+            std::lock_guard<std::mutex> lock(mPendingMutex);
+            events.swap(mPendingEvents);
+        }
+
+        mStream.write(reinterpret_cast<const char*>(&dt), sizeof(dt));
+        const std::uint32_t count = static_cast<std::uint32_t>(events.size());
+        mStream.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        if (count > 0)
+            mStream.write(reinterpret_cast<const char*>(events.data()), count * sizeof(SDL_Event));
+    }
+
+    bool InputReplay::replayFrame(double& dt)
+    {
+        std::uint32_t count = 0;
+        mStream.read(reinterpret_cast<char*>(&dt), sizeof(dt));
+        mStream.read(reinterpret_cast<char*>(&count), sizeof(count));
+        if (!mStream)
+            return false;
+
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            SDL_Event event;
+            mStream.read(reinterpret_cast<char*>(&event), sizeof(event));
+            if (!mStream)
+                return false;
+            SDL_PushEvent(&event);
+        }
+        return true;
+    }
+
+    void InputReplay::addFrameTime(double seconds)
+    {
+        mFrameTimes.push_back(seconds);
+    }
+
+    int InputReplay::eventWatch(void* userdata, SDL_Event* event)
+    {
+        InputReplay& replay = *static_cast<InputReplay*>(userdata);
+        std::lock_guard<std::mutex> lock(replay.mPendingMutex);
+        replay.mPendingEvents.push_back(*event);
+        return 0;
+    }
+
+    void InputReplay::logTimingSummary()
+    {
+        if (mFrameTimes.empty())
+            return;
+
+        std::vector<double> sorted(mFrameTimes);
+        std::sort(sorted.begin(), sorted.end());
+        const auto percentile = [&] (double p)
+        {
+            const std::size_t index = std::min(sorted.size() - 1,
+                static_cast<std::size_t>(p * sorted.size()));
+            return sorted[index] * 1000.0;
+        };
+        const double mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size() * 1000.0;
+
+        std::ostringstream summary;
+        summary << std::fixed << std::setprecision(2)
+            << "mean " << mean
+            << ", p50 " << percentile(0.5)
+            << ", p90 " << percentile(0.9)
+            << ", p99 " << percentile(0.99)
+            << ", max " << sorted.back() * 1000.0;
+        Log(Debug::Info) << "Replayed " << sorted.size() << " frames; frame time (ms): " << summary.str();
+
+        // 2 ms buckets give enough resolution to diff distributions across commits
+        const double bucketSize = 0.002;
+        std::vector<std::size_t> buckets;
+        for (double time : sorted)
+        {
+            const std::size_t bucket = static_cast<std::size_t>(time / bucketSize);
+            if (bucket >= buckets.size())
+                buckets.resize(bucket + 1, 0);
+            ++buckets[bucket];
+        }
+        std::ostringstream histogram;
+        for (std::size_t i = 0; i < buckets.size(); ++i)
+            if (buckets[i] > 0)
+                histogram << " [" << i * 2 << "," << (i + 1) * 2 << ")=" << buckets[i];
+        Log(Debug::Info) << "Frame time histogram (ms):" << histogram.str();
+    }
+
+}
@@ -0,0 +1,73 @@
+#ifndef GAME_INPUTREPLAY_H
+#define GAME_INPUTREPLAY_H
+
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <SDL_events.h>
+
+namespace OMW
+{
+    /// \brief Records the SDL input events and simulation timesteps of a play session
+    /// to a file and plays such a file back, so a gameplay workload can be reproduced
+    /// for performance measurements.
+    ///
+    /// Together with the RNG seed stored in the session header the playback is
+    /// deterministic frame for frame. The event data is written raw, so a session
+    /// file is only meaningful on the same platform and SDL version it was recorded
+    /// with - which is all a CI performance diff needs.
+    class InputReplay
+    {
+        public:
+            enum class Mode
+            {
+                Inactive,
+                Record,
+                Replay
+            };
+
+            InputReplay() = default;
+            ~InputReplay();
+
+            InputReplay(const InputReplay&) = delete;
+            InputReplay& operator=(const InputReplay&) = delete;
+
+            Mode getMode() const { return mMode; }
+
+            /// Begin writing a session file; the given RNG seed is stored in the header.
+            void startRecording(const std::string& path, unsigned int seed);
+
+            /// Open a session file for playback and return the RNG seed it was recorded with.
+            unsigned int startReplay(const std::string& path);
+
+            /// Append a frame to the session: the events seen since the previous call
+            /// together with the timestep the simulation was advanced by.
+            void recordFrame(double dt);
+
+            /// Push the next recorded frame's events onto the SDL event queue and set \a dt
+            /// to the recorded timestep. Returns false once the session is exhausted.
+            bool replayFrame(double& dt);
+
+            /// Feed the measured wall-clock duration of a replayed frame into the timing
+            /// summary that is logged when the replay ends.
+            void addFrameTime(double seconds);
+
+        private:
+            static int eventWatch(void* userdata, SDL_Event* event);
+
+            void logTimingSummary();
+
+            Mode mMode = Mode::Inactive;
+            std::fstream mStream;
+
+            // filled by the SDL event watch while recording
+            std::mutex mPendingMutex;
+            std::vector<SDL_Event> mPendingEvents;
+
+            std::vector<double> mFrameTimes;
+    };
+}
+
+#endif
@@ -127,11 +127,23 @@ bool parseOptions (int argc, char** argv, OMW::Engine& engine, Files::Configurat
         ("export-fonts", bpo::value<bool>()->implicit_value(true)
             ->default_value(false), "Export Morrowind .fnt fonts to PNG image and XML file in current directory")
 
+        ("precompute-navmesh", bpo::value<bool>()->implicit_value(true)
+            ->default_value(false), "Generate the navmesh disk cache for all exterior cells and exit")
+
+        ("headless", bpo::value<bool>()->implicit_value(true)
+            ->default_value(false), "Run the simulation without presenting anything: keep the window hidden, skip all rendering and advance the game loop by a fixed timestep (for dedicated hosts; combine with --no-sound and --skip-menu)")
+
         ("activate-dist", bpo::value <int> ()->default_value (-1), "activation distance override")
 
         ("random-seed", bpo::value <unsigned int> ()
             ->default_value(Misc::Rng::generateDefaultSeed()),
             "seed value for random number generator")
+
+        ("record-session", bpo::value<Files::EscapePath>()->default_value(Files::EscapePath(), ""),
+            "record the input events and frame timesteps of this session to the given file, so the workload can be replayed with --replay-session")
+
+        ("replay-session", bpo::value<Files::EscapePath>()->default_value(Files::EscapePath(), ""),
+            "play back a session recorded with --record-session (using the RNG seed it was recorded with) and log a frame-time summary at the end")
     ;
 
     bpo::parsed_options valid_opts = bpo::command_line_parser(argc, argv)
@@ -245,7 +257,11 @@ bool parseOptions (int argc, char** argv, OMW::Engine& engine, Files::Configurat
     engine.setSoundUsage(!variables["no-sound"].as<bool>());
     engine.setActivationDistanceOverride (variables["activate-dist"].as<int>());
     engine.enableFontExport(variables["export-fonts"].as<bool>());
+    engine.enableNavMeshPrecomputation(variables["precompute-navmesh"].as<bool>());
+    engine.enableHeadless(variables["headless"].as<bool>());
     engine.setRandomSeed(variables["random-seed"].as<unsigned int>());
+    engine.setRecordSessionFile(variables["record-session"].as<Files::EscapePath>().mPath.string());
+    engine.setReplaySessionFile(variables["replay-session"].as<Files::EscapePath>().mPath.string());
 
     return true;
 }
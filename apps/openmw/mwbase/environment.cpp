@@ -214,5 +214,6 @@ const MWBase::Environment& MWBase::Environment::get()
 void MWBase::Environment::reportStats(unsigned int frameNumber, osg::Stats& stats) const
 {
     mMechanicsManager->reportStats(frameNumber, stats);
+    mScriptManager->reportStats(frameNumber, stats);
     mWorld->reportStats(frameNumber, stats);
 }
@@ -89,6 +89,11 @@ namespace MWBase
             virtual TTopicIter topicEnd() const = 0;
             ///< Iterator pointing past the last topic.
 
+            virtual std::size_t getRevision() const = 0;
+            ///< Returns a counter that changes whenever the journal content changes.
+            /// Views can compare it against a stored value to decide whether data
+            /// built from the journal is still valid.
+
             virtual int countSavedGameRecords() const = 0;
 
             virtual void write (ESM::ESMWriter& writer, Loading::Listener& progress) const = 0;
@@ -277,6 +277,8 @@ namespace MWBase
             virtual float getAngleToPlayer(const MWWorld::Ptr& ptr) const  = 0;
             virtual MWMechanics::GreetingState getGreetingState(const MWWorld::Ptr& ptr) const = 0;
             virtual bool isTurningToPlayer(const MWWorld::Ptr& ptr) const = 0;
+            /// AI scheduling tier the actor was assigned this frame; Near for unknown actors.
+            virtual MWMechanics::AiUpdateTier getAiUpdateTier(const MWWorld::Ptr& ptr) const = 0;
 
             virtual void restoreStatsAfterCorprus(const MWWorld::Ptr& actor, const std::string& sourceId) = 0;
     };
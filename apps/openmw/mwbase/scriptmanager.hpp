@@ -3,6 +3,11 @@
 
 #include <string>
 
+namespace osg
+{
+    class Stats;
+}
+
 namespace Interpreter
 {
     class Context;
@@ -55,6 +60,8 @@ namespace MWBase
             virtual MWScript::GlobalScripts& getGlobalScripts() = 0;
 
             virtual const Compiler::Extensions& getExtensions() const = 0;
+
+            virtual void reportStats(unsigned int frameNumber, osg::Stats& stats) const = 0;
    };
 }
 
@@ -157,6 +157,11 @@ namespace MWBase
             virtual void stopSound(const MWWorld::CellStore *cell) = 0;
             ///< Stop all sounds for the given cell.
 
+            virtual void preloadSounds(const MWWorld::CellStore *cell) = 0;
+            ///< Queue sound buffers that are likely needed once the given cell becomes
+            ///< active (region ambients, movement sounds) for loading over the
+            ///< following frames, so they do not hitch on first play.
+
             virtual void fadeOutSound3D(const MWWorld::ConstPtr &reference, const std::string& soundId, float duration) = 0;
             ///< Fade out given sound (that is already playing) of given object
             ///< @param reference Reference to object, whose sound is faded out
@@ -178,6 +183,11 @@ namespace MWBase
 
             virtual void update(float duration) = 0;
 
+            virtual void updateVoicePositions() = 0;
+            ///< Refresh the scene positions of actor voices. Must run on the main
+            ///< thread: update() may run in parallel with the rendering traversals
+            ///< and must not resolve scene graph nodes itself.
+
             virtual void setListenerPosDir(const osg::Vec3f &pos, const osg::Vec3f &dir, const osg::Vec3f &up, bool underwater) = 0;
 
             virtual void updatePtr(const MWWorld::ConstPtr& old, const MWWorld::ConstPtr& updated) = 0;
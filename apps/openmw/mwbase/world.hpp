@@ -3,8 +3,10 @@
 
 #include "rotationflags.hpp"
 
+#include <cstddef>
 #include <vector>
 #include <map>
+#include <optional>
 #include <set>
 #include <deque>
 
@@ -170,18 +172,34 @@ namespace MWBase
             virtual void setGlobalInt (const std::string& name, int value) = 0;
             ///< Set value independently from real type.
 
+            virtual void setGlobalInt (int index, int value) = 0;
+            ///< Set value independently from real type.
+
             virtual void setGlobalFloat (const std::string& name, float value) = 0;
             ///< Set value independently from real type.
 
+            virtual void setGlobalFloat (int index, float value) = 0;
+            ///< Set value independently from real type.
+
             virtual int getGlobalInt (const std::string& name) const = 0;
             ///< Get value independently from real type.
 
+            virtual int getGlobalInt (int index) const = 0;
+            ///< Get value independently from real type.
+
             virtual float getGlobalFloat (const std::string& name) const = 0;
             ///< Get value independently from real type.
 
+            virtual float getGlobalFloat (int index) const = 0;
+            ///< Get value independently from real type.
+
             virtual char getGlobalVariableType (const std::string& name) const = 0;
             ///< Return ' ', if there is no global variable with this name.
 
+            virtual int getGlobalIndex (const std::string& name) const = 0;
+            ///< Return the index of the global variable with this name or -1, if there is no
+            /// such variable. Indices are stable for the lifetime of the content file selection.
+
             virtual std::string getCellName (const MWWorld::CellStore *cell = nullptr) const = 0;
             ///< Return name of the cell.
             ///
@@ -325,6 +343,15 @@ namespace MWBase
 
             virtual bool castRay(const osg::Vec3f& from, const osg::Vec3f& to, int mask, const MWWorld::ConstPtr& ignore) = 0;
 
+            virtual std::size_t asyncCastRay(const osg::Vec3f& from, const osg::Vec3f& to, int mask) = 0;
+            ///< Queue a ray for asynchronous processing by the physics worker threads. Returns
+            /// a handle for retrieveAsyncRayCastResult; the result typically becomes available
+            /// the next frame.
+
+            virtual std::optional<bool> retrieveAsyncRayCastResult(std::size_t handle) = 0;
+            ///< Whether the ray queued under \a handle hit anything. Returns std::nullopt while
+            /// the query is still pending; once a result has been returned the handle is forgotten.
+
             virtual void setActorCollisionMode(const MWWorld::Ptr& ptr, bool internal, bool external) = 0;
             virtual bool isActorCollisionEnabled(const MWWorld::Ptr& ptr) = 0;
 
@@ -3,9 +3,15 @@
 #include <components/esm/loadlevlist.hpp>
 #include <components/esm/creaturelevliststate.hpp>
 
+#include "../mwbase/environment.hpp"
+#include "../mwbase/world.hpp"
+
 #include "../mwmechanics/levelledlist.hpp"
 
+#include "../mwworld/class.hpp"
 #include "../mwworld/customdata.hpp"
+#include "../mwworld/esmstore.hpp"
+#include "../mwworld/manualref.hpp"
 #include "../mwmechanics/creaturestats.hpp"
 
 namespace MWClass
@@ -21,6 +21,53 @@
 
 #include "selectwrapper.hpp"
 
+std::vector<const ESM::DialInfo *> MWDialogue::Filter::getOrderedInfos (const ESM::Dialogue& dialogue) const
+{
+    std::vector<const ESM::DialInfo *> infos;
+
+    if (dialogue.mGenericInfo.empty() && dialogue.mActorInfo.empty())
+    {
+        // The index has not been built for this dialogue, test every info
+        for (ESM::Dialogue::InfoContainer::const_iterator iter = dialogue.mInfo.begin();
+            iter != dialogue.mInfo.end(); ++iter)
+            infos.push_back (&*iter);
+        return infos;
+    }
+
+    const auto bucket = dialogue.mActorInfo.find (mActor.getCellRef().getRefId());
+
+    if (bucket == dialogue.mActorInfo.end())
+    {
+        infos.reserve (dialogue.mGenericInfo.size());
+        for (const auto& generic : dialogue.mGenericInfo)
+            infos.push_back (generic.second);
+        return infos;
+    }
+
+    // Merge the two position-sorted sequences back into the original evaluation order
+    infos.reserve (dialogue.mGenericInfo.size() + bucket->second.size());
+
+    auto genericIt = dialogue.mGenericInfo.begin();
+    auto actorIt = bucket->second.begin();
+
+    while (genericIt != dialogue.mGenericInfo.end() || actorIt != bucket->second.end())
+    {
+        if (actorIt == bucket->second.end()
+            || (genericIt != dialogue.mGenericInfo.end() && genericIt->first < actorIt->first))
+        {
+            infos.push_back (genericIt->second);
+            ++genericIt;
+        }
+        else
+        {
+            infos.push_back (actorIt->second);
+            ++actorIt;
+        }
+    }
+
+    return infos;
+}
+
 bool MWDialogue::Filter::testActor (const ESM::DialInfo& info) const
 {
     bool isCreature = (mActor.getTypeName() != typeid (ESM::NPC).name());
@@ -178,7 +225,7 @@ bool MWDialogue::Filter::testFunctionLocal(const MWDialogue::SelectWrapper& sele
     if (scriptName.empty())
         return false; // no script
 
-    std::string name = Misc::StringUtils::lowerCase (select.getName());
+    const std::string& name = select.getName(); // already case-smashed
 
     const Compiler::Locals& localDefs =
         MWBase::Environment::get().getScriptManager()->getLocals (scriptName);
@@ -629,10 +676,10 @@ const ESM::DialInfo* MWDialogue::Filter::search (const ESM::Dialogue& dialogue,
 std::vector<const ESM::DialInfo *> MWDialogue::Filter::listAll (const ESM::Dialogue& dialogue) const
 {
     std::vector<const ESM::DialInfo *> infos;
-    for (ESM::Dialogue::InfoContainer::const_iterator iter = dialogue.mInfo.begin(); iter!=dialogue.mInfo.end(); ++iter)
+    for (const ESM::DialInfo* info : getOrderedInfos (dialogue))
     {
-        if (testActor (*iter))
-            infos.push_back(&*iter);
+        if (testActor (*info))
+            infos.push_back(info);
     }
     return infos;
 }
@@ -645,13 +692,12 @@ std::vector<const ESM::DialInfo *> MWDialogue::Filter::list (const ESM::Dialogue
     bool infoRefusal = false;
 
     // Iterate over topic responses to find a matching one
-    for (ESM::Dialogue::InfoContainer::const_iterator iter = dialogue.mInfo.begin();
-        iter!=dialogue.mInfo.end(); ++iter)
+    for (const ESM::DialInfo* info : getOrderedInfos (dialogue))
     {
-        if (testActor (*iter) && testPlayer (*iter) && testSelectStructs (*iter))
+        if (testActor (*info) && testPlayer (*info) && testSelectStructs (*info))
         {
-            if (testDisposition (*iter, invertDisposition)) {
-                infos.push_back(&*iter);
+            if (testDisposition (*info, invertDisposition)) {
+                infos.push_back(info);
                 if (!searchAll)
                     break;
             }
@@ -670,10 +716,9 @@ std::vector<const ESM::DialInfo *> MWDialogue::Filter::list (const ESM::Dialogue
 
         const ESM::Dialogue& infoRefusalDialogue = *dialogues.find ("Info Refusal");
 
-        for (ESM::Dialogue::InfoContainer::const_iterator iter = infoRefusalDialogue.mInfo.begin();
-            iter!=infoRefusalDialogue.mInfo.end(); ++iter)
-            if (testActor (*iter) && testPlayer (*iter) && testSelectStructs (*iter) && testDisposition(*iter, invertDisposition)) {
-                infos.push_back(&*iter);
+        for (const ESM::DialInfo* info : getOrderedInfos (infoRefusalDialogue))
+            if (testActor (*info) && testPlayer (*info) && testSelectStructs (*info) && testDisposition(*info, invertDisposition)) {
+                infos.push_back(info);
                 if (!searchAll)
                     break;
             }
@@ -21,6 +21,10 @@ namespace MWDialogue
             int mChoice;
             bool mTalkedToPlayer;
 
+            std::vector<const ESM::DialInfo *> getOrderedInfos (const ESM::Dialogue& dialogue) const;
+            ///< Get the infos that could concern mActor, in their original evaluation order.
+            /// Infos naming a different actor can never match and are skipped (see ESM::Dialogue::setUpInfoIndex).
+
             bool testActor (const ESM::DialInfo& info) const;
             ///< Is this the right actor for this \a info?
 
@@ -50,16 +50,25 @@ namespace MWDialogue
             const MWWorld::Store<ESM::Dialogue> & dialogs =
                 MWBase::Environment::get().getWorld()->getStore().get<ESM::Dialogue>();
 
-            std::vector<std::string> keywordList;
-            keywordList.reserve(dialogs.getSize());
-            for (const auto& it : dialogs)
-                keywordList.push_back(Misc::StringUtils::lowerCase(it.mId));
-            sort(keywordList.begin(), keywordList.end());
+            // The topic list only changes when content files are loaded, so
+            // build the search once and share it across all invocations
+            // instead of reseeding it for every parsed response.
+            static KeywordSearch<std::string, int /*unused*/> keywordSearch;
+            static size_t numDialogs = 0;
+            if (numDialogs != dialogs.getSize())
+            {
+                numDialogs = dialogs.getSize();
 
-            KeywordSearch<std::string, int /*unused*/> keywordSearch;
+                std::vector<std::string> keywordList;
+                keywordList.reserve(dialogs.getSize());
+                for (const auto& it : dialogs)
+                    keywordList.push_back(Misc::StringUtils::lowerCase(it.mId));
+                sort(keywordList.begin(), keywordList.end());
 
-            for (const auto& it : keywordList)
-                keywordSearch.seed(it, 0 /*unused*/);
+                keywordSearch.clear();
+                for (const auto& it : keywordList)
+                    keywordSearch.seed(it, 0 /*unused*/);
+            }
 
             std::vector<KeywordSearch<std::string, int /*unused*/>::Match> matches;
             keywordSearch.highlightKeywords(text.begin(), text.end(), matches);
@@ -66,6 +66,7 @@ namespace MWDialogue
     }
 
     Journal::Journal()
+        : mRevision(0)
     {}
 
     void Journal::clear()
@@ -73,6 +74,7 @@ namespace MWDialogue
         mJournal.clear();
         mQuests.clear();
         mTopics.clear();
+        ++mRevision;
     }
 
     void Journal::addEntry (const std::string& id, int index, const MWWorld::Ptr& actor)
@@ -94,6 +96,7 @@ namespace MWDialogue
 
         Quest& quest = getQuest (id);
         quest.addEntry (entry); // we are doing slicing on purpose here
+        ++mRevision;
 
         // there is no need to show empty entries in journal
         if (!entry.getText().empty())
@@ -108,6 +111,7 @@ namespace MWDialogue
         Quest& quest = getQuest (id);
 
         quest.setIndex (index);
+        ++mRevision;
     }
 
     void Journal::addTopic (const std::string& topicId, const std::string& infoId, const MWWorld::Ptr& actor)
@@ -117,6 +121,7 @@ namespace MWDialogue
         JournalEntry entry(topicId, infoId, actor);
         entry.mActorName = actor.getClass().getName(actor);
         topic.addEntry (entry);
+        ++mRevision;
     }
 
     void Journal::removeLastAddedTopicResponse(const std::string &topicId, const std::string &actorName)
@@ -124,6 +129,7 @@ namespace MWDialogue
         Topic& topic = getTopic (topicId);
 
         topic.removeLastAddedResponse(actorName);
+        ++mRevision;
 
         if (topic.begin() == topic.end())
             mTopics.erase(mTopics.find(topicId)); // All responses removed -> remove topic
@@ -139,6 +145,11 @@ namespace MWDialogue
         return iter->second.getIndex();
     }
 
+    std::size_t Journal::getRevision() const
+    {
+        return mRevision;
+    }
+
     Journal::TEntryIter Journal::begin() const
     {
         return mJournal.begin();
@@ -243,6 +254,8 @@ namespace MWDialogue
             record.load (reader);
 
             if (isThere (record.mTopic, record.mInfo))
+            {
+                ++mRevision;
                 switch (record.mType)
                 {
                     case ESM::JournalEntry::Type_Quest:
@@ -260,6 +273,7 @@ namespace MWDialogue
                         getTopic (record.mTopic).insertEntry (record);
                         break;
                 }
+            }
         }
         else if (type==ESM::REC_QUES)
         {
@@ -268,6 +282,7 @@ namespace MWDialogue
 
             if (isThere (record.mTopic))
             {
+                ++mRevision;
                 std::pair<TQuestContainer::iterator, bool> result = mQuests.insert (std::make_pair (record.mTopic, record));
                 // reapply quest index, this is to handle users upgrading from only
                 // Morrowind.esm (no quest states) to Morrowind.esm + Tribunal.esm
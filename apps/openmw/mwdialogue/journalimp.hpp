@@ -13,6 +13,7 @@ namespace MWDialogue
             TEntryContainer mJournal;
             TQuestContainer mQuests;
             TTopicContainer mTopics;
+            std::size_t mRevision;
 
         private:
 
@@ -38,6 +39,9 @@ namespace MWDialogue
             int getJournalIndex (const std::string& id) const override;
             ///< Get the journal index.
 
+            std::size_t getRevision() const override;
+            ///< Returns a counter that changes whenever the journal content changes.
+
             void addTopic (const std::string& topicId, const std::string& infoId, const MWWorld::Ptr& actor) override;
             /// \note topicId must be lowercase
 
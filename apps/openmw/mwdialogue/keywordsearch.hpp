@@ -31,12 +31,56 @@ public:
         if (keyword.empty())
             return;
         seed_impl  (/*std::move*/ (keyword), /*std::move*/ (value), 0, mRoot);
+        mHighlightCache.clear ();
     }
 
     void clear ()
     {
         mRoot.mChildren.clear ();
         mRoot.mKeyword.clear ();
+        mHighlightCache.clear ();
+    }
+
+    /// Remove a single keyword so the search can be maintained incrementally
+    /// instead of being rebuilt whenever the keyword set shrinks.
+    /// \return whether the keyword was present
+    bool removeKeyword (const string_t& keyword)
+    {
+        if (keyword.empty())
+            return false;
+
+        // walk down to the entry holding the keyword, remembering the path
+        // so orphaned nodes can be pruned afterwards
+        std::vector<typename Entry::childen_t::iterator> path;
+        Entry* entry = &mRoot;
+        Entry* found = nullptr;
+        for (Point i = keyword.begin (); i != keyword.end (); ++i)
+        {
+            typename Entry::childen_t::iterator it = entry->mChildren.find (Misc::StringUtils::toLower (*i));
+            if (it == entry->mChildren.end ())
+                return false;
+            path.push_back (it);
+            entry = &it->second;
+            if (entry->mKeyword.size () && Misc::StringUtils::ciEqual (entry->mKeyword, keyword))
+            {
+                found = entry;
+                break;
+            }
+        }
+        if (!found)
+            return false;
+
+        found->mKeyword.clear ();
+        for (size_t depth = path.size (); depth-- > 0; )
+        {
+            Entry& node = path[depth]->second;
+            if (node.mKeyword.size () || !node.mChildren.empty ())
+                break;
+            typename Entry::childen_t& parent = depth ? path[depth-1]->second.mChildren : mRoot.mChildren;
+            parent.erase (path[depth]);
+        }
+        mHighlightCache.clear ();
+        return true;
     }
 
     bool containsKeyword (string_t keyword, value_t& value)
@@ -74,6 +118,43 @@ public:
     }
 
     void highlightKeywords (Point beg, Point end, std::vector<Match>& out)
+    {
+        // The same response is re-scanned every time the dialogue history or
+        // a journal page is re-typeset, so memoize the results (as offsets;
+        // the iterators only live as long as the caller's string) until the
+        // keyword set changes.
+        string_t text (beg, end);
+        typename std::map<string_t, std::vector<OffsetMatch> >::const_iterator cached = mHighlightCache.find (text);
+        if (cached != mHighlightCache.end ())
+        {
+            for (const OffsetMatch& match : cached->second)
+            {
+                Match result;
+                result.mBeg = beg + match.mBeg;
+                result.mEnd = beg + match.mEnd;
+                result.mValue = match.mValue;
+                out.push_back (result);
+            }
+            return;
+        }
+
+        size_t outStart = out.size ();
+        scanKeywords (beg, end, out);
+
+        if (mHighlightCache.size () >= sMaxCacheSize)
+            mHighlightCache.clear ();
+        std::vector<OffsetMatch>& store = mHighlightCache[std::move (text)];
+        for (size_t i = outStart; i < out.size (); ++i)
+        {
+            OffsetMatch match;
+            match.mBeg = out[i].mBeg - beg;
+            match.mEnd = out[i].mEnd - beg;
+            match.mValue = out[i].mValue;
+            store.push_back (match);
+        }
+    }
+
+    void scanKeywords (Point beg, Point end, std::vector<Match>& out)
     {
         std::vector<Match> matches;
         for (Point i = beg; i != end; ++i)
@@ -210,6 +291,15 @@ private:
         childen_t mChildren;
     };
 
+    struct OffsetMatch
+    {
+        size_t mBeg;
+        size_t mEnd;
+        value_t mValue;
+    };
+
+    static const size_t sMaxCacheSize = 256;
+
     void seed_impl (string_t keyword, value_t value, size_t depth, Entry  & entry)
     {
         int ch = Misc::StringUtils::toLower (keyword.at (depth));
@@ -241,7 +331,10 @@ private:
                 }
             }
             if (depth+1 == keyword.size())
-                j->second.mKeyword = value;
+            {
+                j->second.mKeyword = /*std::move*/ (keyword);
+                j->second.mValue = /*std::move*/ (value);
+            }
             else // depth+1 < keyword.size()
                 seed_impl (/*std::move*/ (keyword), /*std::move*/ (value), depth+1, j->second);
         }
@@ -249,6 +342,7 @@ private:
     }
 
     Entry mRoot;
+    std::map<string_t, std::vector<OffsetMatch> > mHighlightCache;
 };
 
 }
@@ -1,10 +1,6 @@
 #include "selectwrapper.hpp"
 
 #include <stdexcept>
-#include <sstream>
-#include <iterator>
-
-#include <components/misc/stringops.hpp>
 
 namespace
 {
@@ -43,11 +39,7 @@ namespace
 
 MWDialogue::SelectWrapper::Function MWDialogue::SelectWrapper::decodeFunction() const
 {
-    int index = 0;
-
-    std::istringstream (mSelect.mSelectRule.substr(2,2)) >> index;
-
-    switch (index)
+    switch (mSelect.mFunction)
     {
         case  0: return Function_RankLow;
         case  1: return Function_RankHigh;
@@ -94,29 +86,32 @@ MWDialogue::SelectWrapper::Function MWDialogue::SelectWrapper::decodeFunction()
     return Function_False;
 }
 
-MWDialogue::SelectWrapper::SelectWrapper (const ESM::DialInfo::SelectStruct& select) : mSelect (select) {}
-
-MWDialogue::SelectWrapper::Function MWDialogue::SelectWrapper::getFunction() const
+MWDialogue::SelectWrapper::SelectWrapper (const ESM::DialInfo::SelectStruct& select) : mSelect (select)
 {
     char type = mSelect.mSelectRule[1];
 
     switch (type)
     {
-        case '1': return decodeFunction();
-        case '2': return Function_Global;
-        case '3': return Function_Local;
-        case '4': return Function_Journal;
-        case '5': return Function_Item;
-        case '6': return Function_Dead;
-        case '7': return Function_NotId;
-        case '8': return Function_NotFaction;
-        case '9': return Function_NotClass;
-        case 'A': return Function_NotRace;
-        case 'B': return Function_NotCell;
-        case 'C': return Function_NotLocal;
+        case '1': mFunction = decodeFunction(); return;
+        case '2': mFunction = Function_Global; return;
+        case '3': mFunction = Function_Local; return;
+        case '4': mFunction = Function_Journal; return;
+        case '5': mFunction = Function_Item; return;
+        case '6': mFunction = Function_Dead; return;
+        case '7': mFunction = Function_NotId; return;
+        case '8': mFunction = Function_NotFaction; return;
+        case '9': mFunction = Function_NotClass; return;
+        case 'A': mFunction = Function_NotRace; return;
+        case 'B': mFunction = Function_NotCell; return;
+        case 'C': mFunction = Function_NotLocal; return;
     }
 
-    return Function_None;
+    mFunction = Function_None;
+}
+
+MWDialogue::SelectWrapper::Function MWDialogue::SelectWrapper::getFunction() const
+{
+    return mFunction;
 }
 
 int MWDialogue::SelectWrapper::getArgument() const
@@ -124,11 +119,7 @@ int MWDialogue::SelectWrapper::getArgument() const
     if (mSelect.mSelectRule[1]!='1')
         return 0;
 
-    int index = 0;
-
-    std::istringstream (mSelect.mSelectRule.substr(2,2)) >> index;
-
-    switch (index)
+    switch (mSelect.mFunction)
     {
         // AI settings
         case 67: return 1;
@@ -186,94 +177,70 @@ int MWDialogue::SelectWrapper::getArgument() const
 
 MWDialogue::SelectWrapper::Type MWDialogue::SelectWrapper::getType() const
 {
-    static const Function integerFunctions[] =
-    {
-        Function_Journal, Function_Item, Function_Dead,
-        Function_Choice,
-        Function_AiSetting,
-        Function_PcAttribute, Function_PcSkill,
-        Function_FriendlyHit,
-        Function_PcLevel, Function_PcGender, Function_PcClothingModifier,
-        Function_PcCrimeLevel,
-        Function_RankRequirement,
-        Function_Level, Function_PCReputation,
-        Function_Weather,
-        Function_Reputation, Function_FactionRankDiff,
-        Function_WerewolfKills,
-        Function_RankLow, Function_RankHigh,
-        Function_CreatureTargetted,
-        Function_None // end marker
-    };
-
-    static const Function numericFunctions[] =
+    switch (mFunction)
     {
-        Function_Global, Function_Local, Function_NotLocal,
-        Function_PcDynamicStat, Function_PcHealthPercent,
-        Function_HealthPercent,
-        Function_None // end marker
-    };
+        case Function_Journal: case Function_Item: case Function_Dead:
+        case Function_Choice:
+        case Function_AiSetting:
+        case Function_PcAttribute: case Function_PcSkill:
+        case Function_FriendlyHit:
+        case Function_PcLevel: case Function_PcGender: case Function_PcClothingModifier:
+        case Function_PcCrimeLevel:
+        case Function_RankRequirement:
+        case Function_Level: case Function_PCReputation:
+        case Function_Weather:
+        case Function_Reputation: case Function_FactionRankDiff:
+        case Function_WerewolfKills:
+        case Function_RankLow: case Function_RankHigh:
+        case Function_CreatureTargetted:
 
-    static const Function booleanFunctions[] =
-    {
-        Function_False,
-        Function_SameGender, Function_SameRace, Function_SameFaction,
-        Function_PcCommonDisease, Function_PcBlightDisease, Function_PcCorprus,
-        Function_PcExpelled,
-        Function_PcVampire, Function_TalkedToPc,
-        Function_Alarmed, Function_Detected,
-        Function_Attacked, Function_ShouldAttack,
-        Function_Werewolf,
-        Function_None // end marker
-    };
-
-    static const Function invertedBooleanFunctions[] =
-    {
-        Function_NotId, Function_NotFaction, Function_NotClass,
-        Function_NotRace, Function_NotCell,
-        Function_None // end marker
-    };
-
-    Function function = getFunction();
-
-    for (int i=0; integerFunctions[i]!=Function_None; ++i)
-        if (integerFunctions[i]==function)
             return Type_Integer;
 
-    for (int i=0; numericFunctions[i]!=Function_None; ++i)
-        if (numericFunctions[i]==function)
+        case Function_Global: case Function_Local: case Function_NotLocal:
+        case Function_PcDynamicStat: case Function_PcHealthPercent:
+        case Function_HealthPercent:
+
             return Type_Numeric;
 
-    for (int i=0; booleanFunctions[i]!=Function_None; ++i)
-        if (booleanFunctions[i]==function)
+        case Function_False:
+        case Function_SameGender: case Function_SameRace: case Function_SameFaction:
+        case Function_PcCommonDisease: case Function_PcBlightDisease: case Function_PcCorprus:
+        case Function_PcExpelled:
+        case Function_PcVampire: case Function_TalkedToPc:
+        case Function_Alarmed: case Function_Detected:
+        case Function_Attacked: case Function_ShouldAttack:
+        case Function_Werewolf:
+
             return Type_Boolean;
 
-    for (int i=0; invertedBooleanFunctions[i]!=Function_None; ++i)
-        if (invertedBooleanFunctions[i]==function)
+        case Function_NotId: case Function_NotFaction: case Function_NotClass:
+        case Function_NotRace: case Function_NotCell:
+
             return Type_Inverted;
 
-    return Type_None;
+        default:
+
+            return Type_None;
+    }
 }
 
 bool MWDialogue::SelectWrapper::isNpcOnly() const
 {
-    static const Function functions[] =
+    switch (mFunction)
     {
-        Function_NotFaction, Function_NotClass, Function_NotRace,
-        Function_SameGender, Function_SameRace, Function_SameFaction,
-        Function_RankRequirement,
-        Function_Reputation, Function_FactionRankDiff,
-        Function_Werewolf, Function_WerewolfKills,
-        Function_RankLow, Function_RankHigh,
-        Function_None // end marker
-    };
-
-    Function function = getFunction();
-
-    for (int i=0; functions[i]!=Function_None; ++i)
-        if (functions[i]==function)
+        case Function_NotFaction: case Function_NotClass: case Function_NotRace:
+        case Function_SameGender: case Function_SameRace: case Function_SameFaction:
+        case Function_RankRequirement:
+        case Function_Reputation: case Function_FactionRankDiff:
+        case Function_Werewolf: case Function_WerewolfKills:
+        case Function_RankLow: case Function_RankHigh:
+
             return true;
 
-    return false;
+        default:
+
+            return false;
+    }
 }
 
 bool MWDialogue::SelectWrapper::selectCompare (int value) const
@@ -291,7 +258,7 @@ bool MWDialogue::SelectWrapper::selectCompare (bool value) const
     return selectCompareImp (mSelect, static_cast<int> (value));
 }
 
-std::string MWDialogue::SelectWrapper::getName() const
+const std::string& MWDialogue::SelectWrapper::getName() const
 {
-    return Misc::StringUtils::lowerCase (mSelect.mSelectRule.substr (5));
+    return mSelect.mName;
 }
@@ -57,6 +57,8 @@ namespace MWDialogue
 
         private:
 
+            Function mFunction;
+
             Function decodeFunction() const;
 
         public:
@@ -78,7 +80,7 @@ namespace MWDialogue
 
             bool selectCompare (bool value) const;
 
-            std::string getName() const;
+            const std::string& getName() const;
             ///< Return case-smashed name.
     };
 }
@@ -1,5 +1,6 @@
 #include "bookpage.hpp"
 
+#include <map>
 #include <optional>
 
 #include "MyGUI_RenderItem.h"
@@ -68,12 +69,29 @@ struct TypesetBookImpl : TypesetBook
 
     typedef std::list <StyleImpl> Styles;
 
+    // A glyph quad positioned relative to the origin of its run.
+    struct LaidOutGlyph
+    {
+        MyGUI::FloatRect mRect;
+        MyGUI::FloatRect mUvRect;
+    };
+
+    typedef std::vector <LaidOutGlyph> GlyphLayout;
+
     struct Run
     {
         StyleImpl*  mStyle;
         Range       mRange;
         int         mLeft, mRight;
         int         mPrintableChars;
+
+        // Cached glyph layout, built on first render. A run's text, style and
+        // width are immutable once typeset, so the layout never needs to be
+        // rebuilt and every later frame or page turn emits the quads straight
+        // from this buffer instead of re-decoding the text and re-querying
+        // glyph metrics for each character.
+        mutable GlyphLayout mGlyphLayout;
+        mutable bool mGlyphLayoutBuilt;
     };
 
     typedef std::vector <Run> Runs;
@@ -251,6 +269,12 @@ struct TypesetBookImpl::Typesetter : BookTypesetter
     Book::Content const * mCurrentContent;
     Alignment mCurrentAlignment;
 
+    // Memoized glyph advances. Word wrapping measures every character of the
+    // source text, and journal pages repeat a small alphabet thousands of
+    // times, so a single metrics query per (font, code point) pair is enough.
+    typedef std::map <std::pair <MyGUI::IFont*, Utf8Stream::UnicodeChar>, int> AdvanceCache;
+    AdvanceCache mAdvanceCache;
+
     Typesetter (size_t width, size_t height) :
         mPageWidth (width), mPageHeight(height),
         mSection (nullptr), mLine (nullptr), mRun (nullptr),
@@ -506,9 +530,7 @@ struct TypesetBookImpl::Typesetter : BookTypesetter
 
             while (!stream.eof () && !ucsLineBreak (stream.peek ()) && ucsBreakingSpace (stream.peek ()))
             {
-                MWGui::GlyphInfo info = GlyphInfo(style->mFont, stream.peek());
-                if (info.charFound)
-                    space_width += static_cast<int>(info.advance + info.bearingX);
+                space_width += advanceWidth (style, stream.peek ());
                 stream.consume ();
             }
 
@@ -516,9 +538,7 @@ struct TypesetBookImpl::Typesetter : BookTypesetter
 
             while (!stream.eof () && !ucsLineBreak (stream.peek ()) && !ucsBreakingSpace (stream.peek ()))
             {
-                MWGui::GlyphInfo info = GlyphInfo(style->mFont, stream.peek());
-                if (info.charFound)
-                    word_width += static_cast<int>(info.advance + info.bearingX);
+                word_width += advanceWidth (style, stream.peek ());
                 stream.consume ();
             }
 
@@ -534,6 +554,20 @@ struct TypesetBookImpl::Typesetter : BookTypesetter
         }
     }
 
+    int advanceWidth (StyleImpl * style, Utf8Stream::UnicodeChar ch)
+    {
+        AdvanceCache::iterator i = mAdvanceCache.find (std::make_pair (style->mFont, ch));
+
+        if (i == mAdvanceCache.end ())
+        {
+            MWGui::GlyphInfo info = GlyphInfo(style->mFont, ch);
+            int width = info.charFound ? static_cast<int>(info.advance + info.bearingX) : 0;
+            i = mAdvanceCache.insert (std::make_pair (std::make_pair (style->mFont, ch), width)).first;
+        }
+
+        return i->second;
+    }
+
     void add_partial_text ()
     {
         if (mPartialWhitespace.empty() && mPartialWord.empty())
@@ -628,6 +662,7 @@ struct TypesetBookImpl::Typesetter : BookTypesetter
             mRun->mRange.first = begin;
             mRun->mRange.second = end;
             mRun->mPrintableChars = pc;
+            mRun->mGlyphLayoutBuilt = false;
           //Run->Locale = Locale;
         }
         else
@@ -763,37 +798,69 @@ namespace
             mCursor.top = mOrigin.top + top;
         }
 
-        void emitGlyph (wchar_t ch)
+        /// Emit the whole run as one batch of quads, using (and if necessary
+        /// building) the glyph layout cached on the run.
+        void emitRun (TypesetBookImpl::Run const & run)
         {
-            MWGui::GlyphInfo info = GlyphInfo(mFont, ch);
-
-            if (!info.charFound)
-                return;
+            if (!run.mGlyphLayoutBuilt)
+                buildGlyphLayout (run);
 
-            MyGUI::FloatRect vr;
-
-            vr.left = mCursor.left + info.bearingX;
-            vr.top = mCursor.top + info.bearingY;
-            vr.right = vr.left + info.width;
-            vr.bottom = vr.top + info.height;
+            for (TypesetBookImpl::GlyphLayout::const_iterator i = run.mGlyphLayout.begin (); i != run.mGlyphLayout.end (); ++i)
+            {
+                MyGUI::FloatRect vr = i->mRect;
 
-            MyGUI::FloatRect tr = info.uvRect;
+                vr.left   += mCursor.left;
+                vr.right  += mCursor.left;
+                vr.top    += mCursor.top;
+                vr.bottom += mCursor.top;
 
-            if (mRenderXform.clip (vr, tr))
-                quad (vr, tr);
+                MyGUI::FloatRect tr = i->mUvRect;
 
-            mCursor.left += static_cast<int>(info.bearingX + info.advance);
+                if (mRenderXform.clip (vr, tr))
+                    quad (vr, tr);
+            }
         }
 
-        void emitSpace (wchar_t ch)
+    private:
+
+        void buildGlyphLayout (TypesetBookImpl::Run const & run)
         {
-            MWGui::GlyphInfo info = GlyphInfo(mFont, ch);
+            float left = 0;
 
-            if (info.charFound)
-                mCursor.left += static_cast<int>(info.bearingX + info.advance);
-        }
+            run.mGlyphLayout.reserve (run.mPrintableChars);
 
-    private:
+            Utf8Stream stream (run.mRange);
+
+            while (!stream.eof ())
+            {
+                Utf8Stream::UnicodeChar code_point = stream.consume ();
+
+                if (ucsCarriageReturn (code_point))
+                    continue;
+
+                MWGui::GlyphInfo info = GlyphInfo(mFont, code_point);
+
+                if (!info.charFound)
+                    continue;
+
+                if (!ucsSpace (code_point))
+                {
+                    TypesetBookImpl::LaidOutGlyph glyph;
+
+                    glyph.mRect.left = left + info.bearingX;
+                    glyph.mRect.top = info.bearingY;
+                    glyph.mRect.right = glyph.mRect.left + info.width;
+                    glyph.mRect.bottom = glyph.mRect.top + info.height;
+                    glyph.mUvRect = info.uvRect;
+
+                    run.mGlyphLayout.push_back (glyph);
+                }
+
+                left += static_cast<int>(info.bearingX + info.advance);
+            }
+
+            run.mGlyphLayoutBuilt = true;
+        }
 
         void quad (const MyGUI::FloatRect& vr, const MyGUI::FloatRect& tr)
         {
@@ -1192,20 +1259,7 @@ public:
 
             glyphStream.reset(static_cast<float>(section.mRect.left + line.mRect.left + run.mLeft), static_cast<float>(line.mRect.top), colour);
 
-            Utf8Stream stream (run.mRange);
-
-            while (!stream.eof ())
-            {
-                Utf8Stream::UnicodeChar code_point = stream.consume ();
-
-                if (ucsCarriageReturn (code_point))
-                    continue;
-
-                if (!ucsSpace (code_point))
-                    glyphStream.emitGlyph (code_point);
-                else
-                    glyphStream.emitSpace (code_point);
-            }
+            glyphStream.emitRun (run);
         }
     };
 
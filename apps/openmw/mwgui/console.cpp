@@ -1,5 +1,8 @@
 #include "console.hpp"
 
+#include <algorithm>
+#include <string_view>
+
 #include <MyGUI_EditBox.h>
 #include <MyGUI_InputManager.h>
 #include <MyGUI_LayerManager.h>
@@ -13,6 +16,7 @@
 #include <components/compiler/scanner.hpp>
 #include <components/compiler/locals.hpp>
 #include <components/interpreter/interpreter.hpp>
+#include <components/misc/stringops.hpp>
 
 #include "../mwscript/extensions.hpp"
 
@@ -95,44 +99,52 @@ namespace MWGui
 
     void Console::listNames()
     {
-        if (mNames.empty())
-        {
-            // keywords
-            std::istringstream input ("");
+        const MWWorld::ESMStore& store =
+            MWBase::Environment::get().getWorld()->getStore();
 
-            Compiler::Scanner scanner (*this, input, mCompilerContext.getExtensions());
+        // Once built, the list only goes stale when dynamic records (e.g.
+        // player-made spells and enchantments) are added to the store.
+        if (!mNames.empty() && mNamesDynamicCount == store.getDynamicCount())
+            return;
 
-            scanner.listKeywords (mNames);
+        mNames.clear();
 
-            // identifier
-            const MWWorld::ESMStore& store =
-                MWBase::Environment::get().getWorld()->getStore();
+        // keywords
+        std::istringstream input ("");
 
-            for (MWWorld::ESMStore::iterator it = store.begin(); it != store.end(); ++it)
-            {
-                it->second->listIdentifier (mNames);
-            }
+        Compiler::Scanner scanner (*this, input, mCompilerContext.getExtensions());
 
-            // exterior cell names aren't technically identifiers, but since the COC function accepts them,
-            // we should list them too
-            for (MWWorld::Store<ESM::Cell>::iterator it = store.get<ESM::Cell>().extBegin();
-                 it != store.get<ESM::Cell>().extEnd(); ++it)
-            {
-                if (!it->mName.empty())
-                    mNames.push_back(it->mName);
-            }
+        scanner.listKeywords (mNames);
 
-            // sort
-            std::sort (mNames.begin(), mNames.end());
+        // identifier
+        for (MWWorld::ESMStore::iterator it = store.begin(); it != store.end(); ++it)
+        {
+            it->second->listIdentifier (mNames);
+        }
 
-            // remove duplicates
-            mNames.erase( std::unique( mNames.begin(), mNames.end() ), mNames.end() );
+        // exterior cell names aren't technically identifiers, but since the COC function accepts them,
+        // we should list them too
+        for (MWWorld::Store<ESM::Cell>::iterator it = store.get<ESM::Cell>().extBegin();
+             it != store.get<ESM::Cell>().extEnd(); ++it)
+        {
+            if (!it->mName.empty())
+                mNames.push_back(it->mName);
         }
+
+        // sort case-insensitively so that completions form contiguous ranges
+        std::sort (mNames.begin(), mNames.end(), Misc::StringUtils::ciLess);
+
+        // remove duplicates (also across case variants; they complete identically)
+        mNames.erase( std::unique( mNames.begin(), mNames.end(),
+            [] (const std::string& left, const std::string& right) { return Misc::StringUtils::ciEqual(left, right); } ), mNames.end() );
+
+        mNamesDynamicCount = store.getDynamicCount();
     }
 
     Console::Console(int w, int h, bool consoleOnlyScripts)
       : WindowBase("openmw_console.layout"),
         mCompilerContext (MWScript::CompilerContext::Type_Console),
+        mNamesDynamicCount (0),
         mConsoleOnlyScripts (consoleOnlyScripts)
     {
         setCoord(10,10, w-10, h/2);
@@ -406,28 +418,17 @@ namespace MWGui
             return input;
         }
 
-        /* Iterate through the vector. */
-        for(std::string& name : mNames)
+        /* The name list is sorted case-insensitively, so everything completing
+           the input forms one contiguous range that a binary search can find. */
+        std::vector<std::string>::const_iterator current =
+            std::lower_bound(mNames.begin(), mNames.end(), tmp, Misc::StringUtils::ciLess);
+        for(; current != mNames.end(); ++current)
         {
-            bool string_different=false;
-
-            /* Is the string shorter than the input string? If yes skip it. */
-            if(name.length() < tmp.length())
-                continue;
-
-            /* Is the beginning of the string different from the input string? If yes skip it. */
-            for( std::string::iterator iter=tmp.begin(), iter2=name.begin(); iter < tmp.end();++iter, ++iter2) {
-                if( Misc::StringUtils::toLower(*iter) != Misc::StringUtils::toLower(*iter2) ) {
-                    string_different=true;
-                    break;
-                }
-            }
-
-            if( string_different )
-                continue;
+            if( current->length() < tmp.length() ||
+                !Misc::StringUtils::ciEqual(tmp, std::string_view(current->data(), tmp.length())) )
+                break;
 
-            /* The beginning of the string matches the input string, save it for the next test. */
-            matches.push_back(name);
+            matches.push_back(*current);
         }
 
         /* There are no matches. Return the unchanged input. */
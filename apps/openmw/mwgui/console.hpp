@@ -77,6 +77,7 @@ namespace MWGui
             Compiler::Extensions mExtensions;
             MWScript::CompilerContext mCompilerContext;
             std::vector<std::string> mNames;
+            unsigned int mNamesDynamicCount;
             bool mConsoleOnlyScripts;
 
             bool compile (const std::string& cmd, Compiler::Output& output);
@@ -87,10 +88,10 @@ namespace MWGui
             /// Report a file related error
             void report (const std::string& message, Type type) override;
 
-            /// Write all valid identifiers and keywords into mNames and sort them.
-            /// \note If mNames is not empty, this function is a no-op.
-            /// \note The list may contain duplicates (if a name is a keyword and an identifier at the same
-            /// time).
+            /// Write all valid identifiers and keywords into mNames, sorted
+            /// case-insensitively so completion can binary search prefix ranges.
+            /// \note Once built, this function is a no-op until dynamic records
+            /// are added to the store.
             void listNames();
   };
 }
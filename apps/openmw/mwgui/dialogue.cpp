@@ -1,5 +1,7 @@
 #include "dialogue.hpp"
 
+#include <set>
+
 #include <MyGUI_LanguageManager.h>
 #include <MyGUI_Window.h>
 #include <MyGUI_ProgressBar.h>
@@ -501,10 +503,26 @@ namespace MWGui
     void DialogueWindow::updateTopicsPane()
     {
         mTopicsList->clear();
-        for (auto& linkPair : mTopicLinks)
-            mDeleteLater.push_back(linkPair.second);
-        mTopicLinks.clear();
-        mKeywordSearch.clear();
+
+        // Update the topic links and the keyword search incrementally: topics
+        // carry over between refreshes (and between conversations) almost
+        // unchanged, and reseeding a big trie from scratch on every refresh
+        // is expensive. Links for retained topics stay alive, so the seeded
+        // values remain valid too.
+        std::set<std::string> activeTopics;
+        for (const std::string& keyword : mKeywords)
+            activeTopics.insert(Misc::StringUtils::lowerCase(keyword));
+        for (auto it = mTopicLinks.begin(); it != mTopicLinks.end();)
+        {
+            if (activeTopics.count(it->first) == 0)
+            {
+                mKeywordSearch.removeKeyword(it->first);
+                mDeleteLater.push_back(it->second); // Links are not deleted right away to prevent issues with event handlers
+                it = mTopicLinks.erase(it);
+            }
+            else
+                ++it;
+        }
 
         int services = mPtr.getClass().getServices(mPtr);
 
@@ -550,6 +568,9 @@ namespace MWGui
             std::string topicId = Misc::StringUtils::lowerCase(keyword);
             mTopicsList->addItem(keyword);
 
+            if (mTopicLinks.find(topicId) != mTopicLinks.end())
+                continue;
+
             Topic* t = new Topic(keyword);
             t->eventTopicActivated += MyGUI::newDelegate(this, &DialogueWindow::onTopicActivated);
             mTopicLinks[topicId] = t;
@@ -141,9 +141,8 @@ namespace MWGui
         mFilterMagic->setStateSelected(false);
         mFilterMisc->setStateSelected(false);
 
-        mPreview->updatePtr(mPtr);
-        mPreview->rebuild();
-        mPreview->update();
+        if (mPreview->updatePtr(mPtr))
+            mPreview->rebuild();
 
         dirtyPreview();
 
@@ -658,6 +657,10 @@ namespace MWGui
     {
         updateEncumbranceBar();
 
+        // Apply a queued preview update, unless the player was cleared out under us (e.g. while loading a game)
+        if (!mPtr.isEmpty())
+            mPreview->onFrame();
+
         if (mPinned)
         {
             mUpdateTimer += dt;
@@ -93,27 +93,51 @@ void ItemView::layoutWidgets()
 
 void ItemView::update()
 {
-    while (mScrollView->getChildCount())
-        MyGUI::Gui::getInstance().destroyWidget(mScrollView->getChildAt(0));
-
     if (!mModel)
+    {
+        while (mScrollView->getChildCount())
+            MyGUI::Gui::getInstance().destroyWidget(mScrollView->getChildAt(0));
         return;
+    }
 
     mModel->update();
 
-    MyGUI::Widget* dragArea = mScrollView->createWidget<MyGUI::Widget>("",0,0,mScrollView->getWidth(),mScrollView->getHeight(),
-                                                                       MyGUI::Align::Stretch);
-    dragArea->setNeedMouseFocus(true);
-    dragArea->eventMouseButtonClick += MyGUI::newDelegate(this, &ItemView::onSelectedBackground);
-    dragArea->eventMouseWheel += MyGUI::newDelegate(this, &ItemView::onMouseWheelMoved);
+    MyGUI::Widget* dragArea;
+    if (mScrollView->getChildCount())
+        dragArea = mScrollView->getChildAt(0);
+    else
+    {
+        dragArea = mScrollView->createWidget<MyGUI::Widget>("",0,0,mScrollView->getWidth(),mScrollView->getHeight(),
+                                                            MyGUI::Align::Stretch);
+        dragArea->setNeedMouseFocus(true);
+        dragArea->eventMouseButtonClick += MyGUI::newDelegate(this, &ItemView::onSelectedBackground);
+        dragArea->eventMouseWheel += MyGUI::newDelegate(this, &ItemView::onMouseWheelMoved);
+    }
+
+    size_t itemCount = mModel->getItemCount();
 
-    for (ItemModel::ModelIndex i=0; i<static_cast<int>(mModel->getItemCount()); ++i)
+    // Reuse widgets from the previous update where possible; destroying and recreating
+    // one widget per item makes opening large inventories noticeably slow.
+    while (dragArea->getChildCount() > itemCount)
+        MyGUI::Gui::getInstance().destroyWidget(dragArea->getChildAt(dragArea->getChildCount()-1));
+
+    for (ItemModel::ModelIndex i=0; i<static_cast<int>(itemCount); ++i)
     {
         const ItemStack& item = mModel->getItem(i);
 
-        ItemWidget* itemWidget = dragArea->createWidget<ItemWidget>("MW_ItemIcon",
-            MyGUI::IntCoord(0, 0, 42, 42), MyGUI::Align::Default);
-        itemWidget->setUserString("ToolTipType", "ItemModelIndex");
+        ItemWidget* itemWidget;
+        if (static_cast<size_t>(i) < dragArea->getChildCount())
+            itemWidget = dragArea->getChildAt(i)->castType<ItemWidget>();
+        else
+        {
+            itemWidget = dragArea->createWidget<ItemWidget>("MW_ItemIcon",
+                MyGUI::IntCoord(0, 0, 42, 42), MyGUI::Align::Default);
+            itemWidget->setUserString("ToolTipType", "ItemModelIndex");
+
+            itemWidget->eventMouseButtonClick += MyGUI::newDelegate(this, &ItemView::onSelectedItem);
+            itemWidget->eventMouseWheel += MyGUI::newDelegate(this, &ItemView::onMouseWheelMoved);
+        }
+
         itemWidget->setUserData(std::make_pair(i, mModel));
         ItemWidget::ItemState state = ItemWidget::None;
         if (item.mType == ItemStack::Type_Barter)
@@ -122,9 +146,6 @@ void ItemView::update()
             state = ItemWidget::Equip;
         itemWidget->setItem(item.mBase, state);
         itemWidget->setCount(item.mCount);
-
-        itemWidget->eventMouseButtonClick += MyGUI::newDelegate(this, &ItemView::onSelectedItem);
-        itemWidget->eventMouseWheel += MyGUI::newDelegate(this, &ItemView::onMouseWheelMoved);
     }
 
     layoutWidgets();
@@ -23,12 +23,12 @@ struct JournalViewModelImpl : JournalViewModel
 {
     typedef MWDialogue::KeywordSearch <std::string, intptr_t> KeywordSearchT;
 
-    mutable bool             mKeywordSearchLoaded;
+    mutable std::size_t      mKeywordSearchRevision;
     mutable KeywordSearchT mKeywordSearch;
 
     JournalViewModelImpl ()
     {
-        mKeywordSearchLoaded = false;
+        mKeywordSearchRevision = static_cast<std::size_t> (-1);
     }
 
     virtual ~JournalViewModelImpl ()
@@ -52,20 +52,24 @@ struct JournalViewModelImpl : JournalViewModel
 
     void unload () override
     {
-        mKeywordSearch.clear ();
-        mKeywordSearchLoaded = false;
+        // The keyword search (and its match cache) is deliberately kept
+        // around; it stays valid until the journal revision moves on.
     }
 
     void ensureKeyWordSearchLoaded () const
     {
-        if (!mKeywordSearchLoaded)
+        MWBase::Journal * journal = MWBase::Environment::get().getJournal();
+
+        // Reseed when the journal changed: topics may have been added or
+        // removed, and the topic addresses seeded as values may be stale.
+        if (mKeywordSearchRevision != journal->getRevision ())
         {
-            MWBase::Journal * journal = MWBase::Environment::get().getJournal();
+            mKeywordSearch.clear ();
 
             for(MWBase::Journal::TTopicIter i = journal->topicBegin(); i != journal->topicEnd (); ++i)
                 mKeywordSearch.seed (i->first, intptr_t (&i->second));
 
-            mKeywordSearchLoaded = true;
+            mKeywordSearchRevision = journal->getRevision ();
         }
     }
 
@@ -76,6 +80,11 @@ struct JournalViewModelImpl : JournalViewModel
         return journal->begin () == journal->end ();
     }
 
+    std::size_t getRevision () const override
+    {
+        return MWBase::Environment::get().getJournal()->getRevision ();
+    }
+
     template <typename t_iterator, typename Interface>
     struct BaseEntry : Interface
     {
@@ -1,6 +1,7 @@
 #ifndef MWGUI_JOURNALVIEWMODEL_HPP
 #define MWGUI_JOURNALVIEWMODEL_HPP
 
+#include <cstddef>
 #include <string>
 #include <memory>
 #include <functional>
@@ -72,6 +73,10 @@ namespace MWGui
         /// returns true if their are no journal entries to display
         virtual bool isEmpty () const = 0;
 
+        /// returns a counter that changes whenever the journal content changes,
+        /// so views built from the model can be cached while it stands still
+        virtual std::size_t getRevision () const = 0;
+
         /// walks the active and optionally completed, quests providing the name and completed status
         virtual void visitQuestNames (bool active_only, std::function <void (const std::string&, bool)> visitor) const = 0;
 
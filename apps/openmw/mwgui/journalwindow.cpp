@@ -1,5 +1,6 @@
 #include "journalwindow.hpp"
 
+#include <map>
 #include <set>
 #include <stack>
 #include <string>
@@ -57,6 +58,14 @@ namespace
 
         DisplayStateStack mStates;
         Book mTopicIndexBook;
+
+        // Books are cached between opens and invalidated via the model
+        // revision, so reopening an unchanged journal costs nothing.
+        Book mJournalBook;
+        std::size_t mJournalBookRevision;
+        std::map <intptr_t, Book> mTopicBooks;
+        std::map <std::string, Book> mQuestBooks;
+
         bool mQuestMode;
         bool mOptionsMode;
         bool mTopicsMode;
@@ -220,6 +229,7 @@ namespace
                 }
             }
 
+            mJournalBookRevision = static_cast<std::size_t> (-1);
             mQuestMode = false;
             mAllQuests = false;
             mOptionsMode = false;
@@ -236,13 +246,22 @@ namespace
 
             setBookMode ();
 
-            Book journalBook;
-            if (mModel->isEmpty ())
-                journalBook = createEmptyJournalBook ();
-            else
-                journalBook = createJournalBook ();
+            // Typesetting the full journal is by far the most expensive part
+            // of opening the window on long-running games, so the books are
+            // kept until the journal actually changes.
+            if (!mJournalBook || mJournalBookRevision != mModel->getRevision ())
+            {
+                mJournalBookRevision = mModel->getRevision ();
+                mTopicBooks.clear ();
+                mQuestBooks.clear ();
+
+                if (mModel->isEmpty ())
+                    mJournalBook = createEmptyJournalBook ();
+                else
+                    mJournalBook = createJournalBook ();
+            }
 
-            pushBook (journalBook, 0);
+            pushBook (mJournalBook, 0);
 
             // fast forward to the last page
             if (!mStates.empty ())
@@ -401,7 +420,9 @@ namespace
 
         void notifyTopicClicked (intptr_t linkId)
         {
-            Book topicBook = createTopicBook (linkId);
+            Book & topicBook = mTopicBooks[linkId];
+            if (!topicBook)
+                topicBook = createTopicBook (linkId);
 
             if (mStates.size () > 1)
                 replaceBook (topicBook, 0);
@@ -433,7 +454,9 @@ namespace
 
         void notifyQuestClicked (const std::string& name, int id)
         {
-            Book book = createQuestBook (name);
+            Book & book = mQuestBooks[name];
+            if (!book)
+                book = createQuestBook (name);
 
             if (mStates.size () > 1)
                 replaceBook (book, 0);
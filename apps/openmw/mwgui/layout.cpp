@@ -1,11 +1,50 @@
 #include "layout.hpp"
 
+#include <map>
+#include <memory>
+
+#include <MyGUI_DataManager.h>
 #include <MyGUI_LayoutManager.h>
+#include <MyGUI_ResourceLayout.h>
+#include <MyGUI_XmlDocument.h>
 #include <MyGUI_Widget.h>
 #include <MyGUI_Gui.h>
 #include <MyGUI_TextBox.h>
 #include <MyGUI_Window.h>
 
+namespace
+{
+    // MyGUI::LayoutManager::loadLayout re-parses the layout XML on every call unless the
+    // layout is registered as a named resource. Layout files never change while the game
+    // runs and the same few layouts are instantiated over and over (tooltips, list rows,
+    // map markers), so parse each file once and create widgets from the cached resource.
+    MyGUI::VectorWidgetPtr loadLayoutCached(const std::string& layout, const std::string& prefix, MyGUI::Widget* parent)
+    {
+        static std::map<std::string, std::unique_ptr<MyGUI::ResourceLayout>> cache;
+
+        auto found = cache.find(layout);
+        if (found == cache.end())
+        {
+            MyGUI::IDataStream* data = MyGUI::DataManager::getInstance().getData(layout);
+            MyGUI::xml::Document doc;
+            bool loaded = data && doc.open(data);
+            if (data)
+                MyGUI::DataManager::getInstance().freeData(data);
+
+            std::string type;
+            MyGUI::xml::ElementPtr root = loaded ? doc.getRoot() : nullptr;
+            if (!root || root->getName() != "MyGUI" || !root->findAttribute("type", type) || type != "Layout")
+            {
+                // not a plain layout file; let the layout manager handle (and report) it
+                return MyGUI::LayoutManager::getInstance().loadLayout(layout, prefix, parent);
+            }
+
+            found = cache.emplace(layout, std::make_unique<MyGUI::ResourceLayout>(root, layout)).first;
+        }
+        return found->second->createLayout(prefix, parent);
+    }
+}
+
 namespace MWGui
 {
     void Layout::initialise(const std::string& _layout, MyGUI::Widget* _parent)
@@ -18,7 +57,7 @@ namespace MWGui
         else
         {
             mPrefix = MyGUI::utility::toString(this, "_");
-            mListWindowRoot = MyGUI::LayoutManager::getInstance().loadLayout(mLayoutName, mPrefix, _parent);
+            mListWindowRoot = loadLayoutCached(mLayoutName, mPrefix, _parent);
 
             const std::string main_name = mPrefix + MAIN_WINDOW;
             for (MyGUI::Widget* widget : mListWindowRoot)
@@ -323,6 +323,29 @@ namespace MWGui
         return markerWidget;
     }
 
+    MyGUI::ImageBox* LocalMapBase::getOrCreateMagicMarker(const MyGUI::IntCoord& coord, const MarkerUserData& markerPos)
+    {
+        MyGUI::ImageBox* markerWidget;
+        if (!mMagicMarkersToRecycle.empty())
+        {
+            markerWidget = static_cast<MyGUI::ImageBox*>(mMagicMarkersToRecycle.back());
+            mMagicMarkersToRecycle.pop_back();
+
+            *markerWidget->getUserData<MarkerUserData>() = markerPos;
+            markerWidget->setCoord(coord);
+            markerWidget->setVisible(true);
+        }
+        else
+        {
+            markerWidget = mLocalMap->createWidget<MyGUI::ImageBox>("ImageBox", coord, MyGUI::Align::Default);
+            markerWidget->setDepth(Local_MarkerAboveFogLayer);
+            markerWidget->setNeedMouseFocus(false);
+            markerWidget->setUserData(markerPos);
+        }
+        mMagicMarkerWidgets.push_back(markerWidget);
+        return markerWidget;
+    }
+
     void LocalMapBase::centerView()
     {
         MyGUI::IntPoint pos = mCompass->getPosition() + MyGUI::IntPoint{ 16, 16 };
@@ -536,14 +559,10 @@ namespace MWGui
             const ESM::Position& worldPos = ptr.getRefData().getPosition();
             MarkerUserData markerPos (mLocalMapRender);
             ++counter;
-            MyGUI::ImageBox* markerWidget = mLocalMap->createWidget<MyGUI::ImageBox>("ImageBox",
-                getMarkerCoordinates(worldPos.pos[0], worldPos.pos[1], markerPos, 8), MyGUI::Align::Default);
-            markerWidget->setDepth(Local_MarkerAboveFogLayer);
+            MyGUI::ImageBox* markerWidget = getOrCreateMagicMarker(
+                getMarkerCoordinates(worldPos.pos[0], worldPos.pos[1], markerPos, 8), markerPos);
             markerWidget->setImageTexture(markerTexture);
             markerWidget->setImageCoord(MyGUI::IntCoord(0,0,8,8));
-            markerWidget->setNeedMouseFocus(false);
-            markerWidget->setUserData(markerPos);
-            mMagicMarkerWidgets.push_back(markerWidget);
         }
     }
 
@@ -692,9 +711,14 @@ namespace MWGui
 
     void LocalMapBase::updateMagicMarkers()
     {
-        // clear all previous markers
+        // Hide the previous markers and hand them to the recycle pool instead of
+        // destroying them - this runs several times per second while a detection
+        // effect is active.
         for (MyGUI::Widget* widget : mMagicMarkerWidgets)
-            MyGUI::Gui::getInstance().destroyWidget(widget);
+        {
+            widget->setVisible(false);
+            mMagicMarkersToRecycle.push_back(widget);
+        }
         mMagicMarkerWidgets.clear();
 
         addDetectionMarkers(MWBase::World::Detect_Creature);
@@ -709,13 +733,9 @@ namespace MWGui
                 && (!mInterior || Misc::StringUtils::ciEqual(markedCell->getCell()->mName, mPrefix)))
         {
             MarkerUserData markerPos (mLocalMapRender);
-            MyGUI::ImageBox* markerWidget = mLocalMap->createWidget<MyGUI::ImageBox>("ImageBox",
-                getMarkerCoordinates(markedPosition.pos[0], markedPosition.pos[1], markerPos, 8), MyGUI::Align::Default);
-            markerWidget->setDepth(Local_MarkerAboveFogLayer);
+            MyGUI::ImageBox* markerWidget = getOrCreateMagicMarker(
+                getMarkerCoordinates(markedPosition.pos[0], markedPosition.pos[1], markerPos, 8), markerPos);
             markerWidget->setImageTexture("textures\\menu_map_smark.dds");
-            markerWidget->setNeedMouseFocus(false);
-            markerWidget->setUserData(markerPos);
-            mMagicMarkerWidgets.push_back(markerWidget);
         }
 
         redraw();
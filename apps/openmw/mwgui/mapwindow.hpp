@@ -154,6 +154,7 @@ namespace MWGui
         std::vector<MyGUI::Widget*> mMagicMarkerWidgets;
         std::vector<MyGUI::Widget*> mCustomMarkerWidgets;
         std::vector<MyGUI::Widget*> mDoorMarkersToRecycle;
+        std::vector<MyGUI::Widget*> mMagicMarkersToRecycle;
 
         std::vector<MyGUI::Widget*>& currentDoorMarkersWidgets();
 
@@ -165,6 +166,7 @@ namespace MWGui
         MyGUI::IntPoint getMarkerPosition (float worldX, float worldY, MarkerUserData& markerPos) const;
         MyGUI::IntCoord getMarkerCoordinates(float worldX, float worldY, MarkerUserData& markerPos, size_t markerSize) const;
         MyGUI::Widget* createDoorMarker(const std::string& name, const MyGUI::VectorString& notes, float x, float y) const;
+        MyGUI::ImageBox* getOrCreateMagicMarker(const MyGUI::IntCoord& coord, const MarkerUserData& markerPos);
         MyGUI::IntCoord getMarkerCoordinates(MyGUI::Widget* widget, size_t markerSize) const;
 
         virtual void notifyPlayerUpdate() {}
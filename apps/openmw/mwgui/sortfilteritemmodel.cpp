@@ -27,121 +27,123 @@
 
 namespace
 {
-    bool compareType(const std::string& type1, const std::string& type2)
+    int typeOrder(const std::string& type)
     {
         // this defines the sorting order of types. types that are first in the vector appear before other types.
-        std::vector<std::string> mapping;
-        mapping.emplace_back(typeid(ESM::Weapon).name() );
-        mapping.emplace_back(typeid(ESM::Armor).name() );
-        mapping.emplace_back(typeid(ESM::Clothing).name() );
-        mapping.emplace_back(typeid(ESM::Potion).name() );
-        mapping.emplace_back(typeid(ESM::Ingredient).name() );
-        mapping.emplace_back(typeid(ESM::Apparatus).name() );
-        mapping.emplace_back(typeid(ESM::Book).name() );
-        mapping.emplace_back(typeid(ESM::Light).name() );
-        mapping.emplace_back(typeid(ESM::Miscellaneous).name() );
-        mapping.emplace_back(typeid(ESM::Lockpick).name() );
-        mapping.emplace_back(typeid(ESM::Repair).name() );
-        mapping.emplace_back(typeid(ESM::Probe).name() );
-
-        assert( std::find(mapping.begin(), mapping.end(), type1) != mapping.end() );
-        assert( std::find(mapping.begin(), mapping.end(), type2) != mapping.end() );
-
-        return std::find(mapping.begin(), mapping.end(), type1) < std::find(mapping.begin(), mapping.end(), type2);
+        static const std::vector<std::string> mapping {
+            typeid(ESM::Weapon).name(),
+            typeid(ESM::Armor).name(),
+            typeid(ESM::Clothing).name(),
+            typeid(ESM::Potion).name(),
+            typeid(ESM::Ingredient).name(),
+            typeid(ESM::Apparatus).name(),
+            typeid(ESM::Book).name(),
+            typeid(ESM::Light).name(),
+            typeid(ESM::Miscellaneous).name(),
+            typeid(ESM::Lockpick).name(),
+            typeid(ESM::Repair).name(),
+            typeid(ESM::Probe).name()
+        };
+
+        std::vector<std::string>::const_iterator found = std::find(mapping.begin(), mapping.end(), type);
+        assert( found != mapping.end() );
+        return static_cast<int>(found - mapping.begin());
+    }
+
+    // All sort criteria of an item, precomputed once per item. This keeps the name
+    // normalization and the enchantment lookup out of the sort comparator.
+    struct SortKey
+    {
+        int mType;
+        int mTypeOrder;
+        std::string mName;
+        int mChargePercent;
+        bool mHasHealth;
+        float mHealth;
+        float mUsageTime;
+        int mValue;
+        float mWeight;
+        std::string mId;
+    };
+
+    SortKey makeSortKey(const MWGui::ItemStack& item)
+    {
+        const MWWorld::Ptr& base = item.mBase;
+
+        SortKey key;
+        key.mType = item.mType;
+        key.mTypeOrder = typeOrder(base.getTypeName());
+        key.mName = Misc::StringUtils::lowerCaseUtf8(base.getClass().getName(base));
+
+        // 1. enchanted items showed before non-enchanted
+        // 2. item with lesser charge percent comes after items with more charge percent
+        // 3. item with constant effect comes before items with non-constant effects
+        key.mChargePercent = -1;
+        std::string enchantmentId = base.getClass().getEnchantment(base);
+        if (!enchantmentId.empty())
+        {
+            const ESM::Enchantment* ench = MWBase::Environment::get().getWorld()->getStore().get<ESM::Enchantment>().search(enchantmentId);
+            if (ench)
+            {
+                if (ench->mData.mType == ESM::Enchantment::ConstantEffect)
+                    key.mChargePercent = 101;
+                else
+                    key.mChargePercent = static_cast<int>(base.getCellRef().getNormalizedEnchantmentCharge(ench->mData.mCharge) * 100);
+            }
+        }
+
+        key.mHasHealth = base.getClass().hasItemHealth(base);
+        key.mHealth = key.mHasHealth ? base.getClass().getItemHealth(base) : 0;
+        key.mUsageTime = base.getClass().getRemainingUsageTime(base);
+        key.mValue = base.getClass().getValue(base);
+        key.mWeight = base.getClass().getWeight(base);
+        key.mId = base.getCellRef().getRefId();
+        return key;
     }
 
     struct Compare
     {
         bool mSortByType;
         Compare() : mSortByType(true) {}
-        bool operator() (const MWGui::ItemStack& left, const MWGui::ItemStack& right)
+        bool operator() (const std::pair<SortKey, MWGui::ItemStack>& left, const std::pair<SortKey, MWGui::ItemStack>& right) const
         {
-            if (mSortByType && left.mType != right.mType)
-                return left.mType < right.mType;
+            const SortKey& l = left.first;
+            const SortKey& r = right.first;
 
-            float result = 0;
+            if (mSortByType && l.mType != r.mType)
+                return l.mType < r.mType;
 
             // compare items by type
-            std::string leftName = left.mBase.getTypeName();
-            std::string rightName = right.mBase.getTypeName();
-
-            if (leftName != rightName)
-                return compareType(leftName, rightName);
+            if (l.mTypeOrder != r.mTypeOrder)
+                return l.mTypeOrder < r.mTypeOrder;
 
             // compare items by name
-            leftName = Misc::StringUtils::lowerCaseUtf8(left.mBase.getClass().getName(left.mBase));
-            rightName = Misc::StringUtils::lowerCaseUtf8(right.mBase.getClass().getName(right.mBase));
-
-            result = leftName.compare(rightName);
+            int result = l.mName.compare(r.mName);
             if (result != 0)
                 return result < 0;
 
-            // compare items by enchantment:
-            // 1. enchanted items showed before non-enchanted
-            // 2. item with lesser charge percent comes after items with more charge percent
-            // 3. item with constant effect comes before items with non-constant effects
-            int leftChargePercent = -1;
-            int rightChargePercent = -1;
-            leftName = left.mBase.getClass().getEnchantment(left.mBase);
-            rightName = right.mBase.getClass().getEnchantment(right.mBase);
-
-            if (!leftName.empty())
-            {
-                const ESM::Enchantment* ench = MWBase::Environment::get().getWorld()->getStore().get<ESM::Enchantment>().search(leftName);
-                if (ench)
-                {
-                    if (ench->mData.mType == ESM::Enchantment::ConstantEffect)
-                        leftChargePercent = 101;
-                    else
-                        leftChargePercent = static_cast<int>(left.mBase.getCellRef().getNormalizedEnchantmentCharge(ench->mData.mCharge) * 100);
-                }
-            }
-
-            if (!rightName.empty())
-            {
-                const ESM::Enchantment* ench = MWBase::Environment::get().getWorld()->getStore().get<ESM::Enchantment>().search(rightName);
-                if (ench)
-                {
-                    if (ench->mData.mType == ESM::Enchantment::ConstantEffect)
-                        rightChargePercent = 101;
-                    else
-                        rightChargePercent = static_cast<int>(right.mBase.getCellRef().getNormalizedEnchantmentCharge(ench->mData.mCharge) * 100);
-                }
-            }
-
-            result = leftChargePercent - rightChargePercent;
-            if (result != 0)
-                return result > 0;
+            // compare items by enchantment charge (see makeSortKey)
+            if (l.mChargePercent != r.mChargePercent)
+                return l.mChargePercent > r.mChargePercent;
 
             // compare items by condition
-            if (left.mBase.getClass().hasItemHealth(left.mBase) && right.mBase.getClass().hasItemHealth(right.mBase))
-            {
-                result = left.mBase.getClass().getItemHealth(left.mBase) - right.mBase.getClass().getItemHealth(right.mBase);
-                if (result != 0)
-                    return result > 0;
-            }
+            if (l.mHasHealth && r.mHasHealth && l.mHealth != r.mHealth)
+                return l.mHealth > r.mHealth;
 
             // compare items by remaining usage time
-            result = left.mBase.getClass().getRemainingUsageTime(left.mBase) - right.mBase.getClass().getRemainingUsageTime(right.mBase);
-            if (result != 0)
-                return result > 0;
+            if (l.mUsageTime != r.mUsageTime)
+                return l.mUsageTime > r.mUsageTime;
 
             // compare items by value
-            result = left.mBase.getClass().getValue(left.mBase) - right.mBase.getClass().getValue(right.mBase);
-            if (result != 0)
-                return result > 0;
+            if (l.mValue != r.mValue)
+                return l.mValue > r.mValue;
 
             // compare items by weight
-            result = left.mBase.getClass().getWeight(left.mBase) - right.mBase.getClass().getWeight(right.mBase);
-            if (result != 0)
-                return result > 0;
+            if (l.mWeight != r.mWeight)
+                return l.mWeight > r.mWeight;
 
             // compare items by Id
-            leftName = left.mBase.getCellRef().getRefId();
-            rightName = right.mBase.getCellRef().getRefId();
-
-            result = leftName.compare(rightName);
-            return result < 0;
+            return l.mId.compare(r.mId) < 0;
         }
     };
 }
@@ -149,8 +151,23 @@ namespace
 namespace MWGui
 {
 
+    SortFilterItemModel::SourceItem::SourceItem(const ItemStack& item)
+        : mItem(item)
+        , mCharge(item.mBase.getCellRef().getChargeFloat())
+        , mEnchantmentCharge(item.mBase.getCellRef().getEnchantmentCharge())
+    {
+    }
+
+    bool SortFilterItemModel::SourceItem::operator==(const SourceItem& other) const
+    {
+        return mItem.mType == other.mItem.mType && mItem.mFlags == other.mItem.mFlags
+                && mItem.mCount == other.mItem.mCount && mItem.mBase == other.mItem.mBase
+                && mCharge == other.mCharge && mEnchantmentCharge == other.mEnchantmentCharge;
+    }
+
     SortFilterItemModel::SortFilterItemModel(ItemModel *sourceModel)
-        : mCategory(Category_All)
+        : mFilterChanged(true)
+        , mCategory(Category_All)
         , mFilter(0)
         , mSortByType(true)
         , mNameFilter("")
@@ -167,11 +184,16 @@ namespace MWGui
     void SortFilterItemModel::addDragItem (const MWWorld::Ptr& dragItem, size_t count)
     {
         mDragItems.emplace_back(dragItem, count);
+        mFilterChanged = true;
     }
 
     void SortFilterItemModel::clearDragItems()
     {
-        mDragItems.clear();
+        if (!mDragItems.empty())
+        {
+            mDragItems.clear();
+            mFilterChanged = true;
+        }
     }
 
     bool SortFilterItemModel::filterAccepts (const ItemStack& item)
@@ -308,22 +330,40 @@ namespace MWGui
 
     void SortFilterItemModel::setCategory (int category)
     {
-        mCategory = category;
+        if (mCategory != category)
+        {
+            mCategory = category;
+            mFilterChanged = true;
+        }
     }
 
     void SortFilterItemModel::setFilter (int filter)
     {
-        mFilter = filter;
+        if (mFilter != filter)
+        {
+            mFilter = filter;
+            mFilterChanged = true;
+        }
     }
 
     void SortFilterItemModel::setNameFilter (const std::string& filter)
     {
-        mNameFilter = Misc::StringUtils::lowerCaseUtf8(filter);
+        std::string lowerCase = Misc::StringUtils::lowerCaseUtf8(filter);
+        if (mNameFilter != lowerCase)
+        {
+            mNameFilter = std::move(lowerCase);
+            mFilterChanged = true;
+        }
     }
 
     void SortFilterItemModel::setEffectFilter (const std::string& filter)
     {
-        mEffectFilter = Misc::StringUtils::lowerCaseUtf8(filter);
+        std::string lowerCase = Misc::StringUtils::lowerCaseUtf8(filter);
+        if (mEffectFilter != lowerCase)
+        {
+            mEffectFilter = std::move(lowerCase);
+            mFilterChanged = true;
+        }
     }
 
     void SortFilterItemModel::update()
@@ -332,10 +372,23 @@ namespace MWGui
 
         size_t count = mSourceModel->getItemCount();
 
-        mItems.clear();
+        std::vector<SourceItem> sourceItems;
+        sourceItems.reserve(count);
         for (size_t i=0; i<count; ++i)
+            sourceItems.emplace_back(mSourceModel->getItem(i));
+
+        // Neither the source model nor any filter setting changed since the last
+        // update, so the sorted list (and with it all model indices) is still valid.
+        if (!mFilterChanged && sourceItems == mSourceItems)
+            return;
+
+        mSourceItems = std::move(sourceItems);
+        mFilterChanged = false;
+
+        std::vector<std::pair<SortKey, ItemStack> > items;
+        for (const SourceItem& sourceItem : mSourceItems)
         {
-            ItemStack item = mSourceModel->getItem(i);
+            ItemStack item = sourceItem.mItem;
 
             for (std::vector<std::pair<MWWorld::Ptr, size_t> >::iterator it = mDragItems.begin(); it != mDragItems.end(); ++it)
             {
@@ -348,12 +401,17 @@ namespace MWGui
             }
 
             if (item.mCount > 0 && filterAccepts(item))
-                mItems.push_back(item);
+                items.emplace_back(makeSortKey(item), item);
         }
 
         Compare cmp;
         cmp.mSortByType = mSortByType;
-        std::sort(mItems.begin(), mItems.end(), cmp);
+        std::sort(items.begin(), items.end(), cmp);
+
+        mItems.clear();
+        mItems.reserve(items.size());
+        for (std::pair<SortKey, ItemStack>& item : items)
+            mItems.push_back(std::move(item.second));
     }
 
     void SortFilterItemModel::onClose()
@@ -29,7 +29,14 @@ namespace MWGui
         void setEffectFilter (const std::string& filter);
 
         /// Use ItemStack::Type for sorting?
-        void setSortByType(bool sort) { mSortByType = sort; }
+        void setSortByType(bool sort)
+        {
+            if (mSortByType != sort)
+            {
+                mSortByType = sort;
+                mFilterChanged = true;
+            }
+        }
 
         void onClose() override;
         bool onDropItem(const MWWorld::Ptr &item, int count) override;
@@ -52,8 +59,26 @@ namespace MWGui
 
 
     private:
+        /// An item of the source model plus the mutable item state that influences
+        /// filtering and sorting, as seen during the last update.
+        struct SourceItem
+        {
+            SourceItem (const ItemStack& item);
+
+            bool operator== (const SourceItem& other) const;
+
+            ItemStack mItem;
+            float mCharge;
+            float mEnchantmentCharge;
+        };
+
         std::vector<ItemStack> mItems;
 
+        // Snapshot of the source model from the last update. As long as it is unchanged
+        // and no filter setting was touched, mItems is still valid.
+        std::vector<SourceItem> mSourceItems;
+        bool mFilterChanged;
+
         std::vector<std::pair<MWWorld::Ptr, size_t> > mDragItems;
 
         int mCategory;
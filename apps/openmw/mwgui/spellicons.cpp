@@ -168,8 +168,11 @@ namespace MWGui
                 else
                     image = mWidgetMap[effectId];
 
-                image->setPosition(w,2);
-                image->setVisible(true);
+                // don't push unchanged properties to MyGUI; this runs every frame
+                if (image->getPosition() != MyGUI::IntPoint(w, 2))
+                    image->setPosition(w,2);
+                if (!image->getVisible())
+                    image->setVisible(true);
                 w += 16;
 
                 ToolTipInfo* tooltipInfo = image->getUserData<ToolTipInfo>();
@@ -182,8 +185,11 @@ namespace MWGui
             else if (mWidgetMap.find(effectId) != mWidgetMap.end())
             {
                 MyGUI::ImageBox* image = mWidgetMap[effectId];
-                image->setVisible(false);
-                image->setAlpha(1.f);
+                if (image->getVisible())
+                {
+                    image->setVisible(false);
+                    image->setAlpha(1.f);
+                }
             }
         }
 
@@ -193,14 +199,17 @@ namespace MWGui
             if (effects.empty())
                 s = 0;
             int diff = parent->getWidth() - s;
-            parent->setSize(s, parent->getHeight());
-            parent->setPosition(parent->getLeft()+diff, parent->getTop());
+            if (diff != 0)
+            {
+                parent->setSize(s, parent->getHeight());
+                parent->setPosition(parent->getLeft()+diff, parent->getTop());
+            }
         }
 
         // hide inactive effects
         for (auto& widgetPair : mWidgetMap)
         {
-            if (effects.find(widgetPair.first) == effects.end())
+            if (widgetPair.second->getVisible() && effects.find(widgetPair.first) == effects.end())
                 widgetPair.second->setVisible(false);
         }
     }
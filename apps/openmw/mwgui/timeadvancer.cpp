@@ -63,6 +63,11 @@ namespace MWGui
         return mHours;
     }
 
+    int TimeAdvancer::getCurrentHour() const
+    {
+        return mCurHour;
+    }
+
     bool TimeAdvancer::isRunning() const
     {
         return mRunning;
@@ -15,6 +15,7 @@ namespace MWGui
             void onFrame(float dt);
 
             int getHours() const;
+            int getCurrentHour() const;
             bool isRunning() const;
 
             // signals
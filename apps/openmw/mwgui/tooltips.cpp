@@ -7,6 +7,7 @@
 #include <MyGUI_InputManager.h>
 #include <MyGUI_ImageBox.h>
 
+#include <components/misc/hash.hpp>
 #include <components/settings/settings.hpp>
 #include <components/widgets/box.hpp>
 
@@ -33,6 +34,7 @@ namespace MWGui
         Layout("openmw_tooltips.layout")
         , mFocusToolTipX(0.0)
         , mFocusToolTipY(0.0)
+        , mLastToolTipHash(0)
         , mHorizontalScrollIndex(0)
         , mDelay(0.0)
         , mRemainingDelay(0.0)
@@ -75,12 +77,6 @@ namespace MWGui
 
     void ToolTips::update(float frameDuration)
     {
-
-        while (mDynamicToolTipBox->getChildCount())
-        {
-            MyGUI::Gui::getInstance().destroyWidget(mDynamicToolTipBox->getChildAt(0));
-        }
-
         // start by hiding everything
         for (unsigned int i=0; i < mMainWidget->getChildCount(); ++i)
         {
@@ -395,11 +391,59 @@ namespace MWGui
     MyGUI::IntSize ToolTips::createToolTip(const MWGui::ToolTipInfo& info, bool isOwned)
     {
         mDynamicToolTipBox->setVisible(true);
-        
-        if((mShowOwned == 1 || mShowOwned == 3) && isOwned)
-            mDynamicToolTipBox->changeWidgetSkin(MWBase::Environment::get().getWindowManager()->isGuiMode() ? "HUD_Box_NoTransp_Owned" : "HUD_Box_Owned");
+
+        bool ownedSkin = (mShowOwned == 1 || mShowOwned == 3) && isOwned;
+        bool guiMode = MWBase::Environment::get().getWindowManager()->isGuiMode();
+
+        // Creating the widgets and measuring their text is expensive, so reuse the previous
+        // layout if the content is unchanged. Hashing the inputs covers every dynamic bit of
+        // state (counts, charges, ownership...) without having to track it per object.
+        // Note that an animated caption scroll advances mHorizontalScrollIndex on every
+        // rebuild, so such tooltips keep rebuilding as they must.
+        std::size_t hash = 0;
+        Misc::hashCombine(hash, info.caption);
+        Misc::hashCombine(hash, info.text);
+        Misc::hashCombine(hash, info.icon);
+        Misc::hashCombine(hash, info.imageSize);
+        Misc::hashCombine(hash, info.enchant);
+        Misc::hashCombine(hash, info.remainingEnchantCharge);
+        Misc::hashCombine(hash, info.isPotion);
+        Misc::hashCombine(hash, info.isIngredient);
+        Misc::hashCombine(hash, info.wordWrap);
+        for (const std::string& note : info.notes)
+            Misc::hashCombine(hash, note);
+        for (const Widgets::SpellEffectParams& params : info.effects)
+        {
+            Misc::hashCombine(hash, params.mEffectID);
+            Misc::hashCombine(hash, params.mSkill);
+            Misc::hashCombine(hash, params.mAttribute);
+            Misc::hashCombine(hash, params.mMagnMin);
+            Misc::hashCombine(hash, params.mMagnMax);
+            Misc::hashCombine(hash, params.mRange);
+            Misc::hashCombine(hash, params.mDuration);
+            Misc::hashCombine(hash, params.mArea);
+            Misc::hashCombine(hash, params.mNoTarget);
+            Misc::hashCombine(hash, params.mIsConstant);
+            Misc::hashCombine(hash, params.mNoMagnitude);
+            Misc::hashCombine(hash, params.mKnown);
+        }
+        Misc::hashCombine(hash, ownedSkin);
+        Misc::hashCombine(hash, guiMode);
+        Misc::hashCombine(hash, mHorizontalScrollIndex);
+        Misc::hashCombine(hash, MyGUI::RenderManager::getInstance().getViewSize().width);
+
+        if (hash == mLastToolTipHash && mDynamicToolTipBox->getChildCount() > 0)
+            return mLastToolTipSize;
+
+        while (mDynamicToolTipBox->getChildCount())
+        {
+            MyGUI::Gui::getInstance().destroyWidget(mDynamicToolTipBox->getChildAt(0));
+        }
+
+        if(ownedSkin)
+            mDynamicToolTipBox->changeWidgetSkin(guiMode ? "HUD_Box_NoTransp_Owned" : "HUD_Box_Owned");
         else
-            mDynamicToolTipBox->changeWidgetSkin(MWBase::Environment::get().getWindowManager()->isGuiMode() ? "HUD_Box_NoTransp" : "HUD_Box");
+            mDynamicToolTipBox->changeWidgetSkin(guiMode ? "HUD_Box_NoTransp" : "HUD_Box");
 
         std::string caption = info.caption;
         std::string image = info.icon;
@@ -588,6 +632,9 @@ namespace MWGui
 
         totalSize += MyGUI::IntSize(padding.left*2, padding.top*2);
 
+        mLastToolTipHash = hash;
+        mLastToolTipSize = totalSize;
+
         return totalSize;
     }
 
@@ -115,6 +115,11 @@ namespace MWGui
         ///< @return requested tooltip size
         /// @param isFocusObject Is the object this tooltips originates from mFocusObject?
 
+        // Hash of the content the dynamic tooltip was last built from, and its laid-out size.
+        // While the content doesn't change the widgets are reused instead of being rebuilt.
+        std::size_t mLastToolTipHash;
+        MyGUI::IntSize mLastToolTipSize;
+
         float mFocusToolTipX;
         float mFocusToolTipY;
 
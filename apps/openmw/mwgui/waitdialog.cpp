@@ -51,6 +51,7 @@ namespace MWGui
         : WindowBase("openmw_wait_dialog.layout")
         , mTimeAdvancer(0.05f)
         , mSleeping(false)
+        , mTimeSimulated(false)
         , mHours(1)
         , mManualHours(1)
         , mFadeTimeRemaining(0)
@@ -178,6 +179,7 @@ namespace MWGui
         setVisible(false);
 
         mHours = hoursToWait;
+        mTimeSimulated = false;
 
         // FIXME: move this somewhere else?
         mInterruptAt = -1;
@@ -236,16 +238,24 @@ namespace MWGui
     void WaitDialog::onWaitingProgressChanged(int cur, int total)
     {
         mProgressBar.setProgress(cur, total);
-        MWBase::Environment::get().getMechanicsManager()->rest(1, mSleeping);
-        MWBase::Environment::get().getWorld()->advanceTime(1);
+    }
 
-        MWWorld::Ptr player = MWBase::Environment::get().getWorld()->getPlayerPtr();
-        if (player.getClass().getCreatureStats(player).isDead())
-            stopWaiting();
+    void WaitDialog::simulatePassedTime(int hours)
+    {
+        if (mTimeSimulated || hours <= 0)
+            return;
+        mTimeSimulated = true;
+
+        // A single multi-hour pass is equivalent to stepping the simulation hour by hour:
+        // stat restoration, magic effect durations and item recharge all scale with the
+        // elapsed duration, and the AI fast-forward runs once per rest either way.
+        MWBase::Environment::get().getMechanicsManager()->rest(hours, mSleeping);
+        MWBase::Environment::get().getWorld()->advanceTime(hours);
     }
 
     void WaitDialog::onWaitingInterrupted()
     {
+        simulatePassedTime(mInterruptAt);
         MWBase::Environment::get().getWindowManager()->messageBox("#{sSleepInterrupt}");
         MWBase::Environment::get().getWorld()->spawnRandomCreature(mInterruptCreatureList);
         stopWaiting();
@@ -253,9 +263,13 @@ namespace MWGui
 
     void WaitDialog::onWaitingFinished()
     {
+        simulatePassedTime(mHours);
         stopWaiting();
 
         MWWorld::Ptr player = MWMechanics::getPlayer();
+        if (player.getClass().getCreatureStats(player).isDead())
+            return;
+
         const MWMechanics::NpcStats &pcstats = player.getClass().getNpcStats(player);
 
         // trigger levelup if possible
@@ -318,6 +332,10 @@ namespace MWGui
 
     void WaitDialog::wakeUp ()
     {
+        // Advance the hours slept so far before mSleeping is reset, so they still
+        // count as sleep for the purposes of stat restoration.
+        if (mTimeAdvancer.isRunning())
+            simulatePassedTime(mTimeAdvancer.getCurrentHour());
         mSleeping = false;
         if (mInterruptAt != -1)
             onWaitingInterrupted();
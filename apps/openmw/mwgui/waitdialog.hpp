@@ -54,6 +54,7 @@ namespace MWGui
 
         TimeAdvancer mTimeAdvancer;
         bool mSleeping;
+        bool mTimeSimulated;
         int mHours;
         int mManualHours; // stores the hours to rest selected via slider
         float mFadeTimeRemaining;
@@ -77,6 +78,7 @@ namespace MWGui
 
         void startWaiting(int hoursToWait);
         void stopWaiting();
+        void simulatePassedTime(int hours);
     };
 
 }
@@ -133,6 +133,8 @@ namespace MWGui
       , mWorkQueue(workQueue)
       , mViewer(viewer)
       , mConsoleOnlyScripts(consoleOnlyScripts)
+      , mSelectedWeaponPercent(-1)
+      , mSelectedSpellPercent(-1)
       , mCurrentModals()
       , mHud(nullptr)
       , mMap(nullptr)
@@ -1252,7 +1254,10 @@ namespace MWGui
 
     void WindowManager::setSelectedSpell(const std::string& spellId, int successChancePercent)
     {
+        if (spellId == mSelectedSpell && successChancePercent == mSelectedSpellPercent)
+            return; // this is polled every frame, only refresh the widgets on a change
         mSelectedSpell = spellId;
+        mSelectedSpellPercent = successChancePercent;
         mSelectedEnchantItem = MWWorld::Ptr();
         mHud->setSelectedSpell(spellId, successChancePercent);
 
@@ -1263,12 +1268,15 @@ namespace MWGui
 
     void WindowManager::setSelectedEnchantItem(const MWWorld::Ptr& item)
     {
-        mSelectedEnchantItem = item;
-        mSelectedSpell = "";
         const ESM::Enchantment* ench = mStore->get<ESM::Enchantment>()
                 .find(item.getClass().getEnchantment(item));
 
         int chargePercent = static_cast<int>(item.getCellRef().getNormalizedEnchantmentCharge(ench->mData.mCharge) * 100);
+        if (item == mSelectedEnchantItem && chargePercent == mSelectedSpellPercent)
+            return; // this is polled every frame, only refresh the widgets on a change
+        mSelectedEnchantItem = item;
+        mSelectedSpellPercent = chargePercent;
+        mSelectedSpell = "";
         mHud->setSelectedEnchantItem(item, chargePercent);
         mSpellWindow->setTitle(item.getClass().getName(item));
     }
@@ -1280,12 +1288,15 @@ namespace MWGui
 
     void WindowManager::setSelectedWeapon(const MWWorld::Ptr& item)
     {
-        mSelectedWeapon = item;
         int durabilityPercent = 100;
         if (item.getClass().hasItemHealth(item))
         {
             durabilityPercent = static_cast<int>(item.getClass().getItemNormalizedHealth(item) * 100);
         }
+        if (item == mSelectedWeapon && durabilityPercent == mSelectedWeaponPercent)
+            return; // this is polled every frame, only refresh the widgets on a change
+        mSelectedWeapon = item;
+        mSelectedWeaponPercent = durabilityPercent;
         mHud->setSelectedWeapon(item, durabilityPercent);
         mInventoryWindow->setTitle(item.getClass().getName(item));
     }
@@ -1297,7 +1308,10 @@ namespace MWGui
 
     void WindowManager::unsetSelectedSpell()
     {
+        if (mSelectedSpell.empty() && mSelectedEnchantItem.isEmpty() && mSelectedSpellPercent == -2)
+            return; // this is polled every frame, only refresh the widgets on a change
         mSelectedSpell = "";
+        mSelectedSpellPercent = -2;
         mSelectedEnchantItem = MWWorld::Ptr();
         mHud->unsetSelectedSpell();
 
@@ -1310,7 +1324,10 @@ namespace MWGui
 
     void WindowManager::unsetSelectedWeapon()
     {
+        if (mSelectedWeapon.isEmpty() && mSelectedWeaponPercent == -2)
+            return; // this is polled every frame, only refresh the widgets on a change
         mSelectedWeapon = MWWorld::Ptr();
+        mSelectedWeaponPercent = -2;
         mHud->unsetSelectedWeapon();
         mInventoryWindow->setTitle("#{sSkillHandtohand}");
     }
@@ -1670,6 +1687,10 @@ namespace MWGui
         mToolTips->clear();
 
         mSelectedSpell.clear();
+        mSelectedEnchantItem = MWWorld::Ptr();
+        mSelectedWeapon = MWWorld::Ptr();
+        mSelectedWeaponPercent = -1;
+        mSelectedSpellPercent = -1;
         mCustomMarkers.clear();
 
         mForceHidden = GW_None;
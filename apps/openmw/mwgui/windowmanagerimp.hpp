@@ -412,6 +412,13 @@ namespace MWGui
     std::string mSelectedSpell;
     MWWorld::Ptr mSelectedEnchantItem;
     MWWorld::Ptr mSelectedWeapon;
+    // The percentages last pushed to the HUD for the current selections; -1 if nothing was
+    // pushed yet, -2 if an empty selection was pushed. The setters are polled every frame
+    // and skip the widget updates when neither the selection nor its percentage changed.
+    // The spell slot holds either a spell's success chance or an enchanted item's charge,
+    // whichever is selected.
+    int mSelectedWeaponPercent;
+    int mSelectedSpellPercent;
 
     std::vector<WindowModal*> mCurrentModals;
 
@@ -11,16 +11,17 @@
 namespace MWInput
 {
     SensorManager::SensorManager()
-        : mInvertX(Settings::Manager::getBool("invert x axis", "Input"))
-        , mInvertY(Settings::Manager::getBool("invert y axis", "Input"))
+        : mInvertX("invert x axis", "Input")
+        , mInvertY("invert y axis", "Input")
+        , mGyroscopeEnabled("enable gyroscope", "Input")
         , mGyroXSpeed(0.f)
         , mGyroYSpeed(0.f)
         , mGyroUpdateTimer(0.f)
-        , mGyroHSensitivity(Settings::Manager::getFloat("gyro horizontal sensitivity", "Input"))
-        , mGyroVSensitivity(Settings::Manager::getFloat("gyro vertical sensitivity", "Input"))
+        , mGyroHSensitivity("gyro horizontal sensitivity", "Input")
+        , mGyroVSensitivity("gyro vertical sensitivity", "Input")
         , mGyroHAxis(GyroscopeAxis::Minus_X)
         , mGyroVAxis(GyroscopeAxis::Y)
-        , mGyroInputThreshold(Settings::Manager::getFloat("gyro input threshold", "Input"))
+        , mGyroInputThreshold("gyro input threshold", "Input")
         , mGyroscope(nullptr)
         , mGuiCursorEnabled(true)
     {
@@ -62,7 +63,7 @@ namespace MWInput
 
     void SensorManager::correctGyroscopeAxes()
     {
-        if (!Settings::Manager::getBool("enable gyroscope", "Input"))
+        if (!mGyroscopeEnabled.get())
             return;
 
         // Treat setting from config as axes for landscape mode.
@@ -106,7 +107,7 @@ namespace MWInput
 
     void SensorManager::updateSensors()
     {
-        if (Settings::Manager::getBool("enable gyroscope", "Input"))
+        if (mGyroscopeEnabled.get())
         {
             int numSensors = SDL_NumSensors();
             for (int i = 0; i < numSensors; ++i)
@@ -149,20 +150,10 @@ namespace MWInput
 
     void SensorManager::processChangedSettings(const Settings::CategorySettingVector& changed)
     {
+        // Plain values are CachedSetting handles and refresh themselves; only
+        // settings with side effects need handling here.
         for (const auto& setting : changed)
         {
-            if (setting.first == "Input" && setting.second == "invert x axis")
-                mInvertX = Settings::Manager::getBool("invert x axis", "Input");
-
-            if (setting.first == "Input" && setting.second == "invert y axis")
-                mInvertY = Settings::Manager::getBool("invert y axis", "Input");
-
-            if (setting.first == "Input" && setting.second == "gyro horizontal sensitivity")
-                mGyroHSensitivity = Settings::Manager::getFloat("gyro horizontal sensitivity", "Input");
-
-            if (setting.first == "Input" && setting.second == "gyro vertical sensitivity")
-                mGyroVSensitivity = Settings::Manager::getFloat("gyro vertical sensitivity", "Input");
-
             if (setting.first == "Input" && setting.second == "enable gyroscope")
                 init();
 
@@ -171,9 +162,6 @@ namespace MWInput
 
             if (setting.first == "Input" && setting.second == "gyro vertical axis")
                 correctGyroscopeAxes();
-
-            if (setting.first == "Input" && setting.second == "gyro input threshold")
-                mGyroInputThreshold = Settings::Manager::getFloat("gyro input threshold", "Input");
         }
     }
 
@@ -184,11 +172,11 @@ namespace MWInput
             case GyroscopeAxis::X:
             case GyroscopeAxis::Y:
             case GyroscopeAxis::Z:
-                return std::abs(arg.data[0]) >= mGyroInputThreshold ? arg.data[axis-1] : 0.f;
+                return std::abs(arg.data[0]) >= mGyroInputThreshold.get() ? arg.data[axis-1] : 0.f;
             case GyroscopeAxis::Minus_X:
             case GyroscopeAxis::Minus_Y:
             case GyroscopeAxis::Minus_Z:
-                return std::abs(arg.data[0]) >= mGyroInputThreshold ? -arg.data[std::abs(axis)-1] : 0.f;
+                return std::abs(arg.data[0]) >= mGyroInputThreshold.get() ? -arg.data[std::abs(axis)-1] : 0.f;
             default:
                 return 0.f;
         }
@@ -201,7 +189,7 @@ namespace MWInput
 
     void SensorManager::sensorUpdated(const SDL_SensorEvent &arg)
     {
-        if (!Settings::Manager::getBool("enable gyroscope", "Input"))
+        if (!mGyroscopeEnabled.get())
             return;
 
         SDL_Sensor *sensor = SDL_SensorFromInstanceID(arg.which);
@@ -249,9 +237,9 @@ namespace MWInput
         if (!mGuiCursorEnabled)
         {
             float rot[3];
-            rot[0] = -mGyroYSpeed * dt * mGyroVSensitivity * 4 * (mInvertY ? -1 : 1);
+            rot[0] = -mGyroYSpeed * dt * mGyroVSensitivity.get() * 4 * (mInvertY.get() ? -1 : 1);
             rot[1] = 0.0f;
-            rot[2] = -mGyroXSpeed * dt * mGyroHSensitivity * 4 * (mInvertX ? -1 : 1);
+            rot[2] = -mGyroXSpeed * dt * mGyroHSensitivity.get() * 4 * (mInvertX.get() ? -1 : 1);
 
             // Only actually turn player when we're not in vanity mode
             bool playerLooking = MWBase::Environment::get().getInputManager()->getControlSwitch("playerlooking");
@@ -52,18 +52,20 @@ namespace MWInput
         GyroscopeAxis mapGyroscopeAxis(const std::string& axis);
         float getGyroAxisSpeed(GyroscopeAxis axis, const SDL_SensorEvent &arg) const;
 
-        bool mInvertX;
-        bool mInvertY;
+        // Typed handles; reads are atomic loads, kept up to date by the Manager
+        Settings::CachedSetting<bool> mInvertX;
+        Settings::CachedSetting<bool> mInvertY;
+        Settings::CachedSetting<bool> mGyroscopeEnabled;
 
         float mGyroXSpeed;
         float mGyroYSpeed;
         float mGyroUpdateTimer;
 
-        float mGyroHSensitivity;
-        float mGyroVSensitivity;
+        Settings::CachedSetting<float> mGyroHSensitivity;
+        Settings::CachedSetting<float> mGyroVSensitivity;
         GyroscopeAxis mGyroHAxis;
         GyroscopeAxis mGyroVAxis;
-        float mGyroInputThreshold;
+        Settings::CachedSetting<float> mGyroInputThreshold;
 
         SDL_Sensor* mGyroscope;
 
@@ -11,13 +11,64 @@
 namespace MWLua
 {
 
-    template <typename Event>
-    void saveEvent(ESM::ESMWriter& esm, const ObjectId& dest, const Event& event)
+    // Serializes the payload to the end of the shared buffer; rolls the buffer
+    // back if serialization throws so the queue stays consistent.
+    static std::pair<uint32_t, uint32_t> appendPayload(LuaUtil::BinaryData& buffer, const sol::object& data,
+                                                       const LuaUtil::UserdataSerializer* serializer)
     {
-        esm.writeHNString("LUAE", event.mEventName);
+        const size_t offset = buffer.size();
+        try
+        {
+            LuaUtil::serialize(buffer, data, serializer);
+        }
+        catch (...)
+        {
+            buffer.resize(offset);
+            throw;
+        }
+        return {static_cast<uint32_t>(offset), static_cast<uint32_t>(buffer.size() - offset)};
+    }
+
+    static std::pair<uint32_t, uint32_t> appendPayload(LuaUtil::BinaryData& buffer, std::string_view serializedData)
+    {
+        const size_t offset = buffer.size();
+        buffer.append(serializedData.data(), serializedData.size());
+        return {static_cast<uint32_t>(offset), static_cast<uint32_t>(serializedData.size())};
+    }
+
+    void GlobalEventQueue::push(std::string eventName, const sol::object& data,
+                                const LuaUtil::UserdataSerializer* serializer)
+    {
+        const auto [offset, size] = appendPayload(mData, data, serializer);
+        mEvents.push_back({std::move(eventName), offset, size});
+    }
+
+    void GlobalEventQueue::push(std::string eventName, std::string_view serializedData)
+    {
+        const auto [offset, size] = appendPayload(mData, serializedData);
+        mEvents.push_back({std::move(eventName), offset, size});
+    }
+
+    void LocalEventQueue::push(const ObjectId& dest, std::string eventName, const sol::object& data,
+                               const LuaUtil::UserdataSerializer* serializer)
+    {
+        const auto [offset, size] = appendPayload(mData, data, serializer);
+        mEvents.push_back({dest, std::move(eventName), offset, size});
+    }
+
+    void LocalEventQueue::push(const ObjectId& dest, std::string eventName, std::string_view serializedData)
+    {
+        const auto [offset, size] = appendPayload(mData, serializedData);
+        mEvents.push_back({dest, std::move(eventName), offset, size});
+    }
+
+    static void saveEvent(ESM::ESMWriter& esm, const ObjectId& dest, const std::string& eventName,
+                          std::string_view eventData)
+    {
+        esm.writeHNString("LUAE", eventName);
         dest.save(esm, true);
-        if (!event.mEventData.empty())
-            saveLuaBinaryData(esm, event.mEventData);
+        if (!eventData.empty())
+            saveLuaBinaryData(esm, std::string(eventData));
     }
 
     void loadEvents(sol::state& lua, ESM::ESMReader& esm, GlobalEventQueue& globalEvents, LocalEventQueue& localEvents,
@@ -42,10 +93,10 @@ namespace MWLua
                 auto it = contentFileMapping.find(dest.mContentFile);
                 if (it != contentFileMapping.end())
                     dest.mContentFile = it->second;
-                localEvents.push_back({dest, std::move(name), std::move(data)});
+                localEvents.push(dest, std::move(name), data);
             }
             else
-                globalEvents.push_back({std::move(name), std::move(data)});
+                globalEvents.push(std::move(name), data);
         }
     }
 
@@ -54,10 +105,10 @@ namespace MWLua
         ObjectId globalId;
         globalId.unset();  // Used as a marker of a global event.
 
-        for (const GlobalEvent& e : globalEvents)
-            saveEvent(esm, globalId, e);
-        for (const LocalEvent& e : localEvents)
-            saveEvent(esm, e.mDest, e);
+        for (const GlobalEvent& e : globalEvents.mEvents)
+            saveEvent(esm, globalId, e.mEventName, globalEvents.data(e));
+        for (const LocalEvent& e : localEvents.mEvents)
+            saveEvent(esm, e.mDest, e.mEventName, localEvents.data(e));
     }
 
 }
@@ -1,6 +1,8 @@
 #ifndef MWLUA_EVENTQUEUE_H
 #define MWLUA_EVENTQUEUE_H
 
+#include <components/lua/serialization.hpp>
+
 #include "object.hpp"
 
 namespace ESM
@@ -9,31 +11,58 @@ namespace ESM
     class ESMWriter;
 }
 
-namespace LuaUtil
-{
-    class UserdataSerializer;
-}
-
-namespace sol
-{
-    class state;
-}
-
 namespace MWLua
 {
+    // Queued events reference their serialized payload by offset and size in a
+    // buffer shared by the whole queue instead of owning one string each, so
+    // thousands of events per frame cost a handful of allocations and delivery
+    // reads the payloads in place.
     struct GlobalEvent
     {
         std::string mEventName;
-        std::string mEventData;
+        uint32_t mDataOffset;
+        uint32_t mDataSize;
     };
     struct LocalEvent
     {
         ObjectId mDest;
         std::string mEventName;
-        std::string mEventData;
+        uint32_t mDataOffset;
+        uint32_t mDataSize;
+    };
+
+    struct GlobalEventQueue
+    {
+        std::vector<GlobalEvent> mEvents;
+        LuaUtil::BinaryData mData;
+
+        std::string_view data(const GlobalEvent& event) const
+        {
+            return std::string_view(mData.data() + event.mDataOffset, event.mDataSize);
+        }
+
+        void push(std::string eventName, const sol::object& data, const LuaUtil::UserdataSerializer* serializer);
+        void push(std::string eventName, std::string_view serializedData);
+
+        void clear() { mEvents.clear(); mData.clear(); }
+    };
+
+    struct LocalEventQueue
+    {
+        std::vector<LocalEvent> mEvents;
+        LuaUtil::BinaryData mData;
+
+        std::string_view data(const LocalEvent& event) const
+        {
+            return std::string_view(mData.data() + event.mDataOffset, event.mDataSize);
+        }
+
+        void push(const ObjectId& dest, std::string eventName, const sol::object& data,
+                  const LuaUtil::UserdataSerializer* serializer);
+        void push(const ObjectId& dest, std::string eventName, std::string_view serializedData);
+
+        void clear() { mEvents.clear(); mData.clear(); }
     };
-    using GlobalEventQueue = std::vector<GlobalEvent>;
-    using LocalEventQueue = std::vector<LocalEvent>;
 
     void loadEvents(sol::state& lua, ESM::ESMReader& esm, GlobalEventQueue&, LocalEventQueue&,
                     const std::map<int, int>& contentFileMapping, const LuaUtil::UserdataSerializer* serializer);
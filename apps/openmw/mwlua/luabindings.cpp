@@ -34,7 +34,7 @@ namespace MWLua
         };
         api["sendGlobalEvent"] = [context](std::string eventName, const sol::object& eventData)
         {
-            context.mGlobalEventQueue->push_back({std::move(eventName), LuaUtil::serialize(eventData, context.mSerializer)});
+            context.mGlobalEventQueue->push(std::move(eventName), eventData, context.mSerializer);
         };
         api["getGameTimeInSeconds"] = [world=context.mWorldView]() { return world->getGameTimeInSeconds(); };
         api["getGameTimeInHours"] = [world=context.mWorldView]() { return world->getGameTimeInHours(); };
@@ -106,6 +106,10 @@ namespace MWLua
             // TODO: Use sqlite to search objects that are not in the scene
             // return GObjectList{worldView->selectObjects(query, false)};
         };
+        api["objectsNearPoint"] = [worldView](const osg::Vec3f& position, float radius)
+        {
+            return GObjectList{worldView->getNearbyObjects(position, radius)};
+        };
         // TODO: add world.placeNewObject(recordId, cell, pos, [rot])
         return context.mLua->makeReadOnly(api);
     }
@@ -137,6 +141,10 @@ namespace MWLua
             // TODO: Maybe use sqlite
             // return LObjectList{worldView->selectObjects(query, true)};
         };
+        api["objectsNearPoint"] = [worldView](const osg::Vec3f& position, float radius)
+        {
+            return LObjectList{worldView->getNearbyObjects(position, radius)};
+        };
         return context.mLua->makeReadOnly(api);
     }
 
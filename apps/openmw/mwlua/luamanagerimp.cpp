@@ -1,6 +1,9 @@
 #include "luamanagerimp.hpp"
 
+#include <osg/Stats>
+
 #include <components/debug/debuglog.hpp>
+#include <components/debug/memorytracking.hpp>
 
 #include <components/esm/esmreader.hpp>
 #include <components/esm/esmwriter.hpp>
@@ -9,6 +12,8 @@
 #include <components/lua/utilpackage.hpp>
 #include <components/lua/omwscriptsparser.hpp>
 
+#include <components/settings/settings.hpp>
+
 #include "../mwbase/windowmanager.hpp"
 
 #include "../mwworld/class.hpp"
@@ -23,6 +28,7 @@ namespace MWLua
     LuaManager::LuaManager(const VFS::Manager* vfs, const std::vector<std::string>& scriptLists) : mLua(vfs)
     {
         Log(Debug::Info) << "Lua version: " << LuaUtil::getLuaVersion();
+        mUpdateBudget = Settings::Manager::getFloat("lua update budget", "Lua") / 1000.0;
         mGlobalScriptList = LuaUtil::parseOMWScriptsFiles(vfs, scriptLists);
 
         mGlobalSerializer = createUserdataSerializer(false, mWorldView.getObjectRegistry());
@@ -35,6 +41,8 @@ namespace MWLua
 
     void LuaManager::init()
     {
+        Debug::ScopedMemoryDomain memoryDomain(Debug::MemoryDomain::Lua);
+
         Context context;
         context.mIsGlobal = true;
         context.mLuaManager = this;
@@ -76,6 +84,8 @@ namespace MWLua
 
     void LuaManager::update(bool paused, float dt)
     {
+        Debug::ScopedMemoryDomain memoryDomain(Debug::MemoryDomain::Lua);
+
         ObjectRegistry* objectRegistry = mWorldView.getObjectRegistry();
 
         if (!mPlayer.isEmpty())
@@ -97,10 +107,12 @@ namespace MWLua
             return;
         }
 
-        std::vector<GlobalEvent> globalEvents = std::move(mGlobalEvents);
-        std::vector<LocalEvent> localEvents = std::move(mLocalEvents);
-        mGlobalEvents = std::vector<GlobalEvent>();
-        mLocalEvents = std::vector<LocalEvent>();
+        GlobalEventQueue globalEvents = std::move(mGlobalEvents);
+        LocalEventQueue localEvents = std::move(mLocalEvents);
+        mGlobalEvents = GlobalEventQueue();
+        mLocalEvents = LocalEventQueue();
+        mEventQueueHighWaterMark = std::max(mEventQueueHighWaterMark,
+            static_cast<unsigned>(globalEvents.mEvents.size() + localEvents.mEvents.size()));
 
         {  // Update time and process timers
             double seconds = mWorldView.getGameTimeInSeconds() + dt;
@@ -112,18 +124,37 @@ namespace MWLua
                 scripts->processTimers(seconds, hours);
         }
 
-        // Receive events
-        for (GlobalEvent& e : globalEvents)
-            mGlobalScripts.receiveEvent(e.mEventName, e.mEventData);
-        for (LocalEvent& e : localEvents)
+        // Receive events. Consecutive events of the same type to the same recipient
+        // (the common shape of event spam) are delivered as one batch, so the
+        // handler list is resolved once per run instead of once per event.
+        std::vector<std::string_view> eventBatch;
+        for (size_t i = 0; i < globalEvents.mEvents.size();)
         {
+            const GlobalEvent& e = globalEvents.mEvents[i];
+            eventBatch.clear();
+            size_t j = i;
+            while (j < globalEvents.mEvents.size() && globalEvents.mEvents[j].mEventName == e.mEventName)
+                eventBatch.push_back(globalEvents.data(globalEvents.mEvents[j++]));
+            mGlobalScripts.receiveEvents(e.mEventName, eventBatch);
+            i = j;
+        }
+        for (size_t i = 0; i < localEvents.mEvents.size();)
+        {
+            const LocalEvent& e = localEvents.mEvents[i];
+            eventBatch.clear();
+            size_t j = i;
+            while (j < localEvents.mEvents.size() && localEvents.mEvents[j].mDest == e.mDest
+                   && localEvents.mEvents[j].mEventName == e.mEventName)
+                eventBatch.push_back(localEvents.data(localEvents.mEvents[j++]));
             LObject obj(e.mDest, objectRegistry);
             LocalScripts* scripts = obj.isValid() ? obj.ptr().getRefData().getLuaScripts() : nullptr;
             if (scripts)
-                scripts->receiveEvent(e.mEventName, e.mEventData);
+                scripts->receiveEvents(e.mEventName, eventBatch);
             else
-                Log(Debug::Debug) << "Ignored event " << e.mEventName << " to L" << idToString(e.mDest)
+                Log(Debug::Debug) << "Ignored " << eventBatch.size() << " event(s) " << e.mEventName
+                                  << " to L" << idToString(e.mDest)
                                   << ". Object not found or has no attached scripts";
+            i = j;
         }
 
         // Engine handlers in local scripts
@@ -149,8 +180,13 @@ namespace MWLua
         }
         mLocalEngineEvents.clear();
 
+        // One shared time budget for all containers; each container defers its own
+        // overrun handlers internally and serves them first on the next frame.
+        double timeBudget = mUpdateBudget;
+        double* timeBudgetPtr = mUpdateBudget > 0 ? &timeBudget : nullptr;
+
         for (LocalScripts* scripts : mActiveLocalScripts)
-            scripts->update(dt);
+            scripts->update(dt, timeBudgetPtr);
 
         // Engine handlers in global scripts
         if (mPlayerChanged)
@@ -163,7 +199,22 @@ namespace MWLua
             mGlobalScripts.actorActive(GObject(id, objectRegistry));
         mActorAddedEvents.clear();
 
-        mGlobalScripts.update(dt);
+        mGlobalScripts.update(dt, timeBudgetPtr);
+
+        mUpdateHandlersRun = mGlobalScripts.getLastUpdateCallCount();
+        mUpdateHandlersDeferred = mGlobalScripts.getLastUpdateDeferredCount();
+        for (LocalScripts* scripts : mActiveLocalScripts)
+        {
+            mUpdateHandlersRun += scripts->getLastUpdateCallCount();
+            mUpdateHandlersDeferred += scripts->getLastUpdateDeferredCount();
+        }
+    }
+
+    void LuaManager::reportStats(unsigned int frameNumber, osg::Stats& stats) const
+    {
+        stats.setAttribute(frameNumber, "Lua Handlers Run", mUpdateHandlersRun);
+        stats.setAttribute(frameNumber, "Lua Handlers Deferred", mUpdateHandlersDeferred);
+        stats.setAttribute(frameNumber, "Lua Events Peak", mEventQueueHighWaterMark);
     }
 
     void LuaManager::applyQueuedChanges()
@@ -8,6 +8,11 @@
 
 #include "../mwbase/luamanager.hpp"
 
+namespace osg
+{
+    class Stats;
+}
+
 #include "actions.hpp"
 #include "object.hpp"
 #include "eventqueue.hpp"
@@ -34,6 +39,9 @@ namespace MWLua
         // Called by engine.cpp from the main thread. Can use scene graph.
         void applyQueuedChanges();
 
+        // Called by engine.cpp right after `update` (from the same thread).
+        void reportStats(unsigned int frameNumber, osg::Stats& stats) const;
+
         // Available everywhere through the MWBase::LuaManager interface.
         // LuaManager queues these events and propagates to scripts on the next `update` call.
         void newGameStarted() override { mGlobalScripts.newGameStarted(); }
@@ -87,6 +95,13 @@ namespace MWLua
         bool mPlayerChanged = false;
         MWWorld::Ptr mPlayer;
 
+        // Per-frame real time budget (in seconds) for onUpdate handlers; 0 = unlimited.
+        double mUpdateBudget = 0;
+        unsigned mUpdateHandlersRun = 0;
+        unsigned mUpdateHandlersDeferred = 0;
+        // Largest number of events ever taken from the queues in one frame.
+        unsigned mEventQueueHighWaterMark = 0;
+
         GlobalEventQueue mGlobalEvents;
         LocalEventQueue mLocalEvents;
 
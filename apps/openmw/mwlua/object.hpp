@@ -2,6 +2,7 @@
 #define MWLUA_OBJECT_H
 
 #include <typeindex>
+#include <unordered_map>
 
 #include <components/esm/cellref.hpp>
 
@@ -49,7 +50,7 @@ namespace MWLua
 
         bool mChanged = false;
         int64_t mUpdateCounter = 0;
-        std::map<ObjectId, MWWorld::Ptr> mObjectMapping;
+        std::unordered_map<ObjectId, MWWorld::Ptr> mObjectMapping;
         ObjectId mLastAssignedId;
     };
 
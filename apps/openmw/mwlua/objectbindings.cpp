@@ -120,7 +120,7 @@ namespace MWLua
         objectT[sol::meta_function::to_string] = &ObjectT::toString;
         objectT["sendEvent"] = [context](const ObjectT& dest, std::string eventName, const sol::object& eventData)
         {
-            context.mLocalEventQueue->push_back({dest.id(), std::move(eventName), LuaUtil::serialize(eventData, context.mSerializer)});
+            context.mLocalEventQueue->push(dest.id(), std::move(eventName), eventData, context.mSerializer);
         };
 
         objectT["canMove"] = [](const ObjectT& o)
@@ -1,5 +1,8 @@
 #include "query.hpp"
 
+#include <map>
+#include <optional>
+
 #include <sol/sol.hpp>
 
 #include <components/lua/luastate.hpp>
@@ -48,89 +51,113 @@ namespace MWLua
         return fieldGroups;
     }
 
-    bool checkQueryConditions(const Queries::Query& query, const ObjectId& id, const Context& context)
+    // Fields the engine can read from a Ptr directly. A condition on any other field (e.g. a
+    // future custom one) is evaluated by constructing the Lua object, which is much slower.
+    enum class BasicField
+    {
+        Type,
+        RecordId,
+        CellName,
+        CellRegion,
+        CellIsExterior,
+        Count,
+        IsTeleport,
+        DestCellName,
+        DestCellRegion,
+        DestCellIsExterior,
+    };
+
+    static std::optional<BasicField> resolveBasicField(const Queries::Field* field)
     {
-        auto compareFn = [](auto&& a, auto&& b, Queries::Condition::Type t)
+        static const std::map<const Queries::Field*, BasicField> index = []
         {
-            switch (t)
+            auto byPath = [](const Queries::Field& field) -> BasicField
             {
-                case Queries::Condition::EQUAL: return a == b;
-                case Queries::Condition::NOT_EQUAL: return a != b;
-                case Queries::Condition::GREATER: return a > b;
-                case Queries::Condition::GREATER_OR_EQUAL: return a >= b;
-                case Queries::Condition::LESSER: return a < b;
-                case Queries::Condition::LESSER_OR_EQUAL: return a <= b;
-                default:
-                    throw std::runtime_error("Unsupported condition type");
-            }
-        };
-        sol::object obj;
-        MWWorld::Ptr ptr;
-        if (context.mIsGlobal)
+                std::string path;
+                for (const std::string& segment : field.path())
+                {
+                    if (!path.empty())
+                        path += ".";
+                    path += segment;
+                }
+                if (path == "type") return BasicField::Type;
+                if (path == "recordId") return BasicField::RecordId;
+                if (path == "cell.name") return BasicField::CellName;
+                if (path == "cell.region") return BasicField::CellRegion;
+                if (path == "cell.isExterior") return BasicField::CellIsExterior;
+                if (path == "count") return BasicField::Count;
+                if (path == "isTeleport") return BasicField::IsTeleport;
+                if (path == "destCell.name") return BasicField::DestCellName;
+                if (path == "destCell.region") return BasicField::DestCellRegion;
+                if (path == "destCell.isExterior") return BasicField::DestCellIsExterior;
+                throw std::logic_error("No Ptr accessor for basic query field: " + path);
+            };
+            std::map<const Queries::Field*, BasicField> res;
+            for (const QueryFieldGroup& group : getBasicQueryFieldGroups())
+                for (const Queries::Field* field : group.mFields)
+                    res.emplace(field, byPath(*field));
+            return res;
+        }();
+        auto it = index.find(field);
+        if (it == index.end())
+            return std::nullopt;
+        return it->second;
+    }
+
+    // A condition compiled for evaluation against a Ptr: the field is resolved to its
+    // accessor once per query instead of being looked up on the Lua object per candidate.
+    struct CompiledCondition
+    {
+        BasicField mField;
+        Queries::Condition::Type mType;
+        const Queries::FieldValue* mValue;
+    };
+
+    // Compiles all conditions of `filter` (ordered as filter.mConditions); returns nullopt if
+    // some condition uses a field without a Ptr accessor.
+    static std::optional<std::vector<CompiledCondition>> compileFilter(const Queries::Filter& filter)
+    {
+        std::vector<CompiledCondition> res;
+        res.reserve(filter.mConditions.size());
+        for (const Queries::Condition& cond : filter.mConditions)
         {
-            GObject g(id, context.mWorldView->getObjectRegistry());
-            if (!g.isValid())
-                return false;
-            ptr = g.ptr();
-            obj = sol::make_object(context.mLua->sol(), g);
+            std::optional<BasicField> field = resolveBasicField(cond.mField);
+            if (!field)
+                return std::nullopt;
+            res.push_back({*field, cond.mType, &cond.mValue});
         }
-        else
+        return res;
+    }
+
+    template <class T>
+    static bool compareValues(const T& a, const T& b, Queries::Condition::Type t)
+    {
+        switch (t)
         {
-            LObject l(id, context.mWorldView->getObjectRegistry());
-            if (!l.isValid())
-                return false;
-            ptr = l.ptr();
-            obj = sol::make_object(context.mLua->sol(), l);
+            case Queries::Condition::EQUAL: return a == b;
+            case Queries::Condition::NOT_EQUAL: return a != b;
+            case Queries::Condition::GREATER: return a > b;
+            case Queries::Condition::GREATER_OR_EQUAL: return a >= b;
+            case Queries::Condition::LESSER: return a < b;
+            case Queries::Condition::LESSER_OR_EQUAL: return a <= b;
+            default:
+                throw std::runtime_error("Unsupported condition type");
         }
-        if (ptr.getRefData().getCount() == 0)
-            return false;
-
-        // It is important to exclude all markers before checking what class it is.
-        // For example "prisonmarker" has class "Door" despite that it is only an invisible marker.
-        if (isMarker(ptr))
-            return false;
-
-        const MWWorld::Class& cls = ptr.getClass();
-        if (cls.isActivator() != (query.mQueryType == ObjectQueryTypes::ACTIVATORS))
-            return false;
-        if (cls.isActor() != (query.mQueryType == ObjectQueryTypes::ACTORS))
-            return false;
-        if (cls.isDoor() != (query.mQueryType == ObjectQueryTypes::DOORS))
-            return false;
-        if ((typeid(cls) == typeid(MWClass::Container)) != (query.mQueryType == ObjectQueryTypes::CONTAINERS))
-            return false;
+    }
 
+    // Evaluates the operations of `filter` in reverse polish notation; evalCondition maps a
+    // condition index to the condition result for the current candidate.
+    template <class EvalCondition>
+    static bool evaluateFilter(const Queries::Filter& filter, EvalCondition&& evalCondition)
+    {
         std::vector<char> condStack;
-        for (const Queries::Operation& op : query.mFilter.mOperations)
+        for (const Queries::Operation& op : filter.mOperations)
         {
             switch(op.mType)
             {
                 case Queries::Operation::PUSH:
-                {
-                    const Queries::Condition& cond = query.mFilter.mConditions[op.mConditionIndex];
-                    sol::object fieldObj = obj;
-                    for (const std::string& field : cond.mField->path())
-                        fieldObj = LuaUtil::getFieldOrNil(fieldObj, field);
-                    bool c;
-                    if (fieldObj == sol::nil)
-                        c = false;
-                    else if (cond.mField->type() == typeid(std::string))
-                        c = compareFn(fieldObj.as<std::string_view>(), std::get<std::string>(cond.mValue), cond.mType);
-                    else if (cond.mField->type() == typeid(float))
-                        c = compareFn(fieldObj.as<float>(), std::get<float>(cond.mValue), cond.mType);
-                    else if (cond.mField->type() == typeid(double))
-                        c = compareFn(fieldObj.as<double>(), std::get<double>(cond.mValue), cond.mType);
-                    else if (cond.mField->type() == typeid(bool))
-                        c = compareFn(fieldObj.as<bool>(), std::get<bool>(cond.mValue), cond.mType);
-                    else if (cond.mField->type() == typeid(int32_t))
-                        c = compareFn(fieldObj.as<int32_t>(), std::get<int32_t>(cond.mValue), cond.mType);
-                    else if (cond.mField->type() == typeid(int64_t))
-                        c = compareFn(fieldObj.as<int64_t>(), std::get<int64_t>(cond.mValue), cond.mType);
-                    else
-                        throw std::runtime_error("Unknown field type");
-                    condStack.push_back(c);
+                    condStack.push_back(evalCondition(op.mConditionIndex));
                     break;
-                }
                 case Queries::Operation::NOT:
                     condStack.back() = !condStack.back();
                     break;
@@ -153,17 +180,157 @@ namespace MWLua
         return condStack.empty() || condStack.back() != 0;
     }
 
+    // Conditions on a missing value (object not in a cell, door without a teleport
+    // destination) are false, same as the nil result on the Lua path.
+    static bool evaluateCondition(const CompiledCondition& cond, const MWWorld::Ptr& ptr, const Context& context)
+    {
+        switch (cond.mField)
+        {
+            case BasicField::Type:
+                return compareValues<std::string_view>(getMWClassName(ptr), std::get<std::string>(*cond.mValue), cond.mType);
+            case BasicField::RecordId:
+                return compareValues<std::string_view>(ptr.getCellRef().getRefId(), std::get<std::string>(*cond.mValue), cond.mType);
+            case BasicField::Count:
+                return compareValues<int32_t>(ptr.getRefData().getCount(), std::get<int32_t>(*cond.mValue), cond.mType);
+            case BasicField::CellName:
+            case BasicField::CellRegion:
+            case BasicField::CellIsExterior:
+            {
+                if (!ptr.isInCell())
+                    return false;
+                const MWWorld::CellStore* cell = ptr.getCell();
+                if (cond.mField == BasicField::CellIsExterior)
+                    return compareValues<bool>(cell->isExterior(), std::get<bool>(*cond.mValue), cond.mType);
+                const std::string& value = cond.mField == BasicField::CellName ?
+                    cell->getCell()->mName : cell->getCell()->mRegion;
+                return compareValues<std::string_view>(value, std::get<std::string>(*cond.mValue), cond.mType);
+            }
+            case BasicField::IsTeleport:
+            case BasicField::DestCellName:
+            case BasicField::DestCellRegion:
+            case BasicField::DestCellIsExterior:
+            {
+                if (!ptr.getClass().isDoor())
+                    return false;
+                const MWWorld::CellRef& cellRef = ptr.getCellRef();
+                if (cond.mField == BasicField::IsTeleport)
+                    return compareValues<bool>(cellRef.getTeleport(), std::get<bool>(*cond.mValue), cond.mType);
+                if (!cellRef.getTeleport())
+                    return false;
+                const MWWorld::CellStore* dest = context.mWorldView->findCell(
+                    cellRef.getDestCell(), cellRef.getDoorDest().asVec3());
+                if (!dest)
+                    return false;
+                if (cond.mField == BasicField::DestCellIsExterior)
+                    return compareValues<bool>(dest->isExterior(), std::get<bool>(*cond.mValue), cond.mType);
+                const std::string& value = cond.mField == BasicField::DestCellName ?
+                    dest->getCell()->mName : dest->getCell()->mRegion;
+                return compareValues<std::string_view>(value, std::get<std::string>(*cond.mValue), cond.mType);
+            }
+        }
+        throw std::logic_error("Unknown basic query field");
+    }
+
+    static bool checkTypeAndMarker(const Queries::Query& query, const MWWorld::Ptr& ptr)
+    {
+        if (ptr.getRefData().getCount() == 0)
+            return false;
+
+        // It is important to exclude all markers before checking what class it is.
+        // For example "prisonmarker" has class "Door" despite that it is only an invisible marker.
+        if (isMarker(ptr))
+            return false;
+
+        const MWWorld::Class& cls = ptr.getClass();
+        if (cls.isActivator() != (query.mQueryType == ObjectQueryTypes::ACTIVATORS))
+            return false;
+        if (cls.isActor() != (query.mQueryType == ObjectQueryTypes::ACTORS))
+            return false;
+        if (cls.isDoor() != (query.mQueryType == ObjectQueryTypes::DOORS))
+            return false;
+        if ((typeid(cls) == typeid(MWClass::Container)) != (query.mQueryType == ObjectQueryTypes::CONTAINERS))
+            return false;
+        return true;
+    }
+
+    static bool checkCompiledQueryConditions(const Queries::Query& query, const std::vector<CompiledCondition>& conditions,
+                                             const MWWorld::Ptr& ptr, const Context& context)
+    {
+        if (!checkTypeAndMarker(query, ptr))
+            return false;
+        return evaluateFilter(query.mFilter, [&](size_t conditionIndex)
+        {
+            return evaluateCondition(conditions[conditionIndex], ptr, context);
+        });
+    }
+
+    bool checkQueryConditions(const Queries::Query& query, const ObjectId& id, const Context& context)
+    {
+        sol::object obj;
+        MWWorld::Ptr ptr;
+        if (context.mIsGlobal)
+        {
+            GObject g(id, context.mWorldView->getObjectRegistry());
+            if (!g.isValid())
+                return false;
+            ptr = g.ptr();
+            obj = sol::make_object(context.mLua->sol(), g);
+        }
+        else
+        {
+            LObject l(id, context.mWorldView->getObjectRegistry());
+            if (!l.isValid())
+                return false;
+            ptr = l.ptr();
+            obj = sol::make_object(context.mLua->sol(), l);
+        }
+        if (!checkTypeAndMarker(query, ptr))
+            return false;
+
+        return evaluateFilter(query.mFilter, [&](size_t conditionIndex)
+        {
+            const Queries::Condition& cond = query.mFilter.mConditions[conditionIndex];
+            sol::object fieldObj = obj;
+            for (const std::string& field : cond.mField->path())
+                fieldObj = LuaUtil::getFieldOrNil(fieldObj, field);
+            if (fieldObj == sol::nil)
+                return false;
+            else if (cond.mField->type() == typeid(std::string))
+                return compareValues<std::string_view>(fieldObj.as<std::string_view>(), std::get<std::string>(cond.mValue), cond.mType);
+            else if (cond.mField->type() == typeid(float))
+                return compareValues<float>(fieldObj.as<float>(), std::get<float>(cond.mValue), cond.mType);
+            else if (cond.mField->type() == typeid(double))
+                return compareValues<double>(fieldObj.as<double>(), std::get<double>(cond.mValue), cond.mType);
+            else if (cond.mField->type() == typeid(bool))
+                return compareValues<bool>(fieldObj.as<bool>(), std::get<bool>(cond.mValue), cond.mType);
+            else if (cond.mField->type() == typeid(int32_t))
+                return compareValues<int32_t>(fieldObj.as<int32_t>(), std::get<int32_t>(cond.mValue), cond.mType);
+            else if (cond.mField->type() == typeid(int64_t))
+                return compareValues<int64_t>(fieldObj.as<int64_t>(), std::get<int64_t>(cond.mValue), cond.mType);
+            else
+                throw std::runtime_error("Unknown field type");
+        });
+    }
+
     ObjectIdList selectObjectsFromList(const Queries::Query& query, const ObjectIdList& list, const Context& context)
     {
         if (!query.mOrderBy.empty() || !query.mGroupBy.empty() || query.mOffset > 0)
             throw std::runtime_error("OrderBy, GroupBy, and Offset are not supported");
 
+        const std::optional<std::vector<CompiledCondition>> compiled = compileFilter(query.mFilter);
+
         ObjectIdList res = std::make_shared<std::vector<ObjectId>>();
         for (const ObjectId& id : *list)
         {
             if (static_cast<int64_t>(res->size()) == query.mLimit)
                 break;
-            if (checkQueryConditions(query, id, context))
+            if (compiled)
+            {
+                MWWorld::Ptr ptr = context.mWorldView->getObjectRegistry()->getPtr(id, !context.mIsGlobal);
+                if (!ptr.isEmpty() && checkCompiledQueryConditions(query, *compiled, ptr, context))
+                    res->push_back(id);
+            }
+            else if (checkQueryConditions(query, id, context))
                 res->push_back(id);
         }
         return res;
@@ -174,17 +341,44 @@ namespace MWLua
         if (!query.mOrderBy.empty() || !query.mGroupBy.empty() || query.mOffset > 0)
             throw std::runtime_error("OrderBy, GroupBy, and Offset are not supported");
 
+        const std::optional<std::vector<CompiledCondition>> compiled = compileFilter(query.mFilter);
+
         ObjectIdList res = std::make_shared<std::vector<ObjectId>>();
         auto visitor = [&](const MWWorld::Ptr& ptr)
         {
             if (static_cast<int64_t>(res->size()) == query.mLimit)
                 return false;
-            context.mWorldView->getObjectRegistry()->registerPtr(ptr);
-            if (checkQueryConditions(query, getId(ptr), context))
+            bool matches;
+            if (compiled)
+                matches = checkCompiledQueryConditions(query, *compiled, ptr, context);
+            else
+            {
+                context.mWorldView->getObjectRegistry()->registerPtr(ptr);
+                matches = checkQueryConditions(query, getId(ptr), context);
+            }
+            if (matches)
+            {
+                context.mWorldView->getObjectRegistry()->registerPtr(ptr);
                 res->push_back(getId(ptr));
+            }
             return static_cast<int64_t>(res->size()) != query.mLimit;
         };
-        store->forEach(std::move(visitor));  // TODO: maybe use store->forEachType<TYPE> depending on query.mType
+        // The type checks reject everything but one class of objects, so visit only the lists
+        // that can contain that class instead of every reference in the cell. ITEMS spans
+        // several record types and keeps the full walk.
+        if (query.mQueryType == ObjectQueryTypes::ACTIVATORS)
+            store->forEachType<ESM::Activator>(visitor);
+        else if (query.mQueryType == ObjectQueryTypes::ACTORS)
+        {
+            if (store->forEachType<ESM::NPC>(visitor))
+                store->forEachType<ESM::Creature>(visitor);
+        }
+        else if (query.mQueryType == ObjectQueryTypes::CONTAINERS)
+            store->forEachType<ESM::Container>(visitor);
+        else if (query.mQueryType == ObjectQueryTypes::DOORS)
+            store->forEachType<ESM::Door>(visitor);
+        else
+            store->forEach(std::move(visitor));
         return res;
     }
 
@@ -1,5 +1,7 @@
 #include "worldview.hpp"
 
+#include <cmath>
+
 #include <components/esm/esmreader.hpp>
 #include <components/esm/esmwriter.hpp>
 #include <components/esm/loadcell.hpp>
@@ -7,6 +9,7 @@
 #include "../mwclass/container.hpp"
 
 #include "../mwworld/class.hpp"
+#include "../mwworld/refdata.hpp"
 #include "../mwworld/timestamp.hpp"
 
 namespace MWLua
@@ -20,6 +23,7 @@ namespace MWLua
         mContainersInScene.updateList();
         mDoorsInScene.updateList();
         mItemsInScene.updateList();
+        mSpatialGridUpToDate = false;
     }
 
     void WorldView::clear()
@@ -30,6 +34,8 @@ namespace MWLua
         mContainersInScene.clear();
         mDoorsInScene.clear();
         mItemsInScene.clear();
+        mSpatialGrid.clear();
+        mSpatialGridUpToDate = false;
     }
 
     WorldView::ObjectGroup* WorldView::chooseGroup(const MWWorld::Ptr& ptr)
@@ -67,6 +73,57 @@ namespace MWLua
             removeFromGroup(*group, ptr);
     }
 
+    void WorldView::rebuildSpatialIndex()
+    {
+        mSpatialGrid.clear();
+        auto addGroup = [&](const ObjectGroup& group)
+        {
+            for (const ObjectId& id : *group.mList)
+            {
+                MWWorld::Ptr ptr = mObjectRegistry.getPtr(id, false);
+                if (ptr.isEmpty())
+                    continue;
+                const osg::Vec3f pos = ptr.getRefData().getPosition().asVec3();
+                const int cellX = static_cast<int>(std::floor(pos.x() / sGridCellSize));
+                const int cellY = static_cast<int>(std::floor(pos.y() / sGridCellSize));
+                mSpatialGrid[spatialKey(cellX, cellY)].push_back(id);
+            }
+        };
+        addGroup(mActivatorsInScene);
+        addGroup(mActorsInScene);
+        addGroup(mContainersInScene);
+        addGroup(mDoorsInScene);
+        addGroup(mItemsInScene);
+        mSpatialGridUpToDate = true;
+    }
+
+    ObjectIdList WorldView::getNearbyObjects(const osg::Vec3f& position, float radius)
+    {
+        if (!mSpatialGridUpToDate)
+            rebuildSpatialIndex();
+        ObjectIdList res = std::make_shared<std::vector<ObjectId>>();
+        const int minX = static_cast<int>(std::floor((position.x() - radius) / sGridCellSize));
+        const int maxX = static_cast<int>(std::floor((position.x() + radius) / sGridCellSize));
+        const int minY = static_cast<int>(std::floor((position.y() - radius) / sGridCellSize));
+        const int maxY = static_cast<int>(std::floor((position.y() + radius) / sGridCellSize));
+        const float radius2 = radius * radius;
+        for (int cellX = minX; cellX <= maxX; ++cellX)
+            for (int cellY = minY; cellY <= maxY; ++cellY)
+            {
+                auto it = mSpatialGrid.find(spatialKey(cellX, cellY));
+                if (it == mSpatialGrid.end())
+                    continue;
+                for (const ObjectId& id : it->second)
+                {
+                    MWWorld::Ptr ptr = mObjectRegistry.getPtr(id, false);
+                    if (!ptr.isEmpty()
+                        && (ptr.getRefData().getPosition().asVec3() - position).length2() <= radius2)
+                        res->push_back(id);
+                }
+            }
+        return res;
+    }
+
     double WorldView::getGameTimeInHours() const
     {
         MWBase::World* world = MWBase::Environment::get().getWorld();
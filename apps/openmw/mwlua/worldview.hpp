@@ -1,6 +1,10 @@
 #ifndef MWLUA_WORLDVIEW_H
 #define MWLUA_WORLDVIEW_H
 
+#include <unordered_map>
+
+#include <osg/Vec3f>
+
 #include "object.hpp"
 
 namespace ESM
@@ -35,6 +39,10 @@ namespace MWLua
 
         ObjectRegistry* getObjectRegistry() { return &mObjectRegistry; }
 
+        // Returns ids of all objects in the scene within `radius` of `position`.
+        // Backed by a spatial grid instead of a scan over all object lists.
+        ObjectIdList getNearbyObjects(const osg::Vec3f& position, float radius);
+
         void objectUnloaded(const MWWorld::Ptr& ptr) { mObjectRegistry.deregisterPtr(ptr); }
 
         void objectAddedToScene(const MWWorld::Ptr& ptr);
@@ -66,6 +74,13 @@ namespace MWLua
         void addToGroup(ObjectGroup& group, const MWWorld::Ptr& ptr);
         void removeFromGroup(ObjectGroup& group, const MWWorld::Ptr& ptr);
 
+        void rebuildSpatialIndex();
+        static uint64_t spatialKey(int cellX, int cellY)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32)
+                | static_cast<uint32_t>(cellY);
+        }
+
         ObjectRegistry mObjectRegistry;
         ObjectGroup mActivatorsInScene;
         ObjectGroup mActorsInScene;
@@ -73,6 +88,14 @@ namespace MWLua
         ObjectGroup mDoorsInScene;
         ObjectGroup mItemsInScene;
 
+        // Uniform grid over the objects currently in the scene, bucketed by X/Y
+        // (queries still check the full 3d distance). Positions change every frame
+        // while the scene is active, so the grid is rebuilt lazily on the first
+        // query after each update instead of being maintained incrementally.
+        static constexpr float sGridCellSize = 1024;
+        std::unordered_map<uint64_t, std::vector<ObjectId>> mSpatialGrid;
+        bool mSpatialGridUpToDate = false;
+
         double mGameSeconds = 0;
     };
 
@@ -48,6 +48,32 @@ namespace MWMechanics
             return mEngageCombat.update(duration);
         }
 
+        AiUpdateTier getAiUpdateTier() const { return mAiUpdateTier; }
+        void setAiUpdateTier(AiUpdateTier tier) { mAiUpdateTier = tier; }
+
+        /// Accumulate frame time towards the next scheduled AI package update.
+        /// \return the accumulated duration if the update is due this frame, 0 otherwise
+        float updateAiTimer(float duration, bool due)
+        {
+            mAiDuration += duration;
+            if (!due)
+                return 0.f;
+            const float result = mAiDuration;
+            mAiDuration = 0.f;
+            return result;
+        }
+
+        /// Accumulate frame time towards the next scheduled animation update, see updateAiTimer.
+        float updateAnimationTimer(float duration, bool due)
+        {
+            mAnimationDuration += duration;
+            if (!due)
+                return 0.f;
+            const float result = mAnimationDuration;
+            mAnimationDuration = 0.f;
+            return result;
+        }
+
     private:
         std::unique_ptr<CharacterController> mCharacterController;
         int mGreetingTimer{0};
@@ -55,6 +81,9 @@ namespace MWMechanics
         GreetingState mGreetingState{Greet_None};
         bool mIsTurningToPlayer{false};
         Misc::DeviatingPeriodicTimer mEngageCombat{1.0f, 0.25f, Misc::Rng::deviate(0, 0.25f)};
+        AiUpdateTier mAiUpdateTier{AiUpdateTier::Near};
+        float mAiDuration{0.f};
+        float mAnimationDuration{0.f};
     };
 
 }
@@ -1,15 +1,20 @@
 #include "actors.hpp"
 
+#include <cmath>
+#include <cstdint>
 #include <optional>
+#include <unordered_map>
 
 #include <components/esm/esmreader.hpp>
 #include <components/esm/esmwriter.hpp>
 
 #include <components/sceneutil/positionattitudetransform.hpp>
 #include <components/debug/debuglog.hpp>
+#include <components/misc/framearena.hpp>
 #include <components/misc/rng.hpp>
 #include <components/misc/mathutil.hpp>
 #include <components/settings/settings.hpp>
+#include <components/detournavigator/navigator.hpp>
 
 #include "../mwworld/esmstore.hpp"
 #include "../mwworld/class.hpp"
@@ -49,6 +54,17 @@
 namespace
 {
 
+// Cell size of the shared actor proximity grid. Small radii (door and wander occupancy
+// checks, the alarm radius) probe only a few buckets; queries wider than the occupied
+// grid fall back to scanning the buckets linearly.
+constexpr float sActorGridCellSize = 512.f;
+
+uint64_t actorGridKey(int cellX, int cellY)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32)
+        | static_cast<uint32_t>(cellY);
+}
+
 bool isConscious(const MWWorld::Ptr& ptr)
 {
     const MWMechanics::CreatureStats& stats = ptr.getClass().getCreatureStats(ptr);
@@ -1019,11 +1035,16 @@ namespace MWMechanics
 
             for (MagicEffects::Collection::const_iterator it = effects.begin(); it != effects.end(); ++it)
             {
+                // This loop runs for every effect on every actor every frame and the vast majority
+                // of effects (fortifications, resistances, ...) are neither tickable nor instant,
+                // so classify by effect id before dispatching.
+
                 // tickable effects (i.e. effects having a lasting impact after expiry)
-                effectTick(creatureStats, ptr, it->first, it->second.getMagnitude() * duration);
+                if (isTickableEffect(it->first.mId))
+                    effectTick(creatureStats, ptr, it->first, it->second.getMagnitude() * duration);
 
                 // instant effects are already applied on spell impact in spellcasting.cpp, but may also come from permanent abilities
-                if (it->second.getMagnitude() > 0)
+                if (it->second.getMagnitude() > 0 && isInstantEffect(it->first.mId))
                 {
                     CastSpell cast(ptr, ptr);
                     if (cast.applyInstantEffect(ptr, ptr, it->first, it->second.getMagnitude()))
@@ -1612,6 +1633,7 @@ namespace MWMechanics
         if (!anim)
             return;
         mActors.emplace(ptr, new Actor(ptr, anim));
+        mActorGridValid = false;
 
         CharacterController* ctrl = mActors[ptr]->getCharacterController();
         if (updateImmediately)
@@ -1661,6 +1683,7 @@ namespace MWMechanics
         {
             delete iter->second;
             mActors.erase(iter);
+            mActorGridValid = false;
         }
     }
 
@@ -1713,6 +1736,7 @@ namespace MWMechanics
 
             actor->updatePtr(ptr);
             mActors.insert(std::make_pair(ptr, actor));
+            mActorGridValid = false;
         }
     }
 
@@ -1725,6 +1749,7 @@ namespace MWMechanics
             {
                 delete iter->second;
                 mActors.erase(iter++);
+                mActorGridValid = false;
             }
             else
                 ++iter;
@@ -1787,6 +1812,30 @@ namespace MWMechanics
 
         MWWorld::Ptr player = getPlayer();
         MWBase::World* world = MWBase::Environment::get().getWorld();
+
+        // Bucket the actors into a coarse X/Y grid up front so every actor only tests
+        // neighbours within avoidance range instead of every other processed actor;
+        // with a crowd piled up at a doorway the quadratic scan gets very noticeable.
+        const float gridCellSize = maxDistForPartialAvoiding;
+        const auto gridKey = [] (int cellX, int cellY)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32)
+                | static_cast<uint32_t>(cellY);
+        };
+        // The grid and the neighbour list only live until the end of this call, so build them
+        // in the frame arena instead of hitting the general-purpose allocator every frame.
+        using PtrFrameVector = std::vector<MWWorld::Ptr, Misc::FrameAllocator<MWWorld::Ptr>>;
+        std::unordered_map<uint64_t, PtrFrameVector, std::hash<uint64_t>, std::equal_to<uint64_t>,
+            Misc::FrameAllocator<std::pair<const uint64_t, PtrFrameVector>>> actorGrid;
+        for(PtrActorMap::iterator iter(mActors.begin()); iter != mActors.end(); ++iter)
+        {
+            const osg::Vec3f pos = iter->first.getRefData().getPosition().asVec3();
+            const int cellX = static_cast<int>(std::floor(pos.x() / gridCellSize));
+            const int cellY = static_cast<int>(std::floor(pos.y() / gridCellSize));
+            actorGrid[gridKey(cellX, cellY)].push_back(iter->first);
+        }
+        PtrFrameVector neighbours;
+
         for(PtrActorMap::iterator iter(mActors.begin()); iter != mActors.end(); ++iter)
         {
             const MWWorld::Ptr& ptr = iter->first;
@@ -1844,10 +1893,22 @@ namespace MWMechanics
                     ? std::numeric_limits<float>::max()
                     : getTimeToDestination(**aiSequence.begin(), basePos, maxSpeed, duration, halfExtents);
 
-            // Iterate through all other actors and predict collisions.
-            for(PtrActorMap::iterator otherIter(mActors.begin()); otherIter != mActors.end(); ++otherIter)
+            // Every check below is limited to maxDistForPartialAvoiding, i.e. one grid
+            // cell, so the 3x3 neighbourhood around the actor covers all candidates.
+            const int baseCellX = static_cast<int>(std::floor(basePos.x() / gridCellSize));
+            const int baseCellY = static_cast<int>(std::floor(basePos.y() / gridCellSize));
+            neighbours.clear();
+            for (int cellX = baseCellX - 1; cellX <= baseCellX + 1; ++cellX)
+                for (int cellY = baseCellY - 1; cellY <= baseCellY + 1; ++cellY)
+                {
+                    const auto bucket = actorGrid.find(gridKey(cellX, cellY));
+                    if (bucket != actorGrid.end())
+                        neighbours.insert(neighbours.end(), bucket->second.begin(), bucket->second.end());
+                }
+
+            // Iterate through the nearby actors and predict collisions.
+            for (const MWWorld::Ptr& otherPtr : neighbours)
             {
-                const MWWorld::Ptr& otherPtr = otherIter->first;
                 if (otherPtr == ptr || otherPtr == currentTarget)
                     continue;
 
@@ -1919,6 +1980,10 @@ namespace MWMechanics
 
     void Actors::update (float duration, bool paused)
     {
+        // actor positions change every frame, so the proximity grid is rebuilt
+        // on the first range query of the frame
+        mActorGridValid = false;
+
         if(!paused)
         {
             static float timerUpdateHeadTrack = 0;
@@ -1953,6 +2018,14 @@ namespace MWMechanics
             }
             bool godmode = MWBase::Environment::get().getWorld()->getGodModeState();
 
+            ++mAiFrameCounter;
+            mAiTierCounts.fill(0);
+            const float nearProcessingRange = mActorsProcessingRange * 0.5f;
+            std::size_t actorIndex = 0;
+            // Positions of the actors whose AI may request paths this frame; passed to the
+            // navigator so queued navmesh tiles are built closest-agent-first.
+            std::vector<osg::Vec3f> agentsPositions;
+
              // AI and magic effects update
             for(PtrActorMap::iterator iter(mActors.begin()); iter != mActors.end(); ++iter)
             {
@@ -1965,6 +2038,26 @@ namespace MWMechanics
                 // AI processing is only done within given distance to the player.
                 bool inProcessingRange = distSqr <= mActorsProcessingRange*mActorsProcessingRange;
 
+                // Tiered AI scheduling: nearby actors and actors in combat run their AI packages
+                // every frame, the rest of the actors in processing range every other frame and
+                // out-of-range actors in a round-robin batch. Time from skipped frames is
+                // accumulated and passed to the next scheduled update so package timing is
+                // preserved, and movement continues every frame from the last issued commands.
+                AiUpdateTier tier = AiUpdateTier::Near;
+                if (!inProcessingRange)
+                    tier = AiUpdateTier::Far;
+                else if (!isPlayer && distSqr > nearProcessingRange*nearProcessingRange
+                        && !iter->first.getClass().getCreatureStats(iter->first).getAiSequence().isInCombat())
+                    tier = AiUpdateTier::Mid;
+                iter->second->setAiUpdateTier(tier);
+                if (aiActive && inProcessingRange && !isPlayer
+                        && !iter->first.getClass().getCreatureStats(iter->first).isDead())
+                    agentsPositions.push_back(iter->first.getRefData().getPosition().asVec3());
+                ++mAiTierCounts[static_cast<std::size_t>(tier)];
+                const unsigned int aiStride = tier == AiUpdateTier::Near ? 1 : (tier == AiUpdateTier::Mid ? 2 : 4);
+                const bool aiDue = (actorIndex++ + mAiFrameCounter) % aiStride == 0;
+                const float aiDuration = iter->second->updateAiTimer(duration, aiDue);
+
                 if (isPlayer)
                     ctrl->setAttackingOrSpell(world->getPlayer().getAttackingOrSpell());
 
@@ -2063,17 +2156,20 @@ namespace MWMechanics
                             CreatureStats &stats = iter->first.getClass().getCreatureStats(iter->first);
                             if (isConscious(iter->first) && !(luaControls && luaControls->mDisableAI))
                             {
-                                stats.getAiSequence().execute(iter->first, *ctrl, duration);
-                                updateGreetingState(iter->first, *iter->second, timerUpdateHello > 0);
-                                playIdleDialogue(iter->first);
+                                if (aiDuration > 0.f)
+                                {
+                                    stats.getAiSequence().execute(iter->first, *ctrl, aiDuration);
+                                    updateGreetingState(iter->first, *iter->second, timerUpdateHello > 0);
+                                    playIdleDialogue(iter->first);
+                                }
                                 updateMovementSpeed(iter->first);
                             }
                         }
                     }
-                    else if (aiActive && iter->first != player && isConscious(iter->first) && !(luaControls && luaControls->mDisableAI))
+                    else if (aiActive && aiDuration > 0.f && iter->first != player && isConscious(iter->first) && !(luaControls && luaControls->mDisableAI))
                     {
                         CreatureStats &stats = iter->first.getClass().getCreatureStats(iter->first);
-                        stats.getAiSequence().execute(iter->first, *ctrl, duration, /*outOfRange*/true);
+                        stats.getAiSequence().execute(iter->first, *ctrl, aiDuration, /*outOfRange*/true);
                     }
 
                     if(iter->first.getClass().isNpc())
@@ -2117,6 +2213,8 @@ namespace MWMechanics
                 }
             }
 
+            world->getNavigator()->setAgentsPositions(agentsPositions);
+
             static const bool avoidCollisions = Settings::Manager::getBool("NPCs avoid collisions", "Game");
             if (avoidCollisions)
                 predictAndAvoidCollisions(duration);
@@ -2127,6 +2225,8 @@ namespace MWMechanics
             mTimerDisposeSummonsCorpses += duration;
 
             // Animation/movement update
+            static const int offscreenAnimationInterval = std::max(1, Settings::Manager::getInt("offscreen animation update interval", "Game"));
+            std::size_t animationIndex = 0;
             CharacterController* playerCharacter = nullptr;
             for(PtrActorMap::iterator iter(mActors.begin()); iter != mActors.end(); ++iter)
             {
@@ -2171,7 +2271,22 @@ namespace MWMechanics
                 }
 
                 world->setActorCollisionMode(iter->first, true, !iter->first.getClass().getCreatureStats(iter->first).isDeathAnimationFinished());
-                ctrl->update(duration);
+
+                // Characters that are off screen are updated at a reduced rate, with the summed
+                // duration passed on the next scheduled update so that animation state and text
+                // keys stay correct, they just advance in larger steps.
+                bool animationDue = true;
+                if (offscreenAnimationInterval > 1 && !ctrl->wasVisible() && !stats.getAiSequence().isInCombat())
+                    animationDue = (animationIndex++ + mAiFrameCounter) % offscreenAnimationInterval == 0;
+                const float animationDuration = iter->second->updateAnimationTimer(duration, animationDue);
+                if (animationDuration == 0.f && duration > 0.f)
+                {
+                    // Keep applying the last known velocity so travelling actors do not slow
+                    // down on the frames they are skipped
+                    world->queueMovement(iter->first, ctrl->getLastQueuedMovement());
+                    continue;
+                }
+                ctrl->update(animationDuration);
 
                 updateVisibility(iter->first, ctrl);
             }
@@ -2531,21 +2646,94 @@ namespace MWMechanics
             iter->second->getCharacterController()->persistAnimationState();
     }
 
-    void Actors::getObjectsInRange(const osg::Vec3f& position, float radius, std::vector<MWWorld::Ptr>& out)
+    void Actors::buildActorGrid()
     {
+        mActorGrid.clear();
         for (PtrActorMap::iterator iter = mActors.begin(); iter != mActors.end(); ++iter)
         {
-            if ((iter->first.getRefData().getPosition().asVec3() - position).length2() <= radius*radius)
-                out.push_back(iter->first);
+            const osg::Vec3f pos = iter->first.getRefData().getPosition().asVec3();
+            const int cellX = static_cast<int>(std::floor(pos.x() / sActorGridCellSize));
+            const int cellY = static_cast<int>(std::floor(pos.y() / sActorGridCellSize));
+            mActorGrid[actorGridKey(cellX, cellY)].push_back(iter->first);
+        }
+        mActorGridValid = true;
+    }
+
+    void Actors::getObjectsInRange(const osg::Vec3f& position, float radius, std::vector<MWWorld::Ptr>& out)
+    {
+        if (!mActorGridValid)
+            buildActorGrid();
+
+        const int minX = static_cast<int>(std::floor((position.x() - radius) / sActorGridCellSize));
+        const int maxX = static_cast<int>(std::floor((position.x() + radius) / sActorGridCellSize));
+        const int minY = static_cast<int>(std::floor((position.y() - radius) / sActorGridCellSize));
+        const int maxY = static_cast<int>(std::floor((position.y() + radius) / sActorGridCellSize));
+
+        const auto inRange = [&] (const MWWorld::Ptr& ptr)
+        {
+            return (ptr.getRefData().getPosition().asVec3() - position).length2() <= radius*radius;
+        };
+
+        // For a radius spanning more cells than there are occupied buckets (e.g. the
+        // actor processing range), probing cell by cell would cost more than it saves.
+        if (static_cast<std::size_t>(maxX - minX + 1) * static_cast<std::size_t>(maxY - minY + 1) >= mActorGrid.size())
+        {
+            for (const auto& bucket : mActorGrid)
+                for (const MWWorld::Ptr& ptr : bucket.second)
+                    if (inRange(ptr))
+                        out.push_back(ptr);
+            return;
+        }
+
+        for (int cellX = minX; cellX <= maxX; ++cellX)
+        {
+            for (int cellY = minY; cellY <= maxY; ++cellY)
+            {
+                const auto bucket = mActorGrid.find(actorGridKey(cellX, cellY));
+                if (bucket == mActorGrid.end())
+                    continue;
+                for (const MWWorld::Ptr& ptr : bucket->second)
+                    if (inRange(ptr))
+                        out.push_back(ptr);
+            }
         }
     }
 
     bool Actors::isAnyObjectInRange(const osg::Vec3f& position, float radius)
     {
-        for (PtrActorMap::iterator iter = mActors.begin(); iter != mActors.end(); ++iter)
+        if (!mActorGridValid)
+            buildActorGrid();
+
+        const int minX = static_cast<int>(std::floor((position.x() - radius) / sActorGridCellSize));
+        const int maxX = static_cast<int>(std::floor((position.x() + radius) / sActorGridCellSize));
+        const int minY = static_cast<int>(std::floor((position.y() - radius) / sActorGridCellSize));
+        const int maxY = static_cast<int>(std::floor((position.y() + radius) / sActorGridCellSize));
+
+        const auto inRange = [&] (const MWWorld::Ptr& ptr)
         {
-            if ((iter->first.getRefData().getPosition().asVec3() - position).length2() <= radius*radius)
-                return true;
+            return (ptr.getRefData().getPosition().asVec3() - position).length2() <= radius*radius;
+        };
+
+        if (static_cast<std::size_t>(maxX - minX + 1) * static_cast<std::size_t>(maxY - minY + 1) >= mActorGrid.size())
+        {
+            for (const auto& bucket : mActorGrid)
+                for (const MWWorld::Ptr& ptr : bucket.second)
+                    if (inRange(ptr))
+                        return true;
+            return false;
+        }
+
+        for (int cellX = minX; cellX <= maxX; ++cellX)
+        {
+            for (int cellY = minY; cellY <= maxY; ++cellY)
+            {
+                const auto bucket = mActorGrid.find(actorGridKey(cellX, cellY));
+                if (bucket == mActorGrid.end())
+                    continue;
+                for (const MWWorld::Ptr& ptr : bucket->second)
+                    if (inRange(ptr))
+                        return true;
+            }
         }
 
         return false;
@@ -2754,6 +2942,8 @@ namespace MWMechanics
             it->second = nullptr;
         }
         mActors.clear();
+        mActorGrid.clear();
+        mActorGridValid = false;
         mDeathCount.clear();
     }
 
@@ -2820,6 +3010,15 @@ namespace MWMechanics
         return it->second->getGreetingState();
     }
 
+    AiUpdateTier Actors::getAiUpdateTier(const MWWorld::Ptr& ptr) const
+    {
+        PtrActorMap::const_iterator it = mActors.find(ptr);
+        if (it == mActors.end())
+            return AiUpdateTier::Near;
+
+        return it->second->getAiUpdateTier();
+    }
+
     bool Actors::isTurningToPlayer(const MWWorld::Ptr& ptr) const
     {
         PtrActorMap::const_iterator it = mActors.find(ptr);
@@ -1,11 +1,14 @@
 #ifndef GAME_MWMECHANICS_ACTORS_H
 #define GAME_MWMECHANICS_ACTORS_H
 
+#include <array>
+#include <cstdint>
 #include <set>
 #include <vector>
 #include <string>
 #include <list>
 #include <map>
+#include <unordered_map>
 
 #include "../mwmechanics/actorutil.hpp"
 
@@ -76,6 +79,9 @@ namespace MWMechanics
             PtrActorMap::const_iterator end() { return mActors.end(); }
             std::size_t size() const { return mActors.size(); }
 
+            /// Number of actors that were in the given AI scheduling tier during the last update
+            std::size_t getAiTierCount(AiUpdateTier tier) const { return mAiTierCounts[static_cast<std::size_t>(tier)]; }
+
             void notifyDied(const MWWorld::Ptr &actor);
 
             /// Check if the target actor was detected by an observer
@@ -205,14 +211,27 @@ namespace MWMechanics
             float getAngleToPlayer(const MWWorld::Ptr& ptr) const;
             GreetingState getGreetingState(const MWWorld::Ptr& ptr) const;
             bool isTurningToPlayer(const MWWorld::Ptr& ptr) const;
+            AiUpdateTier getAiUpdateTier(const MWWorld::Ptr& ptr) const;
 
     private:
         void updateVisibility (const MWWorld::Ptr& ptr, CharacterController* ctrl);
         void applyCureEffects (const MWWorld::Ptr& actor);
 
+        // Uniform X/Y grid over all active actors, shared by every proximity query that
+        // goes through getObjectsInRange/isAnyObjectInRange. Rebuilt lazily on the first
+        // query after an invalidation (a new frame or an actor added/removed), so frames
+        // without range queries pay nothing.
+        std::unordered_map<uint64_t, std::vector<MWWorld::Ptr>> mActorGrid;
+        bool mActorGridValid = false;
+
+        void buildActorGrid();
+
         PtrActorMap mActors;
         float mTimerDisposeSummonsCorpses;
         float mActorsProcessingRange;
+        // AI scheduling state, see the tier assignment in update()
+        unsigned int mAiFrameCounter = 0;
+        std::array<std::size_t, static_cast<std::size_t>(AiUpdateTier::Count)> mAiTierCounts{};
 
         bool mSmoothMovement;
     };
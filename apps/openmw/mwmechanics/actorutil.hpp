@@ -28,6 +28,15 @@ namespace MWMechanics
         Greet_Done
     };
 
+    /// AI scheduling tier, assigned every frame based on the distance to the player.
+    enum class AiUpdateTier
+    {
+        Near = 0, // full AI update every frame
+        Mid, // reduced AI update rate, movement continues every frame
+        Far, // outside of the AI processing distance, updated round-robin
+        Count
+    };
+
     MWWorld::Ptr getPlayer();
     bool isPlayerInCombat();
     bool canActorMoveByZAxis(const MWWorld::Ptr& actor);
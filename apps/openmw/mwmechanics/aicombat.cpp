@@ -493,32 +493,63 @@ namespace MWMechanics
             if (targetUsesRanged || distToTarget > rangeAttackOfTarget*1.5) // Don't back up if the target is wielding ranged weapon
                 return;
 
+            MWBase::World* world = MWBase::Environment::get().getWorld();
+
             // actor should not back up into water
-            if (MWBase::Environment::get().getWorld()->isUnderwater(MWWorld::ConstPtr(actor), 0.5f))
+            if (world->isUnderwater(MWWorld::ConstPtr(actor), 0.5f))
                 return;
 
             int mask = MWPhysics::CollisionType_World | MWPhysics::CollisionType_HeightMap | MWPhysics::CollisionType_Door;
 
-            // Actor can not back up if there is no free space behind
-            // Currently we take the 35% of actor's height from the ground as vector height.
-            // This approach allows us to detect small obstacles (e.g. crates) and curved walls.
-            osg::Vec3f halfExtents = MWBase::Environment::get().getWorld()->getHalfExtents(actor);
-            osg::Vec3f pos = actor.getRefData().getPosition().asVec3();
-            osg::Vec3f source = pos + osg::Vec3f(0, 0, 0.75f * halfExtents.z());
-            osg::Vec3f fallbackDirection = actor.getRefData().getBaseNode()->getAttitude() * osg::Vec3f(0,-1,0);
-            osg::Vec3f destination = source + fallbackDirection * (halfExtents.y() + 16);
-
-            bool isObstacleDetected = MWBase::Environment::get().getWorld()->castRay(source.x(), source.y(), source.z(), destination.x(), destination.y(), destination.z(), mask);
-            if (isObstacleDetected)
+            if (!mObstacleRayQuery && !mObstacleRayHit.has_value())
+            {
+                // The rays are processed by the physics worker threads; backing up
+                // only starts once the results arrive, usually by the next reaction.
+
+                // Actor can not back up if there is no free space behind
+                // Currently we take the 35% of actor's height from the ground as vector height.
+                // This approach allows us to detect small obstacles (e.g. crates) and curved walls.
+                osg::Vec3f halfExtents = world->getHalfExtents(actor);
+                osg::Vec3f pos = actor.getRefData().getPosition().asVec3();
+                osg::Vec3f source = pos + osg::Vec3f(0, 0, 0.75f * halfExtents.z());
+                osg::Vec3f fallbackDirection = actor.getRefData().getBaseNode()->getAttitude() * osg::Vec3f(0,-1,0);
+                osg::Vec3f destination = source + fallbackDirection * (halfExtents.y() + 16);
+                mObstacleRayQuery = world->asyncCastRay(source, destination, mask);
+
+                // Check if there is nothing behind - probably actor is near cliff.
+                // A current approach: cast ray 1.5-yard ray down in 1.5 yard behind actor from 35% of actor's height.
+                // If we did not hit anything, there is a cliff behind actor.
+                source = pos + osg::Vec3f(0, 0, 0.75f * halfExtents.z()) + fallbackDirection * (halfExtents.y() + 96);
+                destination = source - osg::Vec3f(0, 0, 0.75f * halfExtents.z() + 96);
+                mCliffRayQuery = world->asyncCastRay(source, destination, mask);
+                return;
+            }
+
+            if (mObstacleRayQuery)
+            {
+                if (std::optional<bool> hit = world->retrieveAsyncRayCastResult(mObstacleRayQuery))
+                {
+                    mObstacleRayHit = hit;
+                    mObstacleRayQuery = 0;
+                }
+            }
+            if (mCliffRayQuery)
+            {
+                if (std::optional<bool> hit = world->retrieveAsyncRayCastResult(mCliffRayQuery))
+                {
+                    mCliffRayHit = hit;
+                    mCliffRayQuery = 0;
+                }
+            }
+            if (!mObstacleRayHit.has_value() || !mCliffRayHit.has_value())
                 return;
 
-            // Check if there is nothing behind - probably actor is near cliff.
-            // A current approach: cast ray 1.5-yard ray down in 1.5 yard behind actor from 35% of actor's height.
-            // If we did not hit anything, there is a cliff behind actor.
-            source = pos + osg::Vec3f(0, 0, 0.75f * halfExtents.z()) + fallbackDirection * (halfExtents.y() + 96);
-            destination = source - osg::Vec3f(0, 0, 0.75f * halfExtents.z() + 96);
-            bool isCliffDetected = !MWBase::Environment::get().getWorld()->castRay(source.x(), source.y(), source.z(), destination.x(), destination.y(), destination.z(), mask);
-            if (isCliffDetected)
+            bool isObstacleDetected = *mObstacleRayHit;
+            bool isCliffDetected = !*mCliffRayHit;
+            mObstacleRayHit.reset();
+            mCliffRayHit.reset();
+
+            if (isObstacleDetected || isCliffDetected)
                 return;
 
             mMovement.mPosition[1] = -1;
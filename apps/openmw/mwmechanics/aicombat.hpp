@@ -58,6 +58,14 @@ namespace MWMechanics
         bool mUseCustomDestination;
         osg::Vec3f mCustomDestination;
 
+        // In-flight obstacle/cliff rays for the backing up check in startCombatMove;
+        // 0 while no ray is pending. The hit results are kept until both rays have
+        // been answered, since they do not necessarily resolve in the same frame.
+        std::size_t mObstacleRayQuery;
+        std::size_t mCliffRayQuery;
+        std::optional<bool> mObstacleRayHit;
+        std::optional<bool> mCliffRayHit;
+
         AiCombatStorage():
         mAttackCooldown(0.0f),
         mTimerCombatMove(0.0f),
@@ -78,7 +86,9 @@ namespace MWMechanics
         mUpdateLOSTimer(0.0f),
         mFleeBlindRunTimer(0.0f),
         mUseCustomDestination(false),
-        mCustomDestination()
+        mCustomDestination(),
+        mObstacleRayQuery(0),
+        mCliffRayQuery(0)
         {}
 
         void startCombatMove(bool isDistantCombat, float distToTarget, float rangeAttack, const MWWorld::Ptr& actor, const MWWorld::Ptr& target);
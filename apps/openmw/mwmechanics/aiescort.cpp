@@ -79,7 +79,8 @@ namespace MWMechanics
         if ((leaderPos - followerPos).length2() <= mMaxDist * mMaxDist)
         {
             const osg::Vec3f dest(mX, mY, mZ);
-            if (pathTo(actor, dest, duration, maxHalfExtent)) //Returns true on path complete
+            // Accept partial paths so long escort routes are planned coarsely and refined leg by leg
+            if (pathTo(actor, dest, duration, maxHalfExtent, 0.0f, PathType::Partial)) //Returns true on path complete
             {
                 mRemainingDuration = mDuration;
                 return true;
@@ -112,6 +112,10 @@ bool MWMechanics::AiPackage::pathTo(const MWWorld::Ptr& actor, const osg::Vec3f&
 
     mLastDestinationTolerance = destTolerance;
 
+    // Adopt a path requested on a previous frame once the navigator has finished it
+    if (mPathFinder.hasPendingPath() && mPathFinder.pollAsyncPath(getPathGridGraph(actor.getCell())))
+        mRotateOnTheRunChecks = 3;
+
     const float distToTarget = distance(position, dest);
     const bool isDestReached = (distToTarget <= destTolerance);
     const bool actorCanMoveByZ = canActorMoveByZAxis(actor);
@@ -133,21 +137,27 @@ bool MWMechanics::AiPackage::pathTo(const MWWorld::Ptr& actor, const osg::Vec3f&
             if (wasShortcutting || doesPathNeedRecalc(dest, actor)) // if need to rebuild path
             {
                 const auto pathfindingHalfExtents = world->getPathfindingHalfExtents(actor);
-                mPathFinder.buildLimitedPath(actor, position, dest, actor.getCell(), getPathGridGraph(actor.getCell()),
+                mPathFinder.buildLimitedPathAsync(actor, position, dest, actor.getCell(), getPathGridGraph(actor.getCell()),
                     pathfindingHalfExtents, getNavigatorFlags(actor), getAreaCosts(actor), endTolerance, pathType);
-                mRotateOnTheRunChecks = 3;
 
-                // give priority to go directly on target if there is minimal opportunity
-                if (destInLOS && mPathFinder.getPath().size() > 1)
+                // The new path is usually adopted on a later frame; when it was built inline
+                // apply the post-processing right away
+                if (!mPathFinder.hasPendingPath())
                 {
-                    // get point just before dest
-                    auto pPointBeforeDest = mPathFinder.getPath().rbegin() + 1;
+                    mRotateOnTheRunChecks = 3;
 
-                    // if start point is closer to the target then last point of path (excluding target itself) then go straight on the target
-                    if (distance(position, dest) <= distance(dest, *pPointBeforeDest))
+                    // give priority to go directly on target if there is minimal opportunity
+                    if (destInLOS && mPathFinder.getPath().size() > 1)
                     {
-                        mPathFinder.clearPath();
-                        mPathFinder.addPointToPath(dest);
+                        // get point just before dest
+                        auto pPointBeforeDest = mPathFinder.getPath().rbegin() + 1;
+
+                        // if start point is closer to the target then last point of path (excluding target itself) then go straight on the target
+                        if (distance(position, dest) <= distance(dest, *pPointBeforeDest))
+                        {
+                            mPathFinder.clearPath();
+                            mPathFinder.addPointToPath(dest);
+                        }
                     }
                 }
             }
@@ -372,7 +382,11 @@ bool MWMechanics::AiPackage::checkWayIsClearForActor(const osg::Vec3f& startPoin
 
 bool MWMechanics::AiPackage::doesPathNeedRecalc(const osg::Vec3f& newDest, const MWWorld::Ptr& actor) const
 {
+    // A partial path ends at an intermediate waypoint; once its remaining points are nearly
+    // consumed, plan the next leg from there instead of walking the straight tail towards the
+    // destination that pathTo appends.
     return mPathFinder.getPath().empty()
+        || (mPathFinder.isPartialPath() && mPathFinder.getPath().size() <= 2)
         || getPathDistance(actor, mPathFinder.getPath().back(), newDest) > 10
         || mPathFinder.getPathCell() != actor.getCell();
 }
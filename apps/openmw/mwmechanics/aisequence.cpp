@@ -280,15 +280,19 @@ void AiSequence::execute (const MWWorld::Ptr& actor, CharacterController& charac
         {
             if (package->execute(actor, characterController, mAiState, duration))
             {
-                // Put repeating noncombat AI packages on the end of the stack so they can be used again
+                // Put repeating noncombat AI packages on the end of the stack so they can be used again.
+                // Splicing the list node spares cloning the package and freeing the old node just to
+                // re-add an identical one - repeating wander cycles are steady allocator churn in crowds.
+                // Note that packageIt is used rather than begin() to account for the rare case where
+                // AiPackage::execute() queued another AI package (e.g. AiPursue executing a dialogue
+                // script that uses startCombat)
                 if (isActualAiPackage(packageTypeId) && (mRepeat || package->getRepeat()))
                 {
                     package->reset();
-                    mPackages.push_back(package->clone());
+                    mPackages.splice(mPackages.end(), mPackages, packageIt);
                 }
-                // To account for the rare case where AiPackage::execute() queued another AI package
-                // (e.g. AiPursue executing a dialogue script that uses startCombat)
-                mPackages.erase(packageIt);
+                else
+                    mPackages.erase(packageIt);
                 if (isActualAiPackage(packageTypeId))
                     mDone = true;
             }
@@ -83,7 +83,8 @@ namespace MWMechanics
             }
         }
 
-        if (pathTo(actor, targetPos, duration))
+        // Accept partial paths so long travel routes are planned coarsely and refined leg by leg
+        if (pathTo(actor, targetPos, duration, 0.0f, 0.0f, PathType::Partial))
         {
             actor.getClass().getMovementSettings(actor).mPosition[1] = 0;
             return true;
@@ -19,7 +19,9 @@
 
 #include "character.hpp"
 
+#include <cstdlib>
 #include <iostream>
+#include <string_view>
 
 #include <components/misc/mathutil.hpp>
 #include <components/misc/rng.hpp>
@@ -53,6 +55,15 @@
 namespace
 {
 
+// Compares a text key against "<groupname>: <action>" without building the concatenated string
+bool isTextKey (const std::string& evt, const std::string& groupname, std::string_view action)
+{
+    return evt.size() == groupname.size() + 2 + action.size()
+        && evt.compare(0, groupname.size(), groupname) == 0
+        && evt.compare(groupname.size(), 2, ": ") == 0
+        && evt.compare(groupname.size() + 2, action.size(), action.data(), action.size()) == 0;
+}
+
 std::string getBestAttack (const ESM::Weapon* weapon)
 {
     int slash = (weapon->mData.mSlash[0] + weapon->mData.mSlash[1])/2;
@@ -858,6 +869,7 @@ CharacterController::CharacterController(const MWWorld::Ptr &ptr, MWRender::Anim
     , mCastingManualSpell(false)
     , mTimeUntilWake(0.f)
     , mIsMovingBackward(false)
+    , mLastQueuedMovement(0.f, 0.f, 0.f)
 {
     if(!mAnimation)
         return;
@@ -955,30 +967,27 @@ void CharacterController::handleTextKey(const std::string &groupname, SceneUtil:
     }
     if(evt.compare(0, 10, "soundgen: ") == 0)
     {
-        std::string soundgen = evt.substr(10);
+        std::string_view soundgen = std::string_view(evt).substr(10);
 
         // The event can optionally contain volume and pitch modifiers
         float volume=1.f, pitch=1.f;
-        if (soundgen.find(' ') != std::string::npos)
-        {
-            std::vector<std::string> tokens;
-            Misc::StringUtils::split(soundgen, tokens);
-            soundgen = tokens[0];
-            if (tokens.size() >= 2)
-            {
-                std::stringstream stream;
-                stream << tokens[1];
-                stream >> volume;
-            }
-            if (tokens.size() >= 3)
-            {
-                std::stringstream stream;
-                stream << tokens[2];
-                stream >> pitch;
-            }
-        }
-
-        std::string sound = mPtr.getClass().getSoundIdFromSndGen(mPtr, soundgen);
+        const size_t space = soundgen.find(' ');
+        if (space != std::string_view::npos)
+        {
+            // evt is null-terminated, so strtof can not run past the end of the key
+            const char* cursor = soundgen.data() + space + 1;
+            char* end = nullptr;
+            float value = std::strtof(cursor, &end);
+            if (end != cursor)
+                volume = value;
+            cursor = end;
+            value = std::strtof(cursor, &end);
+            if (end != cursor)
+                pitch = value;
+            soundgen = soundgen.substr(0, space);
+        }
+
+        std::string sound = mPtr.getClass().getSoundIdFromSndGen(mPtr, std::string(soundgen));
         if(!sound.empty())
         {
             MWBase::SoundManager *sndMgr = MWBase::Environment::get().getSoundManager();
@@ -1039,12 +1048,12 @@ void CharacterController::handleTextKey(const std::string &groupname, SceneUtil:
         bool hasHitKey = false;
         while (hitKey != map.end())
         {
-            if (hitKey->second == groupname + ": hit")
+            if (isTextKey(hitKey->second, groupname, "hit"))
             {
                 hasHitKey = true;
                 break;
             }
-            if (hitKey->second == groupname + ": stop")
+            if (isTextKey(hitKey->second, groupname, "stop"))
                 break;
             ++hitKey;
         }
@@ -1065,10 +1074,11 @@ void CharacterController::handleTextKey(const std::string &groupname, SceneUtil:
     else if (evt.compare(off, len, "shoot follow attach") == 0)
         mAnimation->attachArrow();
 
-    else if (groupname == "spellcast" && evt.substr(evt.size()-7, 7) == "release"
-             // Make sure this key is actually for the RangeType we are casting. The flame atronach has
-             // the same animation for all range types, so there are 3 "release" keys on the same time, one for each range type.
-             && evt.compare(off, len, mAttackType + " release") == 0)
+    // Make sure this key is actually for the RangeType we are casting. The flame atronach has
+    // the same animation for all range types, so there are 3 "release" keys on the same time, one for each range type.
+    else if (groupname == "spellcast" && len == mAttackType.size() + 8
+             && evt.compare(off, mAttackType.size(), mAttackType) == 0
+             && evt.compare(off + mAttackType.size(), 8, " release") == 0)
     {
         MWBase::Environment::get().getWorld()->castSpell(mPtr, mCastingManualSpell);
         mCastingManualSpell = false;
@@ -1316,7 +1326,7 @@ bool CharacterController::updateWeaponState(CharacterState& idle)
                 mAnimation->detachArrow();
 
                 // If we do not have the "unequip detach" key, hide weapon manually.
-                if (mAnimation->getTextKeyTime(weapgroup+": unequip detach") < 0)
+                if (mAnimation->getTextKeyTime(weapgroup, "unequip detach") < 0)
                     mAnimation->showWeapons(false);
             }
 
@@ -1370,7 +1380,7 @@ bool CharacterController::updateWeaponState(CharacterState& idle)
                         // If we do not have the "equip attach" key, show weapon manually.
                         if (weaptype != ESM::Weapon::Spell)
                         {
-                            if (mAnimation->getTextKeyTime(weapgroup+": equip attach") < 0)
+                            if (mAnimation->getTextKeyTime(weapgroup, "equip attach") < 0)
                                 mAnimation->showWeapons(true);
                         }
                     }
@@ -1677,8 +1687,8 @@ bool CharacterController::updateWeaponState(CharacterState& idle)
         if(mUpperBodyState == UpperCharState_MinAttackToMaxAttack && !isKnockedDown())
         {
             float attackStrength = complete;
-            float minAttackTime = mAnimation->getTextKeyTime(mCurrentWeapon+": "+mAttackType+" "+"min attack");
-            float maxAttackTime = mAnimation->getTextKeyTime(mCurrentWeapon+": "+mAttackType+" "+"max attack");
+            float minAttackTime = mAnimation->getTextKeyTime(mCurrentWeapon, mAttackType + " min attack");
+            float maxAttackTime = mAnimation->getTextKeyTime(mCurrentWeapon, mAttackType + " max attack");
             if (minAttackTime == maxAttackTime)
             {
                 // most creatures don't actually have an attack wind-up animation, so use a uniform random value
@@ -1789,8 +1799,8 @@ bool CharacterController::updateWeaponState(CharacterState& idle)
                     // If actor is already stopped preparing attack, do not play the "min attack -> max attack" part.
                     // Happens if the player did not hold the attack button.
                     // Note: if the "min attack"->"max attack" is a stub, "play" it anyway. Attack strength will be random.
-                    float minAttackTime = mAnimation->getTextKeyTime(mCurrentWeapon+": "+mAttackType+" "+"min attack");
-                    float maxAttackTime = mAnimation->getTextKeyTime(mCurrentWeapon+": "+mAttackType+" "+"max attack");
+                    float minAttackTime = mAnimation->getTextKeyTime(mCurrentWeapon, mAttackType + " min attack");
+                    float maxAttackTime = mAnimation->getTextKeyTime(mCurrentWeapon, mAttackType + " max attack");
                     if (mAttackingOrSpell || minAttackTime == maxAttackTime)
                     {
                         start = mAttackType+" min attack";
@@ -2399,7 +2409,10 @@ void CharacterController::update(float duration)
             }
 
             if (!mMovementAnimationControlled)
+            {
                 world->queueMovement(mPtr, vec);
+                mLastQueuedMovement = vec;
+            }
         }
 
         movement = vec;
@@ -2462,7 +2475,10 @@ void CharacterController::update(float duration)
 
     // Update movement
     if(mMovementAnimationControlled && mPtr.getClass().isActor())
+    {
         world->queueMovement(mPtr, moved);
+        mLastQueuedMovement = moved;
+    }
 
     mSkipAnim = false;
 
@@ -2520,8 +2536,8 @@ void CharacterController::unpersistAnimationState()
         float complete = anim.mTime;
         if (anim.mAbsolute)
         {
-            float start = mAnimation->getTextKeyTime(anim.mGroup+": start");
-            float stop = mAnimation->getTextKeyTime(anim.mGroup+": stop");
+            float start = mAnimation->getTextKeyTime(anim.mGroup, "start");
+            float stop = mAnimation->getTextKeyTime(anim.mGroup, "stop");
             float time = std::max(start, std::min(stop, anim.mTime));
             complete = (time - start) / (stop - start);
         }
@@ -2551,13 +2567,13 @@ bool CharacterController::playGroup(const std::string &groupname, int mode, int
     // and remove any other animations that were queued.
     // This emulates observed behavior from the original allows the script "OutsideBanner" to animate banners correctly.
     if (!mAnimQueue.empty() && mAnimQueue.front().mGroup == groupname &&
-        mAnimation->getTextKeyTime(mAnimQueue.front().mGroup + ": loop start") >= 0 &&
+        mAnimation->getTextKeyTime(mAnimQueue.front().mGroup, "loop start") >= 0 &&
         mAnimation->isPlaying(groupname))
     {
-        float endOfLoop = mAnimation->getTextKeyTime(mAnimQueue.front().mGroup+": loop stop");
+        float endOfLoop = mAnimation->getTextKeyTime(mAnimQueue.front().mGroup, "loop stop");
 
         if (endOfLoop < 0) // if no Loop Stop key was found, use the Stop key
-            endOfLoop = mAnimation->getTextKeyTime(mAnimQueue.front().mGroup+": stop");
+            endOfLoop = mAnimation->getTextKeyTime(mAnimQueue.front().mGroup, "stop");
 
         if (endOfLoop > 0 && (mAnimation->getCurrentTime(mAnimQueue.front().mGroup) < endOfLoop))
         {
@@ -2899,6 +2915,16 @@ void CharacterController::setActive(int active)
     mAnimation->setActive(active);
 }
 
+bool CharacterController::wasVisible() const
+{
+    return mAnimation->wasVisible();
+}
+
+const osg::Vec3f& CharacterController::getLastQueuedMovement() const
+{
+    return mLastQueuedMovement;
+}
+
 void CharacterController::setHeadTrackTarget(const MWWorld::ConstPtr &target)
 {
     mHeadTrackTarget = target;
@@ -195,6 +195,7 @@ class CharacterController : public MWRender::Animation::TextKeyListener
 
     bool mIsMovingBackward;
     osg::Vec2f mSmoothedSpeed;
+    osg::Vec3f mLastQueuedMovement;
 
     void setAttackTypeBasedOnMovement();
 
@@ -298,6 +299,13 @@ public:
     /// @see Animation::setActive
     void setActive(int active);
 
+    /// @see Animation::wasVisible
+    bool wasVisible() const;
+
+    /// Movement velocity queued to the world during the last update, so that reduced
+    /// rate updates for off screen characters do not slow down their travel.
+    const osg::Vec3f& getLastQueuedMovement() const;
+
     /// Make this character turn its head towards \a target. To turn off head tracking, pass an empty Ptr.
     void setHeadTrackTarget(const MWWorld::ConstPtr& target);
 
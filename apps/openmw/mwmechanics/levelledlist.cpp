@@ -0,0 +1,277 @@
+#include "levelledlist.hpp"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <typeinfo>
+
+#include <components/debug/debuglog.hpp>
+#include <components/esm/loadlevlist.hpp>
+#include <components/misc/stringops.hpp>
+
+#include "../mwbase/world.hpp"
+#include "../mwbase/environment.hpp"
+
+#include "../mwworld/class.hpp"
+#include "../mwworld/esmstore.hpp"
+#include "../mwworld/manualref.hpp"
+
+#include "creaturestats.hpp"
+#include "actorutil.hpp"
+
+namespace
+{
+
+    // Lists that flatten to more outcomes than this (absurdly nested mod content) are
+    // resolved recursively instead of through the tables.
+    const std::size_t sMaxOutcomes = 8192;
+
+    bool isAllLevels (const ESM::LevelledListBase* levItem, bool creature)
+    {
+        // For levelled creatures, the flags are swapped. This file format just makes so much sense.
+        if (creature)
+            return (levItem->mFlags & ESM::CreatureLevList::AllLevels) != 0;
+        return (levItem->mFlags & ESM::ItemLevList::AllLevels) != 0;
+    }
+
+    const ESM::LevelledListBase* findSubList (const MWWorld::ESMStore& store, const std::string& lowerId, bool& creature)
+    {
+        if (const ESM::ItemLevList* itemList = store.get<ESM::ItemLevList>().search(lowerId))
+        {
+            creature = false;
+            return itemList;
+        }
+        if (const ESM::CreatureLevList* creatureList = store.get<ESM::CreatureLevList>().search(lowerId))
+        {
+            creature = true;
+            return creatureList;
+        }
+        return nullptr;
+    }
+
+    // The candidate set of a list only changes at the levels mentioned in it or in its
+    // sub lists, so those are the only player levels that need a table.
+    void collectLevels (const MWWorld::ESMStore& store, const ESM::LevelledListBase* levItem,
+        std::set<int>& levels, std::set<const ESM::LevelledListBase*>& visited)
+    {
+        if (!visited.insert(levItem).second)
+            return;
+
+        for (const auto& levelledItem : levItem->mList)
+        {
+            levels.insert(levelledItem.mLevel);
+            bool subCreature = false;
+            if (const ESM::LevelledListBase* subList = findSubList(store, Misc::StringUtils::lowerCase(levelledItem.mId), subCreature))
+                collectLevels(store, subList, levels, visited);
+        }
+    }
+
+    // Accumulates the probability of every terminal outcome of \a levItem at the given
+    // player level. Returns false when the table exceeds sMaxOutcomes.
+    bool flatten (const MWWorld::ESMStore& store, const ESM::LevelledListBase* levItem, bool creature,
+        int playerLevel, double weight, bool warn, std::map<std::string, double>& outcomes,
+        double& chanceNone, std::vector<const ESM::LevelledListBase*>& stack)
+    {
+        if (std::find(stack.begin(), stack.end(), levItem) != stack.end())
+        {
+            // cyclic list - this pick can never terminate, treat it as producing nothing
+            chanceNone += weight;
+            return true;
+        }
+
+        double none = weight * levItem->mChanceNone / 100.0;
+        chanceNone += none;
+        weight -= none;
+
+        int highestLevel = 0;
+        for (const auto& levelledItem : levItem->mList)
+        {
+            if (levelledItem.mLevel > highestLevel && levelledItem.mLevel <= playerLevel)
+                highestLevel = levelledItem.mLevel;
+        }
+
+        bool allLevels = isAllLevels(levItem, creature);
+
+        std::vector<const ESM::LevelledListBase::LevelItem*> candidates;
+        for (const auto& levelledItem : levItem->mList)
+        {
+            if (playerLevel >= levelledItem.mLevel
+                    && (allLevels || levelledItem.mLevel == highestLevel))
+                candidates.push_back(&levelledItem);
+        }
+        if (candidates.empty())
+        {
+            chanceNone += weight;
+            return true;
+        }
+
+        weight /= candidates.size();
+
+        stack.push_back(levItem);
+        for (const ESM::LevelledListBase::LevelItem* candidate : candidates)
+        {
+            const std::string lowerId = Misc::StringUtils::lowerCase(candidate->mId);
+            bool subCreature = false;
+            if (const ESM::LevelledListBase* subList = findSubList(store, lowerId, subCreature))
+            {
+                if (!flatten(store, subList, subCreature, playerLevel, weight, warn, outcomes, chanceNone, stack))
+                {
+                    stack.pop_back();
+                    return false;
+                }
+            }
+            else if (!store.find(lowerId))
+            {
+                // Vanilla doesn't fail on nonexistent items in levelled lists
+                if (warn)
+                    Log(Debug::Warning) << "Warning: ignoring nonexistent item '" << candidate->mId << "' in levelled list '" << levItem->mId << "'";
+                chanceNone += weight;
+            }
+            else
+            {
+                outcomes[candidate->mId] += weight;
+                if (outcomes.size() > sMaxOutcomes)
+                {
+                    stack.pop_back();
+                    return false;
+                }
+            }
+        }
+        stack.pop_back();
+        return true;
+    }
+
+    // The pre-table resolution algorithm, kept for lists the flattening gives up on.
+    std::string resolveRecursively (const ESM::LevelledListBase* levItem, bool creature, int playerLevel, Misc::Rng::Seed& seed)
+    {
+        const std::vector<ESM::LevelledListBase::LevelItem>& items = levItem->mList;
+
+        if (Misc::Rng::roll0to99(seed) < levItem->mChanceNone)
+            return std::string();
+
+        std::vector<std::string> candidates;
+        int highestLevel = 0;
+        for (const auto& levelledItem : items)
+        {
+            if (levelledItem.mLevel > highestLevel && levelledItem.mLevel <= playerLevel)
+                highestLevel = levelledItem.mLevel;
+        }
+
+        bool allLevels = isAllLevels(levItem, creature);
+
+        for (const auto& levelledItem : items)
+        {
+            if (playerLevel >= levelledItem.mLevel
+                    && (allLevels || levelledItem.mLevel == highestLevel))
+                candidates.push_back(levelledItem.mId);
+        }
+        if (candidates.empty())
+            return std::string();
+        std::string item = candidates[Misc::Rng::rollDice(candidates.size(), seed)];
+
+        // Vanilla doesn't fail on nonexistent items in levelled lists
+        if (!MWBase::Environment::get().getWorld()->getStore().find(Misc::StringUtils::lowerCase(item)))
+        {
+            Log(Debug::Warning) << "Warning: ignoring nonexistent item '" << item << "' in levelled list '" << levItem->mId << "'";
+            return std::string();
+        }
+
+        // Is this another levelled item or a real item?
+        MWWorld::ManualRef ref (MWBase::Environment::get().getWorld()->getStore(), item, 1);
+        if (ref.getPtr().getTypeName() != typeid(ESM::ItemLevList).name()
+                && ref.getPtr().getTypeName() != typeid(ESM::CreatureLevList).name())
+        {
+            return item;
+        }
+        else
+        {
+            if (ref.getPtr().getTypeName() == typeid(ESM::ItemLevList).name())
+                return resolveRecursively(ref.getPtr().get<ESM::ItemLevList>()->mBase, false, playerLevel, seed);
+            else
+                return resolveRecursively(ref.getPtr().get<ESM::CreatureLevList>()->mBase, true, playerLevel, seed);
+        }
+    }
+
+}
+
+namespace MWMechanics
+{
+
+    std::shared_ptr<const FlattenedLevelledList> flattenLevelledList (const MWWorld::ESMStore& store, const ESM::LevelledListBase* levItem, bool creature)
+    {
+        std::shared_ptr<FlattenedLevelledList> flattened = std::make_shared<FlattenedLevelledList>();
+
+        std::set<int> levels;
+        {
+            std::set<const ESM::LevelledListBase*> visited;
+            collectLevels(store, levItem, levels, visited);
+        }
+
+        for (int level : levels)
+        {
+            std::map<std::string, double> outcomes;
+            double chanceNone = 0.0;
+            std::vector<const ESM::LevelledListBase*> stack;
+            if (!flatten(store, levItem, creature, level, 1.0, flattened->mTables.empty(), outcomes, chanceNone, stack))
+            {
+                flattened->mTables.clear();
+                flattened->mResolveRecursively = true;
+                return flattened;
+            }
+
+            FlattenedLevelledList::Table table;
+            table.mMinPlayerLevel = level;
+            table.mChanceNone = chanceNone;
+            table.mCumulativeChance.reserve(outcomes.size());
+            table.mIds.reserve(outcomes.size());
+            double cumulative = chanceNone;
+            for (const auto& [id, chance] : outcomes)
+            {
+                cumulative += chance;
+                table.mCumulativeChance.push_back(cumulative);
+                table.mIds.push_back(id);
+            }
+
+            // a level step that only matters to an excluded branch produces the same table again
+            if (!flattened->mTables.empty()
+                    && flattened->mTables.back().mChanceNone == table.mChanceNone
+                    && flattened->mTables.back().mIds == table.mIds
+                    && flattened->mTables.back().mCumulativeChance == table.mCumulativeChance)
+                continue;
+
+            flattened->mTables.push_back(std::move(table));
+        }
+
+        return flattened;
+    }
+
+    std::string getLevelledItem (const ESM::LevelledListBase* levItem, bool creature, Misc::Rng::Seed& seed)
+    {
+        const MWWorld::ESMStore& store = MWBase::Environment::get().getWorld()->getStore();
+        std::shared_ptr<const FlattenedLevelledList> flattened = store.getLevelledListTables(levItem, creature);
+
+        const MWWorld::Ptr& player = getPlayer();
+        int playerLevel = player.getClass().getCreatureStats(player).getLevel();
+
+        if (flattened->mResolveRecursively)
+            return resolveRecursively(levItem, creature, playerLevel, seed);
+
+        const std::vector<FlattenedLevelledList::Table>& tables = flattened->mTables;
+        auto it = std::upper_bound(tables.begin(), tables.end(), playerLevel,
+            [] (int level, const FlattenedLevelledList::Table& table) { return level < table.mMinPlayerLevel; });
+        if (it == tables.begin())
+            return std::string();
+        const FlattenedLevelledList::Table& table = *--it;
+        if (table.mIds.empty())
+            return std::string();
+
+        double roll = Misc::Rng::rollClosedProbability(seed);
+        if (roll < table.mChanceNone)
+            return std::string();
+        auto outcome = std::lower_bound(table.mCumulativeChance.begin(), table.mCumulativeChance.end(), roll);
+        if (outcome == table.mCumulativeChance.end())
+            --outcome; // the summed chances fall short of the roll by a rounding error
+        return table.mIds[outcome - table.mCumulativeChance.begin()];
+    }
+
+}
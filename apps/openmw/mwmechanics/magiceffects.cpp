@@ -1,10 +1,21 @@
 #include "magiceffects.hpp"
 
+#include <algorithm>
+#include <map>
 #include <stdexcept>
 
 #include <components/esm/effectlist.hpp>
 #include <components/esm/magiceffects.hpp>
 
+namespace
+{
+    bool compareKey(const std::pair<MWMechanics::EffectKey, MWMechanics::EffectParam>& value,
+                    const MWMechanics::EffectKey& key)
+    {
+        return value.first < key;
+    }
+}
+
 namespace MWMechanics
 {
     EffectKey::EffectKey() : mId (0), mArg (-1) {}
@@ -84,18 +95,31 @@ namespace MWMechanics
         return *this;
     }
 
+    EffectParam& MagicEffects::getOrInsert(const EffectKey& key)
+    {
+        Collection::iterator iter = std::lower_bound(mCollection.begin(), mCollection.end(), key, compareKey);
+
+        if (iter == mCollection.end() || key < iter->first)
+            iter = mCollection.insert(iter, std::make_pair(key, EffectParam()));
+
+        return iter->second;
+    }
+
     void MagicEffects::remove(const EffectKey &key)
     {
-        mCollection.erase(key);
+        Collection::iterator iter = std::lower_bound(mCollection.begin(), mCollection.end(), key, compareKey);
+
+        if (iter != mCollection.end() && !(key < iter->first))
+            mCollection.erase(iter);
     }
 
     void MagicEffects::add (const EffectKey& key, const EffectParam& param)
     {
-        Collection::iterator iter = mCollection.find (key);
+        Collection::iterator iter = std::lower_bound(mCollection.begin(), mCollection.end(), key, compareKey);
 
-        if (iter==mCollection.end())
+        if (iter == mCollection.end() || key < iter->first)
         {
-            mCollection.insert (std::make_pair (key, param));
+            mCollection.insert (iter, std::make_pair (key, param));
         }
         else
         {
@@ -105,20 +129,32 @@ namespace MWMechanics
 
     void MagicEffects::modifyBase(const EffectKey &key, int diff)
     {
-        mCollection[key].modifyBase(diff);
+        getOrInsert(key).modifyBase(diff);
     }
 
     void MagicEffects::setModifiers(const MagicEffects &effects)
     {
-        for (Collection::iterator it = mCollection.begin(); it != mCollection.end(); ++it)
-        {
-            it->second.setModifier(effects.get(it->first).getModifier());
-        }
+        // Both collections are sorted, walk them in lockstep: entries not present in
+        // \a effects get their modifier reset, the rest take the modifier from \a effects.
+        Collection::iterator it = mCollection.begin();
 
-        for (Collection::const_iterator it = effects.begin(); it != effects.end(); ++it)
+        for (Collection::const_iterator other = effects.begin(); other != effects.end(); ++other)
         {
-            mCollection[it->first].setModifier(it->second.getModifier());
+            while (it != mCollection.end() && it->first < other->first)
+            {
+                it->second.setModifier(0.f);
+                ++it;
+            }
+
+            if (it == mCollection.end() || other->first < it->first)
+                it = mCollection.insert(it, std::make_pair(other->first, EffectParam()));
+
+            it->second.setModifier(other->second.getModifier());
+            ++it;
         }
+
+        for (; it != mCollection.end(); ++it)
+            it->second.setModifier(0.f);
     }
 
     MagicEffects& MagicEffects::operator+= (const MagicEffects& effects)
@@ -130,14 +166,18 @@ namespace MWMechanics
             return *this;
         }
 
-        for (Collection::const_iterator iter (effects.begin()); iter!=effects.end(); ++iter)
+        Collection::iterator it = mCollection.begin();
+
+        for (Collection::const_iterator other = effects.begin(); other != effects.end(); ++other)
         {
-            Collection::iterator result = mCollection.find (iter->first);
+            it = std::lower_bound(it, mCollection.end(), other->first, compareKey);
 
-            if (result!=mCollection.end())
-                result->second += iter->second;
+            if (it != mCollection.end() && !(other->first < it->first))
+                it->second += other->second;
             else
-                mCollection.insert (*iter);
+                it = mCollection.insert(it, *other);
+
+            ++it;
         }
 
         return *this;
@@ -145,9 +185,9 @@ namespace MWMechanics
 
     EffectParam MagicEffects::get (const EffectKey& key) const
     {
-        Collection::const_iterator iter = mCollection.find (key);
+        Collection::const_iterator iter = std::lower_bound(mCollection.begin(), mCollection.end(), key, compareKey);
 
-        if (iter==mCollection.end())
+        if (iter == mCollection.end() || key < iter->first)
         {
             return EffectParam();
         }
@@ -161,30 +201,31 @@ namespace MWMechanics
     {
         MagicEffects result;
 
-        // adding/changing
-        for (Collection::const_iterator iter (now.begin()); iter!=now.end(); ++iter)
-        {
-            Collection::const_iterator other = prev.mCollection.find (iter->first);
+        // Both collections are sorted, so the changes can be built in a single pass
+        // and result.add() always appends
+        Collection::const_iterator prevIt = prev.begin();
+        Collection::const_iterator nowIt = now.begin();
 
-            if (other==prev.end())
+        while (prevIt != prev.end() || nowIt != now.end())
+        {
+            if (nowIt == now.end() || (prevIt != prev.end() && prevIt->first < nowIt->first))
+            {
+                // removing
+                result.add (prevIt->first, EffectParam() - prevIt->second);
+                ++prevIt;
+            }
+            else if (prevIt == prev.end() || nowIt->first < prevIt->first)
             {
                 // adding
-                result.add (iter->first, iter->second);
+                result.add (nowIt->first, nowIt->second);
+                ++nowIt;
             }
             else
             {
                 // changing
-                result.add (iter->first, iter->second - other->second);
-            }
-        }
-
-        // removing
-        for (Collection::const_iterator iter (prev.begin()); iter!=prev.end(); ++iter)
-        {
-            Collection::const_iterator other = now.mCollection.find (iter->first);
-            if (other==now.end())
-            {
-                result.add (iter->first, EffectParam() - iter->second);
+                result.add (nowIt->first, nowIt->second - prevIt->second);
+                ++prevIt;
+                ++nowIt;
             }
         }
 
@@ -208,7 +249,7 @@ namespace MWMechanics
     {
         for (std::map<int, int>::const_iterator it = state.mEffects.begin(); it != state.mEffects.end(); ++it)
         {
-            mCollection[EffectKey(it->first)].setBase(it->second);
+            getOrInsert(EffectKey(it->first)).setBase(it->second);
         }
     }
 }
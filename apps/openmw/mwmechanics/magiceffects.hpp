@@ -1,8 +1,9 @@
 #ifndef GAME_MWMECHANICS_MAGICEFFECTS_H
 #define GAME_MWMECHANICS_MAGICEFFECTS_H
 
-#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace ESM
 {
@@ -84,12 +85,17 @@ namespace MWMechanics
     {
         public:
 
-            typedef std::map<EffectKey, EffectParam> Collection;
+            // Sorted by EffectKey. A flat vector instead of a node based map: the set of effects
+            // on an actor is small and these collections are rebuilt and merged every frame, so
+            // allocation-free merges and cheap iteration matter more than cheap random insertion.
+            typedef std::vector<std::pair<EffectKey, EffectParam>> Collection;
 
         private:
 
             Collection mCollection;
 
+            EffectParam& getOrInsert (const EffectKey& key);
+
         public:
 
             Collection::const_iterator begin() const { return mCollection.begin(); }
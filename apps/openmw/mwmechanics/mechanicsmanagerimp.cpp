@@ -1879,6 +1879,9 @@ namespace MWMechanics
     void MechanicsManager::reportStats(unsigned int frameNumber, osg::Stats& stats) const
     {
         stats.setAttribute(frameNumber, "Mechanics Actors", mActors.size());
+        stats.setAttribute(frameNumber, "Mechanics Actors Near", mActors.getAiTierCount(AiUpdateTier::Near));
+        stats.setAttribute(frameNumber, "Mechanics Actors Mid", mActors.getAiTierCount(AiUpdateTier::Mid));
+        stats.setAttribute(frameNumber, "Mechanics Actors Far", mActors.getAiTierCount(AiUpdateTier::Far));
         stats.setAttribute(frameNumber, "Mechanics Objects", mObjects.size());
     }
 
@@ -1897,6 +1900,11 @@ namespace MWMechanics
         return mActors.getGreetingState(ptr);
     }
 
+    AiUpdateTier MechanicsManager::getAiUpdateTier(const MWWorld::Ptr& ptr) const
+    {
+        return mActors.getAiUpdateTier(ptr);
+    }
+
     bool MechanicsManager::isTurningToPlayer(const MWWorld::Ptr &ptr) const
     {
         return mActors.isTurningToPlayer(ptr);
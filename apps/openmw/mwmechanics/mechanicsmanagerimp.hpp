@@ -228,6 +228,7 @@ namespace MWMechanics
             int getGreetingTimer(const MWWorld::Ptr& ptr) const override;
             float getAngleToPlayer(const MWWorld::Ptr& ptr) const override;
             GreetingState getGreetingState(const MWWorld::Ptr& ptr) const override;
+            AiUpdateTier getAiUpdateTier(const MWWorld::Ptr& ptr) const override;
             bool isTurningToPlayer(const MWWorld::Ptr& ptr) const override;
 
             void restoreStatsAfterCorprus(const MWWorld::Ptr& actor, const std::string& sourceId) override;
@@ -345,15 +345,19 @@ namespace MWMechanics
     void PathFinder::buildStraightPath(const osg::Vec3f& endPoint)
     {
         mPath.clear();
+        mAsyncRequest.reset();
         mPath.push_back(endPoint);
         mConstructed = true;
+        mPartialPath = false;
     }
 
     void PathFinder::buildPathByPathgrid(const osg::Vec3f& startPoint, const osg::Vec3f& endPoint,
         const MWWorld::CellStore* cell, const PathgridGraph& pathgridGraph)
     {
         mPath.clear();
+        mAsyncRequest.reset();
         mCell = cell;
+        mPartialPath = false;
 
         buildPathByPathgridImpl(startPoint, endPoint, pathgridGraph, std::back_inserter(mPath));
 
@@ -365,6 +369,8 @@ namespace MWMechanics
         const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType)
     {
         mPath.clear();
+        mAsyncRequest.reset();
+        mPartialPath = false;
 
         // If it's not possible to build path over navmesh due to disabled navmesh generation fallback to straight path
         DetourNavigator::Status status = buildPathByNavigatorImpl(actor, startPoint, endPoint, halfExtents, flags,
@@ -385,7 +391,9 @@ namespace MWMechanics
         PathType pathType)
     {
         mPath.clear();
+        mAsyncRequest.reset();
         mCell = cell;
+        mPartialPath = false;
 
         DetourNavigator::Status status = DetourNavigator::Status::NavMeshNotFound;
 
@@ -422,11 +430,17 @@ namespace MWMechanics
         const auto world = MWBase::Environment::get().getWorld();
         const auto stepSize = getPathStepSize(actor);
         const auto navigator = world->getNavigator();
-        const auto status = navigator->findPath(halfExtents, stepSize, startPoint, endPoint, flags, areaCosts,
+        // Partial-path builds may plan long routes coarsely over the navmesh tile grid
+        const auto usedFlags = pathType == PathType::Partial
+            ? flags | DetourNavigator::Flag_useCoarsePath : flags;
+        const auto status = navigator->findPath(halfExtents, stepSize, startPoint, endPoint, usedFlags, areaCosts,
                                                 endTolerance, out);
 
         if (pathType == PathType::Partial && status == DetourNavigator::Status::PartialPath)
+        {
+            mPartialPath = true;
             return DetourNavigator::Status::Success;
+        }
 
         if (status != DetourNavigator::Status::Success)
         {
@@ -497,4 +511,117 @@ namespace MWMechanics
         const auto end = startPoint + startToEnd * maxDistance / distance;
         buildPath(actor, startPoint, end, cell, pathgridGraph, halfExtents, flags, areaCosts, endTolerance, pathType);
     }
+
+    void PathFinder::buildLimitedPathAsync(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
+        const osg::Vec3f& endPoint, const MWWorld::CellStore* cell, const PathgridGraph& pathgridGraph,
+        const osg::Vec3f& halfExtents, const DetourNavigator::Flags flags,
+        const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType)
+    {
+        // A previous request is still in flight, it will be adopted by pollAsyncPath
+        if (mAsyncRequest.has_value())
+            return;
+
+        // Water and flying creatures path by pathgrid only which is cheap enough to run inline
+        if (actor.getClass().isPureWaterCreature(actor) || actor.getClass().isPureFlyingCreature(actor))
+        {
+            buildLimitedPath(actor, startPoint, endPoint, cell, pathgridGraph, halfExtents, flags, areaCosts,
+                             endTolerance, pathType);
+            return;
+        }
+
+        const auto navigator = MWBase::Environment::get().getWorld()->getNavigator();
+        const auto maxDistance = std::min(
+            navigator->getMaxNavmeshAreaRealRadius(),
+            static_cast<float>(Constants::CellSizeInUnits)
+        );
+        const auto startToEnd = endPoint - startPoint;
+        const auto distance = startToEnd.length();
+        const osg::Vec3f end = distance <= maxDistance
+            ? endPoint : startPoint + startToEnd * maxDistance / distance;
+
+        AsyncRequest request;
+        request.mStartPoint = startPoint;
+        request.mEndPoint = end;
+        request.mCell = cell;
+        request.mHalfExtents = halfExtents;
+        request.mStepSize = getPathStepSize(actor);
+        // Partial-path builds may plan long routes coarsely over the navmesh tile grid
+        request.mFlags = pathType == PathType::Partial
+            ? flags | DetourNavigator::Flag_useCoarsePath : flags;
+        request.mAreaCosts = areaCosts;
+        request.mEndTolerance = endTolerance;
+        request.mPathType = pathType;
+        request.mHandle = navigator->findPathAsync(halfExtents, request.mStepSize, startPoint, end, request.mFlags,
+                                                   areaCosts, endTolerance);
+
+        if (request.mHandle == 0)
+        {
+            // The navigator can not serve asynchronous queries, build the path inline
+            buildPath(actor, startPoint, end, cell, pathgridGraph, halfExtents, flags, areaCosts,
+                      endTolerance, pathType);
+            return;
+        }
+
+        mAsyncRequest = request;
+    }
+
+    bool PathFinder::pollAsyncPath(const PathgridGraph& pathgridGraph)
+    {
+        if (!mAsyncRequest.has_value())
+            return false;
+
+        const auto navigator = MWBase::Environment::get().getWorld()->getNavigator();
+        auto result = navigator->getPathQueryResult(mAsyncRequest->mHandle);
+        if (!result.has_value())
+            return false;
+
+        AsyncRequest request = *mAsyncRequest;
+        mAsyncRequest.reset();
+
+        DetourNavigator::Status status = result->mStatus;
+        mPartialPath = false;
+        if (request.mPathType == PathType::Partial && status == DetourNavigator::Status::PartialPath)
+        {
+            status = DetourNavigator::Status::Success;
+            mPartialPath = true;
+        }
+
+        if (status != DetourNavigator::Status::Success && status != DetourNavigator::Status::NavMeshNotFound)
+        {
+            Log(Debug::Debug) << "Build path by navigator error: \"" << DetourNavigator::getMessage(status)
+                << "\" from " << request.mStartPoint << " to " << request.mEndPoint << " with flags ("
+                << DetourNavigator::WriteFlags {request.mFlags} << ")";
+        }
+
+        mPath.clear();
+        mCell = request.mCell;
+
+        if (status == DetourNavigator::Status::Success)
+            std::copy(result->mPath.begin(), result->mPath.end(), std::back_inserter(mPath));
+
+        // Like buildPath, retry with pathgrid following before giving up on the navmesh entirely
+        if (status != DetourNavigator::Status::NavMeshNotFound && mPath.empty()
+                && (request.mFlags & DetourNavigator::Flag_usePathgrid) == 0)
+        {
+            request.mFlags = request.mFlags | DetourNavigator::Flag_usePathgrid;
+            request.mHandle = navigator->findPathAsync(request.mHalfExtents, request.mStepSize,
+                request.mStartPoint, request.mEndPoint, request.mFlags, request.mAreaCosts,
+                request.mEndTolerance);
+            if (request.mHandle != 0)
+            {
+                mAsyncRequest = request;
+                return false;
+            }
+        }
+
+        if (mPath.empty())
+            buildPathByPathgridImpl(request.mStartPoint, request.mEndPoint, pathgridGraph,
+                                    std::back_inserter(mPath));
+
+        if (status == DetourNavigator::Status::NavMeshNotFound && mPath.empty())
+            mPath.push_back(request.mEndPoint);
+
+        mConstructed = !mPath.empty();
+        return true;
+    }
 }
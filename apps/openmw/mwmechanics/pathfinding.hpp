@@ -4,6 +4,7 @@
 #include <deque>
 #include <cassert>
 #include <iterator>
+#include <optional>
 
 #include <components/detournavigator/flags.hpp>
 #include <components/detournavigator/areatype.hpp>
@@ -88,8 +89,10 @@ namespace MWMechanics
             void clearPath()
             {
                 mConstructed = false;
+                mPartialPath = false;
                 mPath.clear();
                 mCell = nullptr;
+                mAsyncRequest.reset();
             }
 
             void buildStraightPath(const osg::Vec3f& endPoint);
@@ -114,6 +117,24 @@ namespace MWMechanics
                 const DetourNavigator::Flags flags, const DetourNavigator::AreaCosts& areaCosts, float endTolerance,
                 PathType pathType);
 
+            /// Asynchronous version of buildLimitedPath: submits the navmesh query to the navigator's
+            /// background threads, to be adopted by a later pollAsyncPath call. While a request is
+            /// pending the current path is kept so the actor continues to move along it. Falls back to
+            /// a synchronous build when the navigator can not serve asynchronous queries.
+            void buildLimitedPathAsync(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
+                const osg::Vec3f& endPoint, const MWWorld::CellStore* cell, const PathgridGraph& pathgridGraph,
+                const osg::Vec3f& halfExtents, const DetourNavigator::Flags flags,
+                const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType);
+
+            bool hasPendingPath() const
+            {
+                return mAsyncRequest.has_value();
+            }
+
+            /// Adopt the result of a pending asynchronous request if the navigator has completed it.
+            /// \return true if a new path was adopted during this call
+            bool pollAsyncPath(const PathgridGraph& pathgridGraph);
+
             /// Remove front point if exist and within tolerance
             void update(const osg::Vec3f& position, float pointTolerance, float destinationTolerance,
                         bool shortenIfAlmostStraight, bool canMoveByZ, const osg::Vec3f& halfExtents,
@@ -134,6 +155,14 @@ namespace MWMechanics
                 return mConstructed && !mPath.empty();
             }
 
+            /// Whether the last constructed path ends at an intermediate waypoint instead of the
+            /// requested destination (a PathType::Partial build that was cut short, e.g. a coarse
+            /// long-range leg). Such paths are meant to be rebuilt once they are nearly consumed.
+            bool isPartialPath() const
+            {
+                return mPartialPath;
+            }
+
             std::size_t getPathSize() const
             {
                 return mPath.size();
@@ -210,11 +239,28 @@ namespace MWMechanics
             }
 
         private:
+            struct AsyncRequest
+            {
+                std::size_t mHandle = 0;
+                osg::Vec3f mStartPoint;
+                osg::Vec3f mEndPoint;
+                const MWWorld::CellStore* mCell = nullptr;
+                osg::Vec3f mHalfExtents;
+                float mStepSize = 0;
+                DetourNavigator::Flags mFlags = DetourNavigator::Flag_none;
+                DetourNavigator::AreaCosts mAreaCosts;
+                float mEndTolerance = 0;
+                PathType mPathType = PathType::Full;
+            };
+
             bool mConstructed;
+            bool mPartialPath = false;
             std::deque<osg::Vec3f> mPath;
 
             const MWWorld::CellStore* mCell;
 
+            std::optional<AsyncRequest> mAsyncRequest;
+
             void buildPathByPathgridImpl(const osg::Vec3f& startPoint, const osg::Vec3f& endPoint,
                 const PathgridGraph& pathgridGraph, std::back_insert_iterator<std::deque<osg::Vec3f>> out);
 
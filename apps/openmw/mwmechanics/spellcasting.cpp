@@ -327,6 +327,21 @@ namespace MWMechanics
         }
     }
 
+    bool isInstantEffect(short effectId)
+    {
+        // Mirrors the effects handled by applyInstantEffect below; everything else is rejected
+        // there without side effects.
+        return effectId == ESM::MagicEffect::Lock
+            || effectId == ESM::MagicEffect::Open
+            || effectId == ESM::MagicEffect::Dispel
+            || (effectId >= ESM::MagicEffect::CalmHumanoid && effectId <= ESM::MagicEffect::RallyCreature)
+            || effectId == ESM::MagicEffect::TurnUndead
+            || effectId == ESM::MagicEffect::DivineIntervention
+            || effectId == ESM::MagicEffect::AlmsiviIntervention
+            || effectId == ESM::MagicEffect::Mark
+            || effectId == ESM::MagicEffect::Recall;
+    }
+
     bool CastSpell::applyInstantEffect(const MWWorld::Ptr &target, const MWWorld::Ptr &caster, const MWMechanics::EffectKey& effect, float magnitude)
     {
         short effectId = effect.mId;
@@ -17,6 +17,10 @@ namespace MWMechanics
 {
     struct EffectKey;
 
+    /// Can the given effect be handled by CastSpell::applyInstantEffect (e.g. Open, Dispel, Recall)?
+    /// Lets per-frame callers skip the call entirely for the many effects it would reject anyway.
+    bool isInstantEffect(short effectId);
+
     class CastSpell
     {
     private:
@@ -19,6 +19,12 @@ namespace
         return MWBase::Environment::get().getWorld()->getStore().get<T>().find(id)->mSpells.mList;
     }
 
+    template<class T>
+    std::size_t getStoreRevision()
+    {
+        return MWBase::Environment::get().getWorld()->getStore().get<T>().getRevision();
+    }
+
     template<class T>
     bool withBaseRecord(const std::string& id, const std::function<bool(std::vector<std::string>&)>& function)
     {
@@ -47,17 +53,32 @@ namespace MWMechanics
         }
     }
 
-    const std::vector<std::string> SpellList::getSpells() const
+    const std::vector<std::string>& SpellList::getSpells() const
     {
+        std::size_t revision;
         switch(mType)
         {
             case ESM::REC_CREA:
-                return getSpellList<ESM::Creature>(mId);
+                revision = getStoreRevision<ESM::Creature>();
+                break;
             case ESM::REC_NPC_:
-                return getSpellList<ESM::NPC>(mId);
+                revision = getStoreRevision<ESM::NPC>();
+                break;
             default:
                 throw std::logic_error("failed to get spell list for " + mId);
         }
+
+        if(!mSpellsCached || revision != mCachedStoreRevision)
+        {
+            if(mType == ESM::REC_CREA)
+                mCachedSpells = getSpellList<ESM::Creature>(mId);
+            else
+                mCachedSpells = getSpellList<ESM::NPC>(mId);
+            mCachedStoreRevision = revision;
+            mSpellsCached = true;
+        }
+
+        return mCachedSpells;
     }
 
     const ESM::Spell* SpellList::getSpell(const std::string& id)
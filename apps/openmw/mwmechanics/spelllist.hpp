@@ -1,6 +1,7 @@
 #ifndef GAME_MWMECHANICS_SPELLLIST_H
 #define GAME_MWMECHANICS_SPELLLIST_H
 
+#include <cstddef>
 #include <functional>
 #include <map>
 #include <string>
@@ -38,6 +39,12 @@ namespace MWMechanics
             const int mType;
             std::vector<Spells*> mListeners;
 
+            // The resolved list is requested over and over (spell auto-calc, services, UI),
+            // so cache it and only rebuild when the base record store has changed.
+            mutable std::vector<std::string> mCachedSpells;
+            mutable std::size_t mCachedStoreRevision = 0;
+            mutable bool mSpellsCached = false;
+
             bool withBaseRecord(const std::function<bool(std::vector<std::string>&)>& function);
         public:
             SpellList(const std::string& id, int type);
@@ -61,7 +68,7 @@ namespace MWMechanics
 
             void updateListener(Spells* before, Spells* after);
 
-            const std::vector<std::string> getSpells() const;
+            const std::vector<std::string>& getSpells() const;
     };
 }
 
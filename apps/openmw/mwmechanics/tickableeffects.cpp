@@ -49,11 +49,13 @@ namespace MWMechanics
 
             if (charge == 0)
             {
-                // Will unequip the broken item and try to find a replacement
+                // Unequip the broken item and, for NPCs, try to find a replacement.
+                // The explicit unequip also tells the inventory that its last
+                // auto-equip result is out of date - breaking an item does not
+                // modify the container contents.
+                inv.unequipItem(*item, ptr);
                 if (ptr != getPlayer())
                     inv.autoEquip(ptr);
-                else
-                    inv.unequipItem(*item, ptr);
             }
 
             return true;
@@ -62,9 +64,40 @@ namespace MWMechanics
         return false;
     }
 
+    bool isTickableEffect(short effectId)
+    {
+        // Mirrors the cases handled by effectTick below
+        switch (effectId)
+        {
+        case ESM::MagicEffect::DamageAttribute:
+        case ESM::MagicEffect::RestoreAttribute:
+        case ESM::MagicEffect::RestoreHealth:
+        case ESM::MagicEffect::RestoreMagicka:
+        case ESM::MagicEffect::RestoreFatigue:
+        case ESM::MagicEffect::DamageHealth:
+        case ESM::MagicEffect::DamageMagicka:
+        case ESM::MagicEffect::DamageFatigue:
+        case ESM::MagicEffect::AbsorbHealth:
+        case ESM::MagicEffect::AbsorbMagicka:
+        case ESM::MagicEffect::AbsorbFatigue:
+        case ESM::MagicEffect::DisintegrateArmor:
+        case ESM::MagicEffect::DisintegrateWeapon:
+        case ESM::MagicEffect::SunDamage:
+        case ESM::MagicEffect::FireDamage:
+        case ESM::MagicEffect::ShockDamage:
+        case ESM::MagicEffect::FrostDamage:
+        case ESM::MagicEffect::Poison:
+        case ESM::MagicEffect::DamageSkill:
+        case ESM::MagicEffect::RestoreSkill:
+            return true;
+        default:
+            return false;
+        }
+    }
+
     bool effectTick(CreatureStats& creatureStats, const MWWorld::Ptr& actor, const EffectKey &effectKey, float magnitude)
     {
-        if (magnitude == 0.f)
+        if (magnitude == 0.f || !isTickableEffect(effectKey.mId))
             return false;
 
         bool receivedMagicDamage = false;
@@ -11,6 +11,11 @@ namespace MWMechanics
     class CreatureStats;
     struct EffectKey;
 
+    /// Does the given effect have a lasting impact that is applied in tick intervals (e.g. Damage Health)?
+    /// Most effects are not tickable, so callers iterating over an actor's full effect list every frame
+    /// should test this before paying for effectTick.
+    bool isTickableEffect(short effectId);
+
     /// Apply a magic effect that is applied in tick intervals until its remaining time ends or it is removed
     /// Note: this function works in loop, so magic effects should not be removed here to avoid iterator invalidation.
     /// @return Was the effect a tickable effect with a magnitude?
@@ -191,6 +191,12 @@ void Actor::applyOffsetChange()
     mWorldPositionChanged = true;
 }
 
+bool Actor::hasPendingPositionChange() const
+{
+    std::scoped_lock lock(mPositionMutex);
+    return mPositionOffset != osg::Vec3f() || mWorldPositionChanged;
+}
+
 osg::Vec3f Actor::getPosition() const
 {
     return mPosition;
@@ -4,6 +4,7 @@
 #include <memory>
 #include <mutex>
 
+#include "groundcache.hpp"
 #include "ptrholder.hpp"
 
 #include <LinearMath/btTransform.h>
@@ -94,6 +95,9 @@ namespace MWPhysics
         // apply position offset. Can't be called during simulation
         void applyOffsetChange();
 
+        // whether a scripted move or offset is waiting to be applied by the simulation
+        bool hasPendingPositionChange() const;
+
         osg::Vec3f getPosition() const;
 
         osg::Vec3f getPreviousPosition() const;
@@ -160,11 +164,26 @@ namespace MWPhysics
             mLastStuckPosition = position;
         }
 
+        const GroundCache& getGroundCache() const
+        {
+            return mGroundCache;
+        }
+        void setGroundCache(const GroundCache& cache)
+        {
+            mGroundCache = cache;
+        }
+
         bool skipCollisions();
 
         void setVelocity(osg::Vec3f velocity);
         osg::Vec3f velocity();
 
+        /// Peek at the queued velocity without consuming it, unlike velocity()
+        const osg::Vec3f& getVelocity() const
+        {
+            return mVelocity;
+        }
+
     private:
         MWWorld::Ptr mStandingOnPtr;
         /// Removes then re-adds the collision object to the dynamics world
@@ -202,6 +221,7 @@ namespace MWPhysics
 
         unsigned int mStuckFrames;
         osg::Vec3f mLastStuckPosition;
+        GroundCache mGroundCache;
 
         osg::Vec3f mForce;
         bool mOnGround;
@@ -0,0 +1,28 @@
+#ifndef OPENMW_MWPHYSICS_GROUNDCACHE_H
+#define OPENMW_MWPHYSICS_GROUNDCACHE_H
+
+#include <osg/Vec3f>
+
+#include <cstdint>
+
+class btCollisionObject;
+
+namespace MWPhysics
+{
+    /// Result of an actor's last standing ground test. While the actor stays at the cached
+    /// position and the collision world geometry is unchanged the movement solver reuses it
+    /// instead of sweeping for the ground again; see MovementSolver::move.
+    struct GroundCache
+    {
+        osg::Vec3f mPosition{0.f, 0.f, 0.f};
+        const btCollisionObject* mStandingOn = nullptr;
+        /// Value of PhysicsTaskScheduler::getWorldGeometryRevision when the test ran; 0 means
+        /// there is no cached result.
+        std::uint64_t mWorldGeometryRevision = 0;
+        bool mIsOnGround = false;
+        bool mIsOnSlope = false;
+        bool mWalkingOnWater = false;
+    };
+}
+
+#endif
@@ -52,6 +52,9 @@ namespace MWPhysics
 {
     HeightField::HeightField(const float* heights, int x, int y, float triSize, float sqrtVerts, float minH, float maxH, const osg::Object* holdObject, PhysicsTaskScheduler* scheduler)
         : mHoldObject(holdObject)
+        , mHeightsData(heights)
+        , mMinHeight(minH)
+        , mMaxHeight(maxH)
 #if BT_BULLET_VERSION < 310
         , mHeights(makeHeights(heights, sqrtVerts))
 #endif
@@ -111,4 +114,19 @@ namespace MWPhysics
     {
         return mShape.get();
     }
+
+    const float* HeightField::getHeights() const
+    {
+        return mHeightsData;
+    }
+
+    float HeightField::getMinHeight() const
+    {
+        return mMinHeight;
+    }
+
+    float HeightField::getMaxHeight() const
+    {
+        return mMaxHeight;
+    }
 }
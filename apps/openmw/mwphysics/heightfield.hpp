@@ -30,10 +30,20 @@ namespace MWPhysics
         const btCollisionObject* getCollisionObject() const;
         const btHeightfieldTerrainShape* getShape() const;
 
+        /// The height samples the shape was built from. Remains valid for the lifetime of the
+        /// HeightField, so other systems (e.g. the navigator) can share the data instead of
+        /// loading their own copy.
+        const float* getHeights() const;
+        float getMinHeight() const;
+        float getMaxHeight() const;
+
     private:
         std::unique_ptr<btHeightfieldTerrainShape> mShape;
         std::unique_ptr<btCollisionObject> mCollisionObject;
         osg::ref_ptr<const osg::Object> mHoldObject;
+        const float* mHeightsData;
+        float mMinHeight;
+        float mMaxHeight;
 #if BT_BULLET_VERSION < 310
         std::vector<btScalar> mHeights;
 #endif
@@ -186,7 +186,12 @@ namespace MWPhysics
         osg::Vec3f lastSlideNormalFallback(0,0,1);
         bool forceGroundTest = false;
 
-        for (int iterations = 0; iterations < sMaxIterations && remainingTime > 0.0001f; ++iterations)
+        // LOD collision: one trace plus at most one slide. Far-away actors mostly walk over
+        // open terrain, where walkable slopes are handled by the slide alone; giving up on the
+        // occasional ledge they would have stepped onto is an acceptable LOD artifact.
+        const int maxIterations = actor.mLodCollision ? 2 : sMaxIterations;
+
+        for (int iterations = 0; iterations < maxIterations && remainingTime > 0.0001f; ++iterations)
         {
             osg::Vec3f nextpos = newPosition + velocity * remainingTime;
             bool underwater = newPosition.z() < swimlevel;
@@ -230,7 +235,7 @@ namespace MWPhysics
             float hitHeight = tracer.mHitPoint.z() - tracer.mEndPos.z() + actor.mHalfExtentsZ;
             osg::Vec3f oldPosition = newPosition;
             bool usedStepLogic = false;
-            if (hitHeight < sStepSizeUp && !isActor(tracer.mHitObject))
+            if (hitHeight < sStepSizeUp && !isActor(tracer.mHitObject) && !actor.mLodCollision)
             {
                 // Try to step up onto it.
                 // NOTE: this modifies newPosition and velocity on its own if successful
@@ -335,46 +340,70 @@ namespace MWPhysics
         bool isOnSlope = false;
         if (forceGroundTest || (actor.mInertia.z() <= 0.f && newPosition.z() >= swimlevel))
         {
-            osg::Vec3f from = newPosition;
-            auto dropDistance = 2*sGroundOffset + (actor.mIsOnGround ? sStepSizeDown : 0);
-            osg::Vec3f to = newPosition - osg::Vec3f(0,0,dropDistance);
-            tracer.doTrace(actor.mCollisionObject, from, to, collisionWorld);
-            if(tracer.mFraction < 1.0f)
+            const GroundCache& cache = actor.mGroundCache;
+            if (!forceGroundTest && actor.mStuckFrames == 0
+                    && cache.mWorldGeometryRevision == worldData.mWorldGeometryRevision
+                    && newPosition == cache.mPosition)
             {
-                if (!isActor(tracer.mHitObject))
+                // Neither the actor nor the collision geometry around it moved since the last
+                // ground test, so its result still holds; skip the sweeps.
+                isOnGround = cache.mIsOnGround;
+                isOnSlope = cache.mIsOnSlope;
+                actor.mStandingOn = cache.mStandingOn;
+                actor.mWalkingOnWater = cache.mWalkingOnWater;
+            }
+            else
+            {
+                // Results found by standing on another actor depend on that actor's position,
+                // which the world geometry revision doesn't cover, so they must not be cached
+                bool cacheable = actor.mStuckFrames == 0;
+                osg::Vec3f from = newPosition;
+                auto dropDistance = 2*sGroundOffset + (actor.mIsOnGround ? sStepSizeDown : 0);
+                osg::Vec3f to = newPosition - osg::Vec3f(0,0,dropDistance);
+                tracer.doTrace(actor.mCollisionObject, from, to, collisionWorld);
+                if(tracer.mFraction < 1.0f)
                 {
-                    isOnGround = true;
-                    isOnSlope = !isWalkableSlope(tracer.mPlaneNormal);
-                    actor.mStandingOn = tracer.mHitObject;
-
-                    if (actor.mStandingOn->getBroadphaseHandle()->m_collisionFilterGroup == CollisionType_Water)
-                        actor.mWalkingOnWater = true;
-                    if (!actor.mFlying && !isOnSlope)
+                    if (!isActor(tracer.mHitObject))
                     {
-                        if (tracer.mFraction*dropDistance > sGroundOffset)
-                            newPosition.z() = tracer.mEndPos.z() + sGroundOffset;
-                        else
+                        isOnGround = true;
+                        isOnSlope = !isWalkableSlope(tracer.mPlaneNormal);
+                        actor.mStandingOn = tracer.mHitObject;
+
+                        if (actor.mStandingOn->getBroadphaseHandle()->m_collisionFilterGroup == CollisionType_Water)
+                            actor.mWalkingOnWater = true;
+                        if (!actor.mFlying && !isOnSlope)
                         {
-                            newPosition.z() = tracer.mEndPos.z();
-                            tracer.doTrace(actor.mCollisionObject, newPosition, newPosition + osg::Vec3f(0, 0, 2*sGroundOffset), collisionWorld);
-                            newPosition = (newPosition+tracer.mEndPos)/2.0;
+                            if (tracer.mFraction*dropDistance > sGroundOffset)
+                                newPosition.z() = tracer.mEndPos.z() + sGroundOffset;
+                            else
+                            {
+                                newPosition.z() = tracer.mEndPos.z();
+                                tracer.doTrace(actor.mCollisionObject, newPosition, newPosition + osg::Vec3f(0, 0, 2*sGroundOffset), collisionWorld);
+                                newPosition = (newPosition+tracer.mEndPos)/2.0;
+                            }
                         }
                     }
+                    else
+                    {
+                        // Vanilla allows actors to float on top of other actors. Do not push them off.
+                        if (!actor.mFlying && isWalkableSlope(tracer.mPlaneNormal) && tracer.mEndPos.z()+sGroundOffset <= newPosition.z())
+                            newPosition.z() = tracer.mEndPos.z() + sGroundOffset;
+
+                        isOnGround = false;
+                        cacheable = false;
+                    }
                 }
-                else
+                // forcibly treat stuck actors as if they're on flat ground because buggy collisions when inside of things can/will break ground detection
+                if(actor.mStuckFrames > 0)
                 {
-                    // Vanilla allows actors to float on top of other actors. Do not push them off.
-                    if (!actor.mFlying && isWalkableSlope(tracer.mPlaneNormal) && tracer.mEndPos.z()+sGroundOffset <= newPosition.z())
-                        newPosition.z() = tracer.mEndPos.z() + sGroundOffset;
-
-                    isOnGround = false;
+                    isOnGround = true;
+                    isOnSlope = false;
                 }
-            }
-            // forcibly treat stuck actors as if they're on flat ground because buggy collisions when inside of things can/will break ground detection
-            if(actor.mStuckFrames > 0)
-            {
-                isOnGround = true;
-                isOnSlope = false;
+                if (cacheable)
+                    actor.mGroundCache = GroundCache {newPosition, actor.mStandingOn,
+                        worldData.mWorldGeometryRevision, isOnGround, isOnSlope, actor.mWalkingOnWater};
+                else
+                    actor.mGroundCache.mWorldGeometryRevision = 0;
             }
         }
 
@@ -1,5 +1,8 @@
+#include <cassert>
+
 #include <BulletCollision/BroadphaseCollision/btDbvtBroadphase.h>
 #include <BulletCollision/CollisionShapes/btCollisionShape.h>
+#include <BulletCollision/CollisionShapes/btSphereShape.h>
 
 #include <osg/Stats>
 
@@ -13,6 +16,7 @@
 #include "../mwworld/class.hpp"
 
 #include "actor.hpp"
+#include "closestnotmerayresultcallback.hpp"
 #include "contacttestwrapper.h"
 #include "movementsolver.hpp"
 #include "mtphysics.hpp"
@@ -49,6 +53,12 @@ namespace
             bool mCanBeSharedLock;
     };
 
+    // A cached LOS result is raycast again only after one of the actors moved away from
+    // the position it was computed at, or after this many frames: the environment itself
+    // (e.g. a door) can change the result for a pair of stationary actors.
+    constexpr int sMaxLOSResultAge = 8;
+    constexpr float sLOSMovedDistanceSq = 1.f;
+
     bool isUnderWater(const MWPhysics::ActorFrameData& actorData)
     {
         return actorData.mPosition.z() < actorData.mSwimLevel;
@@ -100,6 +110,16 @@ namespace
             }
             return std::max(0, wantedThread);
         }
+
+        /// @return the largest simulation step the adaptive rate may use, or defaultDt if
+        /// the user did not configure a minimum framerate
+        float computeMaxSimulationDt(float defaultDt)
+        {
+            const float minFramerate = Settings::Manager::getFloat("minimum physics framerate", "Physics");
+            if (minFramerate <= 0.f)
+                return defaultDt;
+            return std::max(defaultDt, 1.f / minFramerate);
+        }
     }
 }
 
@@ -107,6 +127,8 @@ namespace MWPhysics
 {
     PhysicsTaskScheduler::PhysicsTaskScheduler(float physicsDt, btCollisionWorld *collisionWorld, MWRender::DebugDrawer* debugDrawer)
           : mDefaultPhysicsDt(physicsDt)
+          , mMaxSimulationDt(Config::computeMaxSimulationDt(physicsDt))
+          , mSimulationDt(physicsDt)
           , mPhysicsDt(physicsDt)
           , mTimeAccum(0.f)
           , mCollisionWorld(collisionWorld)
@@ -119,6 +141,7 @@ namespace MWPhysics
           , mQuit(false)
           , mNextJob(0)
           , mNextLOS(0)
+          , mNextAsyncQuery(0)
           , mFrameNumber(0)
           , mTimer(osg::Timer::instance())
           , mPrevStepCount(1)
@@ -161,10 +184,27 @@ namespace MWPhysics
             thread.join();
     }
 
+    void PhysicsTaskScheduler::updateSimulationRate()
+    {
+        if (mMaxSimulationDt <= mDefaultPhysicsDt)
+            return;
+
+        // fraction of real time spent simulating at the current rate; a step costs roughly
+        // the same regardless of its length, so growing the step directly lowers the load
+        const float load = std::max(mBudget.get(), mAsyncBudget.get()) / mSimulationDt;
+        // lower the rate one notch (60 -> 40 -> 30 with the defaults) while simulation eats
+        // most of its budget; restore it only once enough headroom has built up that the
+        // faster rate will not immediately push us over the threshold again
+        if (load > 0.8f)
+            mSimulationDt = std::min(mSimulationDt * 1.5f, mMaxSimulationDt);
+        else if (load < 0.4f)
+            mSimulationDt = std::max(mSimulationDt / 1.5f, mDefaultPhysicsDt);
+    }
+
     std::tuple<int, float> PhysicsTaskScheduler::calculateStepConfig(float timeAccum) const
     {
         int maxAllowedSteps = 2;
-        int numSteps = timeAccum / mDefaultPhysicsDt;
+        int numSteps = timeAccum / mSimulationDt;
 
         // adjust maximum step count based on whether we're likely physics bottlenecked or not
         // if maxAllowedSteps ends up higher than numSteps, we will not invoke delta time
@@ -176,8 +216,8 @@ namespace MWPhysics
 
         // get physics timing stats
         float budgetMeasurement = std::max(mBudget.get(), mAsyncBudget.get());
-        // time spent per step in terms of the intended physics framerate
-        budgetMeasurement /= mDefaultPhysicsDt;
+        // time spent per step in terms of the current simulation framerate
+        budgetMeasurement /= mSimulationDt;
         // ensure sane minimum value
         budgetMeasurement = std::max(0.00001f, budgetMeasurement);
         // we're spending almost or more than realtime per physics frame; limit to a single step
@@ -190,7 +230,7 @@ namespace MWPhysics
         maxAllowedSteps = std::min(10, maxAllowedSteps);
 
         // fall back to delta time for this frame if fixed timestep physics would fall behind
-        float actualDelta = mDefaultPhysicsDt;
+        float actualDelta = mSimulationDt;
         if (numSteps > maxAllowedSteps)
         {
             numSteps = maxAllowedSteps;
@@ -200,8 +240,8 @@ namespace MWPhysics
             actualDelta = timeAccum/float(numSteps+1);
             // actually: if this results in a per-step delta less than the target physics steptime, clamp it
             // this might reintroduce some stutter, but only comes into play in obscure cases
-            // (because numSteps is originally based on mDefaultPhysicsDt, this won't cause us to overrun)
-            actualDelta = std::max(actualDelta, mDefaultPhysicsDt);
+            // (because numSteps is originally based on mSimulationDt, this won't cause us to overrun)
+            actualDelta = std::max(actualDelta, mSimulationDt);
         }
 
         return std::make_tuple(numSteps, actualDelta);
@@ -230,6 +270,7 @@ namespace MWPhysics
             updateStats(frameStart, frameNumber, stats);
         }
 
+        updateSimulationRate();
         auto [numSteps, newDelta] = calculateStepConfig(timeAccum);
         timeAccum -= numSteps*newDelta;
 
@@ -248,10 +289,14 @@ namespace MWPhysics
         mNewFrame = true;
         mNumJobs = mActorsFrameData.size();
         mNextLOS.store(0, std::memory_order_relaxed);
+        mNextAsyncQuery.store(0, std::memory_order_relaxed);
         mNextJob.store(0, std::memory_order_release);
 
         if (mAdvanceSimulation)
+        {
             mWorldFrameData = std::make_unique<WorldFrameData>();
+            mWorldFrameData->mWorldGeometryRevision = getWorldGeometryRevision();
+        }
 
         if (mAdvanceSimulation)
             mBudgetCursor += 1;
@@ -276,6 +321,7 @@ namespace MWPhysics
         std::unique_lock lock(mSimulationMutex);
         mBudget.reset(mDefaultPhysicsDt);
         mAsyncBudget.reset(0.0f);
+        mSimulationDt = mDefaultPhysicsDt;
         mActors.clear();
         mActorsFrameData.clear();
         for (const auto& [_, actor] : actors)
@@ -297,6 +343,15 @@ namespace MWPhysics
         mCollisionWorld->convexSweepTest(castShape, from, to, resultCallback);
     }
 
+    void PhysicsTaskScheduler::convexSweepTestBatch(const std::vector<ConvexSweep>& sweeps) const
+    {
+        if (sweeps.empty())
+            return;
+        MaybeSharedLock lock(mCollisionWorldMutex, mThreadSafeBullet);
+        for (const ConvexSweep& sweep : sweeps)
+            mCollisionWorld->convexSweepTest(sweep.mShape, sweep.mFrom, sweep.mTo, *sweep.mCallback);
+    }
+
     void PhysicsTaskScheduler::contactTest(btCollisionObject* colObj, btCollisionWorld::ContactResultCallback& resultCallback)
     {
         std::shared_lock lock(mCollisionWorldMutex);
@@ -336,20 +391,50 @@ namespace MWPhysics
     {
         std::unique_lock lock(mCollisionWorldMutex);
         collisionObject->getBroadphaseHandle()->m_collisionFilterMask = collisionFilterMask;
+        mWorldGeometryRevision.fetch_add(1, std::memory_order_relaxed);
     }
 
     void PhysicsTaskScheduler::addCollisionObject(btCollisionObject* collisionObject, int collisionFilterGroup, int collisionFilterMask)
     {
         mCollisionObjects.insert(collisionObject);
-        std::unique_lock lock(mCollisionWorldMutex);
+        std::unique_lock lock(mCollisionWorldMutex, std::defer_lock);
+        if (!mBatchUpdateInProgress)
+            lock.lock();
         mCollisionWorld->addCollisionObject(collisionObject, collisionFilterGroup, collisionFilterMask);
+        mWorldGeometryRevision.fetch_add(1, std::memory_order_relaxed);
     }
 
     void PhysicsTaskScheduler::removeCollisionObject(btCollisionObject* collisionObject)
     {
         mCollisionObjects.erase(collisionObject);
-        std::unique_lock lock(mCollisionWorldMutex);
+        std::unique_lock lock(mCollisionWorldMutex, std::defer_lock);
+        if (!mBatchUpdateInProgress)
+            lock.lock();
         mCollisionWorld->removeCollisionObject(collisionObject);
+        mWorldGeometryRevision.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void PhysicsTaskScheduler::refreshAabb(btCollisionObject* collisionObject)
+    {
+        std::unique_lock lock(mCollisionWorldMutex, std::defer_lock);
+        if (!mBatchUpdateInProgress)
+            lock.lock();
+        mCollisionWorld->updateSingleAabb(collisionObject);
+        mWorldGeometryRevision.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void PhysicsTaskScheduler::beginBatchUpdate()
+    {
+        assert(!mBatchUpdateInProgress);
+        mCollisionWorldMutex.lock();
+        mBatchUpdateInProgress = true;
+    }
+
+    void PhysicsTaskScheduler::endBatchUpdate()
+    {
+        assert(mBatchUpdateInProgress);
+        mBatchUpdateInProgress = false;
+        mCollisionWorldMutex.unlock();
     }
 
     void PhysicsTaskScheduler::updateSingleAabb(std::shared_ptr<PtrHolder> ptr, bool immediate)
@@ -365,6 +450,12 @@ namespace MWPhysics
         }
     }
 
+    bool PhysicsTaskScheduler::hasQueuedAabbUpdates()
+    {
+        std::unique_lock lock(mUpdateAabbMutex);
+        return !mUpdateAabb.empty();
+    }
+
     bool PhysicsTaskScheduler::getLineOfSight(const std::shared_ptr<Actor>& actor1, const std::shared_ptr<Actor>& actor2)
     {
         std::unique_lock lock(mLOSCacheMutex);
@@ -373,11 +464,13 @@ namespace MWPhysics
         auto result = std::find(mLOSCache.begin(), mLOSCache.end(), req);
         if (result == mLOSCache.end())
         {
-            req.mResult = hasLineOfSight(actor1.get(), actor2.get());
+            req.mResult = hasLineOfSight(req.mRawActors[0], req.mRawActors[1]);
+            req.mPositions = {req.mRawActors[0]->getCollisionObjectPosition(), req.mRawActors[1]->getCollisionObjectPosition()};
             mLOSCache.push_back(req);
             return req.mResult;
         }
         result->mAge = 0;
+        result->mStale = false;
         return result->mResult;
     }
 
@@ -395,9 +488,92 @@ namespace MWPhysics
             if (req.mAge++ > mLOSCacheExpiry || !actorPtr1 || !actorPtr2)
                 req.mStale = true;
             else
-                req.mResult = hasLineOfSight(actorPtr1.get(), actorPtr2.get());
+            {
+                const osg::Vec3f pos1 = actorPtr1->getCollisionObjectPosition();
+                const osg::Vec3f pos2 = actorPtr2->getCollisionObjectPosition();
+                if ((pos1 - req.mPositions[0]).length2() > sLOSMovedDistanceSq
+                    || (pos2 - req.mPositions[1]).length2() > sLOSMovedDistanceSq
+                    || ++req.mResultAge >= sMaxLOSResultAge)
+                {
+                    req.mResult = hasLineOfSight(actorPtr1.get(), actorPtr2.get());
+                    req.mPositions = {pos1, pos2};
+                    req.mResultAge = 0;
+                }
+            }
+        }
+
+    }
+
+    std::size_t PhysicsTaskScheduler::submitAsyncQuery(AsyncQuery&& query)
+    {
+        std::unique_lock lock(mAsyncQueryMutex);
+        query.mHandle = mNextQueryHandle++;
+        query.mReady = false;
+        mAsyncQueries.push_back(std::move(query));
+        if (mNumThreads == 0)
+            resolveAsyncQuery(mAsyncQueries.back());
+        return mAsyncQueries.back().mHandle;
+    }
+
+    std::optional<AsyncQuery> PhysicsTaskScheduler::retrieveAsyncQuery(std::size_t handle)
+    {
+        std::unique_lock lock(mAsyncQueryMutex);
+        auto result = std::find_if(mAsyncQueries.begin(), mAsyncQueries.end(),
+                [handle](const AsyncQuery& query) { return query.mHandle == handle; });
+        if (result == mAsyncQueries.end() || !result->mReady)
+            return std::nullopt;
+        AsyncQuery query = std::move(*result);
+        mAsyncQueries.erase(result);
+        return query;
+    }
+
+    void PhysicsTaskScheduler::refreshAsyncQueries()
+    {
+        std::shared_lock lock(mAsyncQueryMutex);
+        int job = 0;
+        int numQueries = mAsyncQueries.size();
+        while ((job = mNextAsyncQuery.fetch_add(1, std::memory_order_relaxed)) < numQueries)
+        {
+            auto& query = mAsyncQueries[job];
+            if (!query.mReady)
+                resolveAsyncQuery(query);
+        }
+    }
+
+    void PhysicsTaskScheduler::resolveAsyncQuery(AsyncQuery& query)
+    {
+        if (query.mRadius > 0)
+        {
+            btCollisionWorld::ClosestConvexResultCallback callback(query.mFrom, query.mTo);
+            callback.m_collisionFilterGroup = query.mGroup;
+            callback.m_collisionFilterMask = query.mMask;
+
+            btSphereShape shape(query.mRadius);
+            const btQuaternion btrot = btQuaternion::getIdentity();
+
+            MaybeSharedLock lockColWorld(mCollisionWorldMutex, mThreadSafeBullet);
+            mCollisionWorld->convexSweepTest(&shape, btTransform(btrot, query.mFrom), btTransform(btrot, query.mTo), callback);
+
+            query.mHit = callback.hasHit();
+            query.mHitPos = callback.m_hitPointWorld;
+            query.mHitNormal = callback.m_hitNormalWorld;
+            query.mHitObject = callback.m_hitCollisionObject;
         }
+        else
+        {
+            ClosestNotMeRayResultCallback callback(query.mIgnore, query.mTargets, query.mFrom, query.mTo);
+            callback.m_collisionFilterGroup = query.mGroup;
+            callback.m_collisionFilterMask = query.mMask;
 
+            MaybeSharedLock lockColWorld(mCollisionWorldMutex, mThreadSafeBullet);
+            mCollisionWorld->rayTest(query.mFrom, query.mTo, callback);
+
+            query.mHit = callback.hasHit();
+            query.mHitPos = callback.m_hitPointWorld;
+            query.mHitNormal = callback.m_hitNormalWorld;
+            query.mHitObject = callback.m_collisionObject;
+        }
+        query.mReady = true;
     }
 
     void PhysicsTaskScheduler::updateAabbs()
@@ -420,6 +596,9 @@ namespace MWPhysics
         {
             object->commitPositionChange();
             mCollisionWorld->updateSingleAabb(object->getCollisionObject());
+            // Actors may stand on doors and other moving objects; their cached ground state is
+            // stale now. Actor and projectile moves don't carry ground, so they don't count.
+            mWorldGeometryRevision.fetch_add(1, std::memory_order_relaxed);
         }
         else if (const auto projectile = std::dynamic_pointer_cast<Projectile>(ptr))
         {
@@ -455,6 +634,7 @@ namespace MWPhysics
                 }
 
                 refreshLOSCache();
+                refreshAsyncQueries();
                 mPostSimBarrier->wait([this] { afterPostSim(); });
             }
         }
@@ -479,6 +659,7 @@ namespace MWPhysics
         actor.setSimulationPosition(interpolateMovements(actor, actorData, timeAccum, dt));
         actor.setLastStuckPosition(actorData.mLastStuckPosition);
         actor.setStuckFrames(actorData.mStuckFrames);
+        actor.setGroundCache(actorData.mGroundCache);
         if (simulationPerformed)
         {
             MWWorld::Ptr standingOn;
@@ -530,6 +711,8 @@ namespace MWPhysics
             updateActor(*mActors[i], mActorsFrameData[i], mAdvanceSimulation, mTimeAccum, mPhysicsDt);
         }
         refreshLOSCache();
+        removeStaleLOSRequests();
+        refreshAsyncQueries();
     }
 
     void PhysicsTaskScheduler::updateStats(osg::Timer_t frameStart, unsigned int frameNumber, osg::Stats& stats)
@@ -593,13 +776,16 @@ namespace MWPhysics
     void PhysicsTaskScheduler::afterPostSim()
     {
         mNewFrame = false;
-        {
-            std::unique_lock lock(mLOSCacheMutex);
-            mLOSCache.erase(
-                    std::remove_if(mLOSCache.begin(), mLOSCache.end(),
-                        [](const LOSRequest& req) { return req.mStale; }),
-                    mLOSCache.end());
-        }
+        removeStaleLOSRequests();
         mTimeEnd = mTimer->tick();
     }
+
+    void PhysicsTaskScheduler::removeStaleLOSRequests()
+    {
+        std::unique_lock lock(mLOSCacheMutex);
+        mLOSCache.erase(
+                std::remove_if(mLOSCache.begin(), mLOSCache.end(),
+                    [](const LOSRequest& req) { return req.mStale; }),
+                mLOSCache.end());
+    }
 }
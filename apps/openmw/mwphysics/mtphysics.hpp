@@ -3,6 +3,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <optional>
 #include <shared_mutex>
 #include <thread>
@@ -28,6 +29,36 @@ namespace MWRender
 
 namespace MWPhysics
 {
+    /// A batched asynchronous collision query. Submitted queries are resolved
+    /// by the worker threads alongside the line of sight cache refresh; the
+    /// result typically becomes available the next frame.
+    struct AsyncQuery
+    {
+        std::size_t mHandle;
+        btVector3 mFrom;
+        btVector3 mTo;
+        float mRadius; // > 0 sweeps a sphere of that radius instead of casting a ray
+        const btCollisionObject* mIgnore;
+        std::vector<const btCollisionObject*> mTargets;
+        int mGroup;
+        int mMask;
+        bool mReady;
+        bool mHit;
+        btVector3 mHitPos;
+        btVector3 mHitNormal;
+        const btCollisionObject* mHitObject;
+    };
+
+    /// One convex sweep in a convexSweepTestBatch() call. The callback must stay
+    /// alive until the batch has been processed.
+    struct ConvexSweep
+    {
+        const btConvexShape* mShape;
+        btTransform mFrom;
+        btTransform mTo;
+        btCollisionWorld::ConvexResultCallback* mCallback;
+    };
+
     class PhysicsTaskScheduler
     {
         public:
@@ -46,6 +77,9 @@ namespace MWPhysics
             // Thread safe wrappers
             void rayTest(const btVector3& rayFromWorld, const btVector3& rayToWorld, btCollisionWorld::RayResultCallback& resultCallback) const;
             void convexSweepTest(const btConvexShape* castShape, const btTransform& from, const btTransform& to, btCollisionWorld::ConvexResultCallback& resultCallback) const;
+            /// Run several convex sweeps while holding the collision world lock
+            /// once, instead of taking and releasing it again for every sweep.
+            void convexSweepTestBatch(const std::vector<ConvexSweep>& sweeps) const;
             void contactTest(btCollisionObject* colObj, btCollisionWorld::ContactResultCallback& resultCallback);
             std::optional<btVector3> getHitPoint(const btTransform& from, btCollisionObject* target);
             void aabbTest(const btVector3& aabbMin, const btVector3& aabbMax, btBroadphaseAabbCallback& callback);
@@ -53,7 +87,27 @@ namespace MWPhysics
             void setCollisionFilterMask(btCollisionObject* collisionObject, int collisionFilterMask);
             void addCollisionObject(btCollisionObject* collisionObject, int collisionFilterGroup, int collisionFilterMask);
             void removeCollisionObject(btCollisionObject* collisionObject);
+            /// Recompute the broadphase aabb of an already added collision object whose shape changed.
+            void refreshAabb(btCollisionObject* collisionObject);
+            /// Hold the collision world lock across a burst of main thread
+            /// addCollisionObject/removeCollisionObject calls (cell load/unload),
+            /// so the broadphase is updated under one lock acquisition instead of
+            /// contending with the simulation threads once per object.
+            void beginBatchUpdate();
+            void endBatchUpdate();
+            /// Queue \a query for asynchronous processing and return a handle for
+            /// retrieveAsyncQuery. The handle fields of \a query are filled in here.
+            std::size_t submitAsyncQuery(AsyncQuery&& query);
+            /// Return the result of a previously submitted query, or std::nullopt
+            /// while it is still pending. Once a result has been returned the
+            /// handle is forgotten.
+            std::optional<AsyncQuery> retrieveAsyncQuery(std::size_t handle);
             void updateSingleAabb(std::shared_ptr<PtrHolder> ptr, bool immediate=false);
+            /// Whether AABB updates queued by updateSingleAabb are still waiting to be processed
+            bool hasQueuedAabbUpdates();
+            /// Incremented whenever non-actor collision geometry is added, removed or moved;
+            /// used to invalidate per-actor ground caches (see GroundCache).
+            std::uint64_t getWorldGeometryRevision() const { return mWorldGeometryRevision.load(std::memory_order_relaxed); }
             bool getLineOfSight(const std::shared_ptr<Actor>& actor1, const std::shared_ptr<Actor>& actor2);
             void debugDraw();
             void* getUserPointer(const btCollisionObject* object) const;
@@ -67,10 +121,14 @@ namespace MWPhysics
             void updateActor(Actor& actor, ActorFrameData& actorData, bool simulationPerformed, float timeAccum, float dt) const;
             bool hasLineOfSight(const Actor* actor1, const Actor* actor2);
             void refreshLOSCache();
+            void removeStaleLOSRequests();
+            void refreshAsyncQueries();
+            void resolveAsyncQuery(AsyncQuery& query);
             void updateAabbs();
             void updatePtrAabb(const std::shared_ptr<PtrHolder>& ptr);
             void updateStats(osg::Timer_t frameStart, unsigned int frameNumber, osg::Stats& stats);
             std::tuple<int, float> calculateStepConfig(float timeAccum) const;
+            void updateSimulationRate();
             void afterPreStep();
             void afterPostStep();
             void afterPostSim();
@@ -79,12 +137,22 @@ namespace MWPhysics
             std::vector<std::shared_ptr<Actor>> mActors;
             std::vector<ActorFrameData> mActorsFrameData;
             std::unordered_set<const btCollisionObject*> mCollisionObjects;
+            // Starts at 1 so the GroundCache "no cached result" value 0 never matches
+            std::atomic<std::uint64_t> mWorldGeometryRevision {1};
             float mDefaultPhysicsDt;
+            // Largest step the adaptive rate may grow to; equals mDefaultPhysicsDt when
+            // "minimum physics framerate" is unset, which disables adaptation
+            float mMaxSimulationDt;
+            // Current target step; raised towards mMaxSimulationDt while simulation eats
+            // most of its budget and restored towards mDefaultPhysicsDt once it no longer does
+            float mSimulationDt;
             float mPhysicsDt;
             float mTimeAccum;
             btCollisionWorld* mCollisionWorld;
             MWRender::DebugDrawer* mDebugDrawer;
             std::vector<LOSRequest> mLOSCache;
+            std::vector<AsyncQuery> mAsyncQueries;
+            std::size_t mNextQueryHandle = 1;
             std::set<std::shared_ptr<PtrHolder>> mUpdateAabb;
 
             // TODO: use std::experimental::flex_barrier or std::barrier once it becomes a thing
@@ -99,14 +167,17 @@ namespace MWPhysics
             bool mNewFrame;
             bool mAdvanceSimulation;
             bool mThreadSafeBullet;
+            bool mBatchUpdateInProgress = false; // only set and read by the main thread
             bool mQuit;
             std::atomic<int> mNextJob;
             std::atomic<int> mNextLOS;
+            std::atomic<int> mNextAsyncQuery;
             std::vector<std::thread> mThreads;
 
             mutable std::shared_mutex mSimulationMutex;
             mutable std::shared_mutex mCollisionWorldMutex;
             mutable std::shared_mutex mLOSCacheMutex;
+            mutable std::shared_mutex mAsyncQueryMutex;
             mutable std::mutex mUpdateAabbMutex;
             std::condition_variable_any mHasJob;
 
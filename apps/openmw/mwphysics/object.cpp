@@ -14,9 +14,10 @@
 
 namespace MWPhysics
 {
-    Object::Object(const MWWorld::Ptr& ptr, osg::ref_ptr<Resource::BulletShapeInstance> shapeInstance, osg::Quat rotation, int collisionType, PhysicsTaskScheduler* scheduler)
+    Object::Object(const MWWorld::Ptr& ptr, osg::ref_ptr<Resource::BulletShapeInstance> shapeInstance, osg::Quat rotation, int collisionType, PhysicsTaskScheduler* scheduler, bool batched)
         : mShapeInstance(shapeInstance)
         , mSolid(true)
+        , mBatched(batched)
         , mTaskScheduler(scheduler)
     {
         mPtr = ptr;
@@ -31,12 +32,14 @@ namespace MWPhysics
         updatePosition();
         commitPositionChange();
 
-        mTaskScheduler->addCollisionObject(mCollisionObject.get(), collisionType, CollisionType_Actor|CollisionType_HeightMap|CollisionType_Projectile);
+        if (!mBatched)
+            mTaskScheduler->addCollisionObject(mCollisionObject.get(), collisionType, CollisionType_Actor|CollisionType_HeightMap|CollisionType_Projectile);
     }
 
     Object::~Object()
     {
-        mTaskScheduler->removeCollisionObject(mCollisionObject.get());
+        if (!mBatched)
+            mTaskScheduler->removeCollisionObject(mCollisionObject.get());
     }
 
     const Resource::BulletShapeInstance* Object::getShapeInstance() const
@@ -107,6 +110,16 @@ namespace MWPhysics
         return mShapeInstance->isAnimated();
     }
 
+    bool Object::isBatched() const
+    {
+        return mBatched;
+    }
+
+    void Object::setBatched(bool batched)
+    {
+        mBatched = batched;
+    }
+
     bool Object::animateCollisionShapes()
     {
         if (mShapeInstance->mAnimatedShapes.empty())
@@ -25,7 +25,9 @@ namespace MWPhysics
     class Object final : public PtrHolder
     {
     public:
-        Object(const MWWorld::Ptr& ptr, osg::ref_ptr<Resource::BulletShapeInstance> shapeInstance, osg::Quat rotation, int collisionType, PhysicsTaskScheduler* scheduler);
+        /// @param batched If true, the collision object is not added to the collision world;
+        ///        the caller is expected to merge the shape into a StaticBatch instead.
+        Object(const MWWorld::Ptr& ptr, osg::ref_ptr<Resource::BulletShapeInstance> shapeInstance, osg::Quat rotation, int collisionType, PhysicsTaskScheduler* scheduler, bool batched = false);
         ~Object() override;
 
         const Resource::BulletShapeInstance* getShapeInstance() const;
@@ -38,6 +40,10 @@ namespace MWPhysics
         bool isSolid() const;
         void setSolid(bool solid);
         bool isAnimated() const;
+        /// Whether the shape is merged into a StaticBatch instead of having its own entry
+        /// in the collision world.
+        bool isBatched() const;
+        void setBatched(bool batched);
         /// @brief update object shape
         /// @return true if shape changed
         bool animateCollisionShapes();
@@ -51,6 +57,7 @@ namespace MWPhysics
         osg::Quat mRotation;
         bool mScaleUpdatePending;
         bool mTransformUpdatePending;
+        bool mBatched;
         mutable std::mutex mPositionMutex;
         PhysicsTaskScheduler* mTaskScheduler;
     };
@@ -22,15 +22,20 @@
 #include <components/resource/resourcesystem.hpp>
 #include <components/resource/bulletshapemanager.hpp>
 #include <components/debug/debuglog.hpp>
+#include <components/debug/memorytracking.hpp>
 #include <components/esm/loadgmst.hpp>
+#include <components/esm/loadstat.hpp>
+#include <components/settings/settings.hpp>
 #include <components/sceneutil/positionattitudetransform.hpp>
 #include <components/sceneutil/unrefqueue.hpp>
 #include <components/misc/convert.hpp>
+#include <components/misc/framearena.hpp>
 
 #include <components/nifosg/particle.hpp> // FindRecIndexVisitor
 
 #include "../mwbase/world.hpp"
 #include "../mwbase/environment.hpp"
+#include "../mwbase/mechanicsmanager.hpp"
 
 #include "../mwmechanics/creaturestats.hpp"
 #include "../mwmechanics/actorutil.hpp"
@@ -51,6 +56,7 @@
 #include "trace.h"
 #include "object.hpp"
 #include "heightfield.hpp"
+#include "staticbatch.hpp"
 #include "hasspherecollisioncallback.hpp"
 #include "deepestnotmecontacttestresultcallback.hpp"
 #include "closestnotmerayresultcallback.hpp"
@@ -110,6 +116,7 @@ namespace MWPhysics
     PhysicsSystem::PhysicsSystem(Resource::ResourceSystem* resourceSystem, osg::ref_ptr<osg::Group> parentNode)
         : mShapeManager(new Resource::BulletShapeManager(resourceSystem->getVFS(), resourceSystem->getSceneManager(), resourceSystem->getNifFileManager()))
         , mResourceSystem(resourceSystem)
+        , mStaticBatchingEnabled(Settings::Manager::getBool("static collision batching", "Physics"))
         , mDebugDrawEnabled(false)
         , mTimeAccum(0.0f)
         , mProjectileId(0)
@@ -120,6 +127,10 @@ namespace MWPhysics
     {
         mResourceSystem->addResourceManager(mShapeManager.get());
 
+        const std::string bvhCachePath = Settings::Manager::getString("bvh cache path", "Physics");
+        if (!bvhCachePath.empty())
+            mShapeManager->setBvhCachePath(bvhCachePath);
+
         mCollisionConfiguration = std::make_unique<btDefaultCollisionConfiguration>();
         mDispatcher = std::make_unique<btCollisionDispatcher>(mCollisionConfiguration.get());
         mBroadphase = std::make_unique<btDbvtBroadphase>();
@@ -155,6 +166,7 @@ namespace MWPhysics
 
         mTaskScheduler->releaseSharedStates();
         mHeightFields.clear();
+        mStaticBatches.clear();
         mObjects.clear();
         mActors.clear();
         mProjectiles.clear();
@@ -165,6 +177,17 @@ namespace MWPhysics
         mUnrefQueue = unrefQueue;
     }
 
+    PhysicsSystem::ScopedBatchUpdate::ScopedBatchUpdate(PhysicsSystem& physics)
+        : mTaskScheduler(*physics.mTaskScheduler)
+    {
+        mTaskScheduler.beginBatchUpdate();
+    }
+
+    PhysicsSystem::ScopedBatchUpdate::~ScopedBatchUpdate()
+    {
+        mTaskScheduler.endBatchUpdate();
+    }
+
     Resource::BulletShapeManager *PhysicsSystem::getShapeManager()
     {
         return mShapeManager.get();
@@ -372,6 +395,68 @@ namespace MWPhysics
         return result;
     }
 
+    std::size_t PhysicsSystem::asyncCastRay(const osg::Vec3f& from, const osg::Vec3f& to, const MWWorld::ConstPtr& ignore, const std::vector<MWWorld::Ptr>& targets, int mask, int group)
+    {
+        AsyncQuery query{};
+        query.mFrom = Misc::Convert::toBullet(from);
+        query.mTo = Misc::Convert::toBullet(to);
+        query.mGroup = group;
+        query.mMask = mask;
+
+        if (!ignore.isEmpty())
+        {
+            const Actor* actor = getActor(ignore);
+            if (actor)
+                query.mIgnore = actor->getCollisionObject();
+            else
+            {
+                const Object* object = getObject(ignore);
+                if (object)
+                    query.mIgnore = object->getCollisionObject();
+            }
+        }
+
+        for (const MWWorld::Ptr& target : targets)
+        {
+            const Actor* actor = getActor(target);
+            if (actor)
+                query.mTargets.push_back(actor->getCollisionObject());
+        }
+
+        return mTaskScheduler->submitAsyncQuery(std::move(query));
+    }
+
+    std::size_t PhysicsSystem::asyncCastSphere(const osg::Vec3f& from, const osg::Vec3f& to, float radius)
+    {
+        AsyncQuery query{};
+        query.mFrom = Misc::Convert::toBullet(from);
+        query.mTo = Misc::Convert::toBullet(to);
+        query.mRadius = radius;
+        query.mGroup = 0xff;
+        query.mMask = CollisionType_World|CollisionType_HeightMap|CollisionType_Door;
+
+        return mTaskScheduler->submitAsyncQuery(std::move(query));
+    }
+
+    std::optional<RayCastingResult> PhysicsSystem::retrieveAsyncRayCastResult(std::size_t handle)
+    {
+        std::optional<AsyncQuery> query = mTaskScheduler->retrieveAsyncQuery(handle);
+        if (!query.has_value())
+            return std::nullopt;
+
+        RayCastingResult result;
+        result.mHit = query->mHit;
+        if (result.mHit)
+        {
+            result.mHitPos = Misc::Convert::toOsg(query->mHitPos);
+            result.mHitNormal = Misc::Convert::toOsg(query->mHitNormal);
+            // the object may have been removed from the scene since the query was resolved
+            if (PtrHolder* ptrHolder = static_cast<PtrHolder*>(mTaskScheduler->getUserPointer(query->mHitObject)))
+                result.mHitObject = ptrHolder->getPtr();
+        }
+        return result;
+    }
+
     bool PhysicsSystem::getLineOfSight(const MWWorld::ConstPtr &actor1, const MWWorld::ConstPtr &actor2) const
     {
         const auto it1 = mActors.find(actor1.mRef);
@@ -494,6 +579,8 @@ namespace MWPhysics
     {
         if (ptr.mRef->mData.mPhysicsPostponed)
             return;
+
+        Debug::ScopedMemoryDomain memoryDomain(Debug::MemoryDomain::Physics);
         osg::ref_ptr<Resource::BulletShapeInstance> shapeInstance = mShapeManager->getInstance(mesh);
         if (!shapeInstance || !shapeInstance->getCollisionShape())
             return;
@@ -503,9 +590,25 @@ namespace MWPhysics
 
         assert(!getObject(ptr));
 
-        auto obj = std::make_shared<Object>(ptr, shapeInstance, rotation, collisionType, mTaskScheduler.get());
+        // Statics can not be activated and their shapes never animate, so their collision can be
+        // merged into one compound body per cell instead of one broadphase entry per object.
+        // Should a script move, rotate, scale or delete one after all, it is taken out of the
+        // batch again (see unbatchObject).
+        const bool batch = mStaticBatchingEnabled && collisionType == CollisionType_World
+            && !shapeInstance->isAnimated() && shapeInstance->mAvoidCollisionShape == nullptr
+            && ptr.getTypeName() == typeid(ESM::Static).name();
+
+        auto obj = std::make_shared<Object>(ptr, shapeInstance, rotation, collisionType, mTaskScheduler.get(), batch);
         mObjects.emplace(ptr.mRef, obj);
 
+        if (batch)
+        {
+            std::unique_ptr<StaticBatch>& cellBatch = mStaticBatches[ptr.getCell()];
+            if (!cellBatch)
+                cellBatch = std::make_unique<StaticBatch>(mTaskScheduler.get());
+            cellBatch->insert(ptr.mRef, shapeInstance->getCollisionShape(), obj->getTransform());
+        }
+
         if (obj->isAnimated())
             mAnimatedObjects.insert(obj.get());
     }
@@ -514,6 +617,9 @@ namespace MWPhysics
     {
         if (auto found = mObjects.find(ptr.mRef); found != mObjects.end())
         {
+            if (found->second->isBatched())
+                removeFromBatch(ptr.mRef);
+
             if (mUnrefQueue.get())
                 mUnrefQueue->push(found->second->getShapeInstance());
 
@@ -587,10 +693,34 @@ namespace MWPhysics
         return nullptr;
     }
 
+    void PhysicsSystem::removeFromBatch(const MWWorld::LiveCellRefBase* ref)
+    {
+        for (auto it = mStaticBatches.begin(); it != mStaticBatches.end(); ++it)
+        {
+            if (it->second->remove(ref))
+            {
+                if (it->second->empty())
+                    mStaticBatches.erase(it);
+                return;
+            }
+        }
+    }
+
+    void PhysicsSystem::unbatchObject(const MWWorld::Ptr& ptr, Object& object)
+    {
+        if (!object.isBatched())
+            return;
+        removeFromBatch(ptr.mRef);
+        object.setBatched(false);
+        mTaskScheduler->addCollisionObject(object.getCollisionObject(), CollisionType_World,
+                                           CollisionType_Actor|CollisionType_HeightMap|CollisionType_Projectile);
+    }
+
     void PhysicsSystem::updateScale(const MWWorld::Ptr &ptr)
     {
         if (auto found = mObjects.find(ptr.mRef); found != mObjects.end())
         {
+            unbatchObject(ptr, *found->second);
             float scale = ptr.getCellRef().getScale();
             found->second->setScale(scale);
             mTaskScheduler->updateSingleAabb(found->second);
@@ -602,37 +732,52 @@ namespace MWPhysics
         }
     }
 
-    void PhysicsSystem::updateProjectile(const int projectileId, const osg::Vec3f &position) const
+    void PhysicsSystem::updateProjectiles(const std::vector<std::pair<int, osg::Vec3f>>& moves) const
     {
-        const auto foundProjectile = mProjectiles.find(projectileId);
-        assert(foundProjectile != mProjectiles.end());
-        auto* projectile = foundProjectile->second.get();
+        std::vector<std::shared_ptr<Projectile>> projectiles;
+        std::vector<ProjectileConvexCallback> callbacks;
+        std::vector<ConvexSweep> sweeps;
+        projectiles.reserve(moves.size());
+        // Reserving up front keeps the callback addresses stored in the sweeps stable.
+        callbacks.reserve(moves.size());
+        sweeps.reserve(moves.size());
 
-        btVector3 btFrom = Misc::Convert::toBullet(projectile->getPosition());
-        btVector3 btTo = Misc::Convert::toBullet(position);
+        const btQuaternion btrot = btQuaternion::getIdentity();
+        for (const auto& [projectileId, position] : moves)
+        {
+            const auto foundProjectile = mProjectiles.find(projectileId);
+            assert(foundProjectile != mProjectiles.end());
+            auto* projectile = foundProjectile->second.get();
 
-        if (btFrom == btTo)
-            return;
+            btVector3 btFrom = Misc::Convert::toBullet(projectile->getPosition());
+            btVector3 btTo = Misc::Convert::toBullet(position);
 
-        ProjectileConvexCallback resultCallback(projectile->getCasterCollisionObject(), projectile->getCollisionObject(), btFrom, btTo, projectile);
-        resultCallback.m_collisionFilterMask = 0xff;
-        resultCallback.m_collisionFilterGroup = CollisionType_Projectile;
+            if (btFrom == btTo)
+                continue;
 
-        const btQuaternion btrot = btQuaternion::getIdentity();
-        btTransform from_ (btrot, btFrom);
-        btTransform to_ (btrot, btTo);
+            projectiles.push_back(foundProjectile->second);
+            auto& resultCallback = callbacks.emplace_back(projectile->getCasterCollisionObject(), projectile->getCollisionObject(), btFrom, btTo, projectile);
+            resultCallback.m_collisionFilterMask = 0xff;
+            resultCallback.m_collisionFilterGroup = CollisionType_Projectile;
+            sweeps.push_back({projectile->getConvexShape(), btTransform(btrot, btFrom), btTransform(btrot, btTo), &resultCallback});
+        }
 
-        mTaskScheduler->convexSweepTest(projectile->getConvexShape(), from_, to_, resultCallback);
+        mTaskScheduler->convexSweepTestBatch(sweeps);
 
-        const auto newpos = projectile->isActive() ? position : Misc::Convert::toOsg(resultCallback.m_hitPointWorld);
-        projectile->setPosition(newpos);
-        mTaskScheduler->updateSingleAabb(foundProjectile->second);
+        for (std::size_t i = 0; i < projectiles.size(); ++i)
+        {
+            Projectile* projectile = projectiles[i].get();
+            const auto newpos = projectile->isActive() ? Misc::Convert::toOsg(sweeps[i].mTo.getOrigin()) : Misc::Convert::toOsg(callbacks[i].m_hitPointWorld);
+            projectile->setPosition(newpos);
+            mTaskScheduler->updateSingleAabb(projectiles[i]);
+        }
     }
 
     void PhysicsSystem::updateRotation(const MWWorld::Ptr &ptr, osg::Quat rotate)
     {
         if (auto found = mObjects.find(ptr.mRef); found != mObjects.end())
         {
+            unbatchObject(ptr, *found->second);
             found->second->setRotation(rotate);
             mTaskScheduler->updateSingleAabb(found->second);
         }
@@ -650,6 +795,7 @@ namespace MWPhysics
     {
         if (auto found = mObjects.find(ptr.mRef); found != mObjects.end())
         {
+            unbatchObject(ptr, *found->second);
             found->second->updatePosition();
             mTaskScheduler->updateSingleAabb(found->second);
         }
@@ -657,11 +803,16 @@ namespace MWPhysics
         {
             found->second->updatePosition();
             mTaskScheduler->updateSingleAabb(found->second, true);
+            // the immediate AABB update leaves no trace for the quiescence check, and the actor
+            // may need to fall or settle at its new position
+            mQuiescentFrames = 0;
         }
     }
 
     void PhysicsSystem::addActor (const MWWorld::Ptr& ptr, const std::string& mesh)
     {
+        Debug::ScopedMemoryDomain memoryDomain(Debug::MemoryDomain::Physics);
+
         osg::ref_ptr<const Resource::BulletShape> shape = mShapeManager->getShape(mesh);
 
         // Try to get shape from basic model as fallback for creatures
@@ -770,8 +921,15 @@ namespace MWPhysics
             const bool godmode = ptr == world->getPlayerConstPtr() && world->getGodModeState();
             const bool inert = stats.isDead() || (!godmode && stats.getMagicEffects().get(ESM::MagicEffect::Paralyze).getModifier() > 0);
 
+            // Out-of-range actors get LOD collision: their collision body stays in the world, so
+            // weapons, projectiles and other actors still hit them, but their own movement skips
+            // the stepper and most of the slide sequence. The tier is reassigned every frame, so
+            // an approaching player promotes them back to full collision automatically.
+            const bool lodCollision = ptr != world->getPlayerConstPtr()
+                    && MWBase::Environment::get().getMechanicsManager()->getAiUpdateTier(ptr) == MWMechanics::AiUpdateTier::Far;
+
             framedata.first.emplace_back(physicActor);
-            framedata.second.emplace_back(*physicActor, inert, waterCollision, slowFall, waterlevel);
+            framedata.second.emplace_back(*physicActor, inert, waterCollision, slowFall, waterlevel, lodCollision);
 
             // if the simulation will run, a jump request will be fulfilled. Update mechanics accordingly.
             if (willSimulate)
@@ -780,8 +938,35 @@ namespace MWPhysics
         return framedata;
     }
 
+    bool PhysicsSystem::isSimulationQuiescent()
+    {
+        // Every add, removal or move of non-actor collision geometry, including scripted moves
+        // and door animations, bumps the scheduler's world geometry revision
+        const std::uint64_t revision = mTaskScheduler->getWorldGeometryRevision();
+        const bool worldChanged = revision != mLastWorldGeometryRevision;
+        mLastWorldGeometryRevision = revision;
+        if (worldChanged || mTaskScheduler->hasQueuedAabbUpdates() || !mProjectiles.empty())
+            return false;
+
+        for (const auto& [ref, physicActor] : mActors)
+        {
+            if (physicActor->getVelocity() != osg::Vec3f() || physicActor->getInertialForce() != osg::Vec3f()
+                    || !physicActor->getOnGround() || physicActor->hasPendingPositionChange())
+                return false;
+            // a water walker must keep simulating so prepareFrameData notices the effect expiring
+            if (physicActor->isWalkingOnWater())
+                return false;
+            // let in-progress unstuck resolution finish; it settles or gives up within 10 frames
+            const unsigned int stuckFrames = physicActor->getStuckFrames();
+            if (stuckFrames > 0 && stuckFrames < 10)
+                return false;
+        }
+        return true;
+    }
+
     void PhysicsSystem::stepSimulation(float dt, bool skipSimulation, osg::Timer_t frameStart, unsigned int frameNumber, osg::Stats& stats)
     {
+        bool animationActivity = false;
         for (Object* animatedObject : mAnimatedObjects)
         {
             if (animatedObject->animateCollisionShapes())
@@ -789,6 +974,7 @@ namespace MWPhysics
                 auto obj = mObjects.find(animatedObject->getPtr().mRef);
                 assert(obj != mObjects.end());
                 mTaskScheduler->updateSingleAabb(obj->second);
+                animationActivity = true;
             }
         }
 
@@ -800,12 +986,35 @@ namespace MWPhysics
         mTimeAccum += dt;
 
         if (skipSimulation)
+        {
+            mQuiescentFrames = 0;
             mTaskScheduler->resetSimulation(mActors);
+        }
         else
         {
-            auto [actors, framedata] = prepareFrameData(mTimeAccum >= mPhysicsDt);
+            const bool quiescent = !animationActivity && isSimulationQuiescent();
+            if (!quiescent)
+                mQuiescentFrames = 0;
+
+            // Two simulated steps must confirm quiescence before the world may sleep: the first
+            // recomputes ground state from the current positions, the second consumes those
+            // results and shows the state reproduces itself. The final step's results are never
+            // consumed, which is safe precisely because they equal the state the actors are
+            // already in. While asleep the pipeline is skipped wholesale and the physics
+            // threads never wake; dropping the accumulated time keeps waking up from replaying
+            // a burst of steps.
+            if (quiescent && mQuiescentFrames >= 2)
+            {
+                mTimeAccum = 0.f;
+                return;
+            }
+
+            const bool willAdvance = mTimeAccum >= mPhysicsDt;
+            auto [actors, framedata] = prepareFrameData(willAdvance);
             // modifies mTimeAccum
             mTaskScheduler->applyQueuedMovements(mTimeAccum, std::move(actors), std::move(framedata), frameStart, frameNumber, stats);
+            if (quiescent && willAdvance)
+                ++mQuiescentFrames;
         }
     }
 
@@ -815,7 +1024,9 @@ namespace MWPhysics
         auto* world = MWBase::Environment::get().getWorld();
 
         // copy new ptr position in temporary vector. player is handled separately as its movement might change active cell.
-        std::vector<std::pair<MWWorld::Ptr, osg::Vec3f>> newPositions;
+        // The vector is discarded before the frame ends, so take it from the frame arena.
+        std::vector<std::pair<MWWorld::Ptr, osg::Vec3f>,
+            Misc::FrameAllocator<std::pair<MWWorld::Ptr, osg::Vec3f>>> newPositions;
         newPositions.reserve(mActors.size() - 1);
         for (const auto& [ptr, physicActor] : mActors)
         {
@@ -943,6 +1154,7 @@ namespace MWPhysics
         stats.setAttribute(frameNumber, "Physics Objects", mObjects.size());
         stats.setAttribute(frameNumber, "Physics Projectiles", mProjectiles.size());
         stats.setAttribute(frameNumber, "Physics HeightFields", mHeightFields.size());
+        stats.setAttribute(frameNumber, "Physics Sweeps", getAndResetSweepCount());
     }
 
     void PhysicsSystem::reportCollision(const btVector3& position, const btVector3& normal)
@@ -951,7 +1163,8 @@ namespace MWPhysics
             mDebugDrawer->addCollision(position, normal);
     }
 
-    ActorFrameData::ActorFrameData(Actor& actor, bool inert, bool waterCollision, float slowFall, float waterlevel)
+    ActorFrameData::ActorFrameData(Actor& actor, bool inert, bool waterCollision, float slowFall, float waterlevel,
+            bool lodCollision)
         : mPosition()
         , mStandingOn(nullptr)
         , mIsOnGround(actor.getOnGround())
@@ -973,6 +1186,7 @@ namespace MWPhysics
         , mIsAquatic(actor.getPtr().getClass().isPureWaterCreature(actor.getPtr()))
         , mWaterCollision(waterCollision)
         , mSkipCollisionDetection(actor.skipCollisions() || !actor.getCollisionMode())
+        , mLodCollision(lodCollision)
         , mNeedLand(false)
     {
     }
@@ -992,6 +1206,7 @@ namespace MWPhysics
         mInertia = actor.getInertialForce();
         mStuckFrames = actor.getStuckFrames();
         mLastStuckPosition = actor.getLastStuckPosition();
+        mGroundCache = actor.getGroundCache();
     }
 
     WorldFrameData::WorldFrameData()
@@ -1000,7 +1215,7 @@ namespace MWPhysics
     {}
 
     LOSRequest::LOSRequest(const std::weak_ptr<Actor>& a1, const std::weak_ptr<Actor>& a2)
-        : mResult(false), mStale(false), mAge(0)
+        : mResult(false), mStale(false), mAge(0), mResultAge(0)
     {
         // we use raw actor pointer pair to uniquely identify request
         // sort the pointer value in ascending order to not duplicate equivalent requests, eg. getLOS(A, B) and getLOS(B, A)
@@ -2,8 +2,10 @@
 #define OPENMW_MWPHYSICS_PHYSICSSYSTEM_H
 
 #include <array>
+#include <cstdint>
 #include <memory>
 #include <map>
+#include <optional>
 #include <set>
 #include <unordered_map>
 #include <algorithm>
@@ -16,6 +18,7 @@
 #include "../mwworld/ptr.hpp"
 
 #include "collisiontype.hpp"
+#include "groundcache.hpp"
 #include "raycasting.hpp"
 
 namespace osg
@@ -56,6 +59,7 @@ namespace MWPhysics
     class Actor;
     class PhysicsTaskScheduler;
     class Projectile;
+    class StaticBatch;
 
     using ActorMap = std::unordered_map<const MWWorld::LiveCellRefBase*, std::shared_ptr<Actor>>;
 
@@ -71,15 +75,19 @@ namespace MWPhysics
         LOSRequest(const std::weak_ptr<Actor>& a1, const std::weak_ptr<Actor>& a2);
         std::array<std::weak_ptr<Actor>, 2> mActors;
         std::array<const Actor*, 2> mRawActors;
+        // positions the actors were raycast at, so the refresh job can skip pairs that did not move
+        std::array<osg::Vec3f, 2> mPositions;
         bool mResult;
         bool mStale;
         int mAge;
+        int mResultAge;
     };
     bool operator==(const LOSRequest& lhs, const LOSRequest& rhs) noexcept;
 
     struct ActorFrameData
     {
-        ActorFrameData(Actor& actor, bool inert, bool waterCollision, float slowFall, float waterlevel);
+        ActorFrameData(Actor& actor, bool inert, bool waterCollision, float slowFall, float waterlevel,
+            bool lodCollision);
         void  updatePosition(Actor& actor, btCollisionWorld* world);
         osg::Vec3f mPosition;
         osg::Vec3f mInertia;
@@ -94,6 +102,7 @@ namespace MWPhysics
         osg::Vec2f mRotation;
         osg::Vec3f mMovement;
         osg::Vec3f mLastStuckPosition;
+        GroundCache mGroundCache;
         const float mWaterlevel;
         const float mHalfExtentsZ;
         float mOldHeight;
@@ -104,6 +113,9 @@ namespace MWPhysics
         const bool mIsAquatic;
         const bool mWaterCollision;
         const bool mSkipCollisionDetection;
+        // LOD collision for far-away actors: movement neither steps nor runs the full slide
+        // sequence, while the collision body itself stays in the world (see prepareFrameData)
+        const bool mLodCollision;
         bool mNeedLand;
     };
 
@@ -112,6 +124,7 @@ namespace MWPhysics
         WorldFrameData();
         bool mIsInStorm;
         osg::Vec3f mStormDirection;
+        std::uint64_t mWorldGeometryRevision = 0;
     };
 
     class PhysicsSystem : public RayCastingInterface
@@ -120,6 +133,23 @@ namespace MWPhysics
             PhysicsSystem (Resource::ResourceSystem* resourceSystem, osg::ref_ptr<osg::Group> parentNode);
             virtual ~PhysicsSystem ();
 
+            /// While an instance is alive, collision objects added to or removed from
+            /// the scene update the collision world under a single lock acquisition
+            /// instead of contending with the simulation threads once per object.
+            /// Meant for cell granular loads and unloads on the main thread; keep the
+            /// scope tight, background simulation is blocked for its duration.
+            class ScopedBatchUpdate
+            {
+            public:
+                explicit ScopedBatchUpdate(PhysicsSystem& physics);
+                ~ScopedBatchUpdate();
+                ScopedBatchUpdate(const ScopedBatchUpdate&) = delete;
+                ScopedBatchUpdate& operator=(const ScopedBatchUpdate&) = delete;
+
+            private:
+                PhysicsTaskScheduler& mTaskScheduler;
+            };
+
             void setUnrefQueue(SceneUtil::UnrefQueue* unrefQueue);
 
             Resource::BulletShapeManager* getShapeManager();
@@ -133,7 +163,10 @@ namespace MWPhysics
 
             int addProjectile(const MWWorld::Ptr& caster, const osg::Vec3f& position, const std::string& mesh, bool computeRadius, bool canTraverseWater);
             void setCaster(int projectileId, const MWWorld::Ptr& caster);
-            void updateProjectile(const int projectileId, const osg::Vec3f &position) const;
+            /// Sweep every projectile in \a moves towards its new position and
+            /// resolve hits. All sweeps run under a single collision world lock
+            /// acquisition instead of one per projectile.
+            void updateProjectiles(const std::vector<std::pair<int, osg::Vec3f>>& moves) const;
             void removeProjectile(const int projectileId);
 
             void updatePtr (const MWWorld::Ptr& old, const MWWorld::Ptr& updated);
@@ -190,6 +223,21 @@ namespace MWPhysics
 
             RayCastingResult castSphere(const osg::Vec3f& from, const osg::Vec3f& to, float radius) const override;
 
+            /// Queue a ray for asynchronous processing by the physics worker threads.
+            /// Parameters match castRay. Returns a handle for retrieveAsyncRayCastResult;
+            /// the result typically becomes available the next frame.
+            std::size_t asyncCastRay(const osg::Vec3f& from, const osg::Vec3f& to, const MWWorld::ConstPtr& ignore = MWWorld::ConstPtr(),
+                    const std::vector<MWWorld::Ptr>& targets = std::vector<MWWorld::Ptr>(),
+                    int mask = CollisionType_World|CollisionType_HeightMap|CollisionType_Actor|CollisionType_Door, int group=0xff);
+
+            /// Queue a sphere sweep for asynchronous processing. Parameters match castSphere.
+            std::size_t asyncCastSphere(const osg::Vec3f& from, const osg::Vec3f& to, float radius);
+
+            /// Retrieve the result of an earlier asyncCastRay/asyncCastSphere call.
+            /// Returns std::nullopt while the query is still pending; once a result
+            /// has been returned the handle is forgotten.
+            std::optional<RayCastingResult> retrieveAsyncRayCastResult(std::size_t handle);
+
             /// Return true if actor1 can see actor2.
             bool getLineOfSight(const MWWorld::ConstPtr& actor1, const MWWorld::ConstPtr& actor2) const override;
 
@@ -260,8 +308,20 @@ namespace MWPhysics
 
             void updateWater();
 
+            /// Remove \a ref's shape from whichever StaticBatch holds it, if any.
+            void removeFromBatch(const MWWorld::LiveCellRefBase* ref);
+
+            /// Give a batched object back its own entry in the collision world, so it can be
+            /// moved, scaled or rotated individually.
+            void unbatchObject(const MWWorld::Ptr& ptr, Object& object);
+
             std::pair<std::vector<std::shared_ptr<Actor>>, std::vector<ActorFrameData>> prepareFrameData(bool willSimulate);
 
+            /// Whether simulating would reproduce the current state exactly: no actor moves,
+            /// falls or has a pending scripted move, no projectile is in flight and no collision
+            /// geometry changed since the last frame.
+            bool isSimulationQuiescent();
+
             osg::ref_ptr<SceneUtil::UnrefQueue> mUnrefQueue;
 
             std::unique_ptr<btBroadphaseInterface> mBroadphase;
@@ -286,10 +346,19 @@ namespace MWPhysics
             using HeightFieldMap = std::map<std::pair<int, int>, std::unique_ptr<HeightField>>;
             HeightFieldMap mHeightFields;
 
+            // Compound bodies merging the shapes of batched statics, one per cell.
+            std::map<const MWWorld::CellStore*, std::unique_ptr<StaticBatch>> mStaticBatches;
+            bool mStaticBatchingEnabled;
+
             bool mDebugDrawEnabled;
 
             float mTimeAccum;
 
+            // World geometry revision seen by the last quiescence check, and how many frames in
+            // a row the world has been quiescent; simulation is skipped from the second one on.
+            std::uint64_t mLastWorldGeometryRevision = 0;
+            unsigned int mQuiescentFrames = 0;
+
             unsigned int mProjectileId;
 
             float mWaterHeight;
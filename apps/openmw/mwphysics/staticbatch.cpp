@@ -0,0 +1,62 @@
+#include "staticbatch.hpp"
+#include "collisiontype.hpp"
+#include "mtphysics.hpp"
+
+#include <BulletCollision/CollisionDispatch/btCollisionObject.h>
+#include <BulletCollision/CollisionShapes/btCompoundShape.h>
+
+namespace MWPhysics
+{
+    StaticBatch::StaticBatch(PhysicsTaskScheduler* scheduler)
+        : mCompound(std::make_unique<btCompoundShape>())
+        , mCollisionObject(std::make_unique<btCollisionObject>())
+        , mTaskScheduler(scheduler)
+    {
+        mCollisionObject->setCollisionShape(mCompound.get());
+        mTaskScheduler->addCollisionObject(mCollisionObject.get(), CollisionType_World,
+                                           CollisionType_Actor|CollisionType_HeightMap|CollisionType_Projectile);
+    }
+
+    StaticBatch::~StaticBatch()
+    {
+        mTaskScheduler->removeCollisionObject(mCollisionObject.get());
+    }
+
+    void StaticBatch::insert(const MWWorld::LiveCellRefBase* ref, btCollisionShape* shape, const btTransform& transform)
+    {
+        mCompound->addChildShape(transform, shape);
+        mChildIndices[ref] = mCompound->getNumChildShapes() - 1;
+        mTaskScheduler->refreshAabb(mCollisionObject.get());
+    }
+
+    bool StaticBatch::remove(const MWWorld::LiveCellRefBase* ref)
+    {
+        const auto found = mChildIndices.find(ref);
+        if (found == mChildIndices.end())
+            return false;
+        const int index = found->second;
+        const int lastIndex = mCompound->getNumChildShapes() - 1;
+        // removeChildShapeByIndex moves the last child into the freed slot
+        mCompound->removeChildShapeByIndex(index);
+        mChildIndices.erase(found);
+        if (index != lastIndex)
+        {
+            for (auto& [otherRef, otherIndex] : mChildIndices)
+            {
+                if (otherIndex == lastIndex)
+                {
+                    otherIndex = index;
+                    break;
+                }
+            }
+        }
+        mCompound->recalculateLocalAabb();
+        mTaskScheduler->refreshAabb(mCollisionObject.get());
+        return true;
+    }
+
+    bool StaticBatch::empty() const
+    {
+        return mChildIndices.empty();
+    }
+}
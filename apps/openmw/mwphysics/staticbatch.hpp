@@ -0,0 +1,53 @@
+#ifndef OPENMW_MWPHYSICS_STATICBATCH_H
+#define OPENMW_MWPHYSICS_STATICBATCH_H
+
+#include <map>
+#include <memory>
+
+class btCollisionObject;
+class btCollisionShape;
+class btCompoundShape;
+class btTransform;
+
+namespace MWWorld
+{
+    struct LiveCellRefBase;
+}
+
+namespace MWPhysics
+{
+    class PhysicsTaskScheduler;
+
+    /// Merges the collision shapes of immobile statics into a single compound body, so a cell
+    /// contributes one broadphase entry instead of one per object. Like the heightfields, the
+    /// merged body carries no user pointer; ray and contact hits on it report no Ptr, which is
+    /// why only objects that can not be activated or moved are eligible (see PhysicsSystem::addObject).
+    class StaticBatch
+    {
+    public:
+        StaticBatch(PhysicsTaskScheduler* scheduler);
+        ~StaticBatch();
+
+        /// Add the given shape as a child of the compound body. The transform is in world
+        /// coordinates; the caller is responsible for keeping the shape alive.
+        void insert(const MWWorld::LiveCellRefBase* ref, btCollisionShape* shape, const btTransform& transform);
+
+        /// Remove the child belonging to the given ref.
+        /// @return false if the ref was never inserted.
+        bool remove(const MWWorld::LiveCellRefBase* ref);
+
+        bool empty() const;
+
+    private:
+        std::unique_ptr<btCompoundShape> mCompound;
+        std::unique_ptr<btCollisionObject> mCollisionObject;
+        // Child index of each member in the compound shape.
+        std::map<const MWWorld::LiveCellRefBase*, int> mChildIndices;
+        PhysicsTaskScheduler* mTaskScheduler;
+
+        void operator=(const StaticBatch&);
+        StaticBatch(const StaticBatch&);
+    };
+}
+
+#endif
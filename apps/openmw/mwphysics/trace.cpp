@@ -1,5 +1,7 @@
 #include "trace.h"
 
+#include <atomic>
+
 #include <components/misc/convert.hpp>
 
 #include <BulletCollision/CollisionDispatch/btCollisionWorld.h>
@@ -9,9 +11,19 @@
 #include "actor.hpp"
 #include "actorconvexcallback.hpp"
 
+namespace
+{
+    std::atomic<std::size_t> sSweepCount {0};
+}
+
 namespace MWPhysics
 {
 
+std::size_t getAndResetSweepCount()
+{
+    return sSweepCount.exchange(0, std::memory_order_relaxed);
+}
+
 void ActorTracer::doTrace(const btCollisionObject *actor, const osg::Vec3f& start, const osg::Vec3f& end, const btCollisionWorld* world)
 {
     const btVector3 btstart = Misc::Convert::toBullet(start);
@@ -31,6 +43,7 @@ void ActorTracer::doTrace(const btCollisionObject *actor, const osg::Vec3f& star
 
     const btCollisionShape *shape = actor->getCollisionShape();
     assert(shape->isConvex());
+    sSweepCount.fetch_add(1, std::memory_order_relaxed);
     world->convexSweepTest(static_cast<const btConvexShape*>(shape), from, to, newTraceCallback);
 
     // Copy the hit data over to our trace results struct:
@@ -68,6 +81,7 @@ void ActorTracer::findGround(const Actor* actor, const osg::Vec3f& start, const
     newTraceCallback.m_collisionFilterMask = actor->getCollisionObject()->getBroadphaseHandle()->m_collisionFilterMask;
     newTraceCallback.m_collisionFilterMask &= ~CollisionType_Actor;
 
+    sSweepCount.fetch_add(1, std::memory_order_relaxed);
     world->convexSweepTest(actor->getConvexShape(), from, to, newTraceCallback);
     if(newTraceCallback.hasHit())
     {
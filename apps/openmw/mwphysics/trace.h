@@ -3,6 +3,8 @@
 
 #include <osg/Vec3f>
 
+#include <cstddef>
+
 class btCollisionObject;
 class btCollisionWorld;
 
@@ -11,6 +13,10 @@ namespace MWPhysics
 {
     class Actor;
 
+    /// Number of actor convex sweeps performed across all threads since the last call,
+    /// resetting the counter. Reported once per frame by PhysicsSystem::reportStats.
+    std::size_t getAndResetSweepCount();
+
     struct ActorTracer
     {
         osg::Vec3f mEndPos;
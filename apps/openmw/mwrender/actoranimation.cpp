@@ -247,7 +247,7 @@ bool ActorAnimation::useShieldAnimations() const
     if (!cls.hasInventoryStore(mPtr))
         return false;
 
-    if (getTextKeyTime("shield: equip attach") < 0 || getTextKeyTime("shield: unequip detach") < 0)
+    if (getTextKeyTime("shield", "equip attach") < 0 || getTextKeyTime("shield", "unequip detach") < 0)
         return false;
 
     const MWWorld::InventoryStore& inv = cls.getInventoryStore(mPtr);
@@ -25,6 +25,7 @@
 #include <components/vfs/manager.hpp>
 
 #include <components/sceneutil/actorutil.hpp>
+#include <components/sceneutil/clone.hpp>
 #include <components/sceneutil/statesetupdater.hpp>
 #include <components/sceneutil/visitor.hpp>
 #include <components/sceneutil/lightmanager.hpp>
@@ -546,6 +547,11 @@ namespace MWRender
             mSkeleton->setActive(static_cast<SceneUtil::Skeleton::ActiveType>(active));
     }
 
+    bool Animation::wasVisible() const
+    {
+        return mSkeleton == nullptr || mSkeleton->wasVisible();
+    }
+
     void Animation::updatePtr(const MWWorld::Ptr &ptr)
     {
         mPtr = ptr;
@@ -633,6 +639,15 @@ namespace MWRender
         if (!animsrc->mKeyframes || animsrc->mKeyframes->mTextKeys.empty() || animsrc->mKeyframes->mKeyframeControllers.empty())
             return;
 
+        // the keyframe controllers get attached to nodes of this instance, so the instance
+        // can not keep referencing its template's graph
+        if (mObjectRoot && SceneUtil::unshareGraph(mObjectRoot))
+        {
+            // the node map would point into the graph we just replaced
+            mNodeMap.clear();
+            mNodeMapCreated = false;
+        }
+
         const NodeMap& nodeMap = getNodeMap();
 
         for (SceneUtil::KeyframeHolder::KeyframeControllerMap::const_iterator it = animsrc->mKeyframes->mKeyframeControllers.begin();
@@ -713,7 +728,7 @@ namespace MWRender
         return -1.f;
     }
 
-    float Animation::getTextKeyTime(const std::string &textKey) const
+    float Animation::getTextKeyTime(std::string_view groupname, std::string_view key) const
     {
         for(AnimSourceList::const_reverse_iterator iter(mAnimSources.rbegin()); iter != mAnimSources.rend(); ++iter)
         {
@@ -721,7 +736,12 @@ namespace MWRender
 
             for(auto iterKey = keys.begin(); iterKey != keys.end(); ++iterKey)
             {
-                if(iterKey->second.compare(0, textKey.size(), textKey) == 0)
+                // Compare against "<groupname>: <key>" without building the concatenated string
+                const std::string& evt = iterKey->second;
+                if (evt.size() >= groupname.size() + 2 + key.size()
+                    && evt.compare(0, groupname.size(), groupname.data(), groupname.size()) == 0
+                    && evt.compare(groupname.size(), 2, ": ") == 0
+                    && evt.compare(groupname.size() + 2, key.size(), key.data(), key.size()) == 0)
                     return iterKey->first;
             }
         }
@@ -1432,6 +1452,8 @@ namespace MWRender
 
         if (isCreature)
         {
+            // removes drawables from the graph, so the graph must be private to this instance
+            SceneUtil::unshareGraph(mObjectRoot);
             SceneUtil::RemoveTriBipVisitor removeTriBipVisitor;
             mObjectRoot->accept(removeTriBipVisitor);
             removeTriBipVisitor.remove();
@@ -7,6 +7,7 @@
 #include <components/sceneutil/textkeymap.hpp>
 #include <components/sceneutil/util.hpp>
 
+#include <string_view>
 #include <vector>
 
 namespace ESM
@@ -357,6 +358,11 @@ public:
     /// 0 = Inactive, 1 = Active in place, 2 = Active
     void setActive(int active);
 
+    /// Whether the object was rendered within the last few frames, based on the cull traversal results.
+    /// Always true for objects without a skeleton.
+    /// @see SceneUtil::Skeleton::wasVisible
+    bool wasVisible() const;
+
     osg::Group* getOrCreateObjectRoot();
 
     osg::Group* getObjectRoot();
@@ -434,8 +440,9 @@ public:
     /// Get the absolute position in the animation track of the first text key with the given group.
     float getStartTime(const std::string &groupname) const;
 
-    /// Get the absolute position in the animation track of the text key
-    float getTextKeyTime(const std::string &textKey) const;
+    /// Get the absolute position in the animation track of the text key "<groupname>: <key>".
+    /// Matches by prefix, so \a key may be a prefix of the stored key.
+    float getTextKeyTime(std::string_view groupname, std::string_view key) const;
 
     /// Get the current absolute position in the animation track for the animation that is currently playing from the given group.
     float getCurrentTime(const std::string& groupname) const;
@@ -0,0 +1,79 @@
+#include "cellrefcache.hpp"
+
+#include <algorithm>
+
+#include <components/esm/esmreader.hpp>
+#include <components/misc/stringops.hpp>
+
+#include "apps/openmw/mwworld/esmstore.hpp"
+#include "apps/openmw/mwbase/environment.hpp"
+#include "apps/openmw/mwbase/world.hpp"
+
+namespace MWRender
+{
+
+    std::shared_ptr<const CellRefCache::RefList> CellRefCache::get(int cellX, int cellY)
+    {
+        const std::pair<int, int> key(cellX, cellY);
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            Cache::iterator found = mCache.find(key);
+            if (found != mCache.end())
+                return found->second;
+        }
+
+        std::map<ESM::RefNum, ESM::CellRef> refs;
+        const MWWorld::ESMStore& store = MWBase::Environment::get().getWorld()->getStore();
+        const ESM::Cell* cell = store.get<ESM::Cell>().searchStatic(cellX, cellY);
+        if (cell)
+        {
+            std::vector<ESM::ESMReader> esm;
+            for (size_t i=0; i<cell->mContextList.size(); ++i)
+            {
+                try
+                {
+                    unsigned int index = cell->mContextList[i].index;
+                    if (esm.size()<=index)
+                        esm.resize(index+1);
+                    cell->restore(esm[index], i);
+                    ESM::CellRef ref;
+                    ref.mRefNum.unset();
+                    ESM::MovedCellRef cMRef;
+                    cMRef.mRefNum.mIndex = 0;
+                    bool deleted = false;
+                    bool moved = false;
+                    while(cell->getNextRef(esm[index], ref, deleted, cMRef, moved))
+                    {
+                        if (moved)
+                            continue;
+
+                        if (std::find(cell->mMovedRefs.begin(), cell->mMovedRefs.end(), ref.mRefNum) != cell->mMovedRefs.end()) continue;
+                        if (deleted) { refs.erase(ref.mRefNum); continue; }
+                        Misc::StringUtils::lowerCaseInPlace(ref.mRefID);
+                        refs[ref.mRefNum] = std::move(ref);
+                    }
+                }
+                catch (std::exception&)
+                {
+                    continue;
+                }
+            }
+            for (auto [ref, deleted] : cell->mLeasedRefs)
+            {
+                if (deleted) { refs.erase(ref.mRefNum); continue; }
+                Misc::StringUtils::lowerCaseInPlace(ref.mRefID);
+                refs[ref.mRefNum] = std::move(ref);
+            }
+        }
+
+        std::shared_ptr<RefList> list = std::make_shared<RefList>();
+        list->reserve(refs.size());
+        for (auto& pair : refs)
+            list->push_back(Ref {pair.first, pair.second.mScale, pair.second.mPos, std::move(pair.second.mRefID)});
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        // if another thread parsed the same cell in the meantime, keep its table
+        return mCache.emplace(key, std::move(list)).first->second;
+    }
+
+}
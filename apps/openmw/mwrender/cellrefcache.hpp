@@ -0,0 +1,50 @@
+#ifndef OPENMW_MWRENDER_CELLREFCACHE_H
+#define OPENMW_MWRENDER_CELLREFCACHE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <components/esm/cellref.hpp>
+#include <components/esm/defs.hpp>
+
+namespace MWRender
+{
+
+    /// @brief Per-cell tables of the content file references used by the chunk builders.
+    ///
+    /// Object paging and groundcover both collect the references of every cell a chunk
+    /// touches, and they used to re-read them from the content files for every chunk they
+    /// built. This cache parses each cell once on first use and keeps a compact table with
+    /// the merge of all content files already applied (moved and deleted references are
+    /// resolved, IDs are lower case), so chunk builds iterate an in-memory array instead.
+    class CellRefCache
+    {
+    public:
+        struct Ref
+        {
+            ESM::RefNum mRefNum;
+            float mScale;
+            ESM::Position mPos;
+            std::string mRefID;
+        };
+
+        typedef std::vector<Ref> RefList;
+
+        /// Get the reference table of the given exterior cell, building it if this is the
+        /// first request. Returns an empty table for cells that do not exist.
+        /// @note Thread safe.
+        std::shared_ptr<const RefList> get(int cellX, int cellY);
+
+    private:
+        std::mutex mMutex;
+        typedef std::map<std::pair<int, int>, std::shared_ptr<const RefList>> Cache;
+        Cache mCache;
+    };
+
+}
+
+#endif
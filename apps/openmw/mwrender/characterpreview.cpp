@@ -365,6 +365,7 @@ namespace MWRender
 
     InventoryPreview::InventoryPreview(osg::Group* parent, Resource::ResourceSystem* resourceSystem, const MWWorld::Ptr& character)
         : CharacterPreview(parent, resourceSystem, character, 512, 1024, osg::Vec3f(0, 700, 71), osg::Vec3f(0,0,71))
+        , mUpdateQueued(false)
     {
     }
 
@@ -383,6 +384,19 @@ namespace MWRender
     }
 
     void InventoryPreview::update()
+    {
+        mUpdateQueued = true;
+    }
+
+    void InventoryPreview::onFrame()
+    {
+        if (!mUpdateQueued)
+            return;
+        mUpdateQueued = false;
+        applyUpdate();
+    }
+
+    void InventoryPreview::applyUpdate()
     {
         if (!mAnimation.get())
             return;
@@ -477,9 +491,16 @@ namespace MWRender
         return -1;
     }
 
-    void InventoryPreview::updatePtr(const MWWorld::Ptr &ptr)
+    bool InventoryPreview::updatePtr(const MWWorld::Ptr &ptr)
     {
+        // Reuse the existing animation when the underlying reference is unchanged - re-instancing
+        // the NpcAnimation reloads every body part and equipment model, while update() handles
+        // equipment changes on the existing instance.
+        if (ptr.getBase() == mCharacter.getBase() && mAnimation.get())
+            return false;
+
         mCharacter = MWWorld::Ptr(ptr.getBase(), nullptr);
+        return true;
     }
 
     void InventoryPreview::onSetup()
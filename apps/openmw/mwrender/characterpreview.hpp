@@ -76,9 +76,11 @@ namespace MWRender
 
         InventoryPreview(osg::Group* parent, Resource::ResourceSystem* resourceSystem, const MWWorld::Ptr& character);
 
-        void updatePtr(const MWWorld::Ptr& ptr);
+        /// @return Did the character change, so that the caller needs to rebuild() the preview?
+        bool updatePtr(const MWWorld::Ptr& ptr);
 
-        void update(); // Render preview again, e.g. after changed equipment
+        void update(); // Queue a preview render, e.g. after changed equipment
+        void onFrame(); // Apply a queued update(), if any. Several updates queued in the same frame only render once.
         void setViewport(int sizeX, int sizeY);
 
         int getSlotSelected(int posX, int posY);
@@ -87,6 +89,11 @@ namespace MWRender
         osg::ref_ptr<osg::Viewport> mViewport;
 
         void onSetup() override;
+
+    private:
+        void applyUpdate();
+
+        bool mUpdateQueued;
     };
 
     class UpdateCameraCallback;
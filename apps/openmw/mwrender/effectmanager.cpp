@@ -11,6 +11,19 @@
 #include "vismask.hpp"
 #include "util.hpp"
 
+namespace
+{
+    // Pooled subgraphs keep their texture override, so the key must include
+    // everything that affects the instance's appearance.
+    std::string makeEffectKey(const std::string& model, const std::string& textureOverride, bool isMagicVFX)
+    {
+        return model + '|' + textureOverride + (isMagicVFX ? "|magic" : "");
+    }
+
+    // Enough for heavy spell fights while keeping worst-case memory bounded.
+    constexpr std::size_t sMaxFreeEffects = 64;
+}
+
 namespace MWRender
 {
 
@@ -27,12 +40,30 @@ EffectManager::~EffectManager()
 
 void EffectManager::addEffect(const std::string &model, const std::string& textureOverride, const osg::Vec3f &worldPosition, float scale, bool isMagicVFX)
 {
+    const std::string key = makeEffectKey(model, textureOverride, isMagicVFX);
+
+    EffectPool::iterator free = mFreeEffects.find(key);
+    if (free != mFreeEffects.end())
+    {
+        osg::ref_ptr<osg::PositionAttitudeTransform> trans = free->second.first;
+        Effect effect = free->second.second;
+        mFreeEffects.erase(free);
+
+        effect.mAnimTime->resetTime(0.f);
+        trans->setPosition(worldPosition);
+        trans->setScale(osg::Vec3f(scale, scale, scale));
+        mParentNode->addChild(trans);
+        mEffects[trans] = effect;
+        return;
+    }
+
     osg::ref_ptr<osg::Node> node = mResourceSystem->getSceneManager()->getInstance(model);
 
     node->setNodeMask(Mask_Effect);
 
     Effect effect;
     effect.mAnimTime.reset(new EffectAnimationTime);
+    effect.mPoolKey = key;
 
     SceneUtil::FindMaxControllerLengthVisitor findMaxLengthVisitor;
     node->accept(findMaxLengthVisitor);
@@ -65,6 +96,8 @@ void EffectManager::update(float dt)
         if (it->second.mAnimTime->getTime() >= it->second.mMaxControllerLength)
         {
             mParentNode->removeChild(it->first);
+            if (mFreeEffects.size() < sMaxFreeEffects)
+                mFreeEffects.emplace(it->second.mPoolKey, std::make_pair(it->first, it->second));
             mEffects.erase(it++);
         }
         else
@@ -79,6 +112,7 @@ void EffectManager::clear()
         mParentNode->removeChild(it->first);
     }
     mEffects.clear();
+    mFreeEffects.clear();
 }
 
 }
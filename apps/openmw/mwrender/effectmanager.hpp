@@ -4,6 +4,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include <osg/ref_ptr>
 
@@ -44,11 +45,18 @@ namespace MWRender
         {
             float mMaxControllerLength;
             std::shared_ptr<EffectAnimationTime> mAnimTime;
+            std::string mPoolKey;
         };
 
         typedef std::map<osg::ref_ptr<osg::PositionAttitudeTransform>, Effect> EffectMap;
         EffectMap mEffects;
 
+        // Finished effect subgraphs kept for reuse, keyed by model and texture override.
+        // Their GL objects are already compiled, so respawning a pooled effect neither
+        // clones the scene graph nor stalls the draw thread.
+        typedef std::multimap<std::string, std::pair<osg::ref_ptr<osg::PositionAttitudeTransform>, Effect>> EffectPool;
+        EffectPool mFreeEffects;
+
         osg::ref_ptr<osg::Group> mParentNode;
         Resource::ResourceSystem* mResourceSystem;
 
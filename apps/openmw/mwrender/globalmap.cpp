@@ -30,17 +30,18 @@
 namespace
 {
 
-    // Create a screen-aligned quad with given texture coordinates.
+    // Create a quad with given texture coordinates, covering the given rect in clip space.
     // Assumes a top-left origin of the sampled image.
-    osg::ref_ptr<osg::Geometry> createTexturedQuad(float leftTexCoord, float topTexCoord, float rightTexCoord, float bottomTexCoord)
+    osg::ref_ptr<osg::Geometry> createTexturedQuad(float leftTexCoord, float topTexCoord, float rightTexCoord, float bottomTexCoord,
+                                                   float left = -1.f, float bottom = -1.f, float right = 1.f, float top = 1.f)
     {
         osg::ref_ptr<osg::Geometry> geom = new osg::Geometry;
 
         osg::ref_ptr<osg::Vec3Array> verts = new osg::Vec3Array;
-        verts->push_back(osg::Vec3f(-1, -1, 0));
-        verts->push_back(osg::Vec3f(-1, 1, 0));
-        verts->push_back(osg::Vec3f(1, 1, 0));
-        verts->push_back(osg::Vec3f(1, -1, 0));
+        verts->push_back(osg::Vec3f(left, bottom, 0));
+        verts->push_back(osg::Vec3f(left, top, 0));
+        verts->push_back(osg::Vec3f(right, top, 0));
+        verts->push_back(osg::Vec3f(right, bottom, 0));
 
         geom->setVertexArray(verts);
 
@@ -277,8 +278,7 @@ namespace MWRender
         imageY = (1.f-float(z / float(Constants::CellSizeInUnits) - mMinY) / (mMaxY - mMinY + 1)) * getHeight();
     }
 
-    void GlobalMap::requestOverlayTextureUpdate(int x, int y, int width, int height, osg::ref_ptr<osg::Texture2D> texture, bool clear, bool cpuCopy,
-                                                float srcLeft, float srcTop, float srcRight, float srcBottom)
+    osg::ref_ptr<osg::Camera> GlobalMap::createOverlayCamera(int x, int y, int width, int height, bool clear, bool cpuCopy)
     {
         osg::ref_ptr<osg::Camera> camera (new osg::Camera);
         camera->setNodeMask(Mask_RenderToTexture);
@@ -287,7 +287,6 @@ namespace MWRender
         camera->setProjectionMatrix(osg::Matrix::identity());
         camera->setProjectionResizePolicy(osg::Camera::FIXED);
         camera->setRenderOrder(osg::Camera::PRE_RENDER, 1); // Make sure the global map is rendered after the local map
-        y = mHeight - y - height; // convert top-left origin to bottom-left
         camera->setViewport(x, y, width, height);
 
         if (clear)
@@ -321,42 +320,64 @@ namespace MWRender
             mPendingImageDest[camera] = imageDest;
         }
 
-        // Create a quad rendering the updated texture
-        if (texture)
-        {
-            osg::ref_ptr<osg::Geometry> geom = createTexturedQuad(srcLeft, srcTop, srcRight, srcBottom);
-            auto depth = SceneUtil::createDepth();
-            depth->setWriteMask(0);
-            osg::StateSet* stateset = geom->getOrCreateStateSet();
-            stateset->setAttribute(depth);
-            stateset->setTextureAttributeAndModes(0, texture, osg::StateAttribute::ON);
-            stateset->setMode(GL_LIGHTING, osg::StateAttribute::OFF);
-            stateset->setMode(GL_DEPTH_TEST, osg::StateAttribute::OFF);
-
-            if (mAlphaTexture)
-            {
-                osg::ref_ptr<osg::Vec2Array> texcoords = new osg::Vec2Array;
-
-                float x1 = x / static_cast<float>(mWidth);
-                float x2 = (x + width) / static_cast<float>(mWidth);
-                float y1 = y / static_cast<float>(mHeight);
-                float y2 = (y + height) / static_cast<float>(mHeight);
-                texcoords->push_back(osg::Vec2f(x1, y1));
-                texcoords->push_back(osg::Vec2f(x1, y2));
-                texcoords->push_back(osg::Vec2f(x2, y2));
-                texcoords->push_back(osg::Vec2f(x2, y1));
-                geom->setTexCoordArray(1, texcoords, osg::Array::BIND_PER_VERTEX);
-
-                stateset->setTextureAttributeAndModes(1, mAlphaTexture, osg::StateAttribute::ON);
-                osg::ref_ptr<osg::TexEnvCombine> texEnvCombine = new osg::TexEnvCombine;
-                texEnvCombine->setCombine_RGB(osg::TexEnvCombine::REPLACE);
-                texEnvCombine->setSource0_RGB(osg::TexEnvCombine::PREVIOUS);
-                stateset->setTextureAttributeAndModes(1, texEnvCombine);
-            }
+        return camera;
+    }
 
-            camera->addChild(geom);
+    osg::ref_ptr<osg::Node> GlobalMap::createOverlayQuad(osg::ref_ptr<osg::Texture2D> texture,
+                                                         int x, int y, int width, int height,
+                                                         int viewportX, int viewportY, int viewportWidth, int viewportHeight,
+                                                         float srcLeft, float srcTop, float srcRight, float srcBottom)
+    {
+        // Map the destination rect (bottom-left origin, overlay pixels) into the clip space of the camera viewport
+        float left = (x - viewportX) / static_cast<float>(viewportWidth) * 2.f - 1.f;
+        float right = (x + width - viewportX) / static_cast<float>(viewportWidth) * 2.f - 1.f;
+        float bottom = (y - viewportY) / static_cast<float>(viewportHeight) * 2.f - 1.f;
+        float top = (y + height - viewportY) / static_cast<float>(viewportHeight) * 2.f - 1.f;
+
+        osg::ref_ptr<osg::Geometry> geom = createTexturedQuad(srcLeft, srcTop, srcRight, srcBottom, left, bottom, right, top);
+        auto depth = SceneUtil::createDepth();
+        depth->setWriteMask(0);
+        osg::StateSet* stateset = geom->getOrCreateStateSet();
+        stateset->setAttribute(depth);
+        stateset->setTextureAttributeAndModes(0, texture, osg::StateAttribute::ON);
+        stateset->setMode(GL_LIGHTING, osg::StateAttribute::OFF);
+        stateset->setMode(GL_DEPTH_TEST, osg::StateAttribute::OFF);
+
+        if (mAlphaTexture)
+        {
+            osg::ref_ptr<osg::Vec2Array> texcoords = new osg::Vec2Array;
+
+            float x1 = x / static_cast<float>(mWidth);
+            float x2 = (x + width) / static_cast<float>(mWidth);
+            float y1 = y / static_cast<float>(mHeight);
+            float y2 = (y + height) / static_cast<float>(mHeight);
+            texcoords->push_back(osg::Vec2f(x1, y1));
+            texcoords->push_back(osg::Vec2f(x1, y2));
+            texcoords->push_back(osg::Vec2f(x2, y2));
+            texcoords->push_back(osg::Vec2f(x2, y1));
+            geom->setTexCoordArray(1, texcoords, osg::Array::BIND_PER_VERTEX);
+
+            stateset->setTextureAttributeAndModes(1, mAlphaTexture, osg::StateAttribute::ON);
+            osg::ref_ptr<osg::TexEnvCombine> texEnvCombine = new osg::TexEnvCombine;
+            texEnvCombine->setCombine_RGB(osg::TexEnvCombine::REPLACE);
+            texEnvCombine->setSource0_RGB(osg::TexEnvCombine::PREVIOUS);
+            stateset->setTextureAttributeAndModes(1, texEnvCombine);
         }
 
+        return geom;
+    }
+
+    void GlobalMap::requestOverlayTextureUpdate(int x, int y, int width, int height, osg::ref_ptr<osg::Texture2D> texture, bool clear, bool cpuCopy,
+                                                float srcLeft, float srcTop, float srcRight, float srcBottom)
+    {
+        y = mHeight - y - height; // convert top-left origin to bottom-left
+
+        osg::ref_ptr<osg::Camera> camera = createOverlayCamera(x, y, width, height, clear, cpuCopy);
+
+        // Create a quad rendering the updated texture
+        if (texture)
+            camera->addChild(createOverlayQuad(texture, x, y, width, height, x, y, width, height, srcLeft, srcTop, srcRight, srcBottom));
+
         mRoot->addChild(camera);
 
         mActiveCameras.push_back(camera);
@@ -369,13 +390,48 @@ namespace MWRender
         if (!localMapTexture)
             return;
 
-        int originX = (cellX - mMinX) * mCellSize;
-        int originY = (cellY - mMinY + 1) * mCellSize; // +1 because we want the top left corner of the cell, not the bottom left
-
         if (cellX > mMaxX || cellX < mMinX || cellY > mMaxY || cellY < mMinY)
             return;
 
-        requestOverlayTextureUpdate(originX, mHeight - originY, mCellSize, mCellSize, localMapTexture, false, true);
+        // Batched up and flushed as a single overlay pass by cleanupCameras()
+        PendingExplore explore;
+        explore.mX = (cellX - mMinX) * mCellSize;
+        explore.mY = (cellY - mMinY) * mCellSize; // bottom-left origin
+        explore.mTexture = localMapTexture;
+        mPendingExplores.push_back(explore);
+    }
+
+    void GlobalMap::flushPendingExplores()
+    {
+        if (mPendingExplores.empty())
+            return;
+
+        // Render all cells explored this frame in one pass, with a single viewport and CPU
+        // readback covering their bounding rect. Cells explored together are adjacent, so the
+        // rect stays tight; any other pixels it covers are re-copied with unchanged values.
+        int left = mWidth;
+        int bottom = mHeight;
+        int right = 0;
+        int top = 0;
+        for (const PendingExplore& explore : mPendingExplores)
+        {
+            left = std::min(left, explore.mX);
+            bottom = std::min(bottom, explore.mY);
+            right = std::max(right, explore.mX + mCellSize);
+            top = std::max(top, explore.mY + mCellSize);
+        }
+
+        osg::ref_ptr<osg::Camera> camera = createOverlayCamera(left, bottom, right-left, top-bottom, false, true);
+
+        for (const PendingExplore& explore : mPendingExplores)
+            camera->addChild(createOverlayQuad(explore.mTexture, explore.mX, explore.mY, mCellSize, mCellSize,
+                                               left, bottom, right-left, top-bottom, 0.f, 0.f, 1.f, 1.f));
+
+        mRoot->addChild(camera);
+
+        mActiveCameras.push_back(camera);
+
+        mPendingExplores.clear();
     }
 
     void GlobalMap::clear()
@@ -385,6 +441,7 @@ namespace MWRender
         memset(mOverlayImage->data(), 0, mOverlayImage->getTotalSizeInBytes());
 
         mPendingImageDest.clear();
+        mPendingExplores.clear();
 
         // just push a Camera to clear the FBO, instead of setImage()/dirty()
         // easier, since we don't need to worry about synchronizing access :)
@@ -599,6 +656,8 @@ namespace MWRender
             removeCamera(camera);
 
         mCamerasPendingRemoval.clear();
+
+        flushPendingExplores();
     }
 
     void GlobalMap::removeCamera(osg::Camera *cam)
@@ -9,6 +9,7 @@
 
 namespace osg
 {
+    class Node;
     class Texture2D;
     class Image;
     class Group;
@@ -49,8 +50,9 @@ namespace MWRender
         void clear();
 
         /**
-         * Removes cameras that have already been rendered. Should be called every frame to ensure that
-         * we do not render the same map more than once. Note, this cleanup is difficult to implement in an
+         * Removes cameras that have already been rendered and flushes pending exploreCell updates
+         * into a single overlay pass. Should be called every frame to ensure that we do not render
+         * the same map more than once. Note, this cleanup is difficult to implement in an
          * automated fashion, since we can't alter the scene graph structure from within an update callback.
          */
         void cleanupCameras();
@@ -81,6 +83,19 @@ namespace MWRender
         void requestOverlayTextureUpdate(int x, int y, int width, int height, osg::ref_ptr<osg::Texture2D> texture, bool clear, bool cpuCopy,
                                          float srcLeft = 0.f, float srcTop = 0.f, float srcRight = 1.f, float srcBottom = 1.f);
 
+        /// Create a camera rendering into the given viewport rect of mOverlayTexture (bottom-left coordinate origin)
+        osg::ref_ptr<osg::Camera> createOverlayCamera(int x, int y, int width, int height, bool clear, bool cpuCopy);
+
+        /// Create a quad rendering the given texture into the destination rect (bottom-left coordinate origin),
+        /// expressed in the clip space of a camera with the given viewport rect
+        osg::ref_ptr<osg::Node> createOverlayQuad(osg::ref_ptr<osg::Texture2D> texture,
+                                                  int x, int y, int width, int height,
+                                                  int viewportX, int viewportY, int viewportWidth, int viewportHeight,
+                                                  float srcLeft, float srcTop, float srcRight, float srcBottom);
+
+        /// Render all cells explored since the last flush in one overlay pass
+        void flushPendingExplores();
+
         int mCellSize;
 
         osg::ref_ptr<osg::Group> mRoot;
@@ -109,6 +124,13 @@ namespace MWRender
 
         std::vector< std::pair<int,int> > mExploredCells;
 
+        struct PendingExplore
+        {
+            int mX, mY; // destination in overlay pixels, bottom-left origin
+            osg::ref_ptr<osg::Texture2D> mTexture;
+        };
+        std::vector<PendingExplore> mPendingExplores;
+
         osg::ref_ptr<osg::Texture2D> mBaseTexture;
         osg::ref_ptr<osg::Texture2D> mAlphaTexture;
 
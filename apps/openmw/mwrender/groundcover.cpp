@@ -5,7 +5,6 @@
 #include <osg/Geometry>
 #include <osg/VertexAttribDivisor>
 
-#include <components/esm/esmreader.hpp>
 #include <components/sceneutil/lightmanager.hpp>
 
 #include "apps/openmw/mwworld/esmstore.hpp"
@@ -105,7 +104,7 @@ namespace MWRender
             geom.setVertexAttribArray(7, rotations.get(), osg::Array::BIND_PER_VERTEX);
         }
     private:
-        std::vector<Groundcover::GroundcoverEntry> mInstances;
+        std::vector<Groundcover::GroundcoverEntry>& mInstances;
         osg::Vec3f mChunkPosition;
     };
 
@@ -135,7 +134,7 @@ namespace MWRender
         float mDensity = 0.f;
     };
 
-    inline bool isInChunkBorders(ESM::CellRef& ref, osg::Vec2f& minBound, osg::Vec2f& maxBound)
+    inline bool isInChunkBorders(const CellRefCache::Ref& ref, osg::Vec2f& minBound, osg::Vec2f& maxBound)
     {
         osg::Vec2f size = maxBound - minBound;
         if (size.x() >=1 && size.y() >=1) return true;
@@ -149,7 +148,7 @@ namespace MWRender
         return true;
     }
 
-    osg::ref_ptr<osg::Node> Groundcover::getChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags, bool activeGrid, const osg::Vec3f& viewPoint, bool compile)
+    osg::ref_ptr<osg::Node> Groundcover::getChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags, bool activeGrid, const osg::Vec3f& viewPoint, bool compile, const std::atomic<bool>* abort)
     {
         GroundcoverChunkId id = std::make_tuple(center, size);
 
@@ -158,6 +157,8 @@ namespace MWRender
             return static_cast<osg::Node*>(obj.get());
         else
         {
+            if (abort && *abort)
+                return nullptr;
             InstanceMap instances;
             collectInstances(instances, size, center);
             osg::ref_ptr<osg::Node> node = createChunk(instances, center);
@@ -166,10 +167,11 @@ namespace MWRender
         }
     }
 
-    Groundcover::Groundcover(Resource::SceneManager* sceneManager, float density)
+    Groundcover::Groundcover(Resource::SceneManager* sceneManager, float density, std::shared_ptr<CellRefCache> refCache)
          : GenericResourceManager<GroundcoverChunkId>(nullptr)
          , mSceneManager(sceneManager)
          , mDensity(density)
+         , mRefCache(std::move(refCache))
          , mStateset(new osg::StateSet)
     {
          // MGE uses default alpha settings for groundcover, so we can not rely on alpha properties
@@ -188,41 +190,27 @@ namespace MWRender
         osg::Vec2f minBound = (center - osg::Vec2f(size/2.f, size/2.f));
         osg::Vec2f maxBound = (center + osg::Vec2f(size/2.f, size/2.f));
         DensityCalculator calculator(mDensity);
-        std::vector<ESM::ESMReader> esm;
         osg::Vec2i startCell = osg::Vec2i(std::floor(center.x() - size/2.f), std::floor(center.y() - size/2.f));
         for (int cellX = startCell.x(); cellX < startCell.x() + size; ++cellX)
         {
             for (int cellY = startCell.y(); cellY < startCell.y() + size; ++cellY)
             {
-                const ESM::Cell* cell = store.get<ESM::Cell>().searchStatic(cellX, cellY);
-                if (!cell) continue;
-
+                // The per-cell reference tables are parsed from the content files once and
+                // shared with the object paging chunks; building a chunk only iterates them.
                 calculator.reset();
-                for (size_t i=0; i<cell->mContextList.size(); ++i)
+                for (const CellRefCache::Ref& ref : *mRefCache->get(cellX, cellY))
                 {
-                    unsigned int index = cell->mContextList[i].index;
-                    if (esm.size() <= index)
-                        esm.resize(index+1);
-                    cell->restore(esm[index], i);
-                    ESM::CellRef ref;
-                    ref.mRefNum.unset();
-                    bool deleted = false;
-                    while(cell->getNextRef(esm[index], ref, deleted))
-                    {
-                        if (deleted) continue;
-                        if (!ref.mRefNum.fromGroundcoverFile()) continue;
-
-                        if (!calculator.isInstanceEnabled()) continue;
-                        if (!isInChunkBorders(ref, minBound, maxBound)) continue;
-
-                        Misc::StringUtils::lowerCaseInPlace(ref.mRefID);
-                        int type = store.findStatic(ref.mRefID);
-                        std::string model = getGroundcoverModel(type, ref.mRefID, store);
-                        if (model.empty()) continue;
-                        model = "meshes/" + model;
-
-                        instances[model].emplace_back(std::move(ref), std::move(model));
-                    }
+                    if (!ref.mRefNum.fromGroundcoverFile()) continue;
+
+                    if (!calculator.isInstanceEnabled()) continue;
+                    if (!isInChunkBorders(ref, minBound, maxBound)) continue;
+
+                    int type = store.findStatic(ref.mRefID);
+                    std::string model = getGroundcoverModel(type, ref.mRefID, store);
+                    if (model.empty()) continue;
+                    model = "meshes/" + model;
+
+                    instances[model].emplace_back(ref, model);
                 }
             }
         }
@@ -235,7 +223,10 @@ namespace MWRender
         for (auto& pair : instances)
         {
             const osg::Node* temp = mSceneManager->getTemplate(pair.first);
-            osg::ref_ptr<osg::Node> node = static_cast<osg::Node*>(temp->clone(osg::CopyOp::DEEP_COPY_NODES|osg::CopyOp::DEEP_COPY_DRAWABLES|osg::CopyOp::DEEP_COPY_USERDATA|osg::CopyOp::DEEP_COPY_ARRAYS|osg::CopyOp::DEEP_COPY_PRIMITIVES));
+            // The primitive sets carry the per-chunk instance count and the geometries the
+            // per-chunk instance attributes and bounds, so they need their own copies, but the
+            // vertex data itself is identical for every chunk and stays shared with the template.
+            osg::ref_ptr<osg::Node> node = static_cast<osg::Node*>(temp->clone(osg::CopyOp::DEEP_COPY_NODES|osg::CopyOp::DEEP_COPY_DRAWABLES|osg::CopyOp::DEEP_COPY_USERDATA|osg::CopyOp::DEEP_COPY_PRIMITIVES));
 
             // Keep link to original mesh to keep it in cache
             group->getOrCreateUserDataContainer()->addUserObject(new Resource::TemplateRef(temp));
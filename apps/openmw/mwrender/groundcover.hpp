@@ -1,11 +1,15 @@
 #ifndef OPENMW_MWRENDER_GROUNDCOVER_H
 #define OPENMW_MWRENDER_GROUNDCOVER_H
 
+#include <memory>
+
 #include <components/terrain/quadtreeworld.hpp>
 #include <components/resource/scenemanager.hpp>
 #include <components/sceneutil/statesetupdater.hpp>
 #include <components/esm/loadcell.hpp>
 
+#include "cellrefcache.hpp"
+
 namespace MWRender
 {
     class GroundcoverUpdater : public SceneUtil::StateSetUpdater
@@ -33,10 +37,10 @@ namespace MWRender
     class Groundcover : public Resource::GenericResourceManager<GroundcoverChunkId>, public Terrain::QuadTreeWorld::ChunkManager
     {
     public:
-        Groundcover(Resource::SceneManager* sceneManager, float density);
+        Groundcover(Resource::SceneManager* sceneManager, float density, std::shared_ptr<CellRefCache> refCache);
         ~Groundcover() = default;
 
-        osg::ref_ptr<osg::Node> getChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags, bool activeGrid, const osg::Vec3f& viewPoint, bool compile) override;
+        osg::ref_ptr<osg::Node> getChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags, bool activeGrid, const osg::Vec3f& viewPoint, bool compile, const std::atomic<bool>* abort) override;
 
         unsigned int getNodeMask() override;
 
@@ -48,7 +52,7 @@ namespace MWRender
             float mScale;
             std::string mModel;
 
-            GroundcoverEntry(const ESM::CellRef& ref, const std::string& model):
+            GroundcoverEntry(const CellRefCache::Ref& ref, const std::string& model):
                 mPos(ref.mPos), mScale(ref.mScale), mModel(model)
             {}
         };
@@ -56,6 +60,7 @@ namespace MWRender
     private:
         Resource::SceneManager* mSceneManager;
         float mDensity;
+        std::shared_ptr<CellRefCache> mRefCache;
         osg::ref_ptr<osg::StateSet> mStateset;
 
         typedef std::map<std::string, std::vector<GroundcoverEntry>> InstanceMap;
@@ -29,7 +29,11 @@ osg::ref_ptr<ESMTerrain::LandObject> LandManager::getLand(int x, int y)
         if (!land)
             return nullptr;
         osg::ref_ptr<ESMTerrain::LandObject> landObj (new ESMTerrain::LandObject(land, mLoadFlags));
-        mCache->addEntryToObjectCache(std::make_pair(x,y), landObj.get());
+        // The LandObject owns a full copy of the land data, so report its size to the cache.
+        // Entries referenced by terrain chunks (i.e. the active grid and loaded distant terrain)
+        // are never evicted; beyond that the cache size limit throws out the least recently
+        // used cells and their data is re-read from the content files when needed again.
+        mCache->addEntryToObjectCache(std::make_pair(x,y), landObj.get(), 0.0, sizeof(ESM::Land::LandData));
         return landObj;
     }
 }
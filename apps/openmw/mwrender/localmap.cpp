@@ -1,5 +1,6 @@
 #include "localmap.hpp"
 
+#include <algorithm>
 #include <stdint.h>
 
 #include <osg/Fog>
@@ -86,6 +87,8 @@ namespace MWRender
 
 LocalMap::LocalMap(osg::Group* root)
     : mRoot(root)
+    , mMaxUpdatesPerFrame(std::max(0, Settings::Manager::getInt("local map updates per frame", "Map")))
+    , mSegmentCacheSize(std::max(0, Settings::Manager::getInt("local map cell cache size", "Map")))
     , mMapResolution(Settings::Manager::getInt("local map resolution", "Map"))
     , mMapWorldSize(Constants::CellSizeInUnits)
     , mCellDistance(Constants::CellGridRadius)
@@ -109,6 +112,8 @@ LocalMap::~LocalMap()
         removeCamera(camera);
     for (auto& camera : mCamerasPendingRemoval)
         removeCamera(camera);
+    for (auto& camera : mQueuedCameras)
+        removeCamera(camera);
 }
 
 const osg::Vec2f LocalMap::rotatePoint(const osg::Vec2f& point, const osg::Vec2f& center, const float angle)
@@ -121,6 +126,7 @@ void LocalMap::clear()
 {
     mExteriorSegments.clear();
     mInteriorSegments.clear();
+    mCachedSegments.clear();
 }
 
 void LocalMap::saveFogOfWar(MWWorld::CellStore* cell)
@@ -260,8 +266,7 @@ void LocalMap::setupRenderToTexture(osg::ref_ptr<osg::Camera> camera, int x, int
     SceneUtil::attachAlphaToCoverageFriendlyFramebufferToCamera(camera, osg::Camera::COLOR_BUFFER, texture);
 
     camera->addChild(mSceneRoot);
-    mRoot->addChild(camera);
-    mActiveCameras.push_back(camera);
+    mQueuedCameras.push_back(camera);
 
     MapSegment& segment = mInterior? mInteriorSegments[std::make_pair(x, y)] : mExteriorSegments[std::make_pair(x, y)];
     segment.mMapTexture = texture;
@@ -290,12 +295,33 @@ void LocalMap::requestMap(const MWWorld::CellStore* cell)
 void LocalMap::addCell(MWWorld::CellStore *cell)
 {
     if (cell->isExterior())
-        mExteriorSegments[std::make_pair(cell->getCell()->getGridX(), cell->getCell()->getGridY())].needUpdate = true;
+    {
+        std::pair<int, int> coords (cell->getCell()->getGridX(), cell->getCell()->getGridY());
+        // The cell is loaded, so its contents may change; the cached texture is stale.
+        auto cached = std::find(mCachedSegments.begin(), mCachedSegments.end(), coords);
+        if (cached != mCachedSegments.end())
+            mCachedSegments.erase(cached);
+        mExteriorSegments[coords].needUpdate = true;
+    }
 }
 
 void LocalMap::removeExteriorCell(int x, int y)
 {
-    mExteriorSegments.erase({ x, y });
+    if (mSegmentCacheSize == 0)
+    {
+        mExteriorSegments.erase({ x, y });
+        return;
+    }
+    std::pair<int, int> coords (x, y);
+    auto cached = std::find(mCachedSegments.begin(), mCachedSegments.end(), coords);
+    if (cached != mCachedSegments.end())
+        mCachedSegments.erase(cached);
+    mCachedSegments.push_back(coords);
+    while (mCachedSegments.size() > mSegmentCacheSize)
+    {
+        mExteriorSegments.erase(mCachedSegments.front());
+        mCachedSegments.pop_front();
+    }
 }
 
 void LocalMap::removeCell(MWWorld::CellStore *cell)
@@ -346,13 +372,27 @@ void LocalMap::markForRemoval(osg::Camera *cam)
 
 void LocalMap::cleanupCameras()
 {
-    if (mCamerasPendingRemoval.empty())
-        return;
-
     for (auto& camera : mCamerasPendingRemoval)
         removeCamera(camera);
 
     mCamerasPendingRemoval.clear();
+
+    if (mQueuedCameras.empty())
+        return;
+
+    // Activate queued cameras, up to the configured limit, so the segment renders are
+    // spread over several frames instead of hitting a single frame
+    size_t count = mQueuedCameras.size();
+    if (mMaxUpdatesPerFrame > 0)
+        count = std::min(count, mMaxUpdatesPerFrame);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        mRoot->addChild(mQueuedCameras[i]);
+        mActiveCameras.push_back(mQueuedCameras[i]);
+    }
+
+    mQueuedCameras.erase(mQueuedCameras.begin(), mQueuedCameras.begin() + count);
 }
 
 void LocalMap::requestExteriorMap(const MWWorld::CellStore* cell)
@@ -638,25 +678,31 @@ void LocalMap::updatePlayer (const osg::Vec3f& position, const osg::Quat& orient
 
             uint32_t* data = (uint32_t*)segment.mFogOfWarImage->data();
             bool changed = false;
-            for (int texV = 0; texV<sFogOfWarResolution; ++texV)
+
+            // Only walk the texels the explore circle can touch; outside the radius the alpha clamp is a no-op
+            const float centerU = (u - mx) * (sFogOfWarResolution-1);
+            const float centerV = (v - my) * (sFogOfWarResolution-1);
+            const int minU = std::max(0, static_cast<int>(centerU - exploreRadius));
+            const int maxU = std::min(sFogOfWarResolution-1, static_cast<int>(centerU + exploreRadius) + 1);
+            const int minV = std::max(0, static_cast<int>(centerV - exploreRadius));
+            const int maxV = std::min(sFogOfWarResolution-1, static_cast<int>(centerV + exploreRadius) + 1);
+
+            for (int texV = minV; texV<=maxV; ++texV)
             {
-                for (int texU = 0; texU<sFogOfWarResolution; ++texU)
+                for (int texU = minU; texU<=maxU; ++texU)
                 {
-                    float sqrDist = square((texU + mx*(sFogOfWarResolution-1)) - u*(sFogOfWarResolution-1))
-                            + square((texV + my*(sFogOfWarResolution-1)) - v*(sFogOfWarResolution-1));
+                    float sqrDist = square(texU - centerU) + square(texV - centerV);
 
-                    uint32_t clr = *(uint32_t*)data;
-                    uint8_t alpha = (clr >> 24);
+                    uint32_t& texel = data[texV * sFogOfWarResolution + texU];
+                    uint8_t alpha = (texel >> 24);
 
                     alpha = std::min( alpha, (uint8_t) (std::max(0.f, std::min(1.f, (sqrDist/sqrExploreRadius)))*255) );
                     uint32_t val = (uint32_t) (alpha << 24);
-                    if ( *data != val)
+                    if ( texel != val)
                     {
-                        *data = val;
+                        texel = val;
                         changed = true;
                     }
-
-                    ++data;
                 }
             }
 
@@ -1,6 +1,7 @@
 #ifndef GAME_RENDER_LOCALMAP_H
 #define GAME_RENDER_LOCALMAP_H
 
+#include <deque>
 #include <set>
 #include <vector>
 #include <map>
@@ -66,8 +67,9 @@ namespace MWRender
         void markForRemoval(osg::Camera* cam);
 
         /**
-         * Removes cameras that have already been rendered. Should be called every frame to ensure that
-         * we do not render the same map more than once. Note, this cleanup is difficult to implement in an
+         * Removes cameras that have already been rendered and activates queued cameras, up to the
+         * configured per-frame limit. Should be called every frame to ensure that we do not render
+         * the same map more than once. Note, this cleanup is difficult to implement in an
          * automated fashion, since we can't alter the scene graph structure from within an update callback.
          */
         void cleanupCameras();
@@ -110,6 +112,11 @@ namespace MWRender
 
         CameraVector mCamerasPendingRemoval;
 
+        // Cameras waiting for their render. Activated by cleanupCameras, a few per frame, so that
+        // multi-cell interiors don't render all of their segments in a single frame.
+        CameraVector mQueuedCameras;
+        size_t mMaxUpdatesPerFrame;
+
         typedef std::set<std::pair<int, int> > Grid;
         Grid mCurrentGrid;
 
@@ -136,6 +143,13 @@ namespace MWRender
         SegmentMap mExteriorSegments;
         SegmentMap mInteriorSegments;
 
+        // Exterior segments that left the map view are kept (least recently
+        // evicted first) so panning back does not need a new render-to-texture
+        // pass. Once the queue exceeds the configured size, the oldest
+        // segments are dropped for real.
+        std::deque<std::pair<int, int>> mCachedSegments;
+        size_t mSegmentCacheSize;
+
         int mMapResolution;
 
         // the dynamic texture is a bottleneck, so don't set this too high
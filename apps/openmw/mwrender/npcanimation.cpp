@@ -328,6 +328,7 @@ NpcAnimation::~NpcAnimation()
 NpcAnimation::NpcAnimation(const MWWorld::Ptr& ptr, osg::ref_ptr<osg::Group> parentNode, Resource::ResourceSystem* resourceSystem,
                            bool disableSounds, ViewMode viewMode, float firstPersonFieldOfView)
   : ActorAnimation(ptr, parentNode, resourceSystem),
+    mPartUpdateActive(false),
     mViewMode(viewMode),
     mShowWeapons(false),
     mShowCarriedLeft(true),
@@ -349,6 +350,7 @@ NpcAnimation::NpcAnimation(const MWWorld::Ptr& ptr, osg::ref_ptr<osg::Group> par
     }
 
     std::fill(mSounds.begin(), mSounds.end(), nullptr);
+    std::fill(mPreviousSounds.begin(), mPreviousSounds.end(), nullptr);
 
     updateNpcBase();
 }
@@ -616,6 +618,10 @@ void NpcAnimation::updateParts()
     bool wasArrowAttached = isArrowAttached();
     mAmmunition.reset();
 
+    // defer destruction of removed parts, so slots that resolve to the same
+    // part again keep their subtree instead of rebuilding it
+    beginPartUpdate();
+
     const MWWorld::InventoryStore& inv = mPtr.getClass().getInventoryStore(mPtr);
     for(size_t i = 0;i < slotlistsize && mViewMode != VM_HeadOnly;i++)
     {
@@ -672,7 +678,10 @@ void NpcAnimation::updateParts()
             addOrReplaceIndividualPart(ESM::PRT_Hair, -1,1, mHairModel);
     }
     if(mViewMode == VM_HeadOnly)
+    {
+        endPartUpdate();
         return;
+    }
 
     if(mPartPriorities[ESM::PRT_Shield] < 1)
     {
@@ -706,6 +715,8 @@ void NpcAnimation::updateParts()
         }
     }
 
+    endPartUpdate();
+
     if (wasArrowAttached)
         attachArrow();
 }
@@ -752,11 +763,43 @@ osg::Vec3f NpcAnimation::runAnimation(float timepassed)
     return ret;
 }
 
+void NpcAnimation::beginPartUpdate()
+{
+    mPartUpdateActive = true;
+}
+
+void NpcAnimation::endPartUpdate()
+{
+    mPartUpdateActive = false;
+
+    for (int i = 0; i < ESM::PRT_Count; ++i)
+    {
+        if (!mPreviousParts[i].get())
+            continue;
+
+        mPreviousParts[i].reset();
+        if (mPreviousSounds[i] != nullptr && !mSoundsDisabled)
+            MWBase::Environment::get().getSoundManager()->stopSound(mPreviousSounds[i]);
+        mPreviousSounds[i] = nullptr;
+    }
+}
+
 void NpcAnimation::removeIndividualPart(ESM::PartReferenceType type)
 {
     mPartPriorities[type] = 0;
     mPartslots[type] = -1;
 
+    if (mPartUpdateActive && mObjectParts[type].get() && !mPreviousParts[type].get())
+    {
+        // keep the subtree and its sound until endPartUpdate(); the same part
+        // may be reclaimed by addOrReplaceIndividualPart()
+        mPreviousParts[type] = std::move(mObjectParts[type]);
+        mPreviousPartInfo[type] = mPartInfo[type];
+        mPreviousSounds[type] = mSounds[type];
+        mSounds[type] = nullptr;
+        return;
+    }
+
     mObjectParts[type].reset();
     if (mSounds[type] != nullptr && !mSoundsDisabled)
     {
@@ -824,9 +867,29 @@ bool NpcAnimation::addOrReplaceIndividualPart(ESM::PartReferenceType type, int g
             }
         }
 
+        PartInfo info;
+        info.mMesh = mesh;
+        info.mBonename = bonename;
+        info.mGroup = group;
+        info.mEnchantedGlow = enchantedGlow;
+        if (enchantedGlow && glowColor)
+            info.mGlowColor = *glowColor;
+
+        if (mPreviousParts[type].get() && info.matches(mPreviousPartInfo[type]))
+        {
+            // the identical part is still attached from before this update
+            // pass; reclaim it instead of instantiating it again
+            mObjectParts[type] = std::move(mPreviousParts[type]);
+            mPartInfo[type] = info;
+            mSounds[type] = mPreviousSounds[type];
+            mPreviousSounds[type] = nullptr;
+            return true;
+        }
+
         // PRT_Hair seems to be the only type that breaks consistency and uses a filter that's different from the attachment bone
         const std::string bonefilter = (type == ESM::PRT_Hair) ? "hair" : bonename;
         mObjectParts[type] = insertBoundedPart(mesh, bonename, bonefilter, enchantedGlow, glowColor);
+        mPartInfo[type] = info;
     }
     catch (std::exception& e)
     {
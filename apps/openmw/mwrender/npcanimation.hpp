@@ -45,10 +45,38 @@ public:
 private:
     static const PartBoneMap sPartList;
 
+    // Description of how a displayed body part was created, used to detect
+    // that an equipment update resolves to the same part again.
+    struct PartInfo
+    {
+        std::string mMesh;
+        std::string mBonename;
+        int mGroup;
+        bool mEnchantedGlow;
+        osg::Vec4f mGlowColor;
+
+        PartInfo() : mGroup(-1), mEnchantedGlow(false) {}
+
+        bool matches(const PartInfo& other) const
+        {
+            return mMesh == other.mMesh && mBonename == other.mBonename && mGroup == other.mGroup
+                    && mEnchantedGlow == other.mEnchantedGlow
+                    && (!mEnchantedGlow || mGlowColor == other.mGlowColor);
+        }
+    };
+
     // Bounded Parts
     PartHolderPtr mObjectParts[ESM::PRT_Count];
+    PartInfo mPartInfo[ESM::PRT_Count];
     std::array<MWSound::Sound*, ESM::PRT_Count> mSounds;
 
+    // Parts removed during the current updateParts() pass, kept alive so an
+    // unchanged part can be reclaimed instead of rebuilt.
+    PartHolderPtr mPreviousParts[ESM::PRT_Count];
+    PartInfo mPreviousPartInfo[ESM::PRT_Count];
+    std::array<MWSound::Sound*, ESM::PRT_Count> mPreviousSounds;
+    bool mPartUpdateActive;
+
     const ESM::NPC *mNpc;
     std::string    mHeadModel;
     std::string    mHairModel;
@@ -86,6 +114,12 @@ private:
     PartHolderPtr insertBoundedPart(const std::string &model, const std::string &bonename,
                                         const std::string &bonefilter, bool enchantedGlow, osg::Vec4f* glowColor=nullptr);
 
+    /// Start an updateParts() pass: removed parts are kept detached so an
+    /// identical part can be reclaimed instead of instantiated again.
+    void beginPartUpdate();
+    /// Finish an updateParts() pass, destroying all parts that were not reclaimed.
+    void endPartUpdate();
+
     void removeIndividualPart(ESM::PartReferenceType type);
     void reserveIndividualPart(ESM::PartReferenceType type, int group, int priority);
 
@@ -4,12 +4,13 @@
 
 #include <osg/Version>
 #include <osg/LOD>
+#include <osg/Timer>
 #include <osg/Switch>
 #include <osg/MatrixTransform>
 #include <osg/Material>
 #include <osgUtil/IncrementalCompileOperation>
+#include <osgUtil/Simplifier>
 
-#include <components/esm/esmreader.hpp>
 #include <components/misc/resourcehelpers.hpp>
 #include <components/resource/scenemanager.hpp>
 #include <components/sceneutil/optimizer.hpp>
@@ -30,6 +31,7 @@
 #include "apps/openmw/mwbase/environment.hpp"
 #include "apps/openmw/mwbase/world.hpp"
 
+#include "cellrefcache.hpp"
 #include "vismask.hpp"
 
 namespace MWRender
@@ -68,7 +70,7 @@ namespace MWRender
         }
     }
 
-    osg::ref_ptr<osg::Node> ObjectPaging::getChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags, bool activeGrid, const osg::Vec3f& viewPoint, bool compile)
+    osg::ref_ptr<osg::Node> ObjectPaging::getChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags, bool activeGrid, const osg::Vec3f& viewPoint, bool compile, const std::atomic<bool>* abort)
     {
         if (activeGrid && !mActiveGrid)
             return nullptr;
@@ -80,7 +82,9 @@ namespace MWRender
             return static_cast<osg::Node*>(obj.get());
         else
         {
-            osg::ref_ptr<osg::Node> node = createChunk(size, center, activeGrid, viewPoint, compile);
+            osg::ref_ptr<osg::Node> node = createChunk(size, center, activeGrid, viewPoint, compile, abort);
+            if (!node)
+                return nullptr; // aborted mid-build, don't cache the incomplete chunk
             mCache->addEntryToObjectCache(id, node.get());
             return node;
         }
@@ -369,6 +373,35 @@ namespace MWRender
         }
     };
 
+    // Sample ratio for the vertices kept by each level of detail band. Band 0 is the
+    // unmodified template and never reaches the simplifier; the last band carries the
+    // silhouettes kept past the regular culling distance by the horizon factor.
+    constexpr float sLodSampleRatio[] = { 1.f, 0.5f, 0.25f, 0.1f };
+
+    class SimplifyVisitor : public osg::NodeVisitor
+    {
+    public:
+        SimplifyVisitor(float sampleRatio)
+            : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+        {
+            mSimplifier.setSampleRatio(sampleRatio);
+            // keep the source normals rather than recomputing them from the collapsed mesh
+            mSimplifier.setDoTriStrip(false);
+            mSimplifier.setSmoothing(false);
+        }
+        void apply(osg::Geometry& geom) override
+        {
+            // The simplifier only maintains the standard arrays, so geometry carrying
+            // custom vertex attributes (e.g. generated tangents) keeps full detail.
+            for (const auto& attrib : geom.getVertexAttribArrayList())
+                if (attrib.valid())
+                    return;
+            mSimplifier.simplify(geom);
+        }
+    private:
+        osgUtil::Simplifier mSimplifier;
+    };
+
     class AddRefnumMarkerVisitor : public osg::NodeVisitor
     {
     public:
@@ -384,9 +417,10 @@ namespace MWRender
         }
     };
 
-    ObjectPaging::ObjectPaging(Resource::SceneManager* sceneManager)
+    ObjectPaging::ObjectPaging(Resource::SceneManager* sceneManager, std::shared_ptr<CellRefCache> refCache)
             : GenericResourceManager<ChunkId>(nullptr)
          , mSceneManager(sceneManager)
+         , mRefCache(std::move(refCache))
          , mRefTrackerLocked(false)
     {
         mActiveGrid = Settings::Manager::getBool("object paging active grid", "Terrain");
@@ -395,81 +429,80 @@ namespace MWRender
         mMinSize = Settings::Manager::getFloat("object paging min size", "Terrain");
         mMinSizeMergeFactor = Settings::Manager::getFloat("object paging min size merge factor", "Terrain");
         mMinSizeCostMultiplier = Settings::Manager::getFloat("object paging min size cost multiplier", "Terrain");
+        mMeshLodFactor = Settings::Manager::getFloat("object paging mesh lod factor", "Terrain");
+        mHorizonFactor = std::max(1.f, Settings::Manager::getFloat("object paging horizon factor", "Terrain"));
+    }
+
+    int ObjectPaging::getLodBand(float radius2, float dist2) const
+    {
+        if (dist2 <= 0.f)
+            return 0;
+        // Objects below the regular culling cutoff are only visible because of the horizon
+        // factor; they keep just enough geometry to read as a distant silhouette.
+        if (mHorizonFactor > 1.f && radius2 < dist2 * mMinSize * mMinSize)
+            return 3;
+        if (mMeshLodFactor <= 0.f)
+            return 0;
+        // Apparent size relative to the 'min size' culling cutoff: an object at 1 is about
+        // to be discarded entirely, so hardly any surface detail can still be visible.
+        float relativeSize2 = radius2 / (dist2 * mMinSize * mMinSize * mMeshLodFactor * mMeshLodFactor);
+        if (relativeSize2 < 16.f) // less than 4x the cutoff
+            return 2;
+        if (relativeSize2 < 256.f) // less than 16x the cutoff
+            return 1;
+        return 0;
     }
 
-    osg::ref_ptr<osg::Node> ObjectPaging::createChunk(float size, const osg::Vec2f& center, bool activeGrid, const osg::Vec3f& viewPoint, bool compile)
+    osg::ref_ptr<const osg::Node> ObjectPaging::getSimplifiedTemplate(const std::string& model, osg::ref_ptr<const osg::Node> node, int lodBand)
+    {
+        if (lodBand <= 0)
+            return node;
+
+        std::pair<std::string, int> key(model, lodBand);
+        {
+            std::lock_guard<std::mutex> lock(mLodCacheMutex);
+            LodCache::iterator found = mLodCache.find(key);
+            if (found != mLodCache.end())
+                return found->second;
+        }
+
+        // deep copy so the decimation can not touch the template shared with the rest of the engine
+        osg::ref_ptr<osg::Node> copy = static_cast<osg::Node*>(node->clone(osg::CopyOp::DEEP_COPY_NODES
+            |osg::CopyOp::DEEP_COPY_DRAWABLES|osg::CopyOp::DEEP_COPY_ARRAYS|osg::CopyOp::DEEP_COPY_PRIMITIVES));
+        SimplifyVisitor visitor(sLodSampleRatio[lodBand]);
+        copy->accept(visitor);
+
+        std::lock_guard<std::mutex> lock(mLodCacheMutex);
+        // if another thread built the same variant in the meantime, keep that one
+        return mLodCache.emplace(std::move(key), std::move(copy)).first->second;
+    }
+
+    osg::ref_ptr<osg::Node> ObjectPaging::createChunk(float size, const osg::Vec2f& center, bool activeGrid, const osg::Vec3f& viewPoint, bool compile, const std::atomic<bool>* abort)
     {
         osg::Vec2i startCell = osg::Vec2i(std::floor(center.x() - size/2.f), std::floor(center.y() - size/2.f));
 
         osg::Vec3f worldCenter = osg::Vec3f(center.x(), center.y(), 0)*ESM::Land::REAL_SIZE;
         osg::Vec3f relativeViewPoint = viewPoint - worldCenter;
 
-        std::map<ESM::RefNum, ESM::CellRef> refs;
-        std::vector<ESM::ESMReader> esm;
+        osg::Timer stageTimer;
+
         const MWWorld::ESMStore& store = MWBase::Environment::get().getWorld()->getStore();
 
+        // The per-cell reference tables are parsed from the content files once and shared
+        // with the groundcover chunks; building a chunk only iterates them.
+        std::vector<std::shared_ptr<const CellRefCache::RefList>> refLists;
         for (int cellX = startCell.x(); cellX < startCell.x() + size; ++cellX)
-        {
             for (int cellY = startCell.y(); cellY < startCell.y() + size; ++cellY)
-            {
-                const ESM::Cell* cell = store.get<ESM::Cell>().searchStatic(cellX, cellY);
-                if (!cell) continue;
-                for (size_t i=0; i<cell->mContextList.size(); ++i)
-                {
-                    try
-                    {
-                        unsigned int index = cell->mContextList[i].index;
-                        if (esm.size()<=index)
-                            esm.resize(index+1);
-                        cell->restore(esm[index], i);
-                        ESM::CellRef ref;
-                        ref.mRefNum.unset();
-                        ESM::MovedCellRef cMRef;
-                        cMRef.mRefNum.mIndex = 0;
-                        bool deleted = false;
-                        bool moved = false;
-                        while(cell->getNextRef(esm[index], ref, deleted, cMRef, moved))
-                        {
-                            if (moved)
-                                continue;
-
-                            if (std::find(cell->mMovedRefs.begin(), cell->mMovedRefs.end(), ref.mRefNum) != cell->mMovedRefs.end()) continue;
-                            Misc::StringUtils::lowerCaseInPlace(ref.mRefID);
-                            int type = store.findStatic(ref.mRefID);
-                            if (!typeFilter(type,size>=2)) continue;
-                            if (deleted) { refs.erase(ref.mRefNum); continue; }
-                            if (ref.mRefNum.fromGroundcoverFile()) continue;
-                            refs[ref.mRefNum] = std::move(ref);
-                        }
-                    }
-                    catch (std::exception&)
-                    {
-                        continue;
-                    }
-                }
-                for (auto [ref, deleted] : cell->mLeasedRefs)
-                {
-                    if (deleted) { refs.erase(ref.mRefNum); continue; }
-                    Misc::StringUtils::lowerCaseInPlace(ref.mRefID);
-                    int type = store.findStatic(ref.mRefID);
-                    if (!typeFilter(type,size>=2)) continue;
-                    refs[ref.mRefNum] = std::move(ref);
-                }
-            }
-        }
+                refLists.push_back(mRefCache->get(cellX, cellY));
 
-        if (activeGrid)
-        {
-            std::lock_guard<std::mutex> lock(mRefTrackerMutex);
-            for (auto ref : getRefTracker().mBlacklist)
-                refs.erase(ref);
-        }
+        const double collectTime = stageTimer.time_s();
+        stageTimer.setStartTick();
 
         osg::Vec2f minBound = (center - osg::Vec2f(size/2.f, size/2.f));
         osg::Vec2f maxBound = (center + osg::Vec2f(size/2.f, size/2.f));
         struct InstanceList
         {
-            std::vector<const ESM::CellRef*> mInstances;
+            std::vector<const CellRefCache::Ref*> mInstances;
             AnalyzeVisitor::Result mAnalyzeResult;
             bool mNeedCompile = false;
         };
@@ -488,9 +521,27 @@ namespace MWRender
         float minSize = mMinSize;
         if (mMinSizeMergeFactor)
             minSize *= mMinSizeMergeFactor;
-        for (const auto& pair : refs)
-        {
-            const ESM::CellRef& ref = pair.second;
+        // The horizon factor keeps objects visible that many times further out than the
+        // 'min size' cutoff; getLodBand assigns them the cheapest geometry band.
+        minSize /= mHorizonFactor;
+        for (const auto& refList : refLists)
+        for (const CellRefCache::Ref& ref : *refList)
+        {
+            // loading the templates below is the expensive part of this stage, so poll per ref
+            if (abort && *abort)
+                return nullptr;
+
+            if (ref.mRefNum.fromGroundcoverFile()) continue;
+
+            int type = store.findStatic(ref.mRefID);
+            if (!typeFilter(type,size>=2)) continue;
+
+            if (activeGrid)
+            {
+                std::lock_guard<std::mutex> lock(mRefTrackerMutex);
+                if (getRefTracker().mBlacklist.count(ref.mRefNum))
+                    continue;
+            }
 
             osg::Vec3f pos = ref.mPos.asVec3();
             if (size < 1.f)
@@ -505,7 +556,7 @@ namespace MWRender
             if (!activeGrid)
             {
                 std::lock_guard<std::mutex> lock(mSizeCacheMutex);
-                SizeCache::iterator found = mSizeCache.find(pair.first);
+                SizeCache::iterator found = mSizeCache.find(ref.mRefNum);
                 if (found != mSizeCache.end() && found->second < dSqr*minSize*minSize)
                     continue;
             }
@@ -513,7 +564,6 @@ namespace MWRender
             if (Misc::ResourceHelpers::isHiddenMarker(ref.mRefID))
                 continue;
 
-            int type = store.findStatic(ref.mRefID);
             std::string model = getModel(type, ref.mRefID, store);
             if (model.empty()) continue;
             model = "meshes/" + model;
@@ -537,12 +587,12 @@ namespace MWRender
                 if (cnode->getNumChildrenRequiringUpdateTraversal() > 0 || SceneUtil::hasUserDescription(cnode, Constants::NightDayLabel) || SceneUtil::hasUserDescription(cnode, Constants::HerbalismLabel))
                     continue;
                 else
-                    refnumSet->mRefnums.insert(pair.first);
+                    refnumSet->mRefnums.insert(ref.mRefNum);
             }
 
             {
                 std::lock_guard<std::mutex> lock(mRefTrackerMutex);
-                if (getRefTracker().mDisabled.count(pair.first))
+                if (getRefTracker().mDisabled.count(ref.mRefNum))
                     continue;
             }
 
@@ -550,10 +600,16 @@ namespace MWRender
             if (radius2 < dSqr*minSize*minSize && !activeGrid)
             {
                 std::lock_guard<std::mutex> lock(mSizeCacheMutex);
-                mSizeCache[pair.first] = radius2;
+                mSizeCache[ref.mRefNum] = radius2;
                 continue;
             }
 
+            // Substitute a decimated variant of the template for distant objects; the closer
+            // an object gets to its 'min size' culling distance, the fewer vertices it keeps.
+            // The active grid always uses full detail.
+            if (!activeGrid)
+                cnode = getSimplifiedTemplate(model, cnode, getLodBand(radius2, dSqr));
+
             auto emplaced = nodes.emplace(cnode, InstanceList());
             if (emplaced.second)
             {
@@ -574,6 +630,9 @@ namespace MWRender
         copyop.mCopyMask = copyMask;
         for (const auto& pair : nodes)
         {
+            if (abort && *abort)
+                return nullptr;
+
             const osg::Node* cnode = pair.first;
 
             const AnalyzeVisitor::Result& analyzeResult = pair.second.mAnalyzeResult;
@@ -582,7 +641,7 @@ namespace MWRender
             float mergeBenefit = analyzeVisitor.getMergeBenefit(analyzeResult) * mMergeFactor;
             bool merge = mergeBenefit > mergeCost;
 
-            float minSizeMerged = mMinSize;
+            float minSizeMerged = mMinSize / mHorizonFactor;
             float factor2 = mergeBenefit > 0 ? std::min(1.f, mergeCost * mMinSizeCostMultiplier / mergeBenefit) : 1;
             float minSizeMergeFactor2 = (1-factor2) * mMinSizeMergeFactor + factor2;
             if (minSizeMergeFactor2 > 0)
@@ -591,7 +650,7 @@ namespace MWRender
             unsigned int numinstances = 0;
             for (auto cref : pair.second.mInstances)
             {
-                const ESM::CellRef& ref = *cref;
+                const CellRefCache::Ref& ref = *cref;
                 osg::Vec3f pos = ref.mPos.asVec3();
 
                 if (!activeGrid && minSizeMerged != minSize && cnode->getBound().radius2() * cref->mScale*cref->mScale < (viewPoint-pos).length2()*minSizeMerged*minSizeMerged)
@@ -648,6 +707,9 @@ namespace MWRender
             }
         }
 
+        const double instanceTime = stageTimer.time_s();
+        stageTimer.setStartTick();
+
         if (mergeGroup->getNumChildren())
         {
             SceneUtil::Optimizer optimizer;
@@ -657,9 +719,12 @@ namespace MWRender
                 optimizer.setMergeAlphaBlending(true);
             }
             optimizer.setIsOperationPermissibleForObjectCallback(new CanOptimizeCallback);
+            optimizer.setAbortFlag(abort);
             unsigned int options = SceneUtil::Optimizer::FLATTEN_STATIC_TRANSFORMS|SceneUtil::Optimizer::REMOVE_REDUNDANT_NODES|SceneUtil::Optimizer::MERGE_GEOMETRY;
             mSceneManager->shareState(mergeGroup);
             optimizer.optimize(mergeGroup, options);
+            if (optimizer.isAborted())
+                return nullptr;
 
             group->addChild(mergeGroup);
 
@@ -675,6 +740,14 @@ namespace MWRender
             }
         }
 
+        const double mergeTime = stageTimer.time_s();
+        {
+            std::lock_guard<std::mutex> lock(mStageTimesMutex);
+            mCollectTime += collectTime;
+            mInstanceTime += instanceTime;
+            mMergeTime += mergeTime;
+        }
+
         auto ico = mSceneManager->getIncrementalCompileOperation();
         if (!stateToCompile.empty() && ico)
         {
@@ -832,6 +905,11 @@ namespace MWRender
     void ObjectPaging::reportStats(unsigned int frameNumber, osg::Stats *stats) const
     {
         stats->setAttribute(frameNumber, "Object Chunk", mCache->getCacheSize());
+
+        std::lock_guard<std::mutex> lock(mStageTimesMutex);
+        stats->setAttribute(frameNumber, "Object Chunk Collect Time", mCollectTime);
+        stats->setAttribute(frameNumber, "Object Chunk Instance Time", mInstanceTime);
+        stats->setAttribute(frameNumber, "Object Chunk Merge Time", mMergeTime);
     }
 
 }
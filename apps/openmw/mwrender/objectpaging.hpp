@@ -5,6 +5,7 @@
 #include <components/resource/resourcemanager.hpp>
 #include <components/esm/loadcell.hpp>
 
+#include <memory>
 #include <mutex>
 
 namespace Resource
@@ -18,18 +19,20 @@ namespace MWWorld
 
 namespace MWRender
 {
+    class CellRefCache;
 
     typedef std::tuple<osg::Vec2f, float, bool> ChunkId; // Center, Size, ActiveGrid
 
     class ObjectPaging : public Resource::GenericResourceManager<ChunkId>, public Terrain::QuadTreeWorld::ChunkManager
     {
     public:
-        ObjectPaging(Resource::SceneManager* sceneManager);
+        ObjectPaging(Resource::SceneManager* sceneManager, std::shared_ptr<CellRefCache> refCache);
         ~ObjectPaging() = default;
 
-        osg::ref_ptr<osg::Node> getChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags, bool activeGrid, const osg::Vec3f& viewPoint, bool compile) override;
+        osg::ref_ptr<osg::Node> getChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags, bool activeGrid, const osg::Vec3f& viewPoint, bool compile, const std::atomic<bool>* abort) override;
 
-        osg::ref_ptr<osg::Node> createChunk(float size, const osg::Vec2f& center, bool activeGrid, const osg::Vec3f& viewPoint, bool compile);
+        /// @return nullptr if the abort flag became true before the chunk was complete.
+        osg::ref_ptr<osg::Node> createChunk(float size, const osg::Vec2f& center, bool activeGrid, const osg::Vec3f& viewPoint, bool compile, const std::atomic<bool>* abort);
 
         unsigned int getNodeMask() override;
 
@@ -51,12 +54,15 @@ namespace MWRender
 
     private:
         Resource::SceneManager* mSceneManager;
+        std::shared_ptr<CellRefCache> mRefCache;
         bool mActiveGrid;
         bool mDebugBatches;
         float mMergeFactor;
         float mMinSize;
         float mMinSizeMergeFactor;
         float mMinSizeCostMultiplier;
+        float mMeshLodFactor;
+        float mHorizonFactor;
 
         std::mutex mRefTrackerMutex;
         struct RefTracker
@@ -75,6 +81,27 @@ namespace MWRender
         std::mutex mSizeCacheMutex;
         typedef std::map<ESM::RefNum, float> SizeCache;
         SizeCache mSizeCache;
+
+        /// Pick the level of detail band for an object of the given (squared) bound radius
+        /// at the given (squared) distance to the view point. Band 0 is full detail,
+        /// higher bands use progressively decimated geometry.
+        int getLodBand(float radius2, float dist2) const;
+
+        /// Get a decimated variant of the given loaded template for the given band,
+        /// building and caching it on first use. Returns the template unchanged for band 0.
+        osg::ref_ptr<const osg::Node> getSimplifiedTemplate(const std::string& model, osg::ref_ptr<const osg::Node> node, int lodBand);
+
+        std::mutex mLodCacheMutex;
+        typedef std::map<std::pair<std::string, int>, osg::ref_ptr<const osg::Node>> LodCache;
+        LodCache mLodCache;
+
+        // Cumulative time spent in each stage of createChunk, to help tune the
+        // merge factor settings for a given content load. Chunks are created
+        // concurrently by the preload threads, hence the lock.
+        mutable std::mutex mStageTimesMutex;
+        double mCollectTime = 0.0;
+        double mInstanceTime = 0.0;
+        double mMergeTime = 0.0;
     };
 
     class RefnumMarker : public osg::Object
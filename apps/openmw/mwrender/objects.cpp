@@ -1,8 +1,14 @@
 #include "objects.hpp"
 
+#include <cmath>
+#include <mutex>
+
 #include <osg/Group>
+#include <osg/OcclusionQueryNode>
 #include <osg/UserDataContainer>
 
+#include <components/misc/constants.hpp>
+#include <components/settings/settings.hpp>
 #include <components/sceneutil/positionattitudetransform.hpp>
 #include <components/sceneutil/unrefqueue.hpp>
 
@@ -15,6 +21,46 @@
 #include "vismask.hpp"
 
 
+namespace
+{
+    // Quarter-cell buckets keep each batch small enough to reject individually while still
+    // dividing a dense cell's statics into a two-level hierarchy for the cull traversal.
+    constexpr float sStaticBatchSize = Constants::CellSizeInUnits / 4.f;
+
+    // A batch whose bounding box covers at most this many pixels counts as occluded.
+    constexpr unsigned int sOcclusionVisibilityThreshold = 50;
+
+    // Occlusion query node that counts as visible for one frame after the camera viewpoint
+    // jumps: the pending query result stems from an unrelated viewpoint and must not hide
+    // geometry that may well be on screen now. A fresh query is still issued either way.
+    class StaticOcclusionQueryNode : public osg::OcclusionQueryNode
+    {
+    public:
+        bool getPassed(const osg::Camera* camera, osg::NodeVisitor& nv) override
+        {
+            // moving half a cell between two frames is a teleport, not movement
+            constexpr float cutDistance = Constants::CellSizeInUnits / 2.f;
+            const osg::Vec3f viewPoint = nv.getViewPoint();
+
+            bool cut;
+            {
+                std::lock_guard<std::mutex> lock(mViewPointMutex);
+                osg::Vec3f& last = mLastViewPoint[camera];
+                cut = (viewPoint - last).length2() > cutDistance * cutDistance;
+                last = viewPoint;
+            }
+
+            const bool passed = osg::OcclusionQueryNode::getPassed(camera, nv);
+            return passed || cut;
+        }
+
+    private:
+        // last frame's viewpoint per camera; reflection/refraction cameras query too
+        std::map<const osg::Camera*, osg::Vec3f> mLastViewPoint;
+        std::mutex mViewPointMutex;
+    };
+}
+
 namespace MWRender
 {
 
@@ -22,6 +68,7 @@ Objects::Objects(Resource::ResourceSystem* resourceSystem, osg::ref_ptr<osg::Gro
     : mRootNode(rootNode)
     , mResourceSystem(resourceSystem)
     , mUnrefQueue(unrefQueue)
+    , mOcclusionQueries(Settings::Manager::getBool("occlusion queries", "Camera"))
 {
 }
 
@@ -32,9 +79,38 @@ Objects::~Objects()
     for (CellMap::iterator iter = mCellSceneNodes.begin(); iter != mCellSceneNodes.end(); ++iter)
         iter->second->getParent(0)->removeChild(iter->second);
     mCellSceneNodes.clear();
+    mCellStaticBatches.clear();
 }
 
-void Objects::insertBegin(const MWWorld::Ptr& ptr)
+osg::Group* Objects::getOrCreateStaticBatch(const MWWorld::CellStore* cell, osg::Group* cellnode, const osg::Vec3f& position)
+{
+    std::pair<int, int> bucket(static_cast<int>(std::floor(position.x() / sStaticBatchSize)),
+                               static_cast<int>(std::floor(position.y() / sStaticBatchSize)));
+
+    osg::ref_ptr<osg::Group>& batch = mCellStaticBatches[cell][bucket];
+    if (!batch)
+    {
+        if (mOcclusionQueries)
+        {
+            // The batch bounding box is tested against the depth buffer of the previous
+            // frame; while the query reports it fully hidden, its contents are skipped.
+            // Results are tracked per camera, and a batch counts as visible until its
+            // first query completes, so camera cuts degrade to drawing everything once.
+            osg::ref_ptr<osg::OcclusionQueryNode> query (new StaticOcclusionQueryNode);
+            query->setVisibilityThreshold(sOcclusionVisibilityThreshold);
+            query->setQueryFrameCount(1);
+            query->setDebugDisplay(false);
+            batch = query;
+        }
+        else
+            batch = new osg::Group;
+        batch->setName("Cell Static Batch");
+        cellnode->addChild(batch);
+    }
+    return batch.get();
+}
+
+void Objects::insertBegin(const MWWorld::Ptr& ptr, bool batchStatic)
 {
     assert(mObjects.find(ptr) == mObjects.end());
 
@@ -51,13 +127,17 @@ void Objects::insertBegin(const MWWorld::Ptr& ptr)
     else
         cellnode = found->second;
 
+    const float *f = ptr.getRefData().getPosition().pos;
+
+    osg::Group* attachTo = cellnode;
+    if (batchStatic)
+        attachTo = getOrCreateStaticBatch(ptr.getCell(), cellnode, osg::Vec3f(f[0], f[1], f[2]));
+
     osg::ref_ptr<SceneUtil::PositionAttitudeTransform> insert (new SceneUtil::PositionAttitudeTransform);
-    cellnode->addChild(insert);
+    attachTo->addChild(insert);
 
     insert->getOrCreateUserDataContainer()->addUserObject(new PtrHolder(ptr));
 
-    const float *f = ptr.getRefData().getPosition().pos;
-
     insert->setPosition(osg::Vec3(f[0], f[1], f[2]));
 
     const float scale = ptr.getCellRef().getScale();
@@ -70,7 +150,7 @@ void Objects::insertBegin(const MWWorld::Ptr& ptr)
 
 void Objects::insertModel(const MWWorld::Ptr &ptr, const std::string &mesh, bool animated, bool allowLight)
 {
-    insertBegin(ptr);
+    insertBegin(ptr, true);
     ptr.getRefData().getBaseNode()->setNodeMask(Mask_Object);
 
     osg::ref_ptr<ObjectAnimation> anim (new ObjectAnimation(ptr, mesh, mResourceSystem, animated, allowLight));
@@ -80,7 +160,7 @@ void Objects::insertModel(const MWWorld::Ptr &ptr, const std::string &mesh, bool
 
 void Objects::insertCreature(const MWWorld::Ptr &ptr, const std::string &mesh, bool weaponsShields)
 {
-    insertBegin(ptr);
+    insertBegin(ptr, false);
     ptr.getRefData().getBaseNode()->setNodeMask(Mask_Actor);
 
     // CreatureAnimation
@@ -97,7 +177,7 @@ void Objects::insertCreature(const MWWorld::Ptr &ptr, const std::string &mesh, b
 
 void Objects::insertNPC(const MWWorld::Ptr &ptr)
 {
-    insertBegin(ptr);
+    insertBegin(ptr, false);
     ptr.getRefData().getBaseNode()->setNodeMask(Mask_Actor);
 
     osg::ref_ptr<NpcAnimation> anim (new NpcAnimation(ptr, osg::ref_ptr<osg::Group>(ptr.getRefData().getBaseNode()), mResourceSystem));
@@ -162,6 +242,8 @@ void Objects::removeCell(const MWWorld::CellStore* store)
             ++iter;
     }
 
+    mCellStaticBatches.erase(store);
+
     CellMap::iterator cell = mCellSceneNodes.find(store);
     if(cell != mCellSceneNodes.end())
     {
@@ -6,6 +6,7 @@
 
 #include <osg/ref_ptr>
 #include <osg/Object>
+#include <osg/Vec3f>
 
 #include "../mwworld/ptr.hpp"
 
@@ -60,6 +61,14 @@ class Objects{
 
     typedef std::map<const MWWorld::CellStore*, osg::ref_ptr<osg::Group> > CellMap;
     CellMap mCellSceneNodes;
+
+    // Spatial buckets for static objects, grouped under the cell node by quantized position.
+    // The intermediate groups let the cull traversal reject whole clusters of objects by a
+    // single bound test instead of visiting every object node in the cell. Actors and objects
+    // that move cells attach directly to the cell node and are not bucketed.
+    typedef std::map<std::pair<int, int>, osg::ref_ptr<osg::Group> > StaticBatchMap;
+    std::map<const MWWorld::CellStore*, StaticBatchMap> mCellStaticBatches;
+
     PtrAnimationMap mObjects;
 
     osg::ref_ptr<osg::Group> mRootNode;
@@ -68,7 +77,13 @@ class Objects{
 
     osg::ref_ptr<SceneUtil::UnrefQueue> mUnrefQueue;
 
-    void insertBegin(const MWWorld::Ptr& ptr);
+    // When enabled, static batches become occlusion query nodes and are skipped while
+    // their bounding box is fully hidden behind other geometry.
+    bool mOcclusionQueries;
+
+    void insertBegin(const MWWorld::Ptr& ptr, bool batchStatic);
+
+    osg::Group* getOrCreateStaticBatch(const MWWorld::CellStore* cell, osg::Group* cellnode, const osg::Vec3f& position);
 
 public:
     Objects(Resource::ResourceSystem* resourceSystem, osg::ref_ptr<osg::Group> rootNode, SceneUtil::UnrefQueue* unrefQueue);
@@ -5,6 +5,7 @@
 #include <osg/Callback>
 #include <osg/Texture2D>
 #include <osg/FrameBufferObject>
+#include <osg/GLExtensions>
 
 #include <osgViewer/Viewer>
 
@@ -15,6 +16,10 @@
 #include "vismask.hpp"
 #include "renderingmanager.hpp"
 
+#ifndef GL_TIME_ELAPSED
+#define GL_TIME_ELAPSED 0x88BF
+#endif
+
 namespace
 {
     osg::ref_ptr<osg::Geometry> createFullScreenTri()
@@ -78,6 +83,85 @@ namespace
         unsigned int mLastFrameNumber;
     };
 
+    // Measures the GPU time spent on the post-process pass with timer queries, double buffered so
+    // results are read back a frame late without stalling the pipeline. Reported to the stats HUD.
+    class GpuTimerQueries : public osg::Referenced
+    {
+    public:
+        GpuTimerQueries(osg::Stats* stats)
+            : mStats(stats)
+        {
+        }
+
+        void begin(osg::RenderInfo& renderInfo)
+        {
+            if (!mStats || !mStats->collectStats("resource"))
+                return;
+
+            osg::GLExtensions* ext = renderInfo.getState()->get<osg::GLExtensions>();
+            if (!ext->isTimerQuerySupported && !ext->isARBTimerQuerySupported)
+                return;
+
+            if (mQueries[0] == 0)
+                ext->glGenQueries(2, mQueries);
+            else
+            {
+                // Read the result of the query issued with this object two frames ago. It will
+                // almost always be available by now; if not, drop it rather than sync.
+                GLuint available = 0;
+                ext->glGetQueryObjectuiv(mQueries[mCurrent], GL_QUERY_RESULT_AVAILABLE, &available);
+                if (available)
+                {
+                    GLuint64 elapsed = 0;
+                    ext->glGetQueryObjectui64v(mQueries[mCurrent], GL_QUERY_RESULT, &elapsed);
+                    mStats->setAttribute(renderInfo.getState()->getFrameStamp()->getFrameNumber(), "Post Pass us", elapsed / 1000.0);
+                }
+            }
+
+            ext->glBeginQuery(GL_TIME_ELAPSED, mQueries[mCurrent]);
+            mActive = true;
+        }
+
+        void end(osg::RenderInfo& renderInfo)
+        {
+            if (!mActive)
+                return;
+
+            osg::GLExtensions* ext = renderInfo.getState()->get<osg::GLExtensions>();
+            ext->glEndQuery(GL_TIME_ELAPSED);
+            mCurrent = (mCurrent + 1) % 2;
+            mActive = false;
+        }
+
+    private:
+        osg::ref_ptr<osg::Stats> mStats;
+        GLuint mQueries[2] = { 0, 0 };
+        int mCurrent = 0;
+        bool mActive = false;
+    };
+
+    class GpuTimerBeginCallback : public osg::Camera::DrawCallback
+    {
+    public:
+        GpuTimerBeginCallback(GpuTimerQueries* timer) : mTimer(timer) {}
+
+        void operator()(osg::RenderInfo& renderInfo) const override { mTimer->begin(renderInfo); }
+
+    private:
+        osg::ref_ptr<GpuTimerQueries> mTimer;
+    };
+
+    class GpuTimerEndCallback : public osg::Camera::DrawCallback
+    {
+    public:
+        GpuTimerEndCallback(GpuTimerQueries* timer) : mTimer(timer) {}
+
+        void operator()(osg::RenderInfo& renderInfo) const override { mTimer->end(renderInfo); }
+
+    private:
+        osg::ref_ptr<GpuTimerQueries> mTimer;
+    };
+
     struct ResizedCallback : osg::GraphicsContext::ResizedCallback
     {
         ResizedCallback(MWRender::PostProcessor* postProcessor)
@@ -255,6 +339,11 @@ namespace MWRender
         mHUDCamera->addChild(createFullScreenTri());
         mHUDCamera->setNodeMask(Mask_RenderToTexture);
 
+        // Time the pass on the GPU so the cost of the chain shows up in the stats HUD (F4)
+        osg::ref_ptr<GpuTimerQueries> timer = new GpuTimerQueries(mViewer->getViewerStats());
+        mHUDCamera->setInitialDrawCallback(new GpuTimerBeginCallback(timer));
+        mHUDCamera->setFinalDrawCallback(new GpuTimerEndCallback(timer));
+
         auto* stateset = mHUDCamera->getOrCreateStateSet();
         stateset->setTextureAttributeAndModes(0, mSceneTex, osg::StateAttribute::ON);
         stateset->setAttributeAndModes(program, osg::StateAttribute::ON);
@@ -0,0 +1,137 @@
+#include "renderbintimers.hpp"
+
+#include <map>
+
+#include <osg/Camera>
+#include <osg/GLExtensions>
+#include <osg/Stats>
+#include <osgUtil/CullVisitor>
+#include <osgUtil/RenderStage>
+
+#include "renderbin.hpp"
+
+#ifndef GL_TIME_ELAPSED
+#define GL_TIME_ELAPSED 0x88BF
+#endif
+
+namespace
+{
+
+    const char* binStatName(int binNumber)
+    {
+        switch (binNumber)
+        {
+            case MWRender::RenderBin_Sky: return "Sky Bin us";
+            case MWRender::RenderBin_Water: return "Water Bin us";
+            case MWRender::RenderBin_DepthSorted: return "Transparent Bin us";
+            case MWRender::RenderBin_OcclusionQuery: return "Occlusion Bin us";
+            case MWRender::RenderBin_FirstPerson: return "FirstPerson Bin us";
+            case MWRender::RenderBin_SunGlare: return "SunGlare Bin us";
+        }
+        return nullptr;
+    }
+
+    // Brackets the draw of one render bin with a GPU timer query, double buffered so the result is
+    // read back a frame late without stalling the pipeline.
+    class BinTimer : public osgUtil::RenderBin::DrawCallback
+    {
+    public:
+        BinTimer(osg::Stats* stats, const char* statName)
+            : mStats(stats)
+            , mStatName(statName)
+            , mCurrent(0)
+        {
+            mQueries[0] = 0;
+            mQueries[1] = 0;
+        }
+
+        void drawImplementation(osgUtil::RenderBin* bin, osg::RenderInfo& renderInfo, osgUtil::RenderLeaf*& previous) override
+        {
+            osg::GLExtensions* ext = renderInfo.getState()->get<osg::GLExtensions>();
+            if (!mStats->collectStats("resource") || (!ext->isTimerQuerySupported && !ext->isARBTimerQuerySupported))
+            {
+                bin->drawImplementation(renderInfo, previous);
+                return;
+            }
+
+            if (mQueries[0] == 0)
+                ext->glGenQueries(2, mQueries);
+            else
+            {
+                // Read the result of the query issued two frames ago. It will almost always be
+                // available by now; if not, drop it rather than sync.
+                GLuint available = 0;
+                ext->glGetQueryObjectuiv(mQueries[mCurrent], GL_QUERY_RESULT_AVAILABLE, &available);
+                if (available)
+                {
+                    GLuint64 elapsed = 0;
+                    ext->glGetQueryObjectui64v(mQueries[mCurrent], GL_QUERY_RESULT, &elapsed);
+                    mStats->setAttribute(renderInfo.getState()->getFrameStamp()->getFrameNumber(), mStatName, elapsed / 1000.0);
+                }
+            }
+
+            ext->glBeginQuery(GL_TIME_ELAPSED, mQueries[mCurrent]);
+
+            bin->drawImplementation(renderInfo, previous);
+
+            ext->glEndQuery(GL_TIME_ELAPSED);
+            mCurrent = (mCurrent + 1) % 2;
+        }
+
+    private:
+        osg::ref_ptr<osg::Stats> mStats;
+        const char* mStatName;
+        unsigned int mQueries[2];
+        int mCurrent;
+    };
+
+    // Once the cull traversal has built the render graph for the main camera, wraps each render
+    // bin of the resulting stage in a timer scope. The bins are pooled by the cull visitor, so the
+    // callbacks have to be (re-)assigned every frame.
+    class AttachBinTimersCallback : public osg::NodeCallback
+    {
+    public:
+        AttachBinTimersCallback(osg::Camera* camera, osg::Stats* stats)
+            : mCamera(camera)
+            , mStats(stats)
+        {
+        }
+
+        void operator()(osg::Node* node, osg::NodeVisitor* nv) override
+        {
+            traverse(node, nv);
+
+            osgUtil::CullVisitor* cv = static_cast<osgUtil::CullVisitor*>(nv);
+            if (cv->getCurrentCamera() != mCamera)
+                return; // a render-to-texture pass (shadows, water, ...), not the main camera
+
+            for (const auto& [binNumber, bin] : cv->getCurrentRenderStage()->getRenderBinList())
+            {
+                const char* statName = binStatName(binNumber);
+                if (!statName)
+                    continue;
+
+                osg::ref_ptr<BinTimer>& timer = mTimers[binNumber];
+                if (!timer)
+                    timer = new BinTimer(mStats, statName);
+                bin->setDrawCallback(timer);
+            }
+        }
+
+    private:
+        osg::Camera* mCamera;
+        osg::ref_ptr<osg::Stats> mStats;
+        std::map<int, osg::ref_ptr<BinTimer>> mTimers;
+    };
+
+}
+
+namespace MWRender
+{
+
+    void attachRenderBinTimers(osg::Node* sceneRoot, osg::Camera* camera, osg::Stats* stats)
+    {
+        sceneRoot->addCullCallback(new AttachBinTimersCallback(camera, stats));
+    }
+
+}
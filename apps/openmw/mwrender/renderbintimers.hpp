@@ -0,0 +1,30 @@
+#ifndef OPENMW_MWRENDER_RENDERBINTIMERS_H
+#define OPENMW_MWRENDER_RENDERBINTIMERS_H
+
+#include <osg/ref_ptr>
+
+namespace osg
+{
+    class Camera;
+    class Node;
+    class Stats;
+}
+
+namespace MWRender
+{
+
+    /// Measures the GPU time spent drawing each render bin of the main camera (see renderbin.hpp)
+    /// and reports the results through the viewer stats, so they show up on the F4 stats panel and
+    /// in the OPENMW_OSG_STATS_FILE dump. Only active while the "resource" stats are collected.
+    /// @note The opaque geometry in RenderBin_Default is drawn directly by the render stage rather
+    /// than a child bin, so it can not be bracketed by a timer scope; its cost is the remainder of
+    /// the frame's GPU time after subtracting the reported bins.
+    /// @param sceneRoot the node to install the timer attachment callback on. Must be culled by the
+    /// main camera exactly once per frame.
+    /// @param camera the main camera. Render bins culled for other cameras (shadow maps, water
+    /// reflection and other render-to-texture passes) are left untouched.
+    void attachRenderBinTimers(osg::Node* sceneRoot, osg::Camera* camera, osg::Stats* stats);
+
+}
+
+#endif
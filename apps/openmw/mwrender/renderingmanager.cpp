@@ -40,6 +40,7 @@
 #include <components/sceneutil/unrefqueue.hpp>
 #include <components/sceneutil/writescene.hpp>
 #include <components/sceneutil/shadow.hpp>
+#include <components/sceneutil/shadowsbin.hpp>
 
 #include <components/terrain/terraingrid.hpp>
 #include <components/terrain/quadtreeworld.hpp>
@@ -67,13 +68,54 @@
 #include "actorspaths.hpp"
 #include "recastmesh.hpp"
 #include "fogmanager.hpp"
+#include "cellrefcache.hpp"
 #include "objectpaging.hpp"
 #include "screenshotmanager.hpp"
 #include "groundcover.hpp"
 #include "postprocessor.hpp"
+#include "renderbintimers.hpp"
 
 namespace MWRender
 {
+    /// Reports scene graph objects with DYNAMIC data variance. OSG's threaded viewer modes
+    /// overlap the draw traversal of the previous frame with the next update and serialize
+    /// drawing whenever a DYNAMIC object is encountered. Per-frame state is expected to go
+    /// through the double buffering of SceneUtil::StateSetUpdater instead, so anything this
+    /// visitor finds is a leftover serialization point worth converting.
+    class ReportDynamicStateVisitor : public osg::NodeVisitor
+    {
+    public:
+        ReportDynamicStateVisitor(std::set<std::string>& reported)
+            : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+            , mReported(reported)
+        {
+        }
+
+        void apply(osg::Node& node) override
+        {
+            if (node.getDataVariance() == osg::Object::DYNAMIC)
+                report(node);
+            else if (const osg::StateSet* stateset = node.getStateSet())
+            {
+                if (stateset->getDataVariance() == osg::Object::DYNAMIC)
+                    report(node);
+            }
+            traverse(node);
+        }
+
+    private:
+        void report(const osg::Node& node)
+        {
+            std::string description = node.className();
+            if (!node.getName().empty())
+                description += " \"" + node.getName() + "\"";
+            if (mReported.insert(description).second)
+                Log(Debug::Warning) << "Dynamic state serializes threaded draw: " << description;
+        }
+
+        std::set<std::string>& mReported;
+    };
+
     class SharedUniformStateUpdater : public SceneUtil::StateSetUpdater
     {
     public:
@@ -358,6 +400,10 @@ namespace MWRender
         {
             mViewer->setIncrementalCompileOperation(new osgUtil::IncrementalCompileOperation);
             mViewer->getIncrementalCompileOperation()->setTargetFrameRate(Settings::Manager::getFloat("target framerate", "Cells"));
+            mViewer->getIncrementalCompileOperation()->setMinimumTimeAvailableForGLCompileAndDeletePerFrame(
+                Settings::Manager::getFloat("preload compile time budget", "Cells"));
+            mViewer->getIncrementalCompileOperation()->setMaximumNumOfObjectsToCompilePerFrame(
+                Settings::Manager::getInt("preload compile objects per frame", "Cells"));
         }
 
         mResourceSystem->getSceneManager()->setIncrementalCompileOperation(mViewer->getIncrementalCompileOperation());
@@ -375,6 +421,8 @@ namespace MWRender
 
         bool groundcover = Settings::Manager::getBool("enabled", "Groundcover");
         bool distantTerrain = Settings::Manager::getBool("distant terrain", "Terrain");
+        // Object paging and groundcover share the cached per-cell reference tables
+        std::shared_ptr<CellRefCache> cellRefCache = std::make_shared<CellRefCache>();
         if (distantTerrain || groundcover)
         {
             const int compMapResolution = Settings::Manager::getInt("composite map resolution", "Terrain");
@@ -389,7 +437,7 @@ namespace MWRender
                 compMapResolution, compMapLevel, lodFactor, vertexLodMod, maxCompGeometrySize));
             if (Settings::Manager::getBool("object paging", "Terrain"))
             {
-                mObjectPaging.reset(new ObjectPaging(mResourceSystem->getSceneManager()));
+                mObjectPaging.reset(new ObjectPaging(mResourceSystem->getSceneManager(), cellRefCache));
                 static_cast<Terrain::QuadTreeWorld*>(mTerrain.get())->addChunkManager(mObjectPaging.get());
                 mResourceSystem->addResourceManager(mObjectPaging.get());
             }
@@ -410,7 +458,7 @@ namespace MWRender
             mGroundcoverUpdater = new GroundcoverUpdater;
             composite->addController(mGroundcoverUpdater);
 
-            mGroundcover.reset(new Groundcover(mResourceSystem->getSceneManager(), density));
+            mGroundcover.reset(new Groundcover(mResourceSystem->getSceneManager(), density, cellRefCache));
             static_cast<Terrain::QuadTreeWorld*>(mTerrain.get())->addChunkManager(mGroundcover.get());
             mResourceSystem->addResourceManager(mGroundcover.get());
 
@@ -425,6 +473,8 @@ namespace MWRender
         mSharedUniformStateUpdater = new SharedUniformStateUpdater;
         rootNode->addUpdateCallback(mSharedUniformStateUpdater);
 
+        attachRenderBinTimers(sceneRoot, mViewer->getCamera(), mViewer->getViewerStats());
+
         mPostProcessor = new PostProcessor(*this, viewer, mRootNode);
         resourceSystem->getSceneManager()->setDepthFormat(mPostProcessor->getDepthFormat());
 
@@ -780,6 +830,18 @@ namespace MWRender
     {
         reportStats();
 
+        static const bool validateDynamicState = Settings::Manager::getBool("validate dynamic state", "Video");
+        if (validateDynamicState)
+        {
+            mDynamicStateCheckTimer += dt;
+            if (mDynamicStateCheckTimer >= 5.f)
+            {
+                mDynamicStateCheckTimer = 0.f;
+                ReportDynamicStateVisitor visitor(mReportedDynamicState);
+                mRootNode->accept(visitor);
+            }
+        }
+
         mUnrefQueue->flush(mWorkQueue.get());
 
         float rainIntensity = mSky->getPrecipitationAlpha();
@@ -1203,8 +1265,14 @@ namespace MWRender
         if (stats->collectStats("resource"))
         {
             stats->setAttribute(frameNumber, "UnrefQueue", mUnrefQueue->getNumItems());
+            stats->setAttribute(frameNumber, "Unref Released", mUnrefQueue->getTotalReleased());
+
+            static_cast<SceneUtil::LightManager*>(getLightRoot())->reportStats(frameNumber, stats);
 
             mTerrain->reportStats(frameNumber, stats);
+
+            stats->setAttribute(frameNumber, "Shadow Caster", static_cast<double>(SceneUtil::ShadowsBin::takeCastingLeaves()));
+            stats->setAttribute(frameNumber, "Shadow Pruned", static_cast<double>(SceneUtil::ShadowsBin::takePrunedLeaves()));
         }
     }
 
@@ -16,6 +16,8 @@
 
 #include <deque>
 #include <memory>
+#include <set>
+#include <string>
 
 namespace osg
 {
@@ -306,6 +308,10 @@ namespace MWRender
         float mFieldOfView;
         float mFirstPersonFieldOfView;
 
+        // "validate dynamic state" debug sweep, see update()
+        float mDynamicStateCheckTimer = 0.f;
+        std::set<std::string> mReportedDynamicState;
+
         void operator = (const RenderingManager&);
         RenderingManager(const RenderingManager&);
     };
@@ -122,27 +122,39 @@ RippleSimulation::~RippleSimulation()
 void RippleSimulation::update(float dt)
 {
     const MWBase::World* world = MWBase::Environment::get().getWorld();
+    const MWWorld::ConstPtr player = world->getPlayerPtr();
+
+    // Particles the emitters are allowed to add this frame. The ParticleSystemUpdater expires old
+    // particles during the update traversal, so counting once per frame is accurate enough.
+    int particleBudget = 500 - (mParticleSystem->numParticles() - mParticleSystem->numDeadParticles());
+
     for (Emitter& emitter : mEmitters)
     {
         MWWorld::ConstPtr& ptr = emitter.mPtr;
-        if (ptr == MWBase::Environment::get().getWorld ()->getPlayerPtr())
+        if (ptr == player)
         {
             // fetch a new ptr (to handle cell change etc)
             // for non-player actors this is done in updateObjectCell
-            ptr = MWBase::Environment::get().getWorld ()->getPlayerPtr();
+            ptr = player;
         }
 
         osg::Vec3f currentPos (ptr.getRefData().getPosition().asVec3());
 
+        // Check the movement threshold before the water tests: isSubmerged() and isWalkingOnWater()
+        // both look up the physics actor, and most emitters don't move far on any given frame.
+        if ((currentPos - emitter.mLastEmitPosition).length2() <= 10.f*10.f)
+            continue;
+
         bool shouldEmit = (world->isUnderwater(ptr.getCell(), currentPos) && !world->isSubmerged(ptr)) || world->isWalkingOnWater(ptr);
-        if (shouldEmit && (currentPos - emitter.mLastEmitPosition).length() > 10)
+        if (shouldEmit)
         {
             emitter.mLastEmitPosition = currentPos;
 
-            currentPos.z() = mParticleNode->getPosition().z();
-
-            if (mParticleSystem->numParticles()-mParticleSystem->numDeadParticles() > 500)
+            if (particleBudget <= 0)
                 continue; // TODO: remove the oldest particle to make room?
+            --particleBudget;
+
+            currentPos.z() = mParticleNode->getPosition().z();
 
             emitRipple(currentPos);
         }
@@ -102,8 +102,9 @@ namespace MWRender
                     ext->glBindFramebuffer(GL_FRAMEBUFFER_EXT, postProcessor->getFbo()->getHandle(renderInfo.getContextID()));
             }
 
+            // Scaling to the requested size is left to the caller: resampling the image on the
+            // CPU is expensive and would stall the draw thread here.
             mImage->readPixels(leftPadding, topPadding, width, height, GL_RGB, GL_UNSIGNED_BYTE);
-            mImage->scaleImage(mWidth, mHeight, 1);
         }
     private:
         int mWidth;
@@ -24,6 +24,9 @@ namespace MWRender
         ScreenshotManager(osgViewer::Viewer* viewer, osg::ref_ptr<osg::Group> rootNode, osg::ref_ptr<osg::Group> sceneRoot, Resource::ResourceSystem* resourceSystem, Water* water);
         ~ScreenshotManager();
 
+        /// Capture the framebuffer, cropped to the aspect ratio of the given size.
+        /// @note The image keeps the framebuffer's resolution; scaling it down to
+        ///       w x h is left to the caller.
         void screenshot(osg::Image* image, int w, int h);
         bool screenshot360(osg::Image* image);
 
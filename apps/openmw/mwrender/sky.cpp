@@ -1374,39 +1374,36 @@ public:
     {
         osg::Vec3 position = getCameraPosition();
         osg::Vec3 positionDifference = position - mPreviousCameraPosition;
+        mPreviousCameraPosition = position;
 
         osg::Matrix toWorld, toLocal;
 
         std::vector<osg::Matrix> worldMatrices = ps->getWorldMatrices();
- 
+
         if (!worldMatrices.empty())
         {
             toWorld = worldMatrices[0];
             toLocal.invert(toWorld);
         }
 
-        for (int i = 0; i < ps->numParticles(); ++i)
+        // This runs over every drop of precipitation on the main thread every frame,
+        // so the particle is read and written back exactly once.
+        const int numParticles = ps->numParticles();
+        for (int i = 0; i < numParticles; ++i)
         {
             osgParticle::Particle *p = ps->getParticle(i);
-            p->setPosition(toWorld.preMult(p->getPosition()));
-            p->setPosition(p->getPosition() - positionDifference);
+            osg::Vec3 pos = toWorld.preMult(p->getPosition()) - positionDifference;
 
             for (int j = 0; j < 3; ++j)  // wrap-around in all 3 dimensions
             {
-                osg::Vec3 pos = p->getPosition();
-
                 if (pos[j] < -mHalfWrapRange[j])
-                    pos[j] = mHalfWrapRange[j] + fmod(pos[j] - mHalfWrapRange[j],mWrapRange[j]);
+                    pos[j] = mHalfWrapRange[j] + std::fmod(pos[j] - mHalfWrapRange[j],mWrapRange[j]);
                 else if (pos[j] > mHalfWrapRange[j])
-                    pos[j] = fmod(pos[j] + mHalfWrapRange[j],mWrapRange[j]) - mHalfWrapRange[j];
-
-                p->setPosition(pos);
+                    pos[j] = std::fmod(pos[j] + mHalfWrapRange[j],mWrapRange[j]) - mHalfWrapRange[j];
             }
 
-            p->setPosition(toLocal.preMult(p->getPosition()));
+            p->setPosition(toLocal.preMult(pos));
         }
-
-        mPreviousCameraPosition = position;
     }
 
 protected:
@@ -332,6 +332,7 @@ class Reflection : public SceneUtil::RTTNode
 public:
     Reflection(uint32_t rttSize, bool isInterior)
         : RTTNode(rttSize, rttSize, 0, false)
+        , mAdaptiveUpdates(Settings::Manager::getBool("adaptive reflection updates", "Water"))
     {
         setInterior(isInterior);
         mClipCullNode = new ClipCullNode;
@@ -362,6 +363,29 @@ public:
         camera->setCullMask(mNodeMask);
     }
 
+    bool shouldUpdate(osgUtil::CullVisitor* cv) override
+    {
+        if (!mAdaptiveUpdates)
+            return true;
+
+        // When the camera has barely moved since the reflection was last rendered, refreshing it every
+        // other frame is not noticeable as the water shader distorts the reflection anyway. Any significant
+        // movement, including teleports, exceeds the thresholds and goes back to a refresh every frame.
+        constexpr double maxEyeMovement = 10.0; // units moved since the last update
+        constexpr double minLookDot = 0.9998; // cosine of the view direction change, ~1 degree
+        const osg::Vec3d eyePoint = cv->getEyePoint();
+        const osg::Vec3d lookVector = cv->getLookVectorLocal();
+        const bool cameraIsSlow = (eyePoint - mLastUpdateEyePoint).length2() < maxEyeMovement * maxEyeMovement
+                && lookVector * mLastUpdateLookVector >= minLookDot;
+
+        if (cameraIsSlow && cv->getTraversalNumber() % 2 != 0)
+            return false;
+
+        mLastUpdateEyePoint = eyePoint;
+        mLastUpdateLookVector = lookVector;
+        return true;
+    }
+
     void setInterior(bool isInterior)
     {
         int reflectionDetail = Settings::Manager::getInt("reflection detail", "Water");
@@ -394,6 +418,9 @@ private:
     osg::ref_ptr<osg::Node> mScene;
     osg::Node::NodeMask mNodeMask;
     osg::Matrix mViewMatrix{ osg::Matrix::identity() };
+    bool mAdaptiveUpdates;
+    osg::Vec3d mLastUpdateEyePoint;
+    osg::Vec3d mLastUpdateLookVector;
 };
 
 /// DepthClampCallback enables GL_DEPTH_CLAMP for the current draw, if supported.
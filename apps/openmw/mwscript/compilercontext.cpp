@@ -30,6 +30,11 @@ namespace MWScript
         return MWBase::Environment::get().getWorld()->getGlobalVariableType (name);
     }
 
+    int CompilerContext::getGlobalIndex (const std::string& name) const
+    {
+        return MWBase::Environment::get().getWorld()->getGlobalIndex (name);
+    }
+
     std::pair<char, bool> CompilerContext::getMemberType (const std::string& name,
         const std::string& id) const
     {
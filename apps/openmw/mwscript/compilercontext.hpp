@@ -30,6 +30,10 @@ namespace MWScript
             /// 'l: long, 's': short, 'f': float, ' ': does not exist.
             char getGlobalType (const std::string& name) const override;
 
+            int getGlobalIndex (const std::string& name) const override;
+            ///< Return the index of the global variable \a name or -1, if there is no such
+            /// variable.
+
             std::pair<char, bool> getMemberType (const std::string& name,
                 const std::string& id) const override;
             ///< Return type of member variable \a name in script \a id or in script of reference of
@@ -137,7 +137,7 @@ namespace MWScript
 
     void GlobalScripts::addScript (const std::string& name, const MWWorld::Ptr& target)
     {
-        const auto iter = mScripts.find (::Misc::StringUtils::lowerCase (name));
+        const auto iter = mScripts.find (name);
 
         if (iter==mScripts.end())
         {
@@ -165,7 +165,7 @@ namespace MWScript
 
     void GlobalScripts::removeScript (const std::string& name)
     {
-        const auto iter = mScripts.find (::Misc::StringUtils::lowerCase (name));
+        const auto iter = mScripts.find (name);
 
         if (iter!=mScripts.end())
             iter->second->mRunning = false;
@@ -173,7 +173,7 @@ namespace MWScript
 
     bool GlobalScripts::isRunning (const std::string& name) const
     {
-        const auto iter = mScripts.find (::Misc::StringUtils::lowerCase (name));
+        const auto iter = mScripts.find (name);
 
         if (iter==mScripts.end())
             return false;
@@ -308,8 +308,7 @@ namespace MWScript
 
     Locals& GlobalScripts::getLocals (const std::string& name)
     {
-        std::string name2 = ::Misc::StringUtils::lowerCase (name);
-        auto iter = mScripts.find (name2);
+        auto iter = mScripts.find (name);
 
         if (iter==mScripts.end())
         {
@@ -318,7 +317,7 @@ namespace MWScript
             auto desc = std::make_shared<GlobalScriptDesc>();
             desc->mLocals.configure (*script);
 
-            iter = mScripts.insert (std::make_pair (name2, desc)).first;
+            iter = mScripts.insert (std::make_pair (name, desc)).first;
         }
 
         return iter->second->mLocals;
@@ -326,8 +325,7 @@ namespace MWScript
 
     const Locals* GlobalScripts::getLocalsIfPresent (const std::string& name) const
     {
-        std::string name2 = ::Misc::StringUtils::lowerCase (name);
-        auto iter = mScripts.find (name2);
+        auto iter = mScripts.find (name);
         if (iter==mScripts.end())
             return nullptr;
         return &iter->second->mLocals;
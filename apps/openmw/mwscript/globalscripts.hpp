@@ -10,6 +10,8 @@
 
 #include <stdint.h>
 
+#include <components/misc/stringops.hpp>
+
 #include "locals.hpp"
 
 #include "../mwworld/ptr.hpp"
@@ -51,7 +53,7 @@ namespace MWScript
     class GlobalScripts
     {
             const MWWorld::ESMStore& mStore;
-            std::map<std::string, std::shared_ptr<GlobalScriptDesc> > mScripts;
+            std::map<std::string, std::shared_ptr<GlobalScriptDesc>, ::Misc::StringUtils::CiComp> mScripts;
 
         public:
 
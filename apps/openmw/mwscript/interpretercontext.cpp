@@ -199,6 +199,37 @@ namespace MWScript
     {
     }
 
+    int InterpreterContext::getGlobalShort (int index) const
+    {
+        return MWBase::Environment::get().getWorld()->getGlobalInt (index);
+    }
+
+    int InterpreterContext::getGlobalLong (int index) const
+    {
+        // a global long is internally a float.
+        return MWBase::Environment::get().getWorld()->getGlobalInt (index);
+    }
+
+    float InterpreterContext::getGlobalFloat (int index) const
+    {
+        return MWBase::Environment::get().getWorld()->getGlobalFloat (index);
+    }
+
+    void InterpreterContext::setGlobalShort (int index, int value)
+    {
+        MWBase::Environment::get().getWorld()->setGlobalInt (index, value);
+    }
+
+    void InterpreterContext::setGlobalLong (int index, int value)
+    {
+        MWBase::Environment::get().getWorld()->setGlobalInt (index, value);
+    }
+
+    void InterpreterContext::setGlobalFloat (int index, float value)
+    {
+        MWBase::Environment::get().getWorld()->setGlobalFloat (index, value);
+    }
+
     int InterpreterContext::getGlobalShort (const std::string& name) const
     {
         return MWBase::Environment::get().getWorld()->getGlobalInt (name);
@@ -69,6 +69,18 @@ namespace MWScript
             void report (const std::string& message) override;
             ///< By default, do nothing.
 
+            int getGlobalShort (int index) const override;
+
+            int getGlobalLong (int index) const override;
+
+            float getGlobalFloat (int index) const override;
+
+            void setGlobalShort (int index, int value) override;
+
+            void setGlobalLong (int index, int value) override;
+
+            void setGlobalFloat (int index, float value) override;
+
             int getGlobalShort (const std::string& name) const override;
 
             int getGlobalLong (const std::string& name) const override;
@@ -1,14 +1,20 @@
 #include "scriptmanagerimp.hpp"
 
 #include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <type_traits>
 #include <sstream>
 #include <exception>
 #include <algorithm>
 
+#include <osg/Stats>
+
 #include <components/debug/debuglog.hpp>
 
 #include <components/esm/loadscpt.hpp>
 
+#include <components/misc/hash.hpp>
 #include <components/misc/stringops.hpp>
 
 #include <components/compiler/scanner.hpp>
@@ -21,14 +27,104 @@
 #include "extensions.hpp"
 #include "interpretercontext.hpp"
 
+namespace
+{
+    // Bump the version whenever code generation or the cache layout changes
+    // (new or renumbered opcodes, changed literal layout); it makes every
+    // cached entry a miss.
+    constexpr char byteCodeCacheMagic[4] = {'O', 'M', 'W', 'B'};
+    constexpr std::uint32_t byteCodeCacheVersion = 2;
+
+    std::uint64_t hashSource(const std::string& text)
+    {
+        return Misc::fnv1a(text.data(), text.size());
+    }
+
+    // Compiled code embeds global variable slot indices assigned by
+    // Globals::fill in store iteration order, so cached byte code is only
+    // valid for the exact ordered globals table it was compiled against.
+    // Hashing it catches any change to the content-file selection that
+    // adds, removes or reorders globals.
+    std::uint64_t hashGlobals(const MWWorld::ESMStore& store)
+    {
+        std::uint64_t hash = Misc::fnv1aBasis;
+        for (const ESM::Global& global : store.get<ESM::Global>())
+        {
+            hash = Misc::fnv1aAppend(hash, std::string_view(Misc::StringUtils::lowerCase(global.mId)));
+            hash = Misc::fnv1aAppend(hash, static_cast<unsigned char>('\0'));
+        }
+        return hash;
+    }
+
+    template <class T>
+    void write(std::ostream& stream, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <class T>
+    bool read(std::istream& stream, T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    void writeString(std::ostream& stream, const std::string& value)
+    {
+        write(stream, static_cast<std::uint32_t>(value.size()));
+        stream.write(value.data(), value.size());
+    }
+
+    bool readString(std::istream& stream, std::string& value)
+    {
+        std::uint32_t size;
+        if (!read(stream, size))
+            return false;
+        value.resize(size);
+        return static_cast<bool>(stream.read(value.data(), size));
+    }
+
+    void writeLocals(std::ostream& stream, const Compiler::Locals& locals)
+    {
+        for (const char type : {'s', 'l', 'f'})
+        {
+            const std::vector<std::string>& names = locals.get(type);
+            write(stream, static_cast<std::uint32_t>(names.size()));
+            for (const std::string& name : names)
+                writeString(stream, name);
+        }
+    }
+
+    bool readLocals(std::istream& stream, Compiler::Locals& locals)
+    {
+        for (const char type : {'s', 'l', 'f'})
+        {
+            std::uint32_t count;
+            if (!read(stream, count))
+                return false;
+            for (std::uint32_t i = 0; i < count; ++i)
+            {
+                std::string name;
+                if (!readString(stream, name))
+                    return false;
+                locals.declare(type, name);
+            }
+        }
+        return true;
+    }
+}
+
 namespace MWScript
 {
     ScriptManager::ScriptManager (const MWWorld::ESMStore& store,
         Compiler::Context& compilerContext, int warningsMode,
-        const std::vector<std::string>& scriptBlacklist)
+        const std::vector<std::string>& scriptBlacklist,
+        const std::string& byteCodeCachePath)
     : mErrorHandler(), mStore (store),
       mCompilerContext (compilerContext), mParser (mErrorHandler, mCompilerContext),
-      mOpcodesInstalled (false), mGlobalScripts (store)
+      mOpcodesInstalled (false), mGlobalScripts (store),
+      mByteCodeCachePath (byteCodeCachePath)
     {
         mErrorHandler.setWarningsMode (warningsMode);
 
@@ -37,10 +133,141 @@ namespace MWScript
         std::transform (scriptBlacklist.begin(), scriptBlacklist.end(),
             mScriptBlacklist.begin(), Misc::StringUtils::lowerCase);
         std::sort (mScriptBlacklist.begin(), mScriptBlacklist.end());
+
+        if (!mByteCodeCachePath.empty())
+        {
+            mGlobalsHash = hashGlobals(mStore);
+            loadByteCodeCache();
+        }
+    }
+
+    ScriptManager::~ScriptManager()
+    {
+        if (!mByteCodeCachePath.empty() && mByteCodeCacheDirty)
+            saveByteCodeCache();
+    }
+
+    void ScriptManager::loadByteCodeCache()
+    {
+        std::ifstream stream (mByteCodeCachePath, std::ios::binary);
+        if (!stream.is_open())
+            return;
+
+        char magic[sizeof(byteCodeCacheMagic)];
+        std::uint32_t version;
+        if (!stream.read(magic, sizeof(magic)) || !std::equal(std::begin(magic), std::end(magic), byteCodeCacheMagic)
+                || !read(stream, version) || version != byteCodeCacheVersion)
+        {
+            Log(Debug::Info) << "Ignoring script byte code cache with different version: " << mByteCodeCachePath;
+            return;
+        }
+
+        std::uint64_t globalsHash;
+        if (!read(stream, globalsHash) || globalsHash != mGlobalsHash)
+        {
+            Log(Debug::Info) << "Ignoring script byte code cache built for a different content selection: "
+                << mByteCodeCachePath;
+            return;
+        }
+
+        std::uint32_t entries;
+        if (!read(stream, entries))
+            return;
+
+        std::uint32_t loaded = 0;
+
+        for (std::uint32_t i = 0; i < entries; ++i)
+        {
+            std::string name;
+            std::uint64_t sourceHash;
+            std::uint32_t codeSize;
+            if (!readString(stream, name) || !read(stream, sourceHash) || !read(stream, codeSize))
+            {
+                Log(Debug::Warning) << "Ignoring truncated script byte code cache: " << mByteCodeCachePath;
+                break;
+            }
+
+            std::vector<Interpreter::Type_Code> code (codeSize);
+            if (codeSize > 0 && !stream.read(reinterpret_cast<char*>(code.data()),
+                    codeSize * sizeof(Interpreter::Type_Code)))
+            {
+                Log(Debug::Warning) << "Ignoring truncated script byte code cache: " << mByteCodeCachePath;
+                break;
+            }
+
+            Compiler::Locals locals;
+            if (!readLocals(stream, locals))
+            {
+                Log(Debug::Warning) << "Ignoring truncated script byte code cache: " << mByteCodeCachePath;
+                break;
+            }
+
+            // Entries whose source changed or disappeared are dropped; the
+            // script is recompiled on demand as if it was never cached.
+            const ESM::Script* script = mStore.get<ESM::Script>().search (name);
+            if (script == nullptr || hashSource(script->mScriptText) != sourceHash)
+                continue;
+
+            if (mScripts.emplace(name, CompiledScript(code, locals, sourceHash)).second)
+                ++loaded;
+        }
+
+        Log(Debug::Info) << "Loaded compiled byte code for " << loaded << " scripts from " << mByteCodeCachePath;
+    }
+
+    void ScriptManager::saveByteCodeCache() const
+    {
+        const std::string tempPath = mByteCodeCachePath + ".tmp";
+
+        {
+            std::ofstream stream (tempPath, std::ios::binary);
+            if (!stream.is_open())
+            {
+                Log(Debug::Warning) << "Failed to open " << tempPath << " for writing the script byte code cache";
+                return;
+            }
+
+            std::uint32_t entries = 0;
+            for (const auto& [name, script] : mScripts)
+                if (!script.mByteCode.empty() && script.mSourceHash != 0)
+                    ++entries;
+
+            stream.write(byteCodeCacheMagic, sizeof(byteCodeCacheMagic));
+            write(stream, byteCodeCacheVersion);
+            write(stream, mGlobalsHash);
+            write(stream, entries);
+
+            for (const auto& [name, script] : mScripts)
+            {
+                if (script.mByteCode.empty() || script.mSourceHash == 0)
+                    continue;
+                writeString(stream, name);
+                write(stream, script.mSourceHash);
+                write(stream, static_cast<std::uint32_t>(script.mByteCode.size()));
+                stream.write(reinterpret_cast<const char*>(script.mByteCode.data()),
+                    script.mByteCode.size() * sizeof(Interpreter::Type_Code));
+                writeLocals(stream, script.mLocals);
+            }
+
+            if (!stream)
+            {
+                Log(Debug::Warning) << "Failed to write the script byte code cache to " << tempPath;
+                return;
+            }
+        }
+
+        if (std::rename(tempPath.c_str(), mByteCodeCachePath.c_str()) != 0)
+            Log(Debug::Warning) << "Failed to move the script byte code cache to " << mByteCodeCachePath;
     }
 
     bool ScriptManager::compile (const std::string& name)
     {
+        // Scripts restored from the byte code cache don't need another pass;
+        // compileAll would otherwise redo the work the cache exists to avoid.
+        const auto existing = mScripts.find (name);
+        if (existing != mScripts.end())
+            return !existing->second.mByteCode.empty();
+
         mParser.reset();
         mErrorHandler.reset();
 
@@ -80,7 +307,8 @@ namespace MWScript
             {
                 std::vector<Interpreter::Type_Code> code;
                 mParser.getCode(code);
-                mScripts.emplace(name, CompiledScript(code, mParser.getLocals()));
+                mScripts.emplace(name, CompiledScript(code, mParser.getLocals(), hashSource(script->mScriptText)));
+                mByteCodeCacheDirty = true;
 
                 return true;
             }
@@ -100,7 +328,7 @@ namespace MWScript
             {
                 // failed -> ignore script from now on.
                 std::vector<Interpreter::Type_Code> empty;
-                mScripts.emplace(name, CompiledScript(empty, Compiler::Locals()));
+                mScripts.emplace(name, CompiledScript(empty, Compiler::Locals(), 0));
                 return false;
             }
 
@@ -108,8 +336,14 @@ namespace MWScript
             assert (iter!=mScripts.end());
         }
 
+        ++mScriptsTotal;
+
         // execute script
-        std::string target = Misc::StringUtils::lowerCase(interpreterContext.getTarget());
+        // Only lowercase the target when some target has actually been deactivated;
+        // this runs for every active script every frame.
+        std::string target;
+        if (!iter->second.mInactive.empty())
+            target = Misc::StringUtils::lowerCase(interpreterContext.getTarget());
         if (!iter->second.mByteCode.empty() && iter->second.mInactive.find(target) == iter->second.mInactive.end())
             try
             {
@@ -119,7 +353,14 @@ namespace MWScript
                     mOpcodesInstalled = true;
                 }
 
-                mInterpreter.run (&iter->second.mByteCode[0], iter->second.mByteCode.size(), interpreterContext);
+                if (iter->second.mProgram.empty())
+                    iter->second.mProgram = mInterpreter.precompile (
+                        &iter->second.mByteCode[0], iter->second.mByteCode.size());
+
+                ++mScriptsRun;
+
+                mInterpreter.run (iter->second.mProgram, &iter->second.mByteCode[0],
+                    iter->second.mByteCode.size(), interpreterContext);
                 return true;
             }
             catch (const MissingImplicitRefError& e)
@@ -130,7 +371,8 @@ namespace MWScript
             {
                 Log(Debug::Error) << "Execution of script " << name << " failed: "  << e.what();
 
-                iter->second.mInactive.insert(target); // don't execute again.
+                // don't execute again (target was not necessarily computed above).
+                iter->second.mInactive.insert(Misc::StringUtils::lowerCase(interpreterContext.getTarget()));
             }
         return false;
     }
@@ -224,4 +466,12 @@ namespace MWScript
     {
         return *mCompilerContext.getExtensions();
     }
+
+    void ScriptManager::reportStats(unsigned int frameNumber, osg::Stats& stats) const
+    {
+        stats.setAttribute(frameNumber, "Scripts Total", mScriptsTotal);
+        stats.setAttribute(frameNumber, "Scripts Run", mScriptsRun);
+        mScriptsTotal = 0;
+        mScriptsRun = 0;
+    }
 }
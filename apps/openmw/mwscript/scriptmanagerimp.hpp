@@ -1,9 +1,11 @@
 #ifndef GAME_SCRIPT_SCRIPTMANAGER_H
 #define GAME_SCRIPT_SCRIPTMANAGER_H
 
+#include <cstdint>
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 
 #include <components/compiler/streamerrorhandler.hpp>
 #include <components/compiler/fileparser.hpp>
@@ -45,26 +47,54 @@ namespace MWScript
             struct CompiledScript
             {
                 std::vector<Interpreter::Type_Code> mByteCode;
+                // Byte code pre-decoded into handler pointers, built on first run
+                // (the opcode tables are not populated before that).
+                Interpreter::Program mProgram;
                 Compiler::Locals mLocals;
                 std::set<std::string> mInactive;
+                // Hash of the source the byte code was compiled from; 0 for
+                // placeholder entries of failed compiles, which are not cached.
+                std::uint64_t mSourceHash;
 
-                CompiledScript(const std::vector<Interpreter::Type_Code>& code, const Compiler::Locals& locals):
-                    mByteCode(code), mLocals(locals)
+                CompiledScript(const std::vector<Interpreter::Type_Code>& code, const Compiler::Locals& locals,
+                        std::uint64_t sourceHash):
+                    mByteCode(code), mLocals(locals), mSourceHash(sourceHash)
                 {}
             };
 
-            typedef std::map<std::string, CompiledScript> ScriptCollection;
+            // Looked up by name for every active script every frame; hashed
+            // container since no ordered traversal is needed.
+            typedef std::unordered_map<std::string, CompiledScript> ScriptCollection;
 
             ScriptCollection mScripts;
+            // Per-frame counters for the stats HUD, reset when reported.
+            mutable unsigned int mScriptsTotal = 0;
+            mutable unsigned int mScriptsRun = 0;
             GlobalScripts mGlobalScripts;
             std::map<std::string, Compiler::Locals> mOtherLocals;
             std::vector<std::string> mScriptBlacklist;
+            std::string mByteCodeCachePath;
+            bool mByteCodeCacheDirty = false;
+            // Hash of the ordered globals table the byte code is compiled against;
+            // cached code embeds global slot indices, so entries from a different
+            // content-file selection must not be reused.
+            std::uint64_t mGlobalsHash = 0;
+
+            /// Preload compiled scripts whose cached source hash still matches the loaded content.
+            void loadByteCodeCache();
+
+            /// Rewrite the cache file if any script was compiled this session.
+            void saveByteCodeCache() const;
 
         public:
 
             ScriptManager (const MWWorld::ESMStore& store,
                 Compiler::Context& compilerContext, int warningsMode,
-                const std::vector<std::string>& scriptBlacklist);
+                const std::vector<std::string>& scriptBlacklist,
+                const std::string& byteCodeCachePath = std::string());
+            ///< \param byteCodeCachePath file storing compiled byte code across sessions; empty disables caching.
+
+            ~ScriptManager();
 
             void clear() override;
 
@@ -85,6 +115,8 @@ namespace MWScript
             GlobalScripts& getGlobalScripts() override;
 
             const Compiler::Extensions& getExtensions() const override;
+
+            void reportStats(unsigned int frameNumber, osg::Stats& stats) const override;
     };
 }
 
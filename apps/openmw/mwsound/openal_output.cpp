@@ -111,6 +111,9 @@ LPALGETAUXILIARYEFFECTSLOTI alGetAuxiliaryEffectSloti;
 LPALGETAUXILIARYEFFECTSLOTIV alGetAuxiliaryEffectSlotiv;
 LPALGETAUXILIARYEFFECTSLOTF alGetAuxiliaryEffectSlotf;
 LPALGETAUXILIARYEFFECTSLOTFV alGetAuxiliaryEffectSlotfv;
+// Deferred source updates
+LPALDEFERUPDATESSOFT alDeferUpdatesSOFT;
+LPALPROCESSUPDATESSOFT alProcessUpdatesSOFT;
 
 
 void LoadEffect(ALuint effect, const EFXEAXREVERBPROPERTIES &props)
@@ -690,6 +693,12 @@ bool OpenAL_Output::init(const std::string &devname, const std::string &hrtfname
     }
 
     AL.SOFT_source_spatialize = alIsExtensionPresent("AL_SOFT_source_spatialize");
+    AL.SOFT_deferred_updates = alIsExtensionPresent("AL_SOFT_deferred_updates");
+    if(AL.SOFT_deferred_updates)
+    {
+        getALFunc(alDeferUpdatesSOFT, "alDeferUpdatesSOFT");
+        getALFunc(alProcessUpdatesSOFT, "alProcessUpdatesSOFT");
+    }
 
     ALCuint maxtotal;
     ALCint maxmono = 0, maxstereo = 0;
@@ -1130,11 +1139,50 @@ void OpenAL_Output::updateCommon(ALuint source, const osg::Vec3f& pos, ALfloat m
 }
 
 
+float OpenAL_Output::getAudibility(const Sound *sound) const
+{
+    // Estimate of the effective gain at the listener, mirroring the
+    // AL_INVERSE_DISTANCE_CLAMPED model the 3D sources are set up with.
+    float gain = sound->getRealVolume();
+    if(sound->getIs3D())
+    {
+        float mindist = sound->getMinDistance();
+        float dist = std::max((sound->getPosition() - mListenerPos).length(), mindist);
+        gain *= mindist / dist;
+    }
+    return gain;
+}
+
+bool OpenAL_Output::stealSource(float audibility)
+{
+    // All sources are in use. Cut off the least audible one-shot sound, if
+    // it is quieter than the new sound, rather than dropping the new sound.
+    // Looping sounds are left alone since their owners expect them to keep
+    // playing; SoundManager releases the stolen sound on its next update.
+    Sound *quietest = nullptr;
+    float quietestAudibility = audibility;
+    for(Sound *sound : mActiveSounds)
+    {
+        if(sound->getIsLooping())
+            continue;
+        float soundAudibility = getAudibility(sound);
+        if(soundAudibility < quietestAudibility)
+        {
+            quietest = sound;
+            quietestAudibility = soundAudibility;
+        }
+    }
+    if(!quietest)
+        return false;
+    finishSound(quietest);
+    return true;
+}
+
 bool OpenAL_Output::playSound(Sound *sound, Sound_Handle data, float offset)
 {
     ALuint source;
 
-    if(mFreeSources.empty())
+    if(mFreeSources.empty() && !stealSource(getAudibility(sound)))
     {
         Log(Debug::Warning) << "No free sources!";
         return false;
@@ -1173,7 +1221,7 @@ bool OpenAL_Output::playSound3D(Sound *sound, Sound_Handle data, float offset)
 {
     ALuint source;
 
-    if(mFreeSources.empty())
+    if(mFreeSources.empty() && !stealSource(getAudibility(sound)))
     {
         Log(Debug::Warning) << "No free sources!";
         return false;
@@ -1377,10 +1425,14 @@ void OpenAL_Output::updateStream(Stream *sound)
 void OpenAL_Output::startUpdate()
 {
     alcSuspendContext(alcGetCurrentContext());
+    if(AL.SOFT_deferred_updates)
+        alDeferUpdatesSOFT();
 }
 
 void OpenAL_Output::finishUpdate()
 {
+    if(AL.SOFT_deferred_updates)
+        alProcessUpdatesSOFT();
     alcProcessContext(alcGetCurrentContext());
 }
 
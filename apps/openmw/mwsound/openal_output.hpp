@@ -29,7 +29,8 @@ namespace MWSound
         } ALC = {false, false};
         struct {
             bool SOFT_source_spatialize : 1;
-        } AL = {false};
+            bool SOFT_deferred_updates : 1;
+        } AL = {false, false};
 
         typedef std::deque<ALuint> IDDq;
         IDDq mFreeSources;
@@ -55,6 +56,9 @@ namespace MWSound
 
         void updateCommon(ALuint source, const osg::Vec3f &pos, ALfloat maxdist, ALfloat gain, ALfloat pitch, bool useenv, bool is3d);
 
+        float getAudibility(const Sound *sound) const;
+        bool stealSource(float audibility);
+
         OpenAL_Output& operator=(const OpenAL_Output &rhs);
         OpenAL_Output(const OpenAL_Output &rhs);
 
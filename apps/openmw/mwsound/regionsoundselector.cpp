@@ -24,18 +24,23 @@ namespace MWSound
     , mMaxTimeBetweenSounds(Fallback::Map::getFloat("Weather_Maximum_Time_Between_Environmental_Sounds"))
     {}
 
-    std::optional<std::string> RegionSoundSelector::getNextRandom(float duration, const std::string& regionName,
-                                                                    const MWBase::World& world)
+    bool RegionSoundSelector::update(float duration)
     {
         mTimePassed += duration;
 
         if (mTimePassed < mTimeToNextEnvSound)
-            return {};
+            return false;
 
         const float a = Misc::Rng::rollClosedProbability();
         mTimeToNextEnvSound = mMinTimeBetweenSounds + (mMaxTimeBetweenSounds - mMinTimeBetweenSounds) * a;
         mTimePassed = 0;
 
+        return true;
+    }
+
+    std::optional<std::string> RegionSoundSelector::getNextRandom(const std::string& regionName,
+                                                                    const MWBase::World& world)
+    {
         if (mLastRegionName != regionName)
         {
             mLastRegionName = regionName;
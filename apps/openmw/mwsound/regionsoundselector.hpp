@@ -14,7 +14,12 @@ namespace MWSound
     class RegionSoundSelector
     {
         public:
-            std::optional<std::string> getNextRandom(float duration, const std::string& regionName,
+            /// Accumulate time towards the next environmental sound. Returns true
+            /// when a sound is due and schedules the one after it, so the caller
+            /// only needs to query the world when this fires.
+            bool update(float duration);
+
+            std::optional<std::string> getNextRandom(const std::string& regionName,
                                                        const MWBase::World& world);
 
             RegionSoundSelector();
@@ -658,6 +658,51 @@ namespace MWSound
         }
     }
 
+    void SoundManager::preloadSounds(const MWWorld::CellStore *cell)
+    {
+        if (!mOutput->isInitialized())
+            return;
+
+        const auto enqueue = [this](const std::string& soundId)
+        {
+            std::string id = Misc::StringUtils::lowerCase(soundId);
+            if (mSoundBuffers.lookup(id) != nullptr)
+                return;  // already loaded
+            if (std::find(mPreloadQueue.begin(), mPreloadQueue.end(), id) == mPreloadQueue.end())
+                mPreloadQueue.push_back(std::move(id));
+        };
+
+        // Movement sounds any actor in the cell can trigger at any moment.
+        static const char* const movementSounds[] = {
+            "FootBareLeft", "FootBareRight", "FootLightLeft", "FootLightRight",
+            "FootMedLeft", "FootMedRight", "FootHeavyLeft", "FootHeavyRight",
+            "FootWaterLeft", "FootWaterRight", "Swim Left", "Swim Right", "DefaultLand"
+        };
+        for (const char* soundId : movementSounds)
+            enqueue(soundId);
+
+        // Ambient sounds of the cell's region.
+        const std::string& regionName = cell->getCell()->mRegion;
+        if (!regionName.empty())
+        {
+            const ESM::Region* region =
+                MWBase::Environment::get().getWorld()->getStore().get<ESM::Region>().search(regionName);
+            if (region != nullptr)
+                for (const ESM::Region::SoundRef& sound : region->mSoundList)
+                    enqueue(sound.mSound);
+        }
+    }
+
+    void SoundManager::updatePreloadQueue()
+    {
+        // One buffer per frame keeps the decode cost negligible while still
+        // finishing well within the cell preload window.
+        if (mPreloadQueue.empty())
+            return;
+        mSoundBuffers.load(mPreloadQueue.front());
+        mPreloadQueue.pop_front();
+    }
+
     void SoundManager::fadeOutSound3D(const MWWorld::ConstPtr &ptr,
             const std::string& soundId, float duration)
     {
@@ -738,6 +783,11 @@ namespace MWSound
 
     void SoundManager::updateRegionSound(float duration)
     {
+        // Only query the player's cell and the output device once a sound is
+        // actually due; between sounds this is just a timer increment.
+        if (!mRegionSoundSelector.update(duration))
+            return;
+
         MWBase::World *world = MWBase::Environment::get().getWorld();
         const MWWorld::ConstPtr player = world->getPlayerPtr();
         const ESM::Cell *cell = player.getCell()->getCell();
@@ -747,7 +797,7 @@ namespace MWSound
         if (mCurrentRegionSound && mOutput->isSoundPlaying(mCurrentRegionSound))
             return;
 
-        if (const auto next = mRegionSoundSelector.getNextRandom(duration, cell->mRegion, *world))
+        if (const auto next = mRegionSoundSelector.getNextRandom(cell->mRegion, *world))
             mCurrentRegionSound = playSound(*next, 1.0f, 1.0f);
     }
 
@@ -919,9 +969,10 @@ namespace MWSound
             Stream *sound = sayiter->second.get();
             if(!ptr.isEmpty() && sound->getIs3D())
             {
-                MWBase::World *world = MWBase::Environment::get().getWorld();
-                const osg::Vec3f pos = world->getActorHeadTransform(ptr).getTrans();
-                sound->setPosition(pos);
+                // The position was refreshed by updateVoicePositions on the main
+                // thread; resolving the head node here would traverse the scene
+                // graph in parallel with the rendering traversals.
+                const osg::Vec3f pos = sound->getPosition();
 
                 if(sound->getDistanceCull())
                 {
@@ -1000,6 +1051,17 @@ namespace MWSound
         {
             updateRegionSound(duration);
             updateWaterSound();
+            updatePreloadQueue();
+        }
+    }
+
+    void SoundManager::updateVoicePositions()
+    {
+        MWBase::World *world = MWBase::Environment::get().getWorld();
+        for(SaySoundMap::value_type &snd : mActiveSaySounds)
+        {
+            if(!snd.first.isEmpty() && snd.second->getIs3D())
+                snd.second->setPosition(world->getActorHeadTransform(snd.first).getTrans());
         }
     }
 
@@ -1175,6 +1237,7 @@ namespace MWSound
         for(StreamPtr& sound : mActiveTracks)
             mOutput->finishStream(sound.get());
         mActiveTracks.clear();
+        mPreloadQueue.clear();
         mPlaybackPaused = false;
         std::fill(std::begin(mPausedSoundTypes), std::end(mPausedSoundTypes), 0);
     }
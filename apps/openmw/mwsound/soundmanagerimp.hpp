@@ -1,6 +1,7 @@
 #ifndef GAME_SOUND_SOUNDMANAGER_H
 #define GAME_SOUND_SOUNDMANAGER_H
 
+#include <deque>
 #include <memory>
 #include <string>
 #include <utility>
@@ -97,6 +98,9 @@ namespace MWSound
 
         Sound* mCurrentRegionSound;
 
+        // Sound ids queued by preloadSounds(), loaded one buffer per frame in update().
+        std::deque<std::string> mPreloadQueue;
+
         Sound_Buffer *insertSound(const std::string &soundId, const ESM::Sound *sound);
 
         // returns a decoder to start streaming, or nullptr if the sound was not found
@@ -115,6 +119,7 @@ namespace MWSound
         void updateRegionSound(float duration);
         void updateWaterSound();
         void updateMusic(float duration);
+        void updatePreloadQueue();
 
         float volumeFromType(Type type) const;
 
@@ -223,6 +228,9 @@ namespace MWSound
         void stopSound(const MWWorld::CellStore *cell) override;
         ///< Stop all sounds for the given cell.
 
+        void preloadSounds(const MWWorld::CellStore *cell) override;
+        ///< Queue likely-needed sound buffers of the given cell for loading.
+
         void fadeOutSound3D(const MWWorld::ConstPtr &reference, const std::string& soundId, float duration) override;
         ///< Fade out given sound (that is already playing) of given object
         ///< @param reference Reference to object, whose sound is faded out
@@ -243,6 +251,8 @@ namespace MWSound
 
         void update(float duration) override;
 
+        void updateVoicePositions() override;
+
         void setListenerPosDir(const osg::Vec3f &pos, const osg::Vec3f &dir, const osg::Vec3f &up, bool underwater) override;
 
         void updatePtr (const MWWorld::ConstPtr& old, const MWWorld::ConstPtr& updated) override;
@@ -1,5 +1,7 @@
 #include "statemanagerimp.hpp"
 
+#include <memory>
+
 #include <components/debug/debuglog.hpp>
 
 #include <components/esm/esmwriter.hpp>
@@ -11,6 +13,8 @@
 
 #include <components/settings/settings.hpp>
 
+#include <components/sceneutil/workqueue.hpp>
+
 #include <osg/Image>
 
 #include <osgDB/Registry>
@@ -41,6 +45,57 @@
 
 #include "quicksavemanager.hpp"
 
+namespace
+{
+    /// Scales a captured screenshot down to thumbnail size and encodes it as JPEG, off the
+    /// main thread so a save only pays for the capture itself.
+    class EncodeScreenshotWorkItem : public SceneUtil::WorkItem
+    {
+        public:
+            EncodeScreenshotWorkItem(osg::ref_ptr<osg::Image> image, int width, int height,
+                    std::shared_ptr<std::vector<char>> imageData)
+                : mImage(image), mWidth(width), mHeight(height), mImageData(imageData)
+            {
+            }
+
+            void doWork() override
+            {
+                try
+                {
+                    mImage->scaleImage(mWidth, mHeight, 1);
+
+                    osgDB::ReaderWriter* readerwriter = osgDB::Registry::instance()->getReaderWriterForExtension("jpg");
+                    if (!readerwriter)
+                    {
+                        Log(Debug::Error) << "Error: Unable to write screenshot, can't find a jpg ReaderWriter";
+                        return;
+                    }
+
+                    std::ostringstream ostream;
+                    osgDB::ReaderWriter::WriteResult result = readerwriter->writeImage(*mImage, ostream);
+                    if (!result.success())
+                    {
+                        Log(Debug::Error) << "Error: Unable to write screenshot: " << result.message() << " code " << result.status();
+                        return;
+                    }
+
+                    const std::string data = ostream.str();
+                    mImageData->assign(data.begin(), data.end());
+                }
+                catch (const std::exception& e)
+                {
+                    Log(Debug::Error) << "Error: Unable to write screenshot: " << e.what();
+                }
+            }
+
+        private:
+            osg::ref_ptr<osg::Image> mImage;
+            int mWidth;
+            int mHeight;
+            std::shared_ptr<std::vector<char>> mImageData;
+    };
+}
+
 void MWState::StateManager::cleanup (bool force)
 {
     if (mState!=State_NoGame || force)
@@ -88,12 +143,54 @@ std::map<int, int> MWState::StateManager::buildContentFileIndexMap (const ESM::E
     return map;
 }
 
-MWState::StateManager::StateManager (const boost::filesystem::path& saves, const std::string& game)
+MWState::StateManager::StateManager (const boost::filesystem::path& saves, const std::string& game,
+    SceneUtil::WorkQueue* workQueue)
 : mQuitRequest (false), mAskLoadRecent(false), mState (State_NoGame), mCharacterManager (saves, game), mTimePlayed (0)
+, mSaveFinished (false), mSaveCharacter (nullptr), mSaveSlot (nullptr), mWorkQueue (workQueue)
 {
 
 }
 
+MWState::StateManager::~StateManager()
+{
+    // Can't report errors anymore; just make sure the file is complete.
+    if (mSaveThread.joinable())
+        mSaveThread.join();
+}
+
+void MWState::StateManager::finishPendingSave()
+{
+    if (!mSaveThread.joinable())
+        return;
+
+    mSaveThread.join();
+    mSaveFinished = false;
+
+    if (!mSaveError.empty())
+    {
+        std::stringstream error;
+        error << "Failed to save game: " << mSaveError;
+
+        Log(Debug::Error) << error.str();
+
+        std::vector<std::string> buttons;
+        buttons.emplace_back("#{sOk}");
+        MWBase::Environment::get().getWindowManager()->interactiveMessageBox(error.str(), buttons);
+
+        // If no file was written, clean up the slot
+        if (mSaveCharacter && mSaveSlot && !boost::filesystem::exists(mSaveSlot->mPath))
+        {
+            mSaveCharacter->deleteSlot(mSaveSlot);
+            mSaveCharacter->cleanup();
+        }
+
+        mSaveError.clear();
+    }
+
+    mSaveCharacter = nullptr;
+    mSaveSlot = nullptr;
+}
+
 void MWState::StateManager::requestQuit()
 {
     mQuitRequest = true;
@@ -184,6 +281,9 @@ void MWState::StateManager::resumeGame()
 
 void MWState::StateManager::saveGame (const std::string& description, const Slot *slot)
 {
+    // Wait for a previous save still being written out - it may target the same slot.
+    finishPendingSave();
+
     MWState::Character* character = getCurrentCharacter();
 
     try
@@ -220,12 +320,11 @@ void MWState::StateManager::saveGame (const std::string& description, const Slot
         profile.mDescription = description;
 
         Log(Debug::Info) << "Making a screenshot for saved game '" << description << "'";
-        writeScreenshot(profile.mScreenshot);
-
-        if (!slot)
-            slot = character->createSlot (profile);
-        else
-            slot = character->updateSlot (slot, profile);
+        // The thumbnail is scaled down and encoded on the work queue while the record counting
+        // and header writing below proceed; the result is collected before the profile is
+        // stored in its slot.
+        std::shared_ptr<std::vector<char>> encodedScreenshot = std::make_shared<std::vector<char>>();
+        osg::ref_ptr<SceneUtil::WorkItem> screenshotItem = writeScreenshot(encodedScreenshot);
 
         // Make sure the animation state held by references is up to date before saving the game.
         MWBase::Environment::get().getMechanicsManager()->persistAnimationStates();
@@ -262,6 +361,14 @@ void MWState::StateManager::saveGame (const std::string& description, const Slot
 
         writer.save (stream);
 
+        screenshotItem->waitTillDone();
+        profile.mScreenshot = std::move(*encodedScreenshot);
+
+        if (!slot)
+            slot = character->createSlot (profile);
+        else
+            slot = character->updateSlot (slot, profile);
+
         Loading::Listener& listener = *MWBase::Environment::get().getWindowManager()->getLoadingScreen();
         // Using only Cells for progress information, since they typically have the largest records by far
         listener.setProgressRange(MWBase::Environment::get().getWorld()->countSavedGameCells());
@@ -293,12 +400,29 @@ void MWState::StateManager::saveGame (const std::string& description, const Slot
         if (stream.fail())
             throw std::runtime_error("Write operation failed (memory stream)");
 
-        // All good, write to file
-        boost::filesystem::ofstream filestream (slot->mPath, std::ios::binary);
-        filestream << stream.rdbuf();
+        // All good; the encoded save is complete, so gameplay can resume while a
+        // background thread pushes it to disk. Failures are reported from
+        // finishPendingSave() on the next update.
+        mSaveCharacter = character;
+        mSaveSlot = slot;
+        const boost::filesystem::path path = slot->mPath;
+        auto data = std::make_shared<std::stringstream>(std::move(stream));
+        mSaveThread = std::thread([this, data, path]
+        {
+            try
+            {
+                boost::filesystem::ofstream filestream (path, std::ios::binary);
+                filestream << data->rdbuf();
 
-        if (filestream.fail())
-            throw std::runtime_error("Write operation failed (file stream)");
+                if (filestream.fail())
+                    throw std::runtime_error("Write operation failed (file stream)");
+            }
+            catch (const std::exception& e)
+            {
+                mSaveError = e.what();
+            }
+            mSaveFinished = true;
+        });
 
         Settings::Manager::setString ("character", "Saves",
             slot->mPath.parent_path().filename().string());
@@ -375,6 +499,9 @@ void MWState::StateManager::loadGame(const std::string& filepath)
 
 void MWState::StateManager::loadGame (const Character *character, const std::string& filepath)
 {
+    // The file we are about to read may still be being written out.
+    finishPendingSave();
+
     try
     {
         cleanup();
@@ -587,6 +714,7 @@ void MWState::StateManager::quickLoad()
 
 void MWState::StateManager::deleteGame(const MWState::Character *character, const MWState::Slot *slot)
 {
+    finishPendingSave();
     mCharacterManager.deleteSlot(character, slot);
 }
 
@@ -609,6 +737,10 @@ void MWState::StateManager::update (float duration)
 {
     mTimePlayed += duration;
 
+    // Reap a background save once it is done; join is immediate at this point.
+    if (mSaveFinished)
+        finishPendingSave();
+
     // Note: It would be nicer to trigger this from InputManager, i.e. the very beginning of the frame update.
     if (mAskLoadRecent)
     {
@@ -656,7 +788,7 @@ bool MWState::StateManager::verifyProfile(const ESM::SavedGame& profile) const
     return true;
 }
 
-void MWState::StateManager::writeScreenshot(std::vector<char> &imageData) const
+osg::ref_ptr<SceneUtil::WorkItem> MWState::StateManager::writeScreenshot(std::shared_ptr<std::vector<char>> imageData) const
 {
     int screenshotW = 259*2, screenshotH = 133*2; // *2 to get some nice antialiasing
 
@@ -664,22 +796,14 @@ void MWState::StateManager::writeScreenshot(std::vector<char> &imageData) const
 
     MWBase::Environment::get().getWorld()->screenshot(screenshot.get(), screenshotW, screenshotH);
 
-    osgDB::ReaderWriter* readerwriter = osgDB::Registry::instance()->getReaderWriterForExtension("jpg");
-    if (!readerwriter)
-    {
-        Log(Debug::Error) << "Error: Unable to write screenshot, can't find a jpg ReaderWriter";
-        return;
-    }
-
-    std::ostringstream ostream;
-    osgDB::ReaderWriter::WriteResult result = readerwriter->writeImage(*screenshot, ostream);
-    if (!result.success())
+    osg::ref_ptr<SceneUtil::WorkItem> item (new EncodeScreenshotWorkItem(screenshot, screenshotW, screenshotH, imageData));
+    if (mWorkQueue)
+        // jump the queue - the save waits on this item, it should not sit behind preload work
+        mWorkQueue->addWorkItem(item, true);
+    else
     {
-        Log(Debug::Error) << "Error: Unable to write screenshot: " << result.message() << " code " << result.status();
-        return;
+        item->doWork();
+        item->signalDone();
     }
-
-    std::string data = ostream.str();
-    imageData = std::vector<char>(data.begin(), data.end());
-
+    return item;
 }
@@ -1,7 +1,14 @@
 #ifndef GAME_STATE_STATEMANAGER_H
 #define GAME_STATE_STATEMANAGER_H
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <osg/ref_ptr>
 
 #include "../mwbase/statemanager.hpp"
 
@@ -9,6 +16,12 @@
 
 #include "charactermanager.hpp"
 
+namespace SceneUtil
+{
+    class WorkItem;
+    class WorkQueue;
+}
+
 namespace MWState
 {
     class StateManager : public MWBase::StateManager
@@ -19,19 +32,39 @@ namespace MWState
             CharacterManager mCharacterManager;
             double mTimePlayed;
 
+            // A save still being written to disk by mSaveThread (see saveGame). The
+            // pointers and the error string are only touched by the main thread
+            // after the thread has been joined.
+            std::thread mSaveThread;
+            std::atomic<bool> mSaveFinished;
+            std::string mSaveError;
+            Character* mSaveCharacter;
+            const Slot* mSaveSlot;
+
+            osg::ref_ptr<SceneUtil::WorkQueue> mWorkQueue;
+
         private:
 
             void cleanup (bool force = false);
 
+            void finishPendingSave();
+            ///< Join mSaveThread if a background save is in flight and report any write error.
+
             bool verifyProfile (const ESM::SavedGame& profile) const;
 
-            void writeScreenshot (std::vector<char>& imageData) const;
+            /// Capture a screenshot and start downscaling and encoding it into \a imageData
+            /// on the work queue. The returned item must be waited on before \a imageData
+            /// may be read.
+            osg::ref_ptr<SceneUtil::WorkItem> writeScreenshot (std::shared_ptr<std::vector<char>> imageData) const;
 
             std::map<int, int> buildContentFileIndexMap (const ESM::ESMReader& reader) const;
 
         public:
 
-            StateManager (const boost::filesystem::path& saves, const std::string& game);
+            StateManager (const boost::filesystem::path& saves, const std::string& game,
+                SceneUtil::WorkQueue* workQueue);
+
+            ~StateManager();
 
             void requestQuit() override;
 
@@ -3,6 +3,8 @@
 #include <atomic>
 #include <limits>
 
+#include <osg/Stats>
+
 #include <components/debug/debuglog.hpp>
 #include <components/resource/scenemanager.hpp>
 #include <components/resource/resourcesystem.hpp>
@@ -109,6 +111,12 @@ namespace MWWorld
                 }
             }
 
+            // Let the VFS workers pull the raw mesh data through the archives
+            // (including BSA decompression) while this thread parses, instead
+            // of alternating between reading and parsing.
+            for (const std::string& mesh : mMeshes)
+                mSceneManager->getVFS()->prefetch(Misc::ResourceHelpers::correctActorModelPath(mesh, mSceneManager->getVFS()));
+
             for (std::string& mesh: mMeshes)
             {
                 if (mAbort)
@@ -275,7 +283,7 @@ namespace MWWorld
         mPreloadCells.clear();
     }
 
-    void CellPreloader::preload(CellStore *cell, double timestamp)
+    void CellPreloader::preload(CellStore *cell, double timestamp, int priority)
     {
         if (!mWorkQueue)
         {
@@ -291,39 +299,37 @@ namespace MWWorld
         PreloadMap::iterator found = mPreloadCells.find(cell);
         if (found != mPreloadCells.end())
         {
-            // already preloaded, nothing to do other than updating the timestamp
+            // already preloaded, nothing to do other than refreshing the timestamp and priority
             found->second.mTimeStamp = timestamp;
+            found->second.mPriority = std::max(found->second.mPriority, priority);
             return;
         }
 
         while (mPreloadCells.size() >= mMaxCacheSize)
         {
-            // throw out oldest cell to make room
-            PreloadMap::iterator oldestCell = mPreloadCells.begin();
-            double oldestTimestamp = std::numeric_limits<double>::max();
+            // throw out the cell least likely to be reused: lowest priority first, oldest request within a priority
+            PreloadMap::iterator evictCell = mPreloadCells.begin();
             double threshold = 1.0; // seconds
             for (PreloadMap::iterator it = mPreloadCells.begin(); it != mPreloadCells.end(); ++it)
             {
-                if (it->second.mTimeStamp < oldestTimestamp)
-                {
-                    oldestTimestamp = it->second.mTimeStamp;
-                    oldestCell = it;
-                }
+                if (std::make_pair(it->second.mPriority, it->second.mTimeStamp)
+                        < std::make_pair(evictCell->second.mPriority, evictCell->second.mTimeStamp))
+                    evictCell = it;
             }
 
-            if (oldestTimestamp + threshold < timestamp)
+            if (evictCell->second.mTimeStamp + threshold < timestamp)
             {
-                oldestCell->second.mWorkItem->abort();
-                mPreloadCells.erase(oldestCell);
+                evictCell->second.mWorkItem->abort();
+                mPreloadCells.erase(evictCell);
             }
             else
                 return;
         }
 
         osg::ref_ptr<PreloadItem> item (new PreloadItem(cell, mResourceSystem->getSceneManager(), mBulletShapeManager, mResourceSystem->getKeyframeManager(), mTerrain, mLandManager, mPreloadInstances));
-        mWorkQueue->addWorkItem(item);
+        mWorkQueue->addWorkItem(item, priority, {});
 
-        mPreloadCells[cell] = PreloadEntry(timestamp, item);
+        mPreloadCells[cell] = PreloadEntry(timestamp, item, priority);
     }
 
     void CellPreloader::notifyLoaded(CellStore *cell)
@@ -513,4 +519,16 @@ namespace MWWorld
         return mLoadedTerrainTimestamp + mResourceSystem->getSceneManager()->getExpiryDelay() > referenceTime && contains(mLoadedTerrainPositions, std::array {position}, ESM::Land::REAL_SIZE);
     }
 
+    void CellPreloader::reportStats(unsigned int frameNumber, osg::Stats& stats) const
+    {
+        unsigned int pending = 0;
+        for (const auto& entry : mPreloadCells)
+            if (entry.second.mWorkItem && !entry.second.mWorkItem->isDone())
+                ++pending;
+
+        stats.setAttribute(frameNumber, "Preload Cells", mPreloadCells.size());
+        stats.setAttribute(frameNumber, "Preload Pending", pending);
+        stats.setAttribute(frameNumber, "Preload Terrain", mTerrainPreloadItem && !mTerrainPreloadItem->isDone() ? 1 : 0);
+    }
+
 }
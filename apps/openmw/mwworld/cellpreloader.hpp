@@ -7,6 +7,11 @@
 #include <osg/Vec4i>
 #include <components/sceneutil/workqueue.hpp>
 
+namespace osg
+{
+    class Stats;
+}
+
 namespace Resource
 {
     class ResourceSystem;
@@ -46,8 +51,10 @@ namespace MWWorld
         ~CellPreloader();
 
         /// Ask a background thread to preload rendering meshes and collision shapes for objects in this cell.
+        /// @param priority How likely the cell is to be needed soon. Items with larger values are
+        /// started first by the work queue and evicted last from the preload cache.
         /// @note The cell itself must be in State_Loaded or State_Preloaded.
-        void preload(MWWorld::CellStore* cell, double timestamp);
+        void preload(MWWorld::CellStore* cell, double timestamp, int priority = 0);
 
         void notifyLoaded(MWWorld::CellStore* cell);
 
@@ -81,6 +88,8 @@ namespace MWWorld
         void abortTerrainPreloadExcept(const PositionCellGrid *exceptPos);
         bool isTerrainLoaded(const CellPreloader::PositionCellGrid &position, double referenceTime) const;
 
+        void reportStats(unsigned int frameNumber, osg::Stats& stats) const;
+
     private:
         Resource::ResourceSystem* mResourceSystem;
         Resource::BulletShapeManager* mBulletShapeManager;
@@ -98,18 +107,21 @@ namespace MWWorld
 
         struct PreloadEntry
         {
-            PreloadEntry(double timestamp, osg::ref_ptr<SceneUtil::WorkItem> workItem)
+            PreloadEntry(double timestamp, osg::ref_ptr<SceneUtil::WorkItem> workItem, int priority)
                 : mTimeStamp(timestamp)
                 , mWorkItem(workItem)
+                , mPriority(priority)
             {
             }
             PreloadEntry()
                 : mTimeStamp(0.0)
+                , mPriority(0)
             {
             }
 
             double mTimeStamp;
             osg::ref_ptr<SceneUtil::WorkItem> mWorkItem;
+            int mPriority;
         };
         typedef std::map<const MWWorld::CellStore*, PreloadEntry> PreloadMap;
 
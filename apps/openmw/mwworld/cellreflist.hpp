@@ -1,9 +1,8 @@
 #ifndef GAME_MWWORLD_CELLREFLIST_H
 #define GAME_MWWORLD_CELLREFLIST_H
 
-#include <list>
-
 #include "livecellref.hpp"
+#include "stablelist.hpp"
 
 namespace MWWorld
 {
@@ -12,7 +11,9 @@ namespace MWWorld
     struct CellRefList
     {
         typedef LiveCellRef<X> LiveRef;
-        typedef std::list<LiveRef> List;
+        // Block storage so visitors walk the refs mostly linearly in memory,
+        // while pointers handed out through Ptr stay valid like with std::list
+        typedef StableList<LiveRef> List;
         List mList;
 
         /// Search for the given reference in the given reclist from
@@ -36,7 +37,7 @@ namespace MWWorld
             for (typename List::iterator it = mList.begin(); it != mList.end();)
             {
                 if (*it == refNum)
-                    mList.erase(it++);
+                    it = mList.erase(it);
                 else
                     ++it;
             }
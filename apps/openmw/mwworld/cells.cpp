@@ -1,5 +1,7 @@
 #include "cells.hpp"
 
+#include <sstream>
+
 #include <components/debug/debuglog.hpp>
 #include <components/esm/esmreader.hpp>
 #include <components/esm/esmwriter.hpp>
@@ -90,12 +92,69 @@ MWWorld::CellStore *MWWorld::Cells::getCellStore (const ESM::Cell *cell)
     }
 }
 
+MWWorld::CellStore *MWWorld::Cells::getCellStore (int x, int y)
+{
+    std::map<std::pair<int, int>, CellStore>::iterator result =
+        mExteriors.find (std::make_pair (x, y));
+
+    if (result==mExteriors.end())
+    {
+        const ESM::Cell *cell = mStore.get<ESM::Cell>().search(x, y);
+
+        if (!cell)
+        {
+            // Cell isn't predefined. Make one on the fly.
+            ESM::Cell record;
+            record.mCellId.mWorldspace = ESM::CellId::sDefaultWorldspace;
+            record.mCellId.mPaged = true;
+            record.mCellId.mIndex.mX = x;
+            record.mCellId.mIndex.mY = y;
+
+            record.mData.mFlags = ESM::Cell::HasWater;
+            record.mData.mX = x;
+            record.mData.mY = y;
+            record.mWater = 0;
+            record.mMapColor = 0;
+
+            cell = MWBase::Environment::get().getWorld()->createRecord (record);
+        }
+
+        result = mExteriors.insert (std::make_pair (
+            std::make_pair (x, y), CellStore (cell, mStore, mReader))).first;
+    }
+
+    return &result->second;
+}
+
+MWWorld::CellStore *MWWorld::Cells::getCellStore (const std::string& lowerName)
+{
+    std::map<std::string, CellStore>::iterator result = mInteriors.find (lowerName);
+
+    if (result==mInteriors.end())
+    {
+        const ESM::Cell *cell = mStore.get<ESM::Cell>().find(lowerName);
+
+        result = mInteriors.insert (std::make_pair (lowerName, CellStore (cell, mStore, mReader))).first;
+    }
+
+    return &result->second;
+}
+
+MWWorld::CellStore *MWWorld::Cells::getCellStore (const ESM::CellId& id)
+{
+    if (id.mPaged)
+        return getCellStore (id.mIndex.mX, id.mIndex.mY);
+
+    return getCellStore (Misc::StringUtils::lowerCase(id.mWorldspace));
+}
+
 void MWWorld::Cells::clear()
 {
     mInteriors.clear();
     mExteriors.clear();
     std::fill(mIdCache.begin(), mIdCache.end(), std::make_pair("", (MWWorld::CellStore*)nullptr));
     mIdCacheIndex = 0;
+    mSaveContentFileMap.reset();
 }
 
 MWWorld::Ptr MWWorld::Cells::getPtrAndCache (const std::string& name, CellStore& cellStore)
@@ -115,6 +174,14 @@ MWWorld::Ptr MWWorld::Cells::getPtrAndCache (const std::string& name, CellStore&
 
 void MWWorld::Cells::writeCell (ESM::ESMWriter& writer, CellStore& cell) const
 {
+    if (cell.hasValidSerializedState())
+    {
+        // Nothing could have changed the cell since the last save (or since the
+        // save it was loaded from, if it was never loaded again), reuse its bytes.
+        writer.writeSerializedRecord (cell.getSerializedState());
+        return;
+    }
+
     if (cell.getState()!=CellStore::State_Loaded)
         cell.load ();
 
@@ -122,12 +189,22 @@ void MWWorld::Cells::writeCell (ESM::ESMWriter& writer, CellStore& cell) const
 
     cell.saveState (cellState);
 
-    writer.startRecord (ESM::REC_CSTA);
-    cellState.mId.save (writer);
-    cellState.save (writer);
-    cell.writeFog(writer);
-    cell.writeReferences (writer);
-    writer.endRecord (ESM::REC_CSTA);
+    // Serialize through a buffer, so that the result can be reused by the next save
+    // if the cell is not touched in between. Record bytes do not depend on their
+    // position in the file, so they can be concatenated into any later save.
+    std::ostringstream stream;
+    ESM::ESMWriter cellWriter;
+    cellWriter.setStream (&stream);
+
+    cellWriter.startRecord (ESM::REC_CSTA);
+    cellState.mId.save (cellWriter);
+    cellState.save (cellWriter);
+    cell.writeFog(cellWriter);
+    cell.writeReferences (cellWriter);
+    cellWriter.endRecord (ESM::REC_CSTA);
+
+    cell.setSerializedState (stream.str());
+    writer.writeSerializedRecord (cell.getSerializedState());
 }
 
 MWWorld::Cells::Cells (const MWWorld::ESMStore& store, std::vector<ESM::ESMReader>& reader)
@@ -140,61 +217,26 @@ MWWorld::Cells::Cells (const MWWorld::ESMStore& store, std::vector<ESM::ESMReade
 
 MWWorld::CellStore *MWWorld::Cells::getExterior (int x, int y)
 {
-    std::map<std::pair<int, int>, CellStore>::iterator result =
-        mExteriors.find (std::make_pair (x, y));
-
-    if (result==mExteriors.end())
-    {
-        const ESM::Cell *cell = mStore.get<ESM::Cell>().search(x, y);
-
-        if (!cell)
-        {
-            // Cell isn't predefined. Make one on the fly.
-            ESM::Cell record;
-            record.mCellId.mWorldspace = ESM::CellId::sDefaultWorldspace;
-            record.mCellId.mPaged = true;
-            record.mCellId.mIndex.mX = x;
-            record.mCellId.mIndex.mY = y;
+    CellStore *cellStore = getCellStore (x, y);
 
-            record.mData.mFlags = ESM::Cell::HasWater;
-            record.mData.mX = x;
-            record.mData.mY = y;
-            record.mWater = 0;
-            record.mMapColor = 0;
-
-            cell = MWBase::Environment::get().getWorld()->createRecord (record);
-        }
-
-        result = mExteriors.insert (std::make_pair (
-            std::make_pair (x, y), CellStore (cell, mStore, mReader))).first;
-    }
-
-    if (result->second.getState()!=CellStore::State_Loaded)
+    if (cellStore->getState()!=CellStore::State_Loaded)
     {
-        result->second.load ();
+        cellStore->load ();
     }
 
-    return &result->second;
+    return cellStore;
 }
 
 MWWorld::CellStore *MWWorld::Cells::getInterior (const std::string& name)
 {
-    std::string lowerName = Misc::StringUtils::lowerCase(name);
-    std::map<std::string, CellStore>::iterator result = mInteriors.find (lowerName);
-
-    if (result==mInteriors.end())
-    {
-        const ESM::Cell *cell = mStore.get<ESM::Cell>().find(lowerName);
-
-        result = mInteriors.insert (std::make_pair (lowerName, CellStore (cell, mStore, mReader))).first;
-    }
+    CellStore *cellStore = getCellStore (Misc::StringUtils::lowerCase(name));
 
-    if (result->second.getState()!=CellStore::State_Loaded)
+    if (cellStore->getState()!=CellStore::State_Loaded)
     {
-        result->second.load ();
+        cellStore->load ();
     }
 
-    return &result->second;
+    return cellStore;
 }
 
 void MWWorld::Cells::rest (double hours)
@@ -419,63 +461,44 @@ void MWWorld::Cells::write (ESM::ESMWriter& writer, Loading::Listener& progress)
         }
 }
 
-struct GetCellStoreCallback : public MWWorld::CellStore::GetCellStoreCallback
-{
-public:
-    GetCellStoreCallback(MWWorld::Cells& cells)
-        : mCells(cells)
-    {
-    }
-
-    MWWorld::Cells& mCells;
-
-    MWWorld::CellStore* getCellStore(const ESM::CellId& cellId) override
-    {
-        try
-        {
-            return mCells.getCell(cellId);
-        }
-        catch (...)
-        {
-            return nullptr;
-        }
-    }
-};
-
 bool MWWorld::Cells::readRecord (ESM::ESMReader& reader, uint32_t type,
     const std::map<int, int>& contentFileMap)
 {
     if (type==ESM::REC_CSTA)
     {
-        ESM::CellState state;
-        state.mId.load (reader);
+        // Take the raw record bytes instead of parsing them here; the state is
+        // applied when the cell is first loaded (most cells in an old save are
+        // never visited again) and doubles as the cell's serialized state, so
+        // an untouched cell is written back to the next save verbatim.
+        std::string record = reader.getSerializedRecord();
+
+        // Parse just the cell id off the front of the record to route it.
+        ESM::CellId id;
+        {
+            ESM::ESMReader idReader;
+            idReader.openRaw (std::make_shared<std::istringstream> (record), reader.getName());
+            idReader.getRecName();
+            idReader.getRecHeader();
+            id.load (idReader);
+        }
 
         CellStore *cellStore = nullptr;
 
         try
         {
-            cellStore = getCell (state.mId);
+            cellStore = getCellStore (id);
         }
         catch (...)
         {
             // silently drop cells that don't exist anymore
-            Log(Debug::Warning) << "Warning: Dropping state for cell " << state.mId.mWorldspace << " (cell no longer exists)";
-            reader.skipRecord();
+            Log(Debug::Warning) << "Warning: Dropping state for cell " << id.mWorldspace << " (cell no longer exists)";
             return true;
         }
 
-        state.load (reader);
-        cellStore->loadState (state);
-
-        if (state.mHasFogOfWar)
-            cellStore->readFog(reader);
-
-        if (cellStore->getState()!=CellStore::State_Loaded)
-            cellStore->load ();
-
-        GetCellStoreCallback callback(*this);
+        if (!mSaveContentFileMap || *mSaveContentFileMap != contentFileMap)
+            mSaveContentFileMap = std::make_shared<const std::map<int, int>> (contentFileMap);
 
-        cellStore->readReferences (reader, contentFileMap, &callback);
+        cellStore->setPendingSaveState (std::move (record), reader.getFormat(), mSaveContentFileMap);
 
         return true;
     }
@@ -3,6 +3,7 @@
 
 #include <map>
 #include <list>
+#include <memory>
 #include <string>
 
 #include "ptr.hpp"
@@ -36,11 +37,24 @@ namespace MWWorld
             IdCache mIdCache;
             std::size_t mIdCacheIndex;
 
+            // Content file index map of the save the pending cell states came from,
+            // shared between all cell stores (see readRecord).
+            std::shared_ptr<const std::map<int, int>> mSaveContentFileMap;
+
             Cells (const Cells&);
             Cells& operator= (const Cells&);
 
             CellStore *getCellStore (const ESM::Cell *cell);
 
+            CellStore *getCellStore (int x, int y);
+            ///< Find or create the cell store for the given exterior cell without loading it.
+
+            CellStore *getCellStore (const std::string& lowerName);
+            ///< Find or create the cell store for the given interior cell without loading it.
+
+            CellStore *getCellStore (const ESM::CellId& id);
+            ///< Find or create the cell store for the given cell ID without loading it.
+
             Ptr getPtrAndCache (const std::string& name, CellStore& cellStore);
 
             Ptr getPtr(CellStore& cellStore, const std::string& id, const ESM::RefNum& refNum);
@@ -1,6 +1,7 @@
 #include "cellstore.hpp"
 
 #include <algorithm>
+#include <sstream>
 
 #include <components/debug/debuglog.hpp>
 
@@ -14,6 +15,7 @@
 #include <components/esm/npcstate.hpp>
 #include <components/esm/creaturestate.hpp>
 #include <components/esm/fogstate.hpp>
+#include <components/esm/savedgame.hpp>
 #include <components/esm/creaturelevliststate.hpp>
 #include <components/esm/doorstate.hpp>
 
@@ -32,6 +34,23 @@
 
 namespace
 {
+    // Resolves cells for moved references when applying deferred saved game state
+    // (the same job the Cells manager does for the callback while reading a save).
+    struct WorldGetCellStoreCallback : public MWWorld::CellStore::GetCellStoreCallback
+    {
+        MWWorld::CellStore* getCellStore(const ESM::CellId& cellId) override
+        {
+            try
+            {
+                return MWBase::Environment::get().getWorld()->getCell(cellId);
+            }
+            catch (...)
+            {
+                return nullptr;
+            }
+        }
+    };
+
     template<typename T>
     MWWorld::Ptr searchInContainerList (MWWorld::CellRefList<T>& containerList, const std::string& id)
     {
@@ -225,18 +244,24 @@ namespace MWWorld
 
         if (const X *ptr = store.search (ref.mRefID))
         {
-            typename std::list<LiveRef>::iterator iter =
+            typename List::iterator iter =
                 std::find(mList.begin(), mList.end(), ref.mRefNum);
 
-            LiveRef liveCellRef (ref, ptr);
-
-            if (deleted)
-                liveCellRef.mData.setDeletedByContentFile(true);
-
             if (iter != mList.end())
+            {
+                LiveRef liveCellRef (ref, ptr);
+                if (deleted)
+                    liveCellRef.mData.setDeletedByContentFile(true);
                 *iter = liveCellRef;
+            }
             else
-                mList.push_back (liveCellRef);
+            {
+                // Construct in place - copying a finished LiveRef into the list would
+                // duplicate the CellRef strings and the RefData for every reference
+                LiveRef& liveCellRef = mList.emplace_back(ref, ptr);
+                if (deleted)
+                    liveCellRef.mData.setDeletedByContentFile(true);
+            }
         }
         else
         {
@@ -253,6 +278,7 @@ namespace MWWorld
 
     Ptr CellStore::getCurrentPtr(LiveCellRefBase *ref)
     {
+        mSerializedStateValid = false;
         MovedRefTracker::iterator found = mMovedToAnotherCell.find(ref);
         if (found != mMovedToAnotherCell.end())
             return Ptr(ref, found->second);
@@ -265,6 +291,7 @@ namespace MWWorld
             load();
 
         mHasState = true;
+        mSerializedStateValid = false;
         MovedRefTracker::iterator found = mMovedToAnotherCell.find(object.getBase());
         if (found != mMovedToAnotherCell.end())
         {
@@ -294,6 +321,8 @@ namespace MWWorld
 
         MWBase::Environment::get().getLuaManager()->registerObject(MWWorld::Ptr(object.getBase(), cellToMoveTo));
 
+        mSerializedStateValid = false;
+
         MovedRefTracker::iterator found = mMovedHere.find(object.getBase());
         if (found != mMovedHere.end())
         {
@@ -374,7 +403,7 @@ namespace MWWorld
     }
 
     CellStore::CellStore (const ESM::Cell *cell, const MWWorld::ESMStore& esmStore, std::vector<ESM::ESMReader>& readerList)
-        : mStore(esmStore), mReader(readerList), mCell (cell), mState (State_Unloaded), mHasState (false), mLastRespawn(0,0), mRechargingItemsUpToDate(false)
+        : mStore(esmStore), mReader(readerList), mCell (cell), mState (State_Unloaded), mHasState (false), mSerializedStateValid (false), mHasPendingSaveState (false), mPendingSaveStateFormat (0), mLastRespawn(0,0), mRechargingItemsUpToDate(false)
     {
         mWaterLevel = cell->mWater;
     }
@@ -399,6 +428,56 @@ namespace MWWorld
         return mHasState;
     }
 
+    bool CellStore::hasValidSerializedState() const
+    {
+        return mSerializedStateValid;
+    }
+
+    const std::string& CellStore::getSerializedState() const
+    {
+        return mSerializedState;
+    }
+
+    void CellStore::setSerializedState (std::string state)
+    {
+        mSerializedState = std::move (state);
+        mSerializedStateValid = true;
+    }
+
+    void CellStore::invalidateSerializedState()
+    {
+        mSerializedStateValid = false;
+    }
+
+    void CellStore::setPendingSaveState (std::string state, int format,
+        std::shared_ptr<const std::map<int, int>> contentFileMap)
+    {
+        // The raw bytes are always kept so the state can be parsed once the cell
+        // is first needed, but the next save may only splice them in verbatim if
+        // they were written in the current format and the save's content file
+        // indices match the current selection (RefNums embed those indices).
+        // Otherwise leave the serialized state invalid, so Cells::writeCell loads
+        // the cell and re-serializes instead.
+        mSerializedState = std::move (state);
+        mSerializedStateValid = format == ESM::SavedGame::sCurrentFormat
+            && std::all_of (contentFileMap->begin(), contentFileMap->end(),
+                [] (const auto& mapping) { return mapping.first == mapping.second; });
+
+        mHasState = true;
+        mHasPendingSaveState = true;
+        mPendingSaveStateFormat = format;
+        mPendingSaveStateContentFileMap = std::move (contentFileMap);
+
+        if (mState == State_Loaded)
+            applyPendingSaveState();
+        else if (mState == State_Preloaded)
+        {
+            // The ID list was built before the state arrived; add the saved IDs.
+            listSaveStateIds();
+            std::sort (mIds.begin(), mIds.end());
+        }
+    }
+
     bool CellStore::hasId (const std::string& id) const
     {
         if (mState==State_Unloaded)
@@ -444,6 +523,8 @@ namespace MWWorld
 
     Ptr CellStore::searchViaActorId (int id)
     {
+        mSerializedStateValid = false;
+
         if (Ptr ptr = ::searchViaActorId (mNpcs, id, this, mMovedToAnotherCell))
             return ptr;
 
@@ -499,6 +580,7 @@ namespace MWWorld
     {
         mWaterLevel = level;
         mHasState = true;
+        mSerializedStateValid = false;
     }
 
     std::size_t CellStore::count() const
@@ -510,12 +592,17 @@ namespace MWWorld
     {
         if (mState!=State_Loaded)
         {
+            mSerializedStateValid = false;
+
             if (mState==State_Preloaded)
                 mIds.clear();
 
             loadRefs ();
 
             mState = State_Loaded;
+
+            if (mHasPendingSaveState)
+                applyPendingSaveState();
         }
     }
 
@@ -535,7 +622,7 @@ namespace MWWorld
 
         assert (mCell);
 
-        if (mCell->mContextList.empty())
+        if (mCell->mContextList.empty() && !mHasPendingSaveState)
             return; // this is a dynamically generated cell -> skipping.
 
         // Load references from all plugins that do something with this cell.
@@ -583,9 +670,76 @@ namespace MWWorld
                 mIds.push_back(Misc::StringUtils::lowerCase(ref.mRefID));
         }
 
+        if (mHasPendingSaveState)
+            listSaveStateIds();
+
         std::sort (mIds.begin(), mIds.end());
     }
 
+    void CellStore::listSaveStateIds()
+    {
+        // The saved state may introduce references that do not exist in the content
+        // files (e.g. items dropped by the player), so their IDs have to show up in
+        // the preload list as well. Only scan for the ID subrecords instead of fully
+        // parsing the object states; this can pick up IDs from container contents
+        // too, but such a false positive merely costs an unneeded cell load if
+        // someone searches for that ID.
+        try
+        {
+            ESM::ESMReader reader;
+            reader.openRaw (std::make_shared<std::istringstream> (mSerializedState), "saved game cell state");
+            reader.setFormat (mPendingSaveStateFormat);
+            reader.getRecName();
+            reader.getRecHeader();
+
+            while (reader.hasMoreSubs())
+            {
+                reader.getSubName();
+                if (reader.retSubName() == "NAME")
+                    mIds.push_back (Misc::StringUtils::lowerCase (reader.getHString()));
+                else
+                    reader.skipHSub();
+            }
+        }
+        catch (std::exception& e)
+        {
+            Log(Debug::Error) << "An error occurred listing references from the saved state of cell " << getCell()->getDescription() << ": " << e.what();
+        }
+    }
+
+    void CellStore::applyPendingSaveState()
+    {
+        // Clear the flag before parsing: resolving moved references below can load
+        // other cells, which in turn may look at this one again.
+        mHasPendingSaveState = false;
+
+        try
+        {
+            ESM::ESMReader reader;
+            reader.openRaw (std::make_shared<std::istringstream> (mSerializedState), "saved game cell state");
+            reader.setFormat (mPendingSaveStateFormat);
+            reader.getRecName();
+            reader.getRecHeader();
+
+            ESM::CellState state;
+            state.mId.load (reader);
+            state.load (reader);
+            loadState (state);
+
+            if (state.mHasFogOfWar)
+                readFog (reader);
+
+            WorldGetCellStoreCallback callback;
+            readReferences (reader, *mPendingSaveStateContentFileMap, &callback);
+        }
+        catch (std::exception& e)
+        {
+            Log(Debug::Error) << "An error occurred applying the saved state of cell " << getCell()->getDescription() << ": " << e.what();
+        }
+
+        mPendingSaveStateContentFileMap.reset();
+    }
+
     void CellStore::loadRefs()
     {
         std::vector<ESM::ESMReader>& esm = mReader;
@@ -596,6 +750,9 @@ namespace MWWorld
             return; // this is a dynamically generated cell -> skipping.
 
         std::map<ESM::RefNum, std::string> refNumToID; // used to detect refID modifications
+        // A later content file can only modify a refID if more than one file provides
+        // references for this cell; with a single source, skip tracking every refNum
+        const bool trackRefNums = mCell->mContextList.size() > 1 || !mCell->mLeasedRefs.empty();
 
         // Load references from all plugins that do something with this cell.
         for (size_t i = 0; i < mCell->mContextList.size(); i++)
@@ -626,7 +783,7 @@ namespace MWWorld
                         continue;
                     }
 
-                    loadRef (ref, deleted, refNumToID);
+                    loadRef (ref, deleted, trackRefNums ? &refNumToID : nullptr);
                 }
             }
             catch (std::exception& e)
@@ -641,7 +798,7 @@ namespace MWWorld
             ESM::CellRef &ref = const_cast<ESM::CellRef&>(leasedRef.first);
             bool deleted = leasedRef.second;
 
-            loadRef (ref, deleted, refNumToID);
+            loadRef (ref, deleted, trackRefNums ? &refNumToID : nullptr);
         }
 
         updateMergedRefs();
@@ -657,6 +814,7 @@ namespace MWWorld
         bool oldState = mHasState;
 
         mHasState = true;
+        mSerializedStateValid = false;
 
         if (Ptr ptr = searchInContainerList (mContainers, id))
             return ptr;
@@ -672,14 +830,14 @@ namespace MWWorld
         return Ptr();
     }
 
-    void CellStore::loadRef (ESM::CellRef& ref, bool deleted, std::map<ESM::RefNum, std::string>& refNumToID)
+    void CellStore::loadRef (ESM::CellRef& ref, bool deleted, std::map<ESM::RefNum, std::string>* refNumToID)
     {
         Misc::StringUtils::lowerCaseInPlace (ref.mRefID);
 
         const MWWorld::ESMStore& store = mStore;
 
-        std::map<ESM::RefNum, std::string>::iterator it = refNumToID.find(ref.mRefNum);
-        if (it != refNumToID.end())
+        std::map<ESM::RefNum, std::string>::iterator it;
+        if (refNumToID && (it = refNumToID->find(ref.mRefNum)) != refNumToID->end())
         {
             if (it->second != ref.mRefID)
             {
@@ -748,12 +906,14 @@ namespace MWWorld
                 return;
         }
 
-        refNumToID[ref.mRefNum] = ref.mRefID;
+        if (refNumToID)
+            (*refNumToID)[ref.mRefNum] = ref.mRefID;
     }
 
     void CellStore::loadState (const ESM::CellState& state)
     {
         mHasState = true;
+        mSerializedStateValid = false;
 
         if (mCell->mData.mFlags & ESM::Cell::Interior && mCell->mData.mFlags & ESM::Cell::HasWater)
             mWaterLevel = state.mWaterLevel;
@@ -823,6 +983,7 @@ namespace MWWorld
     void CellStore::readReferences (ESM::ESMReader& reader, const std::map<int, int>& contentFileMap, GetCellStoreCallback* callback)
     {
         mHasState = true;
+        mSerializedStateValid = false;
 
         while (reader.isNextSub ("OBJE"))
         {
@@ -1021,6 +1182,7 @@ namespace MWWorld
 
     void CellStore::setFog(ESM::FogState *fog)
     {
+        mSerializedStateValid = false;
         mFogState.reset(fog);
     }
 
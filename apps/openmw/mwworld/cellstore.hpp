@@ -71,6 +71,23 @@ namespace MWWorld
             const ESM::Cell *mCell;
             State mState;
             bool mHasState;
+
+            // Serialized copy of this cell from the last save (see Cells::writeCell).
+            // Every path that hands out mutable references or changes cell state
+            // invalidates it, so a save only needs to re-serialize cells that could
+            // have changed since the previous save. False positives merely cost a
+            // re-serialization; a missed invalidation would write stale state, so
+            // invalidation errs on the conservative side.
+            std::string mSerializedState;
+            bool mSerializedStateValid;
+
+            // Saved game state for this cell that has not been parsed yet. The raw
+            // record bytes are shared with mSerializedState; they are applied when
+            // the cell is first loaded (see setPendingSaveState).
+            bool mHasPendingSaveState;
+            int mPendingSaveStateFormat;
+            std::shared_ptr<const std::map<int, int>> mPendingSaveStateContentFileMap;
+
             std::vector<std::string> mIds;
             float mWaterLevel;
 
@@ -204,6 +221,7 @@ namespace MWWorld
             LiveCellRefBase* insert(const LiveCellRef<T>* ref)
             {
                 mHasState = true;
+                mSerializedStateValid = false;
                 CellRefList<T>& list = get<T>();
                 LiveCellRefBase* ret = &list.insert(*ref);
                 updateMergedRefs();
@@ -225,6 +243,26 @@ namespace MWWorld
             bool hasState() const;
             ///< Does this cell have state that needs to be stored in a saved game file?
 
+            bool hasValidSerializedState() const;
+            ///< Is the cached serialized form of this cell still up to date?
+
+            const std::string& getSerializedState() const;
+            ///< Get the serialized form of this cell from the last save. Only valid if hasValidSerializedState() returns true.
+
+            void setSerializedState (std::string state);
+            ///< Store the serialized form of this cell written by the current save.
+
+            void invalidateSerializedState();
+            ///< Discard the cached serialized form of this cell.
+
+            void setPendingSaveState (std::string state, int format,
+                std::shared_ptr<const std::map<int, int>> contentFileMap);
+            ///< Hand over this cell's state from a loaded save (a raw cell state record)
+            /// to be applied when the cell is first loaded. The bytes double as the
+            /// serialized state, so a cell that is never loaded again is written back
+            /// to the next save verbatim.
+            /// \param format Format version of the save file the record came from.
+
             bool hasId (const std::string& id) const;
             ///< May return true for deleted IDs when in preload state. Will return false, if cell is
             /// unloaded.
@@ -284,6 +322,7 @@ namespace MWWorld
                     return true;
 
                 mHasState = true;
+                mSerializedStateValid = false;
 
                 for (unsigned int i=0; i<mMergedRefs.size(); ++i)
                 {
@@ -334,6 +373,7 @@ namespace MWWorld
                     return true;
 
                 mHasState = true;
+                mSerializedStateValid = false;
 
                 CellRefList<T>& list = get<T>();
 
@@ -402,10 +442,18 @@ namespace MWWorld
             /// Run through references and store IDs
             void listRefs();
 
+            /// Add the IDs of references the pending saved game state introduces.
+            void listSaveStateIds();
+
+            /// Parse the pending saved game state into this cell. Must be loaded.
+            void applyPendingSaveState();
+
             void loadRefs();
 
-            void loadRef (ESM::CellRef& ref, bool deleted, std::map<ESM::RefNum, std::string>& refNumToID);
+            void loadRef (ESM::CellRef& ref, bool deleted, std::map<ESM::RefNum, std::string>* refNumToID);
             ///< Make case-adjustments to \a ref and insert it into the respective container.
+            /// \a refNumToID is used to detect refID modifications between content files and
+            /// may be null when only a single content file provides references for this cell.
             ///
             /// Invalid \a ref objects are silently dropped.
     };
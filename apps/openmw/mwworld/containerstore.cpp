@@ -15,6 +15,7 @@
 #include "../mwmechanics/actorutil.hpp"
 #include "../mwmechanics/recharge.hpp"
 
+#include "esmstore.hpp"
 #include "manualref.hpp"
 #include "refdata.hpp"
 #include "class.hpp"
@@ -52,25 +53,6 @@ namespace
         return sum;
     }
 
-    template<typename T>
-    MWWorld::Ptr searchId (MWWorld::CellRefList<T>& list, const std::string& id,
-        MWWorld::ContainerStore *store)
-    {
-        store->resolve();
-        std::string id2 = Misc::StringUtils::lowerCase (id);
-
-        for (auto& iter : list.mList)
-        {
-            if (Misc::StringUtils::ciEqual(iter.mBase->mId, id2) && iter.mData.getCount())
-            {
-                MWWorld::Ptr ptr (&iter, nullptr);
-                ptr.setContainerStore (store);
-                return ptr;
-            }
-        }
-
-        return MWWorld::Ptr();
-    }
 }
 
 MWWorld::ResolutionListener::~ResolutionListener()
@@ -101,6 +83,7 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::getState (CellRefList<T
     LiveCellRef<T> ref (record);
     ref.load (state);
     collection.mList.push_back (ref);
+    mIdIndex.mUpToDate = false;
 
     return ContainerStoreIterator (this, --collection.mList.end());
 }
@@ -180,12 +163,30 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::end()
     return ContainerStoreIterator (this);
 }
 
+const std::vector<MWWorld::ContainerStoreIterator>* MWWorld::ContainerStore::getIndexedStacks (const std::string& id) const
+{
+    if (!mIdIndex.mUpToDate)
+    {
+        mIdIndex.mBuckets.clear();
+        // Building iterators requires a mutable store; the rebuild itself only reads from it.
+        ContainerStore *self = const_cast<ContainerStore *> (this);
+        for (ContainerStoreIterator iter (self->begin()); iter != self->end(); ++iter)
+            mIdIndex.mBuckets[iter->getCellRef().getRefIdRef()].push_back (iter);
+        mIdIndex.mUpToDate = true;
+    }
+
+    const auto it = mIdIndex.mBuckets.find (id);
+    if (it == mIdIndex.mBuckets.end())
+        return nullptr;
+    return &it->second;
+}
+
 int MWWorld::ContainerStore::count(const std::string &id) const
 {
     int total=0;
-    for (const auto&& iter : *this)
-        if (Misc::StringUtils::ciEqual(iter.getCellRef().getRefIdRef(), id))
-            total += iter.getRefData().getCount();
+    if (const std::vector<ContainerStoreIterator>* stacks = getIndexedStacks (id))
+        for (const ContainerStoreIterator& iter : *stacks)
+            total += iter->getRefData().getCount();
     return total;
 }
 
@@ -219,19 +220,24 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::restack(const MWWorld::
 {
     resolve();
     MWWorld::ContainerStoreIterator retval = end();
-    for (MWWorld::ContainerStoreIterator iter (begin()); iter != end(); ++iter)
+    const std::vector<ContainerStoreIterator>* candidates = getIndexedStacks (item.getCellRef().getRefIdRef());
+
+    if (candidates)
     {
-        if (item == *iter)
+        for (const ContainerStoreIterator& iter : *candidates)
         {
-            retval = iter;
-            break;
+            if (item == *iter)
+            {
+                retval = iter;
+                break;
+            }
         }
     }
 
     if (retval == end())
         throw std::runtime_error("item is not from this container");
 
-    for (MWWorld::ContainerStoreIterator iter (begin()); iter != end(); ++iter)
+    for (const ContainerStoreIterator& iter : *candidates)
     {
         if (stacks(*iter, item))
         {
@@ -362,30 +368,31 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::addImp (const Ptr& ptr,
     {
         int realCount = count * ptr.getClass().getValue(ptr);
 
-        for (MWWorld::ContainerStoreIterator iter (begin(type)); iter!=end(); ++iter)
+        if (const std::vector<ContainerStoreIterator>* goldStacks = getIndexedStacks (MWWorld::ContainerStore::sGoldId))
         {
-            if (Misc::StringUtils::ciEqual(iter->getCellRef().getRefIdRef(), MWWorld::ContainerStore::sGoldId))
-            {
-                iter->getRefData().setCount(addItems(iter->getRefData().getCount(false), realCount));
-                flagAsModified();
-                return iter;
-            }
+            ContainerStoreIterator iter = goldStacks->front();
+            iter->getRefData().setCount(addItems(iter->getRefData().getCount(false), realCount));
+            flagAsModified();
+            return iter;
         }
 
         MWWorld::ManualRef ref(esmStore, MWWorld::ContainerStore::sGoldId, realCount);
         return addNewStack(ref.getPtr(), realCount);
     }
 
-    // determine whether to stack or not
-    for (MWWorld::ContainerStoreIterator iter (begin(type)); iter!=end(); ++iter)
+    // determine whether to stack or not. Only stacks with the same ID can qualify (see stacks()).
+    if (const std::vector<ContainerStoreIterator>* candidates = getIndexedStacks (ptr.getCellRef().getRefIdRef()))
     {
-        if (stacks(*iter, ptr))
+        for (ContainerStoreIterator iter : *candidates)
         {
-            // stack
-            iter->getRefData().setCount(addItems(iter->getRefData().getCount(false), count));
+            if (stacks(*iter, ptr))
+            {
+                // stack
+                iter->getRefData().setCount(addItems(iter->getRefData().getCount(false), count));
 
-            flagAsModified();
-            return iter;
+                flagAsModified();
+                return iter;
+            }
         }
     }
     // if we got here, this means no stacking
@@ -464,9 +471,18 @@ int MWWorld::ContainerStore::remove(const std::string& itemId, int count, const
         resolve();
     int toRemove = count;
 
-    for (ContainerStoreIterator iter(begin()); iter != end() && toRemove > 0; ++iter)
-        if (Misc::StringUtils::ciEqual(iter->getCellRef().getRefIdRef(), itemId))
+    if (const std::vector<ContainerStoreIterator>* stacks = getIndexedStacks (itemId))
+    {
+        // Copy the bucket: remove() below can trigger listeners that modify the store
+        // and cause the index to be rebuilt under us.
+        const std::vector<ContainerStoreIterator> stacksCopy = *stacks;
+        for (const ContainerStoreIterator& iter : stacksCopy)
+        {
+            if (toRemove <= 0)
+                break;
             toRemove -= remove(*iter, toRemove, actor, equipReplacement, resolveFirst);
+        }
+    }
 
     flagAsModified();
 
@@ -607,6 +623,7 @@ void MWWorld::ContainerStore::flagAsModified()
 {
     mWeightUpToDate = false;
     mRechargingItemsUpToDate = false;
+    mIdIndex.mUpToDate = false;
 }
 
 bool MWWorld::ContainerStore::isResolved() const
@@ -737,11 +754,13 @@ MWWorld::Ptr MWWorld::ContainerStore::findReplacement(const std::string& id)
 {
     MWWorld::Ptr item;
     int itemHealth = 1;
-    for (auto&& iter : *this)
+    if (const std::vector<ContainerStoreIterator>* stacks = getIndexedStacks (id))
     {
-        int iterHealth = iter.getClass().hasItemHealth(iter) ? iter.getClass().getItemHealth(iter) : 1;
-        if (Misc::StringUtils::ciEqual(iter.getCellRef().getRefIdRef(), id))
+        for (const ContainerStoreIterator& it : *stacks)
         {
+            const Ptr iter = *it;
+            int iterHealth = iter.getClass().hasItemHealth(iter) ? iter.getClass().getItemHealth(iter) : 1;
+
             // Prefer the stack with the lowest remaining uses
             // Try to get item with zero durability only if there are no other items found
             if (item.isEmpty() ||
@@ -760,77 +779,11 @@ MWWorld::Ptr MWWorld::ContainerStore::findReplacement(const std::string& id)
 MWWorld::Ptr MWWorld::ContainerStore::search (const std::string& id)
 {
     resolve();
-    {
-        Ptr ptr = searchId (potions, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
 
-    {
-        Ptr ptr = searchId (appas, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (armors, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (books, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (clothes, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (ingreds, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (lights, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (lockpicks, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (miscItems, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (probes, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (repairs, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (weapons, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
+    if (const std::vector<ContainerStoreIterator>* stacks = getIndexedStacks (id))
+        for (const ContainerStoreIterator& iter : *stacks)
+            if (iter->getRefData().getCount())
+                return *iter;
 
     return Ptr();
 }
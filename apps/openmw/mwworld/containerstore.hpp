@@ -5,6 +5,7 @@
 #include <map>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <components/esm/loadalch.hpp>
 #include <components/esm/loadappa.hpp>
@@ -20,6 +21,7 @@
 #include <components/esm/loadweap.hpp>
 
 #include <components/misc/rng.hpp>
+#include <components/misc/stringops.hpp>
 
 #include "ptr.hpp"
 #include "cellreflist.hpp"
@@ -119,6 +121,25 @@ namespace MWWorld
             mutable float mCachedWeight;
             mutable bool mWeightUpToDate;
 
+            // Lazily built map from item ID to every stack with that ID, so that ID
+            // lookups (count, search, remove, stacking) do not have to scan all twelve
+            // CellRefLists. Stacks are never erased from the lists, only zeroed, so the
+            // iterators stay valid until the next rebuild. The iterators would point
+            // into another store after a copy, so copying resets the cache instead.
+            struct IdIndex
+            {
+                std::map<std::string, std::vector<ContainerStoreIterator>, Misc::StringUtils::CiComp> mBuckets;
+                bool mUpToDate = false;
+
+                IdIndex() = default;
+                IdIndex(const IdIndex&) {}
+                IdIndex& operator=(const IdIndex&) { mBuckets.clear(); mUpToDate = false; return *this; }
+            };
+            mutable IdIndex mIdIndex;
+
+            /// Rebuild mIdIndex if needed and return the stacks holding \a id, or nullptr if there are none.
+            const std::vector<ContainerStoreIterator>* getIndexedStacks (const std::string& id) const;
+
             bool mModified;
             bool mResolved;
             unsigned int mSeed;
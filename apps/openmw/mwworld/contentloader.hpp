@@ -27,6 +27,13 @@ struct ContentLoader
         mListener.setLabel(MyGUI::TextIterator::toTagsString(filepath.string()));
     }
 
+    /// Called with the path of an upcoming file before the preceding one is
+    /// loaded. Loaders may use this to start reading ahead on a worker thread;
+    /// the default implementation does nothing.
+    virtual void prefetch(const boost::filesystem::path& filepath)
+    {
+    }
+
     protected:
         Loading::Listener& mListener;
 };
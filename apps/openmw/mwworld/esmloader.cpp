@@ -2,6 +2,7 @@
 #include "esmstore.hpp"
 
 #include <components/esm/esmreader.hpp>
+#include <components/files/mappedfilestream.hpp>
 
 namespace MWWorld
 {
@@ -15,6 +16,34 @@ EsmLoader::EsmLoader(MWWorld::ESMStore& store, std::vector<ESM::ESMReader>& read
 {
 }
 
+EsmLoader::~EsmLoader()
+{
+    if (mPrefetch.valid())
+        mPrefetch.wait();
+}
+
+void EsmLoader::prefetch(const boost::filesystem::path& filepath)
+{
+    // One request deep is enough: the next file is warmed while the current
+    // one is parsed and merged. Assigning the future joins any still-running
+    // worker first, which throttles the read-ahead to the merge rate.
+    const std::string path = filepath.string();
+    mPrefetch = std::async(std::launch::async, [path]
+    {
+        try
+        {
+            Files::IStreamPtr stream = Files::openMappedFileStream(path.c_str());
+            char buf[4096];
+            while (stream->read(buf, sizeof(buf)))
+                ;
+        }
+        catch (std::exception&)
+        {
+            // load() will report the error with proper context
+        }
+    });
+}
+
 void EsmLoader::load(const boost::filesystem::path& filepath, int& index)
 {
   ContentLoader::load(filepath.filename(), index);
@@ -1,6 +1,7 @@
 #ifndef ESMLOADER_HPP
 #define ESMLOADER_HPP
 
+#include <future>
 #include <vector>
 
 #include "contentloader.hpp"
@@ -25,12 +26,19 @@ struct EsmLoader : public ContentLoader
     EsmLoader(MWWorld::ESMStore& store, std::vector<ESM::ESMReader>& readers,
       ToUTF8::Utf8Encoder* encoder, Loading::Listener& listener);
 
+    ~EsmLoader();
+
     void load(const boost::filesystem::path& filepath, int& index) override;
 
+    /// Start reading the given file into the OS cache on a worker thread, so
+    /// its pages are warm by the time load() parses it.
+    void prefetch(const boost::filesystem::path& filepath) override;
+
     private:
       std::vector<ESM::ESMReader>& mEsm;
       MWWorld::ESMStore& mStore;
       ToUTF8::Utf8Encoder* mEncoder;
+      std::future<void> mPrefetch;
 };
 
 } /* namespace MWWorld */
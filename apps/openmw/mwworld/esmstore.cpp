@@ -1,16 +1,22 @@
 #include "esmstore.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <set>
+#include <thread>
 
 #include <boost/filesystem/operations.hpp>
 
+#include <osg/Timer>
+
 #include <components/debug/debuglog.hpp>
+#include <components/debug/memorytracking.hpp>
 #include <components/loadinglistener/loadinglistener.hpp>
 #include <components/esm/esmreader.hpp>
 #include <components/esm/esmwriter.hpp>
 #include <components/misc/algorithm.hpp>
 
+#include "../mwmechanics/levelledlist.hpp"
 #include "../mwmechanics/spelllist.hpp"
 
 namespace
@@ -59,7 +65,7 @@ namespace
         }
     }
 
-    std::vector<ESM::NPC> getNPCsToReplace(const MWWorld::Store<ESM::Faction>& factions, const MWWorld::Store<ESM::Class>& classes, const std::map<std::string, ESM::NPC>& npcs)
+    std::vector<ESM::NPC> getNPCsToReplace(const MWWorld::Store<ESM::Faction>& factions, const MWWorld::Store<ESM::Class>& classes, const std::map<std::string, ESM::NPC, Misc::StringUtils::CiComp>& npcs)
     {
         // Cache first class from store - we will use it if current class is not found
         std::string defaultCls;
@@ -113,7 +119,7 @@ namespace
     // Custom enchanted items can reference scripts that no longer exist, this doesn't necessarily mean the base item no longer exists however.
     // So instead of removing the item altogether, we're only removing the script.
     template<class T>
-    void removeMissingScripts(const MWWorld::Store<ESM::Script>& scripts, std::map<std::string, T>& items)
+    void removeMissingScripts(const MWWorld::Store<ESM::Script>& scripts, std::map<std::string, T, Misc::StringUtils::CiComp>& items)
     {
         for(auto& [id, item] : items)
         {
@@ -145,10 +151,17 @@ static bool isCacheableRecord(int id)
 
 void ESMStore::load(ESM::ESMReader &esm, Loading::Listener* listener)
 {
+    Debug::ScopedMemoryDomain memoryDomain(Debug::MemoryDomain::Store);
+
     listener->setProgressRange(1000);
 
     ESM::Dialogue *dialogue = nullptr;
 
+    // Info merging used to degenerate on load orders where many plugins touch the
+    // same topics; keep a per-file metric around so regressions show up in the log.
+    double infoMergeDuration = 0;
+    std::size_t infoCount = 0;
+
     // Land texture loading needs to use a separate internal store for each plugin.
     // We set the number of plugins here to avoid continual resizes during loading,
     // and so we can properly verify if valid plugin indices are being passed to the
@@ -166,7 +179,7 @@ void ESMStore::load(ESM::ESMReader &esm, Loading::Listener* listener)
         std::string fname = mast.name;
         int index = ~0;
         for (int i = 0; i < esm.getIndex(); i++) {
-            const std::string candidate = allPlugins->at(i).getContext().filename;
+            const std::string& candidate = allPlugins->at(i).getName();
             std::string fnamecandidate = boost::filesystem::path(candidate).filename().string();
             if (Misc::StringUtils::ciEqual(fname, fnamecandidate)) {
                 index = i;
@@ -196,7 +209,10 @@ void ESMStore::load(ESM::ESMReader &esm, Loading::Listener* listener)
             if (n.intval == ESM::REC_INFO) {
                 if (dialogue)
                 {
+                    const osg::Timer_t start = osg::Timer::instance()->tick();
                     dialogue->readInfo(esm, esm.getIndex() != 0);
+                    infoMergeDuration += osg::Timer::instance()->delta_s(start, osg::Timer::instance()->tick());
+                    ++infoCount;
                 }
                 else
                 {
@@ -232,23 +248,52 @@ void ESMStore::load(ESM::ESMReader &esm, Loading::Listener* listener)
         }
         listener->setProgress(static_cast<size_t>(esm.getFileOffset() / (float)esm.getFileSize() * 1000));
     }
+
+    if (infoCount > 0)
+        Log(Debug::Verbose) << "Merged " << infoCount << " dialogue infos from '" << esm.getName()
+            << "' in " << 1000.0 * infoMergeDuration << " ms";
 }
 
 void ESMStore::setUp(bool validateRecords)
 {
     mIds.clear();
 
-    std::map<int, StoreBase *>::iterator storeIt = mStores.begin();
-    for (; storeIt != mStores.end(); ++storeIt) {
-        storeIt->second->setUp();
+    // The stores don't depend on each other at this point (the dialogue/info merging that does
+    // order has already happened during load), so their setUp - sorting the shared lists,
+    // cleaning up dialogue infos - is fanned out over the available cores.
+    {
+        std::vector<StoreBase*> stores;
+        stores.reserve(mStores.size());
+        for (const auto& [recName, store] : mStores)
+            stores.push_back(store);
+
+        std::atomic<std::size_t> nextStore {0};
+        const auto worker = [&]
+        {
+            for (std::size_t i = nextStore++; i < stores.size(); i = nextStore++)
+                stores[i]->setUp();
+        };
+
+        const std::size_t numThreads = std::min<std::size_t>(stores.size(),
+            std::max<std::size_t>(1, std::thread::hardware_concurrency()));
+        std::vector<std::thread> threads;
+        for (std::size_t i = 1; i < numThreads; ++i)
+            threads.emplace_back(worker);
+        worker();
+        for (std::thread& thread : threads)
+            thread.join();
+    }
 
-        if (isCacheableRecord(storeIt->first))
+    // mIds is a single shared map, so the identifier lists are merged serially
+    for (const auto& [recName, store] : mStores)
+    {
+        if (isCacheableRecord(recName))
         {
             std::vector<std::string> identifiers;
-            storeIt->second->listIdentifier(identifiers);
+            store->listIdentifier(identifiers);
 
-            for (std::vector<std::string>::const_iterator record = identifiers.begin(); record != identifiers.end(); ++record)
-                mIds[*record] = storeIt->first;
+            for (const std::string& record : identifiers)
+                mIds[record] = recName;
         }
     }
 
@@ -258,7 +303,13 @@ void ESMStore::setUp(bool validateRecords)
     mSkills.setUp();
     mMagicEffects.setUp();
     mAttributes.setUp();
-    mDialogs.setUp();
+
+    // Flatten the levelled lists up front; respawn ticks resolve them in bulk and
+    // shouldn't pay for the first build.
+    for (auto it = mItemLists.begin(); it != mItemLists.end(); ++it)
+        getLevelledListTables(&*it, false);
+    for (auto it = mCreatureLists.begin(); it != mCreatureLists.end(); ++it)
+        getLevelledListTables(&*it, true);
 
     if (validateRecords)
     {
@@ -514,4 +565,24 @@ void ESMStore::removeMissingObjects(Store<T>& store)
         }
         return {ptr, true};
     }
+
+    std::shared_ptr<const MWMechanics::FlattenedLevelledList> ESMStore::getLevelledListTables(const ESM::LevelledListBase* list, bool creature) const
+    {
+        // Changing any levelled list invalidates the tables of every list nesting it,
+        // so they are all dropped (AddToLevItem and the like are rare events).
+        const std::size_t revision = mItemLists.getRevision() + mCreatureLists.getRevision();
+        if (revision != mLevelledListRevision)
+        {
+            mLevelledListCache.clear();
+            mLevelledListRevision = revision;
+        }
+
+        const std::string key = (creature ? "c:" : "i:") + Misc::StringUtils::lowerCase(list->mId);
+        auto it = mLevelledListCache.find(key);
+        if (it != mLevelledListCache.end())
+            return it->second;
+        std::shared_ptr<const MWMechanics::FlattenedLevelledList> tables = MWMechanics::flattenLevelledList(*this, list, creature);
+        mLevelledListCache.emplace(key, tables);
+        return tables;
+    }
 } // end namespace
@@ -17,6 +17,7 @@ namespace Loading
 namespace MWMechanics
 {
     class SpellList;
+    struct FlattenedLevelledList;
 }
 
 namespace MWWorld
@@ -85,6 +86,11 @@ namespace MWWorld
 
         mutable std::map<std::string, std::weak_ptr<MWMechanics::SpellList> > mSpellListCache;
 
+        // Flattened levelled list resolution tables (see MWMechanics::FlattenedLevelledList),
+        // cleared whenever a levelled list record changes (tracked via the store revisions)
+        mutable std::unordered_map<std::string, std::shared_ptr<const MWMechanics::FlattenedLevelledList> > mLevelledListCache;
+        mutable std::size_t mLevelledListRevision = 0;
+
         /// Validate entries in store after setup
         void validate();
 
@@ -229,6 +235,7 @@ namespace MWWorld
                     mIds[ptr->mId] = it->first;
                 }
             }
+
             return ptr;
         }
 
@@ -268,12 +275,23 @@ namespace MWWorld
         // To be called when we are done with dynamic record loading
         void checkPlayer();
 
+        /// Monotonically increasing count of dynamic records created so far.
+        /// Lets identifier consumers (e.g. console completion) detect lazily
+        /// that their view of the store went stale.
+        unsigned int getDynamicCount() const {
+            return mDynamicCount;
+        }
+
         /// @return The number of instances defined in the base files. Excludes changes from the save file.
         int getRefCount(const std::string& id) const;
 
         /// Actors with the same ID share spells, abilities, etc.
         /// @return The shared spell list to use for this actor and whether or not it has already been initialized.
         std::pair<std::shared_ptr<MWMechanics::SpellList>, bool> getSpellList(const std::string& id) const;
+
+        /// Flattened resolution tables for the given levelled list; built at setUp (or on
+        /// first use for dynamic lists) and cached until a levelled list record changes.
+        std::shared_ptr<const MWMechanics::FlattenedLevelledList> getLevelledListTables(const ESM::LevelledListBase* list, bool creature) const;
     };
 
     template <>
@@ -10,56 +10,74 @@
 
 namespace MWWorld
 {
-    Globals::Collection::const_iterator Globals::find (const std::string& name) const
+    const ESM::Global& Globals::find (const std::string& name) const
     {
-        Collection::const_iterator iter = mVariables.find (Misc::StringUtils::lowerCase (name));
+        std::map<std::string, std::size_t>::const_iterator iter =
+            mIndexes.find (Misc::StringUtils::lowerCase (name));
 
-        if (iter==mVariables.end())
+        if (iter==mIndexes.end())
             throw std::runtime_error ("unknown global variable: " + name);
 
-        return iter;
+        return mVariables[iter->second];
     }
 
-    Globals::Collection::iterator Globals::find (const std::string& name)
+    ESM::Global& Globals::find (const std::string& name)
     {
-        Collection::iterator iter = mVariables.find (Misc::StringUtils::lowerCase (name));
+        std::map<std::string, std::size_t>::const_iterator iter =
+            mIndexes.find (Misc::StringUtils::lowerCase (name));
 
-        if (iter==mVariables.end())
+        if (iter==mIndexes.end())
             throw std::runtime_error ("unknown global variable: " + name);
 
-        return iter;
+        return mVariables[iter->second];
     }
 
     void Globals::fill (const MWWorld::ESMStore& store)
     {
         mVariables.clear();
+        mIndexes.clear();
 
         const MWWorld::Store<ESM::Global>& globals = store.get<ESM::Global>();
 
         for (const ESM::Global& esmGlobal : globals)
         {
-            mVariables.insert (std::make_pair (Misc::StringUtils::lowerCase (esmGlobal.mId), esmGlobal));
+            ESM::Global global (esmGlobal);
+            Misc::StringUtils::lowerCaseInPlace (global.mId);
+
+            mIndexes.insert (std::make_pair (global.mId, mVariables.size()));
+            mVariables.push_back (global);
         }
     }
 
     const ESM::Variant& Globals::operator[] (const std::string& name) const
     {
-        return find (Misc::StringUtils::lowerCase (name))->second.mValue;
+        return find (name).mValue;
     }
 
     ESM::Variant& Globals::operator[] (const std::string& name)
     {
-        return find (Misc::StringUtils::lowerCase (name))->second.mValue;
+        return find (name).mValue;
+    }
+
+    const ESM::Variant& Globals::operator[] (int index) const
+    {
+        return mVariables.at (index).mValue;
+    }
+
+    ESM::Variant& Globals::operator[] (int index)
+    {
+        return mVariables.at (index).mValue;
     }
 
     char Globals::getType (const std::string& name) const
     {
-        Collection::const_iterator iter = mVariables.find (Misc::StringUtils::lowerCase (name));
+        std::map<std::string, std::size_t>::const_iterator iter =
+            mIndexes.find (Misc::StringUtils::lowerCase (name));
 
-        if (iter==mVariables.end())
+        if (iter==mIndexes.end())
             return ' ';
 
-        switch (iter->second.mValue.getType())
+        switch (mVariables[iter->second].mValue.getType())
         {
             case ESM::VT_Short: return 's';
             case ESM::VT_Long: return 'l';
@@ -69,6 +87,22 @@ namespace MWWorld
         }
     }
 
+    int Globals::searchIndex (const std::string& name) const
+    {
+        std::map<std::string, std::size_t>::const_iterator iter =
+            mIndexes.find (Misc::StringUtils::lowerCase (name));
+
+        if (iter==mIndexes.end())
+            return -1;
+
+        return static_cast<int> (iter->second);
+    }
+
+    const std::string& Globals::getName (int index) const
+    {
+        return mVariables.at (index).mId;
+    }
+
     int Globals::countSavedGameRecords() const
     {
         return mVariables.size();
@@ -76,10 +110,10 @@ namespace MWWorld
 
     void Globals::write (ESM::ESMWriter& writer, Loading::Listener& progress) const
     {
-        for (Collection::const_iterator iter (mVariables.begin()); iter!=mVariables.end(); ++iter)
+        for (std::vector<ESM::Global>::const_iterator iter (mVariables.begin()); iter!=mVariables.end(); ++iter)
         {
             writer.startRecord (ESM::REC_GLOB);
-            iter->second.save (writer);
+            iter->save (writer);
             writer.endRecord (ESM::REC_GLOB);
         }
     }
@@ -96,9 +130,9 @@ namespace MWWorld
             global.load(reader, isDeleted);
             Misc::StringUtils::lowerCaseInPlace(global.mId);
 
-            Collection::iterator iter = mVariables.find (global.mId);
-            if (iter!=mVariables.end())
-                iter->second = global;
+            std::map<std::string, std::size_t>::const_iterator iter = mIndexes.find (global.mId);
+            if (iter!=mIndexes.end())
+                mVariables[iter->second] = global;
 
             return true;
         }
@@ -28,13 +28,12 @@ namespace MWWorld
     {
         private:
 
-            typedef std::map<std::string, ESM::Global> Collection;
+            std::vector<ESM::Global> mVariables; // type, value; id stored in lower case
+            std::map<std::string, std::size_t> mIndexes; // lower case name -> index into mVariables
 
-            Collection mVariables; // type, value
+            const ESM::Global& find (const std::string& name) const;
 
-            Collection::const_iterator find (const std::string& name) const;
-
-            Collection::iterator find (const std::string& name);
+            ESM::Global& find (const std::string& name);
 
         public:
 
@@ -42,9 +41,20 @@ namespace MWWorld
 
             ESM::Variant& operator[] (const std::string& name);
 
+            const ESM::Variant& operator[] (int index) const;
+
+            ESM::Variant& operator[] (int index);
+
             char getType (const std::string& name) const;
             ///< If there is no global variable with this name, ' ' is returned.
 
+            int searchIndex (const std::string& name) const;
+            ///< Return the index of the variable with this name or -1, if there is no such
+            /// variable. Indices are stable until the next call to fill().
+
+            const std::string& getName (int index) const;
+            ///< Return the (lower case) name of the variable with this index.
+
             void fill (const MWWorld::ESMStore& store);
             ///< Replace variables with variables from \a store with default values.
 
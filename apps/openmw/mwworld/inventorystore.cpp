@@ -101,6 +101,8 @@ MWWorld::InventoryStore::InventoryStore()
  , mInventoryListener(nullptr)
  , mUpdatesEnabled (true)
  , mFirstAutoEquip(true)
+ , mAutoEquipUpToDate(false)
+ , mSlotEffects(Slots)
  , mSelectedEnchantItem(end())
 {
     initSlots (mSlots);
@@ -112,7 +114,9 @@ MWWorld::InventoryStore::InventoryStore (const InventoryStore& store)
  , mInventoryListener(store.mInventoryListener)
  , mUpdatesEnabled(store.mUpdatesEnabled)
  , mFirstAutoEquip(store.mFirstAutoEquip)
+ , mAutoEquipUpToDate(false)
  , mPermanentMagicEffectMagnitudes(store.mPermanentMagicEffectMagnitudes)
+ , mSlotEffects(Slots) // the cache refers to items of the other store, recompute
  , mSelectedEnchantItem(end())
 {
     copySlots (store);
@@ -127,7 +131,9 @@ MWWorld::InventoryStore& MWWorld::InventoryStore::operator= (const InventoryStor
     mInventoryListener = store.mInventoryListener;
     mMagicEffects = store.mMagicEffects;
     mFirstAutoEquip = store.mFirstAutoEquip;
+    mAutoEquipUpToDate = false;
     mPermanentMagicEffectMagnitudes = store.mPermanentMagicEffectMagnitudes;
+    mSlotEffects.assign (Slots, SlotEffects()); // the cache refers to items of the other store, recompute
     mRechargingItemsUpToDate = false;
     ContainerStore::operator= (store);
     mSlots.clear();
@@ -525,6 +531,11 @@ void MWWorld::InventoryStore::autoEquipShield(const MWWorld::Ptr& actor, TSlots&
 
 void MWWorld::InventoryStore::autoEquip (const MWWorld::Ptr& actor)
 {
+    // The inventory has not changed since the last auto-equip, so scoring the items
+    // again would select the same equipment.
+    if (mAutoEquipUpToDate)
+        return;
+
     TSlots slots_;
     initSlots (slots_);
 
@@ -557,6 +568,15 @@ void MWWorld::InventoryStore::autoEquip (const MWWorld::Ptr& actor)
         updateMagicEffects(actor);
         flagAsModified();
     }
+
+    // Must be set after flagAsModified(), which clears it
+    mAutoEquipUpToDate = true;
+}
+
+void MWWorld::InventoryStore::flagAsModified()
+{
+    ContainerStore::flagAsModified();
+    mAutoEquipUpToDate = false;
 }
 
 MWWorld::ContainerStoreIterator MWWorld::InventoryStore::getPreferredShield(const MWWorld::Ptr& actor)
@@ -588,12 +608,30 @@ void MWWorld::InventoryStore::updateMagicEffects(const Ptr& actor)
     if (stats.isDead() && stats.isDeathAnimationFinished())
         return;
 
-    for (TSlots::const_iterator iter (mSlots.begin()); iter!=mSlots.end(); ++iter)
+    for (std::size_t slot=0; slot<mSlots.size(); ++slot)
     {
-        if (*iter==end())
+        SlotEffects& cache = mSlotEffects[slot];
+
+        if (mSlots[slot]==end())
+        {
+            cache.mItem = nullptr;
             continue;
+        }
 
-        std::string enchantmentId = (*iter)->getClass().getEnchantment (**iter);
+        MWWorld::Ptr item = *mSlots[slot];
+
+        if (cache.mItem == item.getBase())
+        {
+            // The slot holds the same item as during the last update, so its
+            // contribution has not changed.
+            mMagicEffects += cache.mEffects;
+            continue;
+        }
+
+        cache.mItem = item.getBase();
+        cache.mEffects = MWMechanics::MagicEffects();
+
+        std::string enchantmentId = item.getClass().getEnchantment (item);
 
         if (!enchantmentId.empty())
         {
@@ -605,7 +643,7 @@ void MWWorld::InventoryStore::updateMagicEffects(const Ptr& actor)
 
             std::vector<EffectParams> params;
 
-            bool existed = (mPermanentMagicEffectMagnitudes.find((**iter).getCellRef().getRefId()) != mPermanentMagicEffectMagnitudes.end());
+            bool existed = (mPermanentMagicEffectMagnitudes.find(item.getCellRef().getRefId()) != mPermanentMagicEffectMagnitudes.end());
             if (!existed)
             {
                 params.resize(enchantment.mEffects.mList.size());
@@ -626,10 +664,10 @@ void MWWorld::InventoryStore::updateMagicEffects(const Ptr& actor)
                 // Consider equipping the same item twice (e.g. a ring)
                 // However, permanent enchantments with a random magnitude are kind of an exploit anyway,
                 // so it doesn't really matter if both items will get the same magnitude. *Extreme* edge case.
-                mPermanentMagicEffectMagnitudes[(**iter).getCellRef().getRefId()] = params;
+                mPermanentMagicEffectMagnitudes[item.getCellRef().getRefId()] = params;
             }
             else
-                params = mPermanentMagicEffectMagnitudes[(**iter).getCellRef().getRefId()];
+                params = mPermanentMagicEffectMagnitudes[item.getCellRef().getRefId()];
 
             int i=0;
             for (const ESM::ENAMstruct& effect : enchantment.mEffects.mList)
@@ -657,11 +695,13 @@ void MWWorld::InventoryStore::updateMagicEffects(const Ptr& actor)
                 }
 
                 if (magnitude)
-                    mMagicEffects.add (effect, magnitude);
+                    cache.mEffects.add (effect, magnitude);
 
                 i++;
             }
         }
+
+        mMagicEffects += cache.mEffects;
     }
 
     // Now drop expired effects
@@ -778,6 +818,7 @@ MWWorld::ContainerStoreIterator MWWorld::InventoryStore::unequipSlot(int slot, c
 
         // empty this slot
         mSlots[slot] = end();
+        mAutoEquipUpToDate = false;
 
         if (it->getRefData().getCount())
         {
@@ -926,14 +967,20 @@ void MWWorld::InventoryStore::purgeEffect(short effectId, const std::string &sou
     if (effectMagnitudeIt == mPermanentMagicEffectMagnitudes.end())
         return;
 
-    for (TSlots::const_iterator iter (mSlots.begin()); iter!=mSlots.end(); ++iter)
+    for (std::size_t slot=0; slot<mSlots.size(); ++slot)
     {
+        TSlots::const_iterator iter = mSlots.begin()+slot;
+
         if (*iter==end())
             continue;
 
         if ((*iter)->getCellRef().getRefId() != sourceId)
             continue;
 
+        // The effect parameters of this item are about to change, so the cached
+        // contribution no longer matches it.
+        mSlotEffects[slot].mItem = nullptr;
+
         std::string enchantmentId = (*iter)->getClass().getEnchantment (**iter);
 
         if (!enchantmentId.empty())
@@ -978,6 +1025,8 @@ void MWWorld::InventoryStore::clear()
 {
     mSlots.clear();
     initSlots (mSlots);
+    mSlotEffects.assign (Slots, SlotEffects());
+    mAutoEquipUpToDate = false;
     ContainerStore::clear();
 }
 
@@ -1011,6 +1060,9 @@ void MWWorld::InventoryStore::readState(const ESM::InventoryState &state)
 {
     MWWorld::ContainerStore::readState(state);
 
+    mSlotEffects.assign (Slots, SlotEffects());
+    mAutoEquipUpToDate = false;
+
     for (ESM::InventoryState::TEffectMagnitudes::const_iterator it = state.mPermanentMagicEffectMagnitudes.begin();
          it != state.mPermanentMagicEffectMagnitudes.end(); ++it)
     {
@@ -78,6 +78,11 @@ namespace MWWorld
 
             bool mFirstAutoEquip;
 
+            // Scoring in autoEquip only depends on the inventory contents, so the result can
+            // be reused until the contents change (same pattern as
+            // ContainerStore::mRechargingItemsUpToDate).
+            bool mAutoEquipUpToDate;
+
             // Vanilla allows permanent effects with a random magnitude, so it needs to be stored here.
             // We also need this to only play sounds and particle effects when the item is equipped, rather than on every update.
             struct EffectParams
@@ -91,6 +96,16 @@ namespace MWWorld
             typedef std::map<std::string, std::vector<EffectParams> > TEffectMagnitudes;
             TEffectMagnitudes mPermanentMagicEffectMagnitudes;
 
+            // Constant-effect contribution of a single slot. updateMagicEffects only
+            // recomputes slots whose item changed and sums the cached contributions.
+            struct SlotEffects
+            {
+                const LiveCellRefBase* mItem = nullptr; // item the cache was computed for
+                MWMechanics::MagicEffects mEffects;
+            };
+
+            std::vector<SlotEffects> mSlotEffects;
+
             typedef std::vector<ContainerStoreIterator> TSlots;
 
             TSlots mSlots;
@@ -115,6 +130,10 @@ namespace MWWorld
 
             ContainerStoreIterator findSlot (int slot) const;
 
+        protected:
+
+            void flagAsModified() override;
+
         public:
 
             InventoryStore();
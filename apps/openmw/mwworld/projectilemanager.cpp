@@ -407,6 +407,8 @@ namespace MWWorld
 
     void ProjectileManager::moveMagicBolts(float duration)
     {
+        std::vector<std::pair<int, osg::Vec3f>> moves;
+        moves.reserve(mMagicBolts.size());
         for (auto& magicBoltState : mMagicBolts)
         {
             if (magicBoltState.mToDelete)
@@ -442,12 +444,15 @@ namespace MWWorld
                 caster.getClass().getCreatureStats(caster).getAiSequence().getCombatTargets(targetActors);
             projectile->setValidTargets(targetActors);
 
-            mPhysics->updateProjectile(magicBoltState.mProjectileId, newPos);
+            moves.emplace_back(magicBoltState.mProjectileId, newPos);
         }
+        mPhysics->updateProjectiles(moves);
     }
 
     void ProjectileManager::moveProjectiles(float duration)
     {
+        std::vector<std::pair<int, osg::Vec3f>> moves;
+        moves.reserve(mProjectiles.size());
         for (auto& projectileState : mProjectiles)
         {
             if (projectileState.mToDelete)
@@ -480,8 +485,9 @@ namespace MWWorld
                 caster.getClass().getCreatureStats(caster).getAiSequence().getCombatTargets(targetActors);
             projectile->setValidTargets(targetActors);
 
-            mPhysics->updateProjectile(projectileState.mProjectileId, newPos);
+            moves.emplace_back(projectileState.mProjectileId, newPos);
         }
+        mPhysics->updateProjectiles(moves);
     }
 
     void ProjectileManager::processHits()
@@ -5,6 +5,9 @@
 #include <thread>
 #include <atomic>
 
+#include <osg/Stats>
+#include <osg/Timer>
+
 #include <BulletCollision/CollisionDispatch/btCollisionObject.h>
 #include <BulletCollision/CollisionShapes/btCompoundShape.h>
 
@@ -37,6 +40,8 @@
 #include "../mwphysics/object.hpp"
 #include "../mwphysics/heightfield.hpp"
 
+#include "../mwmechanics/creaturestats.hpp"
+
 #include "player.hpp"
 #include "localscripts.hpp"
 #include "esmstore.hpp"
@@ -319,12 +324,25 @@ namespace MWWorld
 
     void Scene::update (float duration, bool paused)
     {
+        if (!mPendingActivations.empty())
+            activateNextPendingCell();
+
         mPreloader->updateCache(mRendering.getReferenceTime());
         preloadCells(duration);
 
         mRendering.update (duration, paused);
     }
 
+    void Scene::reportStats(unsigned int frameNumber, osg::Stats& stats) const
+    {
+        stats.setAttribute(frameNumber, "Scene Active Cells", mActiveCells.size());
+        stats.setAttribute(frameNumber, "Scene Inactive Cells", mInactiveCells.size() - mActiveCells.size());
+        stats.setAttribute(frameNumber, "Scene Grid Changes", mCellGridChanges);
+        stats.setAttribute(frameNumber, "Scene Grid Time", mCellGridTime);
+
+        mPreloader->reportStats(frameNumber, stats);
+    }
+
     void Scene::unloadInactiveCell (CellStore* cell, bool test)
     {
         assert(mActiveCells.find(cell) == mActiveCells.end());
@@ -335,17 +353,21 @@ namespace MWWorld
         ListObjectsVisitor visitor;
 
         cell->forEach(visitor);
-        for (const auto& ptr : visitor.mObjects)
         {
-            mPhysics->remove(ptr);
-            ptr.mRef->mData.mPhysicsPostponed = false;
-        }
+            MWPhysics::PhysicsSystem::ScopedBatchUpdate batch(*mPhysics);
 
-        if (cell->getCell()->isExterior())
-        {
-            const auto cellX = cell->getCell()->getGridX();
-            const auto cellY = cell->getCell()->getGridY();
-            mPhysics->removeHeightField(cellX, cellY);
+            for (const auto& ptr : visitor.mObjects)
+            {
+                mPhysics->remove(ptr);
+                ptr.mRef->mData.mPhysicsPostponed = false;
+            }
+
+            if (cell->getCell()->isExterior())
+            {
+                const auto cellX = cell->getCell()->getGridX();
+                const auto cellY = cell->getCell()->getGridY();
+                mPhysics->removeHeightField(cellX, cellY);
+            }
         }
 
         mInactiveCells.erase(cell);
@@ -406,6 +428,15 @@ namespace MWWorld
         MWBase::Environment::get().getWorld()->getLocalScripts().clearCell (cell);
 
         MWBase::Environment::get().getSoundManager()->stopSound (cell);
+
+        for (auto it = mActorIdCache.begin(); it != mActorIdCache.end();)
+        {
+            if (it->second.getCell() == cell)
+                it = mActorIdCache.erase(it);
+            else
+                ++it;
+        }
+
         mActiveCells.erase(cell);
     }
 
@@ -434,21 +465,23 @@ namespace MWWorld
                 const osg::Vec2i cellPosition(cellX, cellY);
                 const btVector3& origin = heightField->getCollisionObject()->getWorldTransform().getOrigin();
                 const osg::Vec3f shift(origin.x(), origin.y(), origin.z());
-                const osg::ref_ptr<const ESMTerrain::LandObject> land = mRendering.getLandManager()->getLand(cellX, cellY);
-                const ESM::Land::LandData* const data = land == nullptr ? nullptr : land->getData(ESM::Land::DATA_VHGT);
+                // Use the height samples already held by the physics heightfield instead of fetching
+                // the land again, so physics and the navigator share one buffer with one owner.
                 const HeightfieldShape shape = [&] () -> HeightfieldShape
                 {
-                    if (data == nullptr)
+                    // A flat heightfield is either a missing land record (see loadInactiveCell) or
+                    // geometrically equivalent to a plane anyway.
+                    if (heightField->getMinHeight() == heightField->getMaxHeight())
                     {
-                        return DetourNavigator::HeightfieldPlane {static_cast<float>(ESM::Land::DEFAULT_HEIGHT)};
+                        return DetourNavigator::HeightfieldPlane {heightField->getMinHeight()};
                     }
                     else
                     {
                         DetourNavigator::HeightfieldSurface heights;
-                        heights.mHeights = data->mHeights;
+                        heights.mHeights = heightField->getHeights();
                         heights.mSize = static_cast<std::size_t>(ESM::Land::LAND_SIZE);
-                        heights.mMinHeight = data->mMinHeight;
-                        heights.mMaxHeight = data->mMaxHeight;
+                        heights.mMinHeight = heightField->getMinHeight();
+                        heights.mMaxHeight = heightField->getMaxHeight();
                         return heights;
                     }
                 } ();
@@ -555,6 +588,8 @@ namespace MWWorld
 
     void Scene::clear()
     {
+        mPendingActivations.clear();
+
         for (auto iter = mInactiveCells.begin(); iter!=mInactiveCells.end(); )
         {
             auto* cell = *iter++;
@@ -599,11 +634,16 @@ namespace MWWorld
 
         osg::Vec2i newCell = getNewGridCenter(pos, &mCurrentGridCenter);
         if (newCell != mCurrentGridCenter)
-            changeCellGrid(pos, newCell.x(), newCell.y());
+            changeCellGrid(pos, newCell.x(), newCell.y(), true, mPipelinedActivation);
     }
 
-    void Scene::changeCellGrid (const osg::Vec3f &pos, int playerCellX, int playerCellY, bool changeEvent)
+    void Scene::changeCellGrid (const osg::Vec3f &pos, int playerCellX, int playerCellY, bool changeEvent, bool pipelined)
     {
+        const osg::Timer_t gridChangeStart = osg::Timer::instance()->tick();
+
+        // Any activations still queued target the previous grid center; they are recomputed below
+        mPendingActivations.clear();
+
         for (auto iter = mInactiveCells.begin(); iter != mInactiveCells.end(); )
         {
             auto* cell = *iter++;
@@ -712,6 +752,13 @@ namespace MWWorld
         {
             if (!isCellInCollection(x, y, mActiveCells))
             {
+                // When pipelined, only the player's cell is activated now; the surrounding cells
+                // are streamed in over the following frames, nearest first.
+                if (pipelined && !(x == playerCellX && y == playerCellY))
+                {
+                    mPendingActivations.push_back({osg::Vec2i(x, y), changeEvent});
+                    continue;
+                }
                 CellStore *cell = MWBase::Environment::get().getWorld()->getExterior(x, y);
                 activateCell (cell, loadingListener, changeEvent);
             }
@@ -724,6 +771,36 @@ namespace MWWorld
             mCellChanged = true;
 
         mNavigator.wait(*loadingListener, DetourNavigator::WaitConditionType::requiredTilesPresent);
+
+        mCellGridTime += osg::Timer::instance()->delta_s(gridChangeStart, osg::Timer::instance()->tick());
+        ++mCellGridChanges;
+    }
+
+    void Scene::activateNextPendingCell()
+    {
+        // One cell per frame keeps the frame time bounded; the queue is sorted nearest first
+        const PendingActivation pending = mPendingActivations.front();
+        mPendingActivations.pop_front();
+
+        if (!mCurrentCell || !mCurrentCell->isExterior())
+            return;
+
+        const int x = pending.mPosition.x();
+        const int y = pending.mPosition.y();
+        if (std::abs(x - mCurrentGridCenter.x()) > mHalfGridSize || std::abs(y - mCurrentGridCenter.y()) > mHalfGridSize)
+            return; // the grid has moved on without this cell
+
+        if (isCellInCollection(x, y, mActiveCells) || !isCellInCollection(x, y, mInactiveCells))
+            return;
+
+        const osg::Timer_t gridChangeStart = osg::Timer::instance()->tick();
+
+        // No progress is reported to the loading screen - there is no load sequence active, and
+        // drawing the screen would render a nested frame in the middle of the update
+        static Loading::Listener dummyListener;
+        activateCell(MWBase::Environment::get().getWorld()->getExterior(x, y), &dummyListener, pending.mRespawn);
+
+        mCellGridTime += osg::Timer::instance()->delta_s(gridChangeStart, osg::Timer::instance()->tick());
     }
 
     void Scene::testExteriorCells()
@@ -863,6 +940,8 @@ namespace MWWorld
     , mPreloadDoors(Settings::Manager::getBool("preload doors", "Cells"))
     , mPreloadFastTravel(Settings::Manager::getBool("preload fast travel", "Cells"))
     , mPredictionTime(Settings::Manager::getFloat("prediction time", "Cells"))
+    , mTerrainPredictionTime(Settings::Manager::getFloat("terrain prediction time", "Cells"))
+    , mPipelinedActivation(Settings::Manager::getBool("pipelined cell activation", "Cells"))
     {
         mPreloader.reset(new CellPreloader(rendering.getResourceSystem(), physics->getShapeManager(), rendering.getTerrain(), rendering.getLandManager()));
         mPreloader->setWorkQueue(mRendering.getWorkQueue());
@@ -923,6 +1002,8 @@ namespace MWWorld
 
         Log(Debug::Info) << "Changing to interior";
 
+        mPendingActivations.clear();
+
         // unload
         for (auto iter = mInactiveCells.begin(); iter!=mInactiveCells.end(); )
         {
@@ -1021,6 +1102,18 @@ namespace MWWorld
 
     void Scene::removeObjectFromScene (const Ptr& ptr)
     {
+        if (ptr.getClass().isActor())
+        {
+            for (auto it = mActorIdCache.begin(); it != mActorIdCache.end(); ++it)
+            {
+                if (it->second == ptr)
+                {
+                    mActorIdCache.erase(it);
+                    break;
+                }
+            }
+        }
+
         MWBase::Environment::get().getMechanicsManager()->remove (ptr);
         MWBase::Environment::get().getSoundManager()->stopSound3D (ptr);
         MWBase::Environment::get().getLuaManager()->objectRemovedFromScene(ptr);
@@ -1053,12 +1146,44 @@ namespace MWWorld
         return false;
     }
 
+    void Scene::updatePtr (const Ptr& old, const Ptr& updated)
+    {
+        if (!old.getClass().isActor())
+            return;
+
+        for (auto& [actorId, ptr] : mActorIdCache)
+        {
+            if (ptr == old)
+            {
+                ptr = updated;
+                return;
+            }
+        }
+    }
+
     Ptr Scene::searchPtrViaActorId (int actorId)
     {
+        auto cached = mActorIdCache.find (actorId);
+        if (cached != mActorIdCache.end())
+        {
+            const Ptr& ptr = cached->second;
+            // An actor's ID may be reset behind our back (e.g. when it respawns), so
+            // re-check it like the cell scan would.
+            if (ptr.getRefData().getCount() > 0
+                && ptr.getClass().getCreatureStats (ptr).matchesActorId (actorId))
+                // Hand the Ptr out through its cell so the cell knows its state may be modified.
+                return ptr.getCell()->getCurrentPtr (ptr.getBase());
+
+            mActorIdCache.erase (cached);
+        }
+
         for (CellStoreCollection::const_iterator iter (mActiveCells.begin());
             iter!=mActiveCells.end(); ++iter)
             if (Ptr ptr = (*iter)->searchViaActorId (actorId))
+            {
+                mActorIdCache.emplace (actorId, ptr);
                 return ptr;
+            }
 
         return Ptr();
     }
@@ -1120,12 +1245,37 @@ namespace MWWorld
         const MWWorld::ConstPtr player = MWBase::Environment::get().getWorld()->getPlayerPtr();
         osg::Vec3f playerPos = player.getRefData().getPosition().asVec3();
         osg::Vec3f moved = playerPos - mLastPlayerPos;
-        osg::Vec3f predictedPos = playerPos + moved / dt * mPredictionTime;
+        mLastPlayerPos = playerPos;
+
+        // A single frame's movement is too noisy to extrapolate from - one long or short frame
+        // would throw the predicted position off by several cells - so blend the velocity in over
+        // roughly the last half second of movement. A jump of a cell or more in a single frame is
+        // a teleport rather than movement and resets the estimate.
+        if (moved.length2() > float(Constants::CellSizeInUnits)*Constants::CellSizeInUnits)
+            mPredictedVelocity = osg::Vec3f(0.f, 0.f, 0.f);
+        else
+            mPredictedVelocity += (moved / dt - mPredictedVelocity) * std::min(dt / 0.5f, 1.f);
+
+        osg::Vec3f predictedPos = playerPos + mPredictedVelocity * mPredictionTime;
 
         if (mCurrentCell->isExterior())
+        {
             exteriorPositions.emplace_back(predictedPos, gridCenterToBounds(getNewGridCenter(predictedPos, &mCurrentGridCenter)));
 
-        mLastPlayerPos = playerPos;
+            // At sustained high speed (levitation sprints, scripted travel) additionally build a
+            // terrain view with a longer horizon on the background thread. The position is snapped
+            // to the center of its cell so that consecutive frames keep requesting the same view
+            // instead of invalidating the last one, and ViewDataMap can hand the finished view out
+            // once the camera arrives near it.
+            osg::Vec3f speculativePos = playerPos + mPredictedVelocity * mTerrainPredictionTime;
+            if (mTerrainPredictionTime > mPredictionTime
+                    && (speculativePos - predictedPos).length2() > float(Constants::CellSizeInUnits)*Constants::CellSizeInUnits/4.f)
+            {
+                const osg::Vec2i gridCenter = getNewGridCenter(speculativePos);
+                MWBase::Environment::get().getWorld()->indexToPosition(gridCenter.x(), gridCenter.y(), speculativePos.x(), speculativePos.y(), true);
+                exteriorPositions.emplace_back(speculativePos, gridCenterToBounds(gridCenter));
+            }
+        }
 
         if (mPreloadEnabled)
         {
@@ -1157,6 +1307,9 @@ namespace MWWorld
             }
         }
 
+        const MWWorld::ConstPtr player = MWBase::Environment::get().getWorld()->getPlayerPtr();
+        const osg::Vec3f playerDir = osg::Quat(player.getRefData().getPosition().rot[2], osg::Vec3f(0,0,-1)) * osg::Vec3f(0,1,0);
+
         for (const MWWorld::ConstPtr& door : teleportDoors)
         {
             float sqrDistToPlayer = (playerPos - door.getRefData().getPosition().asVec3()).length2();
@@ -1164,16 +1317,19 @@ namespace MWWorld
 
             if (sqrDistToPlayer < mPreloadDistance*mPreloadDistance)
             {
+                // A door the player is facing is the likeliest to be used next - its destination
+                // jumps the preload queue and is kept longest in the preload cache
+                const int priority = (door.getRefData().getPosition().asVec3() - playerPos) * playerDir > 0.f ? 1 : 0;
                 try
                 {
                     if (!door.getCellRef().getDestCell().empty())
-                        preloadCell(MWBase::Environment::get().getWorld()->getInterior(door.getCellRef().getDestCell()));
+                        preloadCell(MWBase::Environment::get().getWorld()->getInterior(door.getCellRef().getDestCell()), false, priority);
                     else
                     {
                         osg::Vec3f pos = door.getCellRef().getDoorDest().asVec3();
                         int x,y;
                         MWBase::Environment::get().getWorld()->positionToIndex (pos.x(), pos.y(), x, y);
-                        preloadCell(MWBase::Environment::get().getWorld()->getExterior(x,y), true);
+                        preloadCell(MWBase::Environment::get().getWorld()->getExterior(x,y), true, priority);
                         exteriorPositions.emplace_back(pos, gridCenterToBounds(getNewGridCenter(pos)));
                     }
                 }
@@ -1219,8 +1375,9 @@ namespace MWWorld
         }
     }
 
-    void Scene::preloadCell(CellStore *cell, bool preloadSurrounding)
+    void Scene::preloadCell(CellStore *cell, bool preloadSurrounding, int priority)
     {
+        MWBase::Environment::get().getSoundManager()->preloadSounds(cell);
         if (preloadSurrounding && cell->isExterior())
         {
             int x = cell->getCell()->getGridX();
@@ -1230,14 +1387,14 @@ namespace MWWorld
             {
                 for (int dy = -mHalfGridSize; dy <= mHalfGridSize; ++dy)
                 {
-                    mPreloader->preload(MWBase::Environment::get().getWorld()->getExterior(x+dx, y+dy), mRendering.getReferenceTime());
+                    mPreloader->preload(MWBase::Environment::get().getWorld()->getExterior(x+dx, y+dy), mRendering.getReferenceTime(), priority);
                     if (++numpreloaded >= mPreloader->getMaxCacheSize())
                         break;
                 }
             }
         }
         else
-            mPreloader->preload(cell, mRendering.getReferenceTime());
+            mPreloader->preload(cell, mRendering.getReferenceTime(), priority);
     }
 
     void Scene::preloadTerrain(const osg::Vec3f &pos, bool sync)
@@ -1302,16 +1459,18 @@ namespace MWWorld
             cellStore->forEachType<ESM::Creature>(listVisitor);
         }
 
+        // There are few fast travel destinations in range at a time and missing one means a long
+        // blocking load after the dialogue, so they rank above the speculative exterior ring
         for (ESM::Transport::Dest& dest : listVisitor.mList)
         {
             if (!dest.mCellName.empty())
-                preloadCell(MWBase::Environment::get().getWorld()->getInterior(dest.mCellName));
+                preloadCell(MWBase::Environment::get().getWorld()->getInterior(dest.mCellName), false, 1);
             else
             {
                 osg::Vec3f pos = dest.mPos.asVec3();
                 int x,y;
                 MWBase::Environment::get().getWorld()->positionToIndex( pos.x(), pos.y(), x, y);
-                preloadCell(MWBase::Environment::get().getWorld()->getExterior(x,y), true);
+                preloadCell(MWBase::Environment::get().getWorld()->getExterior(x,y), true, 1);
                 exteriorPositions.emplace_back(pos, gridCenterToBounds(getNewGridCenter(pos)));
             }
         }
@@ -8,6 +8,7 @@
 #include "ptr.hpp"
 #include "globals.hpp"
 
+#include <deque>
 #include <set>
 #include <memory>
 #include <unordered_map>
@@ -18,6 +19,7 @@
 namespace osg
 {
     class Vec3f;
+    class Stats;
 }
 
 namespace ESM
@@ -91,20 +93,50 @@ namespace MWWorld
             bool mPreloadDoors;
             bool mPreloadFastTravel;
             float mPredictionTime;
+            float mTerrainPredictionTime;
+            bool mPipelinedActivation;
+
+            struct PendingActivation
+            {
+                osg::Vec2i mPosition;
+                bool mRespawn;
+            };
+            // Exterior cells of the active grid that still await activation after a seamless grid
+            // change, nearest first. Drained by update(), one cell per frame, so that crossing a
+            // cell border streams the new edge cells in instead of activating them all at once.
+            std::deque<PendingActivation> mPendingActivations;
 
             static const int mHalfGridSize = Constants::CellGridRadius;
 
             osg::Vec3f mLastPlayerPos;
+            // Player velocity smoothed over the last few frames, used to extrapolate the preload positions
+            osg::Vec3f mPredictedVelocity;
+
+            // Cumulative time spent loading and unloading cells in changeCellGrid,
+            // and how often it ran; reported through reportStats
+            double mCellGridTime = 0.0;
+            unsigned int mCellGridChanges = 0;
 
             std::set<ESM::RefNum> mPagedRefs;
 
+            // Memoizes searchPtrViaActorId lookups so that repeated queries (AI packages do
+            // one per target per frame) don't rescan the active cells. Entries are dropped
+            // when their cell is deactivated or the object leaves the scene, and updated
+            // when an actor moves between two active cells.
+            std::unordered_map<int, Ptr> mActorIdCache;
+
             std::vector<osg::ref_ptr<SceneUtil::WorkItem>> mWorkItems;
 
             void insertCell (CellStore &cell, Loading::Listener* loadingListener, bool onlyObjects, bool test = false);
             osg::Vec2i mCurrentGridCenter;
 
-            // Load and unload cells as necessary to create a cell grid with "X" and "Y" in the center
-            void changeCellGrid (const osg::Vec3f &pos, int playerCellX, int playerCellY, bool changeEvent = true);
+            // Load and unload cells as necessary to create a cell grid with "X" and "Y" in the center.
+            // If pipelined is true, only the player's cell is activated immediately and the remaining
+            // cells are queued on mPendingActivations.
+            void changeCellGrid (const osg::Vec3f &pos, int playerCellX, int playerCellY, bool changeEvent = true, bool pipelined = false);
+
+            // Activate the frontmost cell of mPendingActivations, if it is still wanted
+            void activateNextPendingCell();
 
             typedef std::pair<osg::Vec3f, osg::Vec4i> PositionCellGrid;
 
@@ -128,7 +160,9 @@ namespace MWWorld
 
             ~Scene();
 
-            void preloadCell(MWWorld::CellStore* cell, bool preloadSurrounding=false);
+            /// @param priority Predicted likelihood that the cell is needed soon; higher values
+            /// start preloading first and are evicted from the preload cache last.
+            void preloadCell(MWWorld::CellStore* cell, bool preloadSurrounding=false, int priority=0);
             void preloadTerrain(const osg::Vec3f& pos, bool sync=false);
             void reloadTerrain();
 
@@ -158,6 +192,8 @@ namespace MWWorld
 
             void update (float duration, bool paused);
 
+            void reportStats(unsigned int frameNumber, osg::Stats& stats) const;
+
             void addObjectToScene (const Ptr& ptr);
             ///< Add an object that already exists in the world model to the scene.
 
@@ -166,6 +202,9 @@ namespace MWWorld
 
             void removeFromPagedRefs(const Ptr &ptr);
 
+            void updatePtr (const Ptr& old, const Ptr& updated);
+            ///< Update the stored Ptr of an object that moved between two active cells.
+
             void updateObjectRotation(const Ptr& ptr, RotationOrder order);
             void updateObjectScale(const Ptr& ptr);
             void updateObjectPosition(const Ptr &ptr, const osg::Vec3f &pos, bool movePhysics);
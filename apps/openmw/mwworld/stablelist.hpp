@@ -0,0 +1,217 @@
+#ifndef GAME_MWWORLD_STABLELIST_H
+#define GAME_MWWORLD_STABLELIST_H
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace MWWorld
+{
+    /// \brief List-like container storing its elements in contiguous blocks.
+    ///
+    /// Elements never move once constructed, so pointers and iterators to them
+    /// stay valid across push_back and erase, the same guarantee std::list
+    /// gives. Unlike std::list the elements of a block share cache lines, so
+    /// iterating the container is mostly linear in memory.
+    ///
+    /// erase() only marks the slot as dead; the storage is reclaimed when the
+    /// container is destroyed or cleared. That is a deliberate trade-off:
+    /// erasing is rare (savegame loading, mainly), while iteration runs every
+    /// frame.
+    template <typename T, std::size_t BlockSize = 32>
+    class StableList
+    {
+        struct Block
+        {
+            alignas(T) unsigned char mStorage[BlockSize][sizeof(T)];
+            std::array<bool, BlockSize> mLive;
+
+            Block() : mLive{} {}
+
+            T* get(std::size_t i) { return reinterpret_cast<T*>(mStorage[i]); }
+            const T* get(std::size_t i) const { return reinterpret_cast<const T*>(mStorage[i]); }
+        };
+
+        std::vector<std::unique_ptr<Block>> mBlocks;
+        std::size_t mAllocated; // slots handed out, dead or alive
+        std::size_t mSize; // live elements
+
+        bool isLive(std::size_t index) const
+        {
+            return index < mAllocated && mBlocks[index / BlockSize]->mLive[index % BlockSize];
+        }
+
+        T* slot(std::size_t index) const
+        {
+            return const_cast<T*>(mBlocks[index / BlockSize]->get(index % BlockSize));
+        }
+
+        template <typename Value>
+        class Iterator
+        {
+            const StableList* mContainer;
+            std::size_t mIndex;
+
+            friend class StableList;
+            template <typename> friend class Iterator;
+
+            Iterator(const StableList* container, std::size_t index)
+                : mContainer(container), mIndex(index)
+            {
+            }
+
+        public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef typename std::remove_const<Value>::type value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef Value* pointer;
+            typedef Value& reference;
+
+            Iterator() : mContainer(nullptr), mIndex(0) {}
+
+            // iterator is implicitly convertible to const_iterator
+            Iterator(const Iterator<value_type>& other)
+                : mContainer(other.mContainer), mIndex(other.mIndex)
+            {
+            }
+
+            Value& operator*() const { return *mContainer->slot(mIndex); }
+            Value* operator->() const { return mContainer->slot(mIndex); }
+
+            Iterator& operator++()
+            {
+                ++mIndex;
+                while (mIndex < mContainer->mAllocated && !mContainer->isLive(mIndex))
+                    ++mIndex;
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            Iterator& operator--()
+            {
+                do
+                {
+                    assert(mIndex > 0);
+                    --mIndex;
+                }
+                while (!mContainer->isLive(mIndex));
+                return *this;
+            }
+
+            Iterator operator--(int)
+            {
+                Iterator copy = *this;
+                --*this;
+                return copy;
+            }
+
+            template <typename V>
+            bool operator==(const Iterator<V>& other) const { return mIndex == other.mIndex; }
+            template <typename V>
+            bool operator!=(const Iterator<V>& other) const { return mIndex != other.mIndex; }
+        };
+
+    public:
+        typedef T value_type;
+        typedef Iterator<T> iterator;
+        typedef Iterator<const T> const_iterator;
+
+        StableList() : mAllocated(0), mSize(0) {}
+
+        StableList(const StableList& other) : mAllocated(0), mSize(0)
+        {
+            for (const T& value : other)
+                push_back(value);
+        }
+
+        StableList(StableList&& other) = default;
+
+        StableList& operator=(const StableList& other)
+        {
+            if (this != &other)
+            {
+                clear();
+                for (const T& value : other)
+                    push_back(value);
+            }
+            return *this;
+        }
+
+        StableList& operator=(StableList&& other) = default;
+
+        ~StableList() { clear(); }
+
+        iterator begin() { return iterator(this, firstLive()); }
+        iterator end() { return iterator(this, mAllocated); }
+        const_iterator begin() const { return const_iterator(this, firstLive()); }
+        const_iterator end() const { return const_iterator(this, mAllocated); }
+
+        bool empty() const { return mSize == 0; }
+        std::size_t size() const { return mSize; }
+
+        T& push_back(const T& value) { return emplace_back(value); }
+        T& push_back(T&& value) { return emplace_back(std::move(value)); }
+
+        template <typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            if (mAllocated == mBlocks.size() * BlockSize)
+                mBlocks.emplace_back(new Block);
+            Block& block = *mBlocks[mAllocated / BlockSize];
+            const std::size_t offset = mAllocated % BlockSize;
+            T* element = new (block.mStorage[offset]) T(std::forward<Args>(args)...);
+            block.mLive[offset] = true;
+            ++mAllocated;
+            ++mSize;
+            return *element;
+        }
+
+        T& front() { return *begin(); }
+        const T& front() const { return *begin(); }
+
+        T& back() { return *--end(); }
+        const T& back() const { return *--end(); }
+
+        /// Destroy the element; the slot stays dead until clear().
+        iterator erase(iterator position)
+        {
+            assert(isLive(position.mIndex));
+            slot(position.mIndex)->~T();
+            mBlocks[position.mIndex / BlockSize]->mLive[position.mIndex % BlockSize] = false;
+            --mSize;
+            return ++position;
+        }
+
+        void clear()
+        {
+            for (std::size_t i = 0; i < mAllocated; ++i)
+                if (isLive(i))
+                    slot(i)->~T();
+            mBlocks.clear();
+            mAllocated = 0;
+            mSize = 0;
+        }
+
+    private:
+        std::size_t firstLive() const
+        {
+            std::size_t index = 0;
+            while (index < mAllocated && !isLive(index))
+                ++index;
+            return index;
+        }
+    };
+}
+
+#endif
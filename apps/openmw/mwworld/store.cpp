@@ -92,18 +92,17 @@ namespace MWWorld
         assert(mShared.size() >= mStatic.size());
         mShared.erase(mShared.begin() + mStatic.size(), mShared.end());
         mDynamic.clear();
+        ++mRevision;
     }
 
     template<typename T>
     const T *Store<T>::search(const std::string &id) const
     {
-        std::string idLower = Misc::StringUtils::lowerCase(id);
-
-        typename Dynamic::const_iterator dit = mDynamic.find(idLower);
+        typename Dynamic::const_iterator dit = mDynamic.find(id);
         if (dit != mDynamic.end())
             return &dit->second;
 
-        typename std::map<std::string, T>::const_iterator it = mStatic.find(idLower);
+        typename Static::const_iterator it = mStatic.find(id);
         if (it != mStatic.end())
             return &(it->second);
 
@@ -112,8 +111,7 @@ namespace MWWorld
     template<typename T>
     const T *Store<T>::searchStatic(const std::string &id) const
     {
-        std::string idLower = Misc::StringUtils::lowerCase(id);
-        typename std::map<std::string, T>::const_iterator it = mStatic.find(idLower);
+        typename Static::const_iterator it = mStatic.find(id);
         if (it != mStatic.end())
             return &(it->second);
 
@@ -162,6 +160,7 @@ namespace MWWorld
         std::pair<typename Static::iterator, bool> inserted = mStatic.insert_or_assign(record.mId, record);
         if (inserted.second)
             mShared.push_back(&inserted.first->second);
+        ++mRevision;
 
         return RecordId(record.mId, isDeleted);
     }
@@ -215,6 +214,7 @@ namespace MWWorld
         T *ptr = &result.first->second;
         if (result.second)
             mShared.push_back(ptr);
+        ++mRevision;
         return ptr;
     }
     template<typename T>
@@ -225,14 +225,13 @@ namespace MWWorld
         T *ptr = &result.first->second;
         if (result.second)
             mShared.push_back(ptr);
+        ++mRevision;
         return ptr;
     }
     template<typename T>
     bool Store<T>::eraseStatic(const std::string &id)
     {
-        std::string idLower = Misc::StringUtils::lowerCase(id);
-
-        typename std::map<std::string, T>::iterator it = mStatic.find(idLower);
+        typename Static::iterator it = mStatic.find(id);
 
         if (it != mStatic.end()) {
             // delete from the static part of mShared
@@ -240,13 +239,14 @@ namespace MWWorld
             typename std::vector<T *>::iterator end = sharedIter + mStatic.size();
 
             while (sharedIter != mShared.end() && sharedIter != end) {
-                if((*sharedIter)->mId == idLower) {
+                if(Misc::StringUtils::ciEqual((*sharedIter)->mId, id)) {
                     mShared.erase(sharedIter);
                     break;
                 }
                 ++sharedIter;
             }
             mStatic.erase(it);
+            ++mRevision;
         }
 
         return true;
@@ -255,8 +255,7 @@ namespace MWWorld
     template<typename T>
     bool Store<T>::erase(const std::string &id)
     {
-        std::string key = Misc::StringUtils::lowerCase(id);
-        typename Dynamic::iterator it = mDynamic.find(key);
+        typename Dynamic::iterator it = mDynamic.find(id);
         if (it == mDynamic.end()) {
             return false;
         }
@@ -268,6 +267,7 @@ namespace MWWorld
         for (it = mDynamic.begin(); it != mDynamic.end(); ++it) {
             mShared.push_back(&it->second);
         }
+        ++mRevision;
         return true;
     }
     template<typename T>
@@ -1044,7 +1044,10 @@ namespace MWWorld
         // DialInfos marked as deleted are kept during the loading phase, so that the linked list
         // structure is kept intact for inserting further INFOs. Delete them now that loading is done.
         for (auto & [_, dial] : mStatic)
+        {
             dial.clearDeletedInfos();
+            dial.setUpInfoIndex();
+        }
 
         mShared.clear();
         mShared.reserve(mStatic.size());
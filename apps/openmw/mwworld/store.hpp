@@ -147,14 +147,20 @@ namespace MWWorld
     template <class T>
     class Store : public StoreBase
     {
-        std::map<std::string, T>      mStatic;
+        // Case-insensitive with transparent comparison so lookups work on the
+        // caller's string as-is, without building a lowercased copy per query
+        std::map<std::string, T, Misc::StringUtils::CiComp> mStatic;
         std::vector<T *>    mShared; // Preserves the record order as it came from the content files (this
                                      // is relevant for the spell autocalc code and selection order
                                      // for heads/hairs in the character creation)
-        std::map<std::string, T> mDynamic;
+        std::map<std::string, T, Misc::StringUtils::CiComp> mDynamic;
 
-        typedef std::map<std::string, T> Dynamic;
-        typedef std::map<std::string, T> Static;
+        typedef std::map<std::string, T, Misc::StringUtils::CiComp> Dynamic;
+        typedef std::map<std::string, T, Misc::StringUtils::CiComp> Static;
+
+        // Incremented whenever a record is added, replaced or removed, so that callers
+        // can memoize data derived from the records (see MWMechanics::SpellList)
+        std::size_t mRevision = 0;
 
         friend class ESMStore;
 
@@ -187,6 +193,9 @@ namespace MWWorld
         size_t getSize() const override;
         int getDynamicSize() const override;
 
+        /// Changes every time the contents of the store change
+        std::size_t getRevision() const { return mRevision; }
+
         /// @note The record identifiers are listed in the order that the records were defined by the content files.
         void listIdentifier(std::vector<std::string> &list) const override;
 
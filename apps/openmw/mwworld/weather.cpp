@@ -681,8 +681,7 @@ void WeatherManager::update(float duration, bool paused, const TimeStamp& time,
     if(!paused || mFastForward)
     {
         // Add new transitions when either the player's current external region changes.
-        std::string playerRegion = Misc::StringUtils::lowerCase(player.getCell()->getCell()->mRegion);
-        if(updateWeatherTime() || updateWeatherRegion(playerRegion))
+        if(updateWeatherTime() || updateWeatherRegion(player.getCell()->getCell()->mRegion))
         {
             std::map<std::string, RegionWeather>::iterator it = mRegions.find(mCurrentRegion);
             if(it != mRegions.end())
@@ -1002,9 +1001,11 @@ inline bool WeatherManager::updateWeatherTime()
 
 inline bool WeatherManager::updateWeatherRegion(const std::string& playerRegion)
 {
-    if(!playerRegion.empty() && playerRegion != mCurrentRegion)
+    // Compare case-insensitively and only lowercase on an actual region change, so the
+    // steady state does not allocate a lowercased copy of the region name every frame.
+    if(!playerRegion.empty() && !Misc::StringUtils::ciEqual(playerRegion, mCurrentRegion))
     {
-        mCurrentRegion = playerRegion;
+        mCurrentRegion = Misc::StringUtils::lowerCase(playerRegion);
 
         return true;
     }
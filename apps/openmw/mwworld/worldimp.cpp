@@ -120,6 +120,13 @@ namespace MWWorld
             }
         }
 
+        void prefetch(const boost::filesystem::path& filepath) override
+        {
+            LoadersContainer::iterator it(mLoaders.find(Misc::StringUtils::lowerCase(filepath.extension().string())));
+            if (it != mLoaders.end())
+                it->second->prefetch(filepath);
+        }
+
         private:
           typedef std::map<std::string, ContentLoader*> LoadersContainer;
           LoadersContainer mLoaders;
@@ -311,6 +318,7 @@ namespace MWWorld
         }
 
         mCells.clear();
+        mActiveIdCache.clear();
 
         mDoorStates.clear();
 
@@ -348,6 +356,10 @@ namespace MWWorld
         for (CellStore* cellstore : mWorldScene->getActiveCells())
         {
             MWBase::Environment::get().getWindowManager()->writeFog(cellstore);
+
+            // Anything in an active cell can change without going through the
+            // CellStore, so never reuse a previously serialized state for them.
+            cellstore->invalidateSerializedState();
         }
 
         MWMechanics::CreatureStats::writeActorIdCounter(writer);
@@ -630,6 +642,15 @@ namespace MWWorld
         mGlobalVariables[name].setInteger (value);
     }
 
+    void World::setGlobalInt (int index, int value)
+    {
+        bool dateUpdated = mCurrentDate->updateGlobalInt(mGlobalVariables.getName (index), value);
+        if (dateUpdated)
+            updateSkyDate();
+
+        mGlobalVariables[index].setInteger (value);
+    }
+
     void World::setGlobalFloat (const std::string& name, float value)
     {
         bool dateUpdated = mCurrentDate->updateGlobalFloat(name, value);
@@ -639,21 +660,45 @@ namespace MWWorld
         mGlobalVariables[name].setFloat(value);
     }
 
+    void World::setGlobalFloat (int index, float value)
+    {
+        bool dateUpdated = mCurrentDate->updateGlobalFloat(mGlobalVariables.getName (index), value);
+        if (dateUpdated)
+            updateSkyDate();
+
+        mGlobalVariables[index].setFloat(value);
+    }
+
     int World::getGlobalInt (const std::string& name) const
     {
         return mGlobalVariables[name].getInteger();
     }
 
+    int World::getGlobalInt (int index) const
+    {
+        return mGlobalVariables[index].getInteger();
+    }
+
     float World::getGlobalFloat (const std::string& name) const
     {
         return mGlobalVariables[name].getFloat();
     }
 
+    float World::getGlobalFloat (int index) const
+    {
+        return mGlobalVariables[index].getFloat();
+    }
+
     char World::getGlobalVariableType (const std::string& name) const
     {
         return mGlobalVariables.getType (name);
     }
 
+    int World::getGlobalIndex (const std::string& name) const
+    {
+        return mGlobalVariables.searchIndex (name);
+    }
+
     std::string World::getMonthName (int month) const
     {
         return mCurrentDate->getMonthName(month);
@@ -695,13 +740,33 @@ namespace MWWorld
 
         std::string lowerCaseName = Misc::StringUtils::lowerCase(name);
 
-        for (CellStore* cellstore : mWorldScene->getActiveCells())
+        const Scene::CellStoreCollection& activeCells = mWorldScene->getActiveCells();
+
+        std::map<std::string, CellStore*>::iterator cacheIter = mActiveIdCache.find (lowerCaseName);
+        if (cacheIter != mActiveIdCache.end())
+        {
+            // The Ptr is re-searched within the cached cell, so the cache cannot return an
+            // object that was moved or deleted since the last lookup.
+            if (activeCells.find (cacheIter->second) != activeCells.end())
+            {
+                Ptr ptr = mCells.getPtr (lowerCaseName, *cacheIter->second, false);
+
+                if (!ptr.isEmpty())
+                    return ptr;
+            }
+
+            mActiveIdCache.erase (cacheIter);
+        }
+
+        for (CellStore* cellstore : activeCells)
         {
-            // TODO: caching still doesn't work efficiently here (only works for the one CellStore that the reference is in)
             Ptr ptr = mCells.getPtr (lowerCaseName, *cellstore, false);
 
             if (!ptr.isEmpty())
+            {
+                mActiveIdCache.emplace (lowerCaseName, cellstore);
                 return ptr;
+            }
         }
 
         if (!activeOnly)
@@ -1201,6 +1266,7 @@ namespace MWWorld
                     mRendering->updatePtr(ptr, newPtr);
                     MWBase::Environment::get().getSoundManager()->updatePtr (ptr, newPtr);
                     mPhysics->updatePtr(ptr, newPtr);
+                    mWorldScene->updatePtr(ptr, newPtr);
 
                     MWBase::MechanicsManager *mechMgr = MWBase::Environment::get().getMechanicsManager();
                     mechMgr->updateCell(ptr, newPtr);
@@ -1564,6 +1630,19 @@ namespace MWWorld
         return mPhysics->castRay(from, to, ignore, std::vector<MWWorld::Ptr>(), mask).mHit;
     }
 
+    std::size_t World::asyncCastRay(const osg::Vec3f& from, const osg::Vec3f& to, int mask)
+    {
+        return mPhysics->asyncCastRay(from, to, MWWorld::ConstPtr(), std::vector<MWWorld::Ptr>(), mask);
+    }
+
+    std::optional<bool> World::retrieveAsyncRayCastResult(std::size_t handle)
+    {
+        std::optional<MWPhysics::RayCastingResult> result = mPhysics->retrieveAsyncRayCastResult(handle);
+        if (!result.has_value())
+            return std::nullopt;
+        return result->mHit;
+    }
+
     bool World::rotateDoor(const Ptr door, MWWorld::DoorState state, float duration)
     {
         const ESM::Position& objPos = door.getRefData().getPosition();
@@ -1949,6 +2028,20 @@ namespace MWWorld
     {
         try
         {
+            MWBase::WindowManager* windowManager = MWBase::Environment::get().getWindowManager();
+
+            // While a GUI widget is under the cursor no world tooltip can show (see
+            // ToolTips::update), so don't pay for a scene raycast every frame.
+            if (windowManager->isGuiMode() &&
+                !(windowManager->getWorldMouseOver() &&
+                    (windowManager->isConsoleMode() ||
+                    (windowManager->getMode() == MWGui::GM_Container) ||
+                    (windowManager->getMode() == MWGui::GM_Inventory))))
+            {
+                windowManager->setFocusObject(MWWorld::Ptr());
+                return;
+            }
+
             // inform the GUI about focused object
             MWWorld::Ptr object = getFacedObject ();
 
@@ -2949,39 +3042,36 @@ namespace MWWorld
     void World::loadContentFiles(const Files::Collections& fileCollections,
         const std::vector<std::string>& content, const std::vector<std::string>& groundcover, ContentLoader& contentLoader)
     {
-        int idx = 0;
+        // Resolve all paths up front so each loader can be told about the
+        // next file before the current one finishes, overlapping read-ahead
+        // on a worker thread with the ordered merge into the store.
+        std::vector<boost::filesystem::path> paths;
         for (const std::string &file : content)
         {
             boost::filesystem::path filename(file);
             const Files::MultiDirCollection& col = fileCollections.getCollection(filename.extension().string());
-            if (col.doesExist(file))
-            {
-                contentLoader.load(col.getPath(file), idx);
-            }
-            else
-            {
-                std::string message = "Failed loading " + file + ": the content file does not exist";
-                throw std::runtime_error(message);
-            }
-            idx++;
+            if (!col.doesExist(file))
+                throw std::runtime_error("Failed loading " + file + ": the content file does not exist");
+            paths.push_back(col.getPath(file));
         }
 
-        ESM::GroundcoverIndex = idx;
+        ESM::GroundcoverIndex = static_cast<int>(paths.size());
 
         for (const std::string &file : groundcover)
         {
             boost::filesystem::path filename(file);
             const Files::MultiDirCollection& col = fileCollections.getCollection(filename.extension().string());
-            if (col.doesExist(file))
-            {
-                contentLoader.load(col.getPath(file), idx);
-            }
-            else
-            {
-                std::string message = "Failed loading " + file + ": the groundcover file does not exist";
-                throw std::runtime_error(message);
-            }
-            idx++;
+            if (!col.doesExist(file))
+                throw std::runtime_error("Failed loading " + file + ": the groundcover file does not exist");
+            paths.push_back(col.getPath(file));
+        }
+
+        for (int idx = 0; idx < static_cast<int>(paths.size()); ++idx)
+        {
+            if (idx + 1 < static_cast<int>(paths.size()))
+                contentLoader.prefetch(paths[idx + 1]);
+            int index = idx;
+            contentLoader.load(paths[idx], index);
         }
     }
 
@@ -3962,6 +4052,7 @@ namespace MWWorld
     {
         mNavigator->reportStats(frameNumber, stats);
         mPhysics->reportStats(frameNumber, stats);
+        mWorldScene->reportStats(frameNumber, stats);
     }
 
     void World::updateSkyDate()
@@ -85,6 +85,12 @@ namespace MWWorld
 
             Cells mCells;
 
+            // Cache of the active cell each id was last found in by searchPtr(). Explicit
+            // script references ("id->command") resolve their target per instruction, so
+            // without the cache every such instruction scans all active cells. Entries are
+            // validated against the active cell set and dropped when they go stale.
+            std::map<std::string, CellStore*> mActiveIdCache;
+
             std::string mCurrentWorldSpace;
 
             std::unique_ptr<MWWorld::Player> mPlayer;
@@ -258,18 +264,34 @@ namespace MWWorld
             void setGlobalInt (const std::string& name, int value) override;
             ///< Set value independently from real type.
 
+            void setGlobalInt (int index, int value) override;
+            ///< Set value independently from real type.
+
             void setGlobalFloat (const std::string& name, float value) override;
             ///< Set value independently from real type.
 
+            void setGlobalFloat (int index, float value) override;
+            ///< Set value independently from real type.
+
             int getGlobalInt (const std::string& name) const override;
             ///< Get value independently from real type.
 
+            int getGlobalInt (int index) const override;
+            ///< Get value independently from real type.
+
             float getGlobalFloat (const std::string& name) const override;
             ///< Get value independently from real type.
 
+            float getGlobalFloat (int index) const override;
+            ///< Get value independently from real type.
+
             char getGlobalVariableType (const std::string& name) const override;
             ///< Return ' ', if there is no global variable with this name.
 
+            int getGlobalIndex (const std::string& name) const override;
+            ///< Return the index of the global variable with this name or -1, if there is no
+            /// such variable. Indices are stable for the lifetime of the content file selection.
+
             std::string getCellName (const MWWorld::CellStore *cell = nullptr) const override;
             ///< Return name of the cell.
             ///
@@ -418,6 +440,10 @@ namespace MWWorld
 
             bool castRay(const osg::Vec3f& from, const osg::Vec3f& to, int mask, const MWWorld::ConstPtr& ignore) override;
 
+            std::size_t asyncCastRay(const osg::Vec3f& from, const osg::Vec3f& to, int mask) override;
+
+            std::optional<bool> retrieveAsyncRayCastResult(std::size_t handle) override;
+
             void setActorCollisionMode(const Ptr& ptr, bool internal, bool external) override;
             bool isActorCollisionEnabled(const Ptr& ptr) override;
 
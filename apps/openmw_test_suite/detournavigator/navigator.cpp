@@ -17,8 +17,11 @@
 #include <gmock/gmock.h>
 
 #include <array>
+#include <chrono>
 #include <deque>
 #include <memory>
+#include <optional>
+#include <thread>
 
 MATCHER_P3(Vec3fEq, x, y, z, "")
 {
@@ -202,6 +205,73 @@ namespace
         )) << mPath;
     }
 
+    TEST_F(DetourNavigatorNavigatorTest, find_path_async_should_return_same_path_as_find_path)
+    {
+        constexpr std::array<float, 5 * 5> heightfieldData {{
+            0,   0,    0,    0,    0,
+            0, -25,  -25,  -25,  -25,
+            0, -25, -100, -100, -100,
+            0, -25, -100, -100, -100,
+            0, -25, -100, -100, -100,
+        }};
+        const HeightfieldSurface surface = makeSquareHeightfieldSurface(heightfieldData);
+
+        mNavigator->addAgent(mAgentHalfExtents);
+        mNavigator->addHeightfield(mCellPosition, mHeightfieldTileSize * (surface.mSize - 1), mShift, surface);
+        mNavigator->update(mPlayerPosition);
+        mNavigator->wait(mListener, WaitConditionType::requiredTilesPresent);
+
+        ASSERT_EQ(mNavigator->findPath(mAgentHalfExtents, mStepSize, mStart, mEnd, Flag_walk, mAreaCosts, mEndTolerance, mOut),
+                  Status::Success);
+
+        const std::size_t handle = mNavigator->findPathAsync(mAgentHalfExtents, mStepSize, mStart, mEnd,
+                                                             Flag_walk, mAreaCosts, mEndTolerance);
+        ASSERT_NE(handle, 0u);
+
+        std::optional<PathQueryResult> result;
+        for (int i = 0; i < 1000 && !result.has_value(); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            result = mNavigator->getPathQueryResult(handle);
+        }
+
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result->mStatus, Status::Success);
+        EXPECT_THAT(result->mPath, ElementsAreArray(mPath.begin(), mPath.end())) << result->mPath;
+
+        // The result is removed once it has been retrieved
+        EXPECT_FALSE(mNavigator->getPathQueryResult(handle).has_value());
+    }
+
+    TEST_F(DetourNavigatorNavigatorTest, find_path_with_coarse_flag_over_short_distance_should_return_same_path)
+    {
+        constexpr std::array<float, 5 * 5> heightfieldData {{
+            0,   0,    0,    0,    0,
+            0, -25,  -25,  -25,  -25,
+            0, -25, -100, -100, -100,
+            0, -25, -100, -100, -100,
+            0, -25, -100, -100, -100,
+        }};
+        const HeightfieldSurface surface = makeSquareHeightfieldSurface(heightfieldData);
+
+        mNavigator->addAgent(mAgentHalfExtents);
+        mNavigator->addHeightfield(mCellPosition, mHeightfieldTileSize * (surface.mSize - 1), mShift, surface);
+        mNavigator->update(mPlayerPosition);
+        mNavigator->wait(mListener, WaitConditionType::requiredTilesPresent);
+
+        ASSERT_EQ(mNavigator->findPath(mAgentHalfExtents, mStepSize, mStart, mEnd, Flag_walk, mAreaCosts, mEndTolerance, mOut),
+                  Status::Success);
+
+        const std::deque<osg::Vec3f> plainPath = std::move(mPath);
+        mPath.clear();
+
+        // Start and end are less than the coarse planning distance apart, so the flag must not change the result
+        EXPECT_EQ(mNavigator->findPath(mAgentHalfExtents, mStepSize, mStart, mEnd, Flag_walk | Flag_useCoarsePath,
+                                       mAreaCosts, mEndTolerance, mOut),
+                  Status::Success);
+        EXPECT_THAT(mPath, ElementsAreArray(plainPath.begin(), plainPath.end())) << mPath;
+    }
+
     TEST_F(DetourNavigatorNavigatorTest, add_object_should_change_navmesh)
     {
         const std::array<float, 5 * 5> heightfieldData {{
@@ -0,0 +1,64 @@
+#include <components/esm/esmreader.hpp>
+#include <components/esm/esmwriter.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+namespace
+{
+    std::string writeFile()
+    {
+        std::ostringstream out;
+        ESM::ESMWriter writer;
+        writer.save(out);
+        writer.startRecord("CSTA");
+        writer.writeHNString("SPAC", "some cell");
+        writer.endRecord("CSTA");
+        writer.startRecord("TEST");
+        writer.writeHNT("DATA", int(42));
+        writer.endRecord("TEST");
+        writer.close();
+        return out.str();
+    }
+
+    TEST(ESMSerializedRecordTest, matches_on_disk_bytes_and_skips_the_record)
+    {
+        const std::string data = writeFile();
+
+        ESM::ESMReader reader;
+        reader.open(std::make_shared<std::istringstream>(data), "");
+        ASSERT_EQ(reader.getRecName().toString(), "CSTA");
+        reader.getRecHeader();
+        const std::string record = reader.getSerializedRecord();
+
+        EXPECT_NE(data.find(record), std::string::npos);
+
+        // The reader must end up in the same position as after skipRecord.
+        ASSERT_EQ(reader.getRecName().toString(), "TEST");
+        reader.getRecHeader();
+        int value = 0;
+        reader.getHNT(value, "DATA");
+        EXPECT_EQ(value, 42);
+        EXPECT_FALSE(reader.hasMoreRecs());
+    }
+
+    TEST(ESMSerializedRecordTest, can_be_parsed_on_its_own)
+    {
+        const std::string data = writeFile();
+
+        ESM::ESMReader reader;
+        reader.open(std::make_shared<std::istringstream>(data), "");
+        reader.getRecName();
+        reader.getRecHeader();
+        const std::string record = reader.getSerializedRecord();
+
+        ESM::ESMReader recordReader;
+        recordReader.openRaw(std::make_shared<std::istringstream>(record), "");
+        recordReader.setFormat(reader.getFormat());
+        ASSERT_EQ(recordReader.getRecName().toString(), "CSTA");
+        recordReader.getRecHeader();
+        EXPECT_EQ(recordReader.getHNString("SPAC"), "some cell");
+        EXPECT_FALSE(recordReader.hasMoreRecs());
+    }
+}
@@ -97,6 +97,13 @@ return {
         end,
     },
 }
+)X");
+
+    TestFile intervalUpdateScript(R"X(
+return {
+    updateInterval = 1.0,
+    engineHandlers = { onUpdate = function(dt) print(' throttled update ' .. tostring(dt)) end },
+}
 )X");
 
     struct LuaScriptsContainerTest : Test
@@ -113,6 +120,7 @@ return {
             {"testInterface.lua", &interfaceScript},
             {"overrideInterface.lua", &overrideInterfaceScript},
             {"useInterface.lua", &useInterfaceScript},
+            {"intervalUpdate.lua", &intervalUpdateScript},
         });
 
         LuaUtil::LuaState mLua{mVFS.get()};
@@ -154,6 +162,43 @@ return {
                                                  "Test[test2.lua]:\t update 1.5\n");
     }
 
+    TEST_F(LuaScriptsContainerTest, UpdateInterval)
+    {
+        LuaUtil::ScriptsContainer scripts(&mLua, "Test");
+        testing::internal::CaptureStdout();
+        EXPECT_TRUE(scripts.addNewScript("intervalUpdate.lua"));
+        EXPECT_TRUE(scripts.addNewScript("test1.lua"));
+        scripts.update(0.25f);
+        scripts.update(0.25f);
+        scripts.update(0.5f);  // now the accumulated dt reaches the declared interval
+        EXPECT_EQ(internal::GetCapturedStdout(), "Test[test1.lua]:\t update 0.25\n"
+                                                 "Test[test1.lua]:\t update 0.25\n"
+                                                 "Test[intervalUpdate.lua]:\t throttled update 1\n"
+                                                 "Test[test1.lua]:\t update 0.5\n");
+        ASSERT_EQ(scripts.getUpdateStats().size(), 2u);
+        EXPECT_EQ(scripts.getUpdateStats()[0].mCalls, 1);
+        EXPECT_EQ(scripts.getUpdateStats()[1].mCalls, 3);
+    }
+
+    TEST_F(LuaScriptsContainerTest, UpdateBudget)
+    {
+        LuaUtil::ScriptsContainer scripts(&mLua, "Test");
+        testing::internal::CaptureStdout();
+        EXPECT_TRUE(scripts.addNewScript("test1.lua"));
+        EXPECT_TRUE(scripts.addNewScript("test2.lua"));
+
+        double timeBudget = 0;  // already exhausted; every due handler must be deferred
+        scripts.update(1.0f, &timeBudget);
+        EXPECT_EQ(scripts.getLastUpdateCallCount(), 0u);
+        EXPECT_EQ(scripts.getLastUpdateDeferredCount(), 2u);
+
+        scripts.update(0.5f);  // no budget; deferred handlers run with the accumulated dt
+        EXPECT_EQ(scripts.getLastUpdateCallCount(), 2u);
+        EXPECT_EQ(scripts.getLastUpdateDeferredCount(), 0u);
+        EXPECT_EQ(internal::GetCapturedStdout(), "Test[test1.lua]:\t update 1.5\n"
+                                                 "Test[test2.lua]:\t update 1.5\n");
+    }
+
     TEST_F(LuaScriptsContainerTest, CallEvent)
     {
         LuaUtil::ScriptsContainer scripts(&mLua, "Test");
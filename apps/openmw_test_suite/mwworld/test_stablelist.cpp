@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include "apps/openmw/mwworld/stablelist.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace
+{
+    using MWWorld::StableList;
+
+    // Small block size so the tests cross block boundaries
+    typedef StableList<std::string, 4> List;
+
+    List makeList(int count)
+    {
+        List list;
+        for (int i = 0; i < count; ++i)
+            list.push_back(std::to_string(i));
+        return list;
+    }
+
+    TEST(StableListTest, pushBackShouldAppendInOrder)
+    {
+        List list = makeList(10);
+        EXPECT_EQ(list.size(), 10);
+        EXPECT_EQ(list.front(), "0");
+        EXPECT_EQ(list.back(), "9");
+        int expected = 0;
+        for (const std::string& value : list)
+            EXPECT_EQ(value, std::to_string(expected++));
+    }
+
+    TEST(StableListTest, pushBackShouldNotMoveExistingElements)
+    {
+        List list = makeList(5);
+        const std::string* address = &list.front();
+        for (int i = 5; i < 100; ++i)
+            list.push_back(std::to_string(i));
+        EXPECT_EQ(&list.front(), address);
+    }
+
+    TEST(StableListTest, eraseShouldSkipElementAndPreserveOthers)
+    {
+        List list = makeList(10);
+        const std::string* last = &list.back();
+        for (List::iterator it = list.begin(); it != list.end();)
+        {
+            if (std::stoi(*it) % 2 == 0)
+                it = list.erase(it);
+            else
+                ++it;
+        }
+        EXPECT_EQ(list.size(), 5);
+        EXPECT_EQ(list.front(), "1");
+        EXPECT_EQ(&list.back(), last);
+    }
+
+    TEST(StableListTest, iteratorShouldSupportFindAndDecrementFromEnd)
+    {
+        List list = makeList(10);
+        List::iterator it = std::find(list.begin(), list.end(), "7");
+        ASSERT_NE(it, list.end());
+        EXPECT_EQ(*--list.end(), "9");
+    }
+
+    TEST(StableListTest, copyShouldOnlyContainLiveElements)
+    {
+        List list = makeList(4);
+        list.erase(list.begin());
+        const List copy = list;
+        EXPECT_EQ(copy.size(), 3);
+        EXPECT_EQ(copy.front(), "1");
+    }
+}
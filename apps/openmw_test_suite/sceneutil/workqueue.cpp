@@ -0,0 +1,89 @@
+#include <components/sceneutil/workqueue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace SceneUtil;
+
+    struct CountingWorkItem : WorkItem
+    {
+        std::atomic_int& mCounter;
+        std::chrono::milliseconds mDuration;
+
+        explicit CountingWorkItem(std::atomic_int& counter,
+                std::chrono::milliseconds duration = std::chrono::milliseconds(0))
+            : mCounter(counter)
+            , mDuration(duration)
+        {}
+
+        void doWork() override
+        {
+            if (mDuration.count() > 0)
+                std::this_thread::sleep_for(mDuration);
+            ++mCounter;
+        }
+    };
+
+    TEST(SceneUtilWorkQueue, allAddedItemsShouldComplete)
+    {
+        osg::ref_ptr<WorkQueue> queue(new WorkQueue(4));
+        std::atomic_int counter {0};
+        std::vector<osg::ref_ptr<WorkItem>> items;
+        for (int i = 0; i < 100; ++i)
+        {
+            items.emplace_back(new CountingWorkItem(counter));
+            queue->addWorkItem(items.back(), /*front=*/i % 2 == 0);
+        }
+        for (const osg::ref_ptr<WorkItem>& item : items)
+            item->waitTillDone();
+        EXPECT_EQ(counter, 100);
+        EXPECT_EQ(queue->getNumItems(), 0u);
+    }
+
+    TEST(SceneUtilWorkQueue, itemWithDependenciesShouldRunAfterThem)
+    {
+        struct CheckDependenciesWorkItem : WorkItem
+        {
+            const WorkItem& mFirst;
+            const WorkItem& mSecond;
+            bool mDependenciesDone = false;
+
+            CheckDependenciesWorkItem(const WorkItem& first, const WorkItem& second)
+                : mFirst(first)
+                , mSecond(second)
+            {}
+
+            void doWork() override { mDependenciesDone = mFirst.isDone() && mSecond.isDone(); }
+        };
+
+        osg::ref_ptr<WorkQueue> queue(new WorkQueue(2));
+        std::atomic_int counter {0};
+        osg::ref_ptr<WorkItem> first(new CountingWorkItem(counter, std::chrono::milliseconds(5)));
+        osg::ref_ptr<WorkItem> second(new CountingWorkItem(counter, std::chrono::milliseconds(10)));
+        osg::ref_ptr<CheckDependenciesWorkItem> dependent(new CheckDependenciesWorkItem(*first, *second));
+        queue->addWorkItem(dependent, /*priority=*/1, {first, second});
+        queue->addWorkItem(first);
+        queue->addWorkItem(second);
+        dependent->waitTillDone();
+        EXPECT_TRUE(dependent->mDependenciesDone);
+        EXPECT_EQ(counter, 2);
+    }
+
+    TEST(SceneUtilWorkQueue, stopShouldAllowRestart)
+    {
+        osg::ref_ptr<WorkQueue> queue(new WorkQueue(2));
+        queue->stop();
+        queue->start(2);
+        std::atomic_int counter {0};
+        osg::ref_ptr<WorkItem> item(new CountingWorkItem(counter));
+        queue->addWorkItem(item);
+        item->waitTillDone();
+        EXPECT_EQ(counter, 1);
+    }
+}
@@ -2,6 +2,8 @@
 
 #include <QDebug>
 
+#include <QCryptographicHash>
+#include <QMutexLocker>
 #include <QReadLocker>
 #include <QWriteLocker>
 #include <QFileDialog>
@@ -13,6 +15,84 @@
 #include <QDir>
 #include <QDirIterator>
 
+namespace
+{
+    const int sCopyBufferSize = 4 * 1024 * 1024;
+}
+
+Wizard::FileVerifier::FileVerifier(QObject *parent) :
+    QThread(parent),
+    mDone(false)
+{
+}
+
+Wizard::FileVerifier::~FileVerifier()
+{
+    finish();
+}
+
+void Wizard::FileVerifier::queueFile(const QString &path, const QByteArray &checksum)
+{
+    {
+        QMutexLocker locker(&mMutex);
+        mQueue.append(qMakePair(path, checksum));
+    }
+    mQueued.wakeOne();
+
+    if (!isRunning())
+        start();
+}
+
+void Wizard::FileVerifier::finish()
+{
+    {
+        QMutexLocker locker(&mMutex);
+        mDone = true;
+    }
+    mQueued.wakeAll();
+    wait();
+}
+
+QStringList Wizard::FileVerifier::getFailures()
+{
+    QMutexLocker locker(&mMutex);
+    return mFailures;
+}
+
+void Wizard::FileVerifier::run()
+{
+    for (;;)
+    {
+        QPair<QString, QByteArray> job;
+        {
+            QMutexLocker locker(&mMutex);
+            while (mQueue.isEmpty() && !mDone)
+                mQueued.wait(&mMutex);
+
+            if (mQueue.isEmpty())
+                return;
+
+            job = mQueue.takeFirst();
+        }
+
+        QFile file(job.first);
+        bool result = file.open(QIODevice::ReadOnly);
+        if (result) {
+            QCryptographicHash hash(QCryptographicHash::Md5);
+            QByteArray buffer;
+            while (!(buffer = file.read(sCopyBufferSize)).isEmpty())
+                hash.addData(buffer);
+
+            result = (hash.result() == job.second);
+        }
+
+        if (!result) {
+            QMutexLocker locker(&mMutex);
+            mFailures.append(job.first);
+        }
+    }
+}
+
 Wizard::UnshieldWorker::UnshieldWorker(QObject *parent) :
     QObject(parent),
     mIniSettings()
@@ -237,7 +317,6 @@ bool Wizard::UnshieldWorker::removeDirectory(const QString &dirName)
 bool Wizard::UnshieldWorker::copyFile(const QString &source, const QString &destination, bool keepSource)
 {
     QDir dir;
-    QFile file;
 
     QFileInfo info(destination);
 
@@ -246,17 +325,40 @@ bool Wizard::UnshieldWorker::copyFile(const QString &source, const QString &dest
             return false;
     }
 
-    if (file.copy(source, destination)) {
-        if (!keepSource) {
-            if (!file.remove(source))
-                return false;
-        } else {
-            return true;
-        }
-    } else {
+    QFile sourceFile(source);
+    if (!sourceFile.open(QIODevice::ReadOnly))
         return false;
+
+    QFile destFile(destination);
+    if (!destFile.open(QIODevice::WriteOnly))
+        return false;
+
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    QByteArray buffer;
+    buffer.resize(sCopyBufferSize);
+
+    for (;;)
+    {
+        qint64 bytes = sourceFile.read(buffer.data(), buffer.size());
+        if (bytes < 0)
+            return false;
+        if (bytes == 0)
+            break;
+
+        hash.addData(buffer.constData(), static_cast<int>(bytes));
+
+        if (destFile.write(buffer.constData(), bytes) != bytes)
+            return false;
     }
 
+    destFile.close();
+
+    // check the copy against the source checksum in the background
+    mVerifier.queueFile(destination, hash.result());
+
+    if (!keepSource)
+        return sourceFile.remove();
+
     return true;
 }
 
@@ -405,6 +507,19 @@ void Wizard::UnshieldWorker::extract()
     // Remove the temporary directory
     removeDirectory(getPath() + QDir::separator() + QLatin1String("extract-temp"));
 
+    // Wait for the background checksum verification of the copied files
+    emit textChanged(tr("Verifying installation files"));
+
+    mVerifier.finish();
+
+    const QStringList failures(mVerifier.getFailures());
+    if (!failures.isEmpty())
+    {
+        emit error(tr("Installed file does not match its source!"),
+                   tr("Checksum mismatch for:\n%1").arg(failures.join(QLatin1String("\n"))));
+        return;
+    }
+
     // Fill the progress bar
     int total = 0;
 
@@ -21,6 +21,34 @@ namespace Wizard
         Component_Bloodmoon
     };
 
+    /// Re-reads copied files on a background thread and checks them against
+    /// the checksum computed while copying, so verification overlaps with the
+    /// remaining copies.
+    class FileVerifier : public QThread
+    {
+    public:
+        FileVerifier(QObject *parent = nullptr);
+        ~FileVerifier() override;
+
+        /// Queue a file for verification, starting the thread on first use.
+        void queueFile(const QString &path, const QByteArray &checksum);
+
+        /// Wait until all queued files have been verified.
+        void finish();
+
+        /// Paths of files that could not be read back or did not match their checksum.
+        QStringList getFailures();
+
+    private:
+        void run() override;
+
+        QMutex mMutex;
+        QWaitCondition mQueued;
+        QList<QPair<QString, QByteArray> > mQueue;
+        bool mDone;
+        QStringList mFailures;
+    };
+
     class UnshieldWorker : public QObject
     {
         Q_OBJECT
@@ -107,6 +135,8 @@ namespace Wizard
 
         QReadWriteLock mLock;
 
+        FileVerifier mVerifier;
+
     public slots:
         void extract();
 
@@ -26,6 +26,13 @@
 
 #include <stdexcept>
 #include <cassert>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include <lz4frame.h>
 
@@ -48,6 +55,115 @@
 #include <boost/iostreams/device/array.hpp>
 #include <components/bsa/memorystream.hpp>
 
+namespace
+{
+    using DecompressedBlockPtr = std::shared_ptr<const std::vector<char>>;
+
+    // Stream over a decompressed block shared with the cache below. Each reader
+    // gets its own stream state; like MemoryInputStream, seeking is not supported.
+    class DecompressedBlockStreamBuf : public std::streambuf
+    {
+    public:
+        explicit DecompressedBlockStreamBuf(DecompressedBlockPtr data)
+            : mData(std::move(data))
+        {
+            char* begin = const_cast<char*>(mData->data());
+            setg(begin, begin, begin + mData->size());
+        }
+    private:
+        DecompressedBlockPtr mData;
+    };
+
+    class DecompressedBlockStream : virtual DecompressedBlockStreamBuf, std::istream
+    {
+    public:
+        explicit DecompressedBlockStream(DecompressedBlockPtr data)
+            : DecompressedBlockStreamBuf(std::move(data)),
+              std::istream(static_cast<std::streambuf*>(this))
+        { }
+    };
+
+    // Byte-budgeted LRU of decompressed file records, shared between all
+    // compressed archives. Body parts and common clutter get requested dozens
+    // of times per session; serving them from here skips inflate entirely.
+    class DecompressedBlockCache
+    {
+    public:
+        // Files are identified by the archive instance and their offset in it.
+        using Key = std::pair<std::uintptr_t, std::uint32_t>;
+
+        DecompressedBlockPtr get(const Key& key)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            const auto it = mIndex.find(key);
+            if (it == mIndex.end())
+                return nullptr;
+            mEntries.splice(mEntries.begin(), mEntries, it->second);
+            return it->second->mData;
+        }
+
+        void put(const Key& key, const DecompressedBlockPtr& data)
+        {
+            // A single huge asset should not flush the entire cache.
+            if (data->size() > sByteBudget / 8)
+                return;
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (mIndex.find(key) != mIndex.end())
+                return; // raced with another reader of the same file
+            mEntries.push_front(Entry {key, data});
+            mIndex[key] = mEntries.begin();
+            mSize += data->size();
+            while (mSize > sByteBudget)
+            {
+                mSize -= mEntries.back().mData->size();
+                mIndex.erase(mEntries.back().mKey);
+                mEntries.pop_back();
+            }
+        }
+
+        void removeArchive(std::uintptr_t archive)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            // The index is ordered by archive first, so its entries are contiguous.
+            auto it = mIndex.lower_bound(std::make_pair(archive, std::uint32_t(0)));
+            while (it != mIndex.end() && it->first.first == archive)
+            {
+                mSize -= it->second->mData->size();
+                mEntries.erase(it->second);
+                it = mIndex.erase(it);
+            }
+        }
+
+        static DecompressedBlockCache& instance()
+        {
+            static DecompressedBlockCache cache;
+            return cache;
+        }
+
+    private:
+        struct Entry
+        {
+            Key mKey;
+            DecompressedBlockPtr mData;
+        };
+
+        std::mutex mMutex;
+        std::list<Entry> mEntries; // front = most recently used
+        std::map<Key, std::list<Entry>::iterator> mIndex;
+        std::size_t mSize = 0;
+
+        // Enough for the hot set of a modded install without noticeably
+        // growing the overall footprint.
+        static constexpr std::size_t sByteBudget = 64 * 1024 * 1024;
+    };
+
+    Files::IStreamPtr makeBlockStream(DecompressedBlockPtr data)
+    {
+        auto stream = std::make_shared<DecompressedBlockStream>(std::move(data));
+        return std::shared_ptr<std::istream>(stream, (std::istream*)stream.get());
+    }
+}
+
 namespace Bsa
 {
 //special marker for invalid records,
@@ -111,7 +227,10 @@ CompressedBSAFile::CompressedBSAFile()
     : mCompressedByDefault(false), mEmbeddedFileNames(false)
 { }
 
-CompressedBSAFile::~CompressedBSAFile() = default;
+CompressedBSAFile::~CompressedBSAFile()
+{
+    DecompressedBlockCache::instance().removeArchive(reinterpret_cast<std::uintptr_t>(this));
+}
 
 /// Read header information from the input source
 void CompressedBSAFile::readHeader()
@@ -355,6 +474,15 @@ Files::IStreamPtr CompressedBSAFile::getFile(const FileRecord& fileRecord)
     size_t size = fileRecord.getSizeWithoutCompressionFlag();
     size_t uncompressedSize = size;
     bool compressed = fileRecord.isCompressed(mCompressedByDefault);
+
+    const DecompressedBlockCache::Key cacheKey
+        = std::make_pair(reinterpret_cast<std::uintptr_t>(this), fileRecord.offset);
+    if (compressed)
+    {
+        if (DecompressedBlockPtr cached = DecompressedBlockCache::instance().get(cacheKey))
+            return makeBlockStream(std::move(cached));
+    }
+
     Files::IStreamPtr streamPtr = Files::openConstrainedFileStream(mFilename.c_str(), fileRecord.offset, size);
     std::istream* fileStream = streamPtr.get();
     if (mEmbeddedFileNames)
@@ -365,22 +493,21 @@ Files::IStreamPtr CompressedBSAFile::getFile(const FileRecord& fileRecord)
         fileStream->ignore(length);
         size -= length + sizeof(char);
     }
+
     if (compressed)
     {
         fileStream->read(reinterpret_cast<char*>(&uncompressedSize), sizeof(uint32_t));
         size -= sizeof(uint32_t);
-    }
-    std::shared_ptr<Bsa::MemoryInputStream> memoryStreamPtr = std::make_shared<MemoryInputStream>(uncompressedSize);
 
-    if (compressed)
-    {
+        std::shared_ptr<std::vector<char>> data = std::make_shared<std::vector<char>>(uncompressedSize);
+
         if (mVersion != 0x69) // Non-SSE: zlib
         {
             boost::iostreams::filtering_streambuf<boost::iostreams::input> inputStreamBuf;
             inputStreamBuf.push(boost::iostreams::zlib_decompressor());
             inputStreamBuf.push(*fileStream);
 
-            boost::iostreams::basic_array_sink<char> sr(memoryStreamPtr->getRawData(), uncompressedSize);
+            boost::iostreams::basic_array_sink<char> sr(data->data(), uncompressedSize);
             boost::iostreams::copy(inputStreamBuf, sr);
         }
         else // SSE: lz4
@@ -390,18 +517,21 @@ Files::IStreamPtr CompressedBSAFile::getFile(const FileRecord& fileRecord)
             LZ4F_decompressionContext_t context = nullptr;
             LZ4F_createDecompressionContext(&context, LZ4F_VERSION);
             LZ4F_decompressOptions_t options = {};
-            LZ4F_errorCode_t errorCode = LZ4F_decompress(context, memoryStreamPtr->getRawData(), &uncompressedSize, buffer.get(), &size, &options);
+            LZ4F_errorCode_t errorCode = LZ4F_decompress(context, data->data(), &uncompressedSize, buffer.get(), &size, &options);
             if (LZ4F_isError(errorCode))
                 fail("LZ4 decompression error (file " + mFilename + "): " + LZ4F_getErrorName(errorCode));
             errorCode = LZ4F_freeDecompressionContext(context);
             if (LZ4F_isError(errorCode))
                 fail("LZ4 decompression error (file " + mFilename + "): " + LZ4F_getErrorName(errorCode));
         }
+
+        DecompressedBlockPtr block = std::move(data);
+        DecompressedBlockCache::instance().put(cacheKey, block);
+        return makeBlockStream(std::move(block));
     }
-    else
-    {
-        fileStream->read(memoryStreamPtr->getRawData(), size);
-    }
+
+    std::shared_ptr<Bsa::MemoryInputStream> memoryStreamPtr = std::make_shared<MemoryInputStream>(size);
+    fileStream->read(memoryStreamPtr->getRawData(), size);
 
     return std::shared_ptr<std::istream>(memoryStreamPtr, (std::istream*)memoryStreamPtr.get());
 }
@@ -33,6 +33,10 @@ namespace Compiler
             virtual char getGlobalType (const std::string& name) const = 0;
             ///< 'l: long, 's': short, 'f': float, ' ': does not exist.
 
+            virtual int getGlobalIndex (const std::string& name) const = 0;
+            ///< Return the index of the global variable \a name or -1, if there is no such
+            /// variable. Compiled code refers to global variables by this index.
+
             virtual std::pair<char, bool> getMemberType (const std::string& name,
                 const std::string& id) const = 0;
             ///< Return type of member variable \a name in script \a id or in script of reference of
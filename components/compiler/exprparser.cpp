@@ -314,7 +314,7 @@ namespace Compiler
 
             if (type!=' ')
             {
-                Generator::fetchGlobal (mCode, mLiterals, type, name2);
+                Generator::fetchGlobal (mCode, type, getContext().getGlobalIndex (name2));
                 mNextOperand = false;
                 mOperands.push_back (type=='f' ? 'f' : 'l');
                 return true;
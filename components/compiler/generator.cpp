@@ -573,12 +573,10 @@ namespace Compiler::Generator
             }
         }
 
-        void assignToGlobal (CodeContainer& code, Literals& literals, char localType,
-            const std::string& name, const CodeContainer& value, char valueType)
+        void assignToGlobal (CodeContainer& code, char localType, int globalIndex,
+            const CodeContainer& value, char valueType)
         {
-            int index = literals.addString (name);
-
-            opPushInt (code, index);
+            opPushInt (code, globalIndex);
 
             std::copy (value.begin(), value.end(), std::back_inserter (code));
 
@@ -617,12 +615,9 @@ namespace Compiler::Generator
             }
         }
 
-        void fetchGlobal (CodeContainer& code, Literals& literals, char localType,
-            const std::string& name)
+        void fetchGlobal (CodeContainer& code, char localType, int globalIndex)
         {
-            int index = literals.addString (name);
-
-            opPushInt (code, index);
+            opPushInt (code, globalIndex);
 
             switch (localType)
             {
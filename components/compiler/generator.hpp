@@ -91,11 +91,10 @@ namespace Compiler
 
         void compare (CodeContainer& code, char op, char valueType1, char valueType2);
 
-        void assignToGlobal (CodeContainer& code, Literals& literals, char localType,
-            const std::string& name, const CodeContainer& value, char valueType);
+        void assignToGlobal (CodeContainer& code, char localType, int globalIndex,
+            const CodeContainer& value, char valueType);
 
-        void fetchGlobal (CodeContainer& code, Literals& literals, char localType,
-            const std::string& name);
+        void fetchGlobal (CodeContainer& code, char localType, int globalIndex);
 
         void assignToMember (CodeContainer& code, Literals& literals, char memberType,
             const std::string& name, const std::string& id, const CodeContainer& value, char valueType, bool global);
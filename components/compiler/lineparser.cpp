@@ -406,7 +406,7 @@ namespace Compiler
             std::vector<Interpreter::Type_Code> code;
             char type = mExprParser.append (code);
 
-            Generator::assignToGlobal (mCode, mLiterals, mType, mName, code, type);
+            Generator::assignToGlobal (mCode, mType, getContext().getGlobalIndex (mName), code, type);
 
             mState = EndState;
             return true;
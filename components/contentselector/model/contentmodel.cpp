@@ -4,19 +4,35 @@
 #include <stdexcept>
 
 #include <QDir>
+#include <QDataStream>
+#include <QFileSystemWatcher>
+#include <QSaveFile>
+#include <QStandardPaths>
 #include <QTextCodec>
 #include <QDebug>
 
 #include <components/esm/esmreader.hpp>
 
+namespace
+{
+    const quint32 sMetadataCacheMagic = 0x304D574F; // "OMW0"
+    const quint32 sMetadataCacheVersion = 1;
+}
+
 ContentSelectorModel::ContentModel::ContentModel(QObject *parent, QIcon warningIcon) :
     QAbstractTableModel(parent),
     mWarningIcon(warningIcon),
+    mMetadataCacheLoaded (false),
+    mMetadataCacheModified (false),
+    mWatcher (new QFileSystemWatcher(this)),
     mMimeType ("application/omwcontent"),
     mMimeTypes (QStringList() << mMimeType),
     mColumnCount (1),
     mDropActions (Qt::MoveAction)
 {
+    connect (mWatcher, SIGNAL (directoryChanged(QString)),
+             this, SLOT (slotDirectoryChanged(QString)));
+
     setEncoding ("win1252");
     uncheckAll();
 }
@@ -29,7 +45,15 @@ ContentSelectorModel::ContentModel::~ContentModel()
 
 void ContentSelectorModel::ContentModel::setEncoding(const QString &encoding)
 {
+    if (encoding == mEncoding)
+        return;
+
     mEncoding = encoding;
+
+    // cached authors and descriptions were decoded with the old encoding
+    mMetadataCache.clear();
+    mMetadataCacheLoaded = false;
+    mMetadataCacheModified = false;
 }
 
 int ContentSelectorModel::ContentModel::columnCount(const QModelIndex &parent) const
@@ -424,6 +448,12 @@ void ContentSelectorModel::ContentModel::addFiles(const QString &path)
     filters << "*.esp" << "*.esm" << "*.omwgame" << "*.omwaddon";
     dir.setNameFilters(filters);
 
+    if (!mMetadataCacheLoaded)
+    {
+        loadMetadataCache();
+        mMetadataCacheLoaded = true;
+    }
+
     for (const QString &path2 : dir.entryList())
     {
         QFileInfo info(dir.absoluteFilePath(path2));
@@ -431,6 +461,24 @@ void ContentSelectorModel::ContentModel::addFiles(const QString &path)
         if (item(info.fileName()))
             continue;
 
+        const auto cachedMetadata = mMetadataCache.constFind(info.absoluteFilePath());
+        if (cachedMetadata != mMetadataCache.constEnd()
+                && cachedMetadata->mModified == info.lastModified().toMSecsSinceEpoch()
+                && cachedMetadata->mSize == info.size())
+        {
+            // unchanged since the last scan, no need to open the file
+            EsmFile *file = new EsmFile(path2);
+            file->setAuthor     (cachedMetadata->mAuthor);
+            file->setDate       (info.lastModified());
+            file->setFormat     (cachedMetadata->mFormat);
+            file->setFilePath   (info.absoluteFilePath());
+            file->setDescription(cachedMetadata->mDescription);
+            file->setGameFiles  (cachedMetadata->mGameFiles);
+
+            addFile(file);
+            continue;
+        }
+
         try {
             ESM::ESMReader fileReader;
             ToUTF8::Utf8Encoder encoder =
@@ -458,6 +506,16 @@ void ContentSelectorModel::ContentModel::addFiles(const QString &path)
                 file->addGameFile(QString::fromUtf8("Tribunal.esm"));
             }
 
+            FileMetadata metadata;
+            metadata.mModified = info.lastModified().toMSecsSinceEpoch();
+            metadata.mSize = info.size();
+            metadata.mAuthor = file->author();
+            metadata.mFormat = fileReader.getFormat();
+            metadata.mDescription = file->description();
+            metadata.mGameFiles = file->gameFiles();
+            mMetadataCache.insert(info.absoluteFilePath(), metadata);
+            mMetadataCacheModified = true;
+
             // Put the file in the table
             addFile(file);
 
@@ -469,9 +527,106 @@ void ContentSelectorModel::ContentModel::addFiles(const QString &path)
 
     }
 
+    if (!mWatcher->directories().contains(path))
+        mWatcher->addPath(path);
+
+    if (mMetadataCacheModified)
+        saveMetadataCache();
+
     sortFiles();
 }
 
+void ContentSelectorModel::ContentModel::slotDirectoryChanged(const QString &path)
+{
+    const QDir dir(path);
+
+    // drop entries whose file was deleted or changed on disk; the rescan
+    // below re-adds the changed ones from their new header
+    for (int row = mFiles.count() - 1; row >= 0; --row)
+    {
+        const EsmFile *file = mFiles.at(row);
+        QFileInfo info(file->filePath());
+
+        if (QDir(info.absolutePath()) != dir)
+            continue;
+
+        if (info.exists() && info.lastModified() == file->modified())
+            continue;
+
+        if (!info.exists() && mMetadataCache.remove(file->filePath()))
+            mMetadataCacheModified = true;
+
+        removeRows(row, 1);
+    }
+
+    addFiles(path);
+}
+
+QString ContentSelectorModel::ContentModel::metadataCachePath()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/openmw/contentfiles.cache";
+}
+
+void ContentSelectorModel::ContentModel::loadMetadataCache()
+{
+    QFile file (metadataCachePath());
+    if (!file.open(QIODevice::ReadOnly))
+        return;
+
+    QDataStream stream (&file);
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    quint32 magic = 0, version = 0;
+    QString encoding;
+    stream >> magic >> version >> encoding;
+    if (magic != sMetadataCacheMagic || version != sMetadataCacheVersion || encoding != mEncoding)
+        return;
+
+    quint32 count = 0;
+    stream >> count;
+    for (quint32 i = 0; i < count; ++i)
+    {
+        QString filePath;
+        FileMetadata metadata;
+        qint32 format = 0;
+        stream >> filePath >> metadata.mModified >> metadata.mSize >> metadata.mAuthor
+               >> format >> metadata.mDescription >> metadata.mGameFiles;
+        metadata.mFormat = format;
+
+        if (stream.status() != QDataStream::Ok)
+        {
+            qWarning() << "Discarding damaged content file metadata cache: " << file.fileName();
+            mMetadataCache.clear();
+            return;
+        }
+
+        mMetadataCache.insert(filePath, metadata);
+    }
+}
+
+void ContentSelectorModel::ContentModel::saveMetadataCache()
+{
+    QFileInfo info (metadataCachePath());
+    if (!QDir().mkpath(info.absolutePath()))
+        return;
+
+    QSaveFile file (info.absoluteFilePath());
+    if (!file.open(QIODevice::WriteOnly))
+        return;
+
+    QDataStream stream (&file);
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    stream << sMetadataCacheMagic << sMetadataCacheVersion << mEncoding;
+    stream << static_cast<quint32>(mMetadataCache.size());
+    for (auto it = mMetadataCache.constBegin(); it != mMetadataCache.constEnd(); ++it)
+        stream << it.key() << it->mModified << it->mSize << it->mAuthor
+               << static_cast<qint32>(it->mFormat) << it->mDescription << it->mGameFiles;
+
+    if (file.commit())
+        mMetadataCacheModified = false;
+}
+
 void ContentSelectorModel::ContentModel::clearFiles()
 {
     const int filesCount = mFiles.count();
@@ -7,6 +7,8 @@
 #include <QIcon>
 #include "loadordererror.hpp"
 
+class QFileSystemWatcher;
+
 namespace ContentSelectorModel
 {
     class EsmFile;
@@ -64,8 +66,30 @@ namespace ContentSelectorModel
         /// Checks all plug-ins for load order errors and updates mPluginsWithLoadOrderError with plug-ins with issues
         void checkForLoadOrderErrors();
 
+    private slots:
+
+        /// Rescan a watched directory after files were added, removed or changed on disk.
+        void slotDirectoryChanged(const QString &path);
+
     private:
 
+        /// Header metadata of a content file, cached on disk so unchanged files
+        /// don't have to be opened again on the next scan.
+        struct FileMetadata
+        {
+            qint64 mModified;
+            qint64 mSize;
+            QString mAuthor;
+            int mFormat;
+            QString mDescription;
+            QStringList mGameFiles;
+        };
+
+        static QString metadataCachePath();
+
+        void loadMetadataCache();
+        void saveMetadataCache();
+
         void addFile(EsmFile *file);
 
         void sortFiles();
@@ -85,6 +109,13 @@ namespace ContentSelectorModel
         QString mEncoding;
         QIcon mWarningIcon;
 
+        /// Keyed by absolute file path; entries are valid while the file's
+        /// modification time and size are unchanged.
+        QHash<QString, FileMetadata> mMetadataCache;
+        bool mMetadataCacheLoaded;
+        bool mMetadataCacheModified;
+        QFileSystemWatcher *mWatcher;
+
     public:
 
         QString mMimeType;
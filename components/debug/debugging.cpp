@@ -15,6 +15,89 @@
 
 namespace Debug
 {
+    LogWriter& LogWriter::instance()
+    {
+        static LogWriter value;
+        return value;
+    }
+
+    LogWriter::LogWriter()
+    {
+        mThread = std::thread([this] { process(); });
+    }
+
+    LogWriter::~LogWriter()
+    {
+        stop();
+    }
+
+    void LogWriter::queue(std::ostream& stream, std::string data, bool blockUntilWritten)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        mWritten.wait(lock, [this] { return mRecords.size() < sMaxRecords || mStopped; });
+
+        if (mStopped)
+        {
+            // The drain thread is gone or about to exit, write in place once it is done
+            mWritten.wait(lock, [this] { return mThreadDone; });
+            stream.write(data.data(), data.size());
+            stream.flush();
+            return;
+        }
+
+        mRecords.push_back(Record {&stream, std::move(data)});
+        const std::uint64_t id = ++mQueuedCount;
+        mHasRecords.notify_one();
+
+        if (blockUntilWritten)
+            mWritten.wait(lock, [&] { return mWrittenCount >= id || mStopped; });
+    }
+
+    void LogWriter::stop()
+    {
+        {
+            const std::lock_guard<std::mutex> lock(mMutex);
+            if (mStopped)
+                return;
+            mStopped = true;
+            mHasRecords.notify_one();
+            mWritten.notify_all();
+        }
+
+        if (mThread.joinable())
+            mThread.join();
+    }
+
+    void LogWriter::process()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        while (true)
+        {
+            mHasRecords.wait(lock, [this] { return !mRecords.empty() || mStopped; });
+
+            if (mRecords.empty())
+            {
+                mThreadDone = true;
+                mWritten.notify_all();
+                return;
+            }
+
+            Record record = std::move(mRecords.front());
+            mRecords.pop_front();
+
+            // Write without the lock, so loggers can queue meanwhile
+            lock.unlock();
+            record.mStream->write(record.mData.data(), record.mData.size());
+            record.mStream->flush();
+            lock.lock();
+
+            ++mWrittenCount;
+            mWritten.notify_all();
+        }
+    }
+
 #ifdef _WIN32
     bool isRedirected(DWORD nStdHandle)
     {
@@ -216,6 +299,10 @@ int wrapApplication(int (*innerApplication)(int argc, char *argv[]), int argc, c
         ret = 1;
     }
 
+    // Flush pending log messages and write synchronously from here on, the streams the
+    // writer refers to go away together with this scope
+    Debug::LogWriter::instance().stop();
+
     // Restore cout and cerr
     std::cout.rdbuf(cout_rdbuf);
     std::cerr.rdbuf(cerr_rdbuf);
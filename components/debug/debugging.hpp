@@ -10,6 +10,12 @@
 
 #include "debuglog.hpp"
 
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <sstream>
+#include <thread>
+
 #if defined _WIN32 && defined _DEBUG
 #   undef WIN32_LEAN_AND_MEAN
 #   define WIN32_LEAN_AND_MEAN
@@ -18,6 +24,52 @@
 
 namespace Debug
 {
+    // Writes log messages from a background thread, so logging threads only pay for queueing
+    // instead of blocking on file and console flushes. Messages from all sinks go through one
+    // queue, which keeps their relative order in the log file. wrapApplication() stops the
+    // writer before the streams it writes to go away; after that messages are written
+    // synchronously again.
+    class LogWriter
+    {
+    public:
+        static LogWriter& instance();
+
+        /// Queue \a data to be written to \a stream. With \a blockUntilWritten the call
+        /// returns only once the message and everything queued before it hit the stream,
+        /// used for errors so they are on disk if the process dies right after.
+        void queue(std::ostream& stream, std::string data, bool blockUntilWritten = false);
+
+        /// Write all queued messages and stop the drain thread.
+        void stop();
+
+        ~LogWriter();
+
+    private:
+        struct Record
+        {
+            std::ostream* mStream;
+            std::string mData;
+        };
+
+        // Backpressure limit: loggers block once this many messages are pending, so a spamming
+        // thread cannot make the queue grow without bounds
+        static constexpr std::size_t sMaxRecords = 4096;
+
+        std::mutex mMutex;
+        std::condition_variable mHasRecords;
+        std::condition_variable mWritten;
+        std::deque<Record> mRecords;
+        std::uint64_t mQueuedCount = 0;
+        std::uint64_t mWrittenCount = 0;
+        bool mStopped = false;
+        bool mThreadDone = false;
+        std::thread mThread;
+
+        LogWriter();
+
+        void process();
+    };
+
     // ANSI colors for terminal
     enum Color
     {
@@ -91,20 +143,22 @@ namespace Debug
 
         std::streamsize writeImpl(const char *str, std::streamsize size, Level debugLevel) override
         {
-            out.write (str, size);
-            out.flush();
+            const bool blockUntilWritten = debugLevel == Error;
+
+            LogWriter::instance().queue(out, std::string(str, static_cast<std::size_t>(size)), blockUntilWritten);
 
             if(mUseColor)
             {
-                out2 << "\033[0;" << mColors[debugLevel] << "m";
-                out2.write (str, size);
-                out2 << "\033[0;" << Reset << "m";
+                std::ostringstream decorated;
+                decorated << "\033[0;" << mColors[debugLevel] << "m";
+                decorated.write(str, size);
+                decorated << "\033[0;" << Reset << "m";
+                LogWriter::instance().queue(out2, decorated.str());
             }
             else
             {
-                out2.write(str, size);
+                LogWriter::instance().queue(out2, std::string(str, static_cast<std::size_t>(size)));
             }
-            out2.flush();
 
             return size;
         }
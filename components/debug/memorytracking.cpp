@@ -0,0 +1,162 @@
+#include "memorytracking.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#include <osg/Stats>
+
+#include "debuglog.hpp"
+
+namespace
+{
+    constexpr std::size_t sDomainCount = static_cast<std::size_t>(Debug::MemoryDomain::Number);
+
+    // Never resized, never locked: safe to touch from inside operator new.
+    std::atomic<std::size_t> sBytes[sDomainCount];
+    std::atomic<std::size_t> sCounts[sDomainCount];
+
+    thread_local Debug::MemoryDomain sCurrentDomain = Debug::MemoryDomain::Other;
+
+    // The first call happens inside the first operator new of the process, so every
+    // allocation sees the same answer and tracked news always pair with tracked deletes.
+    bool trackingEnabled()
+    {
+        static const bool enabled = std::getenv("OPENMW_MEMORY_TRACKING") != nullptr;
+        return enabled;
+    }
+
+    constexpr std::uint32_t sHeaderMagic = 0x4d4f574d; // "MWOM"
+
+    // Prepended to every tracked allocation; 16 bytes keeps max_align_t alignment.
+    struct Header
+    {
+        std::uint32_t mMagic;
+        std::uint32_t mDomain;
+        std::uint64_t mSize;
+    };
+    static_assert(sizeof(Header) == 16, "Header must preserve allocation alignment");
+
+    const char* domainName(Debug::MemoryDomain domain)
+    {
+        switch (domain)
+        {
+            case Debug::MemoryDomain::Other: return "Other";
+            case Debug::MemoryDomain::Scene: return "Scene";
+            case Debug::MemoryDomain::Store: return "Store";
+            case Debug::MemoryDomain::Physics: return "Physics";
+            case Debug::MemoryDomain::NavMesh: return "NavMesh";
+            case Debug::MemoryDomain::Lua: return "Lua";
+            default: return "";
+        }
+    }
+}
+
+namespace Debug
+{
+
+    bool isMemoryTrackingEnabled()
+    {
+        return trackingEnabled();
+    }
+
+    ScopedMemoryDomain::ScopedMemoryDomain(MemoryDomain domain)
+        : mPrevious(sCurrentDomain)
+    {
+        sCurrentDomain = domain;
+    }
+
+    ScopedMemoryDomain::~ScopedMemoryDomain()
+    {
+        sCurrentDomain = mPrevious;
+    }
+
+    std::size_t getAllocatedBytes(MemoryDomain domain)
+    {
+        return sBytes[static_cast<std::size_t>(domain)];
+    }
+
+    std::size_t getAllocationCount(MemoryDomain domain)
+    {
+        return sCounts[static_cast<std::size_t>(domain)];
+    }
+
+    void reportMemoryStats(unsigned int frameNumber, osg::Stats& stats)
+    {
+        for (std::size_t i = 0; i < sDomainCount; ++i)
+        {
+            const MemoryDomain domain = static_cast<MemoryDomain>(i);
+            stats.setAttribute(frameNumber, std::string("Mem ") + domainName(domain) + " MB",
+                getAllocatedBytes(domain) / double(1024 * 1024));
+        }
+    }
+
+    void logMemoryStats()
+    {
+        if (!trackingEnabled())
+            return;
+        for (std::size_t i = 0; i < sDomainCount; ++i)
+        {
+            const MemoryDomain domain = static_cast<MemoryDomain>(i);
+            Log(::Debug::Info) << "Memory domain " << domainName(domain) << ": "
+                << getAllocatedBytes(domain) / (1024 * 1024) << " MB in "
+                << getAllocationCount(domain) << " allocations";
+        }
+    }
+
+}
+
+// Replacing the plain forms is enough: the default array, nothrow and sized
+// variants all forward to them. Aligned-new allocations stay untracked (they
+// consistently pair with the default aligned delete).
+void* operator new(std::size_t size)
+{
+    if (!trackingEnabled())
+    {
+        if (void* ptr = std::malloc(size ? size : 1))
+            return ptr;
+        throw std::bad_alloc();
+    }
+
+    void* mem = std::malloc(size + sizeof(Header));
+    if (!mem)
+        throw std::bad_alloc();
+
+    const std::size_t domain = static_cast<std::size_t>(sCurrentDomain);
+    Header* header = static_cast<Header*>(mem);
+    header->mMagic = sHeaderMagic;
+    header->mDomain = static_cast<std::uint32_t>(domain);
+    header->mSize = size;
+
+    sBytes[domain].fetch_add(size, std::memory_order_relaxed);
+    sCounts[domain].fetch_add(1, std::memory_order_relaxed);
+
+    return static_cast<char*>(mem) + sizeof(Header);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    if (!ptr)
+        return;
+
+    if (!trackingEnabled())
+    {
+        std::free(ptr);
+        return;
+    }
+
+    Header* header = reinterpret_cast<Header*>(static_cast<char*>(ptr) - sizeof(Header));
+    if (header->mMagic != sHeaderMagic)
+    {
+        // Not one of ours (e.g. handed over from a malloc-based API); leave it alone.
+        std::free(ptr);
+        return;
+    }
+
+    const std::size_t domain = header->mDomain;
+    sBytes[domain].fetch_sub(header->mSize, std::memory_order_relaxed);
+    sCounts[domain].fetch_sub(1, std::memory_order_relaxed);
+
+    std::free(header);
+}
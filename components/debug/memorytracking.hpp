@@ -0,0 +1,58 @@
+#ifndef COMPONENTS_DEBUG_MEMORYTRACKING_H
+#define COMPONENTS_DEBUG_MEMORYTRACKING_H
+
+#include <cstddef>
+
+namespace osg
+{
+    class Stats;
+}
+
+namespace Debug
+{
+    /// Allocation domains roughly matching the major resource-owning subsystems.
+    /// Allocations made while no domain scope is active are accounted to Other.
+    enum class MemoryDomain
+    {
+        Other,
+        Scene,
+        Store,
+        Physics,
+        NavMesh,
+        Lua,
+
+        Number
+    };
+
+    /// Whether per-domain allocation accounting is active. Enabled by setting the
+    /// OPENMW_MEMORY_TRACKING environment variable; when disabled the only overhead
+    /// is one branch per allocation.
+    bool isMemoryTrackingEnabled();
+
+    /// Tags all allocations made by the current thread with the given domain while
+    /// in scope. Scopes nest; the surrounding domain is restored on destruction.
+    class ScopedMemoryDomain
+    {
+        public:
+            explicit ScopedMemoryDomain(MemoryDomain domain);
+            ~ScopedMemoryDomain();
+
+            ScopedMemoryDomain(const ScopedMemoryDomain&) = delete;
+            ScopedMemoryDomain& operator=(const ScopedMemoryDomain&) = delete;
+
+        private:
+            MemoryDomain mPrevious;
+    };
+
+    std::size_t getAllocatedBytes(MemoryDomain domain);
+    std::size_t getAllocationCount(MemoryDomain domain);
+
+    /// Set the per-domain byte counts as frame attributes (shown on the resource
+    /// stats page and written to the stats file).
+    void reportMemoryStats(unsigned int frameNumber, osg::Stats& stats);
+
+    /// Write the current per-domain totals to the log.
+    void logMemoryStats();
+}
+
+#endif
@@ -1,10 +1,13 @@
 #include "asyncnavmeshupdater.hpp"
 #include "debug.hpp"
+#include "findsmoothpath.hpp"
 #include "makenavmesh.hpp"
+#include "recastglobalallocator.hpp"
 #include "settings.hpp"
 #include "version.hpp"
 
 #include <components/debug/debuglog.hpp>
+#include <components/debug/memorytracking.hpp>
 #include <components/misc/thread.hpp>
 #include <components/loadinglistener/loadinglistener.hpp>
 
@@ -13,6 +16,7 @@
 #include <osg/Stats>
 
 #include <algorithm>
+#include <limits>
 #include <numeric>
 #include <set>
 
@@ -31,13 +35,21 @@ namespace
     }
 
     int getMinDistanceTo(const TilePosition& position, int maxDistance,
-                         const std::set<std::tuple<osg::Vec3f, TilePosition>>& pushedTiles,
+                         const std::map<std::tuple<osg::Vec3f, TilePosition>, JobIt>& pushedTiles,
                          const std::set<std::tuple<osg::Vec3f, TilePosition>>& presentTiles)
     {
         int result = maxDistance;
-        for (const auto& [halfExtents, tile] : pushedTiles)
-            if (presentTiles.find(std::tie(halfExtents, tile)) == presentTiles.end())
-                result = std::min(result, getManhattanDistance(position, tile));
+        for (const auto& [agentAndTile, job] : pushedTiles)
+            if (presentTiles.find(agentAndTile) == presentTiles.end())
+                result = std::min(result, getManhattanDistance(position, std::get<1>(agentAndTile)));
+        return result;
+    }
+
+    int getMinDistanceTo(const TilePosition& position, const std::vector<TilePosition>& tiles)
+    {
+        int result = std::numeric_limits<int>::max();
+        for (const TilePosition& tile : tiles)
+            result = std::min(result, getManhattanDistance(position, tile));
         return result;
     }
 
@@ -48,9 +60,16 @@ namespace
         return UpdateType::Persistent;
     }
 
+    void updateMax(std::atomic_size_t& value, std::size_t candidate)
+    {
+        std::size_t current = value.load(std::memory_order_relaxed);
+        while (current < candidate
+               && !value.compare_exchange_weak(current, candidate, std::memory_order_relaxed));
+    }
+
     auto getPriority(const Job& job) noexcept
     {
-        return std::make_tuple(job.mProcessTime, job.mChangeType, job.mTryNumber, job.mDistanceToPlayer, job.mDistanceToOrigin);
+        return std::make_tuple(job.mProcessTime, job.mChangeType, job.mTryNumber, job.mDistanceToAgents, job.mDistanceToOrigin);
     }
 
     struct LessByJobPriority
@@ -76,14 +95,14 @@ namespace
 namespace DetourNavigator
 {
     Job::Job(const osg::Vec3f& agentHalfExtents, std::weak_ptr<GuardedNavMeshCacheItem> navMeshCacheItem,
-        const TilePosition& changedTile, ChangeType changeType, int distanceToPlayer,
+        const TilePosition& changedTile, ChangeType changeType, int distanceToAgents,
         std::chrono::steady_clock::time_point processTime)
         : mAgentHalfExtents(agentHalfExtents)
         , mNavMeshCacheItem(std::move(navMeshCacheItem))
         , mChangedTile(changedTile)
         , mProcessTime(processTime)
         , mChangeType(changeType)
-        , mDistanceToPlayer(distanceToPlayer)
+        , mDistanceToAgents(distanceToAgents)
         , mDistanceToOrigin(getManhattanDistance(changedTile, TilePosition {0, 0}))
     {
     }
@@ -95,6 +114,8 @@ namespace DetourNavigator
         , mOffMeshConnectionsManager(offMeshConnectionsManager)
         , mShouldStop()
         , mNavMeshTilesCache(settings.mMaxNavMeshTilesCacheSize)
+        , mNavMeshDiskCache(settings.mNavMeshDiskCachePath.empty() ? nullptr
+            : std::make_unique<const NavMeshDiskCache>(settings.mNavMeshDiskCachePath, settings))
     {
         for (std::size_t i = 0; i < mSettings.get().mAsyncNavMeshUpdaterThreads; ++i)
             mThreads.emplace_back([&] { process(); });
@@ -113,7 +134,7 @@ namespace DetourNavigator
 
     void AsyncNavMeshUpdater::post(const osg::Vec3f& agentHalfExtents,
         const SharedNavMeshCacheItem& navMeshCacheItem, const TilePosition& playerTile,
-        const std::map<TilePosition, ChangeType>& changedTiles)
+        const std::vector<TilePosition>& agentTiles, const std::map<TilePosition, ChangeType>& changedTiles)
     {
         bool playerTileChanged = false;
         {
@@ -122,18 +143,25 @@ namespace DetourNavigator
             *locked = playerTile;
         }
 
-        if (!playerTileChanged && changedTiles.empty())
-            return;
-
         const dtNavMeshParams params = *navMeshCacheItem->lockConst()->getImpl().getParams();
 
         const std::lock_guard<std::mutex> lock(mMutex);
 
-        if (playerTileChanged)
+        const bool agentTilesChanged = mAgentTiles != agentTiles;
+        if (agentTilesChanged)
+            mAgentTiles = agentTiles;
+
+        if (!playerTileChanged && !agentTilesChanged && changedTiles.empty())
+            return;
+
+        // The reference tiles moved, so the order of the queue is stale and is rebuilt below
+        const bool resort = playerTileChanged || agentTilesChanged;
+
+        if (resort)
         {
             for (JobIt job : mWaiting)
             {
-                job->mDistanceToPlayer = getManhattanDistance(job->mChangedTile, playerTile);
+                job->mDistanceToAgents = getMinDistanceTo(job->mChangedTile, mAgentTiles);
                 if (!shouldAddTile(job->mChangedTile, playerTile, std::min(mSettings.get().mMaxTilesNumber, params.maxTiles)))
                     job->mChangeType = ChangeType::remove;
             }
@@ -141,23 +169,41 @@ namespace DetourNavigator
 
         for (const auto& [changedTile, changeType] : changedTiles)
         {
-            if (mPushed.emplace(agentHalfExtents, changedTile).second)
-            {
-                const auto processTime = changeType == ChangeType::update
-                    ? mLastUpdates[std::tie(agentHalfExtents, changedTile)] + mSettings.get().mMinUpdateInterval
-                    : std::chrono::steady_clock::time_point();
+            const auto pushed = mPushed.emplace(std::make_tuple(agentHalfExtents, changedTile), mJobs.end());
 
-                const JobIt it = mJobs.emplace(mJobs.end(), agentHalfExtents, navMeshCacheItem, changedTile,
-                    changeType, getManhattanDistance(changedTile, playerTile), processTime);
+            const auto processTime = changeType == ChangeType::update
+                ? mLastUpdates[std::tie(agentHalfExtents, changedTile)] + mSettings.get().mMinUpdateInterval
+                : std::chrono::steady_clock::time_point();
 
-                if (playerTileChanged)
-                    mWaiting.push_back(it);
-                else
-                    insertPrioritizedJob(it, mWaiting);
+            if (!pushed.second)
+            {
+                // Collapse into the job that is already waiting for this tile; it will see the
+                // current state of the recast mesh when it runs
+                const JobIt job = pushed.first->second;
+                const ChangeType mergedChangeType = addChangeType(job->mChangeType, changeType);
+                const auto mergedProcessTime = std::min(job->mProcessTime, processTime);
+                if (mergedChangeType == job->mChangeType && mergedProcessTime == job->mProcessTime)
+                    continue;
+                if (!resort)
+                    mWaiting.erase(std::find(mWaiting.begin(), mWaiting.end(), job));
+                job->mChangeType = mergedChangeType;
+                job->mProcessTime = mergedProcessTime;
+                if (!resort)
+                    insertPrioritizedJob(job, mWaiting);
+                continue;
             }
+
+            const JobIt it = mJobs.emplace(mJobs.end(), agentHalfExtents, navMeshCacheItem, changedTile,
+                changeType, getMinDistanceTo(changedTile, mAgentTiles), processTime);
+            pushed.first->second = it;
+
+            if (resort)
+                mWaiting.push_back(it);
+            else
+                insertPrioritizedJob(it, mWaiting);
         }
 
-        if (playerTileChanged)
+        if (resort)
             std::sort(mWaiting.begin(), mWaiting.end(), LessByJobPriority {});
 
         Log(Debug::Debug) << "Posted " << mJobs.size() << " navigator jobs";
@@ -166,6 +212,69 @@ namespace DetourNavigator
             mHasJob.notify_all();
     }
 
+    std::size_t AsyncNavMeshUpdater::postPathQuery(PathQuery&& query)
+    {
+        if (mThreads.empty())
+            return 0;
+
+        const std::lock_guard<std::mutex> lock(mMutex);
+
+        // Drop completed queries nobody picked up, e.g. because the requesting AI package was discarded
+        const auto now = std::chrono::steady_clock::now();
+        for (auto it = mPathQueryResults.begin(); it != mPathQueryResults.end();)
+        {
+            if (now - it->second.second > std::chrono::seconds(10))
+                it = mPathQueryResults.erase(it);
+            else
+                ++it;
+        }
+
+        query.mId = mNextPathQueryId++;
+        const std::size_t id = query.mId;
+        mPathQueries.push_back(std::move(query));
+        mHasJob.notify_one();
+        return id;
+    }
+
+    std::optional<PathQueryResult> AsyncNavMeshUpdater::getPathQueryResult(std::size_t id)
+    {
+        const std::lock_guard<std::mutex> lock(mMutex);
+        const auto it = mPathQueryResults.find(id);
+        if (it == mPathQueryResults.end())
+            return std::nullopt;
+        PathQueryResult result = std::move(it->second.first);
+        mPathQueryResults.erase(it);
+        return result;
+    }
+
+    bool AsyncNavMeshUpdater::processPathQuery()
+    {
+        PathQuery query;
+        {
+            const std::lock_guard<std::mutex> lock(mMutex);
+            if (mPathQueries.empty())
+                return false;
+            query = std::move(mPathQueries.front());
+            mPathQueries.pop_front();
+        }
+
+        PathQueryResult result;
+        if (const auto navMeshCacheItem = query.mNavMeshCacheItem.lock())
+        {
+            const auto& settings = mSettings.get();
+            auto out = std::back_inserter(result.mPath);
+            result.mStatus = findSmoothPath(navMeshCacheItem->lockConst()->getImpl(),
+                toNavMeshCoordinates(settings, query.mAgentHalfExtents),
+                toNavMeshCoordinates(settings, query.mStepSize),
+                toNavMeshCoordinates(settings, query.mStart), toNavMeshCoordinates(settings, query.mEnd),
+                query.mFlags, query.mAreaCosts, settings, query.mEndTolerance, out);
+        }
+
+        const std::lock_guard<std::mutex> lock(mMutex);
+        mPathQueryResults.emplace(query.mId, std::make_pair(std::move(result), std::chrono::steady_clock::now()));
+        return true;
+    }
+
     void AsyncNavMeshUpdater::wait(Loading::Listener& listener, WaitConditionType waitConditionType)
     {
         if (mSettings.get().mWaitUntilMinDistanceToPlayer == 0)
@@ -246,18 +355,23 @@ namespace DetourNavigator
         std::size_t jobs = 0;
         std::size_t waiting = 0;
         std::size_t pushed = 0;
+        float jobDelay = 0.f;
 
         {
             const std::lock_guard<std::mutex> lock(mMutex);
             jobs = mJobs.size();
             waiting = mWaiting.size();
             pushed = mPushed.size();
+            jobDelay = mLastJobDelayMs;
         }
 
         stats.setAttribute(frameNumber, "NavMesh Jobs", jobs);
         stats.setAttribute(frameNumber, "NavMesh Waiting", waiting);
         stats.setAttribute(frameNumber, "NavMesh Pushed", pushed);
+        stats.setAttribute(frameNumber, "NavMesh Job Delay ms", jobDelay);
         stats.setAttribute(frameNumber, "NavMesh Processing", mProcessingTiles.lockConst()->size());
+        stats.setAttribute(frameNumber, "NavMesh TempAlloc Capacity", mTempAllocatorCapacity.load(std::memory_order_relaxed));
+        stats.setAttribute(frameNumber, "NavMesh TempAlloc Peak", mTempAllocatorPeakUsedSize.load(std::memory_order_relaxed));
 
         mNavMeshTilesCache.reportStats(frameNumber, stats);
     }
@@ -270,6 +384,9 @@ namespace DetourNavigator
         {
             try
             {
+                // Path queries are cheap compared to tile updates and latency sensitive, serve them first
+                if (processPathQuery())
+                    continue;
                 if (JobIt job = getNextJob(); job != mJobs.end())
                 {
                     const auto processed = processJob(*job);
@@ -278,6 +395,11 @@ namespace DetourNavigator
                         removeJob(job);
                     else
                         repost(job);
+                    // Tile builds route temp allocations through a per-thread stack allocator;
+                    // grow it between jobs if this job had to spill into the heap.
+                    const TempAllocatorUsage usage = RecastGlobalAllocator::resetTempAllocator();
+                    updateMax(mTempAllocatorCapacity, usage.mCapacity);
+                    updateMax(mTempAllocatorPeakUsedSize, usage.mPeakUsedSize);
                 }
                 else
                     cleanupLastUpdates();
@@ -292,6 +414,8 @@ namespace DetourNavigator
 
     bool AsyncNavMeshUpdater::processJob(const Job& job)
     {
+        Debug::ScopedMemoryDomain memoryDomain(Debug::MemoryDomain::NavMesh);
+
         Log(Debug::Debug) << "Process job for agent=(" << std::fixed << std::setprecision(2) << job.mAgentHalfExtents << ")"
             " by thread=" << std::this_thread::get_id();
 
@@ -307,7 +431,8 @@ namespace DetourNavigator
         const auto offMeshConnections = mOffMeshConnectionsManager.get().get(job.mChangedTile);
 
         const auto status = updateNavMesh(job.mAgentHalfExtents, recastMesh.get(), job.mChangedTile, playerTile,
-            offMeshConnections, mSettings, navMeshCacheItem, mNavMeshTilesCache, getUpdateType(job.mChangeType));
+            offMeshConnections, mSettings, navMeshCacheItem, mNavMeshTilesCache, mNavMeshDiskCache.get(),
+            getUpdateType(job.mChangeType));
 
         if (recastMesh != nullptr)
         {
@@ -361,6 +486,7 @@ namespace DetourNavigator
         {
             shouldStop = mShouldStop;
             return shouldStop
+                || !mPathQueries.empty()
                 || (!mWaiting.empty() && mWaiting.front()->mProcessTime <= std::chrono::steady_clock::now());
         };
 
@@ -374,10 +500,20 @@ namespace DetourNavigator
         if (shouldStop)
             return mJobs.end();
 
+        // Woken up to serve a path query, handled by the caller
+        if (mWaiting.empty() || mWaiting.front()->mProcessTime > std::chrono::steady_clock::now())
+            return mJobs.end();
+
         const JobIt job = mWaiting.front();
 
         mWaiting.pop_front();
 
+        // How far the updater runs behind: time the job spent in the queue beyond the point
+        // it became processable
+        using FloatMs = std::chrono::duration<float, std::milli>;
+        mLastJobDelayMs = std::chrono::duration_cast<FloatMs>(
+            std::chrono::steady_clock::now() - std::max(job->mPostTime, job->mProcessTime)).count();
+
         if (!lockTile(job->mAgentHalfExtents, job->mChangedTile))
         {
             ++job->mTryNumber;
@@ -422,7 +558,7 @@ namespace DetourNavigator
 
         const std::lock_guard<std::mutex> lock(mMutex);
 
-        if (mPushed.emplace(job->mAgentHalfExtents, job->mChangedTile).second)
+        if (mPushed.emplace(std::make_tuple(job->mAgentHalfExtents, job->mChangedTile), job).second)
         {
             ++job->mTryNumber;
             insertPrioritizedJob(job, mWaiting);
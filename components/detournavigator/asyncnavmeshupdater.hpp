@@ -3,8 +3,10 @@
 
 #include "navmeshcacheitem.hpp"
 #include "offmeshconnectionsmanager.hpp"
+#include "pathquery.hpp"
 #include "tilecachedrecastmeshmanager.hpp"
 #include "tileposition.hpp"
+#include "navmeshdiskcache.hpp"
 #include "navmeshtilescache.hpp"
 #include "waitconditiontype.hpp"
 
@@ -15,9 +17,11 @@
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <deque>
 #include <set>
 #include <thread>
+#include <vector>
 #include <tuple>
 #include <list>
 
@@ -53,19 +57,28 @@ namespace DetourNavigator
         return stream << "ChangeType::" << static_cast<int>(value);
     }
 
+    /// Combine two changes to the same tile into a single one covering both.
+    inline ChangeType addChangeType(const ChangeType current, const ChangeType add) noexcept
+    {
+        return current == add ? current : ChangeType::mixed;
+    }
+
     struct Job
     {
         const osg::Vec3f mAgentHalfExtents;
         const std::weak_ptr<GuardedNavMeshCacheItem> mNavMeshCacheItem;
         const TilePosition mChangedTile;
-        const std::chrono::steady_clock::time_point mProcessTime;
+        const std::chrono::steady_clock::time_point mPostTime = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::time_point mProcessTime;
         unsigned mTryNumber = 0;
         ChangeType mChangeType;
-        int mDistanceToPlayer;
+        /// Manhattan distance to the nearest tile occupied by a pathing agent (the player or
+        /// any actor position reported via Navigator::setAgentsPositions)
+        int mDistanceToAgents;
         const int mDistanceToOrigin;
 
         Job(const osg::Vec3f& agentHalfExtents, std::weak_ptr<GuardedNavMeshCacheItem> navMeshCacheItem,
-            const TilePosition& changedTile, ChangeType changeType, int distanceToPlayer,
+            const TilePosition& changedTile, ChangeType changeType, int distanceToAgents,
             std::chrono::steady_clock::time_point processTime);
     };
 
@@ -78,8 +91,19 @@ namespace DetourNavigator
             OffMeshConnectionsManager& offMeshConnectionsManager);
         ~AsyncNavMeshUpdater();
 
+        /// \a agentTiles are the tiles occupied by pathing agents (always including
+        /// \a playerTile); queued tile builds are ordered by the distance to the nearest of them.
         void post(const osg::Vec3f& agentHalfExtents, const SharedNavMeshCacheItem& mNavMeshCacheItem,
-            const TilePosition& playerTile, const std::map<TilePosition, ChangeType>& changedTiles);
+            const TilePosition& playerTile, const std::vector<TilePosition>& agentTiles,
+            const std::map<TilePosition, ChangeType>& changedTiles);
+
+        /// Queue an asynchronous path find request to be served by the worker threads.
+        /// \return a non-zero handle to retrieve the result with, or 0 if there are no worker threads
+        std::size_t postPathQuery(PathQuery&& query);
+
+        /// Fetch and remove the result of a previously posted path query.
+        /// \return the result, or std::nullopt while the query has not been processed yet
+        std::optional<PathQueryResult> getPathQueryResult(std::size_t id);
 
         void wait(Loading::Listener& listener, WaitConditionType waitConditionType);
 
@@ -96,9 +120,24 @@ namespace DetourNavigator
         std::condition_variable mProcessed;
         std::list<Job> mJobs;
         std::deque<JobIt> mWaiting;
-        std::set<std::tuple<osg::Vec3f, TilePosition>> mPushed;
+        std::deque<PathQuery> mPathQueries;
+        // Completed queries waiting to be picked up; abandoned entries are purged by age
+        std::map<std::size_t, std::pair<PathQueryResult, std::chrono::steady_clock::time_point>> mPathQueryResults;
+        std::size_t mNextPathQueryId = 1;
+        // Keys are the (agent, tile) pairs with a job waiting in mWaiting; a repeated change
+        // for a queued tile is merged into the waiting job instead of being queued again
+        std::map<std::tuple<osg::Vec3f, TilePosition>, JobIt> mPushed;
         Misc::ScopeGuarded<TilePosition> mPlayerTile;
+        std::vector<TilePosition> mAgentTiles;
+        // How long the most recently started job sat in the queue past its allowed process
+        // time, reported through reportStats to make a lagging updater visible
+        float mLastJobDelayMs = 0.f;
+        // Largest capacity and peak usage of the per-thread Recast temp allocators, reported
+        // through reportStats to make heap spills during tile builds visible
+        std::atomic_size_t mTempAllocatorCapacity {0};
+        std::atomic_size_t mTempAllocatorPeakUsedSize {0};
         NavMeshTilesCache mNavMeshTilesCache;
+        std::unique_ptr<const NavMeshDiskCache> mNavMeshDiskCache;
         Misc::ScopeGuarded<std::set<std::tuple<osg::Vec3f, TilePosition>>> mProcessingTiles;
         std::map<std::tuple<osg::Vec3f, TilePosition>, std::chrono::steady_clock::time_point> mLastUpdates;
         std::set<std::tuple<osg::Vec3f, TilePosition>> mPresentTiles;
@@ -106,6 +145,8 @@ namespace DetourNavigator
 
         void process() noexcept;
 
+        bool processPathQuery();
+
         bool processJob(const Job& job);
 
         JobIt getNextJob();
@@ -13,7 +13,7 @@ namespace DetourNavigator
     {
         if (!mImpl.addObject(id, shape, transform, areaType))
             return false;
-        mCached.lock()->reset();
+        std::atomic_store(&mCached, std::shared_ptr<RecastMesh>());
         return true;
     }
 
@@ -21,7 +21,7 @@ namespace DetourNavigator
     {
         if (!mImpl.updateObject(id, transform, areaType))
             return false;
-        mCached.lock()->reset();
+        std::atomic_store(&mCached, std::shared_ptr<RecastMesh>());
         return true;
     }
 
@@ -29,7 +29,7 @@ namespace DetourNavigator
     {
         auto object = mImpl.removeObject(id);
         if (object)
-            mCached.lock()->reset();
+            std::atomic_store(&mCached, std::shared_ptr<RecastMesh>());
         return object;
     }
 
@@ -38,7 +38,7 @@ namespace DetourNavigator
     {
         if (!mImpl.addWater(cellPosition, cellSize, shift))
             return false;
-        mCached.lock()->reset();
+        std::atomic_store(&mCached, std::shared_ptr<RecastMesh>());
         return true;
     }
 
@@ -46,7 +46,7 @@ namespace DetourNavigator
     {
         const auto water = mImpl.removeWater(cellPosition);
         if (water)
-            mCached.lock()->reset();
+            std::atomic_store(&mCached, std::shared_ptr<RecastMesh>());
         return water;
     }
 
@@ -55,7 +55,7 @@ namespace DetourNavigator
     {
         if (!mImpl.addHeightfield(cellPosition, cellSize, shift, shape))
             return false;
-        mCached.lock()->reset();
+        std::atomic_store(&mCached, std::shared_ptr<RecastMesh>());
         return true;
     }
 
@@ -63,17 +63,17 @@ namespace DetourNavigator
     {
         const auto cell = mImpl.removeHeightfield(cellPosition);
         if (cell)
-            mCached.lock()->reset();
+            std::atomic_store(&mCached, std::shared_ptr<RecastMesh>());
         return cell;
     }
 
     std::shared_ptr<RecastMesh> CachedRecastMeshManager::getMesh()
     {
-        std::shared_ptr<RecastMesh> cached = *mCached.lock();
+        std::shared_ptr<RecastMesh> cached = std::atomic_load(&mCached);
         if (cached != nullptr)
             return cached;
         cached = mImpl.getMesh();
-        *mCached.lock() = cached;
+        std::atomic_store(&mCached, cached);
         return cached;
     }
 
@@ -5,7 +5,7 @@
 #include "version.hpp"
 #include "heightfieldshape.hpp"
 
-#include <components/misc/guarded.hpp>
+#include <memory>
 
 namespace DetourNavigator
 {
@@ -40,7 +40,9 @@ namespace DetourNavigator
 
     private:
         RecastMeshManager mImpl;
-        Misc::ScopeGuarded<std::shared_ptr<RecastMesh>> mCached;
+        // Accessed only via std::atomic_load/std::atomic_store so tile builds can
+        // take the cached mesh without contending on a lock.
+        std::shared_ptr<RecastMesh> mCached;
     };
 }
 
@@ -4,10 +4,15 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdlib>
+#include <map>
+#include <queue>
+#include <tuple>
 
 namespace DetourNavigator
 {
-    std::vector<dtPolyRef> fixupCorridor(const std::vector<dtPolyRef>& path, const std::vector<dtPolyRef>& visited)
+    void fixupCorridor(std::vector<dtPolyRef>& path, const std::vector<dtPolyRef>& visited,
+        std::vector<dtPolyRef>& temp)
     {
         std::vector<dtPolyRef>::const_reverse_iterator furthestVisited;
 
@@ -21,9 +26,9 @@ namespace DetourNavigator
             return true;
         });
 
-        // If no intersection found just return current path.
+        // If no intersection found just keep the current path.
         if (it == path.rend())
-            return path;
+            return;
         const auto furthestPath = it.base() - 1;
 
         // Concatenate paths.
@@ -34,13 +39,13 @@ namespace DetourNavigator
         //            ^ furthestPath
         //  result: x b_n ... b_1 D
 
-        std::vector<dtPolyRef> result;
-        result.reserve(static_cast<std::size_t>(furthestVisited - visited.rbegin())
-                       + static_cast<std::size_t>(path.end() - furthestPath) - 1);
-        std::copy(visited.rbegin(), furthestVisited + 1, std::back_inserter(result));
-        std::copy(furthestPath + 1, path.end(), std::back_inserter(result));
-
-        return result;
+        // Build into the temp buffer and swap so both vectors keep their capacity
+        temp.clear();
+        temp.reserve(static_cast<std::size_t>(furthestVisited - visited.rbegin())
+                     + static_cast<std::size_t>(path.end() - furthestPath) - 1);
+        std::copy(visited.rbegin(), furthestVisited + 1, std::back_inserter(temp));
+        std::copy(furthestPath + 1, path.end(), std::back_inserter(temp));
+        path.swap(temp);
     }
 
     // This function checks if the path has a small U-turn, that is,
@@ -54,16 +59,16 @@ namespace DetourNavigator
     //  +-S-+-T-+
     //  |:::|   | <-- the step can end up in here, resulting U-turn path.
     //  +---+---+
-    std::vector<dtPolyRef> fixupShortcuts(const std::vector<dtPolyRef>& path, const dtNavMeshQuery& navQuery)
+    void fixupShortcuts(std::vector<dtPolyRef>& path, const dtNavMeshQuery& navQuery)
     {
         if (path.size() < 3)
-            return path;
+            return;
 
         // Get connected polygons
         const dtMeshTile* tile = nullptr;
         const dtPoly* poly = nullptr;
         if (dtStatusFailed(navQuery.getAttachedNavMesh()->getTileAndPolyByRef(path[0], &tile, &poly)))
-            return path;
+            return;
 
         const std::size_t maxNeis = 16;
         std::array<dtPolyRef, maxNeis> neis;
@@ -95,14 +100,11 @@ namespace DetourNavigator
             }
         }
         if (cut <= 1)
-            return path;
+            return;
 
-        std::vector<dtPolyRef> result;
+        // Keep the first polygon and drop the ones the shortcut skips over
         const auto offset = cut - 1;
-        result.reserve(1 + path.size() - offset);
-        result.push_back(path.front());
-        std::copy(path.begin() + std::ptrdiff_t(offset), path.end(), std::back_inserter(result));
-        return result;
+        path.erase(path.begin() + 1, path.begin() + std::ptrdiff_t(offset));
     }
 
     std::optional<SteerTarget> getSteerTarget(const dtNavMeshQuery& navMeshQuery, const osg::Vec3f& startPos,
@@ -155,4 +157,126 @@ namespace DetourNavigator
             return 0;
         return ref;
     }
+
+    FindSmoothPathScratch& getFindSmoothPathScratch()
+    {
+        static thread_local FindSmoothPathScratch scratch;
+        return scratch;
+    }
+
+    dtNavMeshQuery& getPooledNavMeshQuery()
+    {
+        static thread_local dtNavMeshQuery query;
+        return query;
+    }
+
+    std::optional<osg::Vec3f> findCoarseWaypoint(const dtNavMesh& navMesh, const Settings& settings,
+        const osg::Vec3f& start, const osg::Vec3f& end)
+    {
+        // How many tiles ahead of the start the detailed query is aimed, which is also the
+        // distance below which the coarse pass is skipped entirely.
+        constexpr int waypointDistance = 2;
+        // Upper bound on the tile search. The navmesh holds at most "max tiles number" tiles, so
+        // this is only reached when the end tile is not present and the whole grid gets flooded.
+        constexpr std::size_t maxVisitedTiles = 1024;
+
+        const TilePosition startTile = getTilePosition(settings, start);
+        const TilePosition endTile = getTilePosition(settings, end);
+
+        const auto heuristic = [&] (const TilePosition& tile)
+        {
+            return std::abs(tile.x() - endTile.x()) + std::abs(tile.y() - endTile.y());
+        };
+
+        if (heuristic(startTile) <= waypointDistance)
+            return std::nullopt;
+
+        if (navMesh.getTileAt(startTile.x(), startTile.y(), 0) == nullptr)
+            return std::nullopt;
+
+        struct Visited
+        {
+            TilePosition mParent;
+            int mCost;
+        };
+
+        // A* over the tile grid: a present tile is a node, edge-adjacent present tiles are
+        // connected. Tiles only link across shared edges in Detour, hence no diagonal moves
+        // and the Manhattan distance as an admissible estimate.
+        std::map<TilePosition, Visited> visited;
+        using Candidate = std::tuple<int, int, TilePosition>; // estimated total cost, cost, tile
+        std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> queue;
+
+        visited.emplace(startTile, Visited {startTile, 0});
+        queue.emplace(heuristic(startTile), 0, startTile);
+
+        // When the end tile is absent or unreachable settle for the expanded tile closest to it,
+        // so the route still makes progress towards the destination.
+        TilePosition closestTile = startTile;
+        int closestEstimate = heuristic(startTile);
+        bool reached = false;
+
+        while (!queue.empty() && visited.size() < maxVisitedTiles)
+        {
+            const auto [estimate, cost, tile] = queue.top();
+            queue.pop();
+
+            if (cost > visited.find(tile)->second.mCost)
+                continue;
+
+            if (tile == endTile)
+            {
+                reached = true;
+                break;
+            }
+
+            if (estimate - cost < closestEstimate)
+            {
+                closestEstimate = estimate - cost;
+                closestTile = tile;
+            }
+
+            const std::array<TilePosition, 4> neighbours {
+                TilePosition(tile.x() - 1, tile.y()),
+                TilePosition(tile.x() + 1, tile.y()),
+                TilePosition(tile.x(), tile.y() - 1),
+                TilePosition(tile.x(), tile.y() + 1),
+            };
+            for (const TilePosition& neighbour : neighbours)
+            {
+                if (navMesh.getTileAt(neighbour.x(), neighbour.y(), 0) == nullptr)
+                    continue;
+                const auto it = visited.find(neighbour);
+                if (it != visited.end() && it->second.mCost <= cost + 1)
+                    continue;
+                if (it == visited.end())
+                    visited.emplace(neighbour, Visited {tile, cost + 1});
+                else
+                    it->second = Visited {tile, cost + 1};
+                queue.emplace(cost + 1 + heuristic(neighbour), cost + 1, neighbour);
+            }
+        }
+
+        TilePosition waypointTile = reached ? endTile : closestTile;
+        if (waypointTile == startTile)
+            return std::nullopt;
+
+        // Walk the parent chain back until waypointDistance steps from the start remain
+        const int routeCost = visited.find(waypointTile)->second.mCost;
+        auto node = visited.find(waypointTile);
+        while (node->second.mCost > waypointDistance)
+        {
+            waypointTile = node->second.mParent;
+            node = visited.find(waypointTile);
+        }
+        if (waypointTile == startTile || waypointTile == endTile)
+            return std::nullopt;
+
+        const TileBounds bounds = makeTileBounds(settings, waypointTile);
+        const osg::Vec2f center = (bounds.mMin + bounds.mMax) * 0.5f;
+        // Estimate the height from the start and end heights by the progress made along the
+        // route; the nearest polygon lookup around the waypoint snaps it onto the navmesh.
+        const float progress = static_cast<float>(node->second.mCost) / static_cast<float>(routeCost);
+        return osg::Vec3f(center.x(), start.y() + (end.y() - start.y()) * progress, center.y());
+    }
 }
@@ -17,6 +17,7 @@
 #include <osg/Vec3f>
 
 #include <cassert>
+#include <optional>
 #include <vector>
 
 class dtNavMesh;
@@ -30,7 +31,8 @@ namespace DetourNavigator
         return (osg::Vec2f(v1.x(), v1.z()) - osg::Vec2f(v2.x(), v2.z())).length() < r;
     }
 
-    std::vector<dtPolyRef> fixupCorridor(const std::vector<dtPolyRef>& path, const std::vector<dtPolyRef>& visited);
+    void fixupCorridor(std::vector<dtPolyRef>& path, const std::vector<dtPolyRef>& visited,
+        std::vector<dtPolyRef>& temp);
 
     // This function checks if the path has a small U-turn, that is,
     // a polygon further in the path is adjacent to the first polygon
@@ -43,7 +45,32 @@ namespace DetourNavigator
     //  +-S-+-T-+
     //  |:::|   | <-- the step can end up in here, resulting U-turn path.
     //  +---+---+
-    std::vector<dtPolyRef> fixupShortcuts(const std::vector<dtPolyRef>& path, const dtNavMeshQuery& navQuery);
+    void fixupShortcuts(std::vector<dtPolyRef>& path, const dtNavMeshQuery& navQuery);
+
+    /// Buffers reused between findSmoothPath calls so steady-state path queries do not
+    /// allocate; obtained per thread via getFindSmoothPathScratch.
+    struct FindSmoothPathScratch
+    {
+        std::vector<dtPolyRef> mPolygonPath;
+        std::vector<dtPolyRef> mFixup;
+        std::vector<dtPolyRef> mVisited;
+    };
+
+    /// This thread's scratch buffers for findSmoothPath.
+    FindSmoothPathScratch& getFindSmoothPathScratch();
+
+    /// Coarse planning pass for long-range queries: A* over the navmesh tile grid, treating each
+    /// present tile as a node connected to its edge-adjacent present tiles. Returns a point a few
+    /// tiles along the coarse route for the detailed polygon query to aim at, or std::nullopt when
+    /// start and end are close enough for a direct query. When the end tile is absent or
+    /// unreachable the route heads for the expanded tile closest to it instead of failing.
+    std::optional<osg::Vec3f> findCoarseWaypoint(const dtNavMesh& navMesh, const Settings& settings,
+        const osg::Vec3f& start, const osg::Vec3f& end);
+
+    /// This thread's dtNavMeshQuery, to be (re)initialized with initNavMeshQuery before use.
+    /// Detour keeps the query's node pools between init calls unless maxNodes grows, so
+    /// reusing one query per thread avoids the pool allocation on every path request.
+    dtNavMeshQuery& getPooledNavMeshQuery();
 
     struct SteerTarget
     {
@@ -102,50 +129,46 @@ namespace DetourNavigator
     dtPolyRef findNearestPoly(const dtNavMeshQuery& query, const dtQueryFilter& filter,
             const osg::Vec3f& center, const osg::Vec3f& halfExtents);
 
-    struct MoveAlongSurfaceResult
-    {
-        osg::Vec3f mResultPos;
-        std::vector<dtPolyRef> mVisited;
-    };
-
-    inline std::optional<MoveAlongSurfaceResult> moveAlongSurface(const dtNavMeshQuery& navMeshQuery,
+    inline std::optional<osg::Vec3f> moveAlongSurface(const dtNavMeshQuery& navMeshQuery,
         const dtPolyRef startRef, const osg::Vec3f& startPos, const osg::Vec3f& endPos, const dtQueryFilter& filter,
-        const std::size_t maxVisitedSize)
+        const std::size_t maxVisitedSize, std::vector<dtPolyRef>& visited)
     {
-        MoveAlongSurfaceResult result;
-        result.mVisited.resize(maxVisitedSize);
+        osg::Vec3f resultPos;
+        visited.resize(maxVisitedSize);
         int visitedNumber = 0;
         const auto status = navMeshQuery.moveAlongSurface(startRef, startPos.ptr(), endPos.ptr(),
-            &filter, result.mResultPos.ptr(), result.mVisited.data(), &visitedNumber, static_cast<int>(maxVisitedSize));
+            &filter, resultPos.ptr(), visited.data(), &visitedNumber, static_cast<int>(maxVisitedSize));
         if (!dtStatusSucceed(status))
             return {};
         assert(visitedNumber >= 0);
         assert(visitedNumber <= static_cast<int>(maxVisitedSize));
-        result.mVisited.resize(static_cast<std::size_t>(visitedNumber));
-        return {std::move(result)};
+        visited.resize(static_cast<std::size_t>(visitedNumber));
+        return {resultPos};
     }
 
-    inline std::optional<std::vector<dtPolyRef>> findPath(const dtNavMeshQuery& navMeshQuery, const dtPolyRef startRef,
+    inline bool findPolygonPath(const dtNavMeshQuery& navMeshQuery, const dtPolyRef startRef,
         const dtPolyRef endRef, const osg::Vec3f& startPos, const osg::Vec3f& endPos, const dtQueryFilter& queryFilter,
-        const std::size_t maxSize)
+        const std::size_t maxSize, std::vector<dtPolyRef>& result)
     {
         int pathLen = 0;
-        std::vector<dtPolyRef> result(maxSize);
+        result.resize(maxSize);
         const auto status = navMeshQuery.findPath(startRef, endRef, startPos.ptr(), endPos.ptr(), &queryFilter,
             result.data(), &pathLen, static_cast<int>(maxSize));
         if (!dtStatusSucceed(status))
-            return {};
+            return false;
         assert(pathLen >= 0);
         assert(static_cast<std::size_t>(pathLen) <= maxSize);
         result.resize(static_cast<std::size_t>(pathLen));
-        return {std::move(result)};
+        return true;
     }
 
     template <class OutputIterator>
     Status makeSmoothPath(const dtNavMesh& navMesh, const dtNavMeshQuery& navMeshQuery,
             const dtQueryFilter& filter, const osg::Vec3f& start, const osg::Vec3f& end, const float stepSize,
-            std::vector<dtPolyRef> polygonPath, std::size_t maxSmoothPathSize, OutputIterator& out)
+            FindSmoothPathScratch& scratch, std::size_t maxSmoothPathSize, OutputIterator& out)
     {
+        std::vector<dtPolyRef>& polygonPath = scratch.mPolygonPath;
+
         // Iterate over the path to find smooth path on the detail mesh surface.
         osg::Vec3f iterPos;
         navMeshQuery.closestPointOnPoly(polygonPath.front(), start.ptr(), iterPos.ptr(), nullptr);
@@ -182,16 +205,17 @@ namespace DetourNavigator
                 len = stepSize / len;
 
             const osg::Vec3f moveTgt = iterPos + delta * len;
-            const auto result = moveAlongSurface(navMeshQuery, polygonPath.front(), iterPos, moveTgt, filter, 16);
+            const auto resultPos = moveAlongSurface(navMeshQuery, polygonPath.front(), iterPos, moveTgt, filter, 16,
+                                                    scratch.mVisited);
 
-            if (!result)
+            if (!resultPos)
                 return Status::MoveAlongSurfaceFailed;
 
-            polygonPath = fixupCorridor(polygonPath, result->mVisited);
-            polygonPath = fixupShortcuts(polygonPath, navMeshQuery);
+            fixupCorridor(polygonPath, scratch.mVisited, scratch.mFixup);
+            fixupShortcuts(polygonPath, navMeshQuery);
 
             // Handle end of path and off-mesh links when close enough.
-            if (endOfPath && inRange(result->mResultPos, steerTarget->steerPos, slop))
+            if (endOfPath && inRange(*resultPos, steerTarget->steerPos, slop))
             {
                 // Reached end of path.
                 iterPos = targetPos;
@@ -199,7 +223,7 @@ namespace DetourNavigator
                 ++smoothPathSize;
                 break;
             }
-            else if (offMeshConnection && inRange(result->mResultPos, steerTarget->steerPos, slop))
+            else if (offMeshConnection && inRange(*resultPos, steerTarget->steerPos, slop))
             {
                 // Advance the path up to and over the off-mesh connection.
                 dtPolyRef prevRef = 0;
@@ -240,10 +264,10 @@ namespace DetourNavigator
                 }
             }
 
-            if (dtStatusFailed(navMeshQuery.getPolyHeight(polygonPath.front(), result->mResultPos.ptr(), &iterPos.y())))
+            if (dtStatusFailed(navMeshQuery.getPolyHeight(polygonPath.front(), resultPos->ptr(), &iterPos.y())))
                 return Status::GetPolyHeightFailed;
-            iterPos.x() = result->mResultPos.x();
-            iterPos.z() = result->mResultPos.z();
+            iterPos.x() = resultPos->x();
+            iterPos.z() = resultPos->z();
 
             // Store results.
             *out++ = iterPos;
@@ -258,12 +282,12 @@ namespace DetourNavigator
             const osg::Vec3f& start, const osg::Vec3f& end, const Flags includeFlags, const AreaCosts& areaCosts,
             const Settings& settings, float endTolerance, OutputIterator& out)
     {
-        dtNavMeshQuery navMeshQuery;
+        dtNavMeshQuery& navMeshQuery = getPooledNavMeshQuery();
         if (!initNavMeshQuery(navMeshQuery, navMesh, settings.mMaxNavMeshQueryNodes))
             return Status::InitNavMeshQueryFailed;
 
         dtQueryFilter queryFilter;
-        queryFilter.setIncludeFlags(includeFlags);
+        queryFilter.setIncludeFlags(includeFlags & static_cast<Flags>(~Flag_useCoarsePath));
         queryFilter.setAreaCost(AreaType_water, areaCosts.mWater);
         queryFilter.setAreaCost(AreaType_door, areaCosts.mDoor);
         queryFilter.setAreaCost(AreaType_pathgrid, areaCosts.mPathgrid);
@@ -278,22 +302,45 @@ namespace DetourNavigator
 
         const dtPolyRef endRef = findNearestPoly(navMeshQuery, queryFilter, end,
             polyHalfExtents + osg::Vec3f(endTolerance, endTolerance, endTolerance));
-        if (endRef == 0)
+
+        // Long-range queries: a flat polygon search across every tile between start and end either
+        // exhausts the query node budget or dominates the query cost, and fails outright when the
+        // end lies beyond the built navmesh area. Plan coarsely over the tile grid first and aim
+        // the detailed query at a waypoint a few tiles along the coarse route. Such routes are
+        // reported as partial paths, so callers refine them leg by leg as the actor advances.
+        osg::Vec3f targetPos = end;
+        dtPolyRef targetRef = endRef;
+        bool coarseLeg = false;
+        if (const auto waypoint = (includeFlags & Flag_useCoarsePath) != 0
+                ? findCoarseWaypoint(navMesh, settings, start, end) : std::nullopt)
+        {
+            const float tileExtent = getTileSize(settings) / 2;
+            const dtPolyRef waypointRef = findNearestPoly(navMeshQuery, queryFilter, *waypoint,
+                osg::Vec3f(tileExtent, 2 * tileExtent, tileExtent));
+            if (waypointRef != 0)
+            {
+                targetPos = *waypoint;
+                targetRef = waypointRef;
+                coarseLeg = true;
+            }
+        }
+
+        if (targetRef == 0)
             return Status::EndPolygonNotFound;
 
-        const auto polygonPath = findPath(navMeshQuery, startRef, endRef, start, end, queryFilter,
-                                          settings.mMaxPolygonPathSize);
+        FindSmoothPathScratch& scratch = getFindSmoothPathScratch();
 
-        if (!polygonPath)
+        if (!findPolygonPath(navMeshQuery, startRef, targetRef, start, targetPos, queryFilter,
+                             settings.mMaxPolygonPathSize, scratch.mPolygonPath))
             return Status::FindPathOverPolygonsFailed;
 
-        if (polygonPath->empty())
+        if (scratch.mPolygonPath.empty())
             return Status::Success;
 
-        const bool partialPath = polygonPath->back() != endRef;
+        const bool partialPath = coarseLeg || scratch.mPolygonPath.back() != targetRef;
         auto outTransform = OutputTransformIterator<OutputIterator>(out, settings);
-        const Status smoothStatus = makeSmoothPath(navMesh, navMeshQuery, queryFilter, start, end, stepSize,
-                                                   std::move(*polygonPath), settings.mMaxSmoothPathSize, outTransform);
+        const Status smoothStatus = makeSmoothPath(navMesh, navMeshQuery, queryFilter, start, targetPos, stepSize,
+                                                   scratch, settings.mMaxSmoothPathSize, outTransform);
 
         if (smoothStatus != Status::Success)
             return smoothStatus;
@@ -14,6 +14,9 @@ namespace DetourNavigator
         Flag_swim = 1 << 1,
         Flag_openDoor = 1 << 2,
         Flag_usePathgrid = 1 << 3,
+        // Not a surface filter: allows findPath to plan long routes coarsely over the tile
+        // grid and return a partial path towards an intermediate waypoint
+        Flag_useCoarsePath = 1 << 4,
     };
 
     inline std::ostream& operator <<(std::ostream& stream, const Flag value)
@@ -30,6 +33,8 @@ namespace DetourNavigator
                 return stream << "openDoor";
             case Flag_usePathgrid:
                 return stream << "usePathgrid";
+            case Flag_useCoarsePath:
+                return stream << "useCoarsePath";
         }
 
         return stream;
@@ -48,7 +53,7 @@ namespace DetourNavigator
             else
             {
                 bool first = true;
-                for (const auto flag : {Flag_walk, Flag_swim, Flag_openDoor, Flag_usePathgrid})
+                for (const auto flag : {Flag_walk, Flag_swim, Flag_openDoor, Flag_usePathgrid, Flag_useCoarsePath})
                 {
                     if (value.mValue & flag)
                     {
@@ -6,6 +6,7 @@
 #include "settingsutils.hpp"
 #include "sharednavmesh.hpp"
 #include "flags.hpp"
+#include "navmeshdiskcache.hpp"
 #include "navmeshtilescache.hpp"
 #include "preparednavmeshdata.hpp"
 #include "navmeshdata.hpp"
@@ -510,7 +511,8 @@ namespace DetourNavigator
     UpdateNavMeshStatus updateNavMesh(const osg::Vec3f& agentHalfExtents, const RecastMesh* recastMesh,
         const TilePosition& changedTile, const TilePosition& playerTile,
         const std::vector<OffMeshConnection>& offMeshConnections, const Settings& settings,
-        const SharedNavMeshCacheItem& navMeshCacheItem, NavMeshTilesCache& navMeshTilesCache, UpdateType updateType)
+        const SharedNavMeshCacheItem& navMeshCacheItem, NavMeshTilesCache& navMeshTilesCache,
+        const NavMeshDiskCache* diskCache, UpdateType updateType)
     {
         Log(Debug::Debug) << std::fixed << std::setprecision(2) <<
             "Update NavMesh with multiple tiles:" <<
@@ -557,8 +559,17 @@ namespace DetourNavigator
 
         if (!cachedNavMeshData)
         {
-            auto prepared = prepareNavMeshTileData(*recastMesh, changedTile, recastMeshBounds,
-                                                   agentHalfExtents, settings);
+            auto prepared = diskCache == nullptr ? nullptr
+                : diskCache->load(agentHalfExtents, changedTile, *recastMesh);
+
+            if (prepared == nullptr)
+            {
+                prepared = prepareNavMeshTileData(*recastMesh, changedTile, recastMeshBounds,
+                                                  agentHalfExtents, settings);
+
+                if (prepared != nullptr && diskCache != nullptr && updateType == UpdateType::Persistent)
+                    diskCache->store(agentHalfExtents, changedTile, *recastMesh, *prepared);
+            }
 
             if (prepared == nullptr)
             {
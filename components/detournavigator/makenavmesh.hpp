@@ -17,6 +17,7 @@ class dtNavMesh;
 
 namespace DetourNavigator
 {
+    class NavMeshDiskCache;
     class RecastMesh;
     struct Settings;
     struct PreparedNavMeshData;
@@ -53,10 +54,12 @@ namespace DetourNavigator
         Temporary
     };
 
+    /// @param diskCache optional persistent tile storage, may be nullptr.
     UpdateNavMeshStatus updateNavMesh(const osg::Vec3f& agentHalfExtents, const RecastMesh* recastMesh,
         const TilePosition& changedTile, const TilePosition& playerTile,
         const std::vector<OffMeshConnection>& offMeshConnections, const Settings& settings,
-        const SharedNavMeshCacheItem& navMeshCacheItem, NavMeshTilesCache& navMeshTilesCache, UpdateType updateType);
+        const SharedNavMeshCacheItem& navMeshCacheItem, NavMeshTilesCache& navMeshTilesCache,
+        const NavMeshDiskCache* diskCache, UpdateType updateType);
 }
 
 #endif
@@ -6,13 +6,16 @@
 #include "settings.hpp"
 #include "objectid.hpp"
 #include "navmeshcacheitem.hpp"
+#include "pathquery.hpp"
 #include "recastmeshtiles.hpp"
 #include "waitconditiontype.hpp"
 #include "heightfieldshape.hpp"
 
 #include <components/resource/bulletshape.hpp>
 
+#include <optional>
 #include <variant>
+#include <vector>
 
 namespace ESM
 {
@@ -155,6 +158,14 @@ namespace DetourNavigator
          */
         virtual void updatePlayerPosition(const osg::Vec3f& playerPosition) = 0;
 
+        /**
+         * @brief setAgentsPositions sets world positions of the actors that may request paths.
+         * They are used to order queued tile builds by the distance to the nearest actor; the
+         * player position passed to update remains the anchor for which tiles are built at all.
+         * @param positions current positions of the actors, the player does not have to be included.
+         */
+        virtual void setAgentsPositions(const std::vector<osg::Vec3f>& positions) = 0;
+
         /**
          * @brief disable navigator updates
          */
@@ -198,6 +209,22 @@ namespace DetourNavigator
                 toNavMeshCoordinates(settings, end), includeFlags, areaCosts, settings, endTolerance, out);
         }
 
+        /**
+         * @brief findPathAsync queues a path find request to be served by the navigator's background
+         * threads instead of blocking the calling thread. Parameters match findPath.
+         * @return a non-zero handle to pass to getPathQueryResult, or 0 if asynchronous queries are
+         * not available and the caller should fall back to findPath.
+         */
+        virtual std::size_t findPathAsync(const osg::Vec3f& agentHalfExtents, const float stepSize,
+            const osg::Vec3f& start, const osg::Vec3f& end, const Flags includeFlags,
+            const DetourNavigator::AreaCosts& areaCosts, float endTolerance) = 0;
+
+        /**
+         * @brief getPathQueryResult fetches and removes the result of a findPathAsync request.
+         * @return the path and status, or std::nullopt while the query has not been processed yet.
+         */
+        virtual std::optional<PathQueryResult> getPathQueryResult(std::size_t handle) = 0;
+
         /**
          * @brief getNavMesh returns navmesh for specific agent half extents
          * @return navmesh
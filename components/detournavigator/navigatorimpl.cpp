@@ -145,7 +145,12 @@ namespace DetourNavigator
             return;
         removeUnusedNavMeshes();
         for (const auto& v : mAgents)
-            mNavMeshManager.update(playerPosition, v.first);
+            mNavMeshManager.update(playerPosition, mAgentsPositions, v.first);
+    }
+
+    void NavigatorImpl::setAgentsPositions(const std::vector<osg::Vec3f>& positions)
+    {
+        mAgentsPositions = positions;
     }
 
     void NavigatorImpl::updatePlayerPosition(const osg::Vec3f& playerPosition)
@@ -172,6 +177,19 @@ namespace DetourNavigator
         return mNavMeshManager.getNavMesh(agentHalfExtents);
     }
 
+    std::size_t NavigatorImpl::findPathAsync(const osg::Vec3f& agentHalfExtents, const float stepSize,
+        const osg::Vec3f& start, const osg::Vec3f& end, const Flags includeFlags,
+        const DetourNavigator::AreaCosts& areaCosts, float endTolerance)
+    {
+        return mNavMeshManager.findPathAsync(agentHalfExtents, stepSize, start, end, includeFlags,
+            areaCosts, endTolerance);
+    }
+
+    std::optional<PathQueryResult> NavigatorImpl::getPathQueryResult(std::size_t handle)
+    {
+        return mNavMeshManager.getPathQueryResult(handle);
+    }
+
     std::map<osg::Vec3f, SharedNavMeshCacheItem> NavigatorImpl::getNavMeshes() const
     {
         return mNavMeshManager.getNavMeshes();
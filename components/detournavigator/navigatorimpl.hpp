@@ -48,12 +48,20 @@ namespace DetourNavigator
 
         void updatePlayerPosition(const osg::Vec3f& playerPosition) override;
 
+        void setAgentsPositions(const std::vector<osg::Vec3f>& positions) override;
+
         void setUpdatesEnabled(bool enabled) override;
 
         void wait(Loading::Listener& listener, WaitConditionType waitConditionType) override;
 
         SharedNavMeshCacheItem getNavMesh(const osg::Vec3f& agentHalfExtents) const override;
 
+        std::size_t findPathAsync(const osg::Vec3f& agentHalfExtents, const float stepSize, const osg::Vec3f& start,
+            const osg::Vec3f& end, const Flags includeFlags, const DetourNavigator::AreaCosts& areaCosts,
+            float endTolerance) override;
+
+        std::optional<PathQueryResult> getPathQueryResult(std::size_t handle) override;
+
         std::map<osg::Vec3f, SharedNavMeshCacheItem> getNavMeshes() const override;
 
         const Settings& getSettings() const override;
@@ -69,6 +77,7 @@ namespace DetourNavigator
         NavMeshManager mNavMeshManager;
         bool mUpdatesEnabled;
         std::optional<TilePosition> mLastPlayerPosition;
+        std::vector<osg::Vec3f> mAgentsPositions;
         std::map<osg::Vec3f, std::size_t> mAgents;
         std::unordered_map<ObjectId, ObjectId> mAvoidIds;
         std::unordered_map<ObjectId, ObjectId> mWaterIds;
@@ -73,6 +73,8 @@ namespace DetourNavigator
 
         void updatePlayerPosition(const osg::Vec3f& /*playerPosition*/) override {};
 
+        void setAgentsPositions(const std::vector<osg::Vec3f>& /*positions*/) override {}
+
         void setUpdatesEnabled(bool /*enabled*/) override {}
 
         void wait(Loading::Listener& /*listener*/, WaitConditionType /*waitConditionType*/) override {}
@@ -82,6 +84,18 @@ namespace DetourNavigator
             return mEmptyNavMeshCacheItem;
         }
 
+        std::size_t findPathAsync(const osg::Vec3f& /*agentHalfExtents*/, const float /*stepSize*/,
+            const osg::Vec3f& /*start*/, const osg::Vec3f& /*end*/, const Flags /*includeFlags*/,
+            const DetourNavigator::AreaCosts& /*areaCosts*/, float /*endTolerance*/) override
+        {
+            return 0;
+        }
+
+        std::optional<PathQueryResult> getPathQueryResult(std::size_t /*handle*/) override
+        {
+            return std::nullopt;
+        }
+
         std::map<osg::Vec3f, SharedNavMeshCacheItem> getNavMeshes() const override
         {
             return std::map<osg::Vec3f, SharedNavMeshCacheItem>();
@@ -158,7 +158,9 @@ namespace DetourNavigator
         std::map<TilePosition, std::pair<NavMeshTilesCache::Value, NavMeshData>> mUsedTiles;
     };
 
-    using GuardedNavMeshCacheItem = Misc::ScopeGuarded<NavMeshCacheItem>;
+    // Path queries only need read access to the dtNavMesh, so they take the lock
+    // shared and can run concurrently; only tile updates lock it exclusively.
+    using GuardedNavMeshCacheItem = Misc::SharedGuarded<NavMeshCacheItem>;
     using SharedNavMeshCacheItem = std::shared_ptr<GuardedNavMeshCacheItem>;
 }
 
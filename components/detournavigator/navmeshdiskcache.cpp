@@ -0,0 +1,264 @@
+#include "navmeshdiskcache.hpp"
+
+#include <components/debug/debuglog.hpp>
+#include <components/misc/hash.hpp>
+
+#include <RecastAlloc.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    using namespace DetourNavigator;
+
+    constexpr std::uint32_t formatVersion = 1;
+    constexpr char magic[4] = {'O', 'M', 'W', 'N'};
+
+    template <class T>
+    void appendPod(std::vector<char>& out, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        out.insert(out.end(), bytes, bytes + sizeof(T));
+    }
+
+    template <class T>
+    void appendRange(std::vector<char>& out, const std::vector<T>& values)
+    {
+        appendPod(out, static_cast<std::uint64_t>(values.size()));
+        const char* bytes = reinterpret_cast<const char*>(values.data());
+        out.insert(out.end(), bytes, bytes + values.size() * sizeof(T));
+    }
+
+    template <class T>
+    void write(std::ostream& stream, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <class T>
+    void writeArray(std::ostream& stream, const T* values, std::size_t length)
+    {
+        stream.write(reinterpret_cast<const char*>(values), length * sizeof(T));
+    }
+
+    template <class T>
+    bool read(std::istream& stream, T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    /// Read an array into rcAlloc'd storage, matching how Recast allocates
+    /// the arrays the normal generation path produces.
+    template <class T>
+    bool readRecastArray(std::istream& stream, T*& values, std::size_t length)
+    {
+        if (length == 0)
+            return true;
+        values = static_cast<T*>(rcAlloc(length * sizeof(T), RC_ALLOC_PERM));
+        if (values == nullptr)
+            return false;
+        return static_cast<bool>(stream.read(reinterpret_cast<char*>(values), length * sizeof(T)));
+    }
+}
+
+namespace DetourNavigator
+{
+    NavMeshDiskCache::NavMeshDiskCache(const std::string& directory, const Settings& settings)
+        : mDirectory(directory)
+    {
+        boost::system::error_code ignore;
+        boost::filesystem::create_directories(boost::filesystem::path(mDirectory), ignore);
+
+        // Everything that changes the generated tile besides the recast mesh
+        // itself; a changed setting makes every existing entry a clean miss.
+        appendPod(mSettingsKey, formatVersion);
+        appendPod(mSettingsKey, settings.mCellHeight);
+        appendPod(mSettingsKey, settings.mCellSize);
+        appendPod(mSettingsKey, settings.mDetailSampleDist);
+        appendPod(mSettingsKey, settings.mDetailSampleMaxError);
+        appendPod(mSettingsKey, settings.mMaxClimb);
+        appendPod(mSettingsKey, settings.mMaxSimplificationError);
+        appendPod(mSettingsKey, settings.mMaxSlope);
+        appendPod(mSettingsKey, settings.mRecastScaleFactor);
+        appendPod(mSettingsKey, settings.mSwimHeightScale);
+        appendPod(mSettingsKey, settings.mBorderSize);
+        appendPod(mSettingsKey, settings.mMaxEdgeLen);
+        appendPod(mSettingsKey, settings.mMaxPolys);
+        appendPod(mSettingsKey, settings.mMaxVertsPerPoly);
+        appendPod(mSettingsKey, settings.mRegionMergeSize);
+        appendPod(mSettingsKey, settings.mRegionMinSize);
+        appendPod(mSettingsKey, settings.mTileSize);
+    }
+
+    std::vector<char> NavMeshDiskCache::makeKey(const osg::Vec3f& agentHalfExtents,
+        const TilePosition& changedTile, const RecastMesh& recastMesh) const
+    {
+        std::vector<char> key = mSettingsKey;
+        appendPod(key, agentHalfExtents);
+        appendPod(key, changedTile);
+        appendRange(key, recastMesh.getMesh().getIndices());
+        appendRange(key, recastMesh.getMesh().getVertices());
+        appendRange(key, recastMesh.getMesh().getAreaTypes());
+        appendRange(key, recastMesh.getWater());
+        appendPod(key, static_cast<std::uint64_t>(recastMesh.getHeightfields().size()));
+        for (const Heightfield& heightfield : recastMesh.getHeightfields())
+        {
+            appendPod(key, heightfield.mBounds);
+            appendPod(key, heightfield.mLength);
+            appendPod(key, heightfield.mMinHeight);
+            appendPod(key, heightfield.mMaxHeight);
+            appendPod(key, heightfield.mShift);
+            appendPod(key, heightfield.mScale);
+            appendRange(key, heightfield.mHeights);
+        }
+        appendRange(key, recastMesh.getFlatHeightfields());
+        return key;
+    }
+
+    std::string NavMeshDiskCache::makeFilePath(const std::vector<char>& key) const
+    {
+        char name[2 * sizeof(std::uint64_t) + 1];
+        std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(Misc::fnv1a(key.data(), key.size())));
+        return (boost::filesystem::path(mDirectory) / (std::string(name) + ".navmeshtile")).string();
+    }
+
+    std::unique_ptr<PreparedNavMeshData> NavMeshDiskCache::load(const osg::Vec3f& agentHalfExtents,
+        const TilePosition& changedTile, const RecastMesh& recastMesh) const
+    {
+        const std::vector<char> key = makeKey(agentHalfExtents, changedTile, recastMesh);
+
+        boost::filesystem::ifstream stream(boost::filesystem::path(makeFilePath(key)), std::ios::in | std::ios::binary);
+        if (!stream.is_open())
+            return nullptr;
+
+        char fileMagic[4];
+        if (!stream.read(fileMagic, sizeof(fileMagic)) || std::memcmp(fileMagic, magic, sizeof(magic)) != 0)
+            return nullptr;
+
+        // The file name is only a hash; compare the full key so a collision
+        // or stale entry is a miss instead of a wrong tile.
+        std::uint64_t storedKeySize = 0;
+        if (!read(stream, storedKeySize) || storedKeySize != key.size())
+            return nullptr;
+        std::vector<char> storedKey(key.size());
+        if (!stream.read(storedKey.data(), storedKey.size()) || storedKey != key)
+            return nullptr;
+
+        auto value = std::make_unique<PreparedNavMeshData>();
+        rcPolyMesh& polyMesh = value->mPolyMesh;
+        rcPolyMeshDetail& detail = value->mPolyMeshDetail;
+        std::memset(&polyMesh, 0, sizeof(polyMesh));
+
+        if (!read(stream, value->mUserId) || !read(stream, value->mCellSize) || !read(stream, value->mCellHeight))
+            return nullptr;
+
+        if (!read(stream, polyMesh.nverts) || !read(stream, polyMesh.npolys) || !read(stream, polyMesh.maxpolys)
+                || !read(stream, polyMesh.nvp) || !read(stream, polyMesh.bmin) || !read(stream, polyMesh.bmax)
+                || !read(stream, polyMesh.cs) || !read(stream, polyMesh.ch) || !read(stream, polyMesh.borderSize)
+                || !read(stream, polyMesh.maxEdgeError))
+            return nullptr;
+
+        if (!readRecastArray(stream, polyMesh.verts, getVertsLength(polyMesh))
+                || !readRecastArray(stream, polyMesh.polys, getPolysLength(polyMesh))
+                || !readRecastArray(stream, polyMesh.regs, getRegsLength(polyMesh))
+                || !readRecastArray(stream, polyMesh.flags, getFlagsLength(polyMesh))
+                || !readRecastArray(stream, polyMesh.areas, getAreasLength(polyMesh)))
+            return nullptr;
+
+        if (!read(stream, detail.nmeshes) || !read(stream, detail.nverts) || !read(stream, detail.ntris))
+            return nullptr;
+
+        if (!readRecastArray(stream, detail.meshes, getMeshesLength(detail))
+                || !readRecastArray(stream, detail.verts, getVertsLength(detail))
+                || !readRecastArray(stream, detail.tris, getTrisLength(detail)))
+            return nullptr;
+
+        return value;
+    }
+
+    void NavMeshDiskCache::store(const osg::Vec3f& agentHalfExtents, const TilePosition& changedTile,
+        const RecastMesh& recastMesh, const PreparedNavMeshData& value) const
+    {
+        const std::vector<char> key = makeKey(agentHalfExtents, changedTile, recastMesh);
+        const std::string filePath = makeFilePath(key);
+
+        // Write to a private temporary file and rename so concurrent updater
+        // threads and crashed sessions never leave a half-written entry.
+        boost::filesystem::path temporaryPath;
+        try
+        {
+            temporaryPath = boost::filesystem::unique_path(filePath + ".%%%%%%%%.tmp");
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to store nav mesh tile to disk cache: " << e.what();
+            return;
+        }
+
+        {
+            boost::filesystem::ofstream stream(temporaryPath, std::ios::out | std::ios::binary);
+            if (!stream.is_open())
+                return;
+
+            stream.write(magic, sizeof(magic));
+            write(stream, static_cast<std::uint64_t>(key.size()));
+            stream.write(key.data(), key.size());
+
+            const rcPolyMesh& polyMesh = value.mPolyMesh;
+            const rcPolyMeshDetail& detail = value.mPolyMeshDetail;
+
+            write(stream, value.mUserId);
+            write(stream, value.mCellSize);
+            write(stream, value.mCellHeight);
+
+            write(stream, polyMesh.nverts);
+            write(stream, polyMesh.npolys);
+            write(stream, polyMesh.maxpolys);
+            write(stream, polyMesh.nvp);
+            write(stream, polyMesh.bmin);
+            write(stream, polyMesh.bmax);
+            write(stream, polyMesh.cs);
+            write(stream, polyMesh.ch);
+            write(stream, polyMesh.borderSize);
+            write(stream, polyMesh.maxEdgeError);
+
+            writeArray(stream, polyMesh.verts, getVertsLength(polyMesh));
+            writeArray(stream, polyMesh.polys, getPolysLength(polyMesh));
+            writeArray(stream, polyMesh.regs, getRegsLength(polyMesh));
+            writeArray(stream, polyMesh.flags, getFlagsLength(polyMesh));
+            writeArray(stream, polyMesh.areas, getAreasLength(polyMesh));
+
+            write(stream, detail.nmeshes);
+            write(stream, detail.nverts);
+            write(stream, detail.ntris);
+
+            writeArray(stream, detail.meshes, getMeshesLength(detail));
+            writeArray(stream, detail.verts, getVertsLength(detail));
+            writeArray(stream, detail.tris, getTrisLength(detail));
+
+            if (!stream)
+            {
+                stream.close();
+                boost::system::error_code ignore;
+                boost::filesystem::remove(temporaryPath, ignore);
+                return;
+            }
+        }
+
+        boost::system::error_code error;
+        boost::filesystem::rename(temporaryPath, boost::filesystem::path(filePath), error);
+        if (error)
+        {
+            Log(Debug::Warning) << "Failed to store nav mesh tile to disk cache: " << error.message();
+            boost::system::error_code ignore;
+            boost::filesystem::remove(temporaryPath, ignore);
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_NAVMESHDISKCACHE_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_NAVMESHDISKCACHE_H
+
+#include "preparednavmeshdata.hpp"
+#include "recastmesh.hpp"
+#include "settings.hpp"
+#include "tileposition.hpp"
+
+#include <osg/Vec3f>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace DetourNavigator
+{
+    /// \brief Stores prepared nav mesh tiles on disk so static-world tiles survive across sessions.
+    ///
+    /// Each tile is written to a file named after the hash of its input: the
+    /// RecastMesh content, the agent half extents, the tile position and the
+    /// generation-relevant settings. The full key is stored in the file and
+    /// compared on load, so a hash collision or changed input degrades to a
+    /// cache miss, never to a wrong tile. Writes go through a temporary file
+    /// and rename, making concurrent updater threads safe.
+    class NavMeshDiskCache
+    {
+    public:
+        /// @param directory storage location; created if missing.
+        NavMeshDiskCache(const std::string& directory, const Settings& settings);
+
+        /// @return the stored tile or nullptr on a miss or unreadable file.
+        std::unique_ptr<PreparedNavMeshData> load(const osg::Vec3f& agentHalfExtents,
+            const TilePosition& changedTile, const RecastMesh& recastMesh) const;
+
+        void store(const osg::Vec3f& agentHalfExtents, const TilePosition& changedTile,
+            const RecastMesh& recastMesh, const PreparedNavMeshData& value) const;
+
+    private:
+        std::string mDirectory;
+        std::vector<char> mSettingsKey;
+
+        std::vector<char> makeKey(const osg::Vec3f& agentHalfExtents, const TilePosition& changedTile,
+            const RecastMesh& recastMesh) const;
+
+        std::string makeFilePath(const std::vector<char>& key) const;
+    };
+}
+
+#endif
@@ -11,17 +11,11 @@
 
 #include <DetourNavMesh.h>
 
+#include <algorithm>
 #include <iterator>
 
 namespace
 {
-    using DetourNavigator::ChangeType;
-
-    ChangeType addChangeType(const ChangeType current, const ChangeType add)
-    {
-        return current == add ? current : ChangeType::mixed;
-    }
-
     /// Safely reset shared_ptr with definite underlying object destrutor call.
     /// Assuming there is another thread holding copy of this shared_ptr or weak_ptr to this shared_ptr.
     template <class T>
@@ -128,6 +122,7 @@ namespace DetourNavigator
         mCache.erase(agentHalfExtents);
         mChangedTiles.erase(agentHalfExtents);
         mPlayerTile.erase(agentHalfExtents);
+        mAgentsTiles.erase(agentHalfExtents);
         mLastRecastMeshManagerRevision.erase(agentHalfExtents);
         return true;
     }
@@ -152,19 +147,29 @@ namespace DetourNavigator
             addChangedTile(tile, ChangeType::update);
     }
 
-    void NavMeshManager::update(const osg::Vec3f& playerPosition, const osg::Vec3f& agentHalfExtents)
+    void NavMeshManager::update(const osg::Vec3f& playerPosition, const std::vector<osg::Vec3f>& agentsPositions,
+        const osg::Vec3f& agentHalfExtents)
     {
         const auto playerTile = getTilePosition(mSettings, toNavMeshCoordinates(mSettings, playerPosition));
+        std::vector<TilePosition> agentsTiles;
+        agentsTiles.reserve(agentsPositions.size() + 1);
+        agentsTiles.push_back(playerTile);
+        for (const auto& position : agentsPositions)
+            agentsTiles.push_back(getTilePosition(mSettings, toNavMeshCoordinates(mSettings, position)));
+        std::sort(agentsTiles.begin(), agentsTiles.end());
+        agentsTiles.erase(std::unique(agentsTiles.begin(), agentsTiles.end()), agentsTiles.end());
         auto& lastRevision = mLastRecastMeshManagerRevision[agentHalfExtents];
         auto lastPlayerTile = mPlayerTile.find(agentHalfExtents);
+        auto& lastAgentsTiles = mAgentsTiles[agentHalfExtents];
         if (lastRevision == mRecastMeshManager.getRevision() && lastPlayerTile != mPlayerTile.end()
-                && lastPlayerTile->second == playerTile)
+                && lastPlayerTile->second == playerTile && lastAgentsTiles == agentsTiles)
             return;
         lastRevision = mRecastMeshManager.getRevision();
         if (lastPlayerTile == mPlayerTile.end())
             lastPlayerTile = mPlayerTile.insert(std::make_pair(agentHalfExtents, playerTile)).first;
         else
             lastPlayerTile->second = playerTile;
+        lastAgentsTiles = agentsTiles;
         std::map<TilePosition, ChangeType> tilesToPost;
         const auto cached = getCached(agentHalfExtents);
         if (!cached)
@@ -204,7 +209,7 @@ namespace DetourNavigator
                     recastMeshManager.reportNavMeshChange(recastMeshManager.getVersion(), Version {0, 0});
             });
         }
-        mAsyncNavMeshUpdater.post(agentHalfExtents, cached, playerTile, tilesToPost);
+        mAsyncNavMeshUpdater.post(agentHalfExtents, cached, playerTile, agentsTiles, tilesToPost);
         if (changedTiles != mChangedTiles.end())
             changedTiles->second.clear();
         Log(Debug::Debug) << "Cache update posted for agent=" << agentHalfExtents <<
@@ -222,6 +227,30 @@ namespace DetourNavigator
         return getCached(agentHalfExtents);
     }
 
+    std::size_t NavMeshManager::findPathAsync(const osg::Vec3f& agentHalfExtents, float stepSize,
+        const osg::Vec3f& start, const osg::Vec3f& end, Flags includeFlags, const AreaCosts& areaCosts,
+        float endTolerance)
+    {
+        const auto navMesh = getCached(agentHalfExtents);
+        if (!navMesh)
+            return 0;
+        PathQuery query;
+        query.mAgentHalfExtents = agentHalfExtents;
+        query.mStepSize = stepSize;
+        query.mStart = start;
+        query.mEnd = end;
+        query.mFlags = includeFlags;
+        query.mAreaCosts = areaCosts;
+        query.mEndTolerance = endTolerance;
+        query.mNavMeshCacheItem = navMesh;
+        return mAsyncNavMeshUpdater.postPathQuery(std::move(query));
+    }
+
+    std::optional<PathQueryResult> NavMeshManager::getPathQueryResult(std::size_t handle)
+    {
+        return mAsyncNavMeshUpdater.getPathQueryResult(handle);
+    }
+
     std::map<osg::Vec3f, SharedNavMeshCacheItem> NavMeshManager::getNavMeshes() const
     {
         return mCache;
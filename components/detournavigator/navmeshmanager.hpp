@@ -14,6 +14,7 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 class dtNavMesh;
 
@@ -49,12 +50,21 @@ namespace DetourNavigator
 
         void removeOffMeshConnections(const ObjectId id);
 
-        void update(const osg::Vec3f& playerPosition, const osg::Vec3f& agentHalfExtents);
+        /// \a agentsPositions are the world positions of actors that may request paths; they
+        /// only affect the order in which queued tiles are built, the player stays the anchor
+        /// for which tiles exist.
+        void update(const osg::Vec3f& playerPosition, const std::vector<osg::Vec3f>& agentsPositions,
+            const osg::Vec3f& agentHalfExtents);
 
         void wait(Loading::Listener& listener, WaitConditionType waitConditionType);
 
         SharedNavMeshCacheItem getNavMesh(const osg::Vec3f& agentHalfExtents) const;
 
+        std::size_t findPathAsync(const osg::Vec3f& agentHalfExtents, float stepSize, const osg::Vec3f& start,
+            const osg::Vec3f& end, Flags includeFlags, const AreaCosts& areaCosts, float endTolerance);
+
+        std::optional<PathQueryResult> getPathQueryResult(std::size_t handle);
+
         std::map<osg::Vec3f, SharedNavMeshCacheItem> getNavMeshes() const;
 
         void reportStats(unsigned int frameNumber, osg::Stats& stats) const;
@@ -70,6 +80,7 @@ namespace DetourNavigator
         std::map<osg::Vec3f, std::map<TilePosition, ChangeType>> mChangedTiles;
         std::size_t mGenerationCounter = 0;
         std::map<osg::Vec3f, TilePosition> mPlayerTile;
+        std::map<osg::Vec3f, std::vector<TilePosition>> mAgentsTiles;
         std::map<osg::Vec3f, std::size_t> mLastRecastMeshManagerRevision;
 
         void addChangedTiles(const btCollisionShape& shape, const btTransform& transform, const ChangeType changeType);
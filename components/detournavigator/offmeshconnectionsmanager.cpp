@@ -17,59 +17,61 @@ namespace DetourNavigator
 
     void OffMeshConnectionsManager::add(const ObjectId id, const OffMeshConnection& value)
     {
-        const auto values = mValues.lock();
-
-        values->mById.insert(std::make_pair(id, value));
+        mValues.modify([&] (Values& values)
+        {
+            values.mById.insert(std::make_pair(id, value));
 
-        const auto startTilePosition = getTilePosition(mSettings, value.mStart);
-        const auto endTilePosition = getTilePosition(mSettings, value.mEnd);
+            const auto startTilePosition = getTilePosition(mSettings, value.mStart);
+            const auto endTilePosition = getTilePosition(mSettings, value.mEnd);
 
-        values->mByTilePosition[startTilePosition].insert(id);
+            values.mByTilePosition[startTilePosition].insert(id);
 
-        if (startTilePosition != endTilePosition)
-            values->mByTilePosition[endTilePosition].insert(id);
+            if (startTilePosition != endTilePosition)
+                values.mByTilePosition[endTilePosition].insert(id);
+        });
     }
 
     std::set<TilePosition> OffMeshConnectionsManager::remove(const ObjectId id)
     {
-        const auto values = mValues.lock();
-
-        const auto byId = values->mById.equal_range(id);
+        return mValues.modify([&] (Values& values)
+        {
+            const auto byId = values.mById.equal_range(id);
 
-        if (byId.first == byId.second)
-            return {};
+            if (byId.first == byId.second)
+                return std::set<TilePosition>();
 
-        std::set<TilePosition> removed;
+            std::set<TilePosition> removed;
 
-        std::for_each(byId.first, byId.second, [&] (const auto& v) {
-            const auto startTilePosition = getTilePosition(mSettings, v.second.mStart);
-            const auto endTilePosition = getTilePosition(mSettings, v.second.mEnd);
+            std::for_each(byId.first, byId.second, [&] (const auto& v) {
+                const auto startTilePosition = getTilePosition(mSettings, v.second.mStart);
+                const auto endTilePosition = getTilePosition(mSettings, v.second.mEnd);
 
-            removed.emplace(startTilePosition);
-            if (startTilePosition != endTilePosition)
-                removed.emplace(endTilePosition);
-        });
+                removed.emplace(startTilePosition);
+                if (startTilePosition != endTilePosition)
+                    removed.emplace(endTilePosition);
+            });
 
-        for (const TilePosition& tilePosition : removed)
-        {
-            const auto it = values->mByTilePosition.find(tilePosition);
-            if (it == values->mByTilePosition.end())
-                continue;
-            it->second.erase(id);
-            if (it->second.empty())
-                values->mByTilePosition.erase(it);
-        }
+            for (const TilePosition& tilePosition : removed)
+            {
+                const auto it = values.mByTilePosition.find(tilePosition);
+                if (it == values.mByTilePosition.end())
+                    continue;
+                it->second.erase(id);
+                if (it->second.empty())
+                    values.mByTilePosition.erase(it);
+            }
 
-        values->mById.erase(byId.first, byId.second);
+            values.mById.erase(byId.first, byId.second);
 
-        return removed;
+            return removed;
+        });
     }
 
     std::vector<OffMeshConnection> OffMeshConnectionsManager::get(const TilePosition& tilePosition)
     {
         std::vector<OffMeshConnection> result;
 
-        const auto values = mValues.lock();
+        const auto values = mValues.read();
 
         const auto itByTilePosition = values->mByTilePosition.find(tilePosition);
 
@@ -6,7 +6,7 @@
 #include "objectid.hpp"
 #include "offmeshconnection.hpp"
 
-#include <components/misc/guarded.hpp>
+#include <components/misc/readmostly.hpp>
 
 #include <map>
 #include <unordered_set>
@@ -34,7 +34,9 @@ namespace DetourNavigator
         };
 
         const Settings& mSettings;
-        Misc::ScopeGuarded<Values> mValues;
+        // Read on every tile build, modified only when doors and travel destinations
+        // are registered or removed, so readers take lock-free snapshots.
+        Misc::ReadMostly<Values> mValues;
     };
 }
 
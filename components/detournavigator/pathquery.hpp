@@ -0,0 +1,41 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_PATHQUERY_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_PATHQUERY_H
+
+#include "areatype.hpp"
+#include "flags.hpp"
+#include "status.hpp"
+
+#include <components/misc/guarded.hpp>
+
+#include <osg/Vec3f>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace DetourNavigator
+{
+    class NavMeshCacheItem;
+
+    /// An asynchronous path find request served by the navigator's background threads.
+    struct PathQuery
+    {
+        std::size_t mId = 0;
+        osg::Vec3f mAgentHalfExtents;
+        float mStepSize = 0;
+        osg::Vec3f mStart;
+        osg::Vec3f mEnd;
+        Flags mFlags = Flag_none;
+        AreaCosts mAreaCosts;
+        float mEndTolerance = 0;
+        std::weak_ptr<Misc::SharedGuarded<NavMeshCacheItem>> mNavMeshCacheItem;
+    };
+
+    struct PathQueryResult
+    {
+        Status mStatus = Status::NavMeshNotFound;
+        std::vector<osg::Vec3f> mPath;
+    };
+}
+
+#endif
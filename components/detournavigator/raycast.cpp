@@ -12,7 +12,7 @@ namespace DetourNavigator
     std::optional<osg::Vec3f> raycast(const dtNavMesh& navMesh, const osg::Vec3f& halfExtents,
         const osg::Vec3f& start, const osg::Vec3f& end, const Flags includeFlags, const Settings& settings)
     {
-        dtNavMeshQuery navMeshQuery;
+        dtNavMeshQuery& navMeshQuery = getPooledNavMeshQuery();
         if (!initNavMeshQuery(navMeshQuery, navMesh, settings.mMaxNavMeshQueryNodes))
             return {};
 
@@ -7,6 +7,12 @@
 
 namespace DetourNavigator
 {
+    struct TempAllocatorUsage
+    {
+        std::size_t mCapacity;
+        std::size_t mPeakUsedSize;
+    };
+
     class RecastGlobalAllocator
     {
     public:
@@ -15,6 +21,24 @@ namespace DetourNavigator
             instance();
         }
 
+        /// Grows the temp allocator of the calling thread when allocations since the last call
+        /// overflowed into the heap and returns the usage over that period. Supposed to be
+        /// called by worker threads between jobs, while no temp buffers are held.
+        static TempAllocatorUsage resetTempAllocator()
+        {
+            RecastTempAllocator& allocator = tempAllocator();
+            const TempAllocatorUsage usage {allocator.getCapacity(), allocator.getPeakUsedSize()};
+            if (allocator.getRequiredCapacity() > allocator.getCapacity())
+            {
+                std::size_t capacity = allocator.getCapacity();
+                while (capacity < allocator.getRequiredCapacity())
+                    capacity *= 2;
+                allocator.tryResize(capacity);
+            }
+            allocator.resetStats();
+            return usage;
+        }
+
         static void* alloc(size_t size, rcAllocHint hint)
         {
             void* result = nullptr;
@@ -199,6 +199,39 @@ namespace DetourNavigator
         }
     }
 
+    void RecastMeshBuilder::addObject(const std::vector<RecastMeshTriangle>& triangles, const btTransform& transform)
+    {
+        const btVector3 boundsMin(mBounds.mMin.x(), mBounds.mMin.y(),
+            -std::numeric_limits<btScalar>::max() * std::numeric_limits<btScalar>::epsilon());
+        const btVector3 boundsMax(mBounds.mMax.x(), mBounds.mMax.y(),
+            std::numeric_limits<btScalar>::max() * std::numeric_limits<btScalar>::epsilon());
+
+        for (const RecastMeshTriangle& triangle : triangles)
+        {
+            std::array<btVector3, 3> vertices;
+            for (std::size_t i = 0; i < 3; ++i)
+                vertices[i] = transform(Misc::Convert::toBullet(triangle.mVertices[i]));
+            if (!TestTriangleAgainstAabb2(vertices.data(), boundsMin, boundsMax))
+                continue;
+            RecastMeshTriangle transformed;
+            transformed.mAreaType = triangle.mAreaType;
+            for (std::size_t i = 0; i < 3; ++i)
+                transformed.mVertices[i] = Misc::Convert::makeOsgVec3f(vertices[i]);
+            mTriangles.emplace_back(transformed);
+        }
+    }
+
+    std::shared_ptr<const std::vector<RecastMeshTriangle>> RecastMeshBuilder::makeLocalTriangles(
+        const btCollisionShape& shape, const AreaType areaType, const std::size_t maxTriangles)
+    {
+        const float maxBound = std::numeric_limits<float>::max();
+        RecastMeshBuilder builder(TileBounds {osg::Vec2f(-maxBound, -maxBound), osg::Vec2f(maxBound, maxBound)});
+        builder.addObject(shape, btTransform::getIdentity(), areaType);
+        if (builder.mTriangles.size() > maxTriangles)
+            return nullptr;
+        return std::make_shared<const std::vector<RecastMeshTriangle>>(std::move(builder.mTriangles));
+    }
+
     void RecastMeshBuilder::addWater(const int cellSize, const osg::Vec3f& shift)
     {
         mWater.push_back(Cell {cellSize, shift});
@@ -49,6 +49,17 @@ namespace DetourNavigator
 
         void addObject(const btBoxShape& shape, const btTransform& transform, const AreaType areaType);
 
+        /// Add triangles that were previously extracted by makeLocalTriangles, transformed by
+        /// \a transform and clipped against the tile bounds.
+        void addObject(const std::vector<RecastMeshTriangle>& triangles, const btTransform& transform);
+
+        /// Extract all triangles of \a shape in its local space, in the same layout and winding
+        /// addObject produces, so they can be cached and added to many tiles.
+        /// @return nullptr if the shape has more than \a maxTriangles triangles, in which case
+        /// walking the Bullet shape with its bounding volume hierarchy is preferable.
+        static std::shared_ptr<const std::vector<RecastMeshTriangle>> makeLocalTriangles(
+            const btCollisionShape& shape, AreaType areaType, std::size_t maxTriangles);
+
         void addWater(const int mCellSize, const osg::Vec3f& shift);
 
         void addHeightfield(int cellSize, const osg::Vec3f& shift, float height);
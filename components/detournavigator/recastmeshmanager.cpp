@@ -127,7 +127,8 @@ namespace DetourNavigator
             osg::ref_ptr<const osg::Referenced>,
             std::reference_wrapper<const btCollisionShape>,
             btTransform,
-            AreaType
+            AreaType,
+            std::shared_ptr<const std::vector<RecastMeshTriangle>>
         >;
         std::vector<Object> objects;
         std::size_t revision;
@@ -141,12 +142,18 @@ namespace DetourNavigator
             for (const auto& [k, object] : mObjects)
             {
                 const RecastMeshObject& impl = object.getImpl();
-                objects.emplace_back(impl.getHolder(), impl.getShape(), impl.getTransform(), impl.getAreaType());
+                objects.emplace_back(impl.getHolder(), impl.getShape(), impl.getTransform(), impl.getAreaType(),
+                                     impl.getLocalTriangles());
             }
             revision = mRevision;
         }
-        for (const auto& [holder, shape, transform, areaType] : objects)
-            builder.addObject(shape, transform, areaType);
+        for (const auto& [holder, shape, transform, areaType, localTriangles] : objects)
+        {
+            if (localTriangles != nullptr)
+                builder.addObject(*localTriangles, transform);
+            else
+                builder.addObject(shape, transform, areaType);
+        }
         return std::move(builder).create(mGeneration, revision);
     }
 
@@ -58,6 +58,9 @@ namespace DetourNavigator
     bool RecastMeshObject::update(const btTransform& transform, const AreaType areaType)
     {
         bool result = false;
+        // Moving the whole object keeps its local-space triangles valid; everything below
+        // changes the local geometry or its classification, so the cache has to go.
+        bool localGeometryChanged = false;
         if (!(mTransform == transform))
         {
             mTransform = transform;
@@ -66,16 +69,39 @@ namespace DetourNavigator
         if (mAreaType != areaType)
         {
             mAreaType = areaType;
+            localGeometryChanged = true;
             result = true;
         }
         if (!(mLocalScaling == mShape.get().getLocalScaling()))
         {
             mLocalScaling = mShape.get().getLocalScaling();
+            localGeometryChanged = true;
             result = true;
         }
-        if (mShape.get().isCompound())
-            result = updateCompoundObject(static_cast<const btCompoundShape&>(mShape.get()), mAreaType, mChildren)
-                    || result;
+        if (mShape.get().isCompound()
+                && updateCompoundObject(static_cast<const btCompoundShape&>(mShape.get()), mAreaType, mChildren))
+        {
+            localGeometryChanged = true;
+            result = true;
+        }
+        if (localGeometryChanged)
+        {
+            mLocalTriangles = nullptr;
+            mLocalTrianglesOverLimit = false;
+        }
         return result;
     }
+
+    std::shared_ptr<const std::vector<RecastMeshTriangle>> RecastMeshObject::getLocalTriangles() const
+    {
+        // Keeping large shapes out of the cache bounds the memory spent per object and tile;
+        // their triangles keep getting culled by the bounding volume hierarchy instead.
+        constexpr std::size_t maxCachedTriangles = 2048;
+        if (mLocalTriangles == nullptr && !mLocalTrianglesOverLimit)
+        {
+            mLocalTriangles = RecastMeshBuilder::makeLocalTriangles(mShape, mAreaType, maxCachedTriangles);
+            mLocalTrianglesOverLimit = mLocalTriangles == nullptr;
+        }
+        return mLocalTriangles;
+    }
 }
@@ -2,6 +2,7 @@
 #define OPENMW_COMPONENTS_DETOURNAVIGATOR_RECASTMESHOBJECT_H
 
 #include "areatype.hpp"
+#include "recastmeshbuilder.hpp"
 
 #include <LinearMath/btTransform.h>
 
@@ -9,6 +10,7 @@
 #include <osg/Referenced>
 
 #include <functional>
+#include <memory>
 #include <vector>
 
 class btCollisionShape;
@@ -59,6 +61,14 @@ namespace DetourNavigator
                 return mAreaType;
             }
 
+            /// Triangles of the shape in its local space, extracted on first use so tile rebuilds
+            /// don't walk the Bullet shape hierarchy again. Returns nullptr for shapes above the
+            /// cache limit; those should be added to the builder via the Bullet shape, which
+            /// culls by its bounding volume hierarchy.
+            /// @note Must be called with the owning manager's lock held: the cache is filled
+            /// lazily and reset by update() when the geometry changes.
+            std::shared_ptr<const std::vector<RecastMeshTriangle>> getLocalTriangles() const;
+
         private:
             osg::ref_ptr<const osg::Referenced> mHolder;
             std::reference_wrapper<const btCollisionShape> mShape;
@@ -66,6 +76,8 @@ namespace DetourNavigator
             AreaType mAreaType;
             btVector3 mLocalScaling;
             std::vector<RecastMeshObject> mChildren;
+            mutable std::shared_ptr<const std::vector<RecastMeshTriangle>> mLocalTriangles;
+            mutable bool mLocalTrianglesOverLimit = false;
     };
 }
 
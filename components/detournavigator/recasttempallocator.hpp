@@ -3,6 +3,7 @@
 
 #include "recastallocutils.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <vector>
@@ -22,11 +23,17 @@ namespace DetourNavigator
             void* top = mTop;
             const auto itemSize = 2 * sizeof(std::size_t) + size;
             if (rcUnlikely(!std::align(sizeof(std::size_t), itemSize, top, space)))
+            {
+                // Remember how much space would have been needed, so the stack can be grown
+                // between jobs instead of spilling into the heap again (see tryResize).
+                mRequiredCapacity = std::max(mRequiredCapacity, getUsedSize() + itemSize + sizeof(std::size_t));
                 return nullptr;
+            }
             setTempPtrBufferType(top, BufferType_temp);
             setTempPtrPrev(top, mPrev);
             mTop = static_cast<char*>(top) + itemSize;
             mPrev = static_cast<char*>(top);
+            mPeakUsedSize = std::max(mPeakUsedSize, getUsedSize());
             return getTempPtrDataPtr(top);
         }
 
@@ -50,10 +57,44 @@ namespace DetourNavigator
             return;
         }
 
+        std::size_t getCapacity() const
+        {
+            return mStack.size();
+        }
+
+        std::size_t getPeakUsedSize() const
+        {
+            return mPeakUsedSize;
+        }
+
+        std::size_t getRequiredCapacity() const
+        {
+            return mRequiredCapacity;
+        }
+
+        void resetStats()
+        {
+            mPeakUsedSize = 0;
+            mRequiredCapacity = 0;
+        }
+
+        bool tryResize(std::size_t capacity)
+        {
+            // Allocated buffers contain pointers into the stack, so it can only be replaced
+            // while no buffers are held.
+            if (mPrev != nullptr || getUsedSize() != 0)
+                return false;
+            mStack = std::vector<char>(capacity);
+            mTop = mStack.data();
+            return true;
+        }
+
     private:
         std::vector<char> mStack;
         void* mTop;
         void* mPrev;
+        std::size_t mPeakUsedSize = 0;
+        std::size_t mRequiredCapacity = 0;
 
         std::size_t getUsedSize() const
         {
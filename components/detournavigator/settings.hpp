@@ -38,6 +38,7 @@ namespace DetourNavigator
         std::size_t mMaxSmoothPathSize = 0;
         std::string mRecastMeshPathPrefix;
         std::string mNavMeshPathPrefix;
+        std::string mNavMeshDiskCachePath;
         std::chrono::milliseconds mMinUpdateInterval;
     };
 
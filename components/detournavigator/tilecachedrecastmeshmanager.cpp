@@ -19,14 +19,14 @@ namespace DetourNavigator
     {
         std::vector<TilePosition> tilesPositions;
         const auto border = getBorderSize(mSettings);
+        mTiles.modify([&] (TilesMap& tiles)
         {
-            auto tiles = mTiles.lock();
             getTilesPositions(shape.getShape(), transform, mSettings, [&] (const TilePosition& tilePosition)
                 {
-                    if (addTile(id, shape, transform, areaType, tilePosition, border, tiles.get()))
+                    if (addTile(id, shape, transform, areaType, tilePosition, border, tiles))
                         tilesPositions.push_back(tilePosition);
                 });
-        }
+        });
         if (tilesPositions.empty())
             return false;
         std::sort(tilesPositions.begin(), tilesPositions.end());
@@ -41,15 +41,15 @@ namespace DetourNavigator
         if (object == mObjectsTilesPositions.end())
             return std::nullopt;
         std::optional<RemovedRecastMeshObject> result;
+        mTiles.modify([&] (TilesMap& tiles)
         {
-            auto tiles = mTiles.lock();
             for (const auto& tilePosition : object->second)
             {
-                const auto removed = removeTile(id, tilePosition, tiles.get());
+                const auto removed = removeTile(id, tilePosition, tiles);
                 if (removed && !result)
                     result = removed;
             }
-        }
+        });
         if (result)
             ++mRevision;
         return result;
@@ -66,36 +66,40 @@ namespace DetourNavigator
 
         if (cellSize == std::numeric_limits<int>::max())
         {
-            const auto tiles = mTiles.lock();
-            for (auto& tile : *tiles)
+            mTiles.modify([&] (TilesMap& tiles)
             {
-                if (tile.second->addWater(cellPosition, cellSize, shift))
+                for (auto& tile : tiles)
                 {
-                    tilesPositions.push_back(tile.first);
-                    result = true;
+                    if (tile.second->addWater(cellPosition, cellSize, shift))
+                    {
+                        tilesPositions.push_back(tile.first);
+                        result = true;
+                    }
                 }
-            }
+            });
         }
         else
         {
-            getTilesPositions(cellSize, shift, mSettings, [&] (const TilePosition& tilePosition)
-                {
-                    const auto tiles = mTiles.lock();
-                    auto tile = tiles->find(tilePosition);
-                    if (tile == tiles->end())
-                    {
-                        auto tileBounds = makeTileBounds(mSettings, tilePosition);
-                        tileBounds.mMin -= osg::Vec2f(border, border);
-                        tileBounds.mMax += osg::Vec2f(border, border);
-                        tile = tiles->insert(std::make_pair(tilePosition,
-                                std::make_shared<CachedRecastMeshManager>(mSettings, tileBounds, mTilesGeneration))).first;
-                    }
-                    if (tile->second->addWater(cellPosition, cellSize, shift))
+            mTiles.modify([&] (TilesMap& tiles)
+            {
+                getTilesPositions(cellSize, shift, mSettings, [&] (const TilePosition& tilePosition)
                     {
-                        tilesPositions.push_back(tilePosition);
-                        result = true;
-                    }
-                });
+                        auto tile = tiles.find(tilePosition);
+                        if (tile == tiles.end())
+                        {
+                            auto tileBounds = makeTileBounds(mSettings, tilePosition);
+                            tileBounds.mMin -= osg::Vec2f(border, border);
+                            tileBounds.mMax += osg::Vec2f(border, border);
+                            tile = tiles.insert(std::make_pair(tilePosition,
+                                    std::make_shared<CachedRecastMeshManager>(mSettings, tileBounds, mTilesGeneration))).first;
+                        }
+                        if (tile->second->addWater(cellPosition, cellSize, shift))
+                        {
+                            tilesPositions.push_back(tilePosition);
+                            result = true;
+                        }
+                    });
+            });
         }
 
         if (result)
@@ -110,21 +114,23 @@ namespace DetourNavigator
         if (object == mWaterTilesPositions.end())
             return std::nullopt;
         std::optional<Cell> result;
-        for (const auto& tilePosition : object->second)
+        mTiles.modify([&] (TilesMap& tiles)
         {
-            const auto tiles = mTiles.lock();
-            const auto tile = tiles->find(tilePosition);
-            if (tile == tiles->end())
-                continue;
-            const auto tileResult = tile->second->removeWater(cellPosition);
-            if (tile->second->isEmpty())
+            for (const auto& tilePosition : object->second)
             {
-                tiles->erase(tile);
-                ++mTilesGeneration;
+                const auto tile = tiles.find(tilePosition);
+                if (tile == tiles.end())
+                    continue;
+                const auto tileResult = tile->second->removeWater(cellPosition);
+                if (tile->second->isEmpty())
+                {
+                    tiles.erase(tile);
+                    ++mTilesGeneration;
+                }
+                if (tileResult && !result)
+                    result = tileResult;
             }
-            if (tileResult && !result)
-                result = tileResult;
-        }
+        });
         if (result)
             ++mRevision;
         return result;
@@ -139,24 +145,26 @@ namespace DetourNavigator
 
         bool result = false;
 
-        getTilesPositions(cellSize, shift, mSettings, [&] (const TilePosition& tilePosition)
-            {
-                const auto tiles = mTiles.lock();
-                auto tile = tiles->find(tilePosition);
-                if (tile == tiles->end())
-                {
-                    auto tileBounds = makeTileBounds(mSettings, tilePosition);
-                    tileBounds.mMin -= osg::Vec2f(border, border);
-                    tileBounds.mMax += osg::Vec2f(border, border);
-                    tile = tiles->insert(std::make_pair(tilePosition,
-                            std::make_shared<CachedRecastMeshManager>(mSettings, tileBounds, mTilesGeneration))).first;
-                }
-                if (tile->second->addHeightfield(cellPosition, cellSize, shift, shape))
+        mTiles.modify([&] (TilesMap& tiles)
+        {
+            getTilesPositions(cellSize, shift, mSettings, [&] (const TilePosition& tilePosition)
                 {
-                    tilesPositions.push_back(tilePosition);
-                    result = true;
-                }
-            });
+                    auto tile = tiles.find(tilePosition);
+                    if (tile == tiles.end())
+                    {
+                        auto tileBounds = makeTileBounds(mSettings, tilePosition);
+                        tileBounds.mMin -= osg::Vec2f(border, border);
+                        tileBounds.mMax += osg::Vec2f(border, border);
+                        tile = tiles.insert(std::make_pair(tilePosition,
+                                std::make_shared<CachedRecastMeshManager>(mSettings, tileBounds, mTilesGeneration))).first;
+                    }
+                    if (tile->second->addHeightfield(cellPosition, cellSize, shift, shape))
+                    {
+                        tilesPositions.push_back(tilePosition);
+                        result = true;
+                    }
+                });
+        });
 
         if (result)
             ++mRevision;
@@ -170,21 +178,23 @@ namespace DetourNavigator
         if (object == mHeightfieldTilesPositions.end())
             return std::nullopt;
         std::optional<Cell> result;
-        for (const auto& tilePosition : object->second)
+        mTiles.modify([&] (TilesMap& tiles)
         {
-            const auto tiles = mTiles.lock();
-            const auto tile = tiles->find(tilePosition);
-            if (tile == tiles->end())
-                continue;
-            const auto tileResult = tile->second->removeHeightfield(cellPosition);
-            if (tile->second->isEmpty())
+            for (const auto& tilePosition : object->second)
             {
-                tiles->erase(tile);
-                ++mTilesGeneration;
+                const auto tile = tiles.find(tilePosition);
+                if (tile == tiles.end())
+                    continue;
+                const auto tileResult = tile->second->removeHeightfield(cellPosition);
+                if (tile->second->isEmpty())
+                {
+                    tiles.erase(tile);
+                    ++mTilesGeneration;
+                }
+                if (tileResult && !result)
+                    result = tileResult;
             }
-            if (tileResult && !result)
-                result = tileResult;
-        }
+        });
         if (result)
             ++mRevision;
         return result;
@@ -192,17 +202,11 @@ namespace DetourNavigator
 
     std::shared_ptr<RecastMesh> TileCachedRecastMeshManager::getMesh(const TilePosition& tilePosition) const
     {
-        const auto manager = [&] () -> std::shared_ptr<CachedRecastMeshManager>
-        {
-            const auto tiles = mTiles.lockConst();
-            const auto it = tiles->find(tilePosition);
-            if (it == tiles->end())
-                return nullptr;
-            return it->second;
-        } ();
-        if (manager == nullptr)
+        const auto tiles = mTiles.read();
+        const auto it = tiles->find(tilePosition);
+        if (it == tiles->end())
             return nullptr;
-        return manager->getMesh();
+        return it->second->getMesh();
     }
 
     std::size_t TileCachedRecastMeshManager::getRevision() const
@@ -212,7 +216,7 @@ namespace DetourNavigator
 
     void TileCachedRecastMeshManager::reportNavMeshChange(const TilePosition& tilePosition, Version recastMeshVersion, Version navMeshVersion) const
     {
-        const auto tiles = mTiles.lockConst();
+        const auto tiles = mTiles.read();
         const auto it = tiles->find(tilePosition);
         if (it == tiles->end())
             return;
@@ -8,7 +8,7 @@
 #include "version.hpp"
 #include "heightfieldshape.hpp"
 
-#include <components/misc/guarded.hpp>
+#include <components/misc/readmostly.hpp>
 
 #include <algorithm>
 #include <map>
@@ -36,20 +36,20 @@ namespace DetourNavigator
             const auto border = getBorderSize(mSettings);
             bool changed = false;
             std::vector<TilePosition> newTiles;
+            mTiles.modify([&] (TilesMap& tiles)
             {
-                auto tiles = mTiles.lock();
                 const auto onTilePosition = [&] (const TilePosition& tilePosition)
                 {
                     if (std::binary_search(currentTiles.begin(), currentTiles.end(), tilePosition))
                     {
                         newTiles.push_back(tilePosition);
-                        if (updateTile(id, transform, areaType, tilePosition, tiles.get()))
+                        if (updateTile(id, transform, areaType, tilePosition, tiles))
                         {
                             onChangedTile(tilePosition);
                             changed = true;
                         }
                     }
-                    else if (addTile(id, shape, transform, areaType, tilePosition, border, tiles.get()))
+                    else if (addTile(id, shape, transform, areaType, tilePosition, border, tiles))
                     {
                         newTiles.push_back(tilePosition);
                         onChangedTile(tilePosition);
@@ -60,13 +60,13 @@ namespace DetourNavigator
                 std::sort(newTiles.begin(), newTiles.end());
                 for (const auto& tile : currentTiles)
                 {
-                    if (!std::binary_search(newTiles.begin(), newTiles.end(), tile) && removeTile(id, tile, tiles.get()))
+                    if (!std::binary_search(newTiles.begin(), newTiles.end(), tile) && removeTile(id, tile, tiles))
                     {
                         onChangedTile(tile);
                         changed = true;
                     }
                 }
-            }
+            });
             if (changed)
             {
                 currentTiles = std::move(newTiles);
@@ -91,7 +91,8 @@ namespace DetourNavigator
         template <class Function>
         void forEachTile(Function&& function) const
         {
-            for (auto& [tilePosition, recastMeshManager] : *mTiles.lockConst())
+            const auto tiles = mTiles.read();
+            for (const auto& [tilePosition, recastMeshManager] : *tiles)
                 function(tilePosition, *recastMeshManager);
         }
 
@@ -103,7 +104,11 @@ namespace DetourNavigator
         using TilesMap = std::map<TilePosition, std::shared_ptr<CachedRecastMeshManager>>;
 
         const Settings& mSettings;
-        Misc::ScopeGuarded<TilesMap> mTiles;
+        // The map structure only changes when objects, water or heightfields are
+        // added or removed; tile builds and queries read published snapshots without
+        // locking. The CachedRecastMeshManager instances the map points to are
+        // internally synchronized and shared between versions of the map.
+        Misc::ReadMostly<TilesMap> mTiles;
         std::unordered_map<ObjectId, std::vector<TilePosition>> mObjectsTilesPositions;
         std::map<osg::Vec2i, std::vector<TilePosition>> mWaterTilesPositions;
         std::map<osg::Vec2i, std::vector<TilePosition>> mHeightfieldTilesPositions;
@@ -1,6 +1,8 @@
 #ifndef OPENMW_ESM_CELLREF_H
 #define OPENMW_ESM_CELLREF_H
 
+#include <cstdint>
+#include <functional>
 #include <limits>
 #include <string>
 
@@ -136,4 +138,18 @@ namespace ESM
 
 }
 
+namespace std
+{
+    template <>
+    struct hash<ESM::RefNum>
+    {
+        std::size_t operator() (const ESM::RefNum& refNum) const noexcept
+        {
+            return std::hash<std::uint64_t>()(
+                (static_cast<std::uint64_t>(refNum.mIndex) << 32)
+                | static_cast<std::uint32_t>(refNum.mContentFile));
+        }
+    };
+}
+
 #endif
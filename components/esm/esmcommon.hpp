@@ -2,6 +2,7 @@
 #define OPENMW_ESM_COMMON_H
 
 #include <algorithm>
+#include <memory>
 #include <string>
 #include <cstring>
 #include <vector>
@@ -131,10 +132,15 @@ typedef FIXED_STRING<64> NAME64;
    restored by an ESMReader instance. It will save the position within
    a file, and when restored will let you read from that position as
    if you never left it.
+
+   A context is saved for every cell (often for every contributing plugin), so
+   copies need to be cheap: the file name and the parent file list never change
+   after a file has been opened and are shared between the reader and all
+   contexts saved from it instead of being copied per context.
  */
 struct ESM_Context
 {
-  std::string filename;
+  std::shared_ptr<const std::string> filename;
   uint32_t leftRec, leftSub;
   size_t leftFile;
   NAME recName, subName;
@@ -142,7 +148,7 @@ struct ESM_Context
   //  actually contribute to a specific cell. Therefore, we need to store the index
   //  of the file belonging to this contest. See CellStore::(list/load)refs for details.
   int index;
-  std::vector<int> parentFileIndices;
+  std::shared_ptr<const std::vector<int>> parentFileIndices;
 
   // True if subName has been read but not used.
   bool subCached;
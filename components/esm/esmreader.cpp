@@ -2,6 +2,8 @@
 
 #include <stdexcept>
 
+#include <components/files/mappedfilestream.hpp>
+
 namespace ESM
 {
 
@@ -26,9 +28,13 @@ ESMReader::ESMReader()
 
 void ESMReader::restoreContext(const ESM_Context &rc)
 {
-    // Reopen the file if necessary
-    if (mCtx.filename != rc.filename)
-        openRaw(rc.filename);
+    if (!rc.filename)
+        fail("Cannot restore a context that was never saved");
+
+    // Reopen the file if necessary. The name is shared between all contexts
+    // saved from the same reader, so the common case is a pointer comparison.
+    if (mCtx.filename != rc.filename && *mCtx.filename != *rc.filename)
+        openRaw(*rc.filename);
 
     // Copy the data
     mCtx = rc;
@@ -44,9 +50,10 @@ void ESMReader::close()
     mHeader.blank();
 }
 
-void ESMReader::clearCtx() 
+void ESMReader::clearCtx()
 {
-   mCtx.filename.clear();
+   mCtx.filename = std::make_shared<const std::string>();
+   mCtx.parentFileIndices = std::make_shared<const std::vector<int>>();
    mCtx.leftFile = 0;
    mCtx.leftRec = 0;
    mCtx.leftSub = 0;
@@ -59,7 +66,7 @@ void ESMReader::openRaw(Files::IStreamPtr _esm, const std::string& name)
 {
     close();
     mEsm = _esm;
-    mCtx.filename = name;
+    mCtx.filename = std::make_shared<const std::string>(name);
     mEsm->seekg(0, mEsm->end);
     mCtx.leftFile = mFileSize = mEsm->tellg();
     mEsm->seekg(0, mEsm->beg);
@@ -67,7 +74,11 @@ void ESMReader::openRaw(Files::IStreamPtr _esm, const std::string& name)
 
 void ESMReader::openRaw(const std::string& filename)
 {
-    openRaw(Files::openConstrainedFileStream(filename.c_str()), filename);
+    // Content files are read front to back with lots of tiny reads, so map
+    // them into memory where possible instead of going through buffered I/O.
+    // Compressed or archived sources still come in through the IStreamPtr
+    // overload and use the regular stream path.
+    openRaw(Files::openMappedFileStream(filename.c_str()), filename);
 }
 
 void ESMReader::open(Files::IStreamPtr _esm, const std::string &name)
@@ -248,6 +259,27 @@ void ESMReader::skipRecord()
     mCtx.subCached = false;
 }
 
+std::string ESMReader::getSerializedRecord()
+{
+    const uint32_t size = mCtx.leftRec;
+    const uint32_t unused = 0;
+
+    std::string out;
+    out.reserve(mCtx.recName.data_size() + 3 * sizeof(uint32_t) + size);
+    out.append(mCtx.recName.rw_data(), mCtx.recName.data_size());
+    out.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    out.append(reinterpret_cast<const char*>(&unused), sizeof(unused));
+    out.append(reinterpret_cast<const char*>(&mRecordFlags), sizeof(uint32_t));
+
+    const size_t pos = out.size();
+    out.resize(pos + size);
+    getExact(out.data() + pos, size);
+    mCtx.leftRec = 0;
+    mCtx.subCached = false;
+
+    return out;
+}
+
 void ESMReader::getRecHeader(uint32_t &flags)
 {
     // General error checking
@@ -304,7 +336,7 @@ std::string ESMReader::getString(int size)
     std::stringstream ss;
 
     ss << "ESM Error: " << msg;
-    ss << "\n  File: " << mCtx.filename;
+    ss << "\n  File: " << *mCtx.filename;
     ss << "\n  Record: " << mCtx.recName.toString();
     ss << "\n  Subrecord: " << mCtx.subName.toString();
     if (mEsm.get())
@@ -37,9 +37,12 @@ public:
   const std::vector<Header::MasterData> &getGameFiles() const { return mHeader.mMaster; }
   const Header& getHeader() const { return mHeader; }
   int getFormat() const { return mHeader.mFormat; };
+  // When parsing a serialized record that was extracted from another file
+  // (see getSerializedRecord), carry over that file's format version.
+  void setFormat(int format) { mHeader.mFormat = format; }
   const NAME &retSubName() const { return mCtx.subName; }
   uint32_t getSubSize() const { return mCtx.leftSub; }
-  std::string getName() const {return mCtx.filename; };
+  const std::string& getName() const { return *mCtx.filename; };
 
   /*************************************************************************
    *
@@ -85,8 +88,14 @@ public:
   void setGlobalReaderList(std::vector<ESMReader> *list) {mGlobalReaderList = list;}
   std::vector<ESMReader> *getGlobalReaderList() {return mGlobalReaderList;}
 
-  void addParentFileIndex(int index) { mCtx.parentFileIndices.push_back(index); }
-  const std::vector<int>& getParentFileIndices() const { return mCtx.parentFileIndices; }
+  void addParentFileIndex(int index)
+  {
+      // the list is shared with any saved contexts, so copy it instead of mutating in place
+      auto indices = std::make_shared<std::vector<int>>(*mCtx.parentFileIndices);
+      indices->push_back(index);
+      mCtx.parentFileIndices = std::move(indices);
+  }
+  const std::vector<int>& getParentFileIndices() const { return *mCtx.parentFileIndices; }
 
   /*************************************************************************
    *
@@ -215,6 +224,12 @@ public:
   // already been read
   void skipRecord();
 
+  // Read the rest of this record raw and return it with its header
+  // re-assembled in front, so that it can be parsed on its own later or
+  // written back out via ESMWriter::writeSerializedRecord. Must be called
+  // directly after getRecHeader.
+  std::string getSerializedRecord();
+
   /* Read record header. This updatesleftFile BEYOND the data that
      follows the header, ie beyond the entire record. You should use
      leftRec to orient yourself inside the record itself.
@@ -1,6 +1,7 @@
 #include "esmwriter.hpp"
 
 #include <cassert>
+#include <cstring>
 #include <fstream>
 #include <stdexcept>
 
@@ -70,6 +71,7 @@ namespace ESM
     {
         mRecordCount = 0;
         mRecords.clear();
+        mBuffer.clear();
         mCounting = true;
         mStream = &file;
 
@@ -80,6 +82,22 @@ namespace ESM
         endRecord("TES3");
     }
 
+    void ESMWriter::setStream(std::ostream* stream)
+    {
+        mRecordCount = 0;
+        mRecords.clear();
+        mBuffer.clear();
+        mCounting = true;
+        mStream = stream;
+    }
+
+    void ESMWriter::writeSerializedRecord(const std::string& data)
+    {
+        assert(mRecords.empty());
+        mRecordCount++;
+        mStream->write(data.data(), data.size());
+    }
+
     void ESMWriter::close()
     {
         if (!mRecords.empty())
@@ -93,7 +111,7 @@ namespace ESM
         writeName(name);
         RecordData rec;
         rec.name = name;
-        rec.position = mStream->tellp();
+        rec.position = mBuffer.size();
         rec.size = 0;
         writeT<uint32_t>(0); // Size goes here
         writeT<uint32_t>(0); // Unused header?
@@ -121,7 +139,7 @@ namespace ESM
         writeName(name);
         RecordData rec;
         rec.name = name;
-        rec.position = mStream->tellp();
+        rec.position = mBuffer.size();
         rec.size = 0;
         writeT<uint32_t>(0); // Size goes here
         mRecords.push_back(rec);
@@ -135,14 +153,11 @@ namespace ESM
         assert(rec.name == name);
         mRecords.pop_back();
 
-        mStream->seekp(rec.position);
-
-        mCounting = false;
-        write (reinterpret_cast<const char*> (&rec.size), sizeof(uint32_t));
-        mCounting = true;
-
-        mStream->seekp(0, std::ios::end);
+        // Patch the size placeholder in place instead of seeking the stream back
+        std::memcpy(mBuffer.data() + rec.position, &rec.size, sizeof(uint32_t));
 
+        if (mRecords.empty())
+            flushBuffer();
     }
 
     void ESMWriter::endRecord (uint32_t name)
@@ -220,7 +235,13 @@ namespace ESM
                 it->size += static_cast<uint32_t>(size);
         }
 
-        mStream->write(data, size);
+        mBuffer.insert(mBuffer.end(), data, data + size);
+    }
+
+    void ESMWriter::flushBuffer()
+    {
+        mStream->write(mBuffer.data(), mBuffer.size());
+        mBuffer.clear();
     }
 
     void ESMWriter::setEncoder(ToUTF8::Utf8Encoder* encoder)
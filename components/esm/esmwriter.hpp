@@ -1,8 +1,10 @@
 #ifndef OPENMW_ESM_WRITER_H
 #define OPENMW_ESM_WRITER_H
 
+#include <cstddef>
 #include <iosfwd>
 #include <list>
+#include <vector>
 
 #include "esmcommon.hpp"
 #include "loadtes3.hpp"
@@ -19,7 +21,8 @@ class ESMWriter
         struct RecordData
         {
             std::string name;
-            std::streampos position;
+            // Offset of the size field inside mBuffer
+            std::size_t position;
             uint32_t size;
         };
 
@@ -52,6 +55,14 @@ class ESMWriter
         void save(std::ostream& file);
         ///< Start saving a file by writing the TES3 header.
 
+        void setStream(std::ostream* stream);
+        ///< Start writing to \a stream without emitting a file header. Intended for
+        /// serializing individual records into a memory buffer.
+
+        void writeSerializedRecord(const std::string& data);
+        ///< Copy \a data, the bytes of one complete record previously produced by an
+        /// identically configured writer, into the output verbatim.
+
         void close();
         ///< \note Does not close the stream.
 
@@ -139,7 +150,14 @@ class ESMWriter
         void write(const char* data, size_t size);
 
     private:
+        void flushBuffer();
+        ///< Push the completed record in mBuffer to the stream with a single write.
+
         std::list<RecordData> mRecords;
+        // Records are assembled here and flushed to the stream once complete, so
+        // record sizes are patched in memory instead of seeking the stream back,
+        // and each record reaches the stream in one large write.
+        std::vector<char> mBuffer;
         std::ostream* mStream;
         std::streampos mHeaderPos;
         ToUTF8::Utf8Encoder* mEncoder;
@@ -133,7 +133,7 @@ namespace ESM
                     {
                         if(!overriding)
                             mWater = std::numeric_limits<float>::max();
-                        Log(Debug::Warning) << "Warning: Encountered invalid water level in cell " << mName << " defined in " << esm.getContext().filename;
+                        Log(Debug::Warning) << "Warning: Encountered invalid water level in cell " << mName << " defined in " << esm.getName();
                     }
                     else
                         mWater = waterLevel;
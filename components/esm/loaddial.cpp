@@ -1,5 +1,8 @@
 #include "loaddial.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 #include <components/debug/debuglog.hpp>
 
 #include "esmreader.hpp"
@@ -72,6 +75,8 @@ namespace ESM
     void Dialogue::blank()
     {
         mInfo.clear();
+        mGenericInfo.clear();
+        mActorInfo.clear();
     }
 
     void Dialogue::readInfo(ESMReader &esm, bool merge)
@@ -82,53 +87,65 @@ namespace ESM
 
         if (!merge || mInfo.empty())
         {
-            mLookup[info.mId] = std::make_pair(mInfo.insert(mInfo.end(), info), isDeleted);
+            InfoContainer::iterator it = mInfo.insert(mInfo.end(), std::move(info));
+            mLookup[it->mId] = std::make_pair(it, isDeleted);
             return;
         }
 
-        InfoContainer::iterator it = mInfo.end();
-
-        LookupMap::iterator lookup;
-        lookup = mLookup.find(info.mId);
-
-        if (lookup != mLookup.end())
-        {
-            it = lookup->second.first;
-            // Since the new version of this record may have changed the next/prev linked list connection, we need to re-insert the record
-            mInfo.erase(it);
-            mLookup.erase(lookup);
-        }
+        // Work out where the record belongs before touching the list. Every prev/next
+        // reference resolves through the id index, so merging stays O(n log n) no
+        // matter how many plugins touch the same topic.
+        InfoContainer::iterator dest = mInfo.end();
+        bool found = true;
 
         if (info.mNext.empty())
+            dest = mInfo.end();
+        else if (info.mPrev.empty())
+            dest = mInfo.begin();
+        else
         {
-            mLookup[info.mId] = std::make_pair(mInfo.insert(mInfo.end(), info), isDeleted);
-            return;
+            LookupMap::iterator lookup = mLookup.find(info.mPrev);
+            if (lookup != mLookup.end())
+                dest = std::next(lookup->second.first);
+            else
+            {
+                lookup = mLookup.find(info.mNext);
+                if (lookup != mLookup.end())
+                    dest = lookup->second.first;
+                else
+                    found = false;
+            }
         }
-        if (info.mPrev.empty())
+
+        LookupMap::iterator lookup = mLookup.find(info.mId);
+        if (!found)
         {
-            mLookup[info.mId] = std::make_pair(mInfo.insert(mInfo.begin(), info), isDeleted);
+            // Neither neighbour is known; drop the record, including any older
+            // version of it whose chaining the new one has invalidated.
+            if (lookup != mLookup.end())
+            {
+                mInfo.erase(lookup->second.first);
+                mLookup.erase(lookup);
+            }
+            Log(Debug::Warning) << "Warning: Failed to insert info " << info.mId;
             return;
         }
 
-        lookup = mLookup.find(info.mPrev);
         if (lookup != mLookup.end())
         {
-            it = lookup->second.first;
-
-            mLookup[info.mId] = std::make_pair(mInfo.insert(++it, info), isDeleted);
-            return;
+            // A later plugin overrides this info: update the existing node in place
+            // and relink it instead of copying the whole record again. Splicing to
+            // its own position is a no-op.
+            InfoContainer::iterator it = lookup->second.first;
+            *it = std::move(info);
+            mInfo.splice(dest, mInfo, it);
+            lookup->second.second = isDeleted;
         }
-
-        lookup = mLookup.find(info.mNext);
-        if (lookup != mLookup.end())
+        else
         {
-            it = lookup->second.first;
-
-            mLookup[info.mId] = std::make_pair(mInfo.insert(it, info), isDeleted);
-            return;
+            InfoContainer::iterator it = mInfo.insert(dest, std::move(info));
+            mLookup[it->mId] = std::make_pair(it, isDeleted);
         }
-
-        Log(Debug::Warning) << "Warning: Failed to insert info " << info.mId;
     }
 
     void Dialogue::clearDeletedInfos()
@@ -144,4 +161,25 @@ namespace ESM
         }
         mLookup.clear();
     }
+
+    void Dialogue::setUpInfoIndex()
+    {
+        mGenericInfo.clear();
+        mActorInfo.clear();
+
+        std::size_t position = 0;
+        for (InfoContainer::iterator it = mInfo.begin(); it != mInfo.end(); ++it, ++position)
+        {
+            // The filter ANDs the selects together with short-circuiting, so their
+            // order does not affect the result; evaluate the cheap ones first.
+            std::stable_sort(it->mSelects.begin(), it->mSelects.end(),
+                [](const DialInfo::SelectStruct& left, const DialInfo::SelectStruct& right)
+                { return left.mCost < right.mCost; });
+
+            if (it->mActor.empty())
+                mGenericInfo.emplace_back(position, &*it);
+            else
+                mActorInfo[it->mActor].emplace_back(position, &*it);
+        }
+    }
 }
@@ -4,6 +4,10 @@
 #include <string>
 #include <list>
 #include <map>
+#include <utility>
+#include <vector>
+
+#include <components/misc/stringops.hpp>
 
 #include "loadinfo.hpp"
 
@@ -47,6 +51,17 @@ struct Dialogue
     // This is only used during the loading phase to speed up DialInfo merging.
     LookupMap mLookup;
 
+    // Infos paired with their position in mInfo, so that the index buckets below can be
+    // merged back in the original order. The order is semantic: dialogue filtering
+    // returns the first matching info.
+    typedef std::vector<std::pair<std::size_t, const DialInfo*> > InfoIndex;
+
+    // Built by setUpInfoIndex once loading is complete. Infos naming a specific actor
+    // can only ever match that actor, so dialogue filtering only needs to test the
+    // generic infos plus the bucket for the current actor instead of the whole list.
+    InfoIndex mGenericInfo;
+    std::map<std::string, InfoIndex, Misc::StringUtils::CiComp> mActorInfo;
+
     void load(ESMReader &esm, bool &isDeleted);
     ///< Loads all sub-records of Dialogue record
     void loadId(ESMReader &esm);
@@ -59,6 +74,9 @@ struct Dialogue
     /// Remove all INFOs that are deleted
     void clearDeletedInfos();
 
+    /// Rebuild mGenericInfo/mActorInfo. Must be called again whenever mInfo changes.
+    void setUpInfoIndex();
+
     /// Read the next info record
     /// @param merge Merge with existing list, or just push each record to the end of the list?
     void readInfo (ESM::ESMReader& esm, bool merge);
@@ -1,5 +1,7 @@
 #include "loadinfo.hpp"
 
+#include <components/misc/stringops.hpp>
+
 #include "esmreader.hpp"
 #include "esmwriter.hpp"
 #include "defs.hpp"
@@ -63,6 +65,7 @@ namespace ESM
                     SelectStruct ss;
                     ss.mSelectRule = esm.getHString();
                     ss.mValue.read(esm, Variant::Format_Info);
+                    ss.decode();
                     mSelects.push_back(ss);
                     break;
                 }
@@ -131,6 +134,52 @@ namespace ESM
         }
     }
 
+    void DialInfo::SelectStruct::decode()
+    {
+        mFunction = 0;
+        mName.clear();
+        mCost = 0;
+
+        if (mSelectRule.size() < 5)
+            return;
+
+        // Characters 2-3 select the function when the rule type is '1'; parsed
+        // here once instead of through an istringstream on every evaluation.
+        for (std::size_t i = 2; i < 4; ++i)
+        {
+            const char c = mSelectRule[i];
+            if (c < '0' || c > '9')
+                break;
+            mFunction = mFunction * 10 + (c - '0');
+        }
+
+        mName = Misc::StringUtils::lowerCase(mSelectRule.substr(5));
+
+        // Relative cost of evaluating this condition in the dialogue filter:
+        // plain comparisons and stat reads are cheap, variable and journal
+        // lookups cost a map search, and inventory, corpse and awareness
+        // queries walk game state. Selects are ordered by this so cheap
+        // conditions can reject an info before the expensive ones run.
+        switch (mSelectRule[1])
+        {
+            case '2': case '3': case '4': case 'C': // global/local variable, journal
+                mCost = 1;
+                break;
+            case '5': // item count: scans the inventory
+                mCost = 2;
+                break;
+            case '6': // dead count: scans game state for corpses
+                mCost = 3;
+                break;
+            case '1':
+                if (mFunction == 48 || mFunction == 71) // Detected, ShouldAttack: AI queries
+                    mCost = 3;
+                break;
+            default: // id/class/faction/race/cell comparisons
+                break;
+        }
+    }
+
     void DialInfo::blank()
     {
         mData.mUnknown1 = 0;
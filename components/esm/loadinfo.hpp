@@ -51,6 +51,14 @@ struct DialInfo
     {
         std::string mSelectRule; // This has a complicated format
         Variant mValue;
+
+        // Decoded once after load (see decode()) so dialogue filtering does not
+        // re-parse the rule string for every info it tests.
+        int mFunction = 0;  // numeric function selector (characters 2-3 of the rule)
+        std::string mName;  // case-smashed variable/id name (characters 5+ of the rule)
+        int mCost = 0;      // relative evaluation cost class, used to order selects
+
+        void decode();
     };
 
     // Journal quest indices (introduced with the quest system in Tribunal)
@@ -18,6 +18,12 @@ namespace ESMTerrain
     public:
         typedef std::map<std::pair<int, int>, osg::ref_ptr<const LandObject> > Map;
         Map mMap;
+        // The terrain kernels probe the same cell for long contiguous runs of
+        // samples, so remember the last lookup to keep them out of the map.
+        int mLastCellX = 0;
+        int mLastCellY = 0;
+        const LandObject* mLastLand = nullptr;
+        bool mHasLast = false;
     };
 
     LandObject::LandObject()
@@ -200,6 +206,9 @@ namespace ESMTerrain
 
         bool alteration = useAlteration();
 
+        const float vertexSpacing = size * Constants::CellSizeInUnits / (numVerts - 1);
+        const float chunkOffset = size * Constants::CellSizeInUnits * 0.5f;
+
         float vertY_ = 0; // of current cell corner
         for (int cellY = startCellY; cellY < startCellY + std::ceil(size); ++cellY)
         {
@@ -233,40 +242,38 @@ namespace ESMTerrain
                 int rowEnd = std::min(static_cast<int>(rowStart + std::min(1.f, size) * (ESM::Land::LAND_SIZE-1) + 1), static_cast<int>(ESM::Land::LAND_SIZE));
                 int colEnd = std::min(static_cast<int>(colStart + std::min(1.f, size) * (ESM::Land::LAND_SIZE-1) + 1), static_cast<int>(ESM::Land::LAND_SIZE));
 
-                vertY = vertY_;
-                for (int col=colStart; col<colEnd; col += increment)
+                auto makeVertex = [&](int col, int row, bool cellEdge)
                 {
-                    vertX = vertX_;
-                    for (int row=rowStart; row<rowEnd; row += increment)
-                    {
-                        int srcArrayIndex = col*ESM::Land::LAND_SIZE*3+row*3;
+                    int srcArrayIndex = col*ESM::Land::LAND_SIZE*3+row*3;
 
-                        assert(row >= 0 && row < ESM::Land::LAND_SIZE);
-                        assert(col >= 0 && col < ESM::Land::LAND_SIZE);
+                    assert(row >= 0 && row < ESM::Land::LAND_SIZE);
+                    assert(col >= 0 && col < ESM::Land::LAND_SIZE);
 
-                        assert (vertX < numVerts);
-                        assert (vertY < numVerts);
+                    assert (vertX < numVerts);
+                    assert (vertY < numVerts);
 
-                        float height = defaultHeight;
-                        if (heightData)
-                            height = heightData->mHeights[col*ESM::Land::LAND_SIZE + row];
-                        if (alteration)
-                            height += getAlteredHeight(col, row);
-                        (*positions)[static_cast<unsigned int>(vertX*numVerts + vertY)]
-                            = osg::Vec3f((vertX / float(numVerts - 1) - 0.5f) * size * Constants::CellSizeInUnits,
-                                         (vertY / float(numVerts - 1) - 0.5f) * size * Constants::CellSizeInUnits,
-                                         height);
+                    float height = defaultHeight;
+                    if (heightData)
+                        height = heightData->mHeights[col*ESM::Land::LAND_SIZE + row];
+                    if (alteration)
+                        height += getAlteredHeight(col, row);
+                    (*positions)[static_cast<unsigned int>(vertX*numVerts + vertY)]
+                        = osg::Vec3f(vertX * vertexSpacing - chunkOffset,
+                                     vertY * vertexSpacing - chunkOffset,
+                                     height);
 
-                        if (normalData)
-                        {
-                            for (int i=0; i<3; ++i)
-                                normal[i] = normalData->mNormals[srcArrayIndex+i];
+                    if (normalData)
+                    {
+                        for (int i=0; i<3; ++i)
+                            normal[i] = normalData->mNormals[srcArrayIndex+i];
 
-                            normal.normalize();
-                        }
-                        else
-                            normal = osg::Vec3f(0,0,1);
+                        normal.normalize();
+                    }
+                    else
+                        normal = osg::Vec3f(0,0,1);
 
+                    if (cellEdge)
+                    {
                         // Normals apparently don't connect seamlessly between cells
                         if (col == ESM::Land::LAND_SIZE-1 || row == ESM::Land::LAND_SIZE-1)
                             fixNormal(normal, cellX, cellY, col, row, cache);
@@ -274,34 +281,60 @@ namespace ESMTerrain
                         // some corner normals appear to be complete garbage (z < 0)
                         if ((row == 0 || row == ESM::Land::LAND_SIZE-1) && (col == 0 || col == ESM::Land::LAND_SIZE-1))
                             averageNormal(normal, cellX, cellY, col, row, cache);
+                    }
 
-                        assert(normal.z() > 0);
+                    assert(normal.z() > 0);
 
-                        (*normals)[static_cast<unsigned int>(vertX*numVerts + vertY)] = normal;
+                    (*normals)[static_cast<unsigned int>(vertX*numVerts + vertY)] = normal;
 
-                        if (colourData)
-                        {
-                            for (int i=0; i<3; ++i)
-                                color[i] = colourData->mColours[srcArrayIndex+i];
-                        }
-                        else
-                        {
-                            color.r() = 255;
-                            color.g() = 255;
-                            color.b() = 255;
-                        }
-                        if (alteration)
-                            adjustColor(col, row, heightData, color); //Does nothing by default, override in OpenMW-CS
+                    if (colourData)
+                    {
+                        for (int i=0; i<3; ++i)
+                            color[i] = colourData->mColours[srcArrayIndex+i];
+                    }
+                    else
+                    {
+                        color.r() = 255;
+                        color.g() = 255;
+                        color.b() = 255;
+                    }
+                    if (alteration)
+                        adjustColor(col, row, heightData, color); //Does nothing by default, override in OpenMW-CS
 
+                    if (cellEdge)
+                    {
                         // Unlike normals, colors mostly connect seamlessly between cells, but not always...
                         if (col == ESM::Land::LAND_SIZE-1 || row == ESM::Land::LAND_SIZE-1)
                             fixColour(color, cellX, cellY, col, row, cache);
+                    }
+
+                    color.a() = 255;
 
-                        color.a() = 255;
+                    (*colours)[static_cast<unsigned int>(vertX*numVerts + vertY)] = color;
 
-                        (*colours)[static_cast<unsigned int>(vertX*numVerts + vertY)] = color;
+                    ++vertX;
+                };
 
-                        ++vertX;
+                vertY = vertY_;
+                for (int col=colStart; col<colEnd; col += increment)
+                {
+                    vertX = vertX_;
+                    int row = rowStart;
+                    // Only samples on the first/last row/column of a cell need the
+                    // seam and corner fixups that reach into the neighbouring
+                    // cells; everything in between reads straight from this cell's
+                    // arrays, so keep the interior run free of per-sample branches.
+                    if (col == 0 || col == ESM::Land::LAND_SIZE-1)
+                    {
+                        for (; row<rowEnd; row += increment)
+                            makeVertex(col, row, true);
+                    }
+                    else
+                    {
+                        for (; row<rowEnd && row<ESM::Land::LAND_SIZE-1; row += increment)
+                            makeVertex(col, row, false);
+                        for (; row<rowEnd; row += increment)
+                            makeVertex(col, row, true);
                     }
                     ++vertY;
                 }
@@ -391,11 +424,32 @@ namespace ESMTerrain
         LandCache cache;
         std::map<UniqueTextureId, unsigned int> textureIndicesMap;
 
+        // Texture indices come in long runs of the same value, so remember the
+        // last one classified instead of going through the map for every texel.
+        UniqueTextureId lastId = std::make_pair(-1, -1);
+        unsigned int lastLayerIndex = 0;
+
+        auto writeBlendmapTexel = [&](unsigned int layerIndex, int x, int y)
+        {
+            unsigned char* pData = blendmaps[layerIndex]->data();
+            int realY = (blendmapSize - y - 1)*imageScaleFactor;
+            int realX = x*imageScaleFactor;
+            pData[((realY+0)*blendmapImageSize + realX + 0)] = 255;
+            pData[((realY+1)*blendmapImageSize + realX + 0)] = 255;
+            pData[((realY+0)*blendmapImageSize + realX + 1)] = 255;
+            pData[((realY+1)*blendmapImageSize + realX + 1)] = 255;
+        };
+
         for (int y=0; y<blendmapSize; y++)
         {
             for (int x=0; x<blendmapSize; x++)
             {
                 UniqueTextureId id = getVtexIndexAt(cellX, cellY, x+rowStart, y+colStart, cache);
+                if (id == lastId)
+                {
+                    writeBlendmapTexel(lastLayerIndex, x, y);
+                    continue;
+                }
                 std::map<UniqueTextureId, unsigned int>::iterator found = textureIndicesMap.find(id);
                 if (found == textureIndicesMap.end())
                 {
@@ -424,14 +478,9 @@ namespace ESMTerrain
                         layerList.emplace_back(info);
                     }
                 }
-                unsigned int layerIndex = found->second;
-                unsigned char* pData = blendmaps[layerIndex]->data();
-                int realY = (blendmapSize - y - 1)*imageScaleFactor;
-                int realX = x*imageScaleFactor;
-                pData[((realY+0)*blendmapImageSize + realX + 0)] = 255;
-                pData[((realY+1)*blendmapImageSize + realX + 0)] = 255;
-                pData[((realY+0)*blendmapImageSize + realX + 1)] = 255;
-                pData[((realY+1)*blendmapImageSize + realX + 1)] = 255;
+                lastId = id;
+                lastLayerIndex = found->second;
+                writeBlendmapTexel(lastLayerIndex, x, y);
             }
         }
 
@@ -525,14 +574,16 @@ namespace ESMTerrain
 
     const LandObject* Storage::getLand(int cellX, int cellY, LandCache& cache)
     {
+        if (cache.mHasLast && cache.mLastCellX == cellX && cache.mLastCellY == cellY)
+            return cache.mLastLand;
         LandCache::Map::iterator found = cache.mMap.find(std::make_pair(cellX, cellY));
-        if (found != cache.mMap.end())
-            return found->second;
-        else
-        {
+        if (found == cache.mMap.end())
             found = cache.mMap.insert(std::make_pair(std::make_pair(cellX, cellY), getLand(cellX, cellY))).first;
-            return found->second;
-        }
+        cache.mLastCellX = cellX;
+        cache.mLastCellY = cellY;
+        cache.mLastLand = found->second;
+        cache.mHasLast = true;
+        return found->second;
     }
 
     void Storage::adjustColor(int col, int row, const ESM::Land::LandData *heightData, osg::Vec4ub& color) const
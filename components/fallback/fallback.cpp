@@ -6,77 +6,93 @@
 
 namespace Fallback
 {
-    std::map<std::string,std::string> Map::mFallbackMap;
+    std::map<std::string,Map::Value> Map::mFallbackMap;
 
     void Map::init(const std::map<std::string,std::string>& fallback)
     {
-        mFallbackMap = fallback;
+        mFallbackMap.clear();
+        for (const auto& entry : fallback)
+        {
+            Value value;
+            value.mString = entry.second;
+
+            if (!entry.second.empty())
+            {
+                std::stringstream stream(entry.second);
+                stream >> value.mFloat;
+
+                stream.clear();
+                stream.seekg(0);
+                stream >> value.mInt;
+
+                value.mBool = entry.second != "0";
+
+                try
+                {
+                    std::string ret[3];
+                    unsigned int j = 0;
+                    for (unsigned int i = 0; i < entry.second.length() && j < 3; ++i)
+                    {
+                        if(entry.second[i]==',') j++;
+                        else if (entry.second[i] != ' ') ret[j]+=entry.second[i];
+                    }
+                    value.mColour = osg::Vec4f(std::stoi(ret[0])/255.f,std::stoi(ret[1])/255.f,std::stoi(ret[2])/255.f, 1.f);
+                    value.mColourValid = true;
+                }
+                catch (const std::logic_error&)
+                {
+                    // Not every setting is a colour; only complain if someone
+                    // actually asks for this one as a colour.
+                }
+            }
+
+            mFallbackMap.emplace(entry.first, std::move(value));
+        }
+    }
+
+    const Map::Value* Map::find(const std::string& fall)
+    {
+        std::map<std::string,Value>::const_iterator it = mFallbackMap.find(fall);
+        if (it == mFallbackMap.end())
+            return nullptr;
+        return &it->second;
     }
 
     std::string Map::getString(const std::string& fall)
     {
-        std::map<std::string,std::string>::const_iterator it;
-        if ((it = mFallbackMap.find(fall)) == mFallbackMap.end())
-        {
-            return std::string();
-        }
-        return it->second;
+        if (const Value* value = find(fall))
+            return value->mString;
+        return std::string();
     }
 
     float Map::getFloat(const std::string& fall)
     {
-        const std::string& fallback = getString(fall);
-        if (!fallback.empty())
-        {
-            std::stringstream stream(fallback);
-            float number = 0.f;
-            stream >> number;
-            return number;
-        }
-
+        if (const Value* value = find(fall))
+            return value->mFloat;
         return 0;
     }
 
     int Map::getInt(const std::string& fall)
     {
-        const std::string& fallback = getString(fall);
-        if (!fallback.empty())
-        {
-            std::stringstream stream(fallback);
-            int number = 0;
-            stream >> number;
-            return number;
-        }
-
+        if (const Value* value = find(fall))
+            return value->mInt;
         return 0;
     }
 
     bool Map::getBool(const std::string& fall)
     {
-        const std::string& fallback = getString(fall);
-        return !fallback.empty() && fallback != "0";
+        const Value* value = find(fall);
+        return value && !value->mString.empty() && value->mBool;
     }
 
     osg::Vec4f Map::getColour(const std::string& fall)
     {
-        const std::string& sum = getString(fall);
-        if (!sum.empty())
+        const Value* value = find(fall);
+        if (value && !value->mString.empty())
         {
-            try
-            {
-                std::string ret[3];
-                unsigned int j = 0;
-                for (unsigned int i = 0; i < sum.length(); ++i)
-                {
-                    if(sum[i]==',') j++;
-                    else if (sum[i] != ' ') ret[j]+=sum[i];
-                }
-                return osg::Vec4f(std::stoi(ret[0])/255.f,std::stoi(ret[1])/255.f,std::stoi(ret[2])/255.f, 1.f);    
-            }
-            catch (const std::invalid_argument&)
-            {
-                Log(Debug::Error) << "Error: '" << fall << "' setting value (" << sum << ") is not a valid color, using middle gray as a fallback";
-            }
+            if (value->mColourValid)
+                return value->mColour;
+            Log(Debug::Error) << "Error: '" << fall << "' setting value (" << value->mString << ") is not a valid color, using middle gray as a fallback";
         }
 
         return osg::Vec4f(0.5f,0.5f,0.5f,1.f);
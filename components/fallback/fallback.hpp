@@ -9,9 +9,25 @@
 namespace Fallback
 {
     /// @brief contains settings imported from the Morrowind INI file.
+    ///
+    /// The map never changes after init(), so every value is parsed into its
+    /// numeric and colour forms once up front and the getters are plain
+    /// lookups.
     class Map
     {
-            static std::map<std::string,std::string> mFallbackMap;
+            struct Value
+            {
+                std::string mString;
+                float mFloat = 0.f;
+                int mInt = 0;
+                bool mBool = false;
+                osg::Vec4f mColour = osg::Vec4f(0.5f, 0.5f, 0.5f, 1.f);
+                bool mColourValid = false;
+            };
+
+            static std::map<std::string,Value> mFallbackMap;
+
+            static const Value* find(const std::string& fall);
         public:
             static void init(const std::map<std::string,std::string>& fallback);
 
@@ -0,0 +1,154 @@
+#include "mappedfilestream.hpp"
+
+#include <stdexcept>
+
+#include "memorystream.hpp"
+
+#define MAP_API_NONE   0
+#define MAP_API_POSIX  1
+#define MAP_API_WIN32  2
+
+#if defined(__linux) || defined(__unix) || defined(__posix) || defined(__APPLE__)
+#define MAP_API MAP_API_POSIX
+#elif defined(_WIN32)
+#define MAP_API MAP_API_WIN32
+#else
+#define MAP_API MAP_API_NONE
+#endif
+
+#if MAP_API == MAP_API_POSIX
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#elif MAP_API == MAP_API_WIN32
+#include <windows.h>
+#endif
+
+namespace Files
+{
+
+#if MAP_API != MAP_API_NONE
+
+    namespace
+    {
+        class FileMapping
+        {
+        public:
+            FileMapping(const char *filename)
+                : mPtr(nullptr)
+                , mSize(0)
+            {
+#if MAP_API == MAP_API_POSIX
+                int fd = ::open(filename, O_RDONLY);
+                if (fd < 0)
+                    throw std::runtime_error(std::string("Failed to open '") + filename + "' for reading");
+
+                struct stat st;
+                if (::fstat(fd, &st) != 0 || st.st_size == 0)
+                {
+                    ::close(fd);
+                    throw std::runtime_error(std::string("Failed to map '") + filename + "'");
+                }
+
+                mSize = static_cast<size_t>(st.st_size);
+                void* map = ::mmap(nullptr, mSize, PROT_READ, MAP_SHARED, fd, 0);
+
+                // The mapping stays valid after the descriptor is closed.
+                ::close(fd);
+
+                if (map == MAP_FAILED)
+                    throw std::runtime_error(std::string("Failed to map '") + filename + "'");
+                mPtr = static_cast<const char*>(map);
+#else
+                mFile = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+                if (mFile == INVALID_HANDLE_VALUE)
+                    throw std::runtime_error(std::string("Failed to open '") + filename + "' for reading");
+
+                LARGE_INTEGER size;
+                if (!GetFileSizeEx(mFile, &size) || size.QuadPart == 0)
+                {
+                    CloseHandle(mFile);
+                    throw std::runtime_error(std::string("Failed to map '") + filename + "'");
+                }
+                mSize = static_cast<size_t>(size.QuadPart);
+
+                mMapping = CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (mMapping == nullptr)
+                {
+                    CloseHandle(mFile);
+                    throw std::runtime_error(std::string("Failed to map '") + filename + "'");
+                }
+
+                mPtr = static_cast<const char*>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+                if (mPtr == nullptr)
+                {
+                    CloseHandle(mMapping);
+                    CloseHandle(mFile);
+                    throw std::runtime_error(std::string("Failed to map '") + filename + "'");
+                }
+#endif
+            }
+
+            ~FileMapping()
+            {
+#if MAP_API == MAP_API_POSIX
+                ::munmap(const_cast<char*>(mPtr), mSize);
+#else
+                UnmapViewOfFile(const_cast<char*>(mPtr));
+                CloseHandle(mMapping);
+                CloseHandle(mFile);
+#endif
+            }
+
+            const char* data() const { return mPtr; }
+            size_t size() const { return mSize; }
+
+        private:
+            FileMapping(const FileMapping&);
+            FileMapping& operator=(const FileMapping&);
+
+            const char* mPtr;
+            size_t mSize;
+#if MAP_API == MAP_API_WIN32
+            HANDLE mFile;
+            HANDLE mMapping;
+#endif
+        };
+
+        /// An IMemStream that owns the mapping backing its buffer.
+        /// FileMapping has to be a virtual base listed first: virtual bases are
+        /// constructed before all non-virtual ones, so this is the only way to
+        /// have the mapping established before MemBuf (a virtual base of
+        /// IMemStream) captures the mapped region.
+        class MappedFileStream : private virtual FileMapping, public IMemStream
+        {
+        public:
+            MappedFileStream(const char *filename)
+                : FileMapping(filename)
+                , MemBuf(FileMapping::data(), FileMapping::size())
+                , IMemStream(FileMapping::data(), FileMapping::size())
+            {
+            }
+        };
+    }
+
+#endif
+
+    IStreamPtr openMappedFileStream(const char *filename)
+    {
+#if MAP_API != MAP_API_NONE
+        try
+        {
+            return IStreamPtr(new MappedFileStream(filename));
+        }
+        catch (std::exception&)
+        {
+            // fall through to the buffered stream
+        }
+#endif
+        return openConstrainedFileStream(filename);
+    }
+
+}
@@ -0,0 +1,18 @@
+#ifndef OPENMW_COMPONENTS_FILES_MAPPEDFILESTREAM_H
+#define OPENMW_COMPONENTS_FILES_MAPPEDFILESTREAM_H
+
+#include "constrainedfilestream.hpp"
+
+namespace Files
+{
+
+/// Open a read-only stream backed by a memory mapping of the whole file.
+/// All reads and seeks then resolve to pointer arithmetic over the mapping,
+/// and the OS can share the pages between processes reading the same file.
+/// Falls back to a regular buffered file stream if the platform has no
+/// mapping support or the mapping fails (e.g. an empty file).
+IStreamPtr openMappedFileStream(const char *filename);
+
+}
+
+#endif
@@ -239,6 +239,168 @@ namespace Gui
         float ascent;
     } GlyphInfo;
 
+    // Generates the MyGUI glyph metrics document for a converted bitmap font.
+    // We need to emulate loading from XML because the data members are private as of mygui 3.2.0.
+    // The result only depends on the font data, size and codepage, which makes it
+    // suitable for on-disk caching.
+    static void generateGlyphMetrics(MyGUI::xml::Document& xmlDocument, const GlyphInfo* data, int width, int height,
+                                     float fontSize, const std::string& resourceName, const std::string& bitmapFilename,
+                                     ToUTF8::FromType encoding)
+    {
+        MyGUI::xml::ElementPtr root = xmlDocument.createRoot("ResourceManualFont");
+        root->addAttribute("name", resourceName);
+
+        MyGUI::xml::ElementPtr defaultHeight = root->createChild("Property");
+        defaultHeight->addAttribute("key", "DefaultHeight");
+        defaultHeight->addAttribute("value", fontSize);
+        MyGUI::xml::ElementPtr source = root->createChild("Property");
+        source->addAttribute("key", "Source");
+        source->addAttribute("value", std::string(bitmapFilename));
+        MyGUI::xml::ElementPtr codes = root->createChild("Codes");
+
+        // Fall back from unavailable Windows-1252 encoding symbols to similar characters available in the game fonts
+        std::multimap<int, int> additional; // fallback glyph index, unicode
+        additional.insert(std::make_pair(156, 0x00A2)); // cent sign
+        additional.insert(std::make_pair(89, 0x00A5)); // yen sign
+        additional.insert(std::make_pair(221, 0x00A6)); // broken bar
+        additional.insert(std::make_pair(99, 0x00A9)); // copyright sign
+        additional.insert(std::make_pair(97, 0x00AA)); // prima ordinal indicator
+        additional.insert(std::make_pair(60, 0x00AB)); // double left-pointing angle quotation mark
+        additional.insert(std::make_pair(45, 0x00AD)); // soft hyphen
+        additional.insert(std::make_pair(114, 0x00AE)); // registered trademark symbol
+        additional.insert(std::make_pair(45, 0x00AF)); // macron
+        additional.insert(std::make_pair(241, 0x00B1)); // plus-minus sign
+        additional.insert(std::make_pair(50, 0x00B2)); // superscript two
+        additional.insert(std::make_pair(51, 0x00B3)); // superscript three
+        additional.insert(std::make_pair(44, 0x00B8)); // cedilla
+        additional.insert(std::make_pair(49, 0x00B9)); // superscript one
+        additional.insert(std::make_pair(111, 0x00BA)); // primo ordinal indicator
+        additional.insert(std::make_pair(62, 0x00BB)); // double right-pointing angle quotation mark
+        additional.insert(std::make_pair(63, 0x00BF)); // inverted question mark
+        additional.insert(std::make_pair(65, 0x00C6)); // latin capital ae ligature
+        additional.insert(std::make_pair(79, 0x00D8)); // latin capital o with stroke
+        additional.insert(std::make_pair(97, 0x00E6)); // latin small ae ligature
+        additional.insert(std::make_pair(111, 0x00F8)); // latin small o with stroke
+        additional.insert(std::make_pair(79, 0x0152)); // latin capital oe ligature
+        additional.insert(std::make_pair(111, 0x0153)); // latin small oe ligature
+        additional.insert(std::make_pair(83, 0x015A)); // latin capital s with caron
+        additional.insert(std::make_pair(115, 0x015B)); // latin small s with caron
+        additional.insert(std::make_pair(89, 0x0178)); // latin capital y with diaresis
+        additional.insert(std::make_pair(90, 0x017D)); // latin capital z with caron
+        additional.insert(std::make_pair(122, 0x017E)); // latin small z with caron
+        additional.insert(std::make_pair(102, 0x0192)); // latin small f with hook
+        additional.insert(std::make_pair(94, 0x02C6)); // circumflex modifier
+        additional.insert(std::make_pair(126, 0x02DC)); // small tilde
+        additional.insert(std::make_pair(69, 0x0401)); // cyrillic capital io (no diaeresis latin e is available)
+        additional.insert(std::make_pair(137, 0x0451)); // cyrillic small io
+        additional.insert(std::make_pair(45, 0x2012)); // figure dash
+        additional.insert(std::make_pair(45, 0x2013)); // en dash
+        additional.insert(std::make_pair(45, 0x2014)); // em dash
+        additional.insert(std::make_pair(39, 0x2018)); // left single quotation mark
+        additional.insert(std::make_pair(39, 0x2019)); // right single quotation mark
+        additional.insert(std::make_pair(44, 0x201A)); // single low quotation mark
+        additional.insert(std::make_pair(39, 0x201B)); // single high quotation mark (reversed)
+        additional.insert(std::make_pair(34, 0x201C)); // left double quotation mark
+        additional.insert(std::make_pair(34, 0x201D)); // right double quotation mark
+        additional.insert(std::make_pair(44, 0x201E)); // double low quotation mark
+        additional.insert(std::make_pair(34, 0x201F)); // double high quotation mark (reversed)
+        additional.insert(std::make_pair(43, 0x2020)); // dagger
+        additional.insert(std::make_pair(216, 0x2021)); // double dagger (note: this glyph is not available)
+        additional.insert(std::make_pair(46, 0x2026)); // ellipsis
+        additional.insert(std::make_pair(37, 0x2030)); // per mille sign
+        additional.insert(std::make_pair(60, 0x2039)); // single left-pointing angle quotation mark
+        additional.insert(std::make_pair(62, 0x203A)); // single right-pointing angle quotation mark
+        additional.insert(std::make_pair(101, 0x20AC)); // euro sign
+        additional.insert(std::make_pair(84, 0x2122)); // trademark sign
+        additional.insert(std::make_pair(45, 0x2212)); // minus sign
+
+        ToUTF8::Utf8Encoder encoder(encoding);
+
+        for(int i = 0; i < 256; i++)
+        {
+            float x1 = data[i].top_left.x*width;
+            float y1 = data[i].top_left.y*height;
+            float w  = data[i].top_right.x*width - x1;
+            float h  = data[i].bottom_left.y*height - y1;
+
+            unsigned long unicodeVal = utf8ToUnicode(getUtf8(i, encoder, encoding));
+
+            MyGUI::xml::ElementPtr code = codes->createChild("Code");
+            code->addAttribute("index", unicodeVal);
+            code->addAttribute("coord", MyGUI::utility::toString(x1) + " "
+                                        + MyGUI::utility::toString(y1) + " "
+                                        + MyGUI::utility::toString(w) + " "
+                                        + MyGUI::utility::toString(h));
+            code->addAttribute("advance", data[i].width);
+            code->addAttribute("bearing", MyGUI::utility::toString(data[i].kerning) + " "
+                               + MyGUI::utility::toString((fontSize-data[i].ascent)));
+            code->addAttribute("size", MyGUI::IntSize(static_cast<int>(data[i].width), static_cast<int>(data[i].height)));
+
+            typedef std::multimap<int, int>::const_iterator FallbackIterator;
+            std::pair<FallbackIterator, FallbackIterator> fallbacks = additional.equal_range(i);
+            for (FallbackIterator it = fallbacks.first; it != fallbacks.second; ++it)
+            {
+                code = codes->createChild("Code");
+                code->addAttribute("index", it->second);
+                code->addAttribute("coord", MyGUI::utility::toString(x1) + " "
+                                            + MyGUI::utility::toString(y1) + " "
+                                            + MyGUI::utility::toString(w) + " "
+                                            + MyGUI::utility::toString(h));
+                code->addAttribute("advance", data[i].width);
+                code->addAttribute("bearing", MyGUI::utility::toString(data[i].kerning) + " "
+                                   + MyGUI::utility::toString((fontSize-data[i].ascent)));
+                code->addAttribute("size", MyGUI::IntSize(static_cast<int>(data[i].width), static_cast<int>(data[i].height)));
+            }
+
+            // ASCII vertical bar, use this as text input cursor
+            if (i == 124)
+            {
+                MyGUI::xml::ElementPtr cursorCode = codes->createChild("Code");
+                cursorCode->addAttribute("index", MyGUI::FontCodeType::Cursor);
+                cursorCode->addAttribute("coord", MyGUI::utility::toString(x1) + " "
+                                            + MyGUI::utility::toString(y1) + " "
+                                            + MyGUI::utility::toString(w) + " "
+                                            + MyGUI::utility::toString(h));
+                cursorCode->addAttribute("advance", data[i].width);
+                cursorCode->addAttribute("bearing", MyGUI::utility::toString(data[i].kerning) + " "
+                                   + MyGUI::utility::toString((fontSize-data[i].ascent)));
+                cursorCode->addAttribute("size", MyGUI::IntSize(static_cast<int>(data[i].width), static_cast<int>(data[i].height)));
+            }
+
+            // Question mark, use for NotDefined marker (used for glyphs not existing in the font)
+            if (i == 63)
+            {
+                MyGUI::xml::ElementPtr cursorCode = codes->createChild("Code");
+                cursorCode->addAttribute("index", MyGUI::FontCodeType::NotDefined);
+                cursorCode->addAttribute("coord", MyGUI::utility::toString(x1) + " "
+                                            + MyGUI::utility::toString(y1) + " "
+                                            + MyGUI::utility::toString(w) + " "
+                                            + MyGUI::utility::toString(h));
+                cursorCode->addAttribute("advance", data[i].width);
+                cursorCode->addAttribute("bearing", MyGUI::utility::toString(data[i].kerning) + " "
+                                   + MyGUI::utility::toString((fontSize-data[i].ascent)));
+                cursorCode->addAttribute("size", MyGUI::IntSize(static_cast<int>(data[i].width), static_cast<int>(data[i].height)));
+            }
+        }
+
+        // These are required as well, but the fonts don't provide them
+        for (int i=0; i<2; ++i)
+        {
+            MyGUI::FontCodeType::Enum type;
+            if(i == 0)
+                type = MyGUI::FontCodeType::Selected;
+            else // if (i == 1)
+                type = MyGUI::FontCodeType::SelectedBack;
+
+            MyGUI::xml::ElementPtr cursorCode = codes->createChild("Code");
+            cursorCode->addAttribute("index", type);
+            cursorCode->addAttribute("coord", "0 0 0 0");
+            cursorCode->addAttribute("advance", "0");
+            cursorCode->addAttribute("bearing", "0 0");
+            cursorCode->addAttribute("size", "0 0");
+        }
+    }
+
     void FontLoader::loadBitmapFont(const std::string &fileName, bool exportToFile)
     {
         Files::IStreamPtr file = mVFS->get(fileName);
@@ -337,167 +499,53 @@ namespace Gui
         font->setTexture(myguiTex);
         */
 
-        // We need to emulate loading from XML because the data members are private as of mygui 3.2.0
-        MyGUI::xml::Document xmlDocument;
-        MyGUI::xml::ElementPtr root = xmlDocument.createRoot("ResourceManualFont");
-        root->addAttribute("name", resourceName);
+        // Prebuilt glyph table cache. The conversion performed by generateGlyphMetrics
+        // is deterministic for a given font, size and codepage, so the generated
+        // metrics are written to disk once and reloaded on subsequent startups; the
+        // atlas image itself is the .tex file already uploaded above.
+        const std::string cacheFile = mUserDataPath + "/Fonts/cache/" + name + "_"
+                + MyGUI::utility::toString(fontSize) + "_" + MyGUI::utility::toString(static_cast<int>(mEncoding)) + ".xml";
 
-        MyGUI::xml::ElementPtr defaultHeight = root->createChild("Property");
-        defaultHeight->addAttribute("key", "DefaultHeight");
-        defaultHeight->addAttribute("value", fontSize);
-        MyGUI::xml::ElementPtr source = root->createChild("Property");
-        source->addAttribute("key", "Source");
-        source->addAttribute("value", std::string(bitmapFilename));
-        MyGUI::xml::ElementPtr codes = root->createChild("Codes");
+        MyGUI::xml::Document cachedDocument;
+        MyGUI::xml::Document builtDocument;
+        MyGUI::xml::ElementPtr root = nullptr;
 
-        for(int i = 0; i < 256; i++)
+        if (!exportToFile && boost::filesystem::exists(cacheFile))
         {
-            float x1 = data[i].top_left.x*width;
-            float y1 = data[i].top_left.y*height;
-            float w  = data[i].top_right.x*width - x1;
-            float h  = data[i].bottom_left.y*height - y1;
-
-            ToUTF8::Utf8Encoder encoder(mEncoding);
-            unsigned long unicodeVal = utf8ToUnicode(getUtf8(i, encoder, mEncoding));
+            if (cachedDocument.open(cacheFile) && cachedDocument.getRoot() != nullptr
+                    && cachedDocument.getRoot()->getName() == "ResourceManualFont")
+                root = cachedDocument.getRoot();
+            else
+                Log(Debug::Warning) << "Can not load cached font metrics from " << cacheFile << ", rebuilding";
+        }
 
-            MyGUI::xml::ElementPtr code = codes->createChild("Code");
-            code->addAttribute("index", unicodeVal);
-            code->addAttribute("coord", MyGUI::utility::toString(x1) + " "
-                                        + MyGUI::utility::toString(y1) + " "
-                                        + MyGUI::utility::toString(w) + " "
-                                        + MyGUI::utility::toString(h));
-            code->addAttribute("advance", data[i].width);
-            code->addAttribute("bearing", MyGUI::utility::toString(data[i].kerning) + " "
-                               + MyGUI::utility::toString((fontSize-data[i].ascent)));
-            code->addAttribute("size", MyGUI::IntSize(static_cast<int>(data[i].width), static_cast<int>(data[i].height)));
+        if (root == nullptr)
+        {
+            generateGlyphMetrics(builtDocument, data, width, height, fontSize, resourceName, bitmapFilename, mEncoding);
+            root = builtDocument.getRoot();
 
-            // Fall back from unavailable Windows-1252 encoding symbols to similar characters available in the game fonts
-            std::multimap<int, int> additional; // fallback glyph index, unicode
-            additional.insert(std::make_pair(156, 0x00A2)); // cent sign
-            additional.insert(std::make_pair(89, 0x00A5)); // yen sign
-            additional.insert(std::make_pair(221, 0x00A6)); // broken bar
-            additional.insert(std::make_pair(99, 0x00A9)); // copyright sign
-            additional.insert(std::make_pair(97, 0x00AA)); // prima ordinal indicator
-            additional.insert(std::make_pair(60, 0x00AB)); // double left-pointing angle quotation mark
-            additional.insert(std::make_pair(45, 0x00AD)); // soft hyphen
-            additional.insert(std::make_pair(114, 0x00AE)); // registered trademark symbol
-            additional.insert(std::make_pair(45, 0x00AF)); // macron
-            additional.insert(std::make_pair(241, 0x00B1)); // plus-minus sign
-            additional.insert(std::make_pair(50, 0x00B2)); // superscript two
-            additional.insert(std::make_pair(51, 0x00B3)); // superscript three
-            additional.insert(std::make_pair(44, 0x00B8)); // cedilla
-            additional.insert(std::make_pair(49, 0x00B9)); // superscript one
-            additional.insert(std::make_pair(111, 0x00BA)); // primo ordinal indicator
-            additional.insert(std::make_pair(62, 0x00BB)); // double right-pointing angle quotation mark
-            additional.insert(std::make_pair(63, 0x00BF)); // inverted question mark
-            additional.insert(std::make_pair(65, 0x00C6)); // latin capital ae ligature
-            additional.insert(std::make_pair(79, 0x00D8)); // latin capital o with stroke
-            additional.insert(std::make_pair(97, 0x00E6)); // latin small ae ligature
-            additional.insert(std::make_pair(111, 0x00F8)); // latin small o with stroke
-            additional.insert(std::make_pair(79, 0x0152)); // latin capital oe ligature
-            additional.insert(std::make_pair(111, 0x0153)); // latin small oe ligature
-            additional.insert(std::make_pair(83, 0x015A)); // latin capital s with caron
-            additional.insert(std::make_pair(115, 0x015B)); // latin small s with caron
-            additional.insert(std::make_pair(89, 0x0178)); // latin capital y with diaresis
-            additional.insert(std::make_pair(90, 0x017D)); // latin capital z with caron
-            additional.insert(std::make_pair(122, 0x017E)); // latin small z with caron
-            additional.insert(std::make_pair(102, 0x0192)); // latin small f with hook
-            additional.insert(std::make_pair(94, 0x02C6)); // circumflex modifier
-            additional.insert(std::make_pair(126, 0x02DC)); // small tilde
-            additional.insert(std::make_pair(69, 0x0401)); // cyrillic capital io (no diaeresis latin e is available)
-            additional.insert(std::make_pair(137, 0x0451)); // cyrillic small io
-            additional.insert(std::make_pair(45, 0x2012)); // figure dash
-            additional.insert(std::make_pair(45, 0x2013)); // en dash
-            additional.insert(std::make_pair(45, 0x2014)); // em dash
-            additional.insert(std::make_pair(39, 0x2018)); // left single quotation mark
-            additional.insert(std::make_pair(39, 0x2019)); // right single quotation mark
-            additional.insert(std::make_pair(44, 0x201A)); // single low quotation mark
-            additional.insert(std::make_pair(39, 0x201B)); // single high quotation mark (reversed)
-            additional.insert(std::make_pair(34, 0x201C)); // left double quotation mark
-            additional.insert(std::make_pair(34, 0x201D)); // right double quotation mark
-            additional.insert(std::make_pair(44, 0x201E)); // double low quotation mark
-            additional.insert(std::make_pair(34, 0x201F)); // double high quotation mark (reversed)
-            additional.insert(std::make_pair(43, 0x2020)); // dagger
-            additional.insert(std::make_pair(216, 0x2021)); // double dagger (note: this glyph is not available)
-            additional.insert(std::make_pair(46, 0x2026)); // ellipsis
-            additional.insert(std::make_pair(37, 0x2030)); // per mille sign
-            additional.insert(std::make_pair(60, 0x2039)); // single left-pointing angle quotation mark
-            additional.insert(std::make_pair(62, 0x203A)); // single right-pointing angle quotation mark
-            additional.insert(std::make_pair(101, 0x20AC)); // euro sign
-            additional.insert(std::make_pair(84, 0x2122)); // trademark sign
-            additional.insert(std::make_pair(45, 0x2212)); // minus sign
-
-            for (std::multimap<int, int>::iterator it = additional.begin(); it != additional.end(); ++it)
+            if (exportToFile)
             {
-                if (it->first != i)
-                    continue;
-                code = codes->createChild("Code");
-                code->addAttribute("index", it->second);
-                code->addAttribute("coord", MyGUI::utility::toString(x1) + " "
-                                            + MyGUI::utility::toString(y1) + " "
-                                            + MyGUI::utility::toString(w) + " "
-                                            + MyGUI::utility::toString(h));
-                code->addAttribute("advance", data[i].width);
-                code->addAttribute("bearing", MyGUI::utility::toString(data[i].kerning) + " "
-                                   + MyGUI::utility::toString((fontSize-data[i].ascent)));
-                code->addAttribute("size", MyGUI::IntSize(static_cast<int>(data[i].width), static_cast<int>(data[i].height)));
+                Log(Debug::Info) << "Writing " << resourceName + ".xml";
+                builtDocument.createDeclaration();
+                builtDocument.save(resourceName + ".xml");
             }
-
-            // ASCII vertical bar, use this as text input cursor
-            if (i == 124)
-            {
-                MyGUI::xml::ElementPtr cursorCode = codes->createChild("Code");
-                cursorCode->addAttribute("index", MyGUI::FontCodeType::Cursor);
-                cursorCode->addAttribute("coord", MyGUI::utility::toString(x1) + " "
-                                            + MyGUI::utility::toString(y1) + " "
-                                            + MyGUI::utility::toString(w) + " "
-                                            + MyGUI::utility::toString(h));
-                cursorCode->addAttribute("advance", data[i].width);
-                cursorCode->addAttribute("bearing", MyGUI::utility::toString(data[i].kerning) + " "
-                                   + MyGUI::utility::toString((fontSize-data[i].ascent)));
-                cursorCode->addAttribute("size", MyGUI::IntSize(static_cast<int>(data[i].width), static_cast<int>(data[i].height)));
-            }
-
-            // Question mark, use for NotDefined marker (used for glyphs not existing in the font)
-            if (i == 63)
+            else
             {
-                MyGUI::xml::ElementPtr cursorCode = codes->createChild("Code");
-                cursorCode->addAttribute("index", MyGUI::FontCodeType::NotDefined);
-                cursorCode->addAttribute("coord", MyGUI::utility::toString(x1) + " "
-                                            + MyGUI::utility::toString(y1) + " "
-                                            + MyGUI::utility::toString(w) + " "
-                                            + MyGUI::utility::toString(h));
-                cursorCode->addAttribute("advance", data[i].width);
-                cursorCode->addAttribute("bearing", MyGUI::utility::toString(data[i].kerning) + " "
-                                   + MyGUI::utility::toString((fontSize-data[i].ascent)));
-                cursorCode->addAttribute("size", MyGUI::IntSize(static_cast<int>(data[i].width), static_cast<int>(data[i].height)));
+                try
+                {
+                    boost::filesystem::create_directories(mUserDataPath + "/Fonts/cache");
+                    builtDocument.createDeclaration();
+                    if (!builtDocument.save(cacheFile))
+                        Log(Debug::Warning) << "Can not write font cache file " << cacheFile;
+                }
+                catch (const std::exception& e)
+                {
+                    Log(Debug::Warning) << "Can not write font cache file " << cacheFile << ": " << e.what();
+                }
             }
         }
 
-        // These are required as well, but the fonts don't provide them
-        for (int i=0; i<2; ++i)
-        {
-            MyGUI::FontCodeType::Enum type;
-            if(i == 0)
-                type = MyGUI::FontCodeType::Selected;
-            else // if (i == 1)
-                type = MyGUI::FontCodeType::SelectedBack;
-
-            MyGUI::xml::ElementPtr cursorCode = codes->createChild("Code");
-            cursorCode->addAttribute("index", type);
-            cursorCode->addAttribute("coord", "0 0 0 0");
-            cursorCode->addAttribute("advance", "0");
-            cursorCode->addAttribute("bearing", "0 0");
-            cursorCode->addAttribute("size", "0 0");
-        }
-
-        if (exportToFile)
-        {
-            Log(Debug::Info) << "Writing " << resourceName + ".xml";
-            xmlDocument.createDeclaration();
-            xmlDocument.save(resourceName + ".xml");
-        }
-
         font->deserialization(root, MyGUI::Version(3,2,0));
 
         // Setup "book" version of font as fallback if we will not use TrueType fonts
@@ -37,6 +37,24 @@ namespace Interpreter
 
             virtual void report (const std::string& message) = 0;
 
+            // Index-based global variable access, used by compiled code. Indices are assigned
+            // by the compiler context (see Compiler::Context::getGlobalIndex).
+
+            virtual int getGlobalShort (int index) const = 0;
+
+            virtual int getGlobalLong (int index) const = 0;
+
+            virtual float getGlobalFloat (int index) const = 0;
+
+            virtual void setGlobalShort (int index, int value) = 0;
+
+            virtual void setGlobalLong (int index, int value) = 0;
+
+            virtual void setGlobalFloat (int index, float value) = 0;
+
+            // Name-based global variable access, used outside of compiled code (console, text
+            // defines).
+
             virtual int getGlobalShort (const std::string& name) const = 0;
 
             virtual int getGlobalLong (const std::string& name) const = 0;
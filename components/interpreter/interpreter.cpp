@@ -81,6 +81,76 @@ namespace Interpreter
         abortUnknownSegment (code);
     }
 
+    DecodedInstruction Interpreter::decode (Type_Code code) const
+    {
+        DecodedInstruction instruction;
+        instruction.mOpcode1 = nullptr;
+        instruction.mOpcode0 = nullptr;
+        instruction.mArg0 = 0;
+        instruction.mRaw = code;
+
+        unsigned int segSpec = code>>30;
+
+        switch (segSpec)
+        {
+            case 0:
+            {
+                std::map<int, Opcode1 *>::const_iterator iter = mSegment0.find (code>>24);
+
+                if (iter!=mSegment0.end())
+                {
+                    instruction.mOpcode1 = iter->second;
+                    instruction.mArg0 = code & 0xffffff;
+                }
+
+                return instruction;
+            }
+
+            case 2:
+            {
+                std::map<int, Opcode1 *>::const_iterator iter = mSegment2.find ((code>>20) & 0x3ff);
+
+                if (iter!=mSegment2.end())
+                {
+                    instruction.mOpcode1 = iter->second;
+                    instruction.mArg0 = code & 0xfffff;
+                }
+
+                return instruction;
+            }
+        }
+
+        segSpec = code>>26;
+
+        switch (segSpec)
+        {
+            case 0x30:
+            {
+                std::map<int, Opcode1 *>::const_iterator iter = mSegment3.find ((code>>8) & 0x3ffff);
+
+                if (iter!=mSegment3.end())
+                {
+                    instruction.mOpcode1 = iter->second;
+                    instruction.mArg0 = code & 0xff;
+                }
+
+                return instruction;
+            }
+
+            case 0x32:
+            {
+                std::map<int, Opcode0 *>::const_iterator iter = mSegment5.find (code & 0x3ffffff);
+
+                if (iter!=mSegment5.end())
+                    instruction.mOpcode0 = iter->second;
+
+                return instruction;
+            }
+        }
+
+        return instruction;
+    }
+
     [[noreturn]] void Interpreter::abortUnknownCode (int segment, int opcode)
     {
         const std::string error = "unknown opcode " + std::to_string(opcode) + " in segment " + std::to_string(segment);
@@ -166,25 +236,49 @@ namespace Interpreter
         mSegment5.insert (std::make_pair (code, opcode));
     }
 
-    void Interpreter::run (const Type_Code *code, int codeSize, Context& context)
+    Program Interpreter::precompile (const Type_Code *code, int codeSize) const
     {
         assert (codeSize>=4);
 
+        int opcodes = static_cast<int> (code[0]);
+
+        const Type_Code *codeBlock = code + 4;
+
+        Program program;
+        program.reserve (opcodes);
+
+        for (int i=0; i<opcodes; ++i)
+            program.push_back (decode (codeBlock[i]));
+
+        return program;
+    }
+
+    void Interpreter::run (const Type_Code *code, int codeSize, Context& context)
+    {
+        run (precompile (code, codeSize), code, codeSize, context);
+    }
+
+    void Interpreter::run (const Program& program, const Type_Code *code, int codeSize, Context& context)
+    {
         begin();
 
         try
         {
             mRuntime.configure (code, codeSize, context);
 
-            int opcodes = static_cast<int> (code[0]);
-
-            const Type_Code *codeBlock = code + 4;
+            int opcodes = static_cast<int> (program.size());
 
             while (mRuntime.getPC()>=0 && mRuntime.getPC()<opcodes)
             {
-                Type_Code runCode = codeBlock[mRuntime.getPC()];
+                const DecodedInstruction& instruction = program[mRuntime.getPC()];
                 mRuntime.setPC (mRuntime.getPC()+1);
-                execute (runCode);
+
+                if (instruction.mOpcode1)
+                    instruction.mOpcode1->execute (mRuntime, instruction.mArg0);
+                else if (instruction.mOpcode0)
+                    instruction.mOpcode0->execute (mRuntime);
+                else
+                    execute (instruction.mRaw); // unknown opcode; throws
             }
         }
         catch (...)
@@ -3,6 +3,7 @@
 
 #include <map>
 #include <stack>
+#include <vector>
 
 #include "runtime.hpp"
 #include "types.hpp"
@@ -12,6 +13,22 @@ namespace Interpreter
     class Opcode0;
     class Opcode1;
 
+    /// One pre-decoded instruction: the opcode handler resolved from the segment
+    /// tables plus the immediate argument, so executing it is a single indirect
+    /// call instead of a decode and map lookup per instruction. Exactly one of
+    /// the two handler pointers is set; if neither is (unknown opcode), \a mRaw
+    /// is re-dispatched on execution so the error is only reported when the
+    /// instruction is actually reached, as before.
+    struct DecodedInstruction
+    {
+        Opcode1 *mOpcode1;
+        Opcode0 *mOpcode0;
+        unsigned int mArg0;
+        Type_Code mRaw;
+    };
+
+    typedef std::vector<DecodedInstruction> Program;
+
     class Interpreter
     {
             std::stack<Runtime> mCallstack;
@@ -28,6 +45,8 @@ namespace Interpreter
 
             void execute (Type_Code code);
 
+            DecodedInstruction decode (Type_Code code) const;
+
             [[noreturn]] void abortUnknownCode (int segment, int opcode);
 
             [[noreturn]] void abortUnknownSegment (Type_Code code);
@@ -54,7 +73,15 @@ namespace Interpreter
             void installSegment5 (int code, Opcode0 *opcode);
             ///< ownership of \a opcode is transferred to *this.
 
+            Program precompile (const Type_Code *code, int codeSize) const;
+            ///< Resolve \a code into a \ref Program of handler pointers and inline
+            /// immediates. Must not be called before all opcodes are installed.
+
             void run (const Type_Code *code, int codeSize, Context& context);
+
+            void run (const Program& program, const Type_Code *code, int codeSize, Context& context);
+            ///< Run a program previously returned by precompile() for \a code.
+            /// \a code is still needed for the literal pool.
     };
 }
 
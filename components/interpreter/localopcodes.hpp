@@ -122,9 +122,7 @@ namespace Interpreter
                 Type_Integer data = runtime[0].mInteger;
                 int index = runtime[1].mInteger;
 
-                std::string name = runtime.getStringLiteral (index);
-
-                runtime.getContext().setGlobalShort (name, data);
+                runtime.getContext().setGlobalShort (index, data);
 
                 runtime.pop();
                 runtime.pop();
@@ -140,9 +138,7 @@ namespace Interpreter
                 Type_Integer data = runtime[0].mInteger;
                 int index = runtime[1].mInteger;
 
-                std::string name = runtime.getStringLiteral (index);
-
-                runtime.getContext().setGlobalLong (name, data);
+                runtime.getContext().setGlobalLong (index, data);
 
                 runtime.pop();
                 runtime.pop();
@@ -158,9 +154,7 @@ namespace Interpreter
                 Type_Float data = runtime[0].mFloat;
                 int index = runtime[1].mInteger;
 
-                std::string name = runtime.getStringLiteral (index);
-
-                runtime.getContext().setGlobalFloat (name, data);
+                runtime.getContext().setGlobalFloat (index, data);
 
                 runtime.pop();
                 runtime.pop();
@@ -174,8 +168,7 @@ namespace Interpreter
             void execute (Runtime& runtime) override
             {
                 int index = runtime[0].mInteger;
-                std::string name = runtime.getStringLiteral (index);
-                Type_Integer value = runtime.getContext().getGlobalShort (name);
+                Type_Integer value = runtime.getContext().getGlobalShort (index);
                 runtime[0].mInteger = value;
             }
     };
@@ -187,8 +180,7 @@ namespace Interpreter
             void execute (Runtime& runtime) override
             {
                 int index = runtime[0].mInteger;
-                std::string name = runtime.getStringLiteral (index);
-                Type_Integer value = runtime.getContext().getGlobalLong (name);
+                Type_Integer value = runtime.getContext().getGlobalLong (index);
                 runtime[0].mInteger = value;
             }
     };
@@ -200,8 +192,7 @@ namespace Interpreter
             void execute (Runtime& runtime) override
             {
                 int index = runtime[0].mInteger;
-                std::string name = runtime.getStringLiteral (index);
-                Type_Float value = runtime.getContext().getGlobalFloat (name);
+                Type_Float value = runtime.getContext().getGlobalFloat (index);
                 runtime[0].mFloat = value;
             }
     };
@@ -1,5 +1,8 @@
 #include "scriptscontainer.hpp"
 
+#include <cassert>
+#include <chrono>
+
 #include <components/esm/luascripts.hpp>
 
 namespace LuaUtil
@@ -9,6 +12,7 @@ namespace LuaUtil
 
     static constexpr std::string_view INTERFACE_NAME = "interfaceName";
     static constexpr std::string_view INTERFACE = "interface";
+    static constexpr std::string_view UPDATE_INTERVAL = "updateInterval";
 
     static constexpr std::string_view HANDLER_SAVE = "onSave";
     static constexpr std::string_view HANDLER_LOAD = "onLoad";
@@ -43,6 +47,8 @@ namespace LuaUtil
             sol::object script = mLua.runInNewSandbox(path, mNamePrefix, API, hiddenData);
             std::string interfaceName = "";
             sol::object publicInterface = sol::nil;
+            float updateInterval = 0;
+            size_t updateHandlersBefore = mUpdateHandlers.mList.size();
             if (script != sol::nil)
             {
                 for (auto& [key, value] : sol::table(script))
@@ -56,10 +62,21 @@ namespace LuaUtil
                         interfaceName = value.as<std::string>();
                     else if (sectionName == INTERFACE)
                         publicInterface = value.as<sol::table>();
+                    else if (sectionName == UPDATE_INTERVAL)
+                        updateInterval = value.as<float>();
                     else
                         Log(Debug::Error) << "Not supported section '" << sectionName << "' in " << mNamePrefix << "[" << path << "]";
                 }
             }
+            if (mUpdateHandlers.mList.size() > updateHandlersBefore)
+            {
+                UpdateHandlerStats handlerStats;
+                handlerStats.mScript = path;
+                handlerStats.mInterval = updateInterval;
+                mUpdateSchedule.push_back(std::move(handlerStats));
+            }
+            else if (updateInterval > 0)
+                Log(Debug::Error) << mNamePrefix << "[" << path << "]: 'updateInterval' has no effect without 'onUpdate'";
             if (interfaceName.empty() != (publicInterface == sol::nil))
                 Log(Debug::Error) << mNamePrefix << "[" << path << "]: 'interfaceName' should always be used together with 'interface'";
             else if (!interfaceName.empty())
@@ -114,7 +131,13 @@ namespace LuaUtil
                 if (handlerIter == mEngineHandlers.end())
                     continue;
                 std::vector<sol::protected_function>& list = handlerIter->second->mList;
-                list.erase(std::find(list.begin(), list.end(), value.as<sol::protected_function>()));
+                auto fnIter = std::find(list.begin(), list.end(), value.as<sol::protected_function>());
+                if (handlerIter->second == &mUpdateHandlers)
+                {
+                    mUpdateSchedule.erase(mUpdateSchedule.begin() + (fnIter - list.begin()));
+                    mUpdateQueueStart = 0;
+                }
+                list.erase(fnIter);
             }
         }
         sol::object eventHandlers = getFieldOrNil(script, EVENT_HANDLERS);
@@ -158,7 +181,60 @@ namespace LuaUtil
         }
     }
 
+    void ScriptsContainer::update(float dt, double* timeBudget)
+    {
+        mLastUpdateCalls = 0;
+        mLastUpdateDeferred = 0;
+        for (UpdateHandlerStats& handler : mUpdateSchedule)
+            handler.mAccumulatedDt += dt;
+        const size_t count = mUpdateHandlers.mList.size();
+        if (count == 0)
+            return;
+        assert(mUpdateSchedule.size() == count);
+        // Start where the previous update left off (if it ran out of budget), so
+        // deferred handlers are served before the ones that already ran.
+        size_t index = mUpdateQueueStart < count ? mUpdateQueueStart : 0;
+        for (size_t processed = 0; processed < count; ++processed)
+        {
+            UpdateHandlerStats& handler = mUpdateSchedule[index];
+            if (handler.mAccumulatedDt >= handler.mInterval)
+            {
+                if (timeBudget && *timeBudget <= 0)
+                {
+                    // Out of budget; the handler keeps accumulating dt and runs in a later frame.
+                    if (mLastUpdateDeferred == 0)
+                        mUpdateQueueStart = index;
+                    ++mLastUpdateDeferred;
+                }
+                else
+                {
+                    auto before = std::chrono::steady_clock::now();
+                    try { LuaUtil::call(mUpdateHandlers.mList[index], handler.mAccumulatedDt); }
+                    catch (std::exception& e)
+                    {
+                        Log(Debug::Error) << mNamePrefix << "[" << handler.mScript << "] onUpdate failed. " << e.what();
+                    }
+                    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - before).count();
+                    handler.mAccumulatedDt = 0;
+                    ++handler.mCalls;
+                    handler.mTotalTime += elapsed;
+                    ++mLastUpdateCalls;
+                    if (timeBudget)
+                        *timeBudget -= elapsed;
+                }
+            }
+            index = index + 1 == count ? 0 : index + 1;
+        }
+        if (mLastUpdateDeferred == 0)
+            mUpdateQueueStart = 0;
+    }
+
     void ScriptsContainer::receiveEvent(std::string_view eventName, std::string_view eventData)
+    {
+        receiveEvents(eventName, {eventData});
+    }
+
+    void ScriptsContainer::receiveEvents(std::string_view eventName, const std::vector<std::string_view>& eventData)
     {
         auto it = mEventHandlers.find(eventName);
         if (it == mEventHandlers.end())
@@ -166,28 +242,31 @@ namespace LuaUtil
             Log(Debug::Warning) << mNamePrefix << " has received event '" << eventName << "', but there are no handlers for this event";
             return;
         }
-        sol::object data;
-        try
-        {
-            data = LuaUtil::deserialize(mLua.sol(), eventData, mSerializer);
-        }
-        catch (std::exception& e)
-        {
-            Log(Debug::Error) << mNamePrefix << " can not parse eventData for '" << eventName << "': " << e.what();
-            return;
-        }
         EventHandlerList& list = it->second;
-        for (int i = list.size() - 1; i >= 0; --i)
+        for (std::string_view payload : eventData)
         {
+            sol::object data;
             try
             {
-                sol::object res = LuaUtil::call(list[i], data);
-                if (res != sol::nil && !res.as<bool>())
-                    break;  // Skip other handlers if 'false' was returned.
+                data = LuaUtil::deserialize(mLua.sol(), payload, mSerializer);
             }
             catch (std::exception& e)
             {
-                Log(Debug::Error) << mNamePrefix << " eventHandler[" << eventName << "] failed. " << e.what();
+                Log(Debug::Error) << mNamePrefix << " can not parse eventData for '" << eventName << "': " << e.what();
+                continue;
+            }
+            for (int i = list.size() - 1; i >= 0; --i)
+            {
+                try
+                {
+                    sol::object res = LuaUtil::call(list[i], data);
+                    if (res != sol::nil && !res.as<bool>())
+                        break;  // Skip other handlers if 'false' was returned.
+                }
+                catch (std::exception& e)
+                {
+                    Log(Debug::Error) << mNamePrefix << " eventHandler[" << eventName << "] failed. " << e.what();
+                }
             }
         }
     }
@@ -324,6 +403,8 @@ namespace LuaUtil
         mScriptOrder.clear();
         for (auto& [_, handlers] : mEngineHandlers)
             handlers->mList.clear();
+        mUpdateSchedule.clear();
+        mUpdateQueueStart = 0;
         mEventHandlers.clear();
         mSecondsTimersQueue.clear();
         mHoursTimersQueue.clear();
@@ -4,6 +4,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <components/debug/debuglog.hpp>
 #include <components/esm/luascripts.hpp>
@@ -32,6 +33,11 @@ namespace LuaUtil
 //     end
 //
 //     return {
+//         -- Optional minimal game time (in seconds) between two `onUpdate` calls.
+//         -- The handler then receives the accumulated dt. If absent or zero,
+//         -- `onUpdate` is called every frame.
+//         updateInterval = 0.25,
+//
 //         -- Provides interface for other scripts in the same container
 //         interfaceName = "InterfaceName",
 //         interface = {
@@ -91,9 +97,29 @@ namespace LuaUtil
         // Processes timers. gameSeconds and gameHours are time (in seconds and in game hours) passed from the game start.
         void processTimers(double gameSeconds, double gameHours);
 
-        // Calls `onUpdate` (if present) for every script in the container.
-        // Handlers are called in the same order as scripts were added.
-        void update(float dt) { callEngineHandlers(mUpdateHandlers, dt); }
+        // Scheduling state and accumulated timing of one `onUpdate` handler.
+        struct UpdateHandlerStats
+        {
+            std::string mScript;
+            float mInterval = 0;       // minimal game time (seconds) between two calls; 0 = call every frame
+            float mAccumulatedDt = 0;  // game time passed since the last call
+            int64_t mCalls = 0;
+            double mTotalTime = 0;     // total real time (seconds) spent in the handler
+        };
+
+        // Calls `onUpdate` for every script in the container whose `updateInterval` has passed.
+        // Handlers are called in the same order as scripts were added. If `timeBudget` (real
+        // time, seconds) is given, it is reduced by the time each handler takes; once it is
+        // exhausted the remaining handlers are deferred: they keep accumulating dt and are
+        // called first on the next update. Deferred handlers are never dropped.
+        void update(float dt, double* timeBudget = nullptr);
+
+        // Per-script `onUpdate` timing; for diagnostics.
+        const std::vector<UpdateHandlerStats>& getUpdateStats() const { return mUpdateSchedule; }
+
+        // Counters of the most recent `update` call.
+        unsigned getLastUpdateCallCount() const { return mLastUpdateCalls; }
+        unsigned getLastUpdateDeferredCount() const { return mLastUpdateDeferred; }
 
         // Calls event handlers `eventName` (if present) for every script.
         // If several scripts register handlers for `eventName`, they are called in reverse order.
@@ -101,6 +127,10 @@ namespace LuaUtil
         // (including `nil`) has no effect.
         void receiveEvent(std::string_view eventName, std::string_view eventData);
 
+        // Same as receiveEvent for a batch of payloads of the same event type;
+        // the handler list is resolved once for the whole batch.
+        void receiveEvents(std::string_view eventName, const std::vector<std::string_view>& eventData);
+
         // Serializer defines how to serialize/deserialize userdata. If serializer is not provided,
         // only built-in types and types from util package can be serialized.
         void setSerializer(const UserdataSerializer* serializer) { mSerializer = serializer; }
@@ -200,6 +230,10 @@ namespace LuaUtil
         sol::table mPublicInterfaces;
 
         EngineHandlerList mUpdateHandlers{"onUpdate"};
+        std::vector<UpdateHandlerStats> mUpdateSchedule;  // parallel to mUpdateHandlers.mList
+        size_t mUpdateQueueStart = 0;  // where the next `update` resumes after handlers were deferred
+        unsigned mLastUpdateCalls = 0;
+        unsigned mLastUpdateDeferred = 0;
         std::map<std::string_view, EngineHandlerList*> mEngineHandlers;
         std::map<std::string, EventHandlerList, std::less<>> mEventHandlers;
 
@@ -1,5 +1,10 @@
 #include "serialization.hpp"
 
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
 #include <osg/Vec2f>
 #include <osg/Vec3f>
 
@@ -8,7 +13,10 @@
 namespace LuaUtil
 {
 
-    constexpr unsigned char FORMAT_VERSION = 0;
+    // Version 1 prefixes every table with its size so it can be created
+    // pre-sized and replaces repeated strings with references into a
+    // deduplication table. Version 0 data is still accepted on load.
+    constexpr unsigned char FORMAT_VERSION = 1;
 
     enum class SerializedType : char
     {
@@ -17,12 +25,18 @@ namespace LuaUtil
         BOOLEAN =      0x2,
         TABLE_START =  0x3,
         TABLE_END =    0x4,
+        // 32bit index of an earlier string; both sides number all strings of at
+        // least MIN_DEDUP_STRING_SIZE bytes in order of first occurrence.
+        STRING_REF =   0x5,
 
         VEC2 =         0x10,
         VEC3 =         0x11,
 
         // All values should be lesser than 0x20 (SHORT_STRING_FLAG).
     };
+
+    // Strings shorter than a STRING_REF don't benefit from deduplication.
+    constexpr size_t MIN_DEDUP_STRING_SIZE = 6;
     constexpr unsigned char SHORT_STRING_FLAG = 0x20;    // 0b001SSSSS. SSSSS = string length
     constexpr unsigned char CUSTOM_FULL_FLAG = 0x40;     // 0b01TTTTTT + 32bit dataSize
     constexpr unsigned char CUSTOM_COMPACT_FLAG = 0x80;  // 0b1SSSSTTT. SSSS = dataSize, TTT = (typeName size - 1)
@@ -50,8 +64,22 @@ namespace LuaUtil
         return Misc::fromLittleEndian(v);
     }
 
-    static void appendString(BinaryData& out, std::string_view str)
+    // Keys are views into Lua-owned strings; the serialized object keeps them
+    // alive for the duration of the call.
+    using StringRefTable = std::unordered_map<std::string_view, uint32_t>;
+
+    static void appendString(BinaryData& out, std::string_view str, StringRefTable& stringRefs)
     {
+        if (str.size() >= MIN_DEDUP_STRING_SIZE)
+        {
+            const auto [it, inserted] = stringRefs.emplace(str, static_cast<uint32_t>(stringRefs.size()));
+            if (!inserted)
+            {
+                appendType(out, SerializedType::STRING_REF);
+                appendValue<uint32_t>(out, it->second);
+                return;
+            }
+        }
         if (str.size() < 32)
             out.push_back(SHORT_STRING_FLAG | char(str.size()));
         else
@@ -110,7 +138,8 @@ namespace LuaUtil
             throw std::runtime_error("Value is not serializable.");
     }
 
-    static void serialize(BinaryData& out, const sol::object& obj, const UserdataSerializer* customSerializer, int recursionCounter)
+    static void serialize(BinaryData& out, const sol::object& obj, const UserdataSerializer* customSerializer,
+                          int recursionCounter, StringRefTable& stringRefs)
     {
         if (obj.get_type() == sol::type::lightuserdata)
             throw std::runtime_error("Light userdata is not allowed to be serialized.");
@@ -124,11 +153,24 @@ namespace LuaUtil
                 throw std::runtime_error("Can not serialize more than 32 nested tables. Likely the table contains itself.");
             sol::table table = obj;
             appendType(out, SerializedType::TABLE_START);
+            // The sizes are not known before iterating, so patch them in afterwards.
+            const size_t sizesOffset = out.size();
+            appendValue<uint32_t>(out, 0);
+            appendValue<uint32_t>(out, 0);
+            uint32_t arraySize = 0, hashSize = 0;
             for (auto& [key, value] : table)
             {
-                serialize(out, key, customSerializer, recursionCounter + 1);
-                serialize(out, value, customSerializer, recursionCounter + 1);
+                if (key.get_type() == sol::type::number)
+                    ++arraySize;
+                else
+                    ++hashSize;
+                serialize(out, key, customSerializer, recursionCounter + 1, stringRefs);
+                serialize(out, value, customSerializer, recursionCounter + 1, stringRefs);
             }
+            uint32_t v = Misc::toLittleEndian(arraySize);
+            std::memcpy(out.data() + sizesOffset, &v, sizeof(v));
+            v = Misc::toLittleEndian(hashSize);
+            std::memcpy(out.data() + sizesOffset + sizeof(v), &v, sizeof(v));
             appendType(out, SerializedType::TABLE_END);
         }
         else if (obj.is<double>())
@@ -137,7 +179,7 @@ namespace LuaUtil
             appendValue<double>(out, obj.as<double>());
         }
         else if (obj.is<std::string_view>())
-            appendString(out, obj.as<std::string_view>());
+            appendString(out, obj.as<std::string_view>(), stringRefs);
         else if (obj.is<bool>())
         {
             char v = obj.as<bool>() ? 1 : 0;
@@ -147,7 +189,8 @@ namespace LuaUtil
             throw std::runtime_error("Unknown Lua type.");
     }
 
-    static void deserializeImpl(sol::state& lua, std::string_view& binaryData, const UserdataSerializer* customSerializer)
+    static void deserializeImpl(sol::state& lua, std::string_view& binaryData, const UserdataSerializer* customSerializer,
+                                unsigned char version, std::vector<std::string_view>& stringRefs)
     {
         if (binaryData.empty())
             throw std::runtime_error("Unexpected end of serialized data.");
@@ -176,7 +219,10 @@ namespace LuaUtil
         if (type & SHORT_STRING_FLAG)
         {
             size_t size = type & 0x1f;
-            sol::stack::push<std::string_view>(lua.lua_state(), binaryData.substr(0, size));
+            const std::string_view str = binaryData.substr(0, size);
+            if (size >= MIN_DEDUP_STRING_SIZE)
+                stringRefs.push_back(str);
+            sol::stack::push<std::string_view>(lua.lua_state(), str);
             binaryData = binaryData.substr(size);
             return;
         }
@@ -191,17 +237,35 @@ namespace LuaUtil
             case SerializedType::LONG_STRING:
             {
                 uint32_t size = getValue<uint32_t>(binaryData);
-                sol::stack::push<std::string_view>(lua.lua_state(), binaryData.substr(0, size));
+                const std::string_view str = binaryData.substr(0, size);
+                if (size >= MIN_DEDUP_STRING_SIZE)
+                    stringRefs.push_back(str);
+                sol::stack::push<std::string_view>(lua.lua_state(), str);
                 binaryData = binaryData.substr(size);
                 return;
             }
+            case SerializedType::STRING_REF:
+            {
+                uint32_t index = getValue<uint32_t>(binaryData);
+                if (index >= stringRefs.size())
+                    throw std::runtime_error("Invalid string reference in serialized data.");
+                sol::stack::push<std::string_view>(lua.lua_state(), stringRefs[index]);
+                return;
+            }
             case SerializedType::TABLE_START:
             {
-                lua_createtable(lua, 0, 0);
+                if (version >= 1)
+                {
+                    uint32_t arraySize = getValue<uint32_t>(binaryData);
+                    uint32_t hashSize = getValue<uint32_t>(binaryData);
+                    lua_createtable(lua, arraySize, hashSize);
+                }
+                else
+                    lua_createtable(lua, 0, 0);
                 while (!binaryData.empty() && binaryData[0] != char(SerializedType::TABLE_END))
                 {
-                    deserializeImpl(lua, binaryData, customSerializer);
-                    deserializeImpl(lua, binaryData, customSerializer);
+                    deserializeImpl(lua, binaryData, customSerializer, version, stringRefs);
+                    deserializeImpl(lua, binaryData, customSerializer, version, stringRefs);
                     lua_settable(lua, -3);
                 }
                 if (binaryData.empty())
@@ -236,19 +300,31 @@ namespace LuaUtil
             return "";
         BinaryData res;
         res.push_back(FORMAT_VERSION);
-        serialize(res, obj, customSerializer, 0);
+        StringRefTable stringRefs;
+        serialize(res, obj, customSerializer, 0, stringRefs);
         return res;
     }
 
+    void serialize(BinaryData& out, const sol::object& obj, const UserdataSerializer* customSerializer)
+    {
+        if (obj == sol::nil)
+            return;
+        out.push_back(FORMAT_VERSION);
+        StringRefTable stringRefs;
+        serialize(out, obj, customSerializer, 0, stringRefs);
+    }
+
     sol::object deserialize(sol::state& lua, std::string_view binaryData, const UserdataSerializer* customSerializer)
     {
         if (binaryData.empty())
             return sol::nil;
-        if (binaryData[0] != FORMAT_VERSION)
+        const unsigned char version = binaryData[0];
+        if (version > FORMAT_VERSION)
             throw std::runtime_error("Incorrect version of Lua serialization format: " +
-                                     std::to_string(static_cast<unsigned>(binaryData[0])));
+                                     std::to_string(static_cast<unsigned>(version)));
         binaryData = binaryData.substr(1);
-        deserializeImpl(lua, binaryData, customSerializer);
+        std::vector<std::string_view> stringRefs;
+        deserializeImpl(lua, binaryData, customSerializer, version, stringRefs);
         if (!binaryData.empty())
             throw std::runtime_error("Unexpected data after serialized object");
         return sol::stack::pop<sol::object>(lua.lua_state());
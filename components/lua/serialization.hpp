@@ -28,6 +28,10 @@ namespace LuaUtil
     };
 
     BinaryData serialize(const sol::object&, const UserdataSerializer* customSerializer = nullptr);
+
+    // Appends the serialized object to `out` (nothing for nil), allowing several
+    // objects to share one buffer without a temporary string each.
+    void serialize(BinaryData& out, const sol::object&, const UserdataSerializer* customSerializer = nullptr);
     sol::object deserialize(sol::state& lua, std::string_view binaryData, const UserdataSerializer* customSerializer = nullptr);
 
 }
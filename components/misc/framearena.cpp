@@ -0,0 +1,99 @@
+#include "framearena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#include <components/debug/debuglog.hpp>
+
+namespace
+{
+    constexpr std::size_t sInitialBlockSize = 64 * 1024;
+
+    // Prepended to every allocation in debug mode; 16 bytes keeps alignment.
+    struct DebugHeader
+    {
+        std::uint64_t mGeneration;
+        std::uint64_t mUnused;
+    };
+}
+
+namespace Misc
+{
+
+    FrameArena& FrameArena::get()
+    {
+        static thread_local FrameArena arena;
+        return arena;
+    }
+
+    FrameArena::FrameArena()
+        : mDebug(std::getenv("OPENMW_FRAME_ARENA_DEBUG") != nullptr)
+    {
+    }
+
+    void* FrameArena::allocate(std::size_t bytes, std::size_t alignment)
+    {
+        const std::size_t headerSize = mDebug ? sizeof(DebugHeader) : 0;
+        if (mDebug)
+            alignment = std::max(alignment, alignof(DebugHeader));
+
+        for (;;)
+        {
+            if (mCurrentBlock < mBlocks.size())
+            {
+                const Block& block = mBlocks[mCurrentBlock];
+                const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block.mData.get());
+                const std::uintptr_t ptr = (base + mOffset + headerSize + alignment - 1) / alignment * alignment;
+                if (ptr + bytes <= base + block.mSize)
+                {
+                    mOffset = ptr + bytes - base;
+                    if (mDebug)
+                    {
+                        DebugHeader* header = reinterpret_cast<DebugHeader*>(ptr) - 1;
+                        header->mGeneration = mGeneration;
+                        ++mOutstanding;
+                    }
+                    return reinterpret_cast<void*>(ptr);
+                }
+
+                // Doesn't fit; move on (the leftover space is reused after the next reset)
+                ++mCurrentBlock;
+                mOffset = 0;
+                continue;
+            }
+
+            std::size_t blockSize = mBlocks.empty() ? sInitialBlockSize : mBlocks.back().mSize * 2;
+            blockSize = std::max(blockSize, bytes + alignment + headerSize);
+            mBlocks.push_back({std::unique_ptr<char[]>(new char[blockSize]), blockSize});
+        }
+    }
+
+    void FrameArena::deallocate(void* ptr) noexcept
+    {
+        if (!mDebug || ptr == nullptr)
+            return;
+
+        DebugHeader* header = static_cast<DebugHeader*>(ptr) - 1;
+        if (header->mGeneration != mGeneration)
+        {
+            Log(Debug::Error) << "FrameArena: memory allocated in frame " << header->mGeneration
+                << " was freed in frame " << mGeneration << "; a per-frame container outlived its frame";
+            return;
+        }
+        --mOutstanding;
+    }
+
+    void FrameArena::reset() noexcept
+    {
+        if (mDebug && mOutstanding != 0)
+            Log(Debug::Error) << "FrameArena: " << mOutstanding
+                << " allocations were still alive at frame end; their memory is being reused";
+
+        mCurrentBlock = 0;
+        mOffset = 0;
+        ++mGeneration;
+        mOutstanding = 0;
+    }
+
+}
@@ -0,0 +1,83 @@
+#ifndef MISC_FRAMEARENA_H
+#define MISC_FRAMEARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Misc
+{
+    /// \brief Bump allocator for short-lived per-frame temporaries.
+    ///
+    /// Allocation is a pointer bump into a chain of blocks and deallocation is a
+    /// no-op; the engine resets the arena once per frame, after which all memory
+    /// handed out during the frame is reused. There is one arena per thread, but
+    /// only the main simulation thread's arena is ever reset - containers built on
+    /// it (see FrameAllocator) must not be used from other threads and must not
+    /// outlive the frame.
+    ///
+    /// Setting the OPENMW_FRAME_ARENA_DEBUG environment variable stamps every
+    /// allocation with the frame it was made in so use across a reset is reported
+    /// instead of silently corrupting reused memory.
+    class FrameArena
+    {
+        public:
+            /// The calling thread's arena.
+            static FrameArena& get();
+
+            void* allocate(std::size_t bytes, std::size_t alignment);
+
+            void deallocate(void* ptr) noexcept;
+
+            /// Make all memory allocated since the last reset available again.
+            void reset() noexcept;
+
+        private:
+            FrameArena();
+
+            struct Block
+            {
+                std::unique_ptr<char[]> mData;
+                std::size_t mSize;
+            };
+
+            std::vector<Block> mBlocks;
+            std::size_t mCurrentBlock = 0;
+            std::size_t mOffset = 0;
+
+            const bool mDebug;
+            std::size_t mGeneration = 0;
+            std::size_t mOutstanding = 0;
+    };
+
+    /// std-compatible allocator handing out memory from the calling thread's FrameArena.
+    template <class T>
+    class FrameAllocator
+    {
+        public:
+            using value_type = T;
+
+            FrameAllocator() = default;
+
+            template <class U>
+            FrameAllocator(const FrameAllocator<U>&) noexcept {}
+
+            T* allocate(std::size_t count)
+            {
+                return static_cast<T*>(FrameArena::get().allocate(count * sizeof(T), alignof(T)));
+            }
+
+            void deallocate(T* ptr, std::size_t) noexcept
+            {
+                FrameArena::get().deallocate(ptr);
+            }
+
+            template <class U>
+            bool operator==(const FrameAllocator<U>&) const noexcept { return true; }
+
+            template <class U>
+            bool operator!=(const FrameAllocator<U>&) const noexcept { return false; }
+    };
+}
+
+#endif
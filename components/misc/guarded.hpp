@@ -3,15 +3,44 @@
 
 #include <mutex>
 #include <memory>
+#include <shared_mutex>
 #include <condition_variable>
 
 namespace Misc
 {
-    template <class T>
+    template <class T, class Mutex = std::mutex>
     class Locked
     {
         public:
-            Locked(std::mutex& mutex, T& value)
+            Locked(Mutex& mutex, T& value)
+                : mLock(mutex), mValue(value)
+            {}
+
+            T& get() const
+            {
+                return mValue.get();
+            }
+
+            T* operator ->() const
+            {
+                return std::addressof(get());
+            }
+
+            T& operator *() const
+            {
+                return get();
+            }
+
+        private:
+            std::unique_lock<Mutex> mLock;
+            std::reference_wrapper<T> mValue;
+    };
+
+    template <class T>
+    class SharedLocked
+    {
+        public:
+            SharedLocked(std::shared_mutex& mutex, T& value)
                 : mLock(mutex), mValue(value)
             {}
 
@@ -31,7 +60,7 @@ namespace Misc
             }
 
         private:
-            std::unique_lock<std::mutex> mLock;
+            std::shared_lock<std::shared_mutex> mLock;
             std::reference_wrapper<T> mValue;
     };
 
@@ -91,6 +120,41 @@ namespace Misc
             mutable std::mutex mMutex;
             T mValue;
     };
+
+    /// \brief Like ScopeGuarded, but read-only access through lockConst() takes a
+    /// shared lock, so any number of readers can run concurrently and only block
+    /// while a writer holds the exclusive lock obtained through lock().
+    template <class T>
+    class SharedGuarded
+    {
+        public:
+            SharedGuarded()
+                : mValue()
+            {}
+
+            SharedGuarded(T&& value)
+                : mValue(std::move(value))
+            {}
+
+            template <class ... Args>
+            SharedGuarded(Args&& ... args)
+                : mValue(std::forward<Args>(args) ...)
+            {}
+
+            Locked<T, std::shared_mutex> lock()
+            {
+                return Locked<T, std::shared_mutex>(mMutex, mValue);
+            }
+
+            SharedLocked<const T> lockConst() const
+            {
+                return SharedLocked<const T>(mMutex, mValue);
+            }
+
+        private:
+            mutable std::shared_mutex mMutex;
+            T mValue;
+    };
 }
 
 #endif
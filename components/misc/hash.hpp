@@ -1,6 +1,11 @@
 #ifndef MISC_HASH_H
 #define MISC_HASH_H
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+
 namespace Misc
 {
     /// Implemented similar to the boost::hash_combine
@@ -10,6 +15,34 @@ namespace Misc
         std::hash<T> hasher;
         seed ^= hasher(v) + 0x9e3779b9 + (seed<<6) + (seed>>2);
     }
+
+    /// 64 bit FNV-1a, shared by the disk caches and content hashes so that equal
+    /// bytes produce the same key in every subsystem. Start from fnv1aBasis and
+    /// feed bytes through fnv1aAppend, or use the one-shot fnv1a for a single range.
+    constexpr std::uint64_t fnv1aBasis = 0xcbf29ce484222325ull;
+
+    constexpr std::uint64_t fnv1aAppend(std::uint64_t hash, unsigned char byte)
+    {
+        return (hash ^ byte) * 0x100000001b3ull;
+    }
+
+    inline std::uint64_t fnv1aAppend(std::uint64_t hash, const void* data, std::size_t size)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i)
+            hash = fnv1aAppend(hash, bytes[i]);
+        return hash;
+    }
+
+    inline std::uint64_t fnv1aAppend(std::uint64_t hash, std::string_view data)
+    {
+        return fnv1aAppend(hash, data.data(), data.size());
+    }
+
+    inline std::uint64_t fnv1a(const void* data, std::size_t size)
+    {
+        return fnv1aAppend(fnv1aBasis, data, size);
+    }
 }
 
-#endif
\ No newline at end of file
+#endif
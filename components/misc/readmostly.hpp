@@ -0,0 +1,71 @@
+#ifndef OPENMW_COMPONENTS_MISC_READMOSTLY_H
+#define OPENMW_COMPONENTS_MISC_READMOSTLY_H
+
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace Misc
+{
+    /// \brief Copy-on-write wrapper for read-mostly shared state.
+    ///
+    /// Readers take a snapshot of the current version with read() without acquiring
+    /// any lock and may keep using it for as long as they like; the snapshot stays
+    /// valid even if a writer publishes a new version meanwhile. Writers are
+    /// serialized by a mutex and publish a modified copy of the value, so every
+    /// update pays the cost of copying T and should be much rarer than reads.
+    /// Unlike ScopeGuarded a reader can never block a writer or another reader,
+    /// but it also never observes a version mid-modification.
+    template <class T>
+    class ReadMostly
+    {
+        public:
+            ReadMostly()
+                : mValue(std::make_shared<const T>())
+            {}
+
+            ReadMostly(T value)
+                : mValue(std::make_shared<const T>(std::move(value)))
+            {}
+
+            /// Snapshot of the most recently published version.
+            std::shared_ptr<const T> read() const
+            {
+                return std::atomic_load_explicit(&mValue, std::memory_order_acquire);
+            }
+
+            /// Copy the current version, apply function to the copy and publish the result.
+            /// Returns whatever the function returns.
+            template <class Function>
+            auto modify(Function&& function)
+            {
+                const std::lock_guard<std::mutex> lock(mWriteMutex);
+                auto value = std::make_shared<T>(
+                    *std::atomic_load_explicit(&mValue, std::memory_order_relaxed));
+                if constexpr (std::is_void_v<decltype(function(*value))>)
+                {
+                    function(*value);
+                    publish(std::move(value));
+                }
+                else
+                {
+                    auto result = function(*value);
+                    publish(std::move(value));
+                    return result;
+                }
+            }
+
+        private:
+            void publish(std::shared_ptr<T>&& value)
+            {
+                std::atomic_store_explicit(&mValue,
+                    std::shared_ptr<const T>(std::move(value)), std::memory_order_release);
+            }
+
+            std::mutex mWriteMutex;
+            std::shared_ptr<const T> mValue;
+    };
+}
+
+#endif
@@ -7,6 +7,7 @@
 #include <string_view>
 #include <iterator>
 
+#include "hash.hpp"
 #include "utf8stream.hpp"
 
 namespace Misc
@@ -107,7 +108,7 @@ public:
         return out;
     }
 
-    static bool ciLess(const std::string &x, const std::string &y) {
+    static bool ciLess(std::string_view x, std::string_view y) {
         return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end(), ci());
     }
 
@@ -184,12 +185,45 @@ public:
 
     struct CiComp
     {
-        bool operator()(const std::string& left, const std::string& right) const
+        // Transparent so maps keyed with this comparator can be probed with a
+        // string_view or string of any case without building a lowercased copy
+        using is_transparent = void;
+
+        bool operator()(std::string_view left, std::string_view right) const
         {
             return ciLess(left, right);
         }
     };
 
+    /// Hash functor for keying unordered containers by string case-insensitively.
+    /// Case is folded on the fly while hashing, so keys can be stored in their
+    /// original spelling and probed without building a lowercased copy first.
+    /// Use together with CiEqualTo.
+    struct CiHash
+    {
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view str) const
+        {
+            // FNV-1a over the case-folded bytes
+            std::uint64_t hash = fnv1aBasis;
+            for (char c : str)
+                hash = fnv1aAppend(hash, static_cast<unsigned char>(toLower(c)));
+            return static_cast<std::size_t>(hash);
+        }
+    };
+
+    /// Equality functor counterpart to CiHash.
+    struct CiEqualTo
+    {
+        using is_transparent = void;
+
+        bool operator()(std::string_view left, std::string_view right) const
+        {
+            return ciEqual(left, right);
+        }
+    };
+
 
     /// Performs a binary search on a sorted container for a string that 'key' starts with
     template<typename Iterator, typename T>
@@ -117,24 +117,34 @@ public:
 
         mReadFrom = (mReadFrom+1)%sNumBuffers;
         const std::vector<Batch>& vec = mBatchVector[mReadFrom];
+        // consecutive batches commonly share the same texture and state (e.g. all the text
+        // glyphs of a window), so only bother the driver when either actually changes
+        osg::StateSet* appliedStateSet = nullptr;
+        osg::Texture2D* appliedTexture = nullptr;
         for (std::vector<Batch>::const_iterator it = vec.begin(); it != vec.end(); ++it)
         {
             const Batch& batch = *it;
             osg::VertexBufferObject *vbo = batch.mVertexBuffer;
 
-            if (batch.mStateSet)
+            if (batch.mStateSet != appliedStateSet)
             {
-                state->pushStateSet(batch.mStateSet);
+                if (appliedStateSet)
+                    state->popStateSet();
+                appliedStateSet = batch.mStateSet;
+                if (appliedStateSet)
+                    state->pushStateSet(appliedStateSet);
                 state->apply();
+                appliedTexture = nullptr; // state->apply() may have rebound the texture unit
             }
 
             // A GUI element without an associated texture would be extremely rare.
             // It is worth it to use a dummy 1x1 black texture sampler instead of either adding a conditional or relinking shaders.
-            osg::Texture2D* texture = batch.mTexture;
-            if(texture)
+            osg::Texture2D* texture = batch.mTexture ? batch.mTexture.get() : mDummyTexture.get();
+            if (texture != appliedTexture)
+            {
                 state->applyTextureAttribute(0, texture);
-            else
-                state->applyTextureAttribute(0, mDummyTexture);
+                appliedTexture = texture;
+            }
 
             osg::GLBufferObject* bufferobject = state->isVertexBufferObjectSupported() ? vbo->getOrCreateGLBufferObject(state->getContextID()) : nullptr;
             if (bufferobject)
@@ -153,12 +163,12 @@ public:
             }
 
             glDrawArrays(GL_TRIANGLES, 0, batch.mVertexCount);
+        }
 
-            if (batch.mStateSet)
-            {
-                state->popStateSet();
-                state->apply();
-            }
+        if (appliedStateSet)
+        {
+            state->popStateSet();
+            state->apply();
         }
 
         glDisableClientState(GL_VERTEX_ARRAY);
@@ -446,12 +456,25 @@ void RenderManager::enableShaders(Shader::ShaderManager& shaderManager)
 
 MyGUI::IVertexBuffer* RenderManager::createVertexBuffer()
 {
+    // MyGUI creates and destroys vertex buffers with its layer nodes, i.e. every time a window
+    // is opened or closed. Reusing pooled buffers keeps their arrays and GL buffer objects
+    // alive across that, so reopening a window doesn't reallocate and reupload everything.
+    if (!mVertexBufferPool.empty())
+    {
+        MyGUI::IVertexBuffer* buffer = mVertexBufferPool.back();
+        mVertexBufferPool.pop_back();
+        return buffer;
+    }
     return new OSGVertexBuffer();
 }
 
 void RenderManager::destroyVertexBuffer(MyGUI::IVertexBuffer *buffer)
 {
-    delete buffer;
+    // cap the pool so a burst of one-off windows can't hold memory forever
+    if (mVertexBufferPool.size() < 64)
+        mVertexBufferPool.push_back(buffer);
+    else
+        delete buffer;
 }
 
 
@@ -592,6 +615,10 @@ void RenderManager::destroyAllResources()
     for (MapTexture::iterator it = mTextures.begin(); it != mTextures.end(); ++it)
         delete it->second;
     mTextures.clear();
+
+    for (MyGUI::IVertexBuffer* buffer : mVertexBufferPool)
+        delete buffer;
+    mVertexBufferPool.clear();
 }
 
 bool RenderManager::checkTexture(MyGUI::ITexture* _texture)
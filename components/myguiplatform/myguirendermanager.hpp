@@ -50,6 +50,9 @@ class RenderManager : public MyGUI::RenderManager, public MyGUI::IRenderTarget
     typedef std::map<std::string, MyGUI::ITexture*> MapTexture;
     MapTexture mTextures;
 
+    // Buffers handed back by destroyVertexBuffer, kept for reuse with their allocations intact.
+    std::vector<MyGUI::IVertexBuffer*> mVertexBufferPool;
+
     bool mIsInitialise;
 
     osg::ref_ptr<osg::Camera> mGuiRoot;
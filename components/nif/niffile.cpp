@@ -1,6 +1,8 @@
 #include "niffile.hpp"
 #include "effect.hpp"
 
+#include <components/files/memorystream.hpp>
+
 #include <array>
 #include <map>
 #include <sstream>
@@ -8,6 +10,26 @@
 namespace Nif
 {
 
+void* RecordArena::allocate(std::size_t size)
+{
+    // Records larger than a chunk get a dedicated one, behind the current chunk.
+    if (size > sChunkSize)
+    {
+        const auto it = mChunks.emplace(mChunks.empty() ? mChunks.end() : mChunks.end() - 1, std::make_unique<char[]>(size));
+        return it->get();
+    }
+
+    mFreeOffset = (mFreeOffset + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+    if (mFreeOffset + size > sChunkSize)
+    {
+        mChunks.push_back(std::make_unique<char[]>(sChunkSize));
+        mFreeOffset = 0;
+    }
+    void* result = mChunks.back().get() + mFreeOffset;
+    mFreeOffset += size;
+    return result;
+}
+
 /// Open a NIF stream. The name is used for error messages.
 NIFFile::NIFFile(Files::IStreamPtr stream, const std::string &name)
     : filename(name)
@@ -17,15 +39,20 @@ NIFFile::NIFFile(Files::IStreamPtr stream, const std::string &name)
 
 NIFFile::~NIFFile()
 {
+    // The records live in mArena, so only their destructors need to run here.
     for (Record* record : records)
-        delete record;
+        if (record != nullptr)
+            record->~Record();
 }
 
-template <typename NodeType> static Record* construct() { return new NodeType; }
+template <typename NodeType> static Record* construct(RecordArena& arena)
+{
+    return new (arena.allocate(sizeof(NodeType))) NodeType;
+}
 
 struct RecordFactoryEntry {
 
-    using create_t = Record* (*)();
+    using create_t = Record* (*)(RecordArena&);
 
     create_t        mCreate;
     RecordType      mType;
@@ -156,6 +183,17 @@ std::string NIFFile::printVersion(unsigned int version)
 
 void NIFFile::parse(Files::IStreamPtr stream)
 {
+    // Record parsing does many small reads, so pull the whole file into one
+    // buffer up front instead of hitting the underlying VFS stream each time.
+    // Read chunk-wise; not every archive stream supports seeking to the end.
+    std::vector<char> buffer;
+    char chunk[4096];
+    while (stream->read(chunk, sizeof(chunk)) || stream->gcount() > 0)
+        buffer.insert(buffer.end(), chunk, chunk + stream->gcount());
+    if (stream->bad())
+        fail("Failed to buffer file content");
+    stream = std::make_shared<Files::IMemStream>(buffer.data(), buffer.size());
+
     NIFStream nif (this, stream);
 
     // Check the header string
@@ -292,7 +330,7 @@ void NIFFile::parse(Files::IStreamPtr stream)
 
         if (entry != factories.end())
         {
-            r = entry->second.mCreate ();
+            r = entry->second.mCreate (mArena);
             r->recType = entry->second.mType;
         }
         else
@@ -3,6 +3,8 @@
 #ifndef OPENMW_COMPONENTS_NIF_NIFFILE_HPP
 #define OPENMW_COMPONENTS_NIF_NIFFILE_HPP
 
+#include <cstddef>
+#include <memory>
 #include <stdexcept>
 #include <vector>
 
@@ -14,6 +16,23 @@
 namespace Nif
 {
 
+/// Bump allocator for the records of one file. Records are placement-constructed
+/// into large chunks instead of being allocated one by one, and the chunks are
+/// released as a unit when the file is destroyed, so long sessions don't fragment
+/// the heap with record-sized holes.
+class RecordArena
+{
+public:
+    /// Returns storage suitable for an object of the given size. Never returns nullptr.
+    void* allocate(std::size_t size);
+
+private:
+    static constexpr std::size_t sChunkSize = 16384;
+
+    std::vector<std::unique_ptr<char[]>> mChunks;
+    std::size_t mFreeOffset = sChunkSize;
+};
+
 struct File
 {
     virtual ~File() = default;
@@ -51,7 +70,10 @@ class NIFFile final : public File
     /// File name, used for error messages and opening the file
     std::string filename;
 
-    /// Record list
+    /// Backing storage of all records
+    RecordArena mArena;
+
+    /// Record list. The records are owned by mArena.
     std::vector<Record*> records;
 
     /// Root list.  This is a select portion of the pointers from records
@@ -11,6 +11,8 @@
 #include <components/misc/convert.hpp>
 #include <components/misc/stringops.hpp>
 
+#include <components/resource/bvhcache.hpp>
+
 #include <components/nif/node.hpp>
 #include <components/nif/data.hpp>
 #include <components/nif/extra.hpp>
@@ -174,28 +176,38 @@ osg::ref_ptr<Resource::BulletShape> BulletNifLoader::load(const Nif::File& nif)
         {
             btTransform trans;
             trans.setIdentity();
-            std::unique_ptr<btCollisionShape> child(new Resource::TriangleMeshShape(mStaticMesh.get(), true));
+            std::unique_ptr<btCollisionShape> child = makeStaticShape(std::move(mStaticMesh), true);
             mCompoundShape->addChildShape(trans, child.get());
             child.release();
-            mStaticMesh.release();
         }
         mShape->mCollisionShape = mCompoundShape.release();
     }
     else if (mStaticMesh)
     {
-        mShape->mCollisionShape = new Resource::TriangleMeshShape(mStaticMesh.get(), true);
-        mStaticMesh.release();
+        mShape->mCollisionShape = makeStaticShape(std::move(mStaticMesh), true).release();
     }
 
     if (mAvoidStaticMesh)
     {
-        mShape->mAvoidCollisionShape = new Resource::TriangleMeshShape(mAvoidStaticMesh.get(), false);
-        mAvoidStaticMesh.release();
+        mShape->mAvoidCollisionShape = makeStaticShape(std::move(mAvoidStaticMesh), false).release();
     }
 
     return mShape;
 }
 
+// Builds the shape for a static mesh, going through the BVH disk cache if one is configured.
+// Animated shapes are not routed through the cache: applying their node scale via
+// setLocalScaling discards and rebuilds the BVH, and they are small.
+std::unique_ptr<Resource::TriangleMeshShape> BulletNifLoader::makeStaticShape(std::unique_ptr<btTriangleMesh> mesh, bool useQuantizedAabbCompression) const
+{
+    if (mBvhCache)
+        return std::unique_ptr<Resource::TriangleMeshShape>(mBvhCache->makeShape(std::move(mesh), useQuantizedAabbCompression));
+
+    std::unique_ptr<Resource::TriangleMeshShape> shape(new Resource::TriangleMeshShape(mesh.get(), useQuantizedAabbCompression));
+    mesh.release();
+    return shape;
+}
+
 // Find a boundingBox in the node hierarchy.
 // Return: use bounding box for collision?
 bool BulletNifLoader::findBoundingBox(const Nif::Node* node, const std::string& filename)
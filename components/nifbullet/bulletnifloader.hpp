@@ -29,6 +29,11 @@ namespace Nif
     struct NiTriStrips;
 }
 
+namespace Resource
+{
+    class BvhCache;
+}
+
 namespace NifBullet
 {
 
@@ -38,6 +43,11 @@ namespace NifBullet
 class BulletNifLoader
 {
 public:
+    explicit BulletNifLoader(const Resource::BvhCache* bvhCache = nullptr)
+        : mBvhCache(bvhCache)
+    {
+    }
+
     void warn(const std::string &msg)
     {
         Log(Debug::Warning) << "NIFLoader: Warn: " << msg;
@@ -61,6 +71,10 @@ private:
 
     void handleNiTriShape(const Nif::Node *nifNode, int flags, const osg::Matrixf& transform, bool isAnimated, bool avoid);
 
+    std::unique_ptr<Resource::TriangleMeshShape> makeStaticShape(std::unique_ptr<btTriangleMesh> mesh, bool useQuantizedAabbCompression) const;
+
+    const Resource::BvhCache* mBvhCache;
+
     std::unique_ptr<btCompoundShape> mCompoundShape;
 
     std::unique_ptr<btTriangleMesh> mStaticMesh;
@@ -12,9 +12,106 @@
 
 #include "matrixtransform.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 namespace NifOsg
 {
 
+namespace
+{
+    // Quantization alone deviates by the 16 bit rounding error; allow a little more than that
+    // so only genuinely non-uniform tracks fall back to the raw keys.
+    constexpr float sPackedTrackTolerance = 0.001f; // radians
+    constexpr float sPackedTrackMaxRate = 120.f; // samples per second
+    constexpr float sPackedTrackScale = 32767.f;
+
+    osg::Quat slerpQuaternionKeys(const Nif::QuaternionKeyMap::MapType& keys, float time)
+    {
+        if (time <= keys.begin()->first)
+            return keys.begin()->second.mValue;
+        const auto it = keys.lower_bound(time);
+        if (it == keys.end())
+            return keys.rbegin()->second.mValue;
+        const auto low = std::prev(it);
+        const float fraction = (time - low->first) / (it->first - low->first);
+        osg::Quat result;
+        result.slerp(fraction, low->second.mValue, it->second.mValue);
+        return result;
+    }
+}
+
+std::shared_ptr<const PackedQuaternionTrack> PackedQuaternionTrack::create(const Nif::QuaternionKeyMap& keys)
+{
+    if (keys.mInterpolationType != Nif::InterpolationType_Linear || keys.mKeys.size() < 2)
+        return nullptr;
+
+    const float start = keys.mKeys.begin()->first;
+    const float duration = keys.mKeys.rbegin()->first - start;
+    if (duration <= 0.f)
+        return nullptr;
+
+    const float rate = std::clamp(std::round((keys.mKeys.size() - 1) / duration), 1.f, sPackedTrackMaxRate);
+    const std::size_t sampleCount = std::max<std::size_t>(2, static_cast<std::size_t>(std::round(duration * rate)) + 1);
+    // resampling a sparse track would cost more memory than its raw keys
+    if (sampleCount > keys.mKeys.size() * 4)
+        return nullptr;
+
+    auto track = std::make_shared<PackedQuaternionTrack>();
+    track->mStartTime = start;
+    track->mSampleRate = rate;
+    track->mSamples.reserve(sampleCount);
+    for (std::size_t i = 0; i < sampleCount; ++i)
+    {
+        const osg::Quat value = slerpQuaternionKeys(keys.mKeys, start + i / rate);
+        track->mSamples.push_back({static_cast<std::int16_t>(std::round(value.x() * sPackedTrackScale)),
+                                   static_cast<std::int16_t>(std::round(value.y() * sPackedTrackScale)),
+                                   static_cast<std::int16_t>(std::round(value.z() * sPackedTrackScale)),
+                                   static_cast<std::int16_t>(std::round(value.w() * sPackedTrackScale))});
+    }
+
+    // Reject the track unless it reproduces the source keys and the midpoints between them;
+    // |q1 . q2| = cos(angle / 2) for unit quaternions.
+    const double minDot = std::cos(sPackedTrackTolerance * 0.5f);
+    const auto withinTolerance = [&](float time, const osg::Quat& expected)
+    {
+        return std::abs(expected.asVec4() * track->sample(time).asVec4()) >= minDot;
+    };
+    for (auto it = keys.mKeys.begin(); it != keys.mKeys.end(); ++it)
+    {
+        if (!withinTolerance(it->first, it->second.mValue))
+            return nullptr;
+        const auto next = std::next(it);
+        if (next != keys.mKeys.end())
+        {
+            const float midTime = (it->first + next->first) / 2.f;
+            if (!withinTolerance(midTime, slerpQuaternionKeys(keys.mKeys, midTime)))
+                return nullptr;
+        }
+    }
+
+    return track;
+}
+
+osg::Quat PackedQuaternionTrack::sample(float time) const
+{
+    const float position = std::clamp((time - mStartTime) * mSampleRate, 0.f, float(mSamples.size() - 1));
+    const std::size_t index = static_cast<std::size_t>(position);
+    const osg::Quat low = unpack(index);
+    if (index + 1 >= mSamples.size())
+        return low;
+    osg::Quat result;
+    result.slerp(position - index, low, unpack(index + 1));
+    return result;
+}
+
+osg::Quat PackedQuaternionTrack::unpack(std::size_t index) const
+{
+    constexpr float scale = 1.f / sPackedTrackScale;
+    const auto& sample = mSamples[index];
+    return osg::Quat(sample[0] * scale, sample[1] * scale, sample[2] * scale, sample[3] * scale);
+}
+
 ControllerFunction::ControllerFunction(const Nif::Controller *ctrl)
     : mFrequency(ctrl->frequency)
     , mPhase(ctrl->phase)
@@ -78,6 +175,7 @@ KeyframeController::KeyframeController(const KeyframeController &copy, const osg
     , mZRotations(copy.mZRotations)
     , mTranslations(copy.mTranslations)
     , mScales(copy.mScales)
+    , mPackedRotations(copy.mPackedRotations)
 {
 }
 
@@ -89,6 +187,7 @@ KeyframeController::KeyframeController(const Nif::NiKeyframeData *data)
     , mTranslations(data->mTranslations, osg::Vec3f())
     , mScales(data->mScales, 1.f)
 {
+    packRotations(data->mRotations);
 }
 
 KeyframeController::KeyframeController(const Nif::NiTransformInterpolator* interpolator)
@@ -99,6 +198,17 @@ KeyframeController::KeyframeController(const Nif::NiTransformInterpolator* inter
     , mTranslations(interpolator->data->mTranslations, interpolator->defaultPos)
     , mScales(interpolator->data->mScales, interpolator->defaultScale)
 {
+    packRotations(interpolator->data->mRotations);
+}
+
+void KeyframeController::packRotations(const Nif::QuaternionKeyMapPtr& keys)
+{
+    if (!keys)
+        return;
+    mPackedRotations = PackedQuaternionTrack::create(*keys);
+    // the packed track replaces the raw keys; drop this controller's reference to them
+    if (mPackedRotations)
+        mRotations = QuaternionInterpolator();
 }
 
 KeyframeController::KeyframeController(const float scale, const osg::Vec3f& pos, const osg::Quat& rot)
@@ -145,7 +255,12 @@ void KeyframeController::operator() (osg::Node* node, osg::NodeVisitor* nv)
         Nif::Matrix3& rot = trans->mRotationScale;
 
         bool setRot = false;
-        if(!mRotations.empty())
+        if (mPackedRotations)
+        {
+            mat.setRotate(mPackedRotations->sample(time));
+            setRot = true;
+        }
+        else if(!mRotations.empty())
         {
             mat.setRotate(mRotations.interpKey(time));
             setRot = true;
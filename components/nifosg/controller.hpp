@@ -9,6 +9,9 @@
 #include <components/sceneutil/keyframe.hpp>
 #include <components/sceneutil/statesetupdater.hpp>
 
+#include <array>
+#include <cstdint>
+#include <memory>
 #include <set>
 #include <type_traits>
 
@@ -184,6 +187,28 @@ namespace NifOsg
     using Vec3Interpolator = ValueInterpolator<Nif::Vector3KeyMap>;
     using Vec4Interpolator = ValueInterpolator<Nif::Vector4KeyMap>;
 
+    /// A quaternion keyframe track resampled at load time into a uniform-rate, quantized form.
+    /// Timestamps are implicit in the sample index, each sample packs into 8 bytes instead of a
+    /// map node, and sampling is an index computation instead of a key search. Only tracks that
+    /// slerp linearly and reproduce their source keys within tolerance after resampling pack;
+    /// create() returns nullptr for the rest and the caller keeps the raw keys. The track is
+    /// immutable and shared by every copy of its controller.
+    class PackedQuaternionTrack
+    {
+    public:
+        /// @return the packed track, or nullptr if the keys can not be resampled within tolerance
+        static std::shared_ptr<const PackedQuaternionTrack> create(const Nif::QuaternionKeyMap& keys);
+
+        osg::Quat sample(float time) const;
+
+    private:
+        osg::Quat unpack(std::size_t index) const;
+
+        float mStartTime = 0.f;
+        float mSampleRate = 0.f; // samples per second
+        std::vector<std::array<std::int16_t, 4>> mSamples;
+    };
+
     class ControllerFunction : public SceneUtil::ControllerFunction
     {
     private:
@@ -253,6 +278,11 @@ namespace NifOsg
         Vec3Interpolator mTranslations;
         FloatInterpolator mScales;
 
+        // Replaces mRotations when the rotation keys resample cleanly; see PackedQuaternionTrack
+        std::shared_ptr<const PackedQuaternionTrack> mPackedRotations;
+
+        void packRotations(const Nif::QuaternionKeyMapPtr& keys);
+
         osg::Quat getXYZRotation(float time) const;
     };
 
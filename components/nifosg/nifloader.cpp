@@ -406,7 +406,7 @@ namespace NifOsg
             else
             {
                 std::string filename = Misc::ResourceHelpers::correctTexturePath(st->filename, imageManager->getVFS());
-                image = imageManager->getImage(filename);
+                image = imageManager->getImage(filename, /*allowStreaming*/true);
             }
             return image;
         }
@@ -1692,7 +1692,7 @@ namespace NifOsg
                     }
                 }
                 std::string filename = Misc::ResourceHelpers::correctTexturePath(textureSet->textures[i], imageManager->getVFS());
-                osg::ref_ptr<osg::Image> image = imageManager->getImage(filename);
+                osg::ref_ptr<osg::Image> image = imageManager->getImage(filename, /*allowStreaming*/true);
                 osg::ref_ptr<osg::Texture2D> texture2d = new osg::Texture2D(image);
                 if (image)
                     texture2d->setTextureSize(image->s(), image->t());
@@ -1859,7 +1859,7 @@ namespace NifOsg
                         boundTextures.clear();
                     }
                     std::string filename = Misc::ResourceHelpers::correctTexturePath(texprop->filename, imageManager->getVFS());
-                    osg::ref_ptr<osg::Image> image = imageManager->getImage(filename);
+                    osg::ref_ptr<osg::Image> image = imageManager->getImage(filename, /*allowStreaming*/true);
                     osg::ref_ptr<osg::Texture2D> texture2d = new osg::Texture2D(image);
                     texture2d->setName("diffuseMap");
                     if (image)
@@ -3,6 +3,8 @@
 #include <stdexcept>
 #include <string>
 
+#include <components/misc/hash.hpp>
+
 #include <BulletCollision/CollisionShapes/btBoxShape.h>
 #include <BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.h>
 #include <BulletCollision/CollisionShapes/btCompoundShape.h>
@@ -110,6 +112,29 @@ osg::ref_ptr<BulletShapeInstance> BulletShape::makeInstance() const
     return instance;
 }
 
+std::uint64_t hashTriangleMeshData(const btStridingMeshInterface& mesh, std::size_t& sizeInBytes)
+{
+    std::uint64_t hash = Misc::fnv1aBasis;
+    const auto addBytes = [&] (const unsigned char* data, std::size_t size)
+    {
+        sizeInBytes += size;
+        hash = Misc::fnv1aAppend(hash, data, size);
+    };
+    for (int part = 0; part < mesh.getNumSubParts(); ++part)
+    {
+        const unsigned char* vertexBase;
+        const unsigned char* indexBase;
+        int numVerts, numFaces, vertexStride, indexStride;
+        PHY_ScalarType vertexType, indexType;
+        mesh.getLockedReadOnlyVertexIndexBase(&vertexBase, numVerts, vertexType, vertexStride,
+                                              &indexBase, indexStride, numFaces, indexType, part);
+        addBytes(vertexBase, static_cast<std::size_t>(numVerts) * vertexStride);
+        addBytes(indexBase, static_cast<std::size_t>(numFaces) * indexStride);
+        mesh.unLockReadOnlyVertexBase(part);
+    }
+    return hash;
+}
+
 BulletShapeInstance::BulletShapeInstance(osg::ref_ptr<const BulletShape> source)
     : BulletShape()
     , mSource(source)
@@ -1,6 +1,8 @@
 #ifndef OPENMW_COMPONENTS_RESOURCE_BULLETSHAPE_H
 #define OPENMW_COMPONENTS_RESOURCE_BULLETSHAPE_H
 
+#include <cstddef>
+#include <cstdint>
 #include <map>
 
 #include <osg/Object>
@@ -8,6 +10,7 @@
 #include <osg/Vec3f>
 
 #include <BulletCollision/CollisionShapes/btBvhTriangleMeshShape.h>
+#include <LinearMath/btAlignedAllocator.h>
 
 class btCollisionShape;
 
@@ -79,13 +82,32 @@ namespace Resource
         {
         }
 
+        // Adopts a BVH that was deserialized in place from 'bvhBuffer' instead of building one.
+        // The buffer, which the BVH's internal arrays point into, is freed together with the shape.
+        TriangleMeshShape(btStridingMeshInterface* meshInterface, bool useQuantizedAabbCompression, btOptimizedBvh* bvh, void* bvhBuffer)
+            : btBvhTriangleMeshShape(meshInterface, useQuantizedAabbCompression, false)
+            , mBvhBuffer(bvhBuffer)
+        {
+            setOptimizedBvh(bvh);
+        }
+
         virtual ~TriangleMeshShape()
         {
             delete getTriangleInfoMap();
             delete m_meshInterface;
+            if (mBvhBuffer)
+                btAlignedFree(mBvhBuffer);
         }
+
+    private:
+        void* mBvhBuffer = nullptr;
     };
 
+    /// Hashes the vertex and index streams of a triangle mesh, so identical collision meshes
+    /// can be recognized independently of their file name. Also reports the total size of the
+    /// streams in \a sizeInBytes.
+    std::uint64_t hashTriangleMeshData(const btStridingMeshInterface& mesh, std::size_t& sizeInBytes);
+
 
 }
 
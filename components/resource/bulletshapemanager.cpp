@@ -1,5 +1,7 @@
 #include "bulletshapemanager.hpp"
 
+#include <cstring>
+
 #include <osg/NodeVisitor>
 #include <osg/TriangleFunctor>
 #include <osg/Transform>
@@ -15,6 +17,7 @@
 #include <components/nifbullet/bulletnifloader.hpp>
 
 #include "bulletshape.hpp"
+#include "bvhcache.hpp"
 #include "scenemanager.hpp"
 #include "niffilemanager.hpp"
 #include "objectcache.hpp"
@@ -106,6 +109,35 @@ private:
     std::unique_ptr<btTriangleMesh> mTriangleMesh;
 };
 
+// Full comparison of the mesh data, to rule out hash collisions before shapes are shared.
+bool equalTriangleMeshData(const btBvhTriangleMeshShape* left, const btBvhTriangleMeshShape* right)
+{
+    const btStridingMeshInterface* leftMesh = left->getMeshInterface();
+    const btStridingMeshInterface* rightMesh = right->getMeshInterface();
+    if (leftMesh->getNumSubParts() != rightMesh->getNumSubParts())
+        return false;
+    bool equal = true;
+    for (int part = 0; part < leftMesh->getNumSubParts() && equal; ++part)
+    {
+        const unsigned char *leftVertexBase, *leftIndexBase;
+        const unsigned char *rightVertexBase, *rightIndexBase;
+        int leftNumVerts, leftNumFaces, leftVertexStride, leftIndexStride;
+        int rightNumVerts, rightNumFaces, rightVertexStride, rightIndexStride;
+        PHY_ScalarType leftVertexType, leftIndexType, rightVertexType, rightIndexType;
+        leftMesh->getLockedReadOnlyVertexIndexBase(&leftVertexBase, leftNumVerts, leftVertexType, leftVertexStride,
+                                                   &leftIndexBase, leftIndexStride, leftNumFaces, leftIndexType, part);
+        rightMesh->getLockedReadOnlyVertexIndexBase(&rightVertexBase, rightNumVerts, rightVertexType, rightVertexStride,
+                                                    &rightIndexBase, rightIndexStride, rightNumFaces, rightIndexType, part);
+        equal = leftNumVerts == rightNumVerts && leftVertexStride == rightVertexStride && leftVertexType == rightVertexType
+             && leftNumFaces == rightNumFaces && leftIndexStride == rightIndexStride && leftIndexType == rightIndexType
+             && std::memcmp(leftVertexBase, rightVertexBase, static_cast<std::size_t>(leftNumVerts) * leftVertexStride) == 0
+             && std::memcmp(leftIndexBase, rightIndexBase, static_cast<std::size_t>(leftNumFaces) * leftIndexStride) == 0;
+        leftMesh->unLockReadOnlyVertexBase(part);
+        rightMesh->unLockReadOnlyVertexBase(part);
+    }
+    return equal;
+}
+
 BulletShapeManager::BulletShapeManager(const VFS::Manager* vfs, SceneManager* sceneMgr, NifFileManager* nifFileManager)
     : ResourceManager(vfs)
     , mInstanceCache(new MultiObjectCache)
@@ -120,6 +152,14 @@ BulletShapeManager::~BulletShapeManager()
 
 }
 
+void BulletShapeManager::setBvhCachePath(const std::string &path)
+{
+    if (!path.empty())
+        mBvhCache = std::make_unique<BvhCache>(path);
+    else
+        mBvhCache = nullptr;
+}
+
 osg::ref_ptr<const BulletShape> BulletShapeManager::getShape(const std::string &name)
 {
     const std::string normalized = mVFS->normalizeFilename(name);
@@ -132,7 +172,7 @@ osg::ref_ptr<const BulletShape> BulletShapeManager::getShape(const std::string &
     {
         if (Misc::getFileExtension(normalized) == "nif")
         {
-            NifBullet::BulletNifLoader loader;
+            NifBullet::BulletNifLoader loader(mBvhCache.get());
             shape = loader.load(*mNifFileManager->get(normalized));
         }
         else
@@ -168,11 +208,38 @@ osg::ref_ptr<const BulletShape> BulletShapeManager::getShape(const std::string &
             }
         }
 
+        shape = deduplicateShape(std::move(shape));
         mCache->addEntryToObjectCache(normalized, shape);
     }
     return shape;
 }
 
+osg::ref_ptr<BulletShape> BulletShapeManager::deduplicateShape(osg::ref_ptr<BulletShape> shape)
+{
+    // Only plain static triangle meshes are shared. Compound (animated) shapes and avoid
+    // shapes are comparatively rare, so hashing them is not worth the bother.
+    if (!shape || shape->mAvoidCollisionShape || !shape->mAnimatedShapes.empty())
+        return shape;
+    const btBvhTriangleMeshShape* triangleMeshShape = dynamic_cast<const btBvhTriangleMeshShape*>(shape->mCollisionShape);
+    if (!triangleMeshShape)
+        return shape;
+
+    std::size_t sizeInBytes = 0;
+    const std::uint64_t hash = hashTriangleMeshData(*triangleMeshShape->getMeshInterface(), sizeInBytes);
+
+    std::lock_guard<std::mutex> lock(mContentHashMutex);
+    osg::observer_ptr<BulletShape>& entry = mShapesByContentHash[hash];
+    osg::ref_ptr<BulletShape> existing;
+    if (entry.lock(existing) && existing
+        && equalTriangleMeshData(triangleMeshShape, static_cast<const btBvhTriangleMeshShape*>(existing->mCollisionShape)))
+    {
+        mDedupedBytes += sizeInBytes;
+        return existing;
+    }
+    entry = shape;
+    return shape;
+}
+
 osg::ref_ptr<BulletShapeInstance> BulletShapeManager::cacheInstance(const std::string &name)
 {
     const std::string normalized = mVFS->normalizeFilename(name);
@@ -208,6 +275,16 @@ void BulletShapeManager::updateCache(double referenceTime)
     ResourceManager::updateCache(referenceTime);
 
     mInstanceCache->removeUnreferencedObjectsInCache();
+
+    // Drop index entries whose shape was evicted from the cache.
+    std::lock_guard<std::mutex> lock(mContentHashMutex);
+    for (auto it = mShapesByContentHash.begin(); it != mShapesByContentHash.end();)
+    {
+        if (!it->second.valid())
+            it = mShapesByContentHash.erase(it);
+        else
+            ++it;
+    }
 }
 
 void BulletShapeManager::clearCache()
@@ -221,6 +298,9 @@ void BulletShapeManager::reportStats(unsigned int frameNumber, osg::Stats *stats
 {
     stats->setAttribute(frameNumber, "Shape", mCache->getCacheSize());
     stats->setAttribute(frameNumber, "Shape Instance", mInstanceCache->getCacheSize());
+
+    std::lock_guard<std::mutex> lock(mContentHashMutex);
+    stats->setAttribute(frameNumber, "Shape Dedup MB", mDedupedBytes / (1024.0 * 1024.0));
 }
 
 }
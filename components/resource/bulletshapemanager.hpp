@@ -1,9 +1,13 @@
 #ifndef OPENMW_COMPONENTS_BULLETSHAPEMANAGER_H
 #define OPENMW_COMPONENTS_BULLETSHAPEMANAGER_H
 
+#include <cstdint>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 
+#include <osg/observer_ptr>
 #include <osg/ref_ptr>
 
 #include "bulletshape.hpp"
@@ -16,6 +20,7 @@ namespace Resource
 
     class BulletShape;
     class BulletShapeInstance;
+    class BvhCache;
 
     class MultiObjectCache;
 
@@ -28,6 +33,10 @@ namespace Resource
         BulletShapeManager(const VFS::Manager* vfs, SceneManager* sceneMgr, NifFileManager* nifFileManager);
         ~BulletShapeManager();
 
+        /// Cache the optimized BVH of static triangle mesh shapes in this directory,
+        /// keyed by mesh content hash, so later sessions skip the BVH build.
+        void setBvhCachePath(const std::string& path);
+
         /// @note May return a null pointer if the object has no shape.
         osg::ref_ptr<const BulletShape> getShape(const std::string& name);
 
@@ -49,9 +58,20 @@ namespace Resource
     private:
         osg::ref_ptr<BulletShapeInstance> createInstance(const std::string& name);
 
+        /// If an identical static triangle mesh was already loaded under a different file name,
+        /// return the previously loaded shape so the mesh data is shared, otherwise return \a shape.
+        osg::ref_ptr<BulletShape> deduplicateShape(osg::ref_ptr<BulletShape> shape);
+
         osg::ref_ptr<MultiObjectCache> mInstanceCache;
         SceneManager* mSceneManager;
         NifFileManager* mNifFileManager;
+        std::unique_ptr<BvhCache> mBvhCache;
+
+        // Non-owning index of loaded shapes by a hash of their triangle mesh data, so identical
+        // collision meshes duplicated under different file names share one shape.
+        std::map<std::uint64_t, osg::observer_ptr<BulletShape> > mShapesByContentHash;
+        std::size_t mDedupedBytes = 0;
+        mutable std::mutex mContentHashMutex;
     };
 
 }
@@ -0,0 +1,128 @@
+#include "bvhcache.hpp"
+
+#include <cstdio>
+
+#include <boost/filesystem/fstream.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/path.hpp>
+
+#include <BulletCollision/CollisionShapes/btOptimizedBvh.h>
+#include <BulletCollision/CollisionShapes/btTriangleMesh.h>
+#include <LinearMath/btScalar.h>
+
+#include <components/debug/debuglog.hpp>
+
+#include "bulletshape.hpp"
+
+namespace
+{
+    constexpr std::uint32_t sBvhCacheMagic = 0x4d574248; // 'MWBH'
+
+    // The serialized BVH layout depends on the Bullet version and scalar precision,
+    // so entries written by an incompatible build are rebuilt instead of reused.
+    std::uint32_t layoutVersion()
+    {
+        return static_cast<std::uint32_t>(btGetVersion()) * 10 + sizeof(btScalar);
+    }
+
+    struct EntryHeader
+    {
+        std::uint32_t mMagic;
+        std::uint32_t mVersion;
+        std::uint32_t mBufferSize;
+    };
+}
+
+namespace Resource
+{
+
+BvhCache::BvhCache(const std::string& path)
+    : mPath(path)
+{
+    boost::system::error_code ignore;
+    boost::filesystem::create_directories(boost::filesystem::path(mPath), ignore);
+}
+
+std::string BvhCache::cacheFilePath(std::uint64_t hash, bool useQuantizedAabbCompression) const
+{
+    char name[2 * sizeof(std::uint64_t) + 1];
+    std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(hash));
+    return (boost::filesystem::path(mPath)
+            / (std::string(name) + (useQuantizedAabbCompression ? ".qbvh" : ".bvh"))).string();
+}
+
+TriangleMeshShape* BvhCache::makeShape(std::unique_ptr<btTriangleMesh> mesh, bool useQuantizedAabbCompression) const
+{
+    std::size_t sizeInBytes = 0;
+    const std::uint64_t hash = hashTriangleMeshData(*mesh, sizeInBytes);
+    const std::string filePath = cacheFilePath(hash, useQuantizedAabbCompression);
+
+    boost::filesystem::ifstream stream(boost::filesystem::path(filePath), std::ios::in | std::ios::binary);
+    if (stream.is_open())
+    {
+        EntryHeader header;
+        stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (stream && header.mMagic == sBvhCacheMagic && header.mVersion == layoutVersion() && header.mBufferSize > 0)
+        {
+            // The BVH is deserialized in place, so the buffer must stay alive for as long
+            // as the shape and is adopted by it.
+            void* buffer = btAlignedAlloc(header.mBufferSize, 16);
+            stream.read(static_cast<char*>(buffer), header.mBufferSize);
+            btOptimizedBvh* bvh = stream ? btOptimizedBvh::deSerializeInPlace(buffer, header.mBufferSize, false) : nullptr;
+            if (bvh)
+            {
+                TriangleMeshShape* shape = new TriangleMeshShape(mesh.get(), useQuantizedAabbCompression, bvh, buffer);
+                mesh.release();
+                return shape;
+            }
+            btAlignedFree(buffer);
+        }
+        Log(Debug::Warning) << "Ignoring invalid BVH cache entry " << filePath;
+    }
+
+    TriangleMeshShape* shape = new TriangleMeshShape(mesh.get(), useQuantizedAabbCompression);
+    mesh.release();
+    if (const btOptimizedBvh* bvh = shape->getOptimizedBvh())
+        writeBvh(filePath, *bvh);
+    return shape;
+}
+
+void BvhCache::writeBvh(const std::string& filePath, const btOptimizedBvh& bvh) const
+{
+    const unsigned int bufferSize = bvh.calculateSerializeBufferSize();
+    void* buffer = btAlignedAlloc(bufferSize, 16);
+    if (!bvh.serialize(buffer, bufferSize, false))
+    {
+        btAlignedFree(buffer);
+        return;
+    }
+
+    // Write to a private temporary file and rename, so concurrent loads of identical
+    // meshes and crashed sessions never leave a half-written entry.
+    try
+    {
+        const boost::filesystem::path temporaryPath = boost::filesystem::unique_path(filePath + ".%%%%%%%%.tmp");
+        bool success;
+        {
+            boost::filesystem::ofstream stream(temporaryPath, std::ios::out | std::ios::binary);
+            const EntryHeader header { sBvhCacheMagic, layoutVersion(), bufferSize };
+            stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            stream.write(static_cast<const char*>(buffer), bufferSize);
+            success = static_cast<bool>(stream);
+        }
+        if (success)
+            boost::filesystem::rename(temporaryPath, boost::filesystem::path(filePath));
+        else
+        {
+            boost::system::error_code ignore;
+            boost::filesystem::remove(temporaryPath, ignore);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        Log(Debug::Warning) << "Failed to write BVH cache entry " << filePath << ": " << e.what();
+    }
+    btAlignedFree(buffer);
+}
+
+}
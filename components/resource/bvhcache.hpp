@@ -0,0 +1,40 @@
+#ifndef OPENMW_COMPONENTS_RESOURCE_BVHCACHE_H
+#define OPENMW_COMPONENTS_RESOURCE_BVHCACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+class btOptimizedBvh;
+class btTriangleMesh;
+
+namespace Resource
+{
+    struct TriangleMeshShape;
+
+    /// \brief Disk cache for the optimized BVH of static triangle mesh collision shapes.
+    ///
+    /// Building the BVH dominates the load time of large collision meshes, yet the result
+    /// depends only on the triangle data. Entries are therefore keyed by a content hash of
+    /// the vertex and index streams, so a cached BVH survives file renames and is shared
+    /// between identical meshes. Unreadable or stale entries are ignored and rebuilt.
+    class BvhCache
+    {
+    public:
+        explicit BvhCache(const std::string& path);
+
+        /// Create a shape for the given mesh, deserializing the optimized BVH from the
+        /// cache when a matching entry exists and storing newly built BVHs.
+        /// Takes ownership of the mesh.
+        TriangleMeshShape* makeShape(std::unique_ptr<btTriangleMesh> mesh, bool useQuantizedAabbCompression) const;
+
+    private:
+        std::string mPath;
+
+        std::string cacheFilePath(std::uint64_t hash, bool useQuantizedAabbCompression) const;
+
+        void writeBvh(const std::string& filePath, const btOptimizedBvh& bvh) const;
+    };
+}
+
+#endif
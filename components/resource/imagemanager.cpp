@@ -1,10 +1,23 @@
 #include "imagemanager.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include <osgDB/ImageProcessor>
 #include <osgDB/Registry>
 
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
 #include <components/debug/debuglog.hpp>
+#include <components/files/memorystream.hpp>
+#include <components/misc/hash.hpp>
 #include <components/misc/pathhelpers.hpp>
+#include <components/sceneutil/workqueue.hpp>
 #include <components/vfs/manager.hpp>
 
 #include "objectcache.hpp"
@@ -40,6 +53,101 @@ namespace
         return warningImage;
     }
 
+    std::string makeTranscodeCacheFilePath(const std::string& directory, std::uint64_t sourceHash)
+    {
+        char name[2 * sizeof(std::uint64_t) + 1];
+        std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(sourceHash));
+        return (boost::filesystem::path(directory) / (std::string(name) + ".dds")).string();
+    }
+
+    bool isCompressedFormat(GLenum pixelFormat)
+    {
+        switch (pixelFormat)
+        {
+            case(GL_COMPRESSED_RGB_S3TC_DXT1_EXT):
+            case(GL_COMPRESSED_RGBA_S3TC_DXT1_EXT):
+            case(GL_COMPRESSED_RGBA_S3TC_DXT3_EXT):
+            case(GL_COMPRESSED_RGBA_S3TC_DXT5_EXT):
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    const std::size_t sDDSHeaderSize = 128; // magic number plus the DDS_HEADER struct
+
+    std::uint32_t readUInt32(const unsigned char* data)
+    {
+        return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<std::uint32_t>(data[3]) << 24);
+    }
+
+    void writeUInt32(unsigned char* data, std::uint32_t value)
+    {
+        data[0] = value & 0xff;
+        data[1] = (value >> 8) & 0xff;
+        data[2] = (value >> 16) & 0xff;
+        data[3] = (value >> 24) & 0xff;
+    }
+
+    /// Mipmap layout of a block compressed .dds file, where level n+1 immediately follows level n.
+    struct DDSLayout
+    {
+        int mWidth;
+        int mHeight;
+        int mMipmapCount;
+        std::size_t mBlockSize;
+
+        std::size_t getLevelSize(int level) const
+        {
+            const int width = std::max(mWidth >> level, 1);
+            const int height = std::max(mHeight >> level, 1);
+            return static_cast<std::size_t>((width + 3) / 4) * ((height + 3) / 4) * mBlockSize;
+        }
+
+        /// Byte offset of the given level, relative to the end of the header.
+        std::size_t getLevelOffset(int level) const
+        {
+            std::size_t offset = 0;
+            for (int i = 0; i < level; ++i)
+                offset += getLevelSize(i);
+            return offset;
+        }
+    };
+
+    /// Parse the header of a mipmapped, DXT compressed 2d .dds file. Anything else
+    /// (uncompressed or DX10 formats, cubemaps, volumes, exotic pitches) is rejected.
+    bool getStreamableDDSLayout(const unsigned char* header, DDSLayout& layout)
+    {
+        if (std::memcmp(header, "DDS ", 4) != 0 || readUInt32(header + 4) != 124)
+            return false;
+        const std::uint32_t flags = readUInt32(header + 8);
+        // DDSD_PITCH and DDSD_DEPTH imply a data layout we don't handle
+        if (flags & (0x8 | 0x800000))
+            return false;
+        layout.mHeight = static_cast<int>(readUInt32(header + 12));
+        layout.mWidth = static_cast<int>(readUInt32(header + 16));
+        layout.mMipmapCount = (flags & 0x20000 /*DDSD_MIPMAPCOUNT*/) ? static_cast<int>(readUInt32(header + 28)) : 1;
+        if (layout.mWidth <= 0 || layout.mHeight <= 0 || layout.mMipmapCount <= 1 || layout.mMipmapCount > 16)
+            return false;
+        // the pixel format must be one of the DXT FourCC codes
+        if (readUInt32(header + 76) != 32 || !(readUInt32(header + 80) & 0x4 /*DDPF_FOURCC*/))
+            return false;
+        const std::uint32_t fourCC = readUInt32(header + 84);
+        if (fourCC == 0x31545844) // 'DXT1'
+            layout.mBlockSize = 8;
+        else if (fourCC == 0x33545844 || fourCC == 0x35545844) // 'DXT3' / 'DXT5'
+            layout.mBlockSize = 16;
+        else
+            return false;
+        // no cubemaps or volume textures
+        if (readUInt32(header + 112) & (0x200 | 0x200000))
+            return false;
+        // DDSD_LINEARSIZE, when given, must agree with the tight packing we assume
+        if ((flags & 0x80000) && readUInt32(header + 20) != layout.getLevelSize(0))
+            return false;
+        return true;
+    }
+
 }
 
 namespace Resource
@@ -54,7 +162,6 @@ namespace Resource
 
     ImageManager::~ImageManager()
     {
-
     }
 
     bool checkSupported(osg::Image* image, const std::string& filename)
@@ -82,7 +189,67 @@ namespace Resource
         return true;
     }
 
-    osg::ref_ptr<osg::Image> ImageManager::getImage(const std::string &filename)
+    /// Completed background loads, shared between the work items and the ImageManager so
+    /// items finishing after a shutdown have somewhere safe to write to.
+    struct StreamingResults
+    {
+        std::mutex mMutex;
+        // pairs of (image handed out by getImage, fully loaded replacement)
+        std::vector<std::pair<osg::ref_ptr<osg::Image>, osg::ref_ptr<osg::Image>>> mFinished;
+    };
+
+    /// Loads the full version of an image that getImage() returned with only its smallest
+    /// mipmap levels. The result is applied to the original image by ImageManager::applyStreamedImages.
+    class StreamImageWorkItem : public SceneUtil::WorkItem
+    {
+    public:
+        StreamImageWorkItem(const VFS::Manager* vfs, const std::string& filename, osg::ref_ptr<osg::Image> target,
+                osg::ref_ptr<osgDB::Options> options, std::shared_ptr<StreamingResults> results)
+            : mVFS(vfs)
+            , mFilename(filename)
+            , mTarget(target)
+            , mOptions(options)
+            , mResults(results)
+        {
+        }
+
+        void doWork() override
+        {
+            osgDB::ReaderWriter* reader = osgDB::Registry::instance()->getReaderWriterForExtension("dds");
+            if (!reader)
+                return;
+
+            osgDB::ReaderWriter::ReadResult result;
+            try
+            {
+                Files::IStreamPtr stream = mVFS->get(mFilename);
+                result = reader->readImage(*stream, mOptions);
+            }
+            catch (std::exception& e)
+            {
+                // the scene keeps rendering with the low resolution levels
+                Log(Debug::Warning) << "Failed to stream " << mFilename << ": " << e.what();
+                return;
+            }
+            if (!result.success())
+            {
+                Log(Debug::Warning) << "Failed to stream " << mFilename << ": " << result.message();
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(mResults->mMutex);
+            mResults->mFinished.emplace_back(mTarget, result.getImage());
+        }
+
+    private:
+        const VFS::Manager* mVFS;
+        std::string mFilename;
+        osg::ref_ptr<osg::Image> mTarget;
+        osg::ref_ptr<osgDB::Options> mOptions;
+        std::shared_ptr<StreamingResults> mResults;
+    };
+
+    osg::ref_ptr<osg::Image> ImageManager::getImage(const std::string &filename, bool allowStreaming)
     {
         const std::string normalized = mVFS->normalizeFilename(filename);
 
@@ -112,6 +279,52 @@ namespace Resource
                 return mWarningImage;
             }
 
+            // Mipmap streaming only pays off for loads the frame loop is waiting on;
+            // background preloads can afford to read the full file in one go.
+            if (allowStreaming && mWorkQueue && ext == "dds" && std::this_thread::get_id() == mMainThread)
+            {
+                std::size_t fullSize = 0;
+                osg::ref_ptr<osg::Image> lowRes = readSmallestMipmaps(*reader, *stream, fullSize);
+                if (lowRes && checkSupported(lowRes, filename))
+                {
+                    lowRes->setFileName(normalized);
+                    // osg::Texture may discard the data of STATIC images after uploading them,
+                    // but this image is still going to receive its remaining mipmap levels
+                    lowRes->setDataVariance(osg::Object::DYNAMIC);
+                    // Assign a PixelBufferObject for asynchronous transfer of data to the GPU;
+                    // the full resolution levels get uploaded in the middle of gameplay.
+                    lowRes->setPixelBufferObject(new osg::PixelBufferObject(lowRes));
+                    // budget for the full image, its data is already on the way
+                    mCache->addEntryToObjectCache(normalized, lowRes, 0.0, fullSize);
+                    mWorkQueue->addWorkItem(new StreamImageWorkItem(mVFS, normalized, lowRes, mOptions, mStreamingResults));
+                    return lowRes;
+                }
+                stream->clear();
+                stream->seekg(0);
+            }
+
+            std::uint64_t sourceHash = 0;
+            std::vector<char> sourceBuffer;
+            const bool transcode = !mTranscodeCachePath.empty() && ext != "dds";
+            if (transcode)
+            {
+                // The cache key is the content hash, so changed or replaced source files miss cleanly.
+                char chunk[4096];
+                while (stream->read(chunk, sizeof(chunk)) || stream->gcount() > 0)
+                    sourceBuffer.insert(sourceBuffer.end(), chunk, chunk + stream->gcount());
+                sourceHash = Misc::fnv1a(sourceBuffer.data(), sourceBuffer.size());
+
+                osg::ref_ptr<osg::Image> cached = readTranscodeCache(sourceHash, filename);
+                if (cached)
+                {
+                    cached->setFileName(normalized);
+                    mCache->addEntryToObjectCache(normalized, cached, 0.0, cached->getTotalSizeInBytesIncludingMipmaps());
+                    return cached;
+                }
+
+                stream = std::make_shared<Files::IMemStream>(sourceBuffer.data(), sourceBuffer.size());
+            }
+
             bool killAlpha = false;
             if (reader->supportedExtensions().count("tga"))
             {
@@ -182,11 +395,231 @@ namespace Resource
                 image = newImage;
             }
 
-            mCache->addEntryToObjectCache(normalized, image);
+            if (transcode)
+            {
+                osg::ref_ptr<osg::Image> compressed = writeTranscodeCache(sourceHash, *image);
+                if (compressed)
+                {
+                    compressed->setFileName(normalized);
+                    image = compressed;
+                }
+            }
+
+            mCache->addEntryToObjectCache(normalized, image, 0.0, image->getTotalSizeInBytesIncludingMipmaps());
             return image;
         }
     }
 
+    osg::ref_ptr<osg::Image> ImageManager::readTranscodeCache(std::uint64_t sourceHash, const std::string& filename)
+    {
+        boost::filesystem::ifstream stream(
+            boost::filesystem::path(makeTranscodeCacheFilePath(mTranscodeCachePath, sourceHash)),
+            std::ios::in | std::ios::binary);
+        if (!stream.is_open())
+            return nullptr;
+
+        osgDB::ReaderWriter* reader = osgDB::Registry::instance()->getReaderWriterForExtension("dds");
+        if (!reader)
+            return nullptr;
+
+        osgDB::ReaderWriter::ReadResult result = reader->readImage(stream, mOptions);
+        if (!result.success())
+        {
+            Log(Debug::Warning) << "Ignoring invalid transcode cache entry for " << filename;
+            return nullptr;
+        }
+
+        osg::ref_ptr<osg::Image> image = result.getImage();
+        // A compressed entry the GPU can't sample falls through to the normal load path.
+        if (!isCompressedFormat(image->getPixelFormat()) || !checkSupported(image, filename))
+            return nullptr;
+        return image;
+    }
+
+    osg::ref_ptr<osg::Image> ImageManager::writeTranscodeCache(std::uint64_t sourceHash, const osg::Image& image)
+    {
+        // Only plain 8 bit per channel 2d images are worth transcoding, and block
+        // compression needs the top level dimensions to be multiples of the block size.
+        if ((image.getPixelFormat() != GL_RGB && image.getPixelFormat() != GL_RGBA)
+                || image.getDataType() != GL_UNSIGNED_BYTE || image.r() != 1
+                || image.s() < 4 || image.s() % 4 != 0 || image.t() < 4 || image.t() % 4 != 0)
+            return nullptr;
+
+        osgDB::ImageProcessor* processor = osgDB::Registry::instance()->getImageProcessor();
+        if (!processor)
+        {
+            static bool warned = false;
+            if (!warned)
+            {
+                Log(Debug::Warning) << "Texture transcode cache is enabled, but no osgDB image processor "
+                                       "(e.g. the NVTT plugin) is installed";
+                warned = true;
+            }
+            return nullptr;
+        }
+
+        osg::ref_ptr<osg::Image> compressed = new osg::Image(image, osg::CopyOp::DEEP_COPY_ALL);
+        processor->compress(*compressed,
+            image.getPixelFormat() == GL_RGBA ? osg::Texture::USE_S3TC_DXT5_COMPRESSION : osg::Texture::USE_S3TC_DXT1_COMPRESSION,
+            /*generateMipMap*/ true, /*resizeToPowerOfTwo*/ false,
+            osgDB::ImageProcessor::USE_CPU, osgDB::ImageProcessor::PRODUCTION);
+        if (!isCompressedFormat(compressed->getPixelFormat()))
+            return nullptr;
+
+        osgDB::ReaderWriter* writer = osgDB::Registry::instance()->getReaderWriterForExtension("dds");
+        if (!writer)
+            return compressed;
+
+        // Write to a private temporary file and rename, so concurrent loader threads
+        // and crashed sessions never leave a half-written entry.
+        const std::string filePath = makeTranscodeCacheFilePath(mTranscodeCachePath, sourceHash);
+        try
+        {
+            const boost::filesystem::path temporaryPath = boost::filesystem::unique_path(filePath + ".%%%%%%%%.tmp");
+            {
+                boost::filesystem::ofstream stream(temporaryPath, std::ios::out | std::ios::binary);
+                if (!stream.is_open() || !writer->writeImage(*compressed, stream, mOptions).success() || !stream)
+                {
+                    stream.close();
+                    boost::system::error_code ignore;
+                    boost::filesystem::remove(temporaryPath, ignore);
+                    return compressed;
+                }
+            }
+            boost::filesystem::rename(temporaryPath, boost::filesystem::path(filePath));
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to store transcoded texture: " << e.what();
+        }
+
+        return compressed;
+    }
+
+    osg::ref_ptr<osg::Image> ImageManager::readSmallestMipmaps(osgDB::ReaderWriter& reader, std::istream& stream,
+        std::size_t& fullSize)
+    {
+        unsigned char header[sDDSHeaderSize];
+        stream.read(reinterpret_cast<char*>(header), sDDSHeaderSize);
+        if (stream.gcount() != static_cast<std::streamsize>(sDDSHeaderSize))
+            return nullptr;
+
+        DDSLayout layout;
+        if (!getStreamableDDSLayout(header, layout))
+            return nullptr;
+        // files below this size load fast enough to not be worth two passes
+        if (layout.mWidth <= 256 && layout.mHeight <= 256)
+            return nullptr;
+
+        // Load the levels of 64 pixels or less up front: a few kilobytes at most, and enough
+        // for the texture to be recognizable until the real thing arrives.
+        int firstLevel = 0;
+        while (std::max(layout.mWidth >> firstLevel, layout.mHeight >> firstLevel) > 64
+                && firstLevel + 1 < layout.mMipmapCount)
+            ++firstLevel;
+        if (firstLevel == 0)
+            return nullptr;
+
+        const std::size_t tailOffset = layout.getLevelOffset(firstLevel);
+        const std::size_t tailSize = layout.getLevelOffset(layout.mMipmapCount) - tailOffset;
+        fullSize = tailOffset + tailSize;
+
+        // Synthesize a .dds file holding only the tail of the mipmap chain and run it through
+        // the regular reader, so flipping and format selection behave exactly like a full load.
+        std::vector<char> buffer(sDDSHeaderSize + tailSize);
+        std::memcpy(buffer.data(), header, sDDSHeaderSize);
+        stream.seekg(sDDSHeaderSize + tailOffset);
+        stream.read(buffer.data() + sDDSHeaderSize, tailSize);
+        if (stream.gcount() != static_cast<std::streamsize>(tailSize))
+            return nullptr; // truncated file, let the normal load path deal with it
+
+        unsigned char* patched = reinterpret_cast<unsigned char*>(buffer.data());
+        writeUInt32(patched + 12, static_cast<std::uint32_t>(std::max(layout.mHeight >> firstLevel, 1)));
+        writeUInt32(patched + 16, static_cast<std::uint32_t>(std::max(layout.mWidth >> firstLevel, 1)));
+        writeUInt32(patched + 20, static_cast<std::uint32_t>(layout.getLevelSize(firstLevel)));
+        writeUInt32(patched + 28, static_cast<std::uint32_t>(layout.mMipmapCount - firstLevel));
+
+        Files::IMemStream memStream(buffer.data(), buffer.size());
+        osgDB::ReaderWriter::ReadResult result = reader.readImage(memStream, mOptions);
+        if (!result.success())
+            return nullptr;
+        return result.getImage();
+    }
+
+    void ImageManager::setImageStreaming(SceneUtil::WorkQueue* workQueue)
+    {
+        mWorkQueue = workQueue;
+        mMainThread = std::this_thread::get_id();
+        if (workQueue && !mStreamingResults)
+            mStreamingResults = std::make_shared<StreamingResults>();
+    }
+
+    void ImageManager::applyStreamedImages()
+    {
+        // Runs between the draws of the context that renders the scene (see the
+        // graphics operation registered next to setImageStreaming): the swap below
+        // mutates images whose fields and data the draw traversal reads while
+        // uploading, so it must never overlap with a draw.
+        if (!mStreamingResults)
+            return;
+
+        ++mApplyRuns;
+
+        // Data applied in one run is uploaded by the following draws, so two runs
+        // later the staging buffer can be dropped. A texture that was culled away
+        // since then uploads without the PBO once it comes back into view, which
+        // merely loses the asynchronous transfer.
+        while (!mStagedImages.empty() && mStagedImages.front().first + 2 <= mApplyRuns)
+        {
+            mStagedImages.front().second->setPixelBufferObject(nullptr);
+            mStagedImages.pop_front();
+        }
+
+        std::vector<std::pair<osg::ref_ptr<osg::Image>, osg::ref_ptr<osg::Image>>> finished;
+        {
+            std::lock_guard<std::mutex> lock(mStreamingResults->mMutex);
+            // Each applied image makes the next draw upload a full mipmap chain, so spread
+            // arrivals over several frames rather than reintroducing one big hitch.
+            const std::size_t maxPerFrame = 2;
+            if (mStreamingResults->mFinished.size() <= maxPerFrame)
+                finished.swap(mStreamingResults->mFinished);
+            else
+            {
+                finished.assign(mStreamingResults->mFinished.begin(), mStreamingResults->mFinished.begin() + maxPerFrame);
+                mStreamingResults->mFinished.erase(mStreamingResults->mFinished.begin(), mStreamingResults->mFinished.begin() + maxPerFrame);
+            }
+        }
+
+        for (const auto& targetLoadedPair : finished)
+        {
+            osg::Image* target = targetLoadedPair.first.get();
+            osg::Image* loaded = targetLoadedPair.second.get();
+
+            // Hand the loaded buffer over to the image that the scene's textures
+            // reference. setImage frees the old buffer in place; the draw that may
+            // have been uploading it has already finished on this thread.
+            const osg::Image::AllocationMode bufferOwnership = loaded->getAllocationMode();
+            loaded->setAllocationMode(osg::Image::NO_DELETE);
+            target->setImage(loaded->s(), loaded->t(), loaded->r(), loaded->getInternalTextureFormat(),
+                loaded->getPixelFormat(), loaded->getDataType(), loaded->data(),
+                bufferOwnership, loaded->getPacking());
+            target->setMipmapLevels(loaded->getMipmapLevels());
+            target->dirty();
+            target->setDataVariance(osg::Object::STATIC);
+            mStagedImages.emplace_back(mApplyRuns, targetLoadedPair.first);
+        }
+    }
+
+    void ImageManager::setTranscodeCachePath(const std::string& path)
+    {
+        mTranscodeCachePath = path;
+        if (!mTranscodeCachePath.empty())
+        {
+            boost::system::error_code ignore;
+            boost::filesystem::create_directories(boost::filesystem::path(mTranscodeCachePath), ignore);
+        }
+    }
+
     osg::Image *ImageManager::getWarningImage()
     {
         return mWarningImage;
@@ -195,6 +628,7 @@ namespace Resource
     void ImageManager::reportStats(unsigned int frameNumber, osg::Stats *stats) const
     {
         stats->setAttribute(frameNumber, "Image", mCache->getCacheSize());
+        stats->setAttribute(frameNumber, "Image MB", mCache->getCacheSizeBytes() / (1024.0 * 1024.0));
     }
 
 }
@@ -1,8 +1,14 @@
 #ifndef OPENMW_COMPONENTS_RESOURCE_IMAGEMANAGER_H
 #define OPENMW_COMPONENTS_RESOURCE_IMAGEMANAGER_H
 
+#include <cstdint>
+#include <deque>
+#include <iosfwd>
+#include <memory>
 #include <string>
+#include <thread>
 #include <map>
+#include <utility>
 
 #include <osg/ref_ptr>
 #include <osg/Image>
@@ -13,11 +19,19 @@
 namespace osgDB
 {
     class Options;
+    class ReaderWriter;
+}
+
+namespace SceneUtil
+{
+    class WorkQueue;
 }
 
 namespace Resource
 {
 
+    struct StreamingResults;
+
     /// @brief Handles loading/caching of Images.
     /// @note May be used from any thread.
     class ImageManager : public ResourceManager
@@ -28,15 +42,55 @@ namespace Resource
 
         /// Create or retrieve an Image
         /// Returns the dummy image if the given image is not found.
-        osg::ref_ptr<osg::Image> getImage(const std::string& filename);
+        /// @param allowStreaming Allow returning an image that holds only the smallest mipmap
+        ///        levels for now, with the remaining levels streamed in afterwards
+        ///        (@see setImageStreaming). Only pass true when the caller does not depend on
+        ///        the image's dimensions or contents.
+        osg::ref_ptr<osg::Image> getImage(const std::string& filename, bool allowStreaming = false);
 
         osg::Image* getWarningImage();
 
+        /// Transcode non-DDS images to a compressed GPU format once and keep the result
+        /// in the given directory (created if missing), keyed by the source file hash.
+        /// An empty path (the default) disables the cache.
+        void setTranscodeCachePath(const std::string& path);
+
+        /// Stream large mipmapped DDS images requested with getImage(..., true): only the
+        /// smallest mipmap levels are read up front, and the full image is loaded through the
+        /// given work queue, replacing the cached image's data once it arrives. Streaming only
+        /// applies to loads made on the calling thread. A null work queue disables streaming.
+        void setImageStreaming(SceneUtil::WorkQueue* workQueue);
+
+        /// Apply finished streaming loads (@see setImageStreaming). Must run on the draw
+        /// thread of the context that renders the scene, between its draw traversals,
+        /// since it mutates images that the draw traversal uploads.
+        void applyStreamedImages();
+
         void reportStats(unsigned int frameNumber, osg::Stats* stats) const override;
 
     private:
         osg::ref_ptr<osg::Image> mWarningImage;
         osg::ref_ptr<osgDB::Options> mOptions;
+        std::string mTranscodeCachePath;
+
+        osg::ref_ptr<SceneUtil::WorkQueue> mWorkQueue;
+        std::thread::id mMainThread;
+        std::shared_ptr<StreamingResults> mStreamingResults;
+        // Streamed images whose full data was applied, keyed by the applying run of
+        // applyStreamedImages; their pixel buffer objects are released once the data
+        // is certainly uploaded, freeing the staging memory. Only touched from the
+        // draw thread that runs applyStreamedImages.
+        std::deque<std::pair<unsigned int, osg::ref_ptr<osg::Image>>> mStagedImages;
+        unsigned int mApplyRuns = 0;
+
+        osg::ref_ptr<osg::Image> readTranscodeCache(std::uint64_t sourceHash, const std::string& filename);
+        osg::ref_ptr<osg::Image> writeTranscodeCache(std::uint64_t sourceHash, const osg::Image& image);
+
+        /// Read only the smallest mipmap levels from a block compressed .dds stream.
+        /// @return null if the file is not worth streaming or has a layout we don't handle,
+        ///         with the full image's size in bytes returned in fullSize otherwise.
+        osg::ref_ptr<osg::Image> readSmallestMipmaps(osgDB::ReaderWriter& reader, std::istream& stream,
+            std::size_t& fullSize);
 
         ImageManager(const ImageManager&);
         void operator = (const ImageManager&);
@@ -3,6 +3,8 @@
 // - removeExpiredObjectsInCache no longer keeps a lock while the unref happens.
 // - template allows customized KeyType.
 // - objects with uninitialized time stamp are not removed.
+// - entries may carry a size estimate; when a size budget is set, the least recently
+//   used unreferenced entries are evicted once the total estimate exceeds it.
 
 /* -*-c++-*- OpenSceneGraph - Copyright (C) 1998-2006 Robert Osfield
  *
@@ -24,9 +26,12 @@
 #include <osg/ref_ptr>
 #include <osg/Node>
 
+#include <algorithm>
+#include <cstddef>
 #include <string>
 #include <map>
 #include <mutex>
+#include <vector>
 
 namespace osg
 {
@@ -59,8 +64,8 @@ class GenericObjectCache : public osg::Referenced
             {
                 // If ref count is greater than 1, the object has an external reference.
                 // If the timestamp is yet to be initialized, it needs to be updated too.
-                if (itr->second.first->referenceCount()>1 || itr->second.second == 0.0)
-                    itr->second.second = referenceTime;
+                if (itr->second.mObject->referenceCount()>1 || itr->second.mTimeStamp == 0.0)
+                    itr->second.mTimeStamp = referenceTime;
             }
         }
 
@@ -77,14 +82,38 @@ class GenericObjectCache : public osg::Referenced
                 typename ObjectCacheMap::iterator oitr = _objectCache.begin();
                 while(oitr != _objectCache.end())
                 {
-                    if (oitr->second.second<=expiryTime)
+                    if (oitr->second.mTimeStamp<=expiryTime)
                     {
-                        objectsToRemove.push_back(oitr->second.first);
+                        objectsToRemove.push_back(oitr->second.mObject);
+                        _sizeInBytes -= oitr->second.mSizeInBytes;
                         _objectCache.erase(oitr++);
                     }
                     else
                         ++oitr;
                 }
+
+                // The expiry delay did not bring the cache under its size budget, so
+                // additionally evict unreferenced entries, least recently used first.
+                if (_sizeBudget > 0 && _sizeInBytes > _sizeBudget)
+                {
+                    std::vector<typename ObjectCacheMap::iterator> candidates;
+                    for (typename ObjectCacheMap::iterator itr = _objectCache.begin(); itr != _objectCache.end(); ++itr)
+                    {
+                        if (itr->second.mObject->referenceCount() <= 1 && itr->second.mTimeStamp != 0.0)
+                            candidates.push_back(itr);
+                    }
+                    std::sort(candidates.begin(), candidates.end(),
+                        [] (const typename ObjectCacheMap::iterator& left, const typename ObjectCacheMap::iterator& right)
+                        { return left->second.mTimeStamp < right->second.mTimeStamp; });
+                    for (typename ObjectCacheMap::iterator itr : candidates)
+                    {
+                        if (_sizeInBytes <= _sizeBudget)
+                            break;
+                        objectsToRemove.push_back(itr->second.mObject);
+                        _sizeInBytes -= itr->second.mSizeInBytes;
+                        _objectCache.erase(itr);
+                    }
+                }
             }
             // note, actual unref happens outside of the lock
             objectsToRemove.clear();
@@ -95,13 +124,20 @@ class GenericObjectCache : public osg::Referenced
         {
             std::lock_guard<std::mutex> lock(_objectCacheMutex);
             _objectCache.clear();
+            _sizeInBytes = 0;
         }
 
-        /** Add a key,object,timestamp triple to the Registry::ObjectCache.*/
-        void addEntryToObjectCache(const KeyType& key, osg::Object* object, double timestamp = 0.0)
+        /** Add a key,object,timestamp triple to the Registry::ObjectCache.
+          * The optional size estimate (in bytes) is counted towards the size budget. */
+        void addEntryToObjectCache(const KeyType& key, osg::Object* object, double timestamp = 0.0, std::size_t sizeInBytes = 0)
         {
             std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            _objectCache[key]=ObjectTimeStampPair(object,timestamp);
+            Item& item = _objectCache[key];
+            _sizeInBytes -= item.mSizeInBytes;
+            _sizeInBytes += sizeInBytes;
+            item.mObject = object;
+            item.mTimeStamp = timestamp;
+            item.mSizeInBytes = sizeInBytes;
         }
 
         /** Remove Object from cache.*/
@@ -109,7 +145,11 @@ class GenericObjectCache : public osg::Referenced
         {
             std::lock_guard<std::mutex> lock(_objectCacheMutex);
             typename ObjectCacheMap::iterator itr = _objectCache.find(key);
-            if (itr!=_objectCache.end()) _objectCache.erase(itr);
+            if (itr!=_objectCache.end())
+            {
+                _sizeInBytes -= itr->second.mSizeInBytes;
+                _objectCache.erase(itr);
+            }
         }
 
         /** Get an ref_ptr<Object> from the object cache*/
@@ -118,7 +158,7 @@ class GenericObjectCache : public osg::Referenced
             std::lock_guard<std::mutex> lock(_objectCacheMutex);
             typename ObjectCacheMap::iterator itr = _objectCache.find(key);
             if (itr!=_objectCache.end())
-                return itr->second.first;
+                return itr->second.mObject;
             else return nullptr;
         }
 
@@ -129,7 +169,7 @@ class GenericObjectCache : public osg::Referenced
             typename ObjectCacheMap::iterator itr = _objectCache.find(key);
             if (itr!=_objectCache.end())
             {
-                itr->second.second = timeStamp;
+                itr->second.mTimeStamp = timeStamp;
                 return true;
             }
             else return false;
@@ -141,7 +181,7 @@ class GenericObjectCache : public osg::Referenced
             std::lock_guard<std::mutex> lock(_objectCacheMutex);
             for(typename ObjectCacheMap::iterator itr = _objectCache.begin(); itr != _objectCache.end(); ++itr)
             {
-                osg::Object* object = itr->second.first.get();
+                osg::Object* object = itr->second.mObject.get();
                 object->releaseGLObjects(state);
             }
         }
@@ -152,7 +192,7 @@ class GenericObjectCache : public osg::Referenced
             std::lock_guard<std::mutex> lock(_objectCacheMutex);
             for(typename ObjectCacheMap::iterator itr = _objectCache.begin(); itr != _objectCache.end(); ++itr)
             {
-                osg::Object* object = itr->second.first.get();
+                osg::Object* object = itr->second.mObject.get();
                 if (object)
                 {
                     osg::Node* node = dynamic_cast<osg::Node*>(object);
@@ -168,7 +208,7 @@ class GenericObjectCache : public osg::Referenced
         {
             std::lock_guard<std::mutex> lock(_objectCacheMutex);
             for (typename ObjectCacheMap::iterator it = _objectCache.begin(); it != _objectCache.end(); ++it)
-                f(it->first, it->second.first.get());
+                f(it->first, it->second.mObject.get());
         }
 
         /** Get the number of objects in the cache. */
@@ -178,15 +218,38 @@ class GenericObjectCache : public osg::Referenced
             return _objectCache.size();
         }
 
+        /** Get the total size estimate (in bytes) of the objects in the cache. */
+        std::size_t getCacheSizeBytes() const
+        {
+            std::lock_guard<std::mutex> lock(_objectCacheMutex);
+            return _sizeInBytes;
+        }
+
+        /** Set the size budget (in bytes). While the total size estimate exceeds the budget,
+          * removeExpiredObjectsInCache evicts the least recently used unreferenced entries
+          * regardless of their expiry time. 0 (the default) disables the budget. */
+        void setSizeBudget(std::size_t sizeInBytes)
+        {
+            std::lock_guard<std::mutex> lock(_objectCacheMutex);
+            _sizeBudget = sizeInBytes;
+        }
+
     protected:
 
         virtual ~GenericObjectCache() {}
 
-        typedef std::pair<osg::ref_ptr<osg::Object>, double >           ObjectTimeStampPair;
-        typedef std::map<KeyType, ObjectTimeStampPair >             ObjectCacheMap;
+        struct Item
+        {
+            osg::ref_ptr<osg::Object> mObject;
+            double mTimeStamp = 0.0;
+            std::size_t mSizeInBytes = 0;
+        };
+        typedef std::map<KeyType, Item >             ObjectCacheMap;
 
         ObjectCacheMap                          _objectCache;
         mutable std::mutex                      _objectCacheMutex;
+        std::size_t                             _sizeInBytes = 0;
+        std::size_t                             _sizeBudget = 0;
 
 };
 
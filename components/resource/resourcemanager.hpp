@@ -26,6 +26,7 @@ namespace Resource
         virtual void updateCache(double referenceTime) {}
         virtual void clearCache() {}
         virtual void setExpiryDelay(double expiryDelay) {}
+        virtual void setCacheSizeBudget(std::size_t bytes) {}
         virtual void reportStats(unsigned int frameNumber, osg::Stats* stats) const {}
         virtual void releaseGLObjects(osg::State* state) {}
     };
@@ -61,6 +62,9 @@ namespace Resource
         void setExpiryDelay (double expiryDelay) override { mExpiryDelay = expiryDelay; }
         float getExpiryDelay() const { return mExpiryDelay; }
 
+        /// @see GenericObjectCache::setSizeBudget
+        void setCacheSizeBudget(std::size_t bytes) override { mCache->setSizeBudget(bytes); }
+
         const VFS::Manager* getVFS() const { return mVFS; }
 
         void reportStats(unsigned int frameNumber, osg::Stats* stats) const override {}
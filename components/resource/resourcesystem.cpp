@@ -62,6 +62,12 @@ namespace Resource
         mNifFileManager->setExpiryDelay(0.0);
     }
 
+    void ResourceSystem::setCacheSizeBudget(std::size_t bytes)
+    {
+        for (std::vector<BaseResourceManager*>::iterator it = mResourceManagers.begin(); it != mResourceManagers.end(); ++it)
+            (*it)->setCacheSizeBudget(bytes);
+    }
+
     void ResourceSystem::updateCache(double referenceTime)
     {
         for (std::vector<BaseResourceManager*>::iterator it = mResourceManagers.begin(); it != mResourceManagers.end(); ++it)
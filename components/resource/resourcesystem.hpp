@@ -1,6 +1,7 @@
 #ifndef OPENMW_COMPONENTS_RESOURCE_RESOURCESYSTEM_H
 #define OPENMW_COMPONENTS_RESOURCE_RESOURCESYSTEM_H
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -56,6 +57,11 @@ namespace Resource
         /// How long to keep objects in cache after no longer being referenced.
         void setExpiryDelay(double expiryDelay);
 
+        /// Maximum estimated size (in bytes) each resource manager's cache may retain. When a cache
+        /// exceeds its budget, the least recently used unreferenced entries are evicted regardless
+        /// of the expiry delay. 0 disables the budget.
+        void setCacheSizeBudget(std::size_t bytes);
+
         /// @note May be called from any thread.
         const VFS::Manager* getVFS() const;
 
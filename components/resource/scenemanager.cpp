@@ -2,10 +2,16 @@
 
 #include <cstdlib>
 
+#include <osg/Geometry>
 #include <osg/Node>
 #include <osg/UserDataContainer>
 
 #include <osgParticle/ParticleSystem>
+#include <osgParticle/ParticleProcessor>
+#include <osgParticle/ParticleSystemUpdater>
+
+#include <osgAnimation/MorphGeometry>
+#include <osgAnimation/RigGeometry>
 
 #include <osgUtil/IncrementalCompileOperation>
 
@@ -13,6 +19,7 @@
 #include <osgDB/Registry>
 
 #include <components/debug/debuglog.hpp>
+#include <components/debug/memorytracking.hpp>
 
 #include <components/nifosg/nifloader.hpp>
 #include <components/nif/niffile.hpp>
@@ -25,7 +32,10 @@
 #include <components/sceneutil/clone.hpp>
 #include <components/sceneutil/util.hpp>
 #include <components/sceneutil/controller.hpp>
+#include <components/sceneutil/morphgeometry.hpp>
 #include <components/sceneutil/optimizer.hpp>
+#include <components/sceneutil/riggeometry.hpp>
+#include <components/sceneutil/skeleton.hpp>
 #include <components/sceneutil/visitor.hpp>
 
 #include <components/shader/shadervisitor.hpp>
@@ -222,6 +232,7 @@ namespace Resource
     SceneManager::SceneManager(const VFS::Manager *vfs, Resource::ImageManager* imageManager, Resource::NifFileManager* nifFileManager)
         : ResourceManager(vfs)
         , mShaderManager(new Shader::ShaderManager)
+        , mTextureLookupCache(new Shader::TextureLookupCache)
         , mForceShaders(false)
         , mClampLighting(true)
         , mAutoUseNormalMaps(false)
@@ -254,6 +265,10 @@ namespace Resource
 
     void SceneManager::recreateShaders(osg::ref_ptr<osg::Node> node, const std::string& shaderPrefix, bool translucentFramebuffer, bool forceShadersForNode)
     {
+        // the shader visitor modifies state below the given node, so instances sharing
+        // their template's graph need a private copy of it first
+        SceneUtil::unshareGraph(node);
+
         osg::ref_ptr<Shader::ShaderVisitor> shaderVisitor(createShaderVisitor(shaderPrefix, translucentFramebuffer));
         shaderVisitor->setAllowedToModifyStateSets(false);
         if (forceShadersForNode)
@@ -263,6 +278,8 @@ namespace Resource
 
     void SceneManager::reinstateRemovedState(osg::ref_ptr<osg::Node> node)
     {
+        SceneUtil::unshareGraph(node);
+
         osg::ref_ptr<Shader::ReinstateRemovedStateVisitor> reinstateRemovedStateVisitor = new Shader::ReinstateRemovedStateVisitor(false);
         node->accept(*reinstateRemovedStateVisitor);
     }
@@ -428,34 +445,92 @@ namespace Resource
         }
     }
 
-    class CanOptimizeCallback : public SceneUtil::Optimizer::IsOperationPermissibleForObjectCallback
+    class CountNodesVisitor : public osg::NodeVisitor
     {
     public:
-        bool isReservedName(const std::string& name) const
+        CountNodesVisitor()
+            : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+            , mCount(0)
         {
-            if (name.empty())
-                return false;
+        }
 
-            static std::vector<std::string> reservedNames;
-            if (reservedNames.empty())
-            {
-                const char* reserved[] = {"Head", "Neck", "Chest", "Groin", "Right Hand", "Left Hand", "Right Wrist", "Left Wrist", "Shield Bone", "Right Forearm", "Left Forearm", "Right Upper Arm",
-                                          "Left Upper Arm", "Right Foot", "Left Foot", "Right Ankle", "Left Ankle", "Right Knee", "Left Knee", "Right Upper Leg", "Left Upper Leg", "Right Clavicle",
-                                          "Left Clavicle", "Weapon Bone", "Tail", "Bip01", "Root Bone", "BoneOffset", "AttachLight", "Arrow", "Camera", "Collision", "Right_Wrist", "Left_Wrist",
-                                          "Shield_Bone", "Right_Forearm", "Left_Forearm", "Right_Upper_Arm", "Left_Clavicle", "Weapon_Bone", "Root_Bone"};
+        void apply(osg::Node& node) override
+        {
+            ++mCount;
+            traverse(node);
+        }
 
-                reservedNames = std::vector<std::string>(reserved, reserved + sizeof(reserved)/sizeof(reserved[0]));
+        unsigned int mCount;
+    };
 
-                for (unsigned int i=0; i<sizeof(reserved)/sizeof(reserved[0]); ++i)
-                    reservedNames.push_back(std::string("Tri ") + reserved[i]);
+    // Estimates the memory held by a loaded template's vertex data. Textures are not counted
+    // here since they are tracked by the ImageManager's cache.
+    class ComputeResourceSizeVisitor : public osg::NodeVisitor
+    {
+    public:
+        ComputeResourceSizeVisitor()
+            : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+            , mSizeInBytes(0)
+        {
+        }
 
-                std::sort(reservedNames.begin(), reservedNames.end(), Misc::StringUtils::ciLess);
+        void apply(osg::Geometry& geometry) override
+        {
+            addArray(geometry.getVertexArray());
+            addArray(geometry.getNormalArray());
+            addArray(geometry.getColorArray());
+            addArray(geometry.getSecondaryColorArray());
+            addArray(geometry.getFogCoordArray());
+            for (unsigned int i=0; i<geometry.getNumTexCoordArrays(); ++i)
+                addArray(geometry.getTexCoordArray(i));
+            for (unsigned int i=0; i<geometry.getNumVertexAttribArrays(); ++i)
+                addArray(geometry.getVertexAttribArray(i));
+            for (unsigned int i=0; i<geometry.getNumPrimitiveSets(); ++i)
+            {
+                if (const osg::PrimitiveSet* primitives = geometry.getPrimitiveSet(i))
+                    mSizeInBytes += primitives->getTotalDataSize();
             }
+            traverse(geometry);
+        }
+
+        std::size_t mSizeInBytes;
 
-            std::vector<std::string>::iterator it = Misc::StringUtils::partialBinarySearch(reservedNames.begin(), reservedNames.end(), name);
-            return it != reservedNames.end();
+    private:
+        void addArray(const osg::Array* array)
+        {
+            if (array)
+                mSizeInBytes += array->getTotalDataSize();
         }
+    };
 
+    bool isReservedName(const std::string& name)
+    {
+        if (name.empty())
+            return false;
+
+        static std::vector<std::string> reservedNames;
+        if (reservedNames.empty())
+        {
+            const char* reserved[] = {"Head", "Neck", "Chest", "Groin", "Right Hand", "Left Hand", "Right Wrist", "Left Wrist", "Shield Bone", "Right Forearm", "Left Forearm", "Right Upper Arm",
+                                      "Left Upper Arm", "Right Foot", "Left Foot", "Right Ankle", "Left Ankle", "Right Knee", "Left Knee", "Right Upper Leg", "Left Upper Leg", "Right Clavicle",
+                                      "Left Clavicle", "Weapon Bone", "Tail", "Bip01", "Root Bone", "BoneOffset", "AttachLight", "Arrow", "Camera", "Collision", "Right_Wrist", "Left_Wrist",
+                                      "Shield_Bone", "Right_Forearm", "Left_Forearm", "Right_Upper_Arm", "Left_Clavicle", "Weapon_Bone", "Root_Bone"};
+
+            reservedNames = std::vector<std::string>(reserved, reserved + sizeof(reserved)/sizeof(reserved[0]));
+
+            for (unsigned int i=0; i<sizeof(reserved)/sizeof(reserved[0]); ++i)
+                reservedNames.push_back(std::string("Tri ") + reserved[i]);
+
+            std::sort(reservedNames.begin(), reservedNames.end(), Misc::StringUtils::ciLess);
+        }
+
+        std::vector<std::string>::iterator it = Misc::StringUtils::partialBinarySearch(reservedNames.begin(), reservedNames.end(), name);
+        return it != reservedNames.end();
+    }
+
+    class CanOptimizeCallback : public SceneUtil::Optimizer::IsOperationPermissibleForObjectCallback
+    {
+    public:
         bool isOperationPermissibleForObjectImplementation(const SceneUtil::Optimizer* optimizer, const osg::Drawable* node,unsigned int option) const override
         {
             if (option & SceneUtil::Optimizer::FLATTEN_STATIC_TRANSFORMS)
@@ -523,6 +598,65 @@ namespace Resource
         return options;
     }
 
+    // Decides whether instances of a loaded template may reference the template's graph directly
+    // instead of deep copying it. Animated content needs a private copy per instance so that its
+    // controllers can be assigned per-instance input, and graphs containing reserved-name nodes
+    // may be structurally modified by the systems that look these nodes up (attached lights,
+    // nocked arrows, sheaths and the like).
+    class CanShareInstanceVisitor : public osg::NodeVisitor
+    {
+    public:
+        CanShareInstanceVisitor()
+            : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+            , mCanShare(true)
+        {
+        }
+
+        void apply(osg::Node& node) override
+        {
+            checkNode(node);
+            if (mCanShare)
+                traverse(node);
+        }
+
+        void apply(osg::Drawable& drawable) override
+        {
+            if (dynamic_cast<SceneUtil::RigGeometry*>(&drawable) || dynamic_cast<SceneUtil::MorphGeometry*>(&drawable)
+                    || dynamic_cast<osgAnimation::RigGeometry*>(&drawable) || dynamic_cast<osgAnimation::MorphGeometry*>(&drawable)
+                    || dynamic_cast<osgParticle::ParticleSystem*>(&drawable))
+                mCanShare = false;
+            else
+                checkNode(drawable);
+        }
+
+        bool mCanShare;
+
+    private:
+        void checkNode(osg::Node& node)
+        {
+            if (node.getUpdateCallback() || node.getCullCallback()
+                    || node.getDataVariance() == osg::Object::DYNAMIC
+                    || dynamic_cast<SceneUtil::Skeleton*>(&node)
+                    || dynamic_cast<osgParticle::ParticleProcessor*>(&node)
+                    || dynamic_cast<osgParticle::ParticleSystemUpdater*>(&node)
+                    || isReservedName(node.getName()))
+                mCanShare = false;
+        }
+    };
+
+    bool hasSharedTemplateHint(const osg::Node* node)
+    {
+        const osg::UserDataContainer* container = node->getUserDataContainer();
+        if (!container)
+            return false;
+
+        for (unsigned int i=0; i<container->getNumUserObjects(); ++i)
+            if (dynamic_cast<const SharedTemplateHint*>(container->getUserObject(i)))
+                return true;
+
+        return false;
+    }
+
     void SceneManager::shareState(osg::ref_ptr<osg::Node> node) {
         mSharedStateMutex.lock();
         mSharedStateManager->share(node.get());
@@ -531,6 +665,8 @@ namespace Resource
 
     osg::ref_ptr<const osg::Node> SceneManager::getTemplate(const std::string &name, bool compile)
     {
+        Debug::ScopedMemoryDomain memoryDomain(Debug::MemoryDomain::Scene);
+
         std::string normalized = mVFS->normalizeFilename(name);
 
         osg::ref_ptr<osg::Object> obj = mCache->getRefFromObjectCache(normalized);
@@ -585,15 +721,33 @@ namespace Resource
 
                 static const unsigned int options = getOptimizationOptions();
 
+                CountNodesVisitor countBefore;
+                loaded->accept(countBefore);
+
                 optimizer.optimize(loaded, options);
+
+                CountNodesVisitor countAfter;
+                loaded->accept(countAfter);
+                if (countAfter.mCount < countBefore.mCount)
+                    mOptimizedNodes += countBefore.mCount - countAfter.mCount;
+                Log(Debug::Verbose) << "Optimized " << normalized << ": " << countBefore.mCount
+                                    << " -> " << countAfter.mCount << " nodes";
             }
 
+            CanShareInstanceVisitor canShareVisitor;
+            loaded->accept(canShareVisitor);
+            if (canShareVisitor.mCanShare)
+                loaded->getOrCreateUserDataContainer()->addUserObject(new SharedTemplateHint);
+
             if (compile && mIncrementalCompileOperation)
                 mIncrementalCompileOperation->add(loaded);
             else
                 loaded->getBound();
 
-            mCache->addEntryToObjectCache(normalized, loaded);
+            ComputeResourceSizeVisitor computeSize;
+            loaded->accept(computeSize);
+
+            mCache->addEntryToObjectCache(normalized, loaded, 0.0, computeSize.mSizeInBytes);
             return loaded;
         }
     }
@@ -621,23 +775,37 @@ namespace Resource
 
     osg::ref_ptr<osg::Node> SceneManager::createInstance(const osg::Node *base)
     {
-        osg::ref_ptr<osg::Node> cloned = static_cast<osg::Node*>(base->clone(SceneUtil::CopyOp()));
+        osg::ref_ptr<osg::Node> instance;
+        if (hasSharedTemplateHint(base))
+        {
+            // The template contains no animated content, so the instance can reference the template's
+            // graph instead of deep copying it. Anything that wants to modify nodes or state below the
+            // instance's root needs to call SceneUtil::unshareGraph first.
+            osg::ref_ptr<SceneUtil::SharedInstance> shared (new SceneUtil::SharedInstance);
+            // const-cast is fine, gaining a parent does not modify the template's graph
+            shared->addChild(const_cast<osg::Node*>(base));
+            instance = shared;
+        }
+        else
+            instance = static_cast<osg::Node*>(base->clone(SceneUtil::CopyOp()));
 
         // add a ref to the original template, to hint to the cache that it's still being used and should be kept in cache
-        cloned->getOrCreateUserDataContainer()->addUserObject(new TemplateRef(base));
+        instance->getOrCreateUserDataContainer()->addUserObject(new TemplateRef(base));
 
         // we can skip any scene graphs without update callbacks since we know that particle emitters will have an update callback set
-        if (cloned->getNumChildrenRequiringUpdateTraversal() > 0)
+        if (instance->getNumChildrenRequiringUpdateTraversal() > 0)
         {
             InitParticlesVisitor visitor (mParticleSystemMask);
-            cloned->accept(visitor);
+            instance->accept(visitor);
         }
 
-        return cloned;
+        return instance;
     }
 
     osg::ref_ptr<osg::Node> SceneManager::getInstance(const std::string &name)
     {
+        Debug::ScopedMemoryDomain memoryDomain(Debug::MemoryDomain::Scene);
+
         const std::string normalized = mVFS->normalizeFilename(name);
 
         osg::ref_ptr<osg::Object> obj = mInstanceCache->takeFromObjectCache(normalized);
@@ -799,7 +967,10 @@ namespace Resource
             stats->setAttribute(frameNumber, "StateSet", mSharedStateManager->getNumSharedStateSets());
         }
 
+        stats->setAttribute(frameNumber, "Nodes Removed", mOptimizedNodes);
+
         stats->setAttribute(frameNumber, "Node", mCache->getCacheSize());
+        stats->setAttribute(frameNumber, "Node MB", mCache->getCacheSizeBytes() / (1024.0 * 1024.0));
         stats->setAttribute(frameNumber, "Node Instance", mInstanceCache->getCacheSize());
     }
 
@@ -815,6 +986,7 @@ namespace Resource
         shaderVisitor->setApplyLightingToEnvMaps(mApplyLightingToEnvMaps);
         shaderVisitor->setConvertAlphaTestToAlphaToCoverage(mConvertAlphaTestToAlphaToCoverage);
         shaderVisitor->setTranslucentFramebuffer(translucentFramebuffer);
+        shaderVisitor->setTextureLookupCache(mTextureLookupCache);
         return shaderVisitor;
     }
 }
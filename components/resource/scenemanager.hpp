@@ -3,6 +3,7 @@
 
 #include <string>
 #include <map>
+#include <atomic>
 #include <memory>
 #include <mutex>
 
@@ -35,6 +36,7 @@ namespace Shader
 {
     class ShaderManager;
     class ShaderVisitor;
+    class TextureLookupCache;
 }
 
 namespace Resource
@@ -65,6 +67,18 @@ namespace Resource
         std::vector<osg::ref_ptr<const Object>> mObjects;
     };
 
+    /// Attached to a loaded scene template to mark that instances of it may reference the
+    /// template's graph instead of deep copying it.
+    /// @see SceneManager::createInstance
+    class SharedTemplateHint : public osg::Object
+    {
+    public:
+        SharedTemplateHint() {}
+        SharedTemplateHint(const SharedTemplateHint& copy, const osg::CopyOp&) {}
+
+        META_Object(Resource, SharedTemplateHint)
+    };
+
     class MultiObjectCache;
 
     /// @brief Handles loading and caching of scenes, e.g. .nif files or .osg files
@@ -194,6 +208,9 @@ namespace Resource
         Shader::ShaderVisitor* createShaderVisitor(const std::string& shaderPrefix = "objects", bool translucentFramebuffer = false);
 
         std::unique_ptr<Shader::ShaderManager> mShaderManager;
+        // Shared between all shader visitor runs, so auto-detected map lookups are
+        // not repeated for textures used by many templates.
+        std::shared_ptr<Shader::TextureLookupCache> mTextureLookupCache;
         bool mForceShaders;
         bool mClampLighting;
         bool mAutoUseNormalMaps;
@@ -212,6 +229,9 @@ namespace Resource
         osg::ref_ptr<Resource::SharedStateManager> mSharedStateManager;
         mutable std::mutex mSharedStateMutex;
 
+        // Total number of nodes the optimizer removed from loaded templates, for the stats HUD.
+        std::atomic<unsigned int> mOptimizedNodes{0};
+
         Resource::ImageManager* mImageManager;
         Resource::NifFileManager* mNifFileManager;
 
@@ -370,42 +370,86 @@ void StatsHandler::setUpScene(osgViewer::ViewerBase *viewer)
             "",
             "Compiling",
             "UnrefQueue",
+            "Unref Released",
             "WorkQueue",
             "WorkThread",
             "",
             "Texture",
             "StateSet",
             "Node",
+            "Node MB",
             "Node Instance",
             "Shape",
             "Shape Instance",
+            "Shape Dedup MB",
             "Image",
+            "Image MB",
             "Nif",
             "Keyframe",
+            "Nodes Removed",
             "",
             "Groundcover Chunk",
             "Object Chunk",
+            "Object Chunk Collect Time",
+            "Object Chunk Instance Time",
+            "Object Chunk Merge Time",
             "Terrain Chunk",
             "Terrain Texture",
             "Land",
             "Composite",
+            "Shadow Caster",
+            "Shadow Pruned",
+            "Post Pass us",
+            "",
+            "Sky Bin us",
+            "Water Bin us",
+            "Transparent Bin us",
+            "Occlusion Bin us",
+            "FirstPerson Bin us",
+            "SunGlare Bin us",
             "",
             "NavMesh Jobs",
             "NavMesh Waiting",
             "NavMesh Pushed",
             "NavMesh Processing",
+            "NavMesh Job Delay ms",
             "NavMesh CacheSize",
             "NavMesh UsedTiles",
             "NavMesh CachedTiles",
             "NavMesh CacheHitRate",
             "",
             "Mechanics Actors",
+            "Mechanics Actors Near",
+            "Mechanics Actors Mid",
+            "Mechanics Actors Far",
             "Mechanics Objects",
             "",
+            "Scripts Total",
+            "Scripts Run",
+            "Lua Handlers Run",
+            "Lua Handlers Deferred",
+            "Lua Events Peak",
+            "",
             "Physics Actors",
             "Physics Objects",
             "Physics Projectiles",
             "Physics HeightFields",
+            "Physics Sweeps",
+            "",
+            "Scene Active Cells",
+            "Scene Inactive Cells",
+            "Scene Grid Changes",
+            "Scene Grid Time",
+            "Preload Cells",
+            "Preload Pending",
+            "Preload Terrain",
+            "",
+            "Mem Scene MB",
+            "Mem Store MB",
+            "Mem Physics MB",
+            "Mem NavMesh MB",
+            "Mem Lua MB",
+            "Mem Other MB",
         });
 
         static const auto longest = std::max_element(statNames.begin(), statNames.end(),
@@ -1,5 +1,6 @@
 #include "clone.hpp"
 
+#include <osg/NodeVisitor>
 #include <osg/StateSet>
 
 #include <osgAnimation/MorphGeometry>
@@ -91,4 +92,59 @@ namespace SceneUtil
         return cloned;
     }
 
+    SharedInstance::SharedInstance()
+        : mShared(true)
+    {
+    }
+
+    SharedInstance::SharedInstance(const SharedInstance& copy, const osg::CopyOp& copyop)
+        : osg::Group(copy, copyop)
+        // a deep copy gives this node private children, so the copy is not shared
+        , mShared(copy.mShared && !(copyop.getCopyFlags() & osg::CopyOp::DEEP_COPY_NODES))
+    {
+    }
+
+    void SharedInstance::unshare()
+    {
+        if (!mShared)
+            return;
+
+        SceneUtil::CopyOp copyop;
+        for (unsigned int i=0; i<getNumChildren(); ++i)
+            setChild(i, static_cast<osg::Node*>(getChild(i)->clone(copyop)));
+        mShared = false;
+    }
+
+    class UnshareVisitor : public osg::NodeVisitor
+    {
+    public:
+        UnshareVisitor()
+            : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+            , mUnshared(false)
+        {
+        }
+
+        void apply(osg::Group& group) override
+        {
+            if (SharedInstance* instance = dynamic_cast<SharedInstance*>(&group))
+            {
+                if (instance->isShared())
+                {
+                    instance->unshare();
+                    mUnshared = true;
+                }
+            }
+            traverse(group);
+        }
+
+        bool mUnshared;
+    };
+
+    bool unshareGraph(osg::Node* node)
+    {
+        UnshareVisitor visitor;
+        node->accept(visitor);
+        return visitor.mUnshared;
+    }
+
 }
@@ -4,6 +4,7 @@
 #include <map>
 
 #include <osg/CopyOp>
+#include <osg/Group>
 
 namespace osgParticle
 {
@@ -38,6 +39,34 @@ namespace SceneUtil
         mutable std::map<const osgParticle::ParticleSystem*, osgParticle::ParticleSystem*> mOldPsToNewPs;
     };
 
+    /// Group referencing shared children instead of holding a private copy of them.
+    /// Created by Resource::SceneManager for instances of templates that contain no animated content.
+    /// The node itself belongs to the instance, but everything below it is shared with other
+    /// instances of the same template and must be treated as immutable until unshare() was called.
+    class SharedInstance : public osg::Group
+    {
+    public:
+        SharedInstance();
+        SharedInstance(const SharedInstance& copy, const osg::CopyOp& copyop);
+
+        META_Node(SceneUtil, SharedInstance)
+
+        /// Replace the shared children with a private deep copy.
+        void unshare();
+
+        bool isShared() const { return mShared; }
+
+    private:
+        bool mShared;
+    };
+
+    /// Give any shared subtrees below the given node a private copy of their graph.
+    /// Must be called before modifying nodes or state below an instance created by
+    /// Resource::SceneManager, unless the modification only concerns the instance's root node.
+    /// @return Whether anything was unshared. Node pointers obtained from the graph earlier
+    ///         are stale in that case and need to be looked up again.
+    bool unshareGraph(osg::Node* node);
+
 }
 
 #endif
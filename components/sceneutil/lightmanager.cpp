@@ -5,6 +5,8 @@
 #include <osg/BufferObject>
 #include <osg/BufferIndexBinding>
 #include <osg/Endian>
+#include <osg/Polytope>
+#include <osg/Stats>
 #include <osg/Version>
 #include <osg/ValueObject>
 
@@ -78,6 +80,22 @@ namespace
     {
         return (camera->getName() == "ReflectionCamera");
     }
+
+    bool intersectsFrustum(const osg::Polytope& frustum, const osg::BoundingSphere& bound)
+    {
+        for (const osg::Plane& plane : frustum.getPlaneList())
+            if (plane.distance(bound.center()) < -bound.radius())
+                return false;
+        return true;
+    }
+
+    // Below this light count a linear scan per drawable is cheaper than binning the lights
+    // into a grid first.
+    constexpr size_t sLightGridThreshold = 32;
+
+    // Cells per grid axis. The grid spans the view-space extent of the lights, so the cell
+    // size adapts to how spread out the scene's lights are.
+    constexpr int sLightGridDim = 8;
 }
 
 namespace SceneUtil
@@ -1145,6 +1163,13 @@ namespace SceneUtil
         }
     }
 
+    void LightManager::reportStats(unsigned int frameNumber, osg::Stats* stats)
+    {
+        stats->setAttribute(frameNumber, "Light StateSet", mStateSetCache[frameNumber%2].size());
+        stats->setAttribute(frameNumber, "Light StateSet Contention", mStateSetCacheContention.exchange(0));
+        stats->setAttribute(frameNumber, "Light ViewSpace Contention", mLightsInViewSpaceContention.exchange(0));
+    }
+
     void LightManager::addLight(LightSource* lightSource, const osg::Matrixf& worldMat, size_t frameNum)
     {
         LightSourceTransform l;
@@ -1173,19 +1198,27 @@ namespace SceneUtil
         // possible optimization: return a StateSet containing all requested lights plus some extra lights (if a suitable one exists)
         size_t hash = 0;
         for (size_t i = 0; i < lightList.size(); ++i)
-        {
-            auto id = lightList[i]->mLightSource->getId();
-            Misc::hashCombine(hash, id);
+            Misc::hashCombine(hash, lightList[i]->mLightSource->getId());
 
-            if (getLightingMethod() != LightingMethod::SingleUBO)
-                continue;
+        std::unique_lock<std::mutex> lock(mStateSetCacheMutex, std::try_to_lock);
+        if (!lock.owns_lock())
+        {
+            ++mStateSetCacheContention;
+            lock.lock();
+        }
 
-            if (getLightIndexMap(frameNum).find(id) != getLightIndexMap(frameNum).end())
-                continue;
+        if (getLightingMethod() == LightingMethod::SingleUBO)
+        {
+            for (size_t i = 0; i < lightList.size(); ++i)
+            {
+                auto id = lightList[i]->mLightSource->getId();
+                if (getLightIndexMap(frameNum).find(id) != getLightIndexMap(frameNum).end())
+                    continue;
 
-            int index = getLightIndexMap(frameNum).size() + 1;
-            updateGPUPointLight(index, lightList[i]->mLightSource, frameNum, viewMatrix);
-            getLightIndexMap(frameNum).emplace(lightList[i]->mLightSource->getId(), index);
+                int index = getLightIndexMap(frameNum).size() + 1;
+                updateGPUPointLight(index, lightList[i]->mLightSource, frameNum, viewMatrix);
+                getLightIndexMap(frameNum).emplace(id, index);
+            }
         }
 
         auto& stateSetCache = mStateSetCache[frameNum%2];
@@ -1202,17 +1235,139 @@ namespace SceneUtil
         return stateset;
     }
 
-    const std::vector<LightManager::LightSourceViewBound>& LightManager::getLightsInViewSpace(osg::Camera *camera, const osg::RefMatrix* viewMatrix, size_t frameNum)
+    void LightManager::LightsInViewSpace::buildGrid()
+    {
+        mCellOffsets.clear();
+        mCellLights.clear();
+
+        if (mBounds.size() < sLightGridThreshold)
+            return;
+
+        osg::BoundingBox extents;
+        for (const auto& l : mBounds)
+        {
+            const osg::Vec3f radius (l.mViewBound.radius(), l.mViewBound.radius(), l.mViewBound.radius());
+            extents.expandBy(osg::BoundingBox(l.mViewBound.center() - radius, l.mViewBound.center() + radius));
+        }
+
+        mGridOrigin = extents._min;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const float extent = extents._max[axis] - extents._min[axis];
+            mGridDims[axis] = extent > 0.f ? sLightGridDim : 1;
+            mInvCellSize[axis] = extent > 0.f ? mGridDims[axis] / extent : 0.f;
+        }
+
+        const auto cellRange = [this] (const osg::BoundingSphere& bound, int axis, int& lo, int& hi)
+        {
+            lo = std::clamp(static_cast<int>((bound.center()[axis] - bound.radius() - mGridOrigin[axis]) * mInvCellSize[axis]), 0, mGridDims[axis] - 1);
+            hi = std::clamp(static_cast<int>((bound.center()[axis] + bound.radius() - mGridOrigin[axis]) * mInvCellSize[axis]), 0, mGridDims[axis] - 1);
+        };
+
+        // Count the lights per cell, turn the counts into start offsets, then fill. This keeps
+        // the per-cell lists in two flat arrays instead of a vector per cell.
+        const int numCells = mGridDims[0] * mGridDims[1] * mGridDims[2];
+        mCellOffsets.assign(numCells + 1, 0);
+        for (const auto& l : mBounds)
+        {
+            int lo[3], hi[3];
+            for (int axis = 0; axis < 3; ++axis)
+                cellRange(l.mViewBound, axis, lo[axis], hi[axis]);
+            for (int z = lo[2]; z <= hi[2]; ++z)
+                for (int y = lo[1]; y <= hi[1]; ++y)
+                    for (int x = lo[0]; x <= hi[0]; ++x)
+                        ++mCellOffsets[(z * mGridDims[1] + y) * mGridDims[0] + x + 1];
+        }
+        for (int i = 0; i < numCells; ++i)
+            mCellOffsets[i + 1] += mCellOffsets[i];
+
+        mCellLights.resize(mCellOffsets[numCells]);
+        std::vector<int> cursor (mCellOffsets.begin(), mCellOffsets.end() - 1);
+        for (size_t i = 0; i < mBounds.size(); ++i)
+        {
+            int lo[3], hi[3];
+            for (int axis = 0; axis < 3; ++axis)
+                cellRange(mBounds[i].mViewBound, axis, lo[axis], hi[axis]);
+            for (int z = lo[2]; z <= hi[2]; ++z)
+                for (int y = lo[1]; y <= hi[1]; ++y)
+                    for (int x = lo[0]; x <= hi[0]; ++x)
+                        mCellLights[cursor[(z * mGridDims[1] + y) * mGridDims[0] + x]++] = static_cast<int>(i);
+        }
+    }
+
+    void LightManager::LightsInViewSpace::collectIntersecting(const osg::BoundingSphere& nodeBound, LightList& out,
+                                                              const std::set<LightSource*>& ignoredLightSources) const
+    {
+        if (mCellLights.empty())
+        {
+            for (const auto& l : mBounds)
+            {
+                if (ignoredLightSources.count(l.mLightSource))
+                    continue;
+                if (l.mViewBound.intersects(nodeBound))
+                    out.push_back(&l);
+            }
+            return;
+        }
+
+        int lo[3], hi[3];
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            lo[axis] = std::clamp(static_cast<int>((nodeBound.center()[axis] - nodeBound.radius() - mGridOrigin[axis]) * mInvCellSize[axis]), 0, mGridDims[axis] - 1);
+            hi[axis] = std::clamp(static_cast<int>((nodeBound.center()[axis] + nodeBound.radius() - mGridOrigin[axis]) * mInvCellSize[axis]), 0, mGridDims[axis] - 1);
+        }
+
+        std::vector<int> candidates;
+        for (int z = lo[2]; z <= hi[2]; ++z)
+            for (int y = lo[1]; y <= hi[1]; ++y)
+                for (int x = lo[0]; x <= hi[0]; ++x)
+                {
+                    const int cell = (z * mGridDims[1] + y) * mGridDims[0] + x;
+                    candidates.insert(candidates.end(), mCellLights.begin() + mCellOffsets[cell], mCellLights.begin() + mCellOffsets[cell + 1]);
+                }
+
+        // a light covering several of the queried cells appears once per cell
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+        for (int index : candidates)
+        {
+            const LightSourceViewBound& l = mBounds[index];
+            if (ignoredLightSources.count(l.mLightSource))
+                continue;
+            if (l.mViewBound.intersects(nodeBound))
+                out.push_back(&l);
+        }
+    }
+
+    const LightManager::LightsInViewSpace& LightManager::getLightsInViewSpace(osg::Camera *camera, const osg::RefMatrix* viewMatrix, size_t frameNum)
     {
         osg::observer_ptr<osg::Camera> camPtr (camera);
+
+        std::unique_lock<std::mutex> lock(mLightsInViewSpaceMutex, std::try_to_lock);
+        if (!lock.owns_lock())
+        {
+            ++mLightsInViewSpaceContention;
+            lock.lock();
+        }
+
         auto it = mLightsInViewSpace.find(camPtr);
 
         if (it == mLightsInViewSpace.end())
         {
-            it = mLightsInViewSpace.insert(std::make_pair(camPtr, LightSourceViewBoundCollection())).first;
+            it = mLightsInViewSpace.insert(std::make_pair(camPtr, LightsInViewSpace())).first;
+            auto& bounds = it->second.mBounds;
 
             bool isReflection = isReflectionCamera(camera);
-        
+
+            // Lights that can not reach into the view frustum are dropped here, once per camera,
+            // instead of being intersection-tested against every drawable. The doubled radius
+            // mirrors the margin used when per-object lists are culled below, keeping vertex
+            // lighting from lights just off-screen intact.
+            osg::Polytope frustum;
+            frustum.setToUnitFrustum();
+            frustum.transformProvidingInverse(camera->getProjectionMatrix());
+
             for (const auto& transform : mLights)
             {
                 osg::Matrixf worldViewMat = transform.mWorldMatrix * (*viewMatrix);
@@ -1222,6 +1377,9 @@ namespace SceneUtil
                 osg::BoundingSphere viewBound = osg::BoundingSphere(osg::Vec3f(0,0,0), radius * mPointLightRadiusMultiplier);
                 transformBoundingSphere(worldViewMat, viewBound);
 
+                if (!intersectsFrustum(frustum, osg::BoundingSphere(viewBound.center(), viewBound.radius() * 2.f)))
+                    continue;
+
                 if (!isReflection && mPointLightFadeEnd != 0.f)
                 {
                     const float fadeDelta = mPointLightFadeEnd - mPointLightFadeStart;
@@ -1236,20 +1394,22 @@ namespace SceneUtil
                 LightSourceViewBound l;
                 l.mLightSource = transform.mLightSource;
                 l.mViewBound = viewBound;
-                it->second.push_back(l);
+                bounds.push_back(l);
             }
-        }
 
-        if (getLightingMethod() == LightingMethod::SingleUBO)
-        {
-            if (it->second.size() > static_cast<size_t>(getMaxLightsInScene() - 1))
+            if (getLightingMethod() == LightingMethod::SingleUBO)
             {
-                auto sorter = [] (const LightSourceViewBound& left, const LightSourceViewBound& right) {
-                    return left.mViewBound.center().length2() - left.mViewBound.radius2() < right.mViewBound.center().length2() - right.mViewBound.radius2();
-                };
-                std::sort(it->second.begin() + 1, it->second.end(), sorter);
-                it->second.erase((it->second.begin() + 1) + (getMaxLightsInScene() - 2), it->second.end());
+                if (bounds.size() > static_cast<size_t>(getMaxLightsInScene() - 1))
+                {
+                    auto sorter = [] (const LightSourceViewBound& left, const LightSourceViewBound& right) {
+                        return left.mViewBound.center().length2() - left.mViewBound.radius2() < right.mViewBound.center().length2() - right.mViewBound.radius2();
+                    };
+                    std::sort(bounds.begin() + 1, bounds.end(), sorter);
+                    bounds.erase((bounds.begin() + 1) + (getMaxLightsInScene() - 2), bounds.end());
+                }
             }
+
+            it->second.buildGrid();
         }
 
         return it->second;
@@ -1306,11 +1466,6 @@ namespace SceneUtil
         if (!(cv->getTraversalMask() & mLightManager->getLightingMask()))
             return false;
 
-        // Possible optimizations:
-        // - cull list of lights by the camera frustum
-        // - organize lights in a quad tree
-
-
         // update light list if necessary
         // makes sure we don't update it more than once per frame when rendering with multiple cameras
         if (mLastFrameNumber != cv->getTraversalNumber())
@@ -1319,7 +1474,7 @@ namespace SceneUtil
 
             // Don't use Camera::getViewMatrix, that one might be relative to another camera!
             const osg::RefMatrix* viewMatrix = cv->getCurrentRenderStage()->getInitialViewMatrix();
-            const std::vector<LightManager::LightSourceViewBound>& lights = mLightManager->getLightsInViewSpace(cv->getCurrentCamera(), viewMatrix, mLastFrameNumber);
+            const LightManager::LightsInViewSpace& lights = mLightManager->getLightsInViewSpace(cv->getCurrentCamera(), viewMatrix, mLastFrameNumber);
 
             // get the node bounds in view space
             // NB do not node->getBound() * modelView, that would apply the node's transformation twice
@@ -1336,16 +1491,7 @@ namespace SceneUtil
             transformBoundingSphere(mat, nodeBound);
 
             mLightList.clear();
-            for (size_t i = 0; i < lights.size(); ++i)
-            {
-                const LightManager::LightSourceViewBound& l = lights[i];
-
-                if (mIgnoredLightSources.count(l.mLightSource))
-                    continue;
-
-                if (l.mViewBound.intersects(nodeBound))
-                    mLightList.push_back(&l);
-            }
+            lights.collectIntersecting(nodeBound, mLightList, mIgnoredLightSources);
         }
         if (!mLightList.empty())
         {
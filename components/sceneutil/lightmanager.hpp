@@ -1,6 +1,8 @@
 #ifndef OPENMW_COMPONENTS_SCENEUTIL_LIGHTMANAGER_H
 #define OPENMW_COMPONENTS_SCENEUTIL_LIGHTMANAGER_H
 
+#include <atomic>
+#include <mutex>
 #include <set>
 #include <unordered_set>
 #include <unordered_map>
@@ -17,6 +19,11 @@
 
 #include <components/settings/settings.hpp>
 
+namespace osg
+{
+    class Stats;
+}
+
 namespace osgUtil
 {
     class CullVisitor;
@@ -131,6 +138,28 @@ namespace SceneUtil
         using LightList = std::vector<const LightSourceViewBound*>;
         using SupportedMethods = std::array<bool, 3>;
 
+        /// The lights a camera can see, plus a uniform view-space grid over them so drawables
+        /// can ask for the lights touching their bound without scanning the whole list.
+        struct LightsInViewSpace
+        {
+            std::vector<LightSourceViewBound> mBounds;
+
+            /// Bin mBounds into the grid. With few lights the grid is skipped and
+            /// collectIntersecting() falls back to a linear scan.
+            void buildGrid();
+
+            /// Append the lights whose view bounds intersect \a nodeBound to \a out.
+            void collectIntersecting(const osg::BoundingSphere& nodeBound, LightList& out,
+                                     const std::set<LightSource*>& ignoredLightSources) const;
+
+        private:
+            osg::Vec3f mGridOrigin;
+            osg::Vec3f mInvCellSize;
+            int mGridDims[3] = { 0, 0, 0 };
+            std::vector<int> mCellOffsets; // per cell, the start offset into mCellLights
+            std::vector<int> mCellLights; // indices into mBounds, grouped by cell
+        };
+
         META_Node(SceneUtil, LightManager)
 
         LightManager(bool ffp = true);
@@ -156,10 +185,14 @@ namespace SceneUtil
         /// Internal use only, called automatically by the LightSource's UpdateCallback
         void addLight(LightSource* lightSource, const osg::Matrixf& worldMat, size_t frameNum);
 
-        const std::vector<LightSourceViewBound>& getLightsInViewSpace(osg::Camera* camera, const osg::RefMatrix* viewMatrix, size_t frameNum);
+        const LightsInViewSpace& getLightsInViewSpace(osg::Camera* camera, const osg::RefMatrix* viewMatrix, size_t frameNum);
 
         osg::ref_ptr<osg::StateSet> getLightListStateSet(const LightList& lightList, size_t frameNum, const osg::RefMatrix* viewMatrix);
 
+        /// Report light list cache sizes and how often concurrent cull threads
+        /// collided on the caches since the last frame.
+        void reportStats(unsigned int frameNumber, osg::Stats* stats);
+
         void setSunlight(osg::ref_ptr<osg::Light> sun);
         osg::ref_ptr<osg::Light> getSunlight();
 
@@ -203,13 +236,21 @@ namespace SceneUtil
 
         std::vector<LightSourceTransform> mLights;
 
-        using LightSourceViewBoundCollection = std::vector<LightSourceViewBound>;
-        std::map<osg::observer_ptr<osg::Camera>, LightSourceViewBoundCollection> mLightsInViewSpace;
+        std::map<osg::observer_ptr<osg::Camera>, LightsInViewSpace> mLightsInViewSpace;
 
         // < Light list hash , StateSet >
         using LightStateSetMap = std::map<size_t, osg::ref_ptr<osg::StateSet>>;
         LightStateSetMap mStateSetCache[2];
 
+        // The caches are filled lazily during cull, so they need guarding when
+        // several cull threads (e.g. CullThreadPerCamera) run at once. The
+        // critical sections are short; the counters record how often threads
+        // actually collided, surfaced through reportStats().
+        std::mutex mStateSetCacheMutex;
+        std::mutex mLightsInViewSpaceMutex;
+        std::atomic<unsigned int> mStateSetCacheContention{0};
+        std::atomic<unsigned int> mLightsInViewSpaceContention{0};
+
         std::vector<osg::ref_ptr<osg::StateAttribute>> mDummies;
 
         int mStartLight;
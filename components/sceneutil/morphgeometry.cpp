@@ -1,9 +1,36 @@
 #include "morphgeometry.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 
 #include <osg/Version>
 
+// SSE2 is part of the x86-64 baseline, so no runtime dispatch is needed there;
+// other architectures take the scalar path below.
+#if defined(__SSE2__) || (defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+#define OPENMW_MORPHING_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    /// dst += offsets * weight over a contiguous span of floats. Vertex data is a dense
+    /// x y z x y z... stream and every component accumulates independently, so the kernel
+    /// needs no notion of vertices; the tail that doesn't fill a register is done scalar.
+    inline void accumulateWeighted(float* dst, const float* offsets, float weight, std::size_t count)
+    {
+        std::size_t i = 0;
+#ifdef OPENMW_MORPHING_SSE2
+        const __m128 w = _mm_set1_ps(weight);
+        for (; i + 4 <= count; i += 4)
+            _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(offsets + i), w)));
+#endif
+        for (; i < count; ++i)
+            dst[i] += offsets[i] * weight;
+    }
+}
+
 namespace SceneUtil
 {
 
@@ -163,17 +190,24 @@ void MorphGeometry::cull(osg::NodeVisitor *nv)
     const osg::Vec3Array* positionSrc = static_cast<osg::Vec3Array*>(mSourceGeometry->getVertexArray());
     osg::Vec3Array* positionDst = static_cast<osg::Vec3Array*>(geom.getVertexArray());
     assert(positionSrc->size() == positionDst->size());
-    for (unsigned int vertex=0; vertex<positionSrc->size(); ++vertex)
-        (*positionDst)[vertex] = (*positionSrc)[vertex];
-
-    for (unsigned int i=0; i<mMorphTargets.size(); ++i)
+    if (!positionSrc->empty())
     {
-        float weight = mMorphTargets[i].getWeight();
-        if (weight == 0.f)
-            continue;
-        const osg::Vec3Array* offsets = mMorphTargets[i].getOffsets();
-        for (unsigned int vertex=0; vertex<positionSrc->size(); ++vertex)
-            (*positionDst)[vertex] += (*offsets)[vertex] * weight;
+        // start from the unmorphed vertices; the active targets accumulate on top
+        std::memcpy(&(*positionDst)[0], &(*positionSrc)[0], positionSrc->size() * sizeof(osg::Vec3f));
+
+        float* dst = reinterpret_cast<float*>(&(*positionDst)[0]);
+        const std::size_t floatCount = positionDst->size() * 3;
+        for (unsigned int i=0; i<mMorphTargets.size(); ++i)
+        {
+            float weight = mMorphTargets[i].getWeight();
+            if (weight == 0.f)
+                continue;
+            const osg::Vec3Array* offsets = mMorphTargets[i].getOffsets();
+            if (offsets->empty())
+                continue;
+            const float* src = reinterpret_cast<const float*>(&(*offsets)[0]);
+            accumulateWeighted(dst, src, weight, std::min(floatCount, offsets->size() * 3));
+        }
     }
 
     positionDst->dirty();
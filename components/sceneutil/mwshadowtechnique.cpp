@@ -530,7 +530,8 @@ void MWShadowTechnique::LightData::setLightData(osg::RefMatrix* lm, const osg::L
 //
 MWShadowTechnique::ShadowData::ShadowData(MWShadowTechnique::ViewDependentData* vdd):
     _viewDependentData(vdd),
-    _textureUnit(0)
+    _textureUnit(0),
+    _hasBeenRendered(false)
 {
 
     const ShadowSettings* settings = vdd->getViewDependentShadowMap()->getShadowedScene()->getShadowSettings();
@@ -872,6 +873,11 @@ void SceneUtil::MWShadowTechnique::setShadowFadeStart(float shadowFadeStart)
     _shadowFadeStart = shadowFadeStart;
 }
 
+void SceneUtil::MWShadowTechnique::setDistantCascadeUpdatePeriod(unsigned int period)
+{
+    _distantCascadeUpdatePeriod = osg::maximum(period, 1u);
+}
+
 void SceneUtil::MWShadowTechnique::enableFrontFaceCulling()
 {
     _useFrontFaceCulling = true;
@@ -1238,153 +1244,168 @@ void MWShadowTechnique::cull(osgUtil::CullVisitor& cv)
 
             osg::ref_ptr<osg::Camera> camera = sd->_camera;
 
-            camera->setProjectionMatrix(projectionMatrix);
-            camera->setViewMatrix(viewMatrix);
+            // Distant cascades change little from one frame to the next, so they can be
+            // refreshed in round robin instead of all being re-culled and re-drawn every frame.
+            // A skipped cascade keeps its camera and the map rendered by the last refresh; the
+            // texgen and valid region matrix are still recomputed from the unchanged camera
+            // below, so sampling stays anchored to the world.
+            const bool updateCascade = sm_i == 0 || _distantCascadeUpdatePeriod <= 1 || !sd->_hasBeenRendered
+                    || (cv.getTraversalNumber() + sm_i) % _distantCascadeUpdatePeriod == 0;
+
+            double cascaseNear = reducedNear;
+            double cascadeFar = reducedFar;
+            osg::ref_ptr<VDSMCameraCullCallback> vdsmCallback;
 
-            if (settings->getDebugDraw())
+            if (updateCascade)
             {
-                camera->getViewport()->x() = pos_x;
-                pos_x += static_cast<unsigned int>(camera->getViewport()->width()) + 40;
-            }
+                camera->setProjectionMatrix(projectionMatrix);
+                camera->setViewMatrix(viewMatrix);
 
-            // transform polytope in model coords into light spaces eye coords.
-            osg::Matrixd invertModelView;
-            invertModelView.invert(camera->getViewMatrix());
+                if (settings->getDebugDraw())
+                {
+                    camera->getViewport()->x() = pos_x;
+                    pos_x += static_cast<unsigned int>(camera->getViewport()->width()) + 40;
+                }
 
-            osg::Polytope local_polytope(polytope);
-            local_polytope.transformProvidingInverse(invertModelView);
+                // transform polytope in model coords into light spaces eye coords.
+                osg::Matrixd invertModelView;
+                invertModelView.invert(camera->getViewMatrix());
 
-            double cascaseNear = reducedNear;
-            double cascadeFar = reducedFar;
-            if (numShadowMapsPerLight>1)
-            {
-                // compute the start and end range in non-dimensional coords
+                osg::Polytope local_polytope(polytope);
+                local_polytope.transformProvidingInverse(invertModelView);
+
+                if (numShadowMapsPerLight>1)
+                {
+                    // compute the start and end range in non-dimensional coords
 #if 0
-                double r_start = (sm_i==0) ? -1.0 : (double(sm_i)/double(numShadowMapsPerLight)*2.0-1.0);
-                double r_end = (sm_i+1==numShadowMapsPerLight) ? 1.0 : (double(sm_i+1)/double(numShadowMapsPerLight)*2.0-1.0);
+                    double r_start = (sm_i==0) ? -1.0 : (double(sm_i)/double(numShadowMapsPerLight)*2.0-1.0);
+                    double r_end = (sm_i+1==numShadowMapsPerLight) ? 1.0 : (double(sm_i+1)/double(numShadowMapsPerLight)*2.0-1.0);
 #elif 0
 
-                // hardwired for 2 splits
-                double r_start = (sm_i==0) ? -1.0 : splitPoint;
-                double r_end = (sm_i+1==numShadowMapsPerLight) ? 1.0 : splitPoint;
+                    // hardwired for 2 splits
+                    double r_start = (sm_i==0) ? -1.0 : splitPoint;
+                    double r_end = (sm_i+1==numShadowMapsPerLight) ? 1.0 : splitPoint;
 #else
-                double r_start, r_end;
-
-                // split system based on the original Parallel Split Shadow Maps paper.
-                double n = reducedNear;
-                double f = reducedFar;
-                double i = double(sm_i);
-                double m = double(numShadowMapsPerLight);
-                if (sm_i == 0)
-                    r_start = -1.0;
-                else
-                {
-                    // compute the split point in main camera view
-                    double ciLog = n * pow(f / n, i / m);
-                    double ciUniform = n + (f - n) * i / m;
-                    double ci = _splitPointUniformLogRatio * ciLog + (1.0 - _splitPointUniformLogRatio) * ciUniform + _splitPointDeltaBias;
-                    cascaseNear = ci;
-
-                    // work out where this is in light space
-                    osg::Vec3d worldSpacePos = frustum.eye + frustum.frustumCenterLine * ci;
-                    osg::Vec3d lightSpacePos = worldSpacePos * viewMatrix * projectionMatrix;
-                    r_start = lightSpacePos.y();
-                }
+                    double r_start, r_end;
+
+                    // split system based on the original Parallel Split Shadow Maps paper.
+                    double n = reducedNear;
+                    double f = reducedFar;
+                    double i = double(sm_i);
+                    double m = double(numShadowMapsPerLight);
+                    if (sm_i == 0)
+                        r_start = -1.0;
+                    else
+                    {
+                        // compute the split point in main camera view
+                        double ciLog = n * pow(f / n, i / m);
+                        double ciUniform = n + (f - n) * i / m;
+                        double ci = _splitPointUniformLogRatio * ciLog + (1.0 - _splitPointUniformLogRatio) * ciUniform + _splitPointDeltaBias;
+                        cascaseNear = ci;
+
+                        // work out where this is in light space
+                        osg::Vec3d worldSpacePos = frustum.eye + frustum.frustumCenterLine * ci;
+                        osg::Vec3d lightSpacePos = worldSpacePos * viewMatrix * projectionMatrix;
+                        r_start = lightSpacePos.y();
+                    }
 
-                if (sm_i + 1 == numShadowMapsPerLight)
-                    r_end = 1.0;
-                else
-                {
-                    // compute the split point in main camera view
-                    double ciLog = n * pow(f / n, (i + 1) / m);
-                    double ciUniform = n + (f - n) * (i + 1) / m;
-                    double ci = _splitPointUniformLogRatio * ciLog + (1.0 - _splitPointUniformLogRatio) * ciUniform + _splitPointDeltaBias;
-                    cascadeFar = ci;
+                    if (sm_i + 1 == numShadowMapsPerLight)
+                        r_end = 1.0;
+                    else
+                    {
+                        // compute the split point in main camera view
+                        double ciLog = n * pow(f / n, (i + 1) / m);
+                        double ciUniform = n + (f - n) * (i + 1) / m;
+                        double ci = _splitPointUniformLogRatio * ciLog + (1.0 - _splitPointUniformLogRatio) * ciUniform + _splitPointDeltaBias;
+                        cascadeFar = ci;
                     
-                    // work out where this is in light space
-                    osg::Vec3d worldSpacePos = frustum.eye + frustum.frustumCenterLine * ci;
-                    osg::Vec3d lightSpacePos = worldSpacePos * viewMatrix * projectionMatrix;
-                    r_end = lightSpacePos.y();
-                }
+                        // work out where this is in light space
+                        osg::Vec3d worldSpacePos = frustum.eye + frustum.frustumCenterLine * ci;
+                        osg::Vec3d lightSpacePos = worldSpacePos * viewMatrix * projectionMatrix;
+                        r_end = lightSpacePos.y();
+                    }
 #endif
-                // for all by the last shadowmap shift the r_end so that it overlaps slightly with the next shadowmap
-                // to prevent a seam showing through between the shadowmaps
-                if (sm_i+1<numShadowMapsPerLight) r_end+=0.01;
+                    // for all by the last shadowmap shift the r_end so that it overlaps slightly with the next shadowmap
+                    // to prevent a seam showing through between the shadowmaps
+                    if (sm_i+1<numShadowMapsPerLight) r_end+=0.01;
 
 
-                // We can't add these clipping planes with cascaded shadow maps as they wouldn't be parallel to the light direction.
+                    // We can't add these clipping planes with cascaded shadow maps as they wouldn't be parallel to the light direction.
 
-                if (settings->getMultipleShadowMapHint() == ShadowSettings::PARALLEL_SPLIT && sm_i>0)
-                {
-                    // not the first shadowmap so insert a polytope to clip the scene from before r_start
+                    if (settings->getMultipleShadowMapHint() == ShadowSettings::PARALLEL_SPLIT && sm_i>0)
+                    {
+                        // not the first shadowmap so insert a polytope to clip the scene from before r_start
 
-                    // plane in clip space coords
-                    osg::Plane plane(0.0,1.0,0.0,-r_start);
+                        // plane in clip space coords
+                        osg::Plane plane(0.0,1.0,0.0,-r_start);
 
-                    // transform into eye coords
-                    plane.transformProvidingInverse(projectionMatrix);
-                    local_polytope.getPlaneList().push_back(plane);
+                        // transform into eye coords
+                        plane.transformProvidingInverse(projectionMatrix);
+                        local_polytope.getPlaneList().push_back(plane);
 
-                    //OSG_NOTICE<<"Adding r_start plane "<<plane<<std::endl;
+                        //OSG_NOTICE<<"Adding r_start plane "<<plane<<std::endl;
 
-                }
+                    }
 
-                if (settings->getMultipleShadowMapHint() == ShadowSettings::PARALLEL_SPLIT && sm_i+1<numShadowMapsPerLight)
-                {
-                    // not the last shadowmap so insert a polytope to clip the scene from beyond r_end
+                    if (settings->getMultipleShadowMapHint() == ShadowSettings::PARALLEL_SPLIT && sm_i+1<numShadowMapsPerLight)
+                    {
+                        // not the last shadowmap so insert a polytope to clip the scene from beyond r_end
 
-                    // plane in clip space coords
-                    osg::Plane plane(0.0,-1.0,0.0,r_end);
+                        // plane in clip space coords
+                        osg::Plane plane(0.0,-1.0,0.0,r_end);
 
-                    // transform into eye coords
-                    plane.transformProvidingInverse(projectionMatrix);
-                    local_polytope.getPlaneList().push_back(plane);
+                        // transform into eye coords
+                        plane.transformProvidingInverse(projectionMatrix);
+                        local_polytope.getPlaneList().push_back(plane);
 
-                    //OSG_NOTICE<<"Adding r_end plane "<<plane<<std::endl;
-                }
+                        //OSG_NOTICE<<"Adding r_end plane "<<plane<<std::endl;
+                    }
 
-                local_polytope.setupMask();
+                    local_polytope.setupMask();
 
-                if (settings->getMultipleShadowMapHint() == ShadowSettings::PARALLEL_SPLIT)
-                {
-                    // OSG_NOTICE<<"Need to adjust RTT camera projection and view matrix here, r_start="<<r_start<<", r_end="<<r_end<<std::endl;
-                    // OSG_NOTICE<<"  textureUnit = "<<textureUnit<<std::endl;
+                    if (settings->getMultipleShadowMapHint() == ShadowSettings::PARALLEL_SPLIT)
+                    {
+                        // OSG_NOTICE<<"Need to adjust RTT camera projection and view matrix here, r_start="<<r_start<<", r_end="<<r_end<<std::endl;
+                        // OSG_NOTICE<<"  textureUnit = "<<textureUnit<<std::endl;
 
-                    double mid_r = (r_start + r_end)*0.5;
-                    double range_r = (r_end - r_start);
+                        double mid_r = (r_start + r_end)*0.5;
+                        double range_r = (r_end - r_start);
 
-                    // OSG_NOTICE<<"  mid_r = "<<mid_r<<", range_r = "<<range_r<<std::endl;
+                        // OSG_NOTICE<<"  mid_r = "<<mid_r<<", range_r = "<<range_r<<std::endl;
 
-                    camera->setProjectionMatrix(
-                        camera->getProjectionMatrix() *
-                        osg::Matrixd::translate(osg::Vec3d(0.0,-mid_r,0.0)) *
-                        osg::Matrixd::scale(osg::Vec3d(1.0,2.0/range_r,1.0)));
+                        camera->setProjectionMatrix(
+                            camera->getProjectionMatrix() *
+                            osg::Matrixd::translate(osg::Vec3d(0.0,-mid_r,0.0)) *
+                            osg::Matrixd::scale(osg::Vec3d(1.0,2.0/range_r,1.0)));
                     
+                    }
                 }
-            }
 
-            std::vector<osg::Plane> extraPlanes;
-            if (settings->getMultipleShadowMapHint() == ShadowSettings::CASCADED)
-            {
-                cropShadowCameraToMainFrustum(frustum, camera, cascaseNear, cascadeFar, extraPlanes);
-                for (const auto& plane : extraPlanes)
-                    local_polytope.getPlaneList().push_back(plane);
-                local_polytope.setupMask();
-            }
-            else
-                cropShadowCameraToMainFrustum(frustum, camera, reducedNear, reducedFar, extraPlanes);
+                std::vector<osg::Plane> extraPlanes;
+                if (settings->getMultipleShadowMapHint() == ShadowSettings::CASCADED)
+                {
+                    cropShadowCameraToMainFrustum(frustum, camera, cascaseNear, cascadeFar, extraPlanes);
+                    for (const auto& plane : extraPlanes)
+                        local_polytope.getPlaneList().push_back(plane);
+                    local_polytope.setupMask();
+                }
+                else
+                    cropShadowCameraToMainFrustum(frustum, camera, reducedNear, reducedFar, extraPlanes);
 
-            osg::ref_ptr<VDSMCameraCullCallback> vdsmCallback = new VDSMCameraCullCallback(this, local_polytope);
-            camera->setCullCallback(vdsmCallback.get());
+                vdsmCallback = new VDSMCameraCullCallback(this, local_polytope);
+                camera->setCullCallback(vdsmCallback.get());
 
-            // 4.3 traverse RTT camera
-            //
+                // 4.3 traverse RTT camera
+                //
 
-            cv.pushStateSet(_shadowCastingStateSet.get());
+                cv.pushStateSet(_shadowCastingStateSet.get());
 
-            cullShadowCastingScene(&cv, camera.get());
+                cullShadowCastingScene(&cv, camera.get());
 
-            cv.popStateSet();
+                cv.popStateSet();
+
+                sd->_hasBeenRendered = true;
+            }
 
             if (!orthographicViewFrustum && settings->getShadowMapProjectionHint()==ShadowSettings::PERSPECTIVE_SHADOW_MAP)
             {
@@ -1409,13 +1430,16 @@ void MWShadowTechnique::cull(osgUtil::CullVisitor& cv)
                     validRegionUniform->set(validRegionMatrix);
                 }
 
-                if (settings->getMultipleShadowMapHint() == ShadowSettings::CASCADED)
-                    adjustPerspectiveShadowMapCameraSettings(vdsmCallback->getRenderStage(), frustum, pl, camera.get(), cascaseNear, cascadeFar);
-                else
-                    adjustPerspectiveShadowMapCameraSettings(vdsmCallback->getRenderStage(), frustum, pl, camera.get(), reducedNear, reducedFar);
-                if (vdsmCallback->getProjectionMatrix())
+                if (updateCascade)
                 {
-                    vdsmCallback->getProjectionMatrix()->set(camera->getProjectionMatrix());
+                    if (settings->getMultipleShadowMapHint() == ShadowSettings::CASCADED)
+                        adjustPerspectiveShadowMapCameraSettings(vdsmCallback->getRenderStage(), frustum, pl, camera.get(), cascaseNear, cascadeFar);
+                    else
+                        adjustPerspectiveShadowMapCameraSettings(vdsmCallback->getRenderStage(), frustum, pl, camera.get(), reducedNear, reducedFar);
+                    if (vdsmCallback->getProjectionMatrix())
+                    {
+                        vdsmCallback->getProjectionMatrix()->set(camera->getProjectionMatrix());
+                    }
                 }
             }
 
@@ -81,6 +81,10 @@ namespace SceneUtil {
 
         virtual void setShadowFadeStart(float shadowFadeStart);
 
+        /** Refresh each distant cascade only every @p period frames, in round robin, instead of
+         *  re-culling and re-drawing all of them each frame. 1 means update every frame. */
+        virtual void setDistantCascadeUpdatePeriod(unsigned int period);
+
         virtual void enableFrontFaceCulling();
 
         virtual void disableFrontFaceCulling();
@@ -173,6 +177,8 @@ namespace SceneUtil {
             ViewDependentData*                  _viewDependentData;
 
             unsigned int                        _textureUnit;
+            // whether _texture holds a rendered map that a skipped refresh may keep displaying
+            bool                                _hasBeenRendered;
             osg::ref_ptr<osg::Texture2D>        _texture;
             osg::ref_ptr<osg::TexGen>           _texgen;
             osg::ref_ptr<osg::Camera>           _camera;
@@ -266,6 +272,8 @@ namespace SceneUtil {
 
         float                                   _shadowFadeStart = 0.0;
 
+        unsigned int                            _distantCascadeUpdatePeriod = 1;
+
         class DebugHUD final : public osg::Referenced
         {
         public:
@@ -76,7 +76,7 @@ void Optimizer::optimize(osg::Node* node, unsigned int options)
             node->accept(fstv);
             result = fstv.removeTransforms(node);
             ++i;
-        } while (result);
+        } while (result && !isAborted());
 
         // now combine any adjacent static transforms.
         CombineStaticTransformsVisitor cstv(this);
@@ -84,6 +84,8 @@ void Optimizer::optimize(osg::Node* node, unsigned int options)
         cstv.removeTransforms(node);
     }
 
+    if (isAborted()) return;
+
     if (options & REMOVE_REDUNDANT_NODES)
     {
         OSG_INFO<<"Optimizer::optimize() doing REMOVE_REDUNDANT_NODES"<<std::endl;
@@ -100,6 +102,8 @@ void Optimizer::optimize(osg::Node* node, unsigned int options)
         node->accept(mgrp);
     }
 
+    if (isAborted()) return;
+
     if (options & MERGE_GEOMETRY)
     {
         OSG_INFO<<"Optimizer::optimize() doing MERGE_GEOMETRY"<<std::endl;
@@ -117,6 +121,8 @@ void Optimizer::optimize(osg::Node* node, unsigned int options)
         OSG_INFO<<"MERGE_GEOMETRY took "<<osg::Timer::instance()->delta_s(startTick,endTick)<<std::endl;
     }
 
+    if (isAborted()) return;
+
     if (options & VERTEX_POSTTRANSFORM)
     {
         OSG_INFO<<"Optimizer::optimize() doing VERTEX_POSTTRANSFORM"<<std::endl;
@@ -1135,6 +1141,10 @@ void Optimizer::MergeGeometryVisitor::checkAlphaBlendingActive()
 
 void Optimizer::MergeGeometryVisitor::apply(osg::Group &group)
 {
+    // the merge pass dominates the optimizer's run time, so poll the abort flag per group
+    if (_optimizer && _optimizer->isAborted())
+        return;
+
     if (group.getStateSet())
         pushStateSet(group.getStateSet());
 
@@ -24,6 +24,7 @@
 
 //#include <osgUtil/Export>
 
+#include <atomic>
 #include <set>
 
 //namespace osgUtil {
@@ -65,7 +66,7 @@ class Optimizer
 
     public:
 
-        Optimizer() : _mergeAlphaBlending(false) {}
+        Optimizer() : _mergeAlphaBlending(false), _abortFlag(nullptr) {}
         virtual ~Optimizer() {}
 
         enum OptimizationOptions
@@ -121,6 +122,15 @@ class Optimizer
         void setMergeAlphaBlending(bool merge) { _mergeAlphaBlending = merge; }
         void setViewPoint(const osg::Vec3f& viewPoint) { _viewPoint = viewPoint; }
 
+        /** Set an optional flag polled between optimization passes and within the more
+          * expensive visitors. Once the flag becomes true, optimize() returns as soon as
+          * possible, leaving the graph valid but only partially optimized. Intended for
+          * background optimization of content that may become obsolete while being built,
+          * e.g. object paging chunks the player has already moved away from.
+          * The caller must keep the flag alive for the duration of optimize(). */
+        void setAbortFlag(const std::atomic<bool>* abortFlag) { _abortFlag = abortFlag; }
+        bool isAborted() const { return _abortFlag && *_abortFlag; }
+
         /** Reset internal data to initial state - the getPermissibleOptionsMap is cleared.*/
         void reset();
 
@@ -257,6 +267,7 @@ class Optimizer
 
         osg::Vec3f _viewPoint;
         bool _mergeAlphaBlending;
+        const std::atomic<bool>* _abortFlag;
 
     public:
 
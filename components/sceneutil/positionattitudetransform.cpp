@@ -8,13 +8,29 @@ PositionAttitudeTransform::PositionAttitudeTransform():
 {
 }
 
+void PositionAttitudeTransform::localMatrixChanged()
+{
+    _translationOnly = _attitude == osg::Quat() && _scale == osg::Vec3f(1.f,1.f,1.f);
+    // Composed right here instead of lazily during traversal: several threads
+    // can traverse the node at once (parallel cull threads, the background
+    // sound update), so the traversal paths have to stay read-only. Setters
+    // only run in the update phase, where exclusive access is guaranteed.
+    if (!_translationOnly)
+    {
+        _rotationScaleMatrix.makeRotate(_attitude);
+        _rotationScaleMatrix.preMultScale(_scale);
+    }
+}
+
 bool PositionAttitudeTransform::computeLocalToWorldMatrix(osg::Matrix& matrix, osg::NodeVisitor*) const
 {
     if (_referenceFrame==RELATIVE_RF)
     {
         matrix.preMultTranslate(_position);
-        matrix.preMultRotate(_attitude);
-        matrix.preMultScale(_scale);
+        if (_translationOnly)
+            return true;
+
+        matrix.preMult(_rotationScaleMatrix);
     }
     else // absolute
     {
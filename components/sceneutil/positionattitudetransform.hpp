@@ -17,7 +17,9 @@ class PositionAttitudeTransform : public osg::Transform
             Transform(pat,copyop),
             _position(pat._position),
             _attitude(pat._attitude),
-            _scale(pat._scale){}
+            _scale(pat._scale),
+            _rotationScaleMatrix(pat._rotationScaleMatrix),
+            _translationOnly(pat._translationOnly){}
 
 
         META_Node(SceneUtil, PositionAttitudeTransform)
@@ -25,10 +27,10 @@ class PositionAttitudeTransform : public osg::Transform
         inline void setPosition(const osg::Vec3f& pos) { _position = pos; dirtyBound(); }
         inline const osg::Vec3f& getPosition() const { return _position; }
 
-        inline void setAttitude(const osg::Quat& quat) { _attitude = quat; dirtyBound(); }
+        inline void setAttitude(const osg::Quat& quat) { _attitude = quat; localMatrixChanged(); dirtyBound(); }
         inline const osg::Quat& getAttitude() const { return _attitude; }
 
-        inline void setScale(const osg::Vec3f& scale) { _scale = scale; dirtyBound(); }
+        inline void setScale(const osg::Vec3f& scale) { _scale = scale; localMatrixChanged(); dirtyBound(); }
         inline const osg::Vec3f& getScale() const { return _scale; }
 
         bool computeLocalToWorldMatrix(osg::Matrix& matrix,osg::NodeVisitor* nv) const override;
@@ -38,9 +40,22 @@ class PositionAttitudeTransform : public osg::Transform
     protected :
         virtual ~PositionAttitudeTransform() {}
 
+        void localMatrixChanged();
+
         osg::Vec3f _position;
         osg::Quat _attitude;
         osg::Vec3f _scale;
+
+        // The rotation/scale part of the local matrix, composed in setAttitude/setScale
+        // and reused by every traversal. Not recomputed by setPosition, so nodes that
+        // only move (actors) still benefit across the cull/shadow traversals of a frame.
+        // Composing in the setters rather than lazily on first use keeps the traversal
+        // paths read-only, which concurrent traversals rely on.
+        osg::Matrix _rotationScaleMatrix;
+
+        // True while the attitude is identity and the scale is 1, i.e. for the majority of
+        // statics, which then take a translate-only path with no matrix composition at all.
+        bool _translationOnly = true;
 };
 
 }
@@ -7,6 +7,13 @@
 #include "skeleton.hpp"
 #include "util.hpp"
 
+// SSE2 is part of the x86-64 baseline, so no runtime dispatch is needed there;
+// other architectures take the scalar path below.
+#if defined(__SSE2__) || (defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+#define OPENMW_SKINNING_SSE2 1
+#include <emmintrin.h>
+#endif
+
 namespace
 {
     inline void accumulateMatrix(const osg::Matrixf& invBindMatrix, const osg::Matrixf& matrix, const float weight, osg::Matrixf& result)
@@ -30,6 +37,64 @@ namespace
         ptrresult[13] += ptr[13] * weight;
         ptrresult[14] += ptr[14] * weight;
     }
+
+    /// Apply the accumulated skinning matrix to every vertex of one influence
+    /// group. The matrix rows are loaded once per group; each vertex is then
+    /// three fused multiply-adds instead of nine scalar multiplies.
+    void skinVertices(const osg::Matrixf& matrix, const std::vector<unsigned short>& vertices,
+                      const osg::Vec3Array* positionSrc, osg::Vec3Array* positionDst,
+                      const osg::Vec3Array* normalSrc, osg::Vec3Array* normalDst,
+                      const osg::Vec4Array* tangentSrc, osg::Vec4Array* tangentDst)
+    {
+#ifdef OPENMW_SKINNING_SSE2
+        const float* m = matrix.ptr();
+        const __m128 row0 = _mm_loadu_ps(m);
+        const __m128 row1 = _mm_loadu_ps(m + 4);
+        const __m128 row2 = _mm_loadu_ps(m + 8);
+        const __m128 row3 = _mm_loadu_ps(m + 12);
+
+        // The arrays hold packed Vec3s, so store exactly 12 bytes to avoid
+        // stomping the x component of the following vertex.
+        const auto storeVec3 = [] (const __m128 value, float* out)
+        {
+            _mm_storel_pi(reinterpret_cast<__m64*>(out), value);
+            _mm_store_ss(out + 2, _mm_movehl_ps(value, value));
+        };
+
+        const auto transform3 = [&] (const float* in)
+        {
+            __m128 result = _mm_mul_ps(_mm_set1_ps(in[0]), row0);
+            result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(in[1]), row1));
+            return _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(in[2]), row2));
+        };
+
+        for (unsigned short vertex : vertices)
+        {
+            storeVec3(_mm_add_ps(transform3((*positionSrc)[vertex].ptr()), row3), (*positionDst)[vertex].ptr());
+            if (normalDst)
+                storeVec3(transform3((*normalSrc)[vertex].ptr()), (*normalDst)[vertex].ptr());
+            if (tangentDst)
+            {
+                const osg::Vec4f& srcTangent = (*tangentSrc)[vertex];
+                storeVec3(transform3(srcTangent.ptr()), (*tangentDst)[vertex].ptr());
+                (*tangentDst)[vertex].w() = srcTangent.w();
+            }
+        }
+#else
+        for (unsigned short vertex : vertices)
+        {
+            (*positionDst)[vertex] = matrix.preMult((*positionSrc)[vertex]);
+            if (normalDst)
+                (*normalDst)[vertex] = osg::Matrixf::transform3x3((*normalSrc)[vertex], matrix);
+            if (tangentDst)
+            {
+                const osg::Vec4f& srcTangent = (*tangentSrc)[vertex];
+                osg::Vec3f transformedTangent = osg::Matrixf::transform3x3(osg::Vec3f(srcTangent.x(), srcTangent.y(), srcTangent.z()), matrix);
+                (*tangentDst)[vertex] = osg::Vec4f(transformedTangent, srcTangent.w());
+            }
+        }
+#endif
+    }
 }
 
 namespace SceneUtil
@@ -225,19 +290,7 @@ void RigGeometry::cull(osg::NodeVisitor* nv)
         if (mGeomToSkelMatrix)
             resultMat *= (*mGeomToSkelMatrix);
 
-        for (auto &vertex : pair.second)
-        {
-            (*positionDst)[vertex] = resultMat.preMult((*positionSrc)[vertex]);
-            if (normalDst)
-                (*normalDst)[vertex] = osg::Matrixf::transform3x3((*normalSrc)[vertex], resultMat);
-
-            if (tangentDst)
-            {
-                const osg::Vec4f& srcTangent = (*tangentSrc)[vertex];
-                osg::Vec3f transformedTangent = osg::Matrixf::transform3x3(osg::Vec3f(srcTangent.x(), srcTangent.y(), srcTangent.z()), resultMat);
-                (*tangentDst)[vertex] = osg::Vec4f(transformedTangent, srcTangent.w());
-            }
-        }
+        skinVertices(resultMat, pair.second, positionSrc, positionDst, normalSrc, normalDst, tangentSrc, tangentDst);
     }
 
     positionDst->dirty();
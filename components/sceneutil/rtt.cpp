@@ -42,8 +42,12 @@ namespace SceneUtil
     void RTTNode::cull(osgUtil::CullVisitor* cv)
     {
         auto* vdd = getViewDependentData(cv);
+        if (vdd->mHasBeenRendered && !shouldUpdate(cv))
+            // Skip the camera traversal, keeping the previous contents of the texture
+            return;
         apply(vdd->mCamera);
         vdd->mCamera->accept(*cv);
+        vdd->mHasBeenRendered = true;
     }
 
     osg::Texture* RTTNode::getColorTexture(osgUtil::CullVisitor* cv)
@@ -47,12 +47,17 @@ namespace SceneUtil
         /// Set default settings - optionally override in derived classes
         virtual void apply(osg::Camera* camera) {};
 
+        /// Decide whether the texture needs to be re-rendered this frame - optionally override in derived classes.
+        /// Returning false keeps the result of the previous update. Only called once the texture has been rendered at least once.
+        virtual bool shouldUpdate(osgUtil::CullVisitor* cv) { return true; }
+
         void cull(osgUtil::CullVisitor* cv);
 
     private:
         struct ViewDependentData
         {
             osg::ref_ptr<osg::Camera> mCamera;
+            bool mHasBeenRendered = false;
         };
 
         ViewDependentData* getViewDependentData(osgUtil::CullVisitor* cv);
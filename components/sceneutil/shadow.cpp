@@ -52,6 +52,8 @@ namespace SceneUtil
         mShadowTechnique->setSplitPointUniformLogarithmicRatio(Settings::Manager::getFloat("split point uniform logarithmic ratio", "Shadows"));
         mShadowTechnique->setSplitPointDeltaBias(Settings::Manager::getFloat("split point bias", "Shadows"));
 
+        mShadowTechnique->setDistantCascadeUpdatePeriod(std::max(1, Settings::Manager::getInt("distant cascade update period", "Shadows")));
+
         mShadowTechnique->setPolygonOffset(Settings::Manager::getFloat("polygon offset factor", "Shadows"), Settings::Manager::getFloat("polygon offset units", "Shadows"));
 
         if (Settings::Manager::getBool("use front face culling", "Shadows"))
@@ -46,6 +46,9 @@ std::array<osg::ref_ptr<osg::Program>, GL_ALWAYS - GL_NEVER + 1> ShadowsBin::sCa
     nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr
 };
 
+std::atomic<std::size_t> ShadowsBin::sCastingLeaves{0};
+std::atomic<std::size_t> ShadowsBin::sPrunedLeaves{0};
+
 ShadowsBin::ShadowsBin()
 {
     mNoTestStateSet = new osg::StateSet;
@@ -116,7 +119,12 @@ StateGraph* ShadowsBin::cullStateGraph(StateGraph* sg, StateGraph* root, std::un
     }
 
     if (!state.needShadows())
+    {
+        sPrunedLeaves += sg->_leaves.size();
         return nullptr;
+    }
+
+    sCastingLeaves += sg->_leaves.size();
 
     if (!state.needTexture() && !state.mImportantState)
     {
@@ -1,6 +1,8 @@
 #ifndef OPENMW_COMPONENTS_SCENEUTIL_SHADOWBIN_H
 #define OPENMW_COMPONENTS_SCENEUTIL_SHADOWBIN_H
 #include <array>
+#include <atomic>
+#include <cstddef>
 #include <unordered_set>
 #include <osgUtil/RenderBin>
 
@@ -66,6 +68,15 @@ namespace SceneUtil
         osgUtil::StateGraph* cullStateGraph(osgUtil::StateGraph* sg, osgUtil::StateGraph* root, std::unordered_set<osgUtil::StateGraph*>& uninteresting, bool cullFaceOverridden);
 
         static void addPrototype(const std::string& name, const std::array<osg::ref_ptr<osg::Program>, GL_ALWAYS - GL_NEVER + 1>& castingPrograms);
+
+        /// Render leaves kept as shadow casters since the last call, summed over all shadow maps. For the stats HUD.
+        static std::size_t takeCastingLeaves() { return sCastingLeaves.exchange(0); }
+        /// Render leaves discarded as non-casting since the last call, summed over all shadow maps. For the stats HUD.
+        static std::size_t takePrunedLeaves() { return sPrunedLeaves.exchange(0); }
+
+    private:
+        static std::atomic<std::size_t> sCastingLeaves;
+        static std::atomic<std::size_t> sPrunedLeaves;
     };
 
     class ShadowsBinAdder
@@ -38,6 +38,7 @@ Skeleton::Skeleton()
     , mActive(Active)
     , mLastFrameNumber(0)
     , mLastCullFrameNumber(0)
+    , mWasVisible(false)
 {
 
 }
@@ -49,6 +50,7 @@ Skeleton::Skeleton(const Skeleton &copy, const osg::CopyOp &copyop)
     , mActive(copy.mActive)
     , mLastFrameNumber(0)
     , mLastCullFrameNumber(0)
+    , mWasVisible(false)
 {
 
 }
@@ -117,7 +119,7 @@ void Skeleton::updateBoneMatrices(unsigned int traversalNumber)
         if (mRootBone.get())
         {
             for (unsigned int i=0; i<mRootBone->mChildren.size(); ++i)
-                mRootBone->mChildren[i]->update(nullptr);
+                mRootBone->mChildren[i]->update(nullptr, false);
         }
 
         mNeedToUpdateBoneMatrices = false;
@@ -145,9 +147,10 @@ void Skeleton::traverse(osg::NodeVisitor& nv)
 {
     if (nv.getVisitorType() == osg::NodeVisitor::UPDATE_VISITOR)
     {
+        mWasVisible = mLastCullFrameNumber+3 > nv.getTraversalNumber();
         if (mActive == Inactive && mLastFrameNumber != 0)
             return;
-        if (mActive == SemiActive && mLastFrameNumber != 0 && mLastCullFrameNumber+3 <= nv.getTraversalNumber())
+        if (mActive == SemiActive && mLastFrameNumber != 0 && !mWasVisible)
             return;
     }
     else if (nv.getVisitorType() == osg::NodeVisitor::CULL_VISITOR)
@@ -168,6 +171,7 @@ void Skeleton::childRemoved(unsigned int, unsigned int)
 
 Bone::Bone()
     : mNode(nullptr)
+    , mLastLocalMatrixValid(false)
 {
 }
 
@@ -178,21 +182,36 @@ Bone::~Bone()
     mChildren.clear();
 }
 
-void Bone::update(const osg::Matrixf* parentMatrixInSkeletonSpace)
+void Bone::update(const osg::Matrixf* parentMatrixInSkeletonSpace, bool parentChanged)
 {
     if (!mNode)
     {
         Log(Debug::Error) << "Error: Bone without node";
         return;
     }
-    if (parentMatrixInSkeletonSpace)
-        mMatrixInSkeletonSpace = mNode->getMatrix() * (*parentMatrixInSkeletonSpace);
-    else
-        mMatrixInSkeletonSpace = mNode->getMatrix();
+
+    // Comparing the local matrix is much cheaper than the multiply below, and controllers
+    // driving only part of the body leave the rest of the bones bit-identical between frames.
+    const osg::Matrixf& localMatrix = mNode->getMatrix();
+    const bool localChanged = !mLastLocalMatrixValid || localMatrix != mLastLocalMatrix;
+    if (localChanged)
+    {
+        mLastLocalMatrix = localMatrix;
+        mLastLocalMatrixValid = true;
+    }
+
+    const bool changed = parentChanged || localChanged;
+    if (changed)
+    {
+        if (parentMatrixInSkeletonSpace)
+            mMatrixInSkeletonSpace = localMatrix * (*parentMatrixInSkeletonSpace);
+        else
+            mMatrixInSkeletonSpace = localMatrix;
+    }
 
     for (unsigned int i=0; i<mChildren.size(); ++i)
     {
-        mChildren[i]->update(&mMatrixInSkeletonSpace);
+        mChildren[i]->update(&mMatrixInSkeletonSpace, changed);
     }
 }
 
@@ -23,9 +23,17 @@ namespace SceneUtil
         std::vector<Bone*> mChildren;
 
         /// Update the skeleton-space matrix of this bone and all its children.
-        void update(const osg::Matrixf* parentMatrixInSkeletonSpace);
+        /// A bone whose local matrix did not change since the last update and whose ancestors
+        /// were not recomputed keeps its cached skeleton-space matrix, so partial-body
+        /// animations only pay the matrix multiplies for the chains they actually moved.
+        /// @param parentChanged whether an ancestor's skeleton-space matrix was recomputed
+        void update(const osg::Matrixf* parentMatrixInSkeletonSpace, bool parentChanged);
 
     private:
+        /// Local matrix as of the last update, to detect bones the controllers did not touch.
+        osg::Matrixf mLastLocalMatrix;
+        bool mLastLocalMatrixValid;
+
         Bone(const Bone&);
         void operator=(const Bone&);
     };
@@ -60,6 +68,10 @@ namespace SceneUtil
 
         bool getActive() const;
 
+        /// @return Whether the skeleton was visited by a cull traversal within the last few frames.
+        /// Only valid for skeletons that receive update traversals, i.e. with a non-zero node mask.
+        bool wasVisible() const { return mWasVisible; }
+
         void traverse(osg::NodeVisitor& nv) override;
 
         void markDirty();
@@ -82,6 +94,7 @@ namespace SceneUtil
 
         unsigned int mLastFrameNumber;
         unsigned int mLastCullFrameNumber;
+        bool mWasVisible;
     };
 
 }
@@ -1,17 +1,46 @@
 #include "unrefqueue.hpp"
 
-//#include <osg/Timer>
-
-//#include <components/debug/debuglog.hpp>
+#include <osg/Timer>
 
 namespace SceneUtil
 {
+    namespace
+    {
+        // Maximum time one work item spends destroying objects before handing the
+        // remainder back to the queue.
+        constexpr double sSliceSeconds = 0.002;
+    }
+
     void UnrefWorkItem::doWork()
     {
-        mObjects.clear();
+        const osg::Timer* timer = osg::Timer::instance();
+        const osg::Timer_t start = timer->tick();
+        std::uint64_t released = 0;
+        while (!mObjects.empty())
+        {
+            mObjects.pop_front();
+            ++released;
+            if (timer->delta_s(start, timer->tick()) >= sSliceSeconds)
+                break;
+        }
+        if (mReleased)
+            *mReleased += released;
+
+        if (!mObjects.empty() && mWorkQueue)
+        {
+            // Continue in a fresh item at the back of the queue, so preload tasks
+            // and other queued work get a chance to run in between.
+            osg::ref_ptr<UnrefWorkItem> continuation (new UnrefWorkItem);
+            continuation->mObjects.swap(mObjects);
+            continuation->mWorkQueue = mWorkQueue;
+            continuation->mReleased = mReleased;
+            mWorkQueue->addWorkItem(continuation);
+        }
+        mWorkQueue = nullptr;
     }
 
     UnrefQueue::UnrefQueue()
+        : mTotalReleased(std::make_shared<std::atomic<std::uint64_t> >(0))
     {
         mWorkItem = new UnrefWorkItem;
     }
@@ -26,6 +55,8 @@ namespace SceneUtil
         if (mWorkItem->mObjects.empty())
             return;
 
+        mWorkItem->mWorkQueue = workQueue;
+        mWorkItem->mReleased = mTotalReleased;
         workQueue->addWorkItem(mWorkItem, true);
 
         mWorkItem = new UnrefWorkItem;
@@ -36,4 +67,9 @@ namespace SceneUtil
         return mWorkItem->mObjects.size();
     }
 
+    std::uint64_t UnrefQueue::getTotalReleased() const
+    {
+        return *mTotalReleased;
+    }
+
 }
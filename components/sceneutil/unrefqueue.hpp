@@ -1,7 +1,10 @@
 #ifndef OPENMW_COMPONENTS_UNREFQUEUE_H
 #define OPENMW_COMPONENTS_UNREFQUEUE_H
 
+#include <atomic>
+#include <cstdint>
 #include <deque>
+#include <memory>
 
 #include <osg/ref_ptr>
 #include <osg/Referenced>
@@ -11,16 +14,21 @@
 namespace SceneUtil
 {
     class WorkQueue;
-    
+
     class UnrefWorkItem : public SceneUtil::WorkItem
     {
     public:
         std::deque<osg::ref_ptr<const osg::Referenced> > mObjects;
+        osg::ref_ptr<SceneUtil::WorkQueue> mWorkQueue;
+        std::shared_ptr<std::atomic<std::uint64_t> > mReleased;
         void doWork() override;
     };
 
     /// @brief Handles unreferencing of objects through the WorkQueue. Typical use scenario
     /// would be the main thread pushing objects that are no longer needed, and the background thread deleting them.
+    /// @par Objects are destroyed in time-limited slices: when a slice runs out, the remainder is
+    /// re-queued at the back of the work queue, so the destructor storm after a cell transition does
+    /// not block other work items (e.g. preloading) for its whole duration.
     class UnrefQueue : public osg::Referenced
     {
     public:
@@ -35,8 +43,12 @@ namespace SceneUtil
 
         unsigned int getNumItems() const;
 
+        /// Total number of objects released by flushed work items so far.
+        std::uint64_t getTotalReleased() const;
+
     private:
         osg::ref_ptr<UnrefWorkItem> mWorkItem;
+        std::shared_ptr<std::atomic<std::uint64_t> > mTotalReleased;
     };
 
 }
@@ -2,6 +2,7 @@
 
 #include <components/debug/debuglog.hpp>
 
+#include <algorithm>
 #include <numeric>
 
 namespace SceneUtil
@@ -50,24 +51,43 @@ void WorkQueue::start(std::size_t workerThreads)
         const std::lock_guard lock(mMutex);
         mIsReleased = false;
     }
+    // Create all deques before the first thread starts iterating over them.
+    while (mThreadQueues.size() < workerThreads)
+        mThreadQueues.emplace_back(std::make_unique<ThreadQueue>());
     while (mThreads.size() < workerThreads)
-        mThreads.emplace_back(std::make_unique<WorkThread>(*this));
+        mThreads.emplace_back(std::make_unique<WorkThread>(*this, mThreads.size()));
 }
 
 void WorkQueue::stop()
 {
+    {
+        const std::lock_guard lock(mPendingMutex);
+        mPending.clear();
+    }
+    for (const std::unique_ptr<ThreadQueue>& queue : mThreadQueues)
+    {
+        const std::lock_guard lock(queue->mMutex);
+        queue->mDeque.clear();
+    }
+    // No queued item survives the clearing above, so the runnable count has to go
+    // back to zero as well or a restarted queue would spin its idle workers.
+    mRunnableCount = 0;
     {
         std::unique_lock<std::mutex> lock(mMutex);
-        while (!mQueue.empty())
-            mQueue.pop_back();
         mIsReleased = true;
         mCondition.notify_all();
     }
 
     mThreads.clear();
+    mThreadQueues.clear();
 }
 
 void WorkQueue::addWorkItem(osg::ref_ptr<WorkItem> item, bool front)
+{
+    addWorkItem(std::move(item), front ? 1 : 0, {});
+}
+
+void WorkQueue::addWorkItem(osg::ref_ptr<WorkItem> item, int priority, std::vector<osg::ref_ptr<WorkItem>> dependencies)
 {
     if (item->isDone())
     {
@@ -75,34 +95,111 @@ void WorkQueue::addWorkItem(osg::ref_ptr<WorkItem> item, bool front)
         return;
     }
 
-    std::unique_lock<std::mutex> lock(mMutex);
-    if (front)
-        mQueue.push_front(std::move(item));
-    else
-        mQueue.push_back(std::move(item));
-    mCondition.notify_one();
+    dependencies.erase(std::remove_if(dependencies.begin(), dependencies.end(),
+        [] (const osg::ref_ptr<WorkItem>& v) { return v == nullptr || v->isDone(); }), dependencies.end());
+
+    if (!dependencies.empty())
+    {
+        {
+            const std::lock_guard lock(mPendingMutex);
+            mPending.push_back(PendingEntry {Entry {priority, std::move(item)}, std::move(dependencies)});
+        }
+        // The last dependency may have completed between the check above and the insert,
+        // and workers only rescan the pending list before they go to sleep. Re-check
+        // after publishing the entry so it cannot be stranded until an unrelated item
+        // arrives; if the dependencies complete later, the completing worker flushes.
+        flushPending();
+        return;
+    }
+
+    schedule(Entry {priority, std::move(item)});
 }
 
-osg::ref_ptr<WorkItem> WorkQueue::removeWorkItem()
+void WorkQueue::schedule(Entry&& entry)
 {
-    std::unique_lock<std::mutex> lock(mMutex);
-    while (mQueue.empty() && !mIsReleased)
+    if (mThreadQueues.empty())
     {
-        mCondition.wait(lock);
+        Log(Debug::Error) << "Error: can't add a work item, no worker threads";
+        return;
+    }
+
+    ThreadQueue& queue = *mThreadQueues[mNextThreadQueue++ % mThreadQueues.size()];
+    ++mRunnableCount;
+    {
+        const std::lock_guard lock(queue.mMutex);
+        // Keep the deque sorted by priority, first come first served within the same priority.
+        const auto position = std::find_if(queue.mDeque.begin(), queue.mDeque.end(),
+            [&] (const Entry& v) { return v.mPriority < entry.mPriority; });
+        queue.mDeque.insert(position, std::move(entry));
+    }
+    {
+        const std::lock_guard lock(mMutex);
+        mCondition.notify_one();
+    }
+}
+
+void WorkQueue::flushPending()
+{
+    std::vector<Entry> ready;
+    {
+        const std::lock_guard lock(mPendingMutex);
+        const auto isReady = [] (const PendingEntry& v)
+        {
+            return std::all_of(v.mDependencies.begin(), v.mDependencies.end(),
+                [] (const osg::ref_ptr<WorkItem>& dependency) { return dependency->isDone(); });
+        };
+        for (PendingEntry& pending : mPending)
+            if (isReady(pending))
+                ready.push_back(std::move(pending.mEntry));
+        mPending.erase(std::remove_if(mPending.begin(), mPending.end(),
+            [] (const PendingEntry& v) { return v.mEntry.mItem == nullptr; }), mPending.end());
     }
-    if (!mQueue.empty())
+    for (Entry& entry : ready)
+        schedule(std::move(entry));
+}
+
+osg::ref_ptr<WorkItem> WorkQueue::removeWorkItem(std::size_t threadIndex)
+{
+    while (true)
     {
-        osg::ref_ptr<WorkItem> item = std::move(mQueue.front());
-        mQueue.pop_front();
-        return item;
+        flushPending();
+
+        // Take the highest priority item from the front of the own deque first,
+        // steal the lowest priority item from the back of another deque otherwise.
+        for (std::size_t i = 0; i < mThreadQueues.size(); ++i)
+        {
+            ThreadQueue& queue = *mThreadQueues[(threadIndex + i) % mThreadQueues.size()];
+            const std::lock_guard lock(queue.mMutex);
+            if (queue.mDeque.empty())
+                continue;
+            osg::ref_ptr<WorkItem> item = i == 0
+                ? std::move(queue.mDeque.front().mItem)
+                : std::move(queue.mDeque.back().mItem);
+            if (i == 0)
+                queue.mDeque.pop_front();
+            else
+                queue.mDeque.pop_back();
+            --mRunnableCount;
+            return item;
+        }
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        if (mIsReleased)
+            return nullptr;
+        mCondition.wait(lock, [&] { return mIsReleased || mRunnableCount > 0; });
     }
-    return nullptr;
 }
 
 unsigned int WorkQueue::getNumItems() const
 {
-    std::unique_lock<std::mutex> lock(mMutex);
-    return mQueue.size();
+    unsigned int result = 0;
+    for (const std::unique_ptr<ThreadQueue>& queue : mThreadQueues)
+    {
+        const std::lock_guard lock(queue->mMutex);
+        result += queue->mDeque.size();
+    }
+    const std::lock_guard lock(mPendingMutex);
+    return result + mPending.size();
 }
 
 unsigned int WorkQueue::getNumActiveThreads() const
@@ -111,8 +208,9 @@ unsigned int WorkQueue::getNumActiveThreads() const
         [] (auto r, const auto& t) { return r + t->isActive(); });
 }
 
-WorkThread::WorkThread(WorkQueue& workQueue)
+WorkThread::WorkThread(WorkQueue& workQueue, std::size_t index)
     : mWorkQueue(&workQueue)
+    , mIndex(index)
     , mActive(false)
     , mThread([this] { run(); })
 {
@@ -127,7 +225,7 @@ void WorkThread::run()
 {
     while (true)
     {
-        osg::ref_ptr<WorkItem> item = mWorkQueue->removeWorkItem();
+        osg::ref_ptr<WorkItem> item = mWorkQueue->removeWorkItem(mIndex);
         if (!item)
             return;
         mActive = true;
@@ -9,6 +9,7 @@
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <vector>
 
 namespace SceneUtil
 {
@@ -39,8 +40,10 @@ namespace SceneUtil
     class WorkThread;
 
     /// @brief A work queue that users can push work items onto, to be completed by one or more background threads.
-    /// @note Work items will be processed in the order that they were given in, however
-    /// if multiple work threads are involved then it is possible for a later item to complete before earlier items.
+    /// @par Each worker thread owns a deque; producers distribute items round robin and idle workers steal from
+    /// the back of other deques, so a burst of items does not convoy every thread on a single lock.
+    /// @note Items of equal priority are started in the order that they were given in, however if multiple work
+    /// threads are involved then it is possible for a later item to complete before earlier items.
     class WorkQueue : public osg::Referenced
     {
     public:
@@ -56,19 +59,54 @@ namespace SceneUtil
         /// @param front If true, add item to the front of the queue. If false (default), add to the back.
         void addWorkItem(osg::ref_ptr<WorkItem> item, bool front=false);
 
-        /// Get the next work item from the front of the queue. If the queue is empty, waits until a new item is added.
+        /// Add a new work item with an explicit priority; items with larger values start first.
+        /// @param dependencies The item is held back until every listed item has completed.
+        void addWorkItem(osg::ref_ptr<WorkItem> item, int priority, std::vector<osg::ref_ptr<WorkItem>> dependencies);
+
+        /// Get the next work item for the given worker, stealing from other workers when its own deque is empty.
+        /// If no work is available, waits until a new item is added.
         /// If the workqueue is in the process of being destroyed, may return nullptr.
         /// @par Used internally by the WorkThread.
-        osg::ref_ptr<WorkItem> removeWorkItem();
+        osg::ref_ptr<WorkItem> removeWorkItem(std::size_t threadIndex);
 
         unsigned int getNumItems() const;
 
         unsigned int getNumActiveThreads() const;
 
     private:
+        struct Entry
+        {
+            int mPriority;
+            osg::ref_ptr<WorkItem> mItem;
+        };
+
+        /// Owned by one worker thread; other threads only touch it to submit or steal.
+        struct ThreadQueue
+        {
+            mutable std::mutex mMutex;
+            std::deque<Entry> mDeque;
+        };
+
+        struct PendingEntry
+        {
+            Entry mEntry;
+            std::vector<osg::ref_ptr<WorkItem>> mDependencies;
+        };
+
+        void schedule(Entry&& entry);
+
+        /// Move pending entries whose dependencies have all completed into the worker deques.
+        void flushPending();
+
         bool mIsReleased;
-        std::deque<osg::ref_ptr<WorkItem> > mQueue;
+        std::atomic<unsigned int> mRunnableCount {0};
+        std::atomic<unsigned int> mNextThreadQueue {0};
+        std::vector<std::unique_ptr<ThreadQueue>> mThreadQueues;
+
+        std::vector<PendingEntry> mPending;
+        mutable std::mutex mPendingMutex;
 
+        // Guards mIsReleased and sleeping workers; items themselves live in the per-thread deques.
         mutable std::mutex mMutex;
         std::condition_variable mCondition;
 
@@ -79,7 +117,7 @@ namespace SceneUtil
     class WorkThread
     {
     public:
-        WorkThread(WorkQueue& workQueue);
+        WorkThread(WorkQueue& workQueue, std::size_t index);
 
         ~WorkThread();
 
@@ -87,6 +125,7 @@ namespace SceneUtil
 
     private:
         WorkQueue* mWorkQueue;
+        std::size_t mIndex;
         std::atomic<bool> mActive;
         std::thread mThread;
 
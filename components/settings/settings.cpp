@@ -1,13 +1,80 @@
 #include "settings.hpp"
 #include "parser.hpp"
 
+#include <algorithm>
+#include <mutex>
 #include <sstream>
+#include <vector>
 
 #include <components/misc/stringops.hpp>
 
+namespace
+{
+    // Registry of live CachedSetting handles, keyed like the value maps.
+    // Function-local statics so handles constructed during static
+    // initialization do not race the registry's own construction.
+    std::mutex& handlesMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    std::map<Settings::CategorySetting, std::vector<Settings::CachedSettingBase*>>& handles()
+    {
+        static std::map<Settings::CategorySetting, std::vector<Settings::CachedSettingBase*>> map;
+        return map;
+    }
+}
+
 namespace Settings
 {
 
+CachedSettingBase::CachedSettingBase(const std::string& setting, const std::string& category)
+    : mKey(category, setting)
+{
+    Manager::registerHandle(*this);
+}
+
+CachedSettingBase::~CachedSettingBase()
+{
+    Manager::unregisterHandle(*this);
+}
+
+void Manager::registerHandle(CachedSettingBase& handle)
+{
+    std::lock_guard<std::mutex> lock(handlesMutex());
+    handles()[handle.mKey].push_back(&handle);
+}
+
+void Manager::unregisterHandle(CachedSettingBase& handle)
+{
+    std::lock_guard<std::mutex> lock(handlesMutex());
+    const auto it = handles().find(handle.mKey);
+    if (it == handles().end())
+        return;
+    it->second.erase(std::remove(it->second.begin(), it->second.end(), &handle), it->second.end());
+    if (it->second.empty())
+        handles().erase(it);
+}
+
+void Manager::updateHandles(const CategorySetting& key)
+{
+    std::lock_guard<std::mutex> lock(handlesMutex());
+    const auto it = handles().find(key);
+    if (it == handles().end())
+        return;
+    for (CachedSettingBase* handle : it->second)
+        handle->update();
+}
+
+void Manager::updateAllHandles()
+{
+    std::lock_guard<std::mutex> lock(handlesMutex());
+    for (const auto& entry : handles())
+        for (CachedSettingBase* handle : entry.second)
+            handle->update();
+}
+
 CategorySettingValueMap Manager::mDefaultSettings = CategorySettingValueMap();
 CategorySettingValueMap Manager::mUserSettings = CategorySettingValueMap();
 CategorySettingVector Manager::mChangedSettings = CategorySettingVector();
@@ -29,6 +96,9 @@ void Manager::loadUser(const std::string &file)
 {
     SettingsFileParser parser;
     parser.loadSettingsFile(file, mUserSettings);
+
+    // Refresh any handles that were resolved before the file was (re)loaded
+    updateAllHandles();
 }
 
 void Manager::saveUser(const std::string &file)
@@ -121,6 +191,8 @@ void Manager::setString(const std::string &setting, const std::string &category,
     mUserSettings[key] = value;
 
     mChangedSettings.insert(key);
+
+    updateHandles(key);
 }
 
 void Manager::setInt (const std::string& setting, const std::string& category, const int value)
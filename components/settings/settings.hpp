@@ -3,14 +3,37 @@
 
 #include "categories.hpp"
 
+#include <atomic>
 #include <set>
 #include <map>
 #include <string>
+#include <type_traits>
 #include <osg/Vec2f>
 #include <osg/Vec3f>
 
 namespace Settings
 {
+    /// Non-template base of CachedSetting, keeping the handle registry
+    /// type-erased. Registers itself with the Manager on construction so the
+    /// cached value can be refreshed centrally when the setting changes.
+    class CachedSettingBase
+    {
+    public:
+        CachedSettingBase(const std::string& setting, const std::string& category);
+        virtual ~CachedSettingBase();
+
+        CachedSettingBase(const CachedSettingBase&) = delete;
+        CachedSettingBase& operator=(const CachedSettingBase&) = delete;
+
+    protected:
+        /// Re-read the cached value from the Manager.
+        virtual void update() = 0;
+
+        CategorySetting mKey;
+
+        friend class Manager;
+    };
+
     ///
     /// \brief Settings management (can change during runtime)
     ///
@@ -57,6 +80,52 @@ namespace Settings
         static void setBool (const std::string& setting, const std::string& category, const bool value);
         static void setVector2 (const std::string& setting, const std::string& category, const osg::Vec2f value);
         static void setVector3 (const std::string& setting, const std::string& category, const osg::Vec3f value);
+
+    private:
+        static void registerHandle(CachedSettingBase& handle);
+        static void unregisterHandle(CachedSettingBase& handle);
+        static void updateHandles(const CategorySetting& key);
+        static void updateAllHandles();
+
+        friend class CachedSettingBase;
+    };
+
+    /// Typed cached accessor for a single setting. The backing string is parsed
+    /// once on construction and re-parsed centrally whenever the setting is
+    /// changed through the Manager, so get() is just a relaxed atomic load and
+    /// is safe to call every frame from any thread. Intended for hot paths that
+    /// would otherwise probe the string maps per frame.
+    template <class T>
+    class CachedSetting : public CachedSettingBase
+    {
+    public:
+        CachedSetting(const std::string& setting, const std::string& category)
+            : CachedSettingBase(setting, category)
+        {
+            update();
+        }
+
+        T get() const { return mValue.load(std::memory_order_relaxed); }
+
+    protected:
+        void update() override
+        {
+            // mKey holds (category, setting), the getters take (setting, category)
+            if constexpr (std::is_same_v<T, bool>)
+                mValue.store(Manager::getBool(mKey.second, mKey.first), std::memory_order_relaxed);
+            else if constexpr (std::is_same_v<T, float>)
+                mValue.store(Manager::getFloat(mKey.second, mKey.first), std::memory_order_relaxed);
+            else if constexpr (std::is_same_v<T, double>)
+                mValue.store(Manager::getDouble(mKey.second, mKey.first), std::memory_order_relaxed);
+            else
+            {
+                static_assert(std::is_integral_v<T>, "CachedSetting supports bool, int, float and double");
+                mValue.store(static_cast<T>(Manager::getInt(mKey.second, mKey.first)), std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        std::atomic<T> mValue;
     };
 
 }
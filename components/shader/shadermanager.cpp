@@ -1,18 +1,38 @@
 #include "shadermanager.hpp"
 
+#include <cstdio>
 #include <fstream>
 #include <algorithm>
+#include <iterator>
 #include <sstream>
 
+#include <osg/GLExtensions>
 #include <osg/Program>
+#include <osg/State>
 
 #include <boost/filesystem/path.hpp>
 #include <boost/filesystem/fstream.hpp>
+#include <boost/filesystem/operations.hpp>
 
 #include <components/sceneutil/lightmanager.hpp>
 #include <components/debug/debuglog.hpp>
+#include <components/misc/hash.hpp>
 #include <components/misc/stringops.hpp>
 
+namespace
+{
+    std::uint64_t programHash(const osg::Shader& vertexShader, const osg::Shader& fragmentShader, int lightingMethod)
+    {
+        // The attribute and uniform block bindings depend on the lighting method,
+        // so it is part of the key along with the preprocessed sources.
+        std::uint64_t hash = Misc::fnv1aBasis;
+        hash = Misc::fnv1aAppend(hash, vertexShader.getShaderSource());
+        hash = Misc::fnv1aAppend(hash, fragmentShader.getShaderSource());
+        hash = Misc::fnv1aAppend(hash, std::to_string(lightingMethod));
+        return hash;
+    }
+}
+
 namespace Shader
 {
 
@@ -356,13 +376,138 @@ namespace Shader
             program->addShader(fragmentShader);
             program->addBindAttribLocation("aOffset", 6);
             program->addBindAttribLocation("aRotation", 7);
+            program->addBindAttribLocation("aMorphHeight", 8);
             if (mLightingMethod == SceneUtil::LightingMethod::SingleUBO)
                 program->addBindUniformBlock("LightBufferBinding", static_cast<int>(UBOBinding::LightBuffer));
+            if (mProgramBinaryCacheReady && vertexShader && fragmentShader)
+            {
+                const std::uint64_t hash = programHash(*vertexShader, *fragmentShader, static_cast<int>(mLightingMethod));
+                osg::ref_ptr<osg::Program::ProgramBinary> binary = readProgramBinary(hash);
+                if (binary)
+                    // The driver loads the binary instead of compiling and linking the sources.
+                    program->setProgramBinary(binary);
+                else
+                    mProgramsPendingStore.emplace_back(program, hash);
+            }
             found = mPrograms.insert(std::make_pair(std::make_pair(vertexShader, fragmentShader), program)).first;
         }
         return found->second;
     }
 
+    void ShaderManager::setProgramBinaryCachePath(const std::string& path)
+    {
+        mProgramBinaryCachePath = path;
+        if (!mProgramBinaryCachePath.empty())
+        {
+            boost::system::error_code ignore;
+            boost::filesystem::create_directories(boost::filesystem::path(mProgramBinaryCachePath), ignore);
+        }
+    }
+
+    void ShaderManager::updateProgramBinaryCache(osg::State& state)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mProgramBinaryCachePath.empty())
+            return;
+
+        if (!mProgramBinaryCacheReady)
+        {
+            const osg::GLExtensions* exts = osg::GLExtensions::Get(state.getContextID(), false);
+            if (!exts)
+                return;
+            if (!exts->isGetProgramBinarySupported)
+            {
+                Log(Debug::Info) << "Shader program binary cache disabled: GL_ARB_get_program_binary is not supported";
+                mProgramBinaryCachePath.clear();
+                return;
+            }
+            std::uint64_t driverHash = Misc::fnv1aBasis;
+            for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION })
+            {
+                const char* string = reinterpret_cast<const char*>(glGetString(name));
+                driverHash = Misc::fnv1aAppend(driverHash, std::string_view(string ? string : ""));
+            }
+            mDriverHash = driverHash;
+            mProgramBinaryCacheReady = true;
+        }
+
+        for (auto it = mProgramsPendingStore.begin(); it != mProgramsPendingStore.end();)
+        {
+            osg::Program::PerContextProgram* pcp = it->first->getPCP(state);
+            if (!pcp || !pcp->isLinked())
+            {
+                // Not used for rendering yet, check again next frame.
+                ++it;
+                continue;
+            }
+            osg::ref_ptr<osg::Program::ProgramBinary> binary = pcp->compileProgramBinary(state);
+            if (binary && binary->getSize() > 0)
+                writeProgramBinary(it->second, *binary);
+            it = mProgramsPendingStore.erase(it);
+        }
+    }
+
+    std::string ShaderManager::programBinaryCacheFilePath(std::uint64_t hash) const
+    {
+        char name[4 * sizeof(std::uint64_t) + 2];
+        std::snprintf(name, sizeof(name), "%016llx-%016llx",
+            static_cast<unsigned long long>(mDriverHash), static_cast<unsigned long long>(hash));
+        return (boost::filesystem::path(mProgramBinaryCachePath) / (std::string(name) + ".bin")).string();
+    }
+
+    osg::ref_ptr<osg::Program::ProgramBinary> ShaderManager::readProgramBinary(std::uint64_t hash) const
+    {
+        boost::filesystem::ifstream stream(
+            boost::filesystem::path(programBinaryCacheFilePath(hash)), std::ios::in | std::ios::binary);
+        if (!stream.is_open())
+            return nullptr;
+
+        std::uint32_t format = 0;
+        stream.read(reinterpret_cast<char*>(&format), sizeof(format));
+        if (!stream)
+            return nullptr;
+        std::vector<char> data { std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>() };
+        if (format == 0 || data.empty())
+        {
+            Log(Debug::Warning) << "Ignoring invalid shader program binary cache entry " << programBinaryCacheFilePath(hash);
+            return nullptr;
+        }
+
+        osg::ref_ptr<osg::Program::ProgramBinary> binary (new osg::Program::ProgramBinary);
+        binary->setFormat(format);
+        binary->assign(static_cast<unsigned int>(data.size()), reinterpret_cast<const unsigned char*>(data.data()));
+        return binary;
+    }
+
+    void ShaderManager::writeProgramBinary(std::uint64_t hash, const osg::Program::ProgramBinary& binary) const
+    {
+        // Write to a private temporary file and rename, so a crashed session
+        // never leaves a half-written entry.
+        const std::string filePath = programBinaryCacheFilePath(hash);
+        try
+        {
+            const boost::filesystem::path temporaryPath = boost::filesystem::unique_path(filePath + ".%%%%%%%%.tmp");
+            {
+                boost::filesystem::ofstream stream(temporaryPath, std::ios::out | std::ios::binary);
+                const std::uint32_t format = binary.getFormat();
+                stream.write(reinterpret_cast<const char*>(&format), sizeof(format));
+                stream.write(reinterpret_cast<const char*>(binary.getData()), binary.getSize());
+                if (!stream)
+                {
+                    stream.close();
+                    boost::system::error_code ignore;
+                    boost::filesystem::remove(temporaryPath, ignore);
+                    return;
+                }
+            }
+            boost::filesystem::rename(temporaryPath, boost::filesystem::path(filePath));
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to store shader program binary: " << e.what();
+        }
+    }
+
     ShaderManager::DefineMap ShaderManager::getGlobalDefines()
     {
         return DefineMap(mGlobalDefines);
@@ -371,6 +516,11 @@ namespace Shader
     void ShaderManager::setGlobalDefines(DefineMap & globalDefines)
     {
         mGlobalDefines = globalDefines;
+        // The rewritten sources no longer match the binaries that were cached or
+        // queued for storing under the old defines.
+        mProgramsPendingStore.clear();
+        for (const auto& [_, program] : mPrograms)
+            program->setProgramBinary(nullptr);
         for (const auto& [key, shader]: mShaders)
         {
             std::string templateId = key.first;
@@ -1,13 +1,16 @@
 #ifndef OPENMW_COMPONENTS_SHADERMANAGER_H
 #define OPENMW_COMPONENTS_SHADERMANAGER_H
 
+#include <cstdint>
 #include <string>
 #include <map>
 #include <mutex>
+#include <vector>
 
 #include <osg/ref_ptr>
 
 #include <osg/Shader>
+#include <osg/Program>
 
 #include <osgViewer/Viewer>
 
@@ -55,6 +58,16 @@ namespace Shader
 
         osg::ref_ptr<osg::Program> getProgram(osg::ref_ptr<osg::Shader> vertexShader, osg::ref_ptr<osg::Shader> fragmentShader);
 
+        /// Set the directory used to persist linked program binaries between sessions.
+        /// An empty path disables the cache. Call before the first getProgram call.
+        void setProgramBinaryCachePath(const std::string& path);
+
+        /// Store the binaries of newly linked programs into the cache. On the first call also
+        /// resolves the driver identity the cache entries are keyed by, so binaries are never
+        /// fed back to a different driver or GPU.
+        /// @note Must be called with a current GL context, i.e. on the draw thread.
+        void updateProgramBinaryCache(osg::State& state);
+
         /// Get (a copy of) the DefineMap used to construct all shaders
         DefineMap getGlobalDefines();
 
@@ -81,6 +94,17 @@ namespace Shader
         typedef std::map<std::pair<osg::ref_ptr<osg::Shader>, osg::ref_ptr<osg::Shader> >, osg::ref_ptr<osg::Program> > ProgramMap;
         ProgramMap mPrograms;
 
+        std::string programBinaryCacheFilePath(std::uint64_t hash) const;
+        osg::ref_ptr<osg::Program::ProgramBinary> readProgramBinary(std::uint64_t hash) const;
+        void writeProgramBinary(std::uint64_t hash, const osg::Program::ProgramBinary& binary) const;
+
+        std::string mProgramBinaryCachePath;
+        // Hash of GL_VENDOR/GL_RENDERER/GL_VERSION; program binary formats are driver specific.
+        std::uint64_t mDriverHash = 0;
+        bool mProgramBinaryCacheReady = false;
+        // Programs created with no usable cache entry, waiting to be linked and stored.
+        std::vector<std::pair<osg::ref_ptr<osg::Program>, std::uint64_t> > mProgramsPendingStore;
+
         SceneUtil::LightingMethod mLightingMethod;
 
         std::mutex mMutex;
@@ -100,6 +100,39 @@ namespace Shader
     {
     }
 
+    bool TextureLookupCache::getNormalMap(const std::string& diffuseMap, std::string& normalMap, bool& normalHeight) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto found = mNormalMaps.find(diffuseMap);
+        if (found == mNormalMaps.end())
+            return false;
+        normalMap = found->second.mFileName;
+        normalHeight = found->second.mNormalHeight;
+        return true;
+    }
+
+    void TextureLookupCache::addNormalMap(const std::string& diffuseMap, const std::string& normalMap, bool normalHeight)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mNormalMaps[diffuseMap] = NormalMapEntry{normalMap, normalHeight};
+    }
+
+    bool TextureLookupCache::getSpecularMap(const std::string& diffuseMap, std::string& specularMap) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto found = mSpecularMaps.find(diffuseMap);
+        if (found == mSpecularMaps.end())
+            return false;
+        specularMap = found->second;
+        return true;
+    }
+
+    void TextureLookupCache::addSpecularMap(const std::string& diffuseMap, const std::string& specularMap)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mSpecularMaps[diffuseMap] = specularMap;
+    }
+
     ShaderVisitor::ShaderVisitor(ShaderManager& shaderManager, Resource::ImageManager& imageManager, const std::string &defaultShaderPrefix)
         : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
         , mForceShaders(false)
@@ -272,25 +305,30 @@ namespace Shader
 
             if (mAutoUseNormalMaps && diffuseMap != nullptr && normalMap == nullptr && diffuseMap->getImage(0))
             {
-                std::string normalMapFileName = diffuseMap->getImage(0)->getFileName();
+                const std::string diffuseFileName = diffuseMap->getImage(0)->getFileName();
 
-                osg::ref_ptr<osg::Image> image;
+                std::string detectedFileName;
                 bool normalHeight = false;
-                std::string normalHeightMap = normalMapFileName;
-                Misc::StringUtils::replaceLast(normalHeightMap, ".", mNormalHeightMapPattern + ".");
-                if (mImageManager.getVFS()->exists(normalHeightMap))
-                {
-                    image = mImageManager.getImage(normalHeightMap);
-                    normalHeight = true;
-                }
-                else
+                if (!mTextureLookupCache || !mTextureLookupCache->getNormalMap(diffuseFileName, detectedFileName, normalHeight))
                 {
+                    std::string normalHeightMap = diffuseFileName;
+                    Misc::StringUtils::replaceLast(normalHeightMap, ".", mNormalHeightMapPattern + ".");
+                    std::string normalMapFileName = diffuseFileName;
                     Misc::StringUtils::replaceLast(normalMapFileName, ".", mNormalMapPattern + ".");
-                    if (mImageManager.getVFS()->exists(normalMapFileName))
+                    if (mImageManager.getVFS()->exists(normalHeightMap))
                     {
-                        image = mImageManager.getImage(normalMapFileName);
+                        detectedFileName = normalHeightMap;
+                        normalHeight = true;
                     }
+                    else if (mImageManager.getVFS()->exists(normalMapFileName))
+                        detectedFileName = normalMapFileName;
+                    if (mTextureLookupCache)
+                        mTextureLookupCache->addNormalMap(diffuseFileName, detectedFileName, normalHeight);
                 }
+
+                osg::ref_ptr<osg::Image> image;
+                if (!detectedFileName.empty())
+                    image = mImageManager.getImage(detectedFileName, /*allowStreaming*/true);
                 // Avoid using the auto-detected normal map if it's already being used as a bump map.
                 // It's probably not an actual normal map.
                 bool hasNamesakeBumpMap = image && bumpMap && bumpMap->getImage(0) && image->getFileName() == bumpMap->getImage(0)->getFileName();
@@ -318,11 +356,21 @@ namespace Shader
             }
             if (mAutoUseSpecularMaps && diffuseMap != nullptr && specularMap == nullptr && diffuseMap->getImage(0))
             {
-                std::string specularMapFileName = diffuseMap->getImage(0)->getFileName();
-                Misc::StringUtils::replaceLast(specularMapFileName, ".", mSpecularMapPattern + ".");
-                if (mImageManager.getVFS()->exists(specularMapFileName))
+                const std::string diffuseFileName = diffuseMap->getImage(0)->getFileName();
+
+                std::string specularMapFileName;
+                if (!mTextureLookupCache || !mTextureLookupCache->getSpecularMap(diffuseFileName, specularMapFileName))
+                {
+                    specularMapFileName = diffuseFileName;
+                    Misc::StringUtils::replaceLast(specularMapFileName, ".", mSpecularMapPattern + ".");
+                    if (!mImageManager.getVFS()->exists(specularMapFileName))
+                        specularMapFileName.clear();
+                    if (mTextureLookupCache)
+                        mTextureLookupCache->addSpecularMap(diffuseFileName, specularMapFileName);
+                }
+                if (!specularMapFileName.empty())
                 {
-                    osg::ref_ptr<osg::Image> image (mImageManager.getImage(specularMapFileName));
+                    osg::ref_ptr<osg::Image> image (mImageManager.getImage(specularMapFileName, /*allowStreaming*/true));
                     osg::ref_ptr<osg::Texture2D> specularMapTex (new osg::Texture2D(image));
                     specularMapTex->setTextureSize(image->s(), image->t());
                     specularMapTex->setWrap(osg::Texture::WRAP_S, diffuseMap->getWrap(osg::Texture::WRAP_S));
@@ -764,6 +812,11 @@ namespace Shader
         mTranslucentFramebuffer = translucent;
     }
 
+    void ShaderVisitor::setTextureLookupCache(std::shared_ptr<TextureLookupCache> cache)
+    {
+        mTextureLookupCache = std::move(cache);
+    }
+
     ReinstateRemovedStateVisitor::ReinstateRemovedStateVisitor(bool allowedToModifyStateSets)
         : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
         , mAllowedToModifyStateSets(allowedToModifyStateSets)
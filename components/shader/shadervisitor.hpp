@@ -1,6 +1,10 @@
 #ifndef OPENMW_COMPONENTS_SHADERVISITOR_H
 #define OPENMW_COMPONENTS_SHADERVISITOR_H
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 #include <osg/NodeVisitor>
 
 namespace Resource
@@ -13,6 +17,32 @@ namespace Shader
 
     class ShaderManager;
 
+    /// Remembers which automatically detected normal/specular maps belong to a diffuse
+    /// texture, so the VFS is only probed once per texture no matter how many meshes
+    /// (or templates) use it. Shared between ShaderVisitor runs, see
+    /// ShaderVisitor::setTextureLookupCache. Thread safe.
+    class TextureLookupCache
+    {
+    public:
+        bool getNormalMap(const std::string& diffuseMap, std::string& normalMap, bool& normalHeight) const;
+        void addNormalMap(const std::string& diffuseMap, const std::string& normalMap, bool normalHeight);
+
+        bool getSpecularMap(const std::string& diffuseMap, std::string& specularMap) const;
+        void addSpecularMap(const std::string& diffuseMap, const std::string& specularMap);
+
+    private:
+        struct NormalMapEntry
+        {
+            std::string mFileName; // empty if no normal map was found
+            bool mNormalHeight;
+        };
+
+        mutable std::mutex mMutex;
+        std::unordered_map<std::string, NormalMapEntry> mNormalMaps;
+        // <diffuse file, specular file or empty>
+        std::unordered_map<std::string, std::string> mSpecularMaps;
+    };
+
     /// @brief Adjusts the given subgraph to render using shaders.
     class ShaderVisitor : public osg::NodeVisitor
     {
@@ -44,6 +74,11 @@ namespace Shader
 
         void setTranslucentFramebuffer(bool translucent);
 
+        /// Share the given cache of normal/specular map lookups with this visitor.
+        /// All users of the cache must be configured with the same patterns and
+        /// auto-use settings.
+        void setTextureLookupCache(std::shared_ptr<TextureLookupCache> cache);
+
         void apply(osg::Node& node) override;
 
         void apply(osg::Drawable& drawable) override;
@@ -74,6 +109,8 @@ namespace Shader
         ShaderManager& mShaderManager;
         Resource::ImageManager& mImageManager;
 
+        std::shared_ptr<TextureLookupCache> mTextureLookupCache;
+
         struct ShaderRequirements
         {
             ShaderRequirements();
@@ -1,8 +1,11 @@
 #include "chunkmanager.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 
 #include <osg/Texture2D>
+#include <osg/Texture2DArray>
 #include <osg/ClusterCullingCallback>
 #include <osg/Material>
 #include <osg/MatrixTransform>
@@ -22,6 +25,67 @@
 #include "compositemaprenderer.hpp"
 #include <components/misc/constants.hpp>
 
+namespace
+{
+    // Pack the per-layer GL_ALPHA blendmaps four layers per RGBA texture for the
+    // single-pass material. All blendmaps of a chunk share the same dimensions.
+    std::vector<osg::ref_ptr<osg::Texture2D>> packBlendmaps(const std::vector<osg::ref_ptr<osg::Image>>& blendmaps)
+    {
+        std::vector<osg::ref_ptr<osg::Texture2D>> result;
+        const int width = blendmaps[0]->s();
+        const int height = blendmaps[0]->t();
+        for (std::size_t base = 0; base < blendmaps.size(); base += 4)
+        {
+            osg::ref_ptr<osg::Image> packed (new osg::Image);
+            packed->allocateImage(width, height, 1, GL_RGBA, GL_UNSIGNED_BYTE);
+            unsigned char* dst = packed->data();
+            std::memset(dst, 0, packed->getTotalDataSize());
+
+            const std::size_t channels = std::min<std::size_t>(4, blendmaps.size() - base);
+            for (std::size_t channel = 0; channel < channels; ++channel)
+            {
+                const unsigned char* src = blendmaps[base + channel]->data();
+                for (int pixel = 0; pixel < width * height; ++pixel)
+                    dst[4 * pixel + channel] = src[pixel];
+            }
+
+            osg::ref_ptr<osg::Texture2D> texture (new osg::Texture2D);
+            texture->setImage(packed);
+            texture->setWrap(osg::Texture::WRAP_S, osg::Texture::CLAMP_TO_EDGE);
+            texture->setWrap(osg::Texture::WRAP_T, osg::Texture::CLAMP_TO_EDGE);
+            texture->setResizeNonPowerOfTwoHint(false);
+            result.push_back(texture);
+        }
+        return result;
+    }
+
+    // Fill the per-vertex height differences to the next coarser lod for geomorphing.
+    // Vertices on even rows and columns exist unchanged at the coarser lod; the height the
+    // others take there is the interpolation of their even neighbours. numVerts-1 is always
+    // even, so odd rows/columns are interior and the neighbour lookups stay in bounds.
+    void fillMorphHeights(const osg::Vec3Array& positions, unsigned int numVerts, osg::FloatArray& morphHeights)
+    {
+        morphHeights.assign(positions.size(), 0.f);
+        for (unsigned int x = 0; x < numVerts; ++x)
+        {
+            for (unsigned int y = 0; y < numVerts; ++y)
+            {
+                if (x % 2 == 0 && y % 2 == 0)
+                    continue; // shared with the coarser lod
+                float coarseHeight;
+                if (y % 2 == 0)
+                    coarseHeight = (positions[(x-1) * numVerts + y].z() + positions[(x+1) * numVerts + y].z()) * 0.5f;
+                else if (x % 2 == 0)
+                    coarseHeight = (positions[x * numVerts + y-1].z() + positions[x * numVerts + y+1].z()) * 0.5f;
+                else
+                    coarseHeight = (positions[(x-1) * numVerts + y-1].z() + positions[(x+1) * numVerts + y-1].z()
+                                  + positions[(x-1) * numVerts + y+1].z() + positions[(x+1) * numVerts + y+1].z()) * 0.25f;
+                morphHeights[x * numVerts + y] = coarseHeight - positions[x * numVerts + y].z();
+            }
+        }
+    }
+}
+
 namespace Terrain
 {
 
@@ -36,6 +100,7 @@ ChunkManager::ChunkManager(Storage *storage, Resource::SceneManager *sceneMgr, T
     , mCompositeMapLevel(1.f)
     , mMaxCompGeometrySize(1.f)
     , mDebugChunks(Settings::Manager::getBool("debug chunks", "Terrain"))
+    , mTextureArrayLayers(Settings::Manager::getBool("texture array layers", "Terrain"))
 {
     mMultiPassRoot = new osg::StateSet;
     mMultiPassRoot->setRenderingHint(osg::StateSet::OPAQUE_BIN);
@@ -44,7 +109,7 @@ ChunkManager::ChunkManager(Storage *storage, Resource::SceneManager *sceneMgr, T
     mMultiPassRoot->setAttributeAndModes(material, osg::StateAttribute::ON);
 }
 
-osg::ref_ptr<osg::Node> ChunkManager::getChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags, bool activeGrid, const osg::Vec3f& viewPoint, bool compile)
+osg::ref_ptr<osg::Node> ChunkManager::getChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags, bool activeGrid, const osg::Vec3f& viewPoint, bool compile, const std::atomic<bool>* abort)
 {
     ChunkId id = std::make_tuple(center, lod, lodFlags);
     osg::ref_ptr<osg::Object> obj = mCache->getRefFromObjectCache(id);
@@ -52,22 +117,75 @@ osg::ref_ptr<osg::Node> ChunkManager::getChunk(float size, const osg::Vec2f& cen
         return static_cast<osg::Node*>(obj.get());
     else
     {
-        osg::ref_ptr<osg::Node> node = createChunk(size, center, lod, lodFlags, compile);
+        if (abort && *abort)
+            return nullptr;
+        osg::ref_ptr<osg::Node> node = createChunk(size, center, lod, lodFlags, viewPoint, compile);
         mCache->addEntryToObjectCache(id, node.get());
         return node;
     }
 }
 
+void ChunkManager::updateChunkVertices(osg::Node *chunkNode, float size, const osg::Vec2f &center, unsigned char lod)
+{
+    TerrainDrawable* geometry = dynamic_cast<TerrainDrawable*>(chunkNode);
+    if (!geometry && chunkNode->asGroup() && chunkNode->asGroup()->getNumChildren())
+    {
+        // with debug chunks enabled the drawable shares a group with the chunk border
+        geometry = dynamic_cast<TerrainDrawable*>(chunkNode->asGroup()->getChild(0));
+    }
+    if (!geometry)
+        return;
+
+    osg::ref_ptr<osg::Vec3Array> positions = static_cast<osg::Vec3Array*>(geometry->getVertexArray());
+    osg::ref_ptr<osg::Vec3Array> normals = static_cast<osg::Vec3Array*>(geometry->getNormalArray());
+    osg::ref_ptr<osg::Vec4ubArray> colors = static_cast<osg::Vec4ubArray*>(geometry->getColorArray());
+    if (!positions || !normals || !colors)
+        return;
+
+    mStorage->fillVertexBuffers(lod, size, center, positions, normals, colors);
+
+    positions->dirty();
+    normals->dirty();
+    colors->dirty();
+
+    if (osg::FloatArray* morphHeights = static_cast<osg::FloatArray*>(geometry->getVertexAttribArray(8)))
+    {
+        unsigned int numVerts = (mStorage->getCellVertices()-1) * size / (1 << lod) + 1;
+        fillMorphHeights(*positions, numVerts, *morphHeights);
+        morphHeights->dirty();
+    }
+
+    geometry->dirtyBound();
+    geometry->createClusterCullingCallback();
+}
+
 void ChunkManager::reportStats(unsigned int frameNumber, osg::Stats *stats) const
 {
     stats->setAttribute(frameNumber, "Terrain Chunk", mCache->getCacheSize());
 }
 
+void ChunkManager::updateCache(double referenceTime)
+{
+    GenericResourceManager<ChunkId>::updateCache(referenceTime);
+
+    std::lock_guard<std::mutex> lock(mVertexDataCacheMutex);
+    for (auto it = mVertexDataCache.begin(); it != mVertexDataCache.end();)
+    {
+        if (!it->second.mPositions.valid())
+            it = mVertexDataCache.erase(it);
+        else
+            ++it;
+    }
+}
+
 void ChunkManager::clearCache()
 {
     GenericResourceManager<ChunkId>::clearCache();
 
     mBufferCache.clearCache();
+
+    std::lock_guard<std::mutex> lock(mVertexDataCacheMutex);
+    mVertexDataCache.clear();
 }
 
 void ChunkManager::releaseGLObjects(osg::State *state)
@@ -121,7 +239,7 @@ void ChunkManager::createCompositeMapGeometry(float chunkSize, const osg::Vec2f&
     }
 }
 
-std::vector<osg::ref_ptr<osg::StateSet> > ChunkManager::createPasses(float chunkSize, const osg::Vec2f &chunkCenter, bool forCompositeMap)
+std::vector<osg::ref_ptr<osg::StateSet> > ChunkManager::createPasses(float chunkSize, const osg::Vec2f &chunkCenter, bool forCompositeMap, const osg::Vec2f* morphRange)
 {
     std::vector<LayerInfo> layerList;
     std::vector<osg::ref_ptr<osg::Image> > blendmaps;
@@ -154,6 +272,39 @@ std::vector<osg::ref_ptr<osg::StateSet> > ChunkManager::createPasses(float chunk
     if (forCompositeMap)
         useShaders = false;
 
+    float blendmapScale = mStorage->getBlendmapScale(chunkSize);
+
+    // Composite every layer in one pass when the layer textures fit into a texture
+    // array. Chunks with normal/specular mapped layers and installs whose layer
+    // textures can not share an array keep the multipass material, as does old GL
+    // without texture array support (via the setting).
+    if (mTextureArrayLayers && useShaders && !blendmaps.empty())
+    {
+        bool plainLayers = true;
+        std::vector<std::string> diffuseNames;
+        diffuseNames.reserve(layerList.size());
+        for (const LayerInfo& info : layerList)
+        {
+            if (info.requiresShaders())
+            {
+                plainLayers = false;
+                break;
+            }
+            diffuseNames.push_back(info.mDiffuseMap);
+        }
+
+        if (plainLayers)
+        {
+            if (osg::ref_ptr<osg::Texture2DArray> layerArray = mTextureManager->getTextureArray(diffuseNames))
+            {
+                osg::ref_ptr<osg::StateSet> pass = ::Terrain::createSinglePass(&mSceneManager->getShaderManager(),
+                    layerArray, layerList.size(), packBlendmaps(blendmaps), blendmapScale, blendmapScale, morphRange);
+                if (pass)
+                    return std::vector<osg::ref_ptr<osg::StateSet> >(1, pass);
+            }
+        }
+    }
+
     std::vector<osg::ref_ptr<osg::Texture2D> > blendmapTextures;
     for (std::vector<osg::ref_ptr<osg::Image> >::const_iterator it = blendmaps.begin(); it != blendmaps.end(); ++it)
     {
@@ -165,37 +316,76 @@ std::vector<osg::ref_ptr<osg::StateSet> > ChunkManager::createPasses(float chunk
         blendmapTextures.push_back(texture);
     }
 
-    float blendmapScale = mStorage->getBlendmapScale(chunkSize);
-
-    return ::Terrain::createPasses(useShaders, &mSceneManager->getShaderManager(), layers, blendmapTextures, blendmapScale, blendmapScale);
+    return ::Terrain::createPasses(useShaders, &mSceneManager->getShaderManager(), layers, blendmapTextures, blendmapScale, blendmapScale, morphRange);
 }
 
-osg::ref_ptr<osg::Node> ChunkManager::createChunk(float chunkSize, const osg::Vec2f &chunkCenter, unsigned char lod, unsigned int lodFlags, bool compile)
+osg::ref_ptr<osg::Node> ChunkManager::createChunk(float chunkSize, const osg::Vec2f &chunkCenter, unsigned char lod, unsigned int lodFlags, const osg::Vec3f& viewPoint, bool compile)
 {
-    osg::ref_ptr<osg::Vec3Array> positions (new osg::Vec3Array);
-    osg::ref_ptr<osg::Vec3Array> normals (new osg::Vec3Array);
-    osg::ref_ptr<osg::Vec4ubArray> colors (new osg::Vec4ubArray);
-    colors->setNormalize(true);
+    unsigned int numVerts = (mStorage->getCellVertices()-1) * chunkSize / (1 << lod) + 1;
 
-    osg::ref_ptr<osg::VertexBufferObject> vbo (new osg::VertexBufferObject);
-    positions->setVertexBufferObject(vbo);
-    normals->setVertexBufferObject(vbo);
-    colors->setVertexBufferObject(vbo);
+    const bool geomorph = mLodFactor > 0.f;
 
-    mStorage->fillVertexBuffers(lod, chunkSize, chunkCenter, positions, normals, colors);
+    osg::ref_ptr<osg::Vec3Array> positions;
+    osg::ref_ptr<osg::Vec3Array> normals;
+    osg::ref_ptr<osg::Vec4ubArray> colors;
+    osg::ref_ptr<osg::FloatArray> morphHeights;
+
+    // Chunks that differ only in lod flags share their vertex data; only the index buffer
+    // depends on the flags.
+    const std::pair<osg::Vec2f, unsigned char> vertexDataId (chunkCenter, lod);
+    {
+        std::lock_guard<std::mutex> lock(mVertexDataCacheMutex);
+        std::map<std::pair<osg::Vec2f, unsigned char>, CachedVertexData>::iterator found = mVertexDataCache.find(vertexDataId);
+        if (found != mVertexDataCache.end())
+        {
+            found->second.mPositions.lock(positions);
+            found->second.mNormals.lock(normals);
+            found->second.mColors.lock(colors);
+            found->second.mMorphHeights.lock(morphHeights);
+        }
+    }
+
+    if (!positions || !normals || !colors || (geomorph && !morphHeights))
+    {
+        positions = new osg::Vec3Array;
+        normals = new osg::Vec3Array;
+        colors = new osg::Vec4ubArray;
+        colors->setNormalize(true);
+
+        osg::ref_ptr<osg::VertexBufferObject> vbo (new osg::VertexBufferObject);
+        positions->setVertexBufferObject(vbo);
+        normals->setVertexBufferObject(vbo);
+        colors->setVertexBufferObject(vbo);
+
+        mStorage->fillVertexBuffers(lod, chunkSize, chunkCenter, positions, normals, colors);
+
+        if (geomorph)
+        {
+            morphHeights = new osg::FloatArray;
+            fillMorphHeights(*positions, numVerts, *morphHeights);
+            morphHeights->setVertexBufferObject(vbo);
+        }
+
+        std::lock_guard<std::mutex> lock(mVertexDataCacheMutex);
+        CachedVertexData& cached = mVertexDataCache[vertexDataId];
+        cached.mPositions = positions;
+        cached.mNormals = normals;
+        cached.mColors = colors;
+        cached.mMorphHeights = morphHeights;
+    }
 
     osg::ref_ptr<TerrainDrawable> geometry (new TerrainDrawable);
     geometry->setVertexArray(positions);
     geometry->setNormalArray(normals, osg::Array::BIND_PER_VERTEX);
     geometry->setColorArray(colors, osg::Array::BIND_PER_VERTEX);
+    if (geomorph)
+        geometry->setVertexAttribArray(8, morphHeights, osg::Array::BIND_PER_VERTEX);
     geometry->setUseDisplayList(false);
     geometry->setUseVertexBufferObjects(true);
 
     if (chunkSize <= 1.f)
         geometry->setLightListCallback(new SceneUtil::LightListCallback);
 
-    unsigned int numVerts = (mStorage->getCellVertices()-1) * chunkSize / (1 << lod) + 1;
-
     geometry->addPrimitiveSet(mBufferCache.getIndexBuffer(numVerts, lodFlags));
 
     bool useCompositeMap = chunkSize >= mCompositeMapLevel;
@@ -207,11 +397,28 @@ osg::ref_ptr<osg::Node> ChunkManager::createChunk(float chunkSize, const osg::Ve
 
     geometry->setStateSet(mMultiPassRoot);
 
+    // The lod callback replaces this chunk with its parent once the view distance exceeds
+    // 2 * chunkSize * lodFactor cells, so morph towards the coarser heights over the last 30%
+    // of that range and the switch is invisible.
+    osg::Vec2f morphRange;
+    if (geomorph)
+    {
+        const float morphEnd = 2.f * chunkSize * Constants::CellSizeInUnits * mLodFactor;
+        const float morphStart = 0.7f * morphEnd;
+        morphRange = osg::Vec2f(morphStart, 1.f / (morphEnd - morphStart));
+    }
+
     if (useCompositeMap)
     {
         osg::ref_ptr<CompositeMap> compositeMap = new CompositeMap;
         compositeMap->mTexture = createCompositeMapRTT();
 
+        // Prioritize the compile by approximate screen-space contribution so
+        // pop-in near the camera resolves first
+        const osg::Vec3f worldCenter (chunkCenter.x()*Constants::CellSizeInUnits, chunkCenter.y()*Constants::CellSizeInUnits, 0.f);
+        const float dist = std::max((viewPoint - worldCenter).length(), 1.f);
+        compositeMap->mPriority = chunkSize * Constants::CellSizeInUnits / dist;
+
         createCompositeMapGeometry(chunkSize, chunkCenter, osg::Vec4f(0,0,1,1), *compositeMap);
 
         mCompositeMapRenderer->addCompositeMap(compositeMap.get(), false);
@@ -223,11 +430,11 @@ osg::ref_ptr<osg::Node> ChunkManager::createChunk(float chunkSize, const osg::Ve
         layer.mDiffuseMap = compositeMap->mTexture;
         layer.mParallax = false;
         layer.mSpecular = false;
-        geometry->setPasses(::Terrain::createPasses(mSceneManager->getForceShaders() || !mSceneManager->getClampLighting(), &mSceneManager->getShaderManager(), std::vector<TextureLayer>(1, layer), std::vector<osg::ref_ptr<osg::Texture2D> >(), 1.f, 1.f));
+        geometry->setPasses(::Terrain::createPasses(mSceneManager->getForceShaders() || !mSceneManager->getClampLighting(), &mSceneManager->getShaderManager(), std::vector<TextureLayer>(1, layer), std::vector<osg::ref_ptr<osg::Texture2D> >(), 1.f, 1.f, geomorph ? &morphRange : nullptr));
     }
     else
     {
-        geometry->setPasses(createPasses(chunkSize, chunkCenter, false));
+        geometry->setPasses(createPasses(chunkSize, chunkCenter, false, geomorph ? &morphRange : nullptr));
     }
 
     geometry->setupWaterBoundingBox(-1, chunkSize * mStorage->getCellWorldSize() / numVerts);
@@ -3,6 +3,8 @@
 
 #include <tuple>
 
+#include <osg/observer_ptr>
+
 #include <components/resource/resourcemanager.hpp>
 
 #include "buffercache.hpp"
@@ -35,29 +37,41 @@ namespace Terrain
     public:
         ChunkManager(Storage* storage, Resource::SceneManager* sceneMgr, TextureManager* textureManager, CompositeMapRenderer* renderer);
 
-        osg::ref_ptr<osg::Node> getChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags, bool activeGrid, const osg::Vec3f& viewPoint, bool compile) override;
+        osg::ref_ptr<osg::Node> getChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags, bool activeGrid, const osg::Vec3f& viewPoint, bool compile, const std::atomic<bool>* abort) override;
+
+        /// Re-fill the vertex data of a chunk previously returned by getChunk() from the storage,
+        /// keeping its passes, composite map and index buffers. Intended for live previews of
+        /// height edits; layer changes still require building a new chunk.
+        void updateChunkVertices(osg::Node* chunkNode, float size, const osg::Vec2f& center, unsigned char lod);
 
         void setCompositeMapSize(unsigned int size) { mCompositeMapSize = size; }
         void setCompositeMapLevel(float level) { mCompositeMapLevel = level; }
         void setMaxCompositeGeometrySize(float maxCompGeometrySize) { mMaxCompGeometrySize = maxCompGeometrySize; }
 
+        /// The lod factor used by the quad tree's lod callback. A non-zero value enables geomorphing:
+        /// chunks carry per-vertex height deltas to the next coarser lod and the vertex shader blends
+        /// them in with view distance, so lod switches no longer pop.
+        void setLodFactor(float factor) { mLodFactor = factor; }
+
         void setNodeMask(unsigned int mask) { mNodeMask = mask; }
         unsigned int getNodeMask() override { return mNodeMask; }
 
         void reportStats(unsigned int frameNumber, osg::Stats* stats) const override;
 
+        void updateCache(double referenceTime) override;
+
         void clearCache() override;
 
         void releaseGLObjects(osg::State* state) override;
 
     private:
-        osg::ref_ptr<osg::Node> createChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags, bool compile);
+        osg::ref_ptr<osg::Node> createChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags, const osg::Vec3f& viewPoint, bool compile);
 
         osg::ref_ptr<osg::Texture2D> createCompositeMapRTT();
 
         void createCompositeMapGeometry(float chunkSize, const osg::Vec2f& chunkCenter, const osg::Vec4f& texCoords, CompositeMap& map);
 
-        std::vector<osg::ref_ptr<osg::StateSet> > createPasses(float chunkSize, const osg::Vec2f& chunkCenter, bool forCompositeMap);
+        std::vector<osg::ref_ptr<osg::StateSet> > createPasses(float chunkSize, const osg::Vec2f& chunkCenter, bool forCompositeMap, const osg::Vec2f* morphRange = nullptr);
 
         Terrain::Storage* mStorage;
         Resource::SceneManager* mSceneManager;
@@ -65,6 +79,20 @@ namespace Terrain
         CompositeMapRenderer* mCompositeMapRenderer;
         BufferCache mBufferCache;
 
+        // Vertex data is shared between the chunks a (center, lod) pair produces for different
+        // lod flags, so neighbour lod changes only pick a new index buffer instead of re-sampling
+        // the heightmap. The chunks in the object cache keep the arrays alive; expired entries
+        // are pruned in updateCache().
+        struct CachedVertexData
+        {
+            osg::observer_ptr<osg::Vec3Array> mPositions;
+            osg::observer_ptr<osg::Vec3Array> mNormals;
+            osg::observer_ptr<osg::Vec4ubArray> mColors;
+            osg::observer_ptr<osg::FloatArray> mMorphHeights;
+        };
+        std::map<std::pair<osg::Vec2f, unsigned char>, CachedVertexData> mVertexDataCache;
+        std::mutex mVertexDataCacheMutex;
+
         osg::ref_ptr<osg::StateSet> mMultiPassRoot;
 
         unsigned int mNodeMask;
@@ -73,6 +101,8 @@ namespace Terrain
         float mCompositeMapLevel;
         float mMaxCompGeometrySize;
         bool mDebugChunks = false;
+        bool mTextureArrayLayers = false;
+        float mLodFactor = 0.f;
     };
 
 }
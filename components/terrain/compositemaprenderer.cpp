@@ -9,12 +9,23 @@
 
 #include <algorithm>
 
+#ifndef GL_TIME_ELAPSED
+#define GL_TIME_ELAPSED 0x88BF
+#endif
+#ifndef GL_QUERY_RESULT
+#define GL_QUERY_RESULT 0x8866
+#endif
+#ifndef GL_QUERY_RESULT_AVAILABLE
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+#endif
+
 namespace Terrain
 {
 
 CompositeMapRenderer::CompositeMapRenderer()
     : mTargetFrameRate(120)
     , mMinimumTimeAvailable(0.0025)
+    , mGPUCorrection(1.0)
 {
     setSupportsDisplayList(false);
     setCullingActive(false);
@@ -35,6 +46,33 @@ void CompositeMapRenderer::setWorkQueue(SceneUtil::WorkQueue* workQueue)
     mWorkQueue = workQueue;
 }
 
+void CompositeMapRenderer::updateGPUCorrection(osg::GLExtensions* ext, unsigned int contextID) const
+{
+    while (!mPendingQueries.empty() && mPendingQueries.front().mContextID == contextID)
+    {
+        const PendingQuery& pending = mPendingQueries.front();
+        GLuint available = 0;
+        ext->glGetQueryObjectuiv(pending.mQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+            break;
+
+        GLuint64EXT gpuTime = 0;
+        ext->glGetQueryObjectui64v(pending.mQuery, GL_QUERY_RESULT, &gpuTime);
+        GLuint query = pending.mQuery;
+        double cpuTime = pending.mCpuTime;
+        ext->glDeleteQueries(1, &query);
+        mPendingQueries.pop_front();
+
+        if (cpuTime <= 0.0)
+            continue;
+
+        double correction = (gpuTime * 1e-9) / cpuTime;
+        correction = std::min(20.0, std::max(0.1, correction));
+        // smooth over the last few frames so a single noisy query does not swing the budget
+        mGPUCorrection = mGPUCorrection * 0.8 + correction * 0.2;
+    }
+}
+
 void CompositeMapRenderer::drawImplementation(osg::RenderInfo &renderInfo) const
 {
     double dt = mTimer.time_s();
@@ -48,11 +86,31 @@ void CompositeMapRenderer::drawImplementation(osg::RenderInfo &renderInfo) const
     if (mWorkQueue)
         mUnrefQueue->flush(mWorkQueue.get());
 
+    osg::State& state = *renderInfo.getState();
+    osg::GLExtensions* ext = state.get<osg::GLExtensions>();
+    const bool useTimerQueries = ext && ext->isTimerQuerySupported;
+
+    if (useTimerQueries)
+    {
+        updateGPUCorrection(ext, state.getContextID());
+        // The CPU-side timer below only sees command submission; when the driver
+        // defers the real work to the GPU, scale the budget down accordingly.
+        availableTime = std::max(availableTime / mGPUCorrection, mMinimumTimeAvailable);
+    }
+
     std::lock_guard<std::mutex> lock(mMutex);
 
     if (mImmediateCompileSet.empty() && mCompileSet.empty())
         return;
 
+    GLuint query = 0;
+    osg::Timer compileTimer;
+    if (useTimerQueries)
+    {
+        ext->glGenQueries(1, &query);
+        ext->glBeginQuery(GL_TIME_ELAPSED, query);
+    }
+
     while (!mImmediateCompileSet.empty())
     {
         osg::ref_ptr<CompositeMap> node = *mImmediateCompileSet.begin();
@@ -81,6 +139,13 @@ void CompositeMapRenderer::drawImplementation(osg::RenderInfo &renderInfo) const
             mCompileSet.insert(node);
         }
     }
+
+    if (useTimerQueries)
+    {
+        ext->glEndQuery(GL_TIME_ELAPSED);
+        mPendingQueries.push_back({query, state.getContextID(), compileTimer.time_s()});
+    }
+
     mTimer.setStartTick();
 }
 
@@ -203,6 +268,7 @@ unsigned int CompositeMapRenderer::getCompileSetSize() const
 
 CompositeMap::CompositeMap()
     : mCompiled(0)
+    , mPriority(0.f)
 {
 }
 
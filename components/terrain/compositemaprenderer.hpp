@@ -3,12 +3,14 @@
 
 #include <osg/Drawable>
 
+#include <deque>
 #include <set>
 #include <mutex>
 
 namespace osg
 {
     class FrameBufferObject;
+    class GLExtensions;
     class RenderInfo;
     class Texture2D;
 }
@@ -30,6 +32,7 @@ namespace Terrain
         std::vector<osg::ref_ptr<osg::Drawable> > mDrawables;
         osg::ref_ptr<osg::Texture2D> mTexture;
         unsigned int mCompiled;
+        float mPriority; // approximate screen-space contribution, higher compiles first
     };
 
     /**
@@ -54,7 +57,8 @@ namespace Terrain
         /// If current frame rate is higher than this, the extra time will be set aside to do more compiling
         void setTargetFrameRate(float framerate);
 
-        /// Add a composite map to be rendered
+        /// Add a composite map to be rendered. Non-immediate maps are compiled in
+        /// order of their mPriority, set before the map is added.
         void addCompositeMap(CompositeMap* map, bool immediate=false);
 
         /// Mark this composite map to be required for the current frame
@@ -70,13 +74,38 @@ namespace Terrain
         osg::ref_ptr<SceneUtil::UnrefQueue> mUnrefQueue;
         osg::ref_ptr<SceneUtil::WorkQueue> mWorkQueue;
 
-        typedef std::set<osg::ref_ptr<CompositeMap> > CompileSet;
+        struct CompareByPriority
+        {
+            bool operator()(const osg::ref_ptr<CompositeMap>& left, const osg::ref_ptr<CompositeMap>& right) const
+            {
+                if (left->mPriority != right->mPriority)
+                    return left->mPriority > right->mPriority;
+                return left < right; // arbitrary but stable tie breaker
+            }
+        };
+
+        typedef std::set<osg::ref_ptr<CompositeMap>, CompareByPriority> CompileSet;
 
         mutable CompileSet mCompileSet;
         mutable CompileSet mImmediateCompileSet;
 
         mutable std::mutex mMutex;
 
+        /// Poll finished GPU timer queries and update the budget correction factor.
+        void updateGPUCorrection(osg::GLExtensions* ext, unsigned int contextID) const;
+
+        struct PendingQuery
+        {
+            unsigned int mQuery;
+            unsigned int mContextID;
+            double mCpuTime;
+        };
+        mutable std::deque<PendingQuery> mPendingQueries;
+        // Ratio of GPU time to CPU time spent compiling, smoothed over the last
+        // few frames; scales down the per-frame budget when the driver defers
+        // the real work to the GPU.
+        mutable double mGPUCorrection;
+
         osg::ref_ptr<osg::FrameBufferObject> mFBO;
     };
 
@@ -4,6 +4,7 @@
 #include <osg/Depth>
 #include <osg/TexEnvCombine>
 #include <osg/Texture2D>
+#include <osg/Texture2DArray>
 #include <osg/TexMat>
 #include <osg/BlendFunc>
 
@@ -171,7 +172,8 @@ namespace
 namespace Terrain
 {
     std::vector<osg::ref_ptr<osg::StateSet> > createPasses(bool useShaders, Shader::ShaderManager* shaderManager, const std::vector<TextureLayer> &layers,
-                                                           const std::vector<osg::ref_ptr<osg::Texture2D> > &blendmaps, int blendmapScale, float layerTileSize)
+                                                           const std::vector<osg::ref_ptr<osg::Texture2D> > &blendmaps, int blendmapScale, float layerTileSize,
+                                                           const osg::Vec2f* morphRange)
     {
         std::vector<osg::ref_ptr<osg::StateSet> > passes;
 
@@ -232,6 +234,7 @@ namespace Terrain
                 defineMap["blendMap"] = (!blendmaps.empty()) ? "1" : "0";
                 defineMap["specularMap"] = it->mSpecular ? "1" : "0";
                 defineMap["parallax"] = (it->mNormalMap && it->mParallax) ? "1" : "0";
+                defineMap["geomorph"] = morphRange ? "1" : "0";
 
                 osg::ref_ptr<osg::Shader> vertexShader = shaderManager->getShader("terrain_vertex.glsl", defineMap, osg::Shader::VERTEX);
                 osg::ref_ptr<osg::Shader> fragmentShader = shaderManager->getShader("terrain_fragment.glsl", defineMap, osg::Shader::FRAGMENT);
@@ -243,6 +246,8 @@ namespace Terrain
 
                 stateset->setAttributeAndModes(shaderManager->getProgram(vertexShader, fragmentShader));
                 stateset->addUniform(new osg::Uniform("colorMode", 2));
+                if (morphRange)
+                    stateset->addUniform(new osg::Uniform("morphRange", *morphRange));
             }
             else
             {
@@ -276,4 +281,68 @@ namespace Terrain
         return passes;
     }
 
+    osg::ref_ptr<osg::StateSet> createSinglePass(Shader::ShaderManager* shaderManager,
+                                                 const osg::ref_ptr<osg::Texture2DArray>& layerArray, unsigned int layerCount,
+                                                 const std::vector<osg::ref_ptr<osg::Texture2D> >& packedBlendmaps, int blendmapScale, float layerTileSize,
+                                                 const osg::Vec2f* morphRange)
+    {
+        osg::ref_ptr<osg::StateSet> stateset (new osg::StateSet);
+
+        int texunit = 0;
+        stateset->setTextureAttributeAndModes(texunit, layerArray);
+        if (layerTileSize != 1.f)
+            stateset->setTextureAttributeAndModes(texunit, LayerTexMat::value(layerTileSize), osg::StateAttribute::ON);
+        stateset->addUniform(new osg::Uniform("diffuseArray", texunit));
+
+        std::string blendMapIndexList;
+        for (unsigned int i = 0; i < packedBlendmaps.size(); ++i)
+        {
+            ++texunit;
+            stateset->setTextureAttributeAndModes(texunit, packedBlendmaps[i].get());
+            if (i == 0)
+            {
+                // All packed blendmaps share the same coordinates; the shader reads
+                // gl_TextureMatrix[1] once.
+                stateset->setTextureAttributeAndModes(texunit, BlendmapTexMat::value(blendmapScale));
+            }
+            stateset->addUniform(new osg::Uniform(("blendMap" + std::to_string(i)).c_str(), texunit));
+
+            if (!blendMapIndexList.empty())
+                blendMapIndexList += ",";
+            blendMapIndexList += std::to_string(i);
+        }
+
+        std::string layerIndexList;
+        for (unsigned int i = 0; i < layerCount; ++i)
+        {
+            if (!layerIndexList.empty())
+                layerIndexList += ",";
+            layerIndexList += std::to_string(i);
+        }
+
+        Shader::ShaderManager::DefineMap defineMap;
+        // The single-pass material only handles plain diffuse layers; chunks with
+        // normal/specular mapped layers take the multipass path.
+        defineMap["normalMap"] = "0";
+        defineMap["blendMap"] = "1";
+        defineMap["specularMap"] = "0";
+        defineMap["parallax"] = "0";
+        defineMap["blendMapIndexList"] = blendMapIndexList;
+        defineMap["layerIndexList"] = layerIndexList;
+        defineMap["paddedLayerCount"] = std::to_string(4 * packedBlendmaps.size());
+        defineMap["geomorph"] = morphRange ? "1" : "0";
+
+        osg::ref_ptr<osg::Shader> vertexShader = shaderManager->getShader("terrain_vertex.glsl", defineMap, osg::Shader::VERTEX);
+        osg::ref_ptr<osg::Shader> fragmentShader = shaderManager->getShader("terrain_layers_fragment.glsl", defineMap, osg::Shader::FRAGMENT);
+        if (!vertexShader || !fragmentShader)
+            return nullptr; // error already logged, caller falls back to multipass
+
+        stateset->setAttributeAndModes(shaderManager->getProgram(vertexShader, fragmentShader));
+        stateset->addUniform(new osg::Uniform("colorMode", 2));
+        if (morphRange)
+            stateset->addUniform(new osg::Uniform("morphRange", *morphRange));
+
+        return stateset;
+    }
+
 }
@@ -2,12 +2,14 @@
 #define COMPONENTS_TERRAIN_MATERIAL_H
 
 #include <osg/StateSet>
+#include <osg/Vec2f>
 
 #include "defs.hpp"
 
 namespace osg
 {
     class Texture2D;
+    class Texture2DArray;
 }
 
 namespace Shader
@@ -26,9 +28,21 @@ namespace Terrain
         bool mSpecular;
     };
 
+    /// @param morphRange when non-null, the shader passes geomorph between LOD levels:
+    /// x = distance where morphing starts, y = 1 / (morph end - morph start).
+    /// The geometry must carry the per-vertex height deltas in attribute 8 (aMorphHeight).
     std::vector<osg::ref_ptr<osg::StateSet> > createPasses(bool useShaders, Shader::ShaderManager* shaderManager,
                                                            const std::vector<TextureLayer>& layers,
-                                                           const std::vector<osg::ref_ptr<osg::Texture2D> >& blendmaps, int blendmapScale, float layerTileSize);
+                                                           const std::vector<osg::ref_ptr<osg::Texture2D> >& blendmaps, int blendmapScale, float layerTileSize,
+                                                           const osg::Vec2f* morphRange = nullptr);
+
+    /// Single state set compositing all layers in one pass: the layer textures are stacked
+    /// in a texture array and the blendmaps packed four layers per RGBA texture.
+    /// Returns nullptr if the shaders fail to load; the caller should use createPasses instead.
+    osg::ref_ptr<osg::StateSet> createSinglePass(Shader::ShaderManager* shaderManager,
+                                                 const osg::ref_ptr<osg::Texture2DArray>& layerArray, unsigned int layerCount,
+                                                 const std::vector<osg::ref_ptr<osg::Texture2D> >& packedBlendmaps, int blendmapScale, float layerTileSize,
+                                                 const osg::Vec2f* morphRange = nullptr);
 
 }
 
@@ -47,7 +47,9 @@ namespace Terrain
         {
         public:
             virtual ~ChunkManager(){}
-            virtual osg::ref_ptr<osg::Node> getChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags, bool activeGrid, const osg::Vec3f& viewPoint, bool compile) = 0;
+            /// @param abort If non-null, may be polled during chunk creation; when it becomes true
+            /// the chunk manager should stop as soon as possible and return nullptr without caching.
+            virtual osg::ref_ptr<osg::Node> getChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags, bool activeGrid, const osg::Vec3f& viewPoint, bool compile, const std::atomic<bool>* abort) = 0;
             virtual unsigned int getNodeMask() { return 0; }
 
             void setViewDistance(float viewDistance) { mViewDistance = viewDistance; }
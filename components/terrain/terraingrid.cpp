@@ -64,7 +64,7 @@ osg::ref_ptr<osg::Node> TerrainGrid::buildTerrain (osg::Group* parent, float chu
     }
     else
     {
-        osg::ref_ptr<osg::Node> node = mChunkManager->getChunk(chunkSize, chunkCenter, 0, 0, false, osg::Vec3f(), true);
+        osg::ref_ptr<osg::Node> node = mChunkManager->getChunk(chunkSize, chunkCenter, 0, 0, false, osg::Vec3f(), true, nullptr);
         if (!node)
             return nullptr;
 
@@ -111,6 +111,43 @@ void TerrainGrid::unloadCell(int x, int y)
     updateWaterCulling();
 }
 
+void TerrainGrid::updateCell(int x, int y)
+{
+    CellBorder::CellGrid::iterator it = mGrid.find(std::make_pair(x,y));
+    if (it == mGrid.end())
+        return; // not loaded
+
+    osg::Vec2f center(x+0.5f, y+0.5f);
+    updateTerrain(it->second, 1.f, center);
+    updateWaterCulling();
+}
+
+void TerrainGrid::updateTerrain (osg::Node* node, float chunkSize, const osg::Vec2f& chunkCenter)
+{
+    if (chunkSize * mNumSplits > 1.f)
+    {
+        // the children line up with the quadrants buildTerrain() split this chunk into
+        osg::Group* group = node->asGroup();
+        if (!group || group->getNumChildren() != 4)
+            return;
+
+        float newChunkSize = chunkSize/2.f;
+        updateTerrain(group->getChild(0), newChunkSize, chunkCenter + osg::Vec2f(newChunkSize/2.f, newChunkSize/2.f));
+        updateTerrain(group->getChild(1), newChunkSize, chunkCenter + osg::Vec2f(newChunkSize/2.f, -newChunkSize/2.f));
+        updateTerrain(group->getChild(2), newChunkSize, chunkCenter + osg::Vec2f(-newChunkSize/2.f, newChunkSize/2.f));
+        updateTerrain(group->getChild(3), newChunkSize, chunkCenter + osg::Vec2f(-newChunkSize/2.f, -newChunkSize/2.f));
+    }
+    else
+    {
+        // the chunk node sits under the transform added in buildTerrain()
+        osg::Group* transform = node->asGroup();
+        if (!transform || !transform->getNumChildren())
+            return;
+
+        mChunkManager->updateChunkVertices(transform->getChild(0), chunkSize, chunkCenter, 0);
+    }
+}
+
 void TerrainGrid::updateWaterCulling()
 {
     if (!mHeightCullCallback) return;
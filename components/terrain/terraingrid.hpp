@@ -26,6 +26,12 @@ namespace Terrain
         /// @note Not thread safe.
         void unloadCell(int x, int y) override;
 
+        /// Re-fill the vertex data of an already loaded cell from the storage, keeping the
+        /// existing chunk structure, materials and composite maps. Much cheaper than an
+        /// unloadCell()/loadCell() round trip; used by the editor to preview height edits.
+        /// @note Not thread safe.
+        void updateCell(int x, int y);
+
         View* createView() override;
 
     protected:
@@ -33,6 +39,7 @@ namespace Terrain
 
     private:
         osg::ref_ptr<osg::Node> buildTerrain (osg::Group* parent, float chunkSize, const osg::Vec2f& chunkCenter);
+        void updateTerrain (osg::Node* node, float chunkSize, const osg::Vec2f& chunkCenter);
         void updateWaterCulling();
 
         // split each ESM::Cell into mNumSplits*mNumSplits terrain chunks
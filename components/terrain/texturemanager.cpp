@@ -2,6 +2,7 @@
 
 #include <osg/Stats>
 #include <osg/Texture2D>
+#include <osg/Texture2DArray>
 
 #include <components/resource/scenemanager.hpp>
 #include <components/resource/imagemanager.hpp>
@@ -27,7 +28,8 @@ struct UpdateTextureFilteringFunctor
 
     void operator()(std::string, osg::Object* obj)
     {
-        mSceneManager->applyFilterSettings(static_cast<osg::Texture2D*>(obj));
+        // The cache holds both plain layer textures and layer arrays.
+        mSceneManager->applyFilterSettings(static_cast<osg::Texture*>(obj));
     }
 };
 
@@ -45,7 +47,7 @@ osg::ref_ptr<osg::Texture2D> TextureManager::getTexture(const std::string &name)
         return static_cast<osg::Texture2D*>(obj.get());
     else
     {
-        osg::ref_ptr<osg::Texture2D> texture (new osg::Texture2D(mSceneManager->getImageManager()->getImage(name)));
+        osg::ref_ptr<osg::Texture2D> texture (new osg::Texture2D(mSceneManager->getImageManager()->getImage(name, /*allowStreaming*/true)));
         texture->setWrap(osg::Texture::WRAP_S, osg::Texture::REPEAT);
         texture->setWrap(osg::Texture::WRAP_T, osg::Texture::REPEAT);
         mSceneManager->applyFilterSettings(texture);
@@ -54,6 +56,48 @@ osg::ref_ptr<osg::Texture2D> TextureManager::getTexture(const std::string &name)
     }
 }
 
+osg::ref_ptr<osg::Texture2DArray> TextureManager::getTextureArray(const std::vector<std::string> &names)
+{
+    std::string key = "array:";
+    for (const std::string& name : names)
+    {
+        key += name;
+        key += ';';
+    }
+
+    osg::ref_ptr<osg::Object> obj = mCache->getRefFromObjectCache(key);
+    if (obj)
+        return static_cast<osg::Texture2DArray*>(obj.get());
+
+    std::vector<osg::ref_ptr<osg::Image>> images;
+    images.reserve(names.size());
+    for (const std::string& name : names)
+        images.push_back(mSceneManager->getImageManager()->getImage(name, /*allowStreaming*/true));
+
+    // All layers of an array must share one size, format and mipmap chain. Vanilla
+    // layer textures do, but replacers may mix resolutions or compression formats;
+    // in that case the chunk keeps the multipass material.
+    for (std::size_t i = 1; i < images.size(); ++i)
+    {
+        if (images[i]->s() != images[0]->s() || images[i]->t() != images[0]->t()
+            || images[i]->getPixelFormat() != images[0]->getPixelFormat()
+            || images[i]->getInternalTextureFormat() != images[0]->getInternalTextureFormat()
+            || images[i]->getNumMipmapLevels() != images[0]->getNumMipmapLevels())
+            return nullptr;
+    }
+
+    osg::ref_ptr<osg::Texture2DArray> texture (new osg::Texture2DArray);
+    texture->setTextureSize(images[0]->s(), images[0]->t(), images.size());
+    for (std::size_t i = 0; i < images.size(); ++i)
+        texture->setImage(i, images[i]);
+    texture->setWrap(osg::Texture::WRAP_S, osg::Texture::REPEAT);
+    texture->setWrap(osg::Texture::WRAP_T, osg::Texture::REPEAT);
+    texture->setResizeNonPowerOfTwoHint(false);
+    mSceneManager->applyFilterSettings(texture);
+    mCache->addEntryToObjectCache(key, texture.get());
+    return texture;
+}
+
 void TextureManager::reportStats(unsigned int frameNumber, osg::Stats *stats) const
 {
     stats->setAttribute(frameNumber, "Terrain Texture", mCache->getCacheSize());
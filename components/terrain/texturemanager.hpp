@@ -2,6 +2,7 @@
 #define OPENMW_COMPONENTS_TERRAIN_TEXTUREMANAGER_H
 
 #include <string>
+#include <vector>
 
 #include <components/resource/resourcemanager.hpp>
 
@@ -13,6 +14,7 @@ namespace Resource
 namespace osg
 {
     class Texture2D;
+    class Texture2DArray;
 }
 
 namespace Terrain
@@ -27,6 +29,11 @@ namespace Terrain
 
         osg::ref_ptr<osg::Texture2D> getTexture(const std::string& name);
 
+        /// Layer textures stacked into a texture array for the single-pass terrain material.
+        /// Returns nullptr if the images can not share an array (mismatched size, format or
+        /// mipmap chain) - the caller is expected to fall back to one pass per layer.
+        osg::ref_ptr<osg::Texture2DArray> getTextureArray(const std::vector<std::string>& names);
+
         void reportStats(unsigned int frameNumber, osg::Stats* stats) const override;
 
     private:
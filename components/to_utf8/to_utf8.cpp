@@ -42,6 +42,60 @@
 // Generated tables
 #include "tables_gen.hpp"
 
+// SSE2 is part of the x86-64 baseline; elsewhere the scalar loop below is
+// used. The ASCII scan is where nearly all of the conversion time goes.
+#if defined(__SSE2__) || (defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+#define OPENMW_TOUTF8_SSE2 1
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+namespace
+{
+#ifdef OPENMW_TOUTF8_SSE2
+    inline int firstSetBit(int mask)
+    {
+#ifdef _MSC_VER
+        unsigned long index = 0;
+        _BitScanForward(&index, static_cast<unsigned long>(mask));
+        return static_cast<int>(index);
+#else
+        return __builtin_ctz(static_cast<unsigned int>(mask));
+#endif
+    }
+#endif
+
+    // Advance over the leading run of printable ASCII bytes, stopping at the
+    // first byte that is either null or has the high bit set. 'end' bounds
+    // the buffer so whole 16-byte blocks can be scanned at once.
+    inline const char* skipAsciiRun(const char* ptr, const char* end)
+    {
+#ifdef OPENMW_TOUTF8_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        while (ptr + 16 <= end)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+            // Bytes >= 128 set their sign bit in the first movemask; null
+            // bytes show up through the comparison against zero.
+            const int mask = _mm_movemask_epi8(block) | _mm_movemask_epi8(_mm_cmpeq_epi8(block, zero));
+            if (mask)
+                return ptr + firstSetBit(mask);
+            ptr += 16;
+        }
+#endif
+        while (ptr != end)
+        {
+            const unsigned char ch = static_cast<unsigned char>(*ptr);
+            if (ch == 0 || ch >= 128)
+                break;
+            ++ptr;
+        }
+        return ptr;
+    }
+}
+
 using namespace ToUTF8;
 
 Utf8Encoder::Utf8Encoder(const FromType sourceEncoding):
@@ -78,6 +132,11 @@ Utf8Encoder::Utf8Encoder(const FromType sourceEncoding):
 }
 
 std::string Utf8Encoder::getUtf8(const char* input, size_t size)
+{
+    return std::string(getUtf8View(input, size));
+}
+
+std::string_view Utf8Encoder::getUtf8View(const char* input, size_t size)
 {
     // Double check that the input string stops at some point (it might
     // contain zero terminators before this, inside its own data, which
@@ -92,20 +151,29 @@ std::string Utf8Encoder::getUtf8(const char* input, size_t size)
 
     // Compute output length, and check for pure ascii input at the same
     // time.
+    const char* end = input + size;
     bool ascii;
-    size_t outlen = getLength(input, ascii);
+    size_t outlen = getLength(input, end, ascii);
 
     // If we're pure ascii, then don't bother converting anything.
     if(ascii)
-        return std::string(input, outlen);
+        return std::string_view(input, outlen);
 
     // Make sure the output is large enough
     resize(outlen);
     char *out = &mOutput[0];
 
-    // Translate
-    while (*input)
+    // Translate, bulk-copying the ASCII runs between escapes
+    while (input != end && *input)
+    {
+        const char* runEnd = skipAsciiRun(input, end);
+        memcpy(out, input, runEnd - input);
+        out += runEnd - input;
+        input = runEnd;
+        if (input == end || !*input)
+            break;
         copyFromArray(*(input++), out);
+    }
 
     // Make sure that we wrote the correct number of bytes
     assert((out-&mOutput[0]) == (int)outlen);
@@ -114,8 +182,8 @@ std::string Utf8Encoder::getUtf8(const char* input, size_t size)
     assert(mOutput.size() > outlen);
     assert(mOutput[outlen] == 0);
 
-    // Return a string
-    return std::string(&mOutput[0], outlen);
+    // Return a view over the internal buffer
+    return std::string_view(&mOutput[0], outlen);
 }
 
 std::string Utf8Encoder::getLegacyEnc(const char *input, size_t size)
@@ -133,8 +201,9 @@ std::string Utf8Encoder::getLegacyEnc(const char *input, size_t size)
 
     // Compute output length, and check for pure ascii input at the same
     // time.
+    const char* end = input + size;
     bool ascii;
-    size_t outlen = getLength2(input, ascii);
+    size_t outlen = getLength2(input, end, ascii);
 
     // If we're pure ascii, then don't bother converting anything.
     if(ascii)
@@ -144,9 +213,17 @@ std::string Utf8Encoder::getLegacyEnc(const char *input, size_t size)
     resize(outlen);
     char *out = &mOutput[0];
 
-    // Translate
-    while(*input)
+    // Translate, bulk-copying the ASCII runs between escapes
+    while (input != end && *input)
+    {
+        const char* runEnd = skipAsciiRun(input, end);
+        memcpy(out, input, runEnd - input);
+        out += runEnd - input;
+        input = runEnd;
+        if (input == end || !*input)
+            break;
         copyFromArray2(input, out);
+    }
 
     // Make sure that we wrote the correct number of bytes
     assert((out-&mOutput[0]) == (int)outlen);
@@ -182,31 +259,32 @@ void Utf8Encoder::resize(size_t size)
   is the case, then the ascii parameter is set to true, and the
   caller can optimize for this case.
  */
-size_t Utf8Encoder::getLength(const char* input, bool &ascii) const
+size_t Utf8Encoder::getLength(const char* input, const char* end, bool &ascii) const
 {
     ascii = true;
     size_t len = 0;
-    const char* ptr = input;
-    unsigned char inp = *ptr;
 
     // Do away with the ascii part of the string first (this is almost
     // always the entire string.)
-    while (inp && inp < 128)
-        inp = *(++ptr);
+    const char* ptr = skipAsciiRun(input, end);
     len += (ptr-input);
 
     // If we're not at the null terminator at this point, then there
-    // were some non-ascii characters to deal with. Go to slow-mode for
-    // the rest of the string.
-    if (inp)
+    // were some non-ascii characters to deal with. The rest of the
+    // string alternates between ASCII runs and escapes.
+    if (ptr != end && *ptr)
     {
         ascii = false;
-        while (inp)
+        while (ptr != end && *ptr)
         {
             // Find the translated length of this character in the
             // lookup table.
-            len += translationArray[inp*6];
-            inp = *(++ptr);
+            len += translationArray[static_cast<unsigned char>(*ptr)*6];
+            ++ptr;
+
+            const char* runEnd = skipAsciiRun(ptr, end);
+            len += (runEnd-ptr);
+            ptr = runEnd;
         }
     }
     return len;
@@ -229,25 +307,23 @@ void Utf8Encoder::copyFromArray(unsigned char ch, char* &out) const
     out += len;
 }
 
-size_t Utf8Encoder::getLength2(const char* input, bool &ascii) const
+size_t Utf8Encoder::getLength2(const char* input, const char* end, bool &ascii) const
 {
     ascii = true;
     size_t len = 0;
-    const char* ptr = input;
-    unsigned char inp = *ptr;
 
     // Do away with the ascii part of the string first (this is almost
     // always the entire string.)
-    while (inp && inp < 128)
-        inp = *(++ptr);
+    const char* ptr = skipAsciiRun(input, end);
     len += (ptr-input);
 
     // If we're not at the null terminator at this point, then there
     // were some non-ascii characters to deal with. Go to slow-mode for
     // the rest of the string.
-    if (inp)
+    if (ptr != end && *ptr)
     {
         ascii = false;
+        unsigned char inp = static_cast<unsigned char>(*ptr);
         while(inp)
         {
             len += 1;
@@ -267,7 +343,8 @@ size_t Utf8Encoder::getLength2(const char* input, bool &ascii) const
                 case 0xc5: len -= 1; break;
             }
 
-            inp = *(++ptr);
+            ++ptr;
+            inp = ptr != end ? static_cast<unsigned char>(*ptr) : 0;
         }
     }
     return len;
@@ -2,6 +2,7 @@
 #define COMPONENTS_TOUTF8_H
 
 #include <string>
+#include <string_view>
 #include <cstring>
 #include <vector>
 
@@ -34,6 +35,11 @@ namespace ToUTF8
                 return getUtf8(str.c_str(), str.size());
             }
 
+            // Same conversion without allocating a return string: the view
+            // points either at the input itself (pure-ASCII case) or into an
+            // internal buffer that stays valid until the next conversion call.
+            std::string_view getUtf8View(const char *input, size_t size);
+
             std::string getLegacyEnc(const char *input, size_t size);
             inline std::string getLegacyEnc(const std::string &str)
             {
@@ -42,9 +48,9 @@ namespace ToUTF8
 
         private:
             void resize(size_t size);
-            size_t getLength(const char* input, bool &ascii) const;
+            size_t getLength(const char* input, const char* end, bool &ascii) const;
             void copyFromArray(unsigned char chp, char* &out) const;
-            size_t getLength2(const char* input, bool &ascii) const;
+            size_t getLength2(const char* input, const char* end, bool &ascii) const;
             void copyFromArray2(const char*& chp, char* &out) const;
 
             std::vector<char> mOutput;
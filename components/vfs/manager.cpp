@@ -1,6 +1,11 @@
 #include "manager.hpp"
 
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <queue>
 #include <stdexcept>
+#include <thread>
 
 #include <components/misc/stringops.hpp>
 
@@ -30,8 +35,130 @@ namespace
 namespace VFS
 {
 
+    /// Serves get requests on a small worker pool, highest priority first.
+    /// Prefetch requests ride the same queue at low priority and just pull the
+    /// data through the archive to warm it up.
+    class Manager::AsyncReader
+    {
+    public:
+        AsyncReader(const Manager& manager)
+            : mManager(manager)
+            , mSerial(0)
+            , mDone(false)
+        {
+            const unsigned int numThreads = std::min(2u, std::max(1u, std::thread::hardware_concurrency()));
+            for (unsigned int i = 0; i < numThreads; ++i)
+                mThreads.emplace_back([this] { run(); });
+        }
+
+        ~AsyncReader()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mDone = true;
+            }
+            mCondition.notify_all();
+            for (std::thread& thread : mThreads)
+                thread.join();
+        }
+
+        std::future<Files::IStreamPtr> enqueue(std::string normalizedName, int priority)
+        {
+            Request request;
+            request.mName = std::move(normalizedName);
+            request.mPriority = priority;
+            request.mPromise.reset(new std::promise<Files::IStreamPtr>);
+            std::future<Files::IStreamPtr> future = request.mPromise->get_future();
+            push(std::move(request));
+            return future;
+        }
+
+        void prefetch(std::string normalizedName)
+        {
+            Request request;
+            request.mName = std::move(normalizedName);
+            request.mPriority = std::numeric_limits<int>::min();
+            push(std::move(request));
+        }
+
+    private:
+        struct Request
+        {
+            std::string mName;
+            int mPriority;
+            std::uint64_t mSerial;
+            // null for prefetch requests, which have no consumer
+            std::shared_ptr<std::promise<Files::IStreamPtr>> mPromise;
+        };
+
+        struct RequestOrder
+        {
+            bool operator()(const Request& left, const Request& right) const
+            {
+                if (left.mPriority != right.mPriority)
+                    return left.mPriority < right.mPriority;
+                return left.mSerial > right.mSerial; // FIFO within a priority
+            }
+        };
+
+        void push(Request&& request)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                request.mSerial = mSerial++;
+                mQueue.push(std::move(request));
+            }
+            mCondition.notify_one();
+        }
+
+        void run()
+        {
+            for (;;)
+            {
+                Request request;
+                {
+                    std::unique_lock<std::mutex> lock(mMutex);
+                    mCondition.wait(lock, [this] { return mDone || !mQueue.empty(); });
+                    if (mDone)
+                        return;
+                    request = mQueue.top();
+                    mQueue.pop();
+                }
+
+                try
+                {
+                    Files::IStreamPtr stream = mManager.getNormalized(request.mName);
+                    if (request.mPromise)
+                        request.mPromise->set_value(std::move(stream));
+                    else
+                    {
+                        // Prefetch: drain the stream so the underlying pages
+                        // (and decompressed archive data) end up in the cache.
+                        char buffer[4096];
+                        while (stream->read(buffer, sizeof(buffer)))
+                            ;
+                    }
+                }
+                catch (std::exception&)
+                {
+                    if (request.mPromise)
+                        request.mPromise->set_exception(std::current_exception());
+                }
+            }
+        }
+
+        const Manager& mManager;
+        std::uint64_t mSerial;
+        bool mDone;
+        std::priority_queue<Request, std::vector<Request>, RequestOrder> mQueue;
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        std::vector<std::thread> mThreads;
+    };
+
     Manager::Manager(bool strict)
         : mStrict(strict)
+        , mIndex(FileMap::key_compare(strict))
     {
 
     }
@@ -43,6 +170,11 @@ namespace VFS
 
     void Manager::reset()
     {
+        // Stop the workers before pulling the index out from under them
+        {
+            std::lock_guard<std::mutex> lock(mAsyncReaderMutex);
+            mAsyncReader.reset();
+        }
         mIndex.clear();
         for (std::vector<Archive*>::iterator it = mArchives.begin(); it != mArchives.end(); ++it)
             delete *it;
@@ -58,32 +190,67 @@ namespace VFS
     {
         mIndex.clear();
 
-        for (std::vector<Archive*>::const_iterator it = mArchives.begin(); it != mArchives.end(); ++it)
-            (*it)->listResources(mIndex, mStrict ? &strict_normalize_char : &nonstrict_normalize_char);
+        char (*normalize_char)(char) = mStrict ? &strict_normalize_char : &nonstrict_normalize_char;
+
+        // Each archive walks its directory tree or parses its BSA header
+        // independently, so list them all concurrently and only the merge
+        // needs to run in registration order (later archives take priority).
+        std::vector<std::future<std::map<std::string, File*>>> listings;
+        listings.reserve(mArchives.size());
+        for (Archive* archive : mArchives)
+            listings.push_back(std::async(std::launch::async, [archive, normalize_char]
+            {
+                std::map<std::string, File*> listing;
+                archive->listResources(listing, normalize_char);
+                return listing;
+            }));
+
+        for (std::future<std::map<std::string, File*>>& listing : listings)
+            for (const auto& entry : listing.get())
+                mIndex[entry.first] = entry.second;
     }
 
     Files::IStreamPtr Manager::get(const std::string &name) const
     {
-        std::string normalized = name;
-        normalize_path(normalized, mStrict);
-
-        return getNormalized(normalized);
+        // The index comparator normalizes on the fly, so no normalized copy
+        // needs to be built for the lookup itself.
+        const auto found = mIndex.find(name);
+        if (found == mIndex.end())
+            throw std::runtime_error("Resource '" + normalizeFilename(name) + "' not found");
+        return found->second->open();
     }
 
     Files::IStreamPtr Manager::getNormalized(const std::string &normalizedName) const
     {
-        std::map<std::string, File*>::const_iterator found = mIndex.find(normalizedName);
+        const auto found = mIndex.find(normalizedName);
         if (found == mIndex.end())
             throw std::runtime_error("Resource '" + normalizedName + "' not found");
         return found->second->open();
     }
 
-    bool Manager::exists(const std::string &name) const
+    std::future<Files::IStreamPtr> Manager::getAsync(const std::string &name, int priority) const
     {
-        std::string normalized = name;
-        normalize_path(normalized, mStrict);
+        return getAsyncReader().enqueue(normalizeFilename(name), priority);
+    }
+
+    void Manager::prefetch(const std::string &name) const
+    {
+        if (mIndex.find(name) == mIndex.end())
+            return;
+        getAsyncReader().prefetch(normalizeFilename(name));
+    }
 
-        return mIndex.find(normalized) != mIndex.end();
+    Manager::AsyncReader& Manager::getAsyncReader() const
+    {
+        std::lock_guard<std::mutex> lock(mAsyncReaderMutex);
+        if (!mAsyncReader)
+            mAsyncReader.reset(new AsyncReader(*this));
+        return *mAsyncReader;
+    }
+
+    bool Manager::exists(const std::string &name) const
+    {
+        return mIndex.find(name) != mIndex.end();
     }
 
     std::string Manager::normalizeFilename(const std::string& name) const
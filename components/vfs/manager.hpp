@@ -3,6 +3,12 @@
 
 #include <components/files/constrainedfilestream.hpp>
 
+#include <components/misc/stringops.hpp>
+
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string_view>
 #include <vector>
 #include <map>
 
@@ -12,13 +18,43 @@ namespace VFS
     class Archive;
     class File;
 
+    /// Orders paths as if both sides were normalized: slashes and backslashes
+    /// compare equal and, in non-strict mode, case is folded. The index keys are
+    /// stored normalized, so lookups can probe with the caller's path directly
+    /// without allocating a normalized copy.
+    class PathLess
+    {
+    public:
+        using is_transparent = void;
+
+        explicit PathLess(bool strict = false) : mStrict(strict) {}
+
+        bool operator()(std::string_view left, std::string_view right) const
+        {
+            return std::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end(),
+                [this] (char l, char r) { return normalize(l) < normalize(r); });
+        }
+
+    private:
+        char normalize(char ch) const
+        {
+            if (ch == '\\')
+                return '/';
+            return mStrict ? ch : Misc::StringUtils::toLower(ch);
+        }
+
+        bool mStrict;
+    };
+
+    typedef std::map<std::string, File*, PathLess> FileMap;
+
     class RecursiveDirectoryIterator;
     RecursiveDirectoryIterator end(const RecursiveDirectoryIterator& iter);
 
     class RecursiveDirectoryIterator
     {
     public:
-        RecursiveDirectoryIterator(const std::map<std::string, File*>& index, const std::string& path)
+        RecursiveDirectoryIterator(const FileMap& index, const std::string& path)
             : mPath(path)
             , mIndex(&index)
             , mIt(index.lower_bound(path))
@@ -44,8 +80,8 @@ namespace VFS
         static bool starts_with(const std::string& text, const std::string& start) { return text.rfind(start, 0) == 0; }
 
         std::string mPath;
-        const std::map<std::string, File*>* mIndex;
-        std::map<std::string, File*>::const_iterator mIt;
+        const FileMap* mIndex;
+        FileMap::const_iterator mIt;
     };
 
     inline RecursiveDirectoryIterator begin(RecursiveDirectoryIterator iter) { return iter; }
@@ -99,6 +135,18 @@ namespace VFS
         /// @note May be called from any thread once the index has been built.
         Files::IStreamPtr getNormalized(const std::string& normalizedName) const;
 
+        /// Retrieve a file by name on a background worker, serving higher priority
+        /// requests first. A missing file surfaces as an exception on the future.
+        /// @note May be called from any thread once the index has been built.
+        std::future<Files::IStreamPtr> getAsync(const std::string& name, int priority = 0) const;
+
+        /// Hint that the given file is likely to be requested soon. The data is
+        /// pulled through the archive at low priority on a background worker, so
+        /// it is warm by the time a get() for it comes in. Unknown names are
+        /// silently ignored.
+        /// @note May be called from any thread once the index has been built.
+        void prefetch(const std::string& name) const;
+
         std::string getArchive(const std::string& name) const;
 
         /// Recursivly iterate over the elements of the given path
@@ -108,11 +156,18 @@ namespace VFS
         RecursiveDirectoryIterator getRecursiveDirectoryIterator(const std::string& path) const;
 
     private:
+        class AsyncReader;
+
+        AsyncReader& getAsyncReader() const;
+
         bool mStrict;
 
         std::vector<Archive*> mArchives;
 
-        std::map<std::string, File*> mIndex;
+        FileMap mIndex;
+
+        mutable std::mutex mAsyncReaderMutex;
+        mutable std::unique_ptr<AsyncReader> mAsyncReader;
     };
 
 }
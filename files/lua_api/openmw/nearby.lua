@@ -32,5 +32,13 @@
 -- @param openmw.query#Query query
 -- @return openmw.core#ObjectList
 
+-------------------------------------------------------------------------------
+-- Returns all nearby objects within `radius` of `position`.
+-- Backed by a spatial index, so it is much cheaper than filtering the object lists manually.
+-- @function [parent=#nearby] objectsNearPoint
+-- @param openmw.util#Vector3 position
+-- @param #number radius
+-- @return openmw.core#ObjectList
+
 return nil
 
@@ -16,6 +16,14 @@
 -- @param openmw.query#Query query
 -- @return openmw.core#ObjectList
 
+-------------------------------------------------------------------------------
+-- Returns all objects in the scene within `radius` of `position`.
+-- Backed by a spatial index, so it is much cheaper than filtering the object lists manually.
+-- @function [parent=#world] objectsNearPoint
+-- @param openmw.util#Vector3 position
+-- @param #number radius
+-- @return openmw.core#ObjectList
+
 -------------------------------------------------------------------------------
 -- Loads a named cell
 -- @function [parent=#world] getCellByName
@@ -0,0 +1,100 @@
+#version 120
+
+#if @useUBO
+    #extension GL_ARB_uniform_buffer_object : require
+#endif
+
+#if @useGPUShader4
+    #extension GL_EXT_gpu_shader4: require
+#endif
+
+#extension GL_EXT_texture_array : require
+
+varying vec2 uv;
+
+// All blend layers of the chunk, stacked by Terrain::TextureManager.
+uniform sampler2DArray diffuseArray;
+
+// Blendmaps packed four layers per RGBA texture.
+$foreach i @blendMapIndexList
+uniform sampler2D blendMap$i;
+$endforeach
+
+varying float euclideanDepth;
+varying float linearDepth;
+
+#define PER_PIXEL_LIGHTING @forcePPL
+
+#if !PER_PIXEL_LIGHTING
+centroid varying vec3 passLighting;
+centroid varying vec3 shadowDiffuseLighting;
+#endif
+varying vec3 passViewPos;
+varying vec3 passNormal;
+
+#include "vertexcolors.glsl"
+#include "shadows_fragment.glsl"
+#include "lighting.glsl"
+
+void main()
+{
+    vec2 adjustedUV = (gl_TextureMatrix[0] * vec4(uv, 0.0, 1.0)).xy;
+    vec2 blendMapUV = (gl_TextureMatrix[1] * vec4(uv, 0.0, 1.0)).xy;
+
+    float blendWeights[@paddedLayerCount];
+$foreach i @blendMapIndexList
+    {
+        vec4 packedWeights$i = texture2D(blendMap$i, blendMapUV);
+        blendWeights[4*$i+0] = packedWeights$i.r;
+        blendWeights[4*$i+1] = packedWeights$i.g;
+        blendWeights[4*$i+2] = packedWeights$i.b;
+        blendWeights[4*$i+3] = packedWeights$i.a;
+    }
+$endforeach
+
+    // Weighted sum over the layers; the weights of adjacent passes already add
+    // up to one in the multipass material, so no renormalization is needed.
+    vec3 diffuse = vec3(0.0);
+$foreach i @layerIndexList
+    diffuse += texture2DArray(diffuseArray, vec3(adjustedUV, float($i))).xyz * blendWeights[$i];
+$endforeach
+
+    gl_FragData[0] = vec4(diffuse, 1.0);
+
+    vec4 diffuseColor = getDiffuseColor();
+    gl_FragData[0].a *= diffuseColor.a;
+
+    float shadowing = unshadowedLightRatio(linearDepth);
+    vec3 lighting;
+#if !PER_PIXEL_LIGHTING
+    lighting = passLighting + shadowDiffuseLighting * shadowing;
+#else
+    vec3 viewNormal = gl_NormalMatrix * normalize(passNormal);
+    vec3 diffuseLight, ambientLight;
+    doLighting(passViewPos, normalize(viewNormal), shadowing, diffuseLight, ambientLight);
+    lighting = diffuseColor.xyz * diffuseLight + getAmbientColor().xyz * ambientLight + getEmissionColor().xyz;
+    clampLightingResult(lighting);
+#endif
+
+    gl_FragData[0].xyz *= lighting;
+
+    float shininess = gl_FrontMaterial.shininess;
+    vec3 matSpec = getSpecularColor().xyz;
+
+    if (matSpec != vec3(0.0))
+    {
+#if !PER_PIXEL_LIGHTING
+        vec3 viewNormal = gl_NormalMatrix * normalize(passNormal);
+#endif
+        gl_FragData[0].xyz += getSpecular(normalize(viewNormal), normalize(passViewPos), shininess, matSpec) * shadowing;
+    }
+
+#if @radialFog
+    float fogValue = clamp((euclideanDepth - gl_Fog.start) * gl_Fog.scale, 0.0, 1.0);
+#else
+    float fogValue = clamp((linearDepth - gl_Fog.start) * gl_Fog.scale, 0.0, 1.0);
+#endif
+    gl_FragData[0].xyz = mix(gl_FragData[0].xyz, gl_Fog.color.xyz, fogValue);
+
+    applyShadowDebugOverlay();
+}
@@ -10,6 +10,13 @@
 
 uniform mat4 projectionMatrix;
 
+#if @geomorph
+// Difference to the height this vertex has at the next coarser LOD.
+attribute float aMorphHeight;
+// x = distance where morphing starts, y = 1 / (morph end - morph start)
+uniform vec2 morphRange;
+#endif
+
 varying vec2 uv;
 varying float euclideanDepth;
 varying float linearDepth;
@@ -31,9 +38,17 @@ varying vec3 passNormal;
 
 void main(void)
 {
-    gl_Position = projectionMatrix * (gl_ModelViewMatrix * gl_Vertex);
+    vec4 vertex = gl_Vertex;
+#if @geomorph
+    // Blend towards the height of the next coarser LOD with distance so the
+    // transition is already completed when the quad tree actually switches.
+    float morphDist = length((gl_ModelViewMatrix * vertex).xyz);
+    vertex.z += aMorphHeight * clamp((morphDist - morphRange.x) * morphRange.y, 0.0, 1.0);
+#endif
+
+    gl_Position = projectionMatrix * (gl_ModelViewMatrix * vertex);
 
-    vec4 viewPos = (gl_ModelViewMatrix * gl_Vertex);
+    vec4 viewPos = (gl_ModelViewMatrix * vertex);
     gl_ClipVertex = viewPos;
     euclideanDepth = length(viewPos.xyz);
     linearDepth = getLinearDepth(gl_Position.z, viewPos.z);